@@ -0,0 +1,71 @@
+/**
+* @file Inputs.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_BENCHMARKS_INPUTS_HPP
+#define NTL_BENCHMARKS_INPUTS_HPP
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "data/Size.hpp"
+#include "data/String.hpp"
+
+namespace ntl::bench {
+  /**
+   * @brief Seed of all generated inputs, so every run measures the same data.
+   */
+  constexpr unsigned SEED = 42;
+
+  /**
+   * @brief Generates uniformly distributed integers.
+   *
+   * @param a_count the number of integers
+   * @param a_max the maximum value (inclusive)
+   * @return the generated integers
+   */
+  inline std::vector<int> RandomIntegers(Size a_count, int a_max = std::numeric_limits<int>::max()) {
+    std::mt19937 random{SEED};
+    std::uniform_int_distribution<int> distribution{0, a_max};
+
+    std::vector<int> result(a_count);
+    for(int& value : result)
+      value = distribution(random);
+    return result;
+  }
+
+  /**
+   * @brief Generates distinct integers in a scrambled order (an odd multiplier permutes the integers).
+   *
+   * @param a_count the number of integers
+   * @return the generated integers
+   */
+  inline std::vector<int> DistinctIntegers(Size a_count) {
+    std::vector<int> result(a_count);
+    for(Size i = 0; i < a_count; ++i)
+      result[i] = static_cast<int>(static_cast<unsigned>(i) * 2654435761u);
+    return result;
+  }
+
+  /**
+   * @brief Generates distinct keys like "key-1234" in random order.
+   *
+   * @param a_count the number of keys
+   * @return the generated keys
+   */
+  inline std::vector<String> RandomKeys(Size a_count) {
+    std::vector<String> result;
+    result.reserve(a_count);
+    for(Size i = 0; i < a_count; ++i)
+      result.push_back(String("key-").Append(i * 2654435761u % 1000003u));
+    std::shuffle(result.begin(), result.end(), std::mt19937{SEED});
+    return result;
+  }
+}
+
+#endif // NTL_BENCHMARKS_INPUTS_HPP
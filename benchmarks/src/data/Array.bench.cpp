@@ -0,0 +1,192 @@
+/**
+* @file Array.bench.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Inputs.hpp"
+#include "core/Algorithms.hpp"
+#include "data/Array.hpp"
+
+namespace {
+  using namespace ntl;
+
+  Array<int> toArray(const std::vector<int>& a_values, bool a_keep_sorted = false) {
+    Array<int> result(a_values.size(), a_keep_sorted);
+    for(const int value : a_values)
+      result.Insert(value);
+    return result;
+  }
+
+  template <algorithms::Sort algorithm>
+  void BM_ArraySort(benchmark::State& a_state) {
+    const auto source = toArray(bench::RandomIntegers(a_state.range(0)));
+
+    for(auto _ : a_state) {
+      a_state.PauseTiming();
+      Array<int> array(source);
+      a_state.ResumeTiming();
+
+      array.Sort(algorithm);
+      benchmark::DoNotOptimize(array.GetData());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_StdSort(benchmark::State& a_state) {
+    const auto source = bench::RandomIntegers(a_state.range(0));
+
+    for(auto _ : a_state) {
+      a_state.PauseTiming();
+      std::vector<int> vector(source);
+      a_state.ResumeTiming();
+
+      std::sort(vector.begin(), vector.end());
+      benchmark::DoNotOptimize(vector.data());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_ArrayFindUnsorted(benchmark::State& a_state) {
+    const auto values = bench::RandomIntegers(a_state.range(0));
+    const auto array = toArray(values);
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      benchmark::DoNotOptimize(array.Find(values[next]));
+      next = (next + 7919) % values.size();
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_StdFind(benchmark::State& a_state) {
+    const auto values = bench::RandomIntegers(a_state.range(0));
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      benchmark::DoNotOptimize(std::find(values.begin(), values.end(), values[next]));
+      next = (next + 7919) % values.size();
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_ArrayFindSorted(benchmark::State& a_state) {
+    const auto values = bench::RandomIntegers(a_state.range(0));
+    auto array = toArray(values);
+    array.Sort();
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      benchmark::DoNotOptimize(array.Find(values[next]));
+      next = (next + 7919) % values.size();
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_StdLowerBound(benchmark::State& a_state) {
+    const auto values = bench::RandomIntegers(a_state.range(0));
+    auto sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      benchmark::DoNotOptimize(std::lower_bound(sorted.begin(), sorted.end(), values[next]));
+      next = (next + 7919) % values.size();
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_ArrayInsert(benchmark::State& a_state) {
+    const auto values = bench::RandomIntegers(a_state.range(0));
+    const bool keep_sorted = a_state.range(1) != 0;
+
+    for(auto _ : a_state) {
+      Array<int> array(values.size(), keep_sorted);
+      for(const int value : values)
+        array.Insert(value);
+      benchmark::DoNotOptimize(array.GetData());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_StdVectorPushBack(benchmark::State& a_state) {
+    const auto values = bench::RandomIntegers(a_state.range(0));
+
+    for(auto _ : a_state) {
+      std::vector<int> vector;
+      vector.reserve(values.size());
+      for(const int value : values)
+        vector.push_back(value);
+      benchmark::DoNotOptimize(vector.data());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_StdVectorInsertSorted(benchmark::State& a_state) {
+    const auto values = bench::RandomIntegers(a_state.range(0));
+
+    for(auto _ : a_state) {
+      std::vector<int> vector;
+      vector.reserve(values.size());
+      for(const int value : values)
+        vector.insert(std::upper_bound(vector.begin(), vector.end(), value), value);
+      benchmark::DoNotOptimize(vector.data());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  // sums through the subscript operator, which should vectorize like the loop over the raw data
+  void BM_ArrayIndexedSum(benchmark::State& a_state) {
+    const auto array = toArray(bench::RandomIntegers(a_state.range(0)));
+
+    for(auto _ : a_state) {
+      I64 sum = 0;
+      for(Size i = 0; i < array.GetSize(); ++i)
+        sum += array[i];
+      benchmark::DoNotOptimize(sum);
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_RawIndexedSum(benchmark::State& a_state) {
+    const auto array = toArray(bench::RandomIntegers(a_state.range(0)));
+    const int* data = array.GetData();
+
+    for(auto _ : a_state) {
+      I64 sum = 0;
+      for(Size i = 0; i < array.GetSize(); ++i)
+        sum += data[i];
+      benchmark::DoNotOptimize(sum);
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+}
+
+// quadratic algorithms only get small inputs
+BENCHMARK_TEMPLATE(BM_ArraySort, ntl::algorithms::Sort::DYNAMIC)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ArraySort, ntl::algorithms::Sort::INSERTION_SORT)->Range(1 << 6, 1 << 12);
+BENCHMARK_TEMPLATE(BM_ArraySort, ntl::algorithms::Sort::QUICK_SORT)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ArraySort, ntl::algorithms::Sort::MERGE_SORT)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ArraySort, ntl::algorithms::Sort::INTRO_SORT)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ArraySort, ntl::algorithms::Sort::HEAP_SORT)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ArraySort, ntl::algorithms::Sort::PARALLEL_MERGE_SORT)->Range(1 << 10, 1 << 20)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ArraySort, ntl::algorithms::Sort::RADIX_SORT)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_StdSort)->Range(1 << 10, 1 << 20);
+
+BENCHMARK(BM_ArrayFindUnsorted)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_StdFind)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_ArrayFindSorted)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_StdLowerBound)->Range(1 << 8, 1 << 20);
+
+BENCHMARK(BM_ArrayInsert)->ArgsProduct({{1 << 10, 1 << 14}, {0, 1}});
+BENCHMARK(BM_StdVectorPushBack)->Range(1 << 10, 1 << 14);
+BENCHMARK(BM_StdVectorInsertSorted)->Range(1 << 10, 1 << 14);
+
+BENCHMARK(BM_ArrayIndexedSum)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_RawIndexedSum)->Range(1 << 10, 1 << 16);
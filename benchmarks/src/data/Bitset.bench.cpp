@@ -0,0 +1,138 @@
+/**
+* @file Bitset.bench.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <bitset>
+
+#include "Inputs.hpp"
+#include "data/Bitset.hpp"
+
+namespace {
+  using namespace ntl;
+
+  constexpr Size BITS = 1 << 16;
+
+  template <typename T>
+  void randomize(T& a_bitset, unsigned a_offset) {
+    for(const int index : bench::RandomIntegers(BITS / 4, BITS - 1))
+      a_bitset.Set((static_cast<Size>(index) + a_offset) % BITS);
+  }
+
+  void randomize(std::bitset<BITS>& a_bitset, unsigned a_offset) {
+    for(const int index : bench::RandomIntegers(BITS / 4, BITS - 1))
+      a_bitset.set((static_cast<Size>(index) + a_offset) % BITS);
+  }
+
+  template <BitsetStorage storage>
+  void BM_BitsetSet(benchmark::State& a_state) {
+    const auto indices = bench::RandomIntegers(BITS, BITS - 1);
+    Bitset<BITS, storage> bitset;
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      bitset.Set(indices[next]);
+      next = (next + 1) % indices.size();
+    }
+    benchmark::DoNotOptimize(bitset.GetCount());
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_StdBitsetSet(benchmark::State& a_state) {
+    const auto indices = bench::RandomIntegers(BITS, BITS - 1);
+    std::bitset<BITS> bitset;
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      bitset.set(indices[next]);
+      next = (next + 1) % indices.size();
+    }
+    benchmark::DoNotOptimize(bitset.count());
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  template <BitsetStorage storage>
+  void BM_BitsetAnd(benchmark::State& a_state) {
+    Bitset<BITS, storage> first, second;
+    randomize(first, 0);
+    randomize(second, 1);
+
+    for(auto _ : a_state) {
+      auto result = first & second;
+      benchmark::DoNotOptimize(result);
+    }
+    a_state.SetBytesProcessed(a_state.iterations() * BITS / 8 * 2);
+  }
+
+  void BM_StdBitsetAnd(benchmark::State& a_state) {
+    std::bitset<BITS> first, second;
+    randomize(first, 0);
+    randomize(second, 1);
+
+    for(auto _ : a_state) {
+      auto result = first & second;
+      benchmark::DoNotOptimize(result);
+    }
+    a_state.SetBytesProcessed(a_state.iterations() * BITS / 8 * 2);
+  }
+
+  template <BitsetStorage storage>
+  void BM_BitsetCount(benchmark::State& a_state) {
+    Bitset<BITS, storage> bitset;
+    randomize(bitset, 0);
+
+    for(auto _ : a_state)
+      benchmark::DoNotOptimize(bitset.GetCount());
+    a_state.SetBytesProcessed(a_state.iterations() * BITS / 8);
+  }
+
+  void BM_StdBitsetCount(benchmark::State& a_state) {
+    std::bitset<BITS> bitset;
+    randomize(bitset, 0);
+
+    for(auto _ : a_state)
+      benchmark::DoNotOptimize(bitset.count());
+    a_state.SetBytesProcessed(a_state.iterations() * BITS / 8);
+  }
+
+  void BM_PackedBitsetInPlaceOps(benchmark::State& a_state) {
+    PackedBitset<BITS> first, second;
+    randomize(first, 0);
+    randomize(second, 1);
+
+    for(auto _ : a_state) {
+      first |= second;
+      first ^= second;
+      benchmark::DoNotOptimize(first.GetWords());
+    }
+    a_state.SetBytesProcessed(a_state.iterations() * BITS / 8 * 2);
+  }
+
+  void BM_PackedBitsetIterate(benchmark::State& a_state) {
+    PackedBitset<BITS> bitset;
+    randomize(bitset, 0);
+
+    for(auto _ : a_state) {
+      Size sum = 0;
+      for(I64 index = bitset.FindFirst(); index >= 0; index = bitset.FindNext(index))
+        sum += index;
+      benchmark::DoNotOptimize(sum);
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_BitsetSet, ntl::BitsetStorage::BYTE);
+BENCHMARK_TEMPLATE(BM_BitsetSet, ntl::BitsetStorage::PACKED);
+BENCHMARK(BM_StdBitsetSet);
+BENCHMARK_TEMPLATE(BM_BitsetAnd, ntl::BitsetStorage::BYTE);
+BENCHMARK_TEMPLATE(BM_BitsetAnd, ntl::BitsetStorage::PACKED);
+BENCHMARK(BM_StdBitsetAnd);
+BENCHMARK_TEMPLATE(BM_BitsetCount, ntl::BitsetStorage::BYTE);
+BENCHMARK_TEMPLATE(BM_BitsetCount, ntl::BitsetStorage::PACKED);
+BENCHMARK(BM_StdBitsetCount);
+BENCHMARK(BM_PackedBitsetInPlaceOps);
+BENCHMARK(BM_PackedBitsetIterate);
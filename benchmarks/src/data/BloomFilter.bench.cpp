@@ -0,0 +1,38 @@
+/**
+* @file BloomFilter.bench.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "data/BloomFilter.hpp"
+
+namespace {
+  using namespace ntl;
+
+  // 4 MiB of bits at 10 bits per key, so most lookups miss the caches
+  constexpr Size BITS = Size{1} << 25;
+  constexpr Size KEYS = BITS / 10;
+  constexpr Size LOOKUPS = 1 << 16;
+
+  template <typename FilterType>
+  void BM_BloomFilterNegativeLookup(benchmark::State& a_state) {
+    const auto filter = std::make_unique<FilterType>();
+    for(U64 key = 0; key < KEYS; ++key)
+      filter->Insert(key);
+
+    U64 key = KEYS;
+    for(auto _ : a_state) {
+      for(Size i = 0; i < LOOKUPS; ++i)
+        benchmark::DoNotOptimize(filter->MayContain(key++));
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * LOOKUPS);
+  }
+}
+
+BENCHMARK(BM_BloomFilterNegativeLookup<BloomFilter<U64, BITS, BloomHashCount(BITS, KEYS)>>);
+BENCHMARK(BM_BloomFilterNegativeLookup<BlockedBloomFilter<U64, BITS>>);
@@ -0,0 +1,107 @@
+/**
+* @file List.bench.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <queue>
+#include <stack>
+
+#include "data/List.hpp"
+#include "data/Queue.hpp"
+#include "data/Stack.hpp"
+
+// every churn benchmark keeps the container at the size given by the argument,
+// removing and inserting one element per iteration
+
+namespace {
+  using namespace ntl;
+
+  void BM_ListChurn(benchmark::State& a_state) {
+    List<int> list;
+    for(int i = 0; i < a_state.range(0); ++i)
+      list.InsertBack(i);
+
+    for(auto _ : a_state)
+      list.InsertBack(list.RemoveFront());
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_StdListChurn(benchmark::State& a_state) {
+    std::list<int> list;
+    for(int i = 0; i < a_state.range(0); ++i)
+      list.push_back(i);
+
+    for(auto _ : a_state) {
+      const int value = list.front();
+      list.pop_front();
+      list.push_back(value);
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_QueueChurn(benchmark::State& a_state) {
+    Queue<int> queue;
+    for(int i = 0; i < a_state.range(0); ++i)
+      queue.Put(i);
+
+    for(auto _ : a_state)
+      queue.Put(queue.Get());
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_StdQueueChurn(benchmark::State& a_state) {
+    std::queue<int> queue;
+    for(int i = 0; i < a_state.range(0); ++i)
+      queue.push(i);
+
+    for(auto _ : a_state) {
+      const int value = queue.front();
+      queue.pop();
+      queue.push(value);
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  // pushes and pops a burst of elements, as a single push/pop pair would never touch the allocator twice
+  void BM_StackChurn(benchmark::State& a_state) {
+    Stack<int> stack;
+    for(int i = 0; i < a_state.range(0); ++i)
+      stack.Push(i);
+
+    for(auto _ : a_state) {
+      for(int i = 0; i < 64; ++i)
+        stack.Push(i);
+      for(int i = 0; i < 64; ++i)
+        benchmark::DoNotOptimize(stack.Pop());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * 128);
+  }
+
+  void BM_StdStackChurn(benchmark::State& a_state) {
+    std::stack<int> stack;
+    for(int i = 0; i < a_state.range(0); ++i)
+      stack.push(i);
+
+    for(auto _ : a_state) {
+      for(int i = 0; i < 64; ++i)
+        stack.push(i);
+      for(int i = 0; i < 64; ++i) {
+        benchmark::DoNotOptimize(stack.top());
+        stack.pop();
+      }
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * 128);
+  }
+}
+
+BENCHMARK(BM_ListChurn)->Range(1 << 4, 1 << 16);
+BENCHMARK(BM_StdListChurn)->Range(1 << 4, 1 << 16);
+BENCHMARK(BM_QueueChurn)->Range(1 << 4, 1 << 16);
+BENCHMARK(BM_StdQueueChurn)->Range(1 << 4, 1 << 16);
+BENCHMARK(BM_StackChurn)->Range(1 << 4, 1 << 16);
+BENCHMARK(BM_StdStackChurn)->Range(1 << 4, 1 << 16);
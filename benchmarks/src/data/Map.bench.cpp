@@ -0,0 +1,200 @@
+/**
+* @file Map.bench.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Inputs.hpp"
+#include "core/Algorithms.hpp"
+#include "data/Map.hpp"
+
+namespace {
+  using namespace ntl;
+
+  constexpr Size CAPACITY = 1 << 16;
+
+  // grows only when the probe sequences get too long, so the load factor stays at the requested percentage
+  Map<int, int> fill(const std::vector<int>& a_keys) {
+    Map<int, int> map(CAPACITY, algorithms::Hash::FNV1a, 1.0f);
+    for(const int key : a_keys)
+      map.Insert(key, key);
+    return map;
+  }
+
+  std::vector<int> loadedKeys(const benchmark::State& a_state) {
+    return bench::DistinctIntegers(CAPACITY * a_state.range(0) / 100);
+  }
+
+  void BM_MapInsert(benchmark::State& a_state) {
+    const auto keys = loadedKeys(a_state);
+
+    for(auto _ : a_state) {
+      auto map = fill(keys);
+      benchmark::DoNotOptimize(map.GetSize());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * keys.size());
+  }
+
+  void BM_StdUnorderedMapInsert(benchmark::State& a_state) {
+    const auto keys = loadedKeys(a_state);
+
+    for(auto _ : a_state) {
+      std::unordered_map<int, int> map(CAPACITY);
+      for(const int key : keys)
+        map.emplace(key, key);
+      benchmark::DoNotOptimize(map.size());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * keys.size());
+  }
+
+  void BM_MapLookup(benchmark::State& a_state) {
+    const auto keys = loadedKeys(a_state);
+    const auto map = fill(keys);
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      benchmark::DoNotOptimize(map.Exists(keys[next]));
+      // every second lookup misses
+      benchmark::DoNotOptimize(map.Exists(static_cast<int>(next * 2 + 1)));
+      next = (next + 1) % keys.size();
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * 2);
+  }
+
+  void BM_StdUnorderedMapLookup(benchmark::State& a_state) {
+    const auto keys = loadedKeys(a_state);
+    std::unordered_map<int, int> map(CAPACITY);
+    for(const int key : keys)
+      map.emplace(key, key);
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      benchmark::DoNotOptimize(map.contains(keys[next]));
+      benchmark::DoNotOptimize(map.contains(static_cast<int>(next * 2 + 1)));
+      next = (next + 1) % keys.size();
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * 2);
+  }
+
+  // removes and reinserts a key to keep the load factor constant
+  void BM_MapErase(benchmark::State& a_state) {
+    const auto keys = loadedKeys(a_state);
+    auto map = fill(keys);
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      map.Remove(keys[next]);
+      map.Insert(keys[next], 0);
+      next = (next + 1) % keys.size();
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_StdUnorderedMapErase(benchmark::State& a_state) {
+    const auto keys = loadedKeys(a_state);
+    std::unordered_map<int, int> map(CAPACITY);
+    for(const int key : keys)
+      map.emplace(key, key);
+
+    Size next = 0;
+    for(auto _ : a_state) {
+      map.erase(keys[next]);
+      map.emplace(keys[next], 0);
+      next = (next + 1) % keys.size();
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  // grows from a small table, the slowest insertion shows the latency of a resize
+  void BM_MapGrowth(benchmark::State& a_state) {
+    const auto keys = bench::DistinctIntegers(CAPACITY);
+    double slowest = 0;
+
+    for(auto _ : a_state) {
+      Map<int, int> map(16);
+      map.SetIncrementalResize(a_state.range(0) != 0);
+      double round = 0;
+      for(const int key : keys) {
+        const auto begin = std::chrono::steady_clock::now();
+        map.Insert(key, key);
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - begin;
+        round = std::max(round, elapsed.count());
+      }
+      benchmark::DoNotOptimize(map.GetSize());
+      slowest += round;
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * keys.size());
+    // averaged over the iterations, so a single preemption doesn't dominate
+    a_state.counters["max_ns"] = benchmark::Counter(slowest, benchmark::Counter::kAvgIterations);
+  }
+
+  // clears tables up to 64 MiB, which only resets the probe distances of the slots
+  void BM_MapClear(benchmark::State& a_state) {
+    const Size capacity = Size{1} << a_state.range(0);
+    Map<U64, U64> map(capacity, algorithms::Hash::FNV1a, 1.0f);
+
+    for(auto _ : a_state) {
+      a_state.PauseTiming();
+      for(U64 key = 0; key < capacity / 2; ++key)
+        map.Insert(key, key);
+      a_state.ResumeTiming();
+      map.Clear();
+      benchmark::DoNotOptimize(map.GetSize());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * capacity);
+  }
+
+  template <algorithms::Hash algorithm>
+  void BM_MapStringKeys(benchmark::State& a_state) {
+    const auto keys = bench::RandomKeys(a_state.range(0));
+
+    for(auto _ : a_state) {
+      Map<String, int> map(keys.size() * 2, algorithm);
+      for(const String& key : keys)
+        map.Insert(key, 0);
+      for(const String& key : keys)
+        benchmark::DoNotOptimize(map.Get(key));
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * keys.size() * 2);
+  }
+
+  void BM_StdUnorderedMapStringKeys(benchmark::State& a_state) {
+    std::vector<std::string> keys;
+    for(const String& key : bench::RandomKeys(a_state.range(0)))
+      keys.emplace_back(key.GetCString());
+
+    for(auto _ : a_state) {
+      std::unordered_map<std::string, int> map(keys.size() * 2);
+      for(const std::string& key : keys)
+        map.emplace(key, 0);
+      for(const std::string& key : keys)
+        benchmark::DoNotOptimize(map.at(key));
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * keys.size() * 2);
+  }
+}
+
+// the load factor is given in percent
+BENCHMARK(BM_MapInsert)->ArgName("load")->DenseRange(25, 100, 25);
+BENCHMARK(BM_StdUnorderedMapInsert)->ArgName("load")->DenseRange(25, 100, 25);
+BENCHMARK(BM_MapLookup)->ArgName("load")->DenseRange(25, 100, 25);
+BENCHMARK(BM_StdUnorderedMapLookup)->ArgName("load")->DenseRange(25, 100, 25);
+BENCHMARK(BM_MapErase)->ArgName("load")->DenseRange(25, 100, 25);
+BENCHMARK(BM_StdUnorderedMapErase)->ArgName("load")->DenseRange(25, 100, 25);
+BENCHMARK(BM_MapGrowth)->ArgName("incremental")->DenseRange(0, 1);
+BENCHMARK(BM_MapClear)->ArgName("log_capacity")->DenseRange(16, 22, 6)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MapStringKeys, ntl::algorithms::Hash::FNV1a)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_MapStringKeys, ntl::algorithms::Hash::DJB2)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_MapStringKeys, ntl::algorithms::Hash::SDBM)->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_MapStringKeys, ntl::algorithms::Hash::WyHash)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_StdUnorderedMapStringKeys)->Range(1 << 8, 1 << 16);
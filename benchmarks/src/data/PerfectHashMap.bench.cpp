@@ -0,0 +1,68 @@
+/**
+* @file PerfectHashMap.bench.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "data/Array.hpp"
+#include "data/Map.hpp"
+#include "data/PerfectHashMap.hpp"
+#include "data/String.hpp"
+
+namespace {
+  using namespace ntl;
+
+  constexpr Pair<StringView, int> KEYWORDS[] = {
+    {"alignas", 0}, {"alignof", 1}, {"auto", 2}, {"bool", 3}, {"break", 4}, {"case", 5}, {"catch", 6},
+    {"char", 7}, {"class", 8}, {"const", 9}, {"constexpr", 10}, {"continue", 11}, {"default", 12},
+    {"delete", 13}, {"do", 14}, {"double", 15}, {"else", 16}, {"enum", 17}, {"explicit", 18},
+    {"extern", 19}, {"false", 20}, {"float", 21}, {"for", 22}, {"friend", 23}, {"goto", 24}, {"if", 25},
+    {"inline", 26}, {"int", 27}, {"long", 28}, {"mutable", 29}, {"namespace", 30}, {"new", 31},
+    {"noexcept", 32}, {"nullptr", 33}, {"operator", 34}, {"private", 35}, {"protected", 36},
+    {"public", 37}, {"return", 38}, {"short", 39}, {"signed", 40}, {"sizeof", 41}, {"static", 42},
+    {"struct", 43}, {"switch", 44}, {"template", 45}, {"this", 46}, {"throw", 47}, {"true", 48},
+    {"try", 49}, {"typedef", 50}, {"typename", 51}, {"union", 52}, {"unsigned", 53}, {"using", 54},
+    {"virtual", 55}, {"void", 56}, {"volatile", 57}, {"while", 58}
+  };
+
+  constexpr auto KEYWORD_MAP = MakePerfectHashMap(KEYWORDS);
+
+  // every keyword followed by as many identifiers, which are misses
+  Array<String> lookups() {
+    Array<String> result{};
+    for(const auto& [keyword, value] : KEYWORDS) {
+      result.Insert(String(keyword));
+      result.Insert(String(keyword) + "_id");
+    }
+    return result;
+  }
+
+  void BM_PerfectHashMapLookup(benchmark::State& a_state) {
+    const auto words = lookups();
+
+    for(auto _ : a_state) {
+      for(const String& word : words)
+        benchmark::DoNotOptimize(KEYWORD_MAP.TryGet(word));
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * words.GetSize());
+  }
+
+  void BM_MapKeywordLookup(benchmark::State& a_state) {
+    const auto words = lookups();
+    Map<StringView, int> map{};
+    for(const auto& [keyword, value] : KEYWORDS)
+      map.Insert(keyword, value);
+
+    for(auto _ : a_state) {
+      for(const String& word : words)
+        benchmark::DoNotOptimize(map.TryGet(word));
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * words.GetSize());
+  }
+}
+
+BENCHMARK(BM_PerfectHashMapLookup);
+BENCHMARK(BM_MapKeywordLookup);
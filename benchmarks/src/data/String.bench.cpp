@@ -0,0 +1,159 @@
+/**
+* @file String.bench.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <string_view>
+
+#include "data/StaticArray.hpp"
+#include "data/String.hpp"
+#include "data/StringView.hpp"
+
+namespace {
+  using namespace ntl;
+
+  // a comma separated line like "field0,field1,...", sized by the benchmark argument
+  std::string csvLine(Size a_fields) {
+    std::string line;
+    for(Size i = 0; i < a_fields; ++i)
+      line.append(i ? ",field" : "field").append(std::to_string(i));
+    return line;
+  }
+
+  void BM_StringAppend(benchmark::State& a_state) {
+    for(auto _ : a_state) {
+      String string;
+      for(int i = 0; i < a_state.range(0); ++i)
+        string.Append("value=").Append(i).Append(';');
+      benchmark::DoNotOptimize(string.GetCString());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_StdStringAppend(benchmark::State& a_state) {
+    for(auto _ : a_state) {
+      std::string string;
+      for(int i = 0; i < a_state.range(0); ++i)
+        string.append("value=").append(std::to_string(i)).push_back(';');
+      benchmark::DoNotOptimize(string.data());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_StringSplitAtIndex(benchmark::State& a_state) {
+    const String string{csvLine(a_state.range(0)).c_str()};
+
+    for(auto _ : a_state) {
+      auto parts = string.Split(string.GetLength() / 2);
+      benchmark::DoNotOptimize(parts[0].GetCString());
+    }
+  }
+
+  void BM_StdStringSplitAtIndex(benchmark::State& a_state) {
+    const std::string string = csvLine(a_state.range(0));
+
+    for(auto _ : a_state) {
+      std::string first = string.substr(0, string.size() / 2);
+      std::string second = string.substr(string.size() / 2);
+      benchmark::DoNotOptimize(first.data());
+      benchmark::DoNotOptimize(second.data());
+    }
+  }
+
+  void BM_StringViewSplit(benchmark::State& a_state) {
+    const String string{csvLine(a_state.range(0)).c_str()};
+
+    for(auto _ : a_state) {
+      Size length = 0;
+      for(const StringView piece : StringView(string).Split(','))
+        length += piece.GetLength();
+      benchmark::DoNotOptimize(length);
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_StdStringViewSplit(benchmark::State& a_state) {
+    const std::string string = csvLine(a_state.range(0));
+
+    for(auto _ : a_state) {
+      Size length = 0;
+      std::string_view rest = string;
+      for(Size end = rest.find(','); ; end = rest.find(',')) {
+        length += rest.substr(0, end).size();
+        if(end == std::string_view::npos)
+          break;
+        rest.remove_prefix(end + 1);
+      }
+      benchmark::DoNotOptimize(length);
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_StringReplaceAll(benchmark::State& a_state) {
+    const String source{csvLine(a_state.range(0)).c_str()};
+    // shrinking replacements run in place, growing ones allocate once
+    const StringView replacement = a_state.range(1) ? "column" : "f";
+
+    for(auto _ : a_state) {
+      String string{source};
+      string.ReplaceAll("field", replacement);
+      benchmark::DoNotOptimize(string.GetCString());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  void BM_StdStringReplaceAll(benchmark::State& a_state) {
+    const std::string source = csvLine(a_state.range(0));
+    const std::string replacement = a_state.range(1) ? "column" : "f";
+
+    for(auto _ : a_state) {
+      std::string string{source};
+      for(Size at = string.find("field"); at != std::string::npos; at = string.find("field", at + replacement.size()))
+        string.replace(at, 5, replacement);
+      benchmark::DoNotOptimize(string.data());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  template <algorithms::Hash algorithm>
+  void BM_Hash(benchmark::State& a_state) {
+    const std::string key(a_state.range(0), 'k');
+
+    for(auto _ : a_state) {
+      benchmark::DoNotOptimize(key.data());
+      benchmark::DoNotOptimize(hash::Calculate(algorithm, key.data(), key.size()));
+    }
+    a_state.SetBytesProcessed(a_state.iterations() * a_state.range(0));
+  }
+
+  // the cache only pays off for the same string, so the modified string has to hash again
+  void BM_StringGetHash(benchmark::State& a_state) {
+    String string{std::string(a_state.range(0), 'k').c_str()};
+    const bool modified = a_state.range(1);
+
+    for(auto _ : a_state) {
+      if(modified)
+        string[0] = 'k';
+      benchmark::DoNotOptimize(string.GetHash());
+    }
+    a_state.SetBytesProcessed(a_state.iterations() * a_state.range(0));
+  }
+}
+
+BENCHMARK(BM_StringAppend)->Range(1 << 4, 1 << 14);
+BENCHMARK(BM_StdStringAppend)->Range(1 << 4, 1 << 14);
+BENCHMARK(BM_StringSplitAtIndex)->Range(1 << 4, 1 << 14);
+BENCHMARK(BM_StdStringSplitAtIndex)->Range(1 << 4, 1 << 14);
+BENCHMARK(BM_StringViewSplit)->Range(1 << 4, 1 << 14);
+BENCHMARK(BM_StdStringViewSplit)->Range(1 << 4, 1 << 14);
+BENCHMARK(BM_StringReplaceAll)->ArgsProduct({{1 << 4, 1 << 10, 1 << 14}, {0, 1}});
+BENCHMARK(BM_StdStringReplaceAll)->ArgsProduct({{1 << 4, 1 << 10, 1 << 14}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_Hash, ntl::algorithms::Hash::FNV1a)->Range(1 << 3, 1 << 12);
+BENCHMARK_TEMPLATE(BM_Hash, ntl::algorithms::Hash::DJB2)->Range(1 << 3, 1 << 12);
+BENCHMARK_TEMPLATE(BM_Hash, ntl::algorithms::Hash::WyHash)->Range(1 << 3, 1 << 12);
+BENCHMARK(BM_StringGetHash)->ArgsProduct({{1 << 4, 1 << 10}, {0, 1}});
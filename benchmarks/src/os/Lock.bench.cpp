@@ -0,0 +1,120 @@
+/**
+* @file Lock.bench.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <shared_mutex>
+
+#include "os/AdaptiveLock.hpp"
+#include "os/DistributedSharedLock.hpp"
+#include "os/Lock.hpp"
+#include "os/ReadWriteLock.hpp"
+#include "os/SharedLock.hpp"
+#include "os/SpinLock.hpp"
+
+// all threads of a benchmark share one lock guarding a counter, so the contention grows with the thread count.
+// The shared benchmarks write on every sixteenth iteration.
+
+namespace {
+  using namespace ntl;
+
+  constexpr int WRITE_INTERVAL = 16;
+
+  template <typename LockType>
+  void BM_ExclusiveLock(benchmark::State& a_state) {
+    static LockType lock;
+    static Size counter = 0;
+
+    for(auto _ : a_state) {
+      lock.Acquire();
+      benchmark::DoNotOptimize(++counter);
+      lock.Release();
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_StdMutex(benchmark::State& a_state) {
+    static std::mutex lock;
+    static Size counter = 0;
+
+    for(auto _ : a_state) {
+      lock.lock();
+      benchmark::DoNotOptimize(++counter);
+      lock.unlock();
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  template <typename LockType>
+  void BM_SharedLock(benchmark::State& a_state) {
+    static LockType lock;
+    static Size counter = 0;
+
+    int iteration = 0;
+    for(auto _ : a_state) {
+      if(++iteration % WRITE_INTERVAL == 0) {
+        lock.StartWrite();
+        benchmark::DoNotOptimize(++counter);
+        lock.EndWrite();
+      } else {
+        lock.StartRead();
+        benchmark::DoNotOptimize(counter);
+        lock.EndRead();
+      }
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_DistributedSharedLock(benchmark::State& a_state) {
+    static DistributedSharedLock lock;
+    static Size counter = 0;
+
+    int iteration = 0;
+    for(auto _ : a_state) {
+      if(++iteration % WRITE_INTERVAL == 0) {
+        lock.StartWrite();
+        benchmark::DoNotOptimize(++counter);
+        lock.EndWrite();
+      } else {
+        const Size slot = lock.StartRead();
+        benchmark::DoNotOptimize(counter);
+        lock.EndRead(slot);
+      }
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+
+  void BM_StdSharedMutex(benchmark::State& a_state) {
+    static std::shared_mutex lock;
+    static Size counter = 0;
+
+    int iteration = 0;
+    for(auto _ : a_state) {
+      if(++iteration % WRITE_INTERVAL == 0) {
+        lock.lock();
+        benchmark::DoNotOptimize(++counter);
+        lock.unlock();
+      } else {
+        lock.lock_shared();
+        benchmark::DoNotOptimize(counter);
+        lock.unlock_shared();
+      }
+    }
+    a_state.SetItemsProcessed(a_state.iterations());
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_ExclusiveLock, ntl::SpinLock)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ExclusiveLock, ntl::Lock)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ExclusiveLock, ntl::AdaptiveLock)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_StdMutex)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_SharedLock, ntl::SharedLock)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SharedLock, ntl::ReadWriteLock)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_DistributedSharedLock)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_StdSharedMutex)->ThreadRange(1, 8)->UseRealTime();
@@ -13,18 +13,25 @@ namespace ntl::algorithms {
     DYNAMIC = 0,
     INSERTION_SORT = 1,
     QUICK_SORT = 2,
-    MERGE_SORT = 3
+    MERGE_SORT = 3,
+    INTRO_SORT = 4,
+    HEAP_SORT = 5,
+    PARALLEL_MERGE_SORT = 6,
+    RADIX_SORT = 7
   };
 
   enum class Search {
     BINARY_SEARCH = 0,
-    FRONT_BACK_SEARCH = 1
+    FRONT_BACK_SEARCH = 1,
+    PARALLEL_SEARCH = 2,
+    BRANCHLESS_SEARCH = 3
   };
 
   enum class Hash {
     FNV1a = 0,
     DJB2 = 1,
     SDBM = 2,
+    WyHash = 3,
   };
 }
 
@@ -12,9 +12,10 @@
 
 #include "core/Platform.hpp"
 
-#ifdef NTL_DEBUG
+// checks a precondition while NTL_CHECKS is enabled, and compiles to nothing otherwise
+#if NTL_CHECKS
   #define VERIFY(cond) \
-  if(!(cond)) {        \
+  if(!(cond)) [[unlikely]] { \
   printf("Verify failed: (%s) -> %s (%s:%d)\n", \
   #cond,       \
   __PRETTY_FUNCTION__,                                                 \
@@ -22,12 +23,15 @@
   __LINE__);      \
   abort();                       \
   }
+  #define ASSUME(cond) VERIFY(cond)
 #else
 #define VERIFY(cond)
+// lets the optimizer rely on the precondition instead, for the hot accessors of the containers
+#define ASSUME(cond) NTL_ASSUME(cond);
 #endif
 
 #define ENSURE(cond) \
-if(!(cond)) {             \
+if(!(cond)) [[unlikely]] { \
 printf("Ensure failed: (%s) -> %s (%s:%d)\n", \
 #cond,       \
 __PRETTY_FUNCTION__,                                                 \
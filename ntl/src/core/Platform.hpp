@@ -45,12 +45,82 @@
 	  #error "Unknown platform!"
 #endif
 
+#if defined(__AVX2__)                            // x86-64 AVX2 (implies SSE4.2)
+  #define NTL_SIMD_AVX2
+#endif
+#if defined(__SSE4_2__) || defined(NTL_SIMD_AVX2) // x86-64 SSE4.2
+  #define NTL_SIMD_SSE42
+#endif
+#if defined(__SSE2__) || defined(_M_X64)         // x86-64 baseline
+  #define NTL_SIMD_SSE2
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) // ARMv8 NEON
+  #define NTL_SIMD_NEON
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)    // hint the memory behind an address into the cache
+  #define NTL_PREFETCH(address) __builtin_prefetch(address)
+#elif defined(NTL_SIMD_SSE2)
+  #include <xmmintrin.h>
+  #define NTL_PREFETCH(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#else
+  #define NTL_PREFETCH(address) static_cast<void>(address)
+#endif
+
+#if defined(NTL_SIMD_SSE2)                       // tell the core that it spins in a busy-wait loop
+  #include <immintrin.h>
+  #define NTL_PAUSE() _mm_pause()
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+  #define NTL_PAUSE() __asm__ __volatile__("yield")
+#else
+  #define NTL_PAUSE() static_cast<void>(0)
+#endif
+
+#if defined(NTL_PLATFORM_LINUX) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  // compiles a function for every listed target, the loader picks the best one the CPU supports
+  #define NTL_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+  #define NTL_TARGET_CLONES
+#endif
+
+#if __has_cpp_attribute(assume) >= 202207L      // let the optimizer rely on a condition, which is never evaluated
+  #define NTL_ASSUME(cond) [[assume(cond)]]
+#elif defined(__clang__)
+  #define NTL_ASSUME(cond) __builtin_assume(cond)
+#elif defined(__GNUC__)
+  #define NTL_ASSUME(cond) do { if(!(cond)) __builtin_unreachable(); } while(false)
+#else
+  #define NTL_ASSUME(cond) static_cast<void>(0)
+#endif
+
+#ifndef NTL_CACHE_LINE_SIZE                      // padding of data written by different threads
+  #if defined(NTL_PLATFORM_APPLE) && defined(__aarch64__)
+    #define NTL_CACHE_LINE_SIZE 128
+  #else
+    #define NTL_CACHE_LINE_SIZE 64
+  #endif
+#endif
+
 #ifdef NDEBUG
   #define NTL_RELEASE
-  #define NTL_PROFILE 0
 #else
   #define NTL_DEBUG
-  #define NTL_PROFILE 1
+#endif
+
+#ifndef NTL_CHECKS                               // run the VERIFY checks of core/Assert.hpp (may be forced to 1 or 0)
+  #ifdef NTL_DEBUG
+    #define NTL_CHECKS 1
+  #else
+    #define NTL_CHECKS 0
+  #endif
+#endif
+
+#ifndef NTL_PROFILE                              // record the counters of utils/Profile.hpp (may be forced to 1 or 0)
+  #ifdef NTL_DEBUG
+    #define NTL_PROFILE 1
+  #else
+    #define NTL_PROFILE 0
+  #endif
 #endif
 
 #endif //NTL_PLATFORM_HPP
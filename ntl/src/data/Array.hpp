@@ -8,23 +8,45 @@
 #ifndef NTL_ARRAY_HPP
 #define NTL_ARRAY_HPP
 
+#include <algorithm>
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
 #include "core/Algorithms.hpp"
 #include "core/Assert.hpp"
 #include "data/Integer.hpp"
 #include "data/Size.hpp"
 #include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Memory.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Profile.hpp"
+#include "utils/Scan.hpp"
+#include "utils/Search.hpp"
+#include "utils/Sort.hpp"
+#include "utils/Trace.hpp"
 
 namespace ntl {
   /**
    * @brief Constructs a new static/dynamic array object.
+   *
+   * @details Only the used slots hold constructed elements. Growing the array relocates the
+   * elements with memcpy if T is trivially relocatable (see memory::IsTriviallyRelocatable)
+   * and moves them otherwise, so no element is ever copied by a resize.
+   *
    * @tparam T the type of the elements to store
+   * @tparam Allocator the allocator of the element storage (see is_allocator)
    */
-  template <typename T>
+  template <typename T, typename Allocator = DefaultAllocator>
   class Array {
   public:
     // workaround to avoid the constructor of the
-    // object "T" being called. Also allows the usage
-    // of the auto alignment feature of the new operator
+    // object "T" being called. The allocator is asked
+    // for the alignment of the chunks
 
     /**
      * @brief Represents a single element in the array.
@@ -158,6 +180,7 @@ namespace ntl {
     bool m_sorted,
          m_keep_sorted,
          m_growable;
+    [[no_unique_address]] Allocator m_allocator;
 
   public:
     /**
@@ -169,8 +192,43 @@ namespace ntl {
      * @param a_capacity the maximum capacity
      * @param a_keep_sorted if the array should be kept sorted
      * @param a_growable if the array should be able to grow when maximum capacity is reached
+     * @param a_allocator the allocator of the element storage
+     */
+    explicit Array(Size a_capacity = 1024, bool a_keep_sorted = false, bool a_growable = false,
+                   const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Constructs a new array holding copies of the given elements.
+     *
+     * @details Runtime: O(m) (O(m*log(m)) if the array is kept sorted), where m is the number of elements.
+     *
+     * The capacity equals the number of elements. Note that brace initialization with elements of
+     * type T picks this constructor, so use parentheses to pass a capacity.
+     *
+     * @param a_elements the elements
+     * @param a_keep_sorted if the array should be kept sorted
+     * @param a_growable if the array should be able to grow when maximum capacity is reached
+     * @param a_allocator the allocator of the element storage
+     */
+    Array(std::initializer_list<T> a_elements, bool a_keep_sorted = false, bool a_growable = false,
+          const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Constructs a new array holding copies of the elements between the given iterators.
+     *
+     * @details Runtime: O(m) (O(m*log(m)) if the array is kept sorted), where m is the number of elements.
+     *
+     * The capacity equals the number of elements.
+     *
+     * @param a_first the iterator to the first element
+     * @param a_last the iterator behind the last element
+     * @param a_keep_sorted if the array should be kept sorted
+     * @param a_growable if the array should be able to grow when maximum capacity is reached
+     * @param a_allocator the allocator of the element storage
      */
-    explicit Array(Size a_capacity = 1024, bool a_keep_sorted = false, bool a_growable = false);
+    template <std::forward_iterator ForwardIterator>
+    Array(ForwardIterator a_first, ForwardIterator a_last, bool a_keep_sorted = false, bool a_growable = false,
+          const Allocator& a_allocator = Allocator{});
 
     /**
      * @brief Constructs a new array from another array with double its used size as capacity.
@@ -179,7 +237,7 @@ namespace ntl {
      *
      * @param a_other the other array
      */
-    Array(const Array<T>& a_other);
+    Array(const Array& a_other);
 
     /**
      * @brief Constructs a new array from another array with a given capacity.
@@ -189,14 +247,30 @@ namespace ntl {
      * @param a_other the other array
      * @param a_capacity the maximum capacity
      */
-    Array(const Array<T>& a_other, Size a_capacity);
+    Array(const Array& a_other, Size a_capacity);
+
+    /**
+     * @brief Constructs a new array by taking over the elements of another array.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other array (empty with no capacity afterwards)
+     */
+    Array(Array&& a_other) noexcept;
 
     /**
      * @brief Destructs the array.
      */
     ~Array();
 
-    Array<T>& operator=(const Array& other);
+    Array& operator=(const Array& other);
+
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other the array to take the elements from (empty with no capacity afterwards)
+     * @return the reference of the current array object
+     */
+    Array& operator=(Array&& a_other) noexcept;
 
     /**
      * @brief Inserts a new element at the end of the array.
@@ -205,22 +279,119 @@ namespace ntl {
      *  - O(n), where n is the used size of the array. n is a result of resizing when necessary.
      *  - Ω(1), in the best and average case
      *
+     * If the array is kept sorted, the element is inserted at its sorted position instead, which is
+     * found using binary search (O(log(n)) comparisons and one block shift of the tail).
+     *
      * @param a_element the element
      * @return the index of the element
      */
     Size Insert(const T& a_element);
 
+    /**
+     * @brief Inserts a new element at the end of the array by moving it.
+     *
+     * @details Runtime:
+     *  - O(n), where n is the used size of the array. n is a result of resizing when necessary.
+     *  - Ω(1), in the best and average case
+     *
+     * @param a_element the element
+     * @return the index of the element
+     */
+    Size Insert(T&& a_element);
+
+    /**
+     * @brief Constructs a new element in place at the end of the array.
+     *
+     * @details Runtime:
+     *  - O(n), where n is the used size of the array. n is a result of resizing when necessary.
+     *  - Ω(1), in the best and average case
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     * @return the index of the element
+     */
+    template <typename... Args>
+    Size Emplace(Args&&... a_args);
+
     /**
      * @brief Inserts a new element at a given index (between 0 and used size).
      *
      * @details Runtime: O(n), where n is the used size of the array. n is a result of either
      * reallocation or element shifting.
      *
+     * @note If the array is kept sorted, the index is ignored and the element is inserted at its sorted position.
+     *
      * @param a_element the element
      * @param a_index the index to insert at
      */
     void Insert(const T& a_element, Size a_index);
 
+    /**
+     * @brief Inserts a new element at a given index (between 0 and used size) by moving it.
+     *
+     * @details Runtime: O(n), where n is the used size of the array. n is a result of either
+     * reallocation or element shifting.
+     *
+     * @param a_element the element
+     * @param a_index the index to insert at
+     */
+    void Insert(T&& a_element, Size a_index);
+
+    /**
+     * @brief Constructs a new element in place at a given index (between 0 and used size).
+     *
+     * @details Runtime: O(n), where n is the used size of the array. n is a result of either
+     * reallocation or element shifting.
+     *
+     * @param a_index the index to insert at
+     * @param a_args the arguments passed to the constructor of the element
+     */
+    template <typename... Args>
+    void EmplaceAt(Size a_index, Args&&... a_args);
+
+    /**
+     * @brief Inserts all elements of the given range at the end of the array.
+     *
+     * @details Runtime:
+     *  - O(m), where m is the number of inserted elements (plus O(n) for resizing when necessary).
+     *  - O(n + m*log(m)), if the array is kept sorted, as the new elements get sorted on their own
+     *    and then merged with the existing ones once.
+     *
+     * @param a_elements any range of elements (anything usable in a range-based for loop)
+     */
+    template <typename Range>
+    void InsertBulk(const Range& a_elements);
+
+    /**
+     * @brief Inserts copies of the elements between the given iterators at the end of the array.
+     *
+     * @details Runtime:
+     *  - O(m), where m is the number of inserted elements (plus O(n) for growing at most once).
+     *  - O(n + m*log(m)), if the array is kept sorted (see InsertBulk).
+     *
+     * @note Aborts if the array isn't growable and the elements don't fit into its capacity.
+     *
+     * @param a_first the iterator to the first element (must not point into this array)
+     * @param a_last the iterator behind the last element
+     */
+    template <std::input_iterator InputIterator>
+    void InsertRange(InputIterator a_first, InputIterator a_last);
+
+    /**
+     * @brief Inserts copies of the elements between the given iterators at a given index (between 0 and used size).
+     *
+     * @details Runtime: O(n + m), where n is the used size of the array and m the number of inserted
+     * elements, as the tail is shifted only once (using memmove for trivially relocatable types).
+     *
+     * @note If the array is kept sorted, the index is ignored and the elements are merged at their sorted positions.
+     * Aborts if the array isn't growable and the elements don't fit into its capacity.
+     *
+     * @param a_first the iterator to the first element (must not point into this array)
+     * @param a_last the iterator behind the last element
+     * @param a_index the index to insert at
+     */
+    template <std::forward_iterator ForwardIterator>
+    void InsertRange(ForwardIterator a_first, ForwardIterator a_last, Size a_index);
+
     /**
      * @brief Removes a element from the array.
      *
@@ -243,7 +414,30 @@ namespace ntl {
      * @param a_index the index where the element to remove is
      * @return the element that was removed
      */
-    const T& Remove(Size a_index);
+    T Remove(Size a_index);
+
+    /**
+     * @brief Removes the elements between the given indices from the array.
+     *
+     * @details Runtime: O(n), where n is the used size of the array, as the tail is shifted only once
+     * (using memmove for trivially relocatable types).
+     *
+     * @param a_from the index of the first element to remove
+     * @param a_to the index behind the last element to remove
+     */
+    void RemoveRange(Size a_from, Size a_to);
+
+    /**
+     * @brief Removes all elements matching the given predicate, keeping the order of the others.
+     *
+     * @details Runtime: O(n), where n is the used size of the array, as the remaining elements are
+     * compacted in a single pass.
+     *
+     * @param a_predicate a callable returning if the given element should be removed
+     * @return the number of removed elements
+     */
+    template <typename Predicate>
+    Size RemoveIf(const Predicate& a_predicate);
 
     /**
      * @brief Swaps two elements at the given indices.
@@ -281,6 +475,22 @@ namespace ntl {
      */
     void Resize(Size a_capacity);
 
+    /**
+     * @brief Makes sure the array can hold the given number of elements without growing.
+     *
+     * @details Runtime: O(n), where n is the used size of the array (O(1) if the capacity suffices).
+     *
+     * @param a_capacity the number of elements
+     */
+    void Reserve(Size a_capacity);
+
+    /**
+     * @brief Shrinks the capacity of the array to its used size (at least 1).
+     *
+     * @details Runtime: O(n), where n is the used size of the array (O(1) if there is nothing to shrink).
+     */
+    void ShrinkToFit();
+
     void Use(Size a_size);
 
     /**
@@ -289,8 +499,16 @@ namespace ntl {
      * @details Runtime:
      *  - DynamicSort: O(n*log(n)) & Ω(n), where n is the used size of the array.
      *  - InsertionSort: O(n^2) & Ω(n), where n is the used size of the array.
-     *  - QuickSort: O(n^2) & Ω(n*log(n)), where n is the used size of the array.
-     *  - MergeSort O(n*log(n)) & Ω(n*log(n)), where n is the used size of the array.
+     *  - QuickSort/IntroSort: O(n*log(n)) & Ω(n), where n is the used size of the array.
+     *  - MergeSort: O(n*log(n)) & Ω(n), where n is the used size of the array.
+     *  - HeapSort: O(n*log(n)) & Ω(n*log(n)), where n is the used size of the array.
+     *  - ParallelMergeSort: O(n*log(n) / t + n), where n is the used size of the array and t the number of threads.
+     *  - RadixSort: O(n*k), where n is the used size of the array and k the size of the keys.
+     *
+     * Insertion sort and (parallel) merge sort are stable. Dynamic sort is stable for all types but arithmetic,
+     * enumeration and pointer types (see sort::Sort) and uses radix sort for big arrays of integral, floating point
+     * and String elements. The elements only need to support operator<, radix sort falls back to the
+     * dynamic sort for elements without has_radix_key.
      *
      * @param a_algorithm the sorting algorithm to use
      */
@@ -301,7 +519,7 @@ namespace ntl {
      *
      * @details Runtime:
      *  - Sorted: O(log(n)), where n is the used size of the array.
-     *  - Unsorted: O(n), where n is the used size of the array.
+     *  - Unsorted: O(n), where n is the used size of the array (vectorized for scannable types, see scan::FindFrontBack).
      *
      * @param a_element the element to find
      * @return the index of the element (-1 if not found)
@@ -314,6 +532,8 @@ namespace ntl {
      * @details Runtime:
      *  - BinarySearch: O(log(n)), where n is the used size of the array.
      *  - FrontBackSearch: O(n), where n is the used size of the array.
+     *  - ParallelSearch: O(n / t), where n is the used size of the array and t the number of threads.
+     *  - BranchlessSearch: O(log(n)), where n is the used size of the array (see search::Find).
      *
      * @param a_element the element to find
      * @param a_from the starting index to search from
@@ -321,11 +541,97 @@ namespace ntl {
      * @param a_algorithm the algorithm to use for searching
      * @return the index of the element (-1 if not found)
      *
-     * @note the binary search algorithm can only be used if the array is sorted
+     * @note the binary and branchless search algorithms can only be used if the array is sorted
      */
     I64 Find(const T& a_element, I64 a_from, I64 a_to,
              algorithms::Search a_algorithm = algorithms::Search::BINARY_SEARCH) const;
 
+    /**
+     * @brief Finds the indices of the given elements in the sorted array, interleaving the lookups
+     * to hide the memory latency (see search::FindMany).
+     *
+     * @details Runtime: O(m * log(n)), where m is the number of searched elements and n the used size of the array.
+     *
+     * @param a_elements the elements to find
+     * @param a_count the number of elements to find
+     * @param a_results receives the index of every searched element (-1 if not found)
+     *
+     * @note can only be used if the array is sorted (use EytzingerArray for read-mostly tables)
+     */
+    void FindMany(const T* a_elements, Size a_count, I64* a_results) const;
+
+    /**
+     * @brief Checks if the array contains the given element.
+     *
+     * @details Runtime: see Find
+     *
+     * @param a_element the element to find
+     * @return if the element was found
+     */
+    [[nodiscard]] bool Contains(const T& a_element) const;
+
+    /**
+     * @brief Counts the elements equal to the given one.
+     *
+     * @details Runtime: O(n), where n is the used size of the array (vectorized for scannable types, see scan::Count).
+     *
+     * @param a_element the element to count
+     * @return the number of equal elements
+     */
+    [[nodiscard]] Size Count(const T& a_element) const;
+
+    /**
+     * @brief Gets the smallest element of the non-empty array.
+     *
+     * @details Runtime: O(1) if sorted, O(n) otherwise, where n is the used size of the array
+     * (vectorized for scannable types, see scan::Min).
+     *
+     * @return the smallest element
+     */
+    [[nodiscard]] T Min() const;
+
+    /**
+     * @brief Gets the biggest element of the non-empty array.
+     *
+     * @details Runtime: O(1) if sorted, O(n) otherwise, where n is the used size of the array
+     * (vectorized for scannable types, see scan::Max).
+     *
+     * @return the biggest element
+     */
+    [[nodiscard]] T Max() const;
+
+    /**
+     * @brief Sums the elements of an array of arithmetic values up.
+     *
+     * @details Runtime: O(n), where n is the used size of the array (vectorized, see scan::Sum).
+     *
+     * @return the sum in 64 bit integers or double (0 if the array is empty)
+     */
+    [[nodiscard]] scan::SumType<T> Sum() const
+      requires scan::scannable<T>;
+
+    /**
+     * @brief Checks if the predicate holds for any element.
+     *
+     * @details Runtime: O(n), where n is the used size of the array (see scan::Any).
+     *
+     * @param a_predicate the predicate taking a const reference to an element
+     * @return if the predicate holds for any element (false if the array is empty)
+     */
+    template <typename Predicate>
+    [[nodiscard]] bool Any(const Predicate& a_predicate) const;
+
+    /**
+     * @brief Checks if the predicate holds for all elements.
+     *
+     * @details Runtime: O(n), where n is the used size of the array (see scan::All).
+     *
+     * @param a_predicate the predicate taking a const reference to an element
+     * @return if the predicate holds for all elements (true if the array is empty)
+     */
+    template <typename Predicate>
+    [[nodiscard]] bool All(const Predicate& a_predicate) const;
+
     /**
      * @brief Gets the element at the given index.
      *
@@ -346,6 +652,26 @@ namespace ntl {
      */
     T& Get(Size a_index);
 
+    /**
+     * @brief Gets the element at the given index, without checking the index even if NTL_CHECKS is enabled.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the element, which must be less than the size
+     * @return the element itself
+     */
+    const T& GetUnchecked(Size a_index) const;
+
+    /**
+     * @brief Gets the element at the given index, without checking the index even if NTL_CHECKS is enabled.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the element, which must be less than the size
+     * @return the element itself
+     */
+    T& GetUnchecked(Size a_index);
+
     /**
      * @brief Gets the first element.
      *
@@ -408,7 +734,7 @@ namespace ntl {
      *
      * @note the caller is responsible for freeing the newly allocated memory
      */
-    Array<T> GetSubArray(Size a_from, Size a_to) const;
+    Array GetSubArray(Size a_from, Size a_to) const;
 
     /**
      * @brief Checks if the array is equal to another array.
@@ -418,7 +744,7 @@ namespace ntl {
      * @param a_other the other array to compare with
      * @return if the arrays are equal
      */
-    bool IsEqual(const Array<T>& a_other) const;
+    bool IsEqual(const Array& a_other) const;
 
     /**
      * @brief Checks if the array is empty.
@@ -429,6 +755,15 @@ namespace ntl {
      */
     [[nodiscard]] bool IsEmpty() const;
 
+    /**
+     * @brief Checks if the elements of the array are sorted.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the array is known to be sorted
+     */
+    [[nodiscard]] bool IsSorted() const;
+
     /**
      * @brief Gets the capacity of the array.
      *
@@ -456,6 +791,13 @@ namespace ntl {
      */
     [[nodiscard]] T* GetData() const;
 
+    /**
+     * @brief Gets the allocator of the element storage.
+     *
+     * @return the allocator
+     */
+    [[nodiscard]] const Allocator& GetAllocator() const;
+
     /**
      * @brief Overloading subscript operator.
      * @param a_index the index of a element
@@ -520,87 +862,95 @@ namespace ntl {
 
   private:
     /**
-     * @brief Searches the array using the binary search algorithm.
+     * @brief Moves the existing elements to newly allocated storage of the given capacity.
      *
-     * @details Runtime O(log(n)), where is the used size of the array.
+     * @param a_capacity the new capacity (at least the used size)
+     */
+    void reallocate(Size a_capacity);
+
+    /**
+     * @brief Makes room for the given number of elements at the given index, leaving the slots uninitialized.
      *
-     * @param a_element the element to find
-     * @param a_from the starting index to search from
-     * @param a_to the ending index to search to
-     * @return the index of the found element (-1 if not found)
+     * @param a_index the index of the first free slot
+     * @param a_count the number of free slots
      */
-    I64 binarySearch(const T& a_element, I64 a_from, I64 a_to) const;
+    void openGap(Size a_index, Size a_count);
 
     /**
-     * @brief Searches the array using the front and back search algorithm
+     * @brief Restores the order after elements were appended behind the first given number of elements.
      *
-     * @details Runtime: O(n), where n is the used size of the array.
+     * @param a_sorted the number of elements that were there before
+     */
+    void mergeAppended(Size a_sorted);
+
+    /**
+     * @brief Searches the array using the binary search algorithm.
+     *
+     * @details Runtime O(log(n)), where is the used size of the array.
      *
      * @param a_element the element to find
      * @param a_from the starting index to search from
      * @param a_to the ending index to search to
      * @return the index of the found element (-1 if not found)
-     *
-     * @note in practice it's probably faster than O(n) as it will only search
-     * half of the used size of the array.
-     */
-    I64 frontBackSearch(const T& a_element, I64 a_from, I64 a_to) const;
-
-    /**
-     * @brief Sorts the array using the insertion sort algorithm.
-     *
-     * @details Runtime: O(n^2) & Ω(n), where n is the used size of the array.
      */
-    void insertionSort();
+    I64 binarySearch(const T& a_element, I64 a_from, I64 a_to) const;
 
     /**
-     * @brief Sorts the array using the quick sort algorithm.
+     * @brief Gets the index of the first element in the given range which is bigger than the given element.
      *
-     * @details Runtime: O(n^2) & Ω(n*log(n)), where n is the used size of the array.
+     * @details Runtime O(log(n)), where n is the size of the range. The range has to be sorted.
      *
-     * @param a_from the starting index to sort from
-     * @param a_to the ending index to sort to
+     * @param a_element the element to compare with
+     * @param a_from the starting index to search from
+     * @param a_to the index after the last element to search
+     * @return the index after the last element not bigger than the given one
      */
-    void quickSort(I64 a_from, I64 a_to);
+    Size upperBound(const T& a_element, Size a_from, Size a_to) const;
 
     /**
-     * @brief Sorts the whole array using the quick sort algorithm.
+     * @brief Constructs a new element at the end of the array, resizing it if necessary.
+     *
+     * @details Runtime: O(n), where n is the used size of the array. n is a result of resizing when necessary.
      *
-     * @details Runtime: O(n*log(n)) & Ω(n*log(n)), where n is the used size of the array.
+     * @param a_args the arguments passed to the constructor of the element
      */
-    void mergeSort();
+    template <typename... Args>
+    void append(Args&&... a_args);
 
     /**
-     * @brief Sorts the array using the merge sort algorithm.
+     * @brief Inserts an element at the given index, shifting the tail in one block.
      *
-     * @details Runtime: O(n*log(n)) & Ω(n*log(n)), where n is the used size of the array.
+     * @details Runtime: O(n), where n is the used size of the array.
      *
-     * @param a_array the array to sort
-     * @param a_capacity the capacity of the array
-     * @param a_used the used size of the array
-     * @return the sorted part of the array
+     * @param a_index the index to insert at
+     * @param a_element the element
      */
-    ArrayChunk* mergeSort(ArrayChunk* a_array, I64 a_capacity, I64 a_used);
+    void insertAt(Size a_index, T&& a_element);
 
     /**
-     * @brief Sorts the array using a dynamic sorting algorithm.
+     * @brief Inserts an element at its sorted position.
      *
-     * @details Runtime: O(n*log(n)) & Ω(n), where n is the used size of the array.
+     * @details Runtime: O(n), where n is the used size of the array (O(log(n)) comparisons).
      *
-     * @note this is inspired by the TimSort algorithm using in Python
+     * @param a_element the element
+     * @return the index of the element
      */
-    void dynamicSort();
+    Size insertSorted(T&& a_element);
 
     /**
-     * @brief Partitioning the array by selecting a pivot element.
+     * @brief Searches the array using the front and back search algorithm
      *
-     * @details Runtime O(n), where n is the used size of the array.
+     * @details Runtime: O(n), where n is the used size of the array.
      *
-     * @param a_from the starting index to partition from
-     * @param a_to the ending index to partition to
-     * @return the index of the pivot element
+     * @param a_element the element to find
+     * @param a_from the starting index to search from
+     * @param a_to the ending index to search to
+     * @return the index of the found element (-1 if not found)
+     *
+     * @note in practice it's probably faster than O(n) as it will only search
+     * half of the used size of the array.
      */
-    I64 partition(I64 a_from, I64 a_to);
+    I64 frontBackSearch(const T& a_element, I64 a_from, I64 a_to) const;
   };
 
   // ----------------
@@ -617,6 +967,9 @@ namespace ntl {
     { lhs < rhs } -> std::same_as<bool>;
   };
 
+  template <class T>
+  concept has_radix_key = sort::radix_sortable<T> && has_less_than<T>;
+
   template <class L, class R=L>
   concept has_less_equals_than = requires(const L& lhs, const R& rhs) {
     { lhs <= rhs } -> std::same_as<bool>;
@@ -626,13 +979,13 @@ namespace ntl {
   // ITERATOR-RELATED METHODS
   // ------------------------
 
-  template <typename T>
-  typename Array<T>::Iterator Array<T>::begin() const {
+  template <typename T, typename Allocator>
+  typename Array<T, Allocator>::Iterator Array<T, Allocator>::begin() const {
     return Iterator(m_data);
   }
 
-  template <typename T>
-  typename Array<T>::Iterator Array<T>::end() const {
+  template <typename T, typename Allocator>
+  typename Array<T, Allocator>::Iterator Array<T, Allocator>::end() const {
     return Array::Iterator(m_data + m_used);
   }
 
@@ -646,8 +999,8 @@ namespace ntl {
    * @param a_array the array
    * @return the combined ostream
    */
-  template <typename T>
-  std::ostream& operator<<(std::ostream& a_stream, const Array<T>& a_array) {
+  template <typename T, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const Array<T, Allocator>& a_array) {
     return (a_stream << a_array.ToString());
   }
 
@@ -655,100 +1008,217 @@ namespace ntl {
   // PUBLIC METHODS
   // --------------
 
-  template <typename T>
-  Array<T>::Array(Size a_capacity, bool a_keep_sorted, bool a_growable)
-    : m_used{0}, m_capacity{a_capacity}, m_data{new ArrayChunk[a_capacity]},
-      m_sorted{true}, m_keep_sorted(a_keep_sorted), m_growable(a_growable) {
+  template <typename T, typename Allocator>
+  Array<T, Allocator>::Array(Size a_capacity, bool a_keep_sorted, bool a_growable, const Allocator& a_allocator)
+    : m_used{0}, m_capacity{a_capacity}, m_sorted{true}, m_keep_sorted(a_keep_sorted), m_growable(a_growable),
+      m_allocator{a_allocator} {
     VERIFY(m_capacity > 0)
+    m_data = memory::Allocate<ArrayChunk>(m_allocator, m_capacity);
+  }
+
+  template <typename T, typename Allocator>
+  Array<T, Allocator>::Array(std::initializer_list<T> a_elements, bool a_keep_sorted, bool a_growable,
+                             const Allocator& a_allocator)
+    : Array(a_elements.begin(), a_elements.end(), a_keep_sorted, a_growable, a_allocator) {
+    // Empty
   }
 
-  template <typename T>
-  Array<T>::Array(const Array<T>& a_other) {
-    m_used = a_other.m_used;
-    m_capacity = m_used * 2;
-    m_data = new ArrayChunk[a_other.m_capacity];
-    m_sorted = a_other.m_sorted;
+  template <typename T, typename Allocator>
+  template <std::forward_iterator ForwardIterator>
+  Array<T, Allocator>::Array(ForwardIterator a_first, ForwardIterator a_last, bool a_keep_sorted, bool a_growable,
+                             const Allocator& a_allocator)
+    : Array(std::max(static_cast<Size>(std::distance(a_first, a_last)), Size{1}), a_keep_sorted, a_growable,
+            a_allocator) {
+    InsertRange(a_first, a_last);
+  }
 
+  template <typename T, typename Allocator>
+  Array<T, Allocator>::Array(const Array<T, Allocator>& a_other)
+    : m_used{a_other.m_used}, m_capacity{a_other.m_used * 2}, m_sorted{a_other.m_sorted},
+      m_keep_sorted{a_other.m_keep_sorted}, m_growable{a_other.m_growable}, m_allocator{a_other.m_allocator} {
+    m_data = memory::Allocate<ArrayChunk>(m_allocator, m_capacity);
     for(Size i = 0; i < m_used; i++) {
-      m_data[i].value = a_other.m_data[i].value;
+      std::construct_at(&m_data[i].value, a_other.m_data[i].value);
     }
   }
 
-  template <typename T>
-  Array<T>::Array(const Array<T>& a_other, Size a_capacity)
-    : m_used(a_other.m_used), m_capacity(a_capacity), m_data{new ArrayChunk[a_capacity]}, m_sorted(a_other.m_sorted) {
+  template <typename T, typename Allocator>
+  Array<T, Allocator>::Array(const Array<T, Allocator>& a_other, Size a_capacity)
+    : m_used(a_other.m_used), m_capacity(a_capacity), m_sorted(a_other.m_sorted),
+      m_keep_sorted{a_other.m_keep_sorted}, m_growable{a_other.m_growable}, m_allocator{a_other.m_allocator} {
     VERIFY(m_capacity > m_used)
+    m_data = memory::Allocate<ArrayChunk>(m_allocator, m_capacity);
 
     for(Size i = 0; i < m_used; i++) {
-      m_data[i] = a_other.m_data[i];
+      std::construct_at(&m_data[i].value, a_other.m_data[i].value);
     }
   }
 
-  template <typename T>
-  Array<T>::~Array() {
-    delete[] m_data;
+  template <typename T, typename Allocator>
+  Array<T, Allocator>::Array(Array<T, Allocator>&& a_other) noexcept
+    : m_data{a_other.m_data}, m_used{a_other.m_used}, m_capacity{a_other.m_capacity}, m_sorted{a_other.m_sorted},
+      m_keep_sorted{a_other.m_keep_sorted}, m_growable{a_other.m_growable}, m_allocator{a_other.m_allocator} {
+    a_other.m_data = nullptr;
+    a_other.m_used = 0;
+    a_other.m_capacity = 0;
+  }
+
+  template <typename T, typename Allocator>
+  Array<T, Allocator>::~Array() {
+    memory::Destroy(GetData(), m_used);
+    memory::Deallocate(m_allocator, m_data, m_capacity);
   }
 
 
-  template <typename T>
-  Array<T>& Array<T>::operator=(const Array& other) {
+  template <typename T, typename Allocator>
+  Array<T, Allocator>& Array<T, Allocator>::operator=(const Array& other) {
     if (this != &other) {
-      delete[] m_data;
+      memory::Destroy(GetData(), m_used);
+      memory::Deallocate(m_allocator, m_data, m_capacity);
+      m_allocator = other.m_allocator;
       m_capacity = other.m_capacity;
       m_used = other.m_used;
       m_sorted = other.m_sorted;
-      m_data = new ArrayChunk[m_capacity];
+      m_keep_sorted = other.m_keep_sorted;
+      m_growable = other.m_growable;
+      m_data = memory::Allocate<ArrayChunk>(m_allocator, m_capacity);
       for (size_t i = 0; i < m_used; ++i) {
-        m_data[i] = other.m_data[i];
+        std::construct_at(&m_data[i].value, other.m_data[i].value);
       }
     }
     return *this;
   }
 
-  template <typename T>
-  Size Array<T>::Insert(const T& a_element) {
-    if(m_growable && m_used >= m_capacity)
-      Resize(m_capacity * 2);
+  template <typename T, typename Allocator>
+  Array<T, Allocator>& Array<T, Allocator>::operator=(Array&& a_other) noexcept {
+    if (this != &a_other) {
+      memory::Destroy(GetData(), m_used);
+      memory::Deallocate(m_allocator, m_data, m_capacity);
+      m_allocator = a_other.m_allocator;
+      m_data = a_other.m_data;
+      m_capacity = a_other.m_capacity;
+      m_used = a_other.m_used;
+      m_sorted = a_other.m_sorted;
+      m_keep_sorted = a_other.m_keep_sorted;
+      m_growable = a_other.m_growable;
+      a_other.m_data = nullptr;
+      a_other.m_used = 0;
+      a_other.m_capacity = 0;
+    }
+    return *this;
+  }
 
-    VERIFY(m_used < m_capacity)
+  template <typename T, typename Allocator>
+  Size Array<T, Allocator>::Insert(const T& a_element) {
+    return Emplace(a_element);
+  }
 
-    m_data[m_used].value = a_element;
-    m_used++;
+  template <typename T, typename Allocator>
+  Size Array<T, Allocator>::Insert(T&& a_element) {
+    return Emplace(std::move(a_element));
+  }
+
+  template <typename T, typename Allocator>
+  template <typename... Args>
+  Size Array<T, Allocator>::Emplace(Args&&... a_args) {
+    if(m_keep_sorted)
+      return insertSorted(T(std::forward<Args>(a_args)...));
+
+    append(std::forward<Args>(a_args)...);
+    m_sorted = false;
+
+    return (m_used - 1);
+  }
+
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::Insert(const T& a_element, Size a_index) {
+    EmplaceAt(a_index, a_element);
+  }
+
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::Insert(T&& a_element, Size a_index) {
+    EmplaceAt(a_index, std::move(a_element));
+  }
+
+  template <typename T, typename Allocator>
+  template <typename... Args>
+  void Array<T, Allocator>::EmplaceAt(Size a_index, Args&&... a_args) {
+    VERIFY(a_index <= m_used)
+
+    // constructed up front, as the arguments might refer to an element that gets shifted
+    T element(std::forward<Args>(a_args)...);
 
     if(m_keep_sorted) {
-      insertionSort();
+      insertSorted(std::move(element));
     } else {
+      insertAt(a_index, std::move(element));
       m_sorted = false;
     }
-
-    return (m_used - 1);
   }
 
-  template <typename T>
-  void Array<T>::Insert(const T& a_element, Size a_index) {
-    VERIFY(a_index <= m_used)
+  template <typename T, typename Allocator>
+  template <typename Range>
+  void Array<T, Allocator>::InsertBulk(const Range& a_elements) {
+    if constexpr(requires { { a_elements.size() } -> std::convertible_to<Size>; }) {
+      if(m_growable && m_used + a_elements.size() > m_capacity)
+        Resize(std::max(m_capacity * 2, m_used + a_elements.size()));
+    } else if constexpr(requires { { a_elements.GetSize() } -> std::convertible_to<Size>; }) {
+      if(m_growable && m_used + a_elements.GetSize() > m_capacity)
+        Resize(std::max(m_capacity * 2, m_used + a_elements.GetSize()));
+    }
+
+    const Size sorted = m_used;
+    for(const auto& element : a_elements)
+      append(element);
 
-    if(a_index >= m_capacity && m_growable)
-      Resize(m_capacity * 2);
+    mergeAppended(sorted);
+  }
 
-    VERIFY(a_index < m_capacity)
+  template <typename T, typename Allocator>
+  template <std::input_iterator InputIterator>
+  void Array<T, Allocator>::InsertRange(InputIterator a_first, InputIterator a_last) {
+    const Size sorted = m_used;
 
-    for(Size i = m_used; i > a_index; --i) {
-      m_data[i] = m_data[i - 1];
+    if constexpr(std::forward_iterator<InputIterator>) {
+      const auto count = static_cast<Size>(std::distance(a_first, a_last));
+      if(m_used + count > m_capacity) {
+        ENSURE(m_growable && "Array is full")
+        reallocate(std::max(m_capacity * 2, m_used + count));
+      }
+      for(; a_first != a_last; ++a_first)
+        std::construct_at(&m_data[m_used++].value, *a_first);
+    } else {
+      for(; a_first != a_last; ++a_first)
+        append(*a_first);
     }
 
-    m_data[a_index].value = a_element;
-    m_used++;
+    mergeAppended(sorted);
+  }
+
+  template <typename T, typename Allocator>
+  template <std::forward_iterator ForwardIterator>
+  void Array<T, Allocator>::InsertRange(ForwardIterator a_first, ForwardIterator a_last, Size a_index) {
+    VERIFY(a_index <= m_used)
 
     if(m_keep_sorted) {
-      insertionSort();
-    } else {
-      m_sorted = false;
+      InsertRange(a_first, a_last);
+      return;
     }
+
+    const auto count = static_cast<Size>(std::distance(a_first, a_last));
+    if(count == 0)
+      return;
+
+    openGap(a_index, count);
+    for(Size i = a_index; a_first != a_last; ++a_first, ++i)
+      std::construct_at(&m_data[i].value, *a_first);
+
+    m_used += count;
+    m_sorted = false;
   }
 
-  template <typename T>
-  I64 Array<T>::RemoveElement(const T& a_element) {
+  template <typename T, typename Allocator>
+  I64 Array<T, Allocator>::RemoveElement(const T& a_element) {
     auto index = Find(a_element);
     if(index < 0)
       return -1;
@@ -757,102 +1227,160 @@ namespace ntl {
     return index;
   }
 
-  template <typename T>
-  const T& Array<T>::Remove(Size a_index) {
+  template <typename T, typename Allocator>
+  T Array<T, Allocator>::Remove(Size a_index) {
     VERIFY(a_index < m_used)
 
-    for(Size i = a_index; i < m_used; i++) {
-      m_data[i] = m_data[i + 1];
+    T result = std::move(m_data[a_index].value);
+
+    NTL_PROFILE_RECORD(profile::RecordArrayMoves(m_used - a_index - 1));
+    if constexpr(memory::IsTriviallyRelocatable<T>::value) {
+      memory::Destroy(&m_data[a_index].value, 1);
+      std::memmove(static_cast<void*>(m_data + a_index), static_cast<const void*>(m_data + a_index + 1),
+                   (m_used - a_index - 1) * sizeof(ArrayChunk));
+    } else {
+      for(Size i = a_index; i + 1 < m_used; i++) {
+        m_data[i].value = std::move(m_data[i + 1].value);
+      }
+      std::destroy_at(&m_data[m_used - 1].value);
     }
 
     m_used--;
 
-    return static_cast<ArrayChunk*>(m_data + a_index)->value;
+    return result;
+  }
+
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::RemoveRange(Size a_from, Size a_to) {
+    VERIFY(a_from <= a_to && a_to <= m_used)
+
+    const Size count = a_to - a_from;
+    if(count == 0)
+      return;
+
+    memory::Destroy(GetData() + a_from, count);
+    NTL_PROFILE_RECORD(profile::RecordArrayMoves(m_used - a_to));
+    if constexpr(memory::IsTriviallyRelocatable<T>::value) {
+      std::memmove(static_cast<void*>(m_data + a_from), static_cast<const void*>(m_data + a_to),
+                   (m_used - a_to) * sizeof(ArrayChunk));
+    } else {
+      for(Size i = a_to; i < m_used; ++i) {
+        std::construct_at(&m_data[i - count].value, std::move(m_data[i].value));
+        std::destroy_at(&m_data[i].value);
+      }
+    }
+
+    m_used -= count;
   }
 
-  template <typename T>
-  void Array<T>::Swap(Size a_first, Size a_second) {
+  template <typename T, typename Allocator>
+  template <typename Predicate>
+  Size Array<T, Allocator>::RemoveIf(const Predicate& a_predicate) {
+    Size kept = 0;
+    for(Size i = 0; i < m_used; ++i) {
+      if(a_predicate(std::as_const(m_data[i].value)))
+        continue;
+
+      if(kept != i)
+        m_data[kept].value = std::move(m_data[i].value);
+      ++kept;
+    }
+
+    const Size removed = m_used - kept;
+    memory::Destroy(GetData() + kept, removed);
+    m_used = kept;
+
+    return removed;
+  }
+
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::Swap(Size a_first, Size a_second) {
     VERIFY(a_first < m_used)
     VERIFY(a_second < m_used)
 
-    auto temp = m_data[a_first];
-    m_data[a_first] = m_data[a_second];
-    m_data[a_second] = temp;
+    std::swap(m_data[a_first].value, m_data[a_second].value);
 
     m_sorted = false;
   }
 
-  template <typename T>
-  void Array<T>::Clear() {
-    delete[] m_data;
-    m_data = new ArrayChunk[m_capacity];
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::Clear() {
+    memory::Destroy(GetData(), m_used);
     m_sorted = true;
     m_used = 0;
   }
 
-  template <typename T>
-  void Array<T>::Clear(Size a_capacity) {
-    delete[] m_data;
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::Clear(Size a_capacity) {
+    memory::Destroy(GetData(), m_used);
+    memory::Deallocate(m_allocator, m_data, m_capacity);
     m_capacity = a_capacity;
-    m_data = new ArrayChunk[m_capacity];
+    m_data = memory::Allocate<ArrayChunk>(m_allocator, m_capacity);
     m_sorted = true;
     m_used = 0;
   }
 
-  template <typename T>
-  void Array<T>::Resize(Size a_capacity) {
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::Resize(Size a_capacity) {
     VERIFY(a_capacity >= m_used);
     VERIFY(a_capacity > m_capacity)
 
-    m_capacity = a_capacity;
-    auto* temp = new ArrayChunk[m_capacity];
+    reallocate(a_capacity);
+  }
 
-    for(Size i = 0; i < m_used; ++i) {
-      temp[i].value = m_data[i].value;
-    }
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::Reserve(Size a_capacity) {
+    if(a_capacity > m_capacity)
+      reallocate(a_capacity);
+  }
 
-    delete[] m_data;
-    m_data = temp;
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::ShrinkToFit() {
+    const Size capacity = std::max(m_used, Size{1});
+    if(capacity < m_capacity)
+      reallocate(capacity);
   }
 
-  template <typename T>
-  void Array<T>::Use(Size a_size) {
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::Use(Size a_size) {
     VERIFY(a_size <= m_capacity);
 
+    // trivial elements may have been written through GetData, so they're left untouched
+    if constexpr(!std::is_trivially_default_constructible_v<T>) {
+      for(Size i = m_used; i < a_size; ++i)
+        ::new(static_cast<void*>(&m_data[i].value)) T;
+    }
+    if(a_size < m_used)
+      memory::Destroy(GetData() + a_size, m_used - a_size);
+
     m_used = a_size;
   }
 
-  template <typename T>
-  void Array<T>::Sort(algorithms::Sort a_algorithm) {
-    switch(a_algorithm) {
-      case algorithms::Sort::DYNAMIC:
-        dynamicSort();
-        break;
-      case algorithms::Sort::INSERTION_SORT:
-        insertionSort();
-        break;
-      case algorithms::Sort::QUICK_SORT:
-        quickSort(0, m_used - 1);
-        break;
-      case algorithms::Sort::MERGE_SORT:
-        mergeSort();
-        break;
-      default:
-        VERIFY(a_algorithm == algorithms::Sort::DYNAMIC)
-        break;
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::Sort(algorithms::Sort a_algorithm) {
+    if constexpr(has_less_than<T>) {
+      NTL_PROFILE_SCOPE("Array::Sort");
+      NTL_PROFILE_RECORD(profile::RecordArraySort(m_used));
+      if(a_algorithm == algorithms::Sort::PARALLEL_MERGE_SORT)
+        parallel::Sort(GetData(), m_used);
+      else
+        sort::Sort(GetData(), m_used, a_algorithm);
+      m_sorted = true;
+    } else {
+      VERIFY(has_less_than<T>)
     }
   }
 
-  template <typename T>
-  I64 Array<T>::Find(const T& a_element) const {
+  template <typename T, typename Allocator>
+  I64 Array<T, Allocator>::Find(const T& a_element) const {
     if(m_used == 0)
       return -1;
 
     return m_sorted ? binarySearch(a_element, 0, m_used - 1) : frontBackSearch(a_element, 0, m_used - 1);
   }
 
-  template <typename T>
-  I64 Array<T>::Find(const T& a_element, I64 a_from, I64 a_to, algorithms::Search a_algorithm) const {
+  template <typename T, typename Allocator>
+  I64 Array<T, Allocator>::Find(const T& a_element, I64 a_from, I64 a_to, algorithms::Search a_algorithm) const {
     if(m_used == 0)
       return -1;
 
@@ -862,48 +1390,148 @@ namespace ntl {
         return binarySearch(a_element, a_from, a_to);
       case algorithms::Search::FRONT_BACK_SEARCH:
         return frontBackSearch(a_element, a_from, a_to);
+      case algorithms::Search::PARALLEL_SEARCH: {
+        VERIFY(a_from >= 0 && a_from <= a_to && a_to < static_cast<I64>(m_used))
+        const I64 index = parallel::Find(GetData() + a_from, static_cast<Size>(a_to - a_from + 1), a_element);
+        return index < 0 ? -1 : a_from + index;
+      }
+      case algorithms::Search::BRANCHLESS_SEARCH: {
+        VERIFY(m_sorted && a_from >= 0 && a_to < static_cast<I64>(m_used))
+        if(a_from > a_to)
+          return -1;
+
+        const I64 index = search::Find(GetData() + a_from, static_cast<Size>(a_to - a_from + 1), a_element);
+        return index < 0 ? -1 : a_from + index;
+      }
       default:
         VERIFY(a_algorithm == algorithms::Search::BINARY_SEARCH)
         break;
     }
+
+    return -1;
   }
 
-  template <typename T>
-  const T& Array<T>::Get(Size a_index) const {
-    VERIFY(a_index < m_used)
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::FindMany(const T* a_elements, Size a_count, I64* a_results) const {
+    VERIFY(m_sorted)
+    search::FindMany(GetData(), m_used, a_elements, a_count, a_results);
+  }
+
+  template <typename T, typename Allocator>
+  bool Array<T, Allocator>::Contains(const T& a_element) const {
+    return Find(a_element) >= 0;
+  }
+
+  template <typename T, typename Allocator>
+  Size Array<T, Allocator>::Count(const T& a_element) const {
+    if constexpr(scan::scannable<T>) {
+      return scan::Count(GetData(), m_used, a_element);
+    } else {
+      Size count = 0;
+      for(Size i = 0; i < m_used; ++i)
+        count += m_data[i].value == a_element;
+      return count;
+    }
+  }
+
+  template <typename T, typename Allocator>
+  T Array<T, Allocator>::Min() const {
+    VERIFY(m_used > 0)
+
+    if(m_sorted)
+      return m_data[0].value;
+
+    if constexpr(scan::scannable<T>) {
+      return scan::Min(GetData(), m_used);
+    } else {
+      const T* minimum = GetData();
+      for(Size i = 1; i < m_used; ++i)
+        minimum = m_data[i].value < *minimum ? &m_data[i].value : minimum;
+      return *minimum;
+    }
+  }
+
+  template <typename T, typename Allocator>
+  T Array<T, Allocator>::Max() const {
+    VERIFY(m_used > 0)
+
+    if(m_sorted)
+      return m_data[m_used - 1].value;
+
+    if constexpr(scan::scannable<T>) {
+      return scan::Max(GetData(), m_used);
+    } else {
+      const T* maximum = GetData();
+      for(Size i = 1; i < m_used; ++i)
+        maximum = *maximum < m_data[i].value ? &m_data[i].value : maximum;
+      return *maximum;
+    }
+  }
+
+  template <typename T, typename Allocator>
+  scan::SumType<T> Array<T, Allocator>::Sum() const
+    requires scan::scannable<T> {
+    return scan::Sum(GetData(), m_used);
+  }
+
+  template <typename T, typename Allocator>
+  template <typename Predicate>
+  bool Array<T, Allocator>::Any(const Predicate& a_predicate) const {
+    return scan::Any(GetData(), m_used, a_predicate);
+  }
+
+  template <typename T, typename Allocator>
+  template <typename Predicate>
+  bool Array<T, Allocator>::All(const Predicate& a_predicate) const {
+    return scan::All(GetData(), m_used, a_predicate);
+  }
+
+  template <typename T, typename Allocator>
+  const T& Array<T, Allocator>::Get(Size a_index) const {
+    ASSUME(a_index < m_used)
 
     return m_data[a_index].value;
   }
 
-  template <typename T>
-  T& Array<T>::Get(Size a_index) {
-    VERIFY(a_index < m_used)
+  template <typename T, typename Allocator>
+  T& Array<T, Allocator>::Get(Size a_index) {
+    ASSUME(a_index < m_used)
+
+    return m_data[a_index].value;
+  }
+
+  template <typename T, typename Allocator>
+  const T& Array<T, Allocator>::GetUnchecked(Size a_index) const {
+    return m_data[a_index].value;
+  }
 
+  template <typename T, typename Allocator>
+  T& Array<T, Allocator>::GetUnchecked(Size a_index) {
     return m_data[a_index].value;
   }
 
-  template <typename T>
-  const T& Array<T>::GetFirst() const {
+  template <typename T, typename Allocator>
+  const T& Array<T, Allocator>::GetFirst() const {
     return m_data[0].value;
   }
 
-  template <typename T>
-  T& Array<T>::GetFirst() {
+  template <typename T, typename Allocator>
+  T& Array<T, Allocator>::GetFirst() {
     return m_data[0].value;
   }
 
-  template <typename T>
-  const T& Array<T>::GetLast() const {
+  template <typename T, typename Allocator>
+  const T& Array<T, Allocator>::GetLast() const {
     return m_data[m_used - 1].value;
   }
 
-  template <typename T>
-  T& Array<T>::GetLast() {
+  template <typename T, typename Allocator>
+  T& Array<T, Allocator>::GetLast() {
     return m_data[m_used - 1].value;
   }
 
-  template <typename T>
-  void Array<T>::GetNeighbors(const T& a_element, T*& a_left, T*& a_right) {
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::GetNeighbors(const T& a_element, T*& a_left, T*& a_right) {
     I64 idx = Find(a_element);
 
     a_left = nullptr;
@@ -919,25 +1547,25 @@ namespace ntl {
       a_right = reinterpret_cast<T*>(m_data + idx);
   }
 
-  template <typename T>
-  Array<T> Array<T>::GetSubArray(Size a_from, Size a_to) const {
+  template <typename T, typename Allocator>
+  Array<T, Allocator> Array<T, Allocator>::GetSubArray(Size a_from, Size a_to) const {
     VERIFY(a_from < a_to)
     VERIFY(a_from < m_used)
     VERIFY(a_to < m_used)
 
 
-    Array<T> result((a_to - a_from), m_sorted, m_growable);
+    Array<T, Allocator> result((a_to - a_from), m_sorted, m_growable, m_allocator);
     result.m_sorted = m_sorted;
 
     for(Size i = a_from; i < a_to; ++i) {
-      result.m_data[result.m_used++] = m_data[i];
+      std::construct_at(&result.m_data[result.m_used++].value, m_data[i].value);
     }
 
     return result;
   }
 
-  template <typename T>
-  bool Array<T>::IsEqual(const Array<T>& a_other) const {
+  template <typename T, typename Allocator>
+  bool Array<T, Allocator>::IsEqual(const Array<T, Allocator>& a_other) const {
     if(m_used != a_other.m_used)
       return false;
 
@@ -953,230 +1581,253 @@ namespace ntl {
     return result;
   }
 
-  template <typename T>
-  bool Array<T>::IsEmpty() const {
+  template <typename T, typename Allocator>
+  bool Array<T, Allocator>::IsEmpty() const {
     return (m_used == 0);
   }
 
-  template <typename T>
-  Size Array<T>::GetCapacity() const {
+  template <typename T, typename Allocator>
+  bool Array<T, Allocator>::IsSorted() const {
+    return m_sorted;
+  }
+
+  template <typename T, typename Allocator>
+  Size Array<T, Allocator>::GetCapacity() const {
     return m_capacity;
   }
 
-  template <typename T>
-  Size Array<T>::GetSize() const {
+  template <typename T, typename Allocator>
+  Size Array<T, Allocator>::GetSize() const {
     return m_used;
   }
 
-  template <typename T>
-  T* Array<T>::GetData() const {
+  template <typename T, typename Allocator>
+  T* Array<T, Allocator>::GetData() const {
     return reinterpret_cast<T*>(m_data);
   }
 
-  template <typename T>
-  T& Array<T>::operator[](Size a_index) {
+  template <typename T, typename Allocator>
+  const Allocator& Array<T, Allocator>::GetAllocator() const {
+    return m_allocator;
+  }
+
+  template <typename T, typename Allocator>
+  T& Array<T, Allocator>::operator[](Size a_index) {
     return Get(a_index);
   }
 
-  template <typename T>
-  const T& Array<T>::operator[](Size a_index) const {
+  template <typename T, typename Allocator>
+  const T& Array<T, Allocator>::operator[](Size a_index) const {
     return Get(a_index);
   }
 
-  template <typename T>
-  Array<T>& Array<T>::operator+=(const T& a_element) {
+  template <typename T, typename Allocator>
+  Array<T, Allocator>& Array<T, Allocator>::operator+=(const T& a_element) {
     Insert(a_element);
     return (*this);
   }
 
-  template <typename T>
-  Array<T>& Array<T>::operator-=(const T& a_element) {
+  template <typename T, typename Allocator>
+  Array<T, Allocator>& Array<T, Allocator>::operator-=(const T& a_element) {
     RemoveElement(a_element);
     return (*this);
   }
 
-  template <typename T>
-  bool Array<T>::operator==(const Array& a_other) const {
+  template <typename T, typename Allocator>
+  bool Array<T, Allocator>::operator==(const Array& a_other) const {
     return IsEqual(a_other);
   }
 
-  template <typename T>
-  bool Array<T>::operator!=(const Array& a_other) const {
+  template <typename T, typename Allocator>
+  bool Array<T, Allocator>::operator!=(const Array& a_other) const {
     return (!IsEqual(a_other));
   }
 
-  template <typename T>
-  String Array<T>::ToString() const {
-    String result = "Array(";
+  template <typename T, typename Allocator>
+  String Array<T, Allocator>::ToString() const {
+    Size estimate = 8;
+    for(Size i = 0; i < m_used; ++i)
+      estimate += StringBuilder::Measure(m_data[i].value) + 2;
 
-    for(int i = 0; i < m_used; ++i) {
-      result += m_data[i].value;
-      result += (i == m_used - 1) ? ")\n" : ", ";
+    StringBuilder builder{estimate};
+    builder.Append("Array(");
+
+    for(Size i = 0; i < m_used; ++i) {
+      if(i > 0)
+        builder.Append(", ");
+      builder.Append(m_data[i].value);
     }
 
-    return result;
+    builder.Append(")\n");
+    return builder.Build();
   }
 
   // ---------------
   // PRIVATE METHODS
   // ---------------
 
-  template <typename T>
-  I64 Array<T>::binarySearch(const T& a_element, I64 a_from, I64 a_to) const {
-    if constexpr(has_less_than<T> && has_bigger_than<T>) {
-      if(a_from == a_to)
-        return static_cast<I64>(a_from);
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::reallocate(Size a_capacity) {
+    auto* temp = memory::Allocate<ArrayChunk>(m_allocator, a_capacity);
 
-      if(a_from > a_to)
-        return -1;
+    memory::Relocate(reinterpret_cast<T*>(temp), GetData(), m_used);
+    NTL_PROFILE_RECORD(profile::RecordArrayResize(m_used));
 
-      I64 pivot = (a_from + a_to) / 2;
+    memory::Deallocate(m_allocator, m_data, m_capacity);
+    m_capacity = a_capacity;
+    m_data = temp;
+  }
 
-      if(a_element < m_data[pivot].value) {
-        return binarySearch(a_element, a_from, pivot - 1);
-      } else if(a_element > m_data[pivot].value) {
-        return binarySearch(a_element, pivot + 1, a_to);
-      } else {
-        return pivot;
-      }
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::openGap(Size a_index, Size a_count) {
+    if(m_used + a_count > m_capacity) {
+      ENSURE(m_growable && "Array is full")
+      reallocate(std::max(m_capacity * 2, m_used + a_count));
+    }
+
+    NTL_PROFILE_RECORD(profile::RecordArrayMoves(m_used - a_index));
+    if constexpr(memory::IsTriviallyRelocatable<T>::value) {
+      std::memmove(static_cast<void*>(m_data + a_index + a_count), static_cast<const void*>(m_data + a_index),
+                   (m_used - a_index) * sizeof(ArrayChunk));
     } else {
-      return frontBackSearch(a_element, a_from, a_to);
+      // from the back, as the source and destination may overlap
+      for(Size i = m_used; i > a_index; --i) {
+        std::construct_at(&m_data[i - 1 + a_count].value, std::move(m_data[i - 1].value));
+        std::destroy_at(&m_data[i - 1].value);
+      }
     }
   }
 
-  template <typename T>
-  I64 Array<T>::frontBackSearch(const T& a_element, I64 a_from, I64 a_to) const {
-    while(a_from <= a_to) {
-      if(m_data[a_from].value == a_element)
-        return a_from;
-
-      if(m_data[a_to].value == a_element)
-        return a_to;
-
-      a_from++;
-      a_to--;
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::mergeAppended(Size a_sorted) {
+    if(!m_keep_sorted) {
+      m_sorted = m_sorted && a_sorted == m_used;
+      return;
     }
 
-    return -1;
-  }
-
-  template <typename T>
-  void Array<T>::insertionSort() {
-    if constexpr(has_bigger_than<T>) {
-      ArrayChunk temp;
-      for(int i = 1; i < m_used; ++i) {
-        temp = m_data[i];
-        int j = i - 1;
-        while(m_data[j].value > temp.value && j >= 0) {
-          m_data[j + 1] = m_data[j];
-          j--;
-        }
-        m_data[j + 1] = temp;
+    if constexpr(has_less_than<T>) {
+      if(!m_sorted) {
+        Sort();
+        return;
       }
 
-      m_sorted = true;
+      sort::Sort(GetData() + a_sorted, m_used - a_sorted, algorithms::Sort::DYNAMIC);
+      sort::Merge(GetData(), a_sorted, m_used - a_sorted);
     } else {
-      VERIFY(has_bigger_than<T>)
+      VERIFY(has_less_than<T>)
     }
   }
 
-  template <typename T>
-  void Array<T>::quickSort(I64 a_from, I64 a_to) {
-    if(m_used == 0)
-      return;
+  template <typename T, typename Allocator>
+  I64 Array<T, Allocator>::binarySearch(const T& a_element, I64 a_from, I64 a_to) const {
+    if constexpr(has_less_than<T>) {
+      if(a_from > a_to)
+        return -1;
 
-    if(a_from >= a_to) {
-      m_sorted = true;
-      return;
-    }
+      // the element can only be right before its upper bound
+      const Size index = upperBound(a_element, a_from, a_to + 1);
 
-    I64 k = partition(a_from, a_to);
-    quickSort(a_from, k - 1);
-    quickSort(k + 1, a_to);
-  }
+      if(index > static_cast<Size>(a_from) && !(m_data[index - 1].value < a_element))
+        return static_cast<I64>(index - 1);
 
-  template <typename T>
-  void Array<T>::mergeSort() {
-    ArrayChunk* temp = mergeSort(m_data, m_capacity, m_used);
-    delete[] m_data;
-    m_data = temp;
-    m_sorted = true;
+      return -1;
+    } else {
+      return frontBackSearch(a_element, a_from, a_to);
+    }
   }
 
-  template <typename T>
-  typename Array<T>::ArrayChunk* Array<T>::mergeSort(ArrayChunk* a_array, I64 a_capacity, I64 a_used) {
-    if constexpr(has_less_equals_than<T>) {
-      ArrayChunk* result;
+  template <typename T, typename Allocator>
+  Size Array<T, Allocator>::upperBound(const T& a_element, Size a_from, Size a_to) const {
+    while(a_from < a_to) {
+      const Size middle = a_from + (a_to - a_from) / 2;
 
-      if(a_used <= 1) {
-        result = new ArrayChunk[1];
-        result[0] = a_array[0];
-        return result;
-      }
-
-      I64 size1 = a_used / 2;
-      I64 size2 = a_used - size1;
+      if(a_element < m_data[middle].value)
+        a_to = middle;
+      else
+        a_from = middle + 1;
+    }
 
-      auto* array1 = mergeSort(a_array, size1, size1);
-      auto* array2 = mergeSort(a_array + size1, size2, size2);
+    return a_from;
+  }
 
-      result = new ArrayChunk[a_capacity];
+  template <typename T, typename Allocator>
+  template <typename... Args>
+  void Array<T, Allocator>::append(Args&&... a_args) {
+    if(m_growable && m_used >= m_capacity) {
+      // the arguments might refer to an element of this array, so construct before reallocating
+      T element(std::forward<Args>(a_args)...);
+      Resize(m_capacity > 0 ? m_capacity * 2 : 1);
+      std::construct_at(&m_data[m_used].value, std::move(element));
+    } else {
+      VERIFY(m_used < m_capacity)
+      std::construct_at(&m_data[m_used].value, std::forward<Args>(a_args)...);
+    }
+    m_used++;
+  }
 
-      Size j = 0, k = 0;
-      for(Size i = 0; i < a_used; ++i) {
-        if((j < size1) && (k == size2 || array1[j].value <= array2[k].value)) {
-          result[i] = array1[j];
-          j++;
-        } else {
-          result[i] = array2[k];
-          k++;
-        }
-      }
+  template <typename T, typename Allocator>
+  void Array<T, Allocator>::insertAt(Size a_index, T&& a_element) {
+    if(m_used >= m_capacity && m_growable)
+      Resize(m_capacity > 0 ? m_capacity * 2 : 1);
 
-      delete[] array1;
-      delete[] array2;
+    VERIFY(m_used < m_capacity)
 
-      return result;
+    NTL_PROFILE_RECORD(profile::RecordArrayMoves(m_used - a_index));
+    if constexpr(memory::IsTriviallyRelocatable<T>::value) {
+      std::memmove(static_cast<void*>(m_data + a_index + 1), static_cast<const void*>(m_data + a_index),
+                   (m_used - a_index) * sizeof(ArrayChunk));
+      std::construct_at(&m_data[a_index].value, std::move(a_element));
+    } else if(a_index == m_used) {
+      std::construct_at(&m_data[a_index].value, std::move(a_element));
     } else {
-      VERIFY(has_less_equals_than<T>)
-      return m_data;
+      std::construct_at(&m_data[m_used].value, std::move(m_data[m_used - 1].value));
+      for(Size i = m_used - 1; i > a_index; --i) {
+        m_data[i].value = std::move(m_data[i - 1].value);
+      }
+      m_data[a_index].value = std::move(a_element);
     }
+    m_used++;
   }
 
-  template <typename T>
-  void Array<T>::dynamicSort() {
-    if constexpr(has_less_equals_than<T> && has_bigger_than<T>) {
-      // TODO: improve also using insertion sort when mergesort array is small
-      if(m_used > 64) {
-        mergeSort();
-      } else {
-        insertionSort();
-      }
+  template <typename T, typename Allocator>
+  Size Array<T, Allocator>::insertSorted(T&& a_element) {
+    if constexpr(has_less_than<T>) {
+      // the array might have been modified through references, so restore the order first
+      if(!m_sorted)
+        Sort();
+
+      const Size index = upperBound(a_element, 0, m_used);
+      insertAt(index, std::move(a_element));
+
+      return index;
+    } else {
+      VERIFY(has_less_than<T>)
+      return -1;
     }
   }
 
-  template <typename T>
-  I64 Array<T>::partition(I64 a_from, I64 a_to) {
-    if constexpr(has_less_equals_than<T>) {
-      const T& pivot = m_data[a_to].value;
+  template <typename T, typename Allocator>
+  I64 Array<T, Allocator>::frontBackSearch(const T& a_element, I64 a_from, I64 a_to) const {
+    if constexpr(scan::scannable<T>) {
+      if(a_from > a_to)
+        return -1;
 
-      I64 i = a_from - 1;
+      const I64 index = scan::FindFrontBack(GetData() + a_from, static_cast<Size>(a_to - a_from + 1), a_element);
+      return index < 0 ? -1 : a_from + index;
+    }
 
-      for(I64 j = a_from; j < a_to; ++j) {
-        if(m_data[j].value <= pivot) {
-          Swap(i + 1, j);
-          i++;
-        }
-      }
+    while(a_from <= a_to) {
+      if(m_data[a_from].value == a_element)
+        return a_from;
 
-      Swap(i + 1, a_to);
-      i++;
+      if(m_data[a_to].value == a_element)
+        return a_to;
 
-      return i;
-    } else {
-      VERIFY(has_less_equals_than<T>)
-      return -1;
+      a_from++;
+      a_to--;
     }
+
+    return -1;
   }
 }
 
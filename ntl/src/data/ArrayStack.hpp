@@ -0,0 +1,278 @@
+/**
+* @file ArrayStack.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_ARRAY_STACK_HPP
+#define NTL_ARRAY_STACK_HPP
+
+#include <algorithm>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "data/Array.hpp"
+#include "data/Size.hpp"
+#include "utils/Allocator.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new stack object storing its elements in a growable array.
+   *
+   * @details The top of the stack is the last element of the array, so pushing and popping
+   * never allocate unless the array is full, which doubles its capacity.
+   *
+   * @tparam T the type of the elements to store
+   * @tparam Allocator the allocator of the internal array (see is_allocator)
+   */
+  template<typename T, typename Allocator = DefaultAllocator>
+  class ArrayStack {
+  private:
+    Array<T, Allocator> m_data;
+
+  public:
+    /**
+     * @brief Default capacity of the internal array.
+     */
+    static constexpr Size DEFAULT_CAPACITY = 16;
+
+    /**
+     * @brief Constructs a new stack.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_capacity the initial capacity
+     */
+    explicit ArrayStack(Size a_capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Constructs a new stack allocating its elements using the given allocator.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_capacity the initial capacity
+     * @param a_allocator the allocator
+     */
+    ArrayStack(Size a_capacity, const Allocator& a_allocator);
+
+    /**
+     * @brief Destroys the stack.
+     */
+    ~ArrayStack() = default;
+
+    ArrayStack(const ArrayStack&) = default;
+    ArrayStack(ArrayStack&&) noexcept = default;
+    ArrayStack& operator=(const ArrayStack&) = default;
+    ArrayStack& operator=(ArrayStack&&) noexcept = default;
+
+    /**
+     * @brief Pushes a new element onto the top of the stack.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_element the element to add
+     */
+    void Push(const T& a_element);
+
+    /**
+     * @brief Pushes a new element onto the top of the stack by moving it.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_element the element to add
+     */
+    void Push(T&& a_element);
+
+    /**
+     * @brief Pushes a new element onto the top of the stack by constructing it in place.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     */
+    template<typename... Args>
+    void Emplace(Args&&... a_args);
+
+    /**
+     * @brief Pushes copies of the given elements onto the stack in their order, so the last one ends up on top.
+     *
+     * @details Runtime: O(m), where m is the number of elements to add (growing at most once).
+     *
+     * @param a_elements the first element to add
+     * @param a_count the number of elements to add
+     */
+    void PushMany(const T* a_elements, Size a_count);
+
+    /**
+     * @brief Removes the element on top of the stack and returns it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the element that was removed from the top of the stack
+     */
+    T Pop();
+
+    /**
+     * @brief Removes up to the given number of elements from the top of the stack.
+     *
+     * @details Runtime: O(m), where m is the number of removed elements.
+     *
+     * @param a_elements receives the removed elements from the top on (moved into existing objects)
+     * @param a_count the maximum number of elements to remove
+     * @return the number of removed elements
+     */
+    Size PopMany(T* a_elements, Size a_count);
+
+    /**
+     * @brief Peeks at the element on top of the stack without copying it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the element that is currently on top of the stack
+     */
+    const T& Peek() const;
+
+    /**
+     * @brief Peeks at the element on top of the stack without copying it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the element that is currently on top of the stack
+     */
+    T& Peek();
+
+    /**
+     * @brief Makes sure the stack can hold the given number of elements without growing.
+     *
+     * @details Runtime: O(n), where n is the size of the stack (O(1) if the capacity suffices).
+     *
+     * @param a_capacity the number of elements
+     */
+    void Reserve(Size a_capacity);
+
+    /**
+     * @brief Removes all elements from the stack, keeping its capacity.
+     *
+     * @details Runtime: O(n), where n is the size of the stack (O(1) for trivially destructible types)
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the size of the stack.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the stack
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the number of elements the stack can hold before growing.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the capacity of the stack
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Checks if the stack is empty.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the stack is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+  };
+
+  template<typename T, typename Allocator>
+  ArrayStack<T, Allocator>::ArrayStack(Size a_capacity)
+    : m_data(a_capacity, false, true) {}
+
+  template<typename T, typename Allocator>
+  ArrayStack<T, Allocator>::ArrayStack(Size a_capacity, const Allocator& a_allocator)
+    : m_data(a_capacity, false, true, a_allocator) {}
+
+  template<typename T, typename Allocator>
+  void ArrayStack<T, Allocator>::Push(const T& a_element) {
+    m_data.Emplace(a_element);
+  }
+
+  template<typename T, typename Allocator>
+  void ArrayStack<T, Allocator>::Push(T&& a_element) {
+    m_data.Emplace(std::move(a_element));
+  }
+
+  template<typename T, typename Allocator>
+  template<typename... Args>
+  void ArrayStack<T, Allocator>::Emplace(Args&&... a_args) {
+    m_data.Emplace(std::forward<Args>(a_args)...);
+  }
+
+  template<typename T, typename Allocator>
+  void ArrayStack<T, Allocator>::PushMany(const T* a_elements, Size a_count) {
+    Reserve(m_data.GetSize() + a_count);
+    for(Size i = 0; i < a_count; ++i)
+      m_data.Emplace(a_elements[i]);
+  }
+
+  template<typename T, typename Allocator>
+  T ArrayStack<T, Allocator>::Pop() {
+    VERIFY(!m_data.IsEmpty())
+    return m_data.Remove(m_data.GetSize() - 1);
+  }
+
+  template<typename T, typename Allocator>
+  Size ArrayStack<T, Allocator>::PopMany(T* a_elements, Size a_count) {
+    const Size size = m_data.GetSize();
+    const Size count = std::min(a_count, size);
+
+    T* data = m_data.GetData();
+    for(Size i = 0; i < count; ++i)
+      a_elements[i] = std::move(data[size - 1 - i]);
+
+    m_data.Use(size - count);
+    return count;
+  }
+
+  template<typename T, typename Allocator>
+  const T& ArrayStack<T, Allocator>::Peek() const {
+    VERIFY(!m_data.IsEmpty())
+    return m_data.GetLast();
+  }
+
+  template<typename T, typename Allocator>
+  T& ArrayStack<T, Allocator>::Peek() {
+    VERIFY(!m_data.IsEmpty())
+    return m_data.GetLast();
+  }
+
+  template<typename T, typename Allocator>
+  void ArrayStack<T, Allocator>::Reserve(Size a_capacity) {
+    if(a_capacity > m_data.GetCapacity())
+      m_data.Resize(std::max(a_capacity, m_data.GetCapacity() * 2));
+  }
+
+  template<typename T, typename Allocator>
+  void ArrayStack<T, Allocator>::Clear() {
+    m_data.Clear();
+  }
+
+  template<typename T, typename Allocator>
+  Size ArrayStack<T, Allocator>::GetSize() const {
+    return m_data.GetSize();
+  }
+
+  template<typename T, typename Allocator>
+  Size ArrayStack<T, Allocator>::GetCapacity() const {
+    return m_data.GetCapacity();
+  }
+
+  template<typename T, typename Allocator>
+  bool ArrayStack<T, Allocator>::IsEmpty() const {
+    return m_data.IsEmpty();
+  }
+}
+
+#endif // NTL_ARRAY_STACK_HPP
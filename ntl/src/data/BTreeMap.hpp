@@ -0,0 +1,1274 @@
+/**
+* @file BTreeMap.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_BTREE_MAP_HPP
+#define NTL_BTREE_MAP_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+#include "data/Array.hpp"
+#include "data/Pair.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Allocator.hpp"
+
+namespace ntl {
+  namespace detail {
+    /**
+     * @brief Default size of the key (and value) arrays of a B-tree node in bytes.
+     */
+    inline constexpr Size BTREE_NODE_SIZE = 4 * NTL_CACHE_LINE_SIZE;
+
+    /**
+     * @brief Value of the entries of a BTreeSet, which takes no space in the nodes.
+     */
+    struct BTreeSetValue {
+      bool operator==(const BTreeSetValue&) const = default;
+    };
+
+    /**
+     * @brief Inserts an element into the constructed prefix of an array.
+     *
+     * @param a_array the array (with room for one more element)
+     * @param a_count the number of constructed elements
+     * @param a_index the index of the new element
+     * @param a_element the element
+     */
+    template <typename T>
+    void BTreeInsert(T* a_array, const Size a_count, const Size a_index, T&& a_element) {
+      if(a_index == a_count) {
+        std::construct_at(a_array + a_count, std::move(a_element));
+        return;
+      }
+
+      std::construct_at(a_array + a_count, std::move(a_array[a_count - 1]));
+      std::move_backward(a_array + a_index, a_array + a_count - 1, a_array + a_count);
+      a_array[a_index] = std::move(a_element);
+    }
+
+    /**
+     * @brief Removes an element from the constructed prefix of an array.
+     *
+     * @param a_array the array
+     * @param a_count the number of constructed elements
+     * @param a_index the index of the element
+     */
+    template <typename T>
+    void BTreeErase(T* a_array, const Size a_count, const Size a_index) {
+      std::move(a_array + a_index + 1, a_array + a_count, a_array + a_index);
+      std::destroy_at(a_array + a_count - 1);
+    }
+
+    /**
+     * @brief Moves elements into uninitialized memory, destroying the moved-from elements.
+     *
+     * @param a_source the first element to move
+     * @param a_count the number of elements
+     * @param a_target the uninitialized destination
+     */
+    template <typename T>
+    void BTreeRelocate(T* a_source, const Size a_count, T* a_target) {
+      for(Size i = 0; i < a_count; ++i)
+        std::construct_at(a_target + i, std::move(a_source[i]));
+      std::destroy_n(a_source, a_count);
+    }
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  class BTreeSet;
+
+  /**
+   * @brief Constructs a new sorted map object.
+   *
+   * @details The map is a B+ tree: all entries are stored sorted in leaves holding about node_size bytes of
+   * keys and values, which are linked for iteration, and the inner nodes only hold separator keys. Lookups,
+   * insertions and removals take O(log(n)) steps over a few cache lines each, and ranges are iterated at the
+   * speed of an array, leaf by leaf. Keys are compared with operator<.
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam ValueType the type of the values
+   * @tparam node_size the size of the key (and value) arrays of a node in bytes
+   * @tparam Allocator the allocator of the nodes (see is_allocator)
+   *
+   * @note Iterators are invalidated by insertions and removals. The map isn't thread-safe: concurrent
+   * range scans have to share a lock (like SharedLock) with the writers.
+   */
+  template <typename KeyType, typename ValueType, Size node_size = detail::BTREE_NODE_SIZE,
+            typename Allocator = DefaultAllocator>
+  class BTreeMap {
+    template <typename, Size, typename>
+    friend class BTreeSet;
+
+    static constexpr bool EMPTY_VALUE = std::is_empty_v<ValueType>;
+
+  public:
+    /**
+     * @brief The maximum number of entries of a leaf.
+     */
+    static constexpr Size LEAF_CAPACITY =
+      std::max<Size>(4, node_size / (sizeof(KeyType) + (EMPTY_VALUE ? 0 : sizeof(ValueType))));
+
+    /**
+     * @brief The maximum number of keys of an inner node (which has one child more).
+     */
+    static constexpr Size INNER_CAPACITY = std::max<Size>(4, node_size / (sizeof(KeyType) + sizeof(void*)));
+
+  private:
+    /**
+     * @brief The part shared by leaves and inner nodes (which are told apart by their depth).
+     */
+    struct Node {
+      Size count;
+    };
+
+    /**
+     * @brief Represents a node holding entries, with room for one more while it is split.
+     */
+    struct Leaf : Node {
+      Leaf* prev;
+      Leaf* next;
+      union {
+        KeyType keys[LEAF_CAPACITY + 1];
+      };
+      union {
+        ValueType values[EMPTY_VALUE ? 1 : LEAF_CAPACITY + 1];
+      };
+
+      Leaf() : Node{0}, prev{nullptr}, next{nullptr} {
+        if constexpr(EMPTY_VALUE)
+          std::construct_at(values);
+      }
+
+      ~Leaf() {}
+    };
+
+    /**
+     * @brief Represents a node holding separator keys, with room for one more while it is split.
+     *
+     * @details The subtree of children[i] holds the keys less than keys[i] and at least keys[i - 1].
+     */
+    struct Inner : Node {
+      union {
+        KeyType keys[INNER_CAPACITY + 1];
+      };
+      Node* children[INNER_CAPACITY + 2];
+
+      Inner() : Node{0} {}
+      ~Inner() {}
+    };
+
+    /**
+     * @brief An inner node on the way down and the index of the child that was taken.
+     */
+    struct Step {
+      Inner* node;
+      Size index;
+    };
+
+    /**
+     * @brief The maximum height of the tree (every inner node has at least two children).
+     */
+    static constexpr Size MAX_DEPTH = 64;
+
+  public:
+    /**
+     * @brief Iterator class to simplify iteration over the map in key order.
+     */
+    class Iterator {
+      friend class BTreeMap;
+
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = Pair<const KeyType&, ValueType&>;
+      using pointer = void;
+      using reference = value_type;
+
+    private:
+      Leaf* m_leaf;
+      Size m_index;
+
+    public:
+      /**
+       * @brief Constructs a new iterator
+       * @param a_leaf the leaf of the entry (nullptr for the end)
+       * @param a_index the index of the entry in its leaf
+       */
+      Iterator(Leaf* a_leaf, Size a_index) : m_leaf(a_leaf), m_index(a_index) {}
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the key and value of the current iteration
+       */
+      reference operator*() const { return {GetKey(), GetValue()}; }
+
+      /**
+       * @brief Gets the key of the current iteration.
+       * @return the key
+       */
+      const KeyType& GetKey() const { return m_leaf->keys[m_index]; }
+
+      /**
+       * @brief Gets the value of the current iteration.
+       * @return the value
+       */
+      ValueType& GetValue() const { return value(m_leaf, m_index); }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the reference to the next iterator
+       */
+      Iterator& operator++() {
+        if(++m_index == m_leaf->count) {
+          m_leaf = m_leaf->next;
+          m_index = 0;
+        }
+        return *this;
+      }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the next iterator
+       */
+      Iterator operator++(int) {
+        Iterator temp = *this;
+        ++*this;
+        return temp;
+      }
+
+      /**
+       * @brief Overloading equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators are equivalent
+       */
+      friend bool operator==(const Iterator& a_first, const Iterator& a_second) {
+        return a_first.m_leaf == a_second.m_leaf && a_first.m_index == a_second.m_index;
+      }
+
+      /**
+       * @brief Overloading anti equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators aren't equivalent
+       */
+      friend bool operator!=(const Iterator& a_first, const Iterator& a_second) {
+        return !(a_first == a_second);
+      }
+    };
+
+    /**
+     * @brief A range of entries, which can be iterated with a range-based for loop.
+     */
+    struct Range {
+      Iterator first;
+      Iterator last;
+
+      Iterator begin() const { return first; }
+      Iterator end() const { return last; }
+    };
+
+  private:
+    Node* m_root;
+    Leaf* m_first;
+    Leaf* m_last;
+    Size m_height,
+         m_size;
+    [[no_unique_address]] Allocator m_allocator;
+
+  public:
+    /**
+     * @brief Constructs a new empty map.
+     *
+     * @param a_allocator the allocator of the nodes
+     */
+    explicit BTreeMap(const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Constructs a new map from another one, bulk-loading its entries.
+     *
+     * @details Runtime: O(n), where n is the size of the other map.
+     *
+     * @param a_other the other map
+     */
+    BTreeMap(const BTreeMap& a_other);
+
+    /**
+     * @brief Constructs a new map by taking over the nodes of another one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other map (empty afterwards)
+     */
+    BTreeMap(BTreeMap&& a_other) noexcept;
+
+    /**
+     * @brief Destructs the map and its entries.
+     */
+    ~BTreeMap();
+
+    /**
+     * @brief Overloading assignment operator.
+     * @param a_other the map to copy
+     * @return the reference of the current map object
+     */
+    BTreeMap& operator=(const BTreeMap& a_other);
+
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other the map to take the nodes from
+     * @return the reference of the current map object
+     */
+    BTreeMap& operator=(BTreeMap&& a_other) noexcept;
+
+    /**
+     * @brief Inserts an entry or replaces the value of an existing one.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @param a_value the value of the entry
+     * @return if a new entry was inserted
+     */
+    bool Insert(const KeyType& a_key, const ValueType& a_value);
+
+    /**
+     * @brief Inserts an entry or replaces the value of an existing one by moving them into the map.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @param a_value the value of the entry
+     * @return if a new entry was inserted
+     */
+    bool Insert(KeyType&& a_key, ValueType&& a_value);
+
+    /**
+     * @brief Removes the entry with the given key, if it exists.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return if an entry was removed
+     */
+    bool Remove(const KeyType& a_key);
+
+    /**
+     * @brief Replaces all entries with the given ones, building the tree bottom-up.
+     *
+     * @details Runtime: O(m), where m is the size of the array.
+     *
+     * @param a_entries the entries sorted by strictly increasing keys
+     */
+    template <typename ArrayAllocator>
+    void Load(const Array<Pair<KeyType, ValueType>, ArrayAllocator>& a_entries);
+
+    /**
+     * @brief Removes all entries.
+     *
+     * @details Runtime: O(n), where n is the size of the map.
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the value at the given key, inserting a default constructed one if it doesn't exist.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return the value
+     */
+    ValueType& At(const KeyType& a_key);
+
+    /**
+     * @brief Gets the value at the given key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return the value itself
+     */
+    ValueType& Get(const KeyType& a_key) const;
+
+    /**
+     * @brief Gets a pointer to the value at the given key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return the pointer to the value (nullptr if the key doesn't exist), valid until the next modification
+     */
+    ValueType* TryGet(const KeyType& a_key) const;
+
+    /**
+     * @brief Checks if an entry with the given key exists.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key to check
+     * @return if the entry exists
+     */
+    [[nodiscard]] bool Exists(const KeyType& a_key) const;
+
+    /**
+     * @brief Finds the entry with the given key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return the iterator of the entry (end if it doesn't exist)
+     */
+    Iterator Find(const KeyType& a_key) const;
+
+    /**
+     * @brief Finds the first entry with a key not less than the given one.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key to compare with
+     * @return the iterator of the entry (end if there is none)
+     */
+    Iterator LowerBound(const KeyType& a_key) const;
+
+    /**
+     * @brief Finds the first entry with a key greater than the given one.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key to compare with
+     * @return the iterator of the entry (end if there is none)
+     */
+    Iterator UpperBound(const KeyType& a_key) const;
+
+    /**
+     * @brief Gets the entries with keys in [a_low, a_high).
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map (plus O(1) per iterated entry).
+     *
+     * @param a_low the lowest key of the range
+     * @param a_high the key after the range
+     * @return the range of entries
+     */
+    Range GetRange(const KeyType& a_low, const KeyType& a_high) const;
+
+    /**
+     * @brief Gets the smallest key.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the smallest key
+     */
+    const KeyType& GetMin() const;
+
+    /**
+     * @brief Gets the greatest key.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the greatest key
+     */
+    const KeyType& GetMax() const;
+
+    /**
+     * @brief Checks if the map is empty.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the map is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Gets the number of entries.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the map
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the number of levels of the tree.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the height of the tree (0 if empty, 1 if the root is a leaf)
+     */
+    [[nodiscard]] Size GetHeight() const;
+
+    /**
+     * @brief Checks if the map is equal to another one.
+     *
+     * @details Runtime: O(n), where n is the size of the map.
+     *
+     * @param a_other the other map to compare with
+     * @return if both maps hold the same entries
+     */
+    bool IsEqual(const BTreeMap& a_other) const;
+
+    /**
+     * @brief Converts the map to a string.
+     *
+     * @details Runtime: O(n), where n is the size of the map.
+     *
+     * @return the map as a string
+     */
+    [[nodiscard]] String ToString() const;
+
+    ValueType& operator[](const KeyType& a_key);
+    const ValueType& operator[](const KeyType& a_key) const;
+    bool operator==(const BTreeMap& a_other) const;
+    bool operator!=(const BTreeMap& a_other) const;
+
+    // ------------------------
+    // ITERATOR-RELATED METHODS
+    // ------------------------
+    Iterator begin() const;
+    Iterator end() const;
+
+  private:
+    /**
+     * @brief Gets the value at the given index of a leaf.
+     *
+     * @param a_leaf the leaf
+     * @param a_index the index of the entry
+     * @return the value
+     */
+    static ValueType& value(Leaf* a_leaf, Size a_index);
+
+    /**
+     * @brief Descends to the leaf that holds the given key if it exists.
+     *
+     * @param a_key the key
+     * @param a_path receives the inner nodes on the way down (may be nullptr)
+     * @return the leaf
+     */
+    Leaf* descend(const KeyType& a_key, Step* a_path) const;
+
+    /**
+     * @brief Normalizes a position behind the last entry of a leaf to the first entry of the next leaf.
+     *
+     * @param a_leaf the leaf
+     * @param a_index the index in the leaf (at most its count)
+     * @return the iterator
+     */
+    static Iterator position(Leaf* a_leaf, Size a_index);
+
+    /**
+     * @brief Inserts an entry or replaces the value of an existing one.
+     *
+     * @param a_key the key of the entry
+     * @param a_value the value of the entry
+     * @return if a new entry was inserted
+     */
+    template <typename Key, typename Value>
+    bool insert(Key&& a_key, Value&& a_value);
+
+    /**
+     * @brief Splits the overflowing leaf at the end of the path and inserts the separators upwards.
+     *
+     * @param a_leaf the leaf holding one entry more than its capacity
+     * @param a_path the inner nodes on the way down to the leaf
+     */
+    void split(Leaf* a_leaf, Step* a_path);
+
+    /**
+     * @brief Refills the underflowing leaf at the end of the path from a sibling or merges it into one.
+     *
+     * @param a_leaf the leaf holding fewer than half of its capacity
+     * @param a_path the inner nodes on the way down to the leaf
+     */
+    void rebalance(Leaf* a_leaf, Step* a_path);
+
+    /**
+     * @brief Refills the underflowing inner node at the given depth or merges it into a sibling.
+     *
+     * @param a_path the inner nodes on the way down
+     * @param a_depth the depth of the underflowing node in the path
+     */
+    void rebalance(Step* a_path, Size a_depth);
+
+    /**
+     * @brief Builds the tree bottom-up from sorted entries.
+     *
+     * @param a_count the number of entries
+     * @param a_emplace a callable constructing the next entry from (KeyType*, ValueType*)
+     */
+    template <typename Emplace>
+    void load(Size a_count, Emplace&& a_emplace);
+
+    /**
+     * @brief Destroys the subtree of the given node.
+     *
+     * @param a_node the node
+     * @param a_height the number of levels of the subtree
+     */
+    void destroy(Node* a_node, Size a_height);
+
+    Leaf* createLeaf();
+    Inner* createInner();
+    void destroyLeaf(Leaf* a_leaf);
+    void destroyInner(Inner* a_inner);
+
+    /**
+     * @brief Swaps the nodes and allocators with another map.
+     *
+     * @param a_other the other map
+     */
+    void swap(BTreeMap& a_other) noexcept;
+  };
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Iterator
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::begin() const {
+    return Iterator(m_first, 0);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Iterator
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::end() const {
+    return Iterator(nullptr, 0);
+  }
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_map the map
+   * @return the combined ostream
+   */
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const BTreeMap<KeyType, ValueType, node_size, Allocator>& a_map) {
+    return (a_stream << a_map.ToString());
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::BTreeMap(const Allocator& a_allocator)
+    : m_root{nullptr}, m_first{nullptr}, m_last{nullptr}, m_height{0}, m_size{0}, m_allocator{a_allocator} {
+    // Empty
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::BTreeMap(const BTreeMap& a_other)
+    : BTreeMap(a_other.m_allocator) {
+    Iterator it = a_other.begin();
+    load(a_other.m_size, [&](KeyType* a_key, ValueType* a_value) {
+      std::construct_at(a_key, it.GetKey());
+      if constexpr(!EMPTY_VALUE)
+        std::construct_at(a_value, it.GetValue());
+      ++it;
+    });
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::BTreeMap(BTreeMap&& a_other) noexcept
+    : BTreeMap(a_other.m_allocator) {
+    swap(a_other);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::~BTreeMap() {
+    Clear();
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  BTreeMap<KeyType, ValueType, node_size, Allocator>&
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::operator=(const BTreeMap& a_other) {
+    if(this != &a_other) {
+      BTreeMap copy(a_other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  BTreeMap<KeyType, ValueType, node_size, Allocator>&
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::operator=(BTreeMap&& a_other) noexcept {
+    swap(a_other);
+    return *this;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  bool BTreeMap<KeyType, ValueType, node_size, Allocator>::Insert(const KeyType& a_key, const ValueType& a_value) {
+    return insert(a_key, a_value);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  bool BTreeMap<KeyType, ValueType, node_size, Allocator>::Insert(KeyType&& a_key, ValueType&& a_value) {
+    return insert(std::move(a_key), std::move(a_value));
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  bool BTreeMap<KeyType, ValueType, node_size, Allocator>::Remove(const KeyType& a_key) {
+    if(!m_root)
+      return false;
+
+    Step path[MAX_DEPTH];
+    Leaf* leaf = descend(a_key, path);
+    const Size index = std::lower_bound(leaf->keys, leaf->keys + leaf->count, a_key) - leaf->keys;
+    if(index == leaf->count || a_key < leaf->keys[index])
+      return false;
+
+    detail::BTreeErase(leaf->keys, leaf->count, index);
+    if constexpr(!EMPTY_VALUE)
+      detail::BTreeErase(leaf->values, leaf->count, index);
+    leaf->count--;
+    m_size--;
+
+    if(m_height == 1) {
+      if(leaf->count == 0) {
+        destroyLeaf(leaf);
+        m_root = nullptr;
+        m_first = m_last = nullptr;
+        m_height = 0;
+      }
+    } else if(leaf->count < LEAF_CAPACITY / 2) {
+      rebalance(leaf, path);
+    }
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  template <typename ArrayAllocator>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::Load(const Array<Pair<KeyType, ValueType>, ArrayAllocator>& a_entries) {
+    for(Size i = 1; i < a_entries.GetSize(); ++i) {
+      VERIFY(a_entries[i - 1].first < a_entries[i].first && "the entries have to be sorted by unique keys")
+    }
+
+    Clear();
+    Size next = 0;
+    load(a_entries.GetSize(), [&](KeyType* a_key, ValueType* a_value) {
+      std::construct_at(a_key, a_entries[next].first);
+      if constexpr(!EMPTY_VALUE)
+        std::construct_at(a_value, a_entries[next].second);
+      next++;
+    });
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::Clear() {
+    if(m_root)
+      destroy(m_root, m_height);
+
+    m_root = nullptr;
+    m_first = m_last = nullptr;
+    m_height = 0;
+    m_size = 0;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  ValueType& BTreeMap<KeyType, ValueType, node_size, Allocator>::At(const KeyType& a_key) {
+    ValueType* value = TryGet(a_key);
+    if(value)
+      return *value;
+
+    insert(a_key, ValueType{});
+    return *TryGet(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  ValueType& BTreeMap<KeyType, ValueType, node_size, Allocator>::Get(const KeyType& a_key) const {
+    ValueType* value = TryGet(a_key);
+    VERIFY(value && "No entry at key found")
+    return *value;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  ValueType* BTreeMap<KeyType, ValueType, node_size, Allocator>::TryGet(const KeyType& a_key) const {
+    if(!m_root)
+      return nullptr;
+
+    Leaf* leaf = descend(a_key, nullptr);
+    const Size index = std::lower_bound(leaf->keys, leaf->keys + leaf->count, a_key) - leaf->keys;
+    if(index == leaf->count || a_key < leaf->keys[index])
+      return nullptr;
+    return &value(leaf, index);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  bool BTreeMap<KeyType, ValueType, node_size, Allocator>::Exists(const KeyType& a_key) const {
+    return TryGet(a_key) != nullptr;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Iterator
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::Find(const KeyType& a_key) const {
+    const Iterator it = LowerBound(a_key);
+    if(it == end() || a_key < it.GetKey())
+      return end();
+    return it;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Iterator
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::LowerBound(const KeyType& a_key) const {
+    if(!m_root)
+      return end();
+
+    Leaf* leaf = descend(a_key, nullptr);
+    return position(leaf, std::lower_bound(leaf->keys, leaf->keys + leaf->count, a_key) - leaf->keys);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Iterator
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::UpperBound(const KeyType& a_key) const {
+    if(!m_root)
+      return end();
+
+    Leaf* leaf = descend(a_key, nullptr);
+    return position(leaf, std::upper_bound(leaf->keys, leaf->keys + leaf->count, a_key) - leaf->keys);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Range
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::GetRange(const KeyType& a_low, const KeyType& a_high) const {
+    if(!(a_low < a_high))
+      return {end(), end()};
+    return {LowerBound(a_low), LowerBound(a_high)};
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  const KeyType& BTreeMap<KeyType, ValueType, node_size, Allocator>::GetMin() const {
+    VERIFY(m_size > 0)
+    return m_first->keys[0];
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  const KeyType& BTreeMap<KeyType, ValueType, node_size, Allocator>::GetMax() const {
+    VERIFY(m_size > 0)
+    return m_last->keys[m_last->count - 1];
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  bool BTreeMap<KeyType, ValueType, node_size, Allocator>::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  Size BTreeMap<KeyType, ValueType, node_size, Allocator>::GetSize() const {
+    return m_size;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  Size BTreeMap<KeyType, ValueType, node_size, Allocator>::GetHeight() const {
+    return m_height;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  bool BTreeMap<KeyType, ValueType, node_size, Allocator>::IsEqual(const BTreeMap& a_other) const {
+    if(m_size != a_other.m_size)
+      return false;
+
+    for(Iterator it = begin(), other = a_other.begin(); it != end(); ++it, ++other) {
+      if(!(it.GetKey() == other.GetKey()) || !(it.GetValue() == other.GetValue()))
+        return false;
+    }
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  String BTreeMap<KeyType, ValueType, node_size, Allocator>::ToString() const {
+    Size estimate = 10;
+    for(Iterator it = begin(); it != end(); ++it)
+      estimate += StringBuilder::Measure(it.GetKey()) + StringBuilder::Measure(it.GetValue()) + 5;
+
+    StringBuilder builder{estimate};
+    builder.Append("BTreeMap(");
+
+    for(Iterator it = begin(); it != end(); ++it) {
+      if(it != begin())
+        builder.Append(", ");
+      builder.Append(it.GetKey()).Append(" : ").Append(it.GetValue());
+    }
+
+    builder.Append(")");
+    return builder.Build();
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  ValueType& BTreeMap<KeyType, ValueType, node_size, Allocator>::operator[](const KeyType& a_key) {
+    return At(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  const ValueType& BTreeMap<KeyType, ValueType, node_size, Allocator>::operator[](const KeyType& a_key) const {
+    return Get(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  bool BTreeMap<KeyType, ValueType, node_size, Allocator>::operator==(const BTreeMap& a_other) const {
+    return IsEqual(a_other);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  bool BTreeMap<KeyType, ValueType, node_size, Allocator>::operator!=(const BTreeMap& a_other) const {
+    return !IsEqual(a_other);
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  ValueType& BTreeMap<KeyType, ValueType, node_size, Allocator>::value(Leaf* a_leaf, const Size a_index) {
+    if constexpr(EMPTY_VALUE)
+      return a_leaf->values[0];
+    else
+      return a_leaf->values[a_index];
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Leaf*
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::descend(const KeyType& a_key, Step* a_path) const {
+    Node* node = m_root;
+    for(Size depth = 0; depth + 1 < m_height; ++depth) {
+      auto* inner = static_cast<Inner*>(node);
+      const Size index = std::upper_bound(inner->keys, inner->keys + inner->count, a_key) - inner->keys;
+      if(a_path)
+        a_path[depth] = {inner, index};
+      node = inner->children[index];
+    }
+    return static_cast<Leaf*>(node);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Iterator
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::position(Leaf* a_leaf, const Size a_index) {
+    if(a_index < a_leaf->count)
+      return Iterator(a_leaf, a_index);
+    return Iterator(a_leaf->next, 0);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  template <typename Key, typename Value>
+  bool BTreeMap<KeyType, ValueType, node_size, Allocator>::insert(Key&& a_key, Value&& a_value) {
+    if(!m_root) {
+      m_first = m_last = createLeaf();
+      m_root = m_first;
+      m_height = 1;
+    }
+
+    Step path[MAX_DEPTH];
+    Leaf* leaf = descend(a_key, path);
+    const Size index = std::lower_bound(leaf->keys, leaf->keys + leaf->count, a_key) - leaf->keys;
+    if(index < leaf->count && !(a_key < leaf->keys[index])) {
+      value(leaf, index) = std::forward<Value>(a_value);
+      return false;
+    }
+
+    detail::BTreeInsert(leaf->keys, leaf->count, index, KeyType(std::forward<Key>(a_key)));
+    if constexpr(!EMPTY_VALUE)
+      detail::BTreeInsert(leaf->values, leaf->count, index, ValueType(std::forward<Value>(a_value)));
+    leaf->count++;
+    m_size++;
+
+    if(leaf->count > LEAF_CAPACITY)
+      split(leaf, path);
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::split(Leaf* a_leaf, Step* a_path) {
+    // the upper half of the leaf moves into a new right sibling, whose first key separates both
+    Leaf* right = createLeaf();
+    const Size kept = a_leaf->count / 2;
+    right->count = a_leaf->count - kept;
+    detail::BTreeRelocate(a_leaf->keys + kept, right->count, right->keys);
+    if constexpr(!EMPTY_VALUE)
+      detail::BTreeRelocate(a_leaf->values + kept, right->count, right->values);
+    a_leaf->count = kept;
+
+    right->prev = a_leaf;
+    right->next = a_leaf->next;
+    if(right->next)
+      right->next->prev = right;
+    else
+      m_last = right;
+    a_leaf->next = right;
+
+    KeyType separator = right->keys[0];
+    Node* child = right;
+    for(Size depth = m_height - 1; depth-- > 0;) {
+      Inner* parent = a_path[depth].node;
+      const Size index = a_path[depth].index;
+      detail::BTreeInsert(parent->keys, parent->count, index, std::move(separator));
+      detail::BTreeInsert(parent->children, parent->count + 1, index + 1, std::move(child));
+      parent->count++;
+      if(parent->count <= INNER_CAPACITY)
+        return;
+
+      // the middle key moves up, the keys after it move into a new right sibling
+      Inner* sibling = createInner();
+      const Size middle = parent->count / 2;
+      sibling->count = parent->count - middle - 1;
+      separator = std::move(parent->keys[middle]);
+      detail::BTreeRelocate(parent->keys + middle + 1, sibling->count, sibling->keys);
+      std::destroy_at(parent->keys + middle);
+      std::copy_n(parent->children + middle + 1, sibling->count + 1, sibling->children);
+      parent->count = middle;
+      child = sibling;
+    }
+
+    // the root was split, so the tree grows by one level
+    Inner* root = createInner();
+    std::construct_at(root->keys, std::move(separator));
+    root->children[0] = m_root;
+    root->children[1] = child;
+    root->count = 1;
+    m_root = root;
+    m_height++;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::rebalance(Leaf* a_leaf, Step* a_path) {
+    const Size depth = m_height - 2;
+    Inner* parent = a_path[depth].node;
+    const Size index = a_path[depth].index;
+    Leaf* left = index > 0 ? static_cast<Leaf*>(parent->children[index - 1]) : nullptr;
+    Leaf* right = index < parent->count ? static_cast<Leaf*>(parent->children[index + 1]) : nullptr;
+
+    if(left && left->count > LEAF_CAPACITY / 2) {
+      detail::BTreeInsert(a_leaf->keys, a_leaf->count, 0, std::move(left->keys[left->count - 1]));
+      std::destroy_at(left->keys + left->count - 1);
+      if constexpr(!EMPTY_VALUE) {
+        detail::BTreeInsert(a_leaf->values, a_leaf->count, 0, std::move(left->values[left->count - 1]));
+        std::destroy_at(left->values + left->count - 1);
+      }
+      left->count--;
+      a_leaf->count++;
+      parent->keys[index - 1] = a_leaf->keys[0];
+      return;
+    }
+
+    if(right && right->count > LEAF_CAPACITY / 2) {
+      std::construct_at(a_leaf->keys + a_leaf->count, std::move(right->keys[0]));
+      detail::BTreeErase(right->keys, right->count, 0);
+      if constexpr(!EMPTY_VALUE) {
+        std::construct_at(a_leaf->values + a_leaf->count, std::move(right->values[0]));
+        detail::BTreeErase(right->values, right->count, 0);
+      }
+      right->count--;
+      a_leaf->count++;
+      parent->keys[index] = right->keys[0];
+      return;
+    }
+
+    // both siblings are at most half full, so they can take the remaining entries
+    Leaf* target = left ? left : a_leaf;
+    Leaf* source = left ? a_leaf : right;
+    const Size removed = left ? index : index + 1;
+
+    detail::BTreeRelocate(source->keys, source->count, target->keys + target->count);
+    if constexpr(!EMPTY_VALUE)
+      detail::BTreeRelocate(source->values, source->count, target->values + target->count);
+    target->count += source->count;
+    source->count = 0;
+
+    target->next = source->next;
+    if(source->next)
+      source->next->prev = target;
+    else
+      m_last = target;
+    destroyLeaf(source);
+
+    detail::BTreeErase(parent->keys, parent->count, removed - 1);
+    detail::BTreeErase(parent->children, parent->count + 1, removed);
+    parent->count--;
+    rebalance(a_path, depth);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::rebalance(Step* a_path, const Size a_depth) {
+    Inner* node = a_path[a_depth].node;
+    if(a_depth == 0) {
+      // an empty root only has a single child left, which becomes the new root
+      if(node->count == 0) {
+        m_root = node->children[0];
+        destroyInner(node);
+        m_height--;
+      }
+      return;
+    }
+    if(node->count >= INNER_CAPACITY / 2)
+      return;
+
+    Inner* parent = a_path[a_depth - 1].node;
+    const Size index = a_path[a_depth - 1].index;
+    Inner* left = index > 0 ? static_cast<Inner*>(parent->children[index - 1]) : nullptr;
+    Inner* right = index < parent->count ? static_cast<Inner*>(parent->children[index + 1]) : nullptr;
+
+    if(left && left->count > INNER_CAPACITY / 2) {
+      // rotate the last child of the left sibling over the separator
+      detail::BTreeInsert(node->keys, node->count, 0, std::move(parent->keys[index - 1]));
+      detail::BTreeInsert(node->children, node->count + 1, 0, std::move(left->children[left->count]));
+      parent->keys[index - 1] = std::move(left->keys[left->count - 1]);
+      std::destroy_at(left->keys + left->count - 1);
+      left->count--;
+      node->count++;
+      return;
+    }
+
+    if(right && right->count > INNER_CAPACITY / 2) {
+      std::construct_at(node->keys + node->count, std::move(parent->keys[index]));
+      node->children[node->count + 1] = right->children[0];
+      parent->keys[index] = std::move(right->keys[0]);
+      detail::BTreeErase(right->keys, right->count, 0);
+      detail::BTreeErase(right->children, right->count + 1, 0);
+      right->count--;
+      node->count++;
+      return;
+    }
+
+    // merge with a sibling, pulling the separator between both down
+    Inner* target = left ? left : node;
+    Inner* source = left ? node : right;
+    const Size removed = left ? index : index + 1;
+
+    std::construct_at(target->keys + target->count, std::move(parent->keys[removed - 1]));
+    detail::BTreeRelocate(source->keys, source->count, target->keys + target->count + 1);
+    std::copy_n(source->children, source->count + 1, target->children + target->count + 1);
+    target->count += source->count + 1;
+    source->count = 0;
+    destroyInner(source);
+
+    detail::BTreeErase(parent->keys, parent->count, removed - 1);
+    detail::BTreeErase(parent->children, parent->count + 1, removed);
+    parent->count--;
+    rebalance(a_path, a_depth - 1);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  template <typename Emplace>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::load(const Size a_count, Emplace&& a_emplace) {
+    if(a_count == 0)
+      return;
+
+    // the entries are spread evenly, so every node is at least half full
+    Size count = (a_count + LEAF_CAPACITY - 1) / LEAF_CAPACITY;
+    Node** level = memory::Allocate<Node*>(m_allocator, count);
+    const KeyType** minimums = memory::Allocate<const KeyType*>(m_allocator, count);
+
+    Leaf* previous = nullptr;
+    for(Size i = 0; i < count; ++i) {
+      Leaf* leaf = createLeaf();
+      leaf->count = a_count / count + (i < a_count % count);
+      for(Size j = 0; j < leaf->count; ++j)
+        a_emplace(leaf->keys + j, EMPTY_VALUE ? nullptr : leaf->values + j);
+
+      leaf->prev = previous;
+      if(previous)
+        previous->next = leaf;
+      else
+        m_first = leaf;
+      previous = leaf;
+
+      level[i] = leaf;
+      minimums[i] = leaf->keys;
+    }
+    m_last = previous;
+    m_size = a_count;
+    m_height = 1;
+
+    // every inner level takes the smallest key of each child but the first as separators
+    while(count > 1) {
+      const Size parents = (count + INNER_CAPACITY) / (INNER_CAPACITY + 1);
+      Size child = 0;
+      for(Size i = 0; i < parents; ++i) {
+        Inner* inner = createInner();
+        const Size children = count / parents + (i < count % parents);
+        for(Size j = 0; j < children; ++j, ++child) {
+          inner->children[j] = level[child];
+          if(j > 0)
+            std::construct_at(inner->keys + j - 1, *minimums[child]);
+        }
+        inner->count = children - 1;
+
+        minimums[i] = minimums[child - children];
+        level[i] = inner;
+      }
+      count = parents;
+      m_height++;
+    }
+
+    m_root = level[0];
+    const Size allocated = (a_count + LEAF_CAPACITY - 1) / LEAF_CAPACITY;
+    memory::Deallocate(m_allocator, level, allocated);
+    memory::Deallocate(m_allocator, minimums, allocated);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::destroy(Node* a_node, const Size a_height) {
+    if(a_height == 1) {
+      destroyLeaf(static_cast<Leaf*>(a_node));
+      return;
+    }
+
+    auto* inner = static_cast<Inner*>(a_node);
+    for(Size i = 0; i <= inner->count; ++i)
+      destroy(inner->children[i], a_height - 1);
+    destroyInner(inner);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Leaf*
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::createLeaf() {
+    return ::new(memory::Allocate<Leaf>(m_allocator, 1)) Leaf;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  typename BTreeMap<KeyType, ValueType, node_size, Allocator>::Inner*
+  BTreeMap<KeyType, ValueType, node_size, Allocator>::createInner() {
+    return ::new(memory::Allocate<Inner>(m_allocator, 1)) Inner;
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::destroyLeaf(Leaf* a_leaf) {
+    std::destroy_n(a_leaf->keys, a_leaf->count);
+    if constexpr(EMPTY_VALUE)
+      std::destroy_at(a_leaf->values);
+    else
+      std::destroy_n(a_leaf->values, a_leaf->count);
+
+    a_leaf->~Leaf();
+    memory::Deallocate(m_allocator, a_leaf, 1);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::destroyInner(Inner* a_inner) {
+    std::destroy_n(a_inner->keys, a_inner->count);
+    a_inner->~Inner();
+    memory::Deallocate(m_allocator, a_inner, 1);
+  }
+
+  template <typename KeyType, typename ValueType, Size node_size, typename Allocator>
+  void BTreeMap<KeyType, ValueType, node_size, Allocator>::swap(BTreeMap& a_other) noexcept {
+    std::swap(m_root, a_other.m_root);
+    std::swap(m_first, a_other.m_first);
+    std::swap(m_last, a_other.m_last);
+    std::swap(m_height, a_other.m_height);
+    std::swap(m_size, a_other.m_size);
+    std::swap(m_allocator, a_other.m_allocator);
+  }
+}
+
+#endif // NTL_BTREE_MAP_HPP
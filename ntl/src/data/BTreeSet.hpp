@@ -0,0 +1,439 @@
+/**
+* @file BTreeSet.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_BTREE_SET_HPP
+#define NTL_BTREE_SET_HPP
+
+#include <iterator>
+#include <memory>
+
+#include "core/Assert.hpp"
+#include "data/Array.hpp"
+#include "data/BTreeMap.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Allocator.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new sorted set object.
+   *
+   * @details The set is a BTreeMap whose values take no space, so a leaf holds node_size bytes of keys.
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam node_size the size of the key array of a node in bytes
+   * @tparam Allocator the allocator of the nodes (see is_allocator)
+   *
+   * @note Iterators are invalidated by insertions and removals. The set isn't thread-safe.
+   */
+  template <typename KeyType, Size node_size = detail::BTREE_NODE_SIZE, typename Allocator = DefaultAllocator>
+  class BTreeSet {
+    using Tree = BTreeMap<KeyType, detail::BTreeSetValue, node_size, Allocator>;
+
+  public:
+    /**
+     * @brief Iterator class to simplify iteration over the set in key order.
+     */
+    class Iterator {
+      friend class BTreeSet;
+
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = KeyType;
+      using pointer = const KeyType*;
+      using reference = const KeyType&;
+
+    private:
+      typename Tree::Iterator m_it;
+
+    public:
+      /**
+       * @brief Constructs a new iterator
+       * @param a_it the iterator of the tree
+       */
+      Iterator(typename Tree::Iterator a_it) : m_it(a_it) {}
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the key of the current iteration
+       */
+      reference operator*() const { return m_it.GetKey(); }
+
+      /**
+       * @brief Overloading pointer operator.
+       * @return the pointer to the key of the current iteration
+       */
+      pointer operator->() const { return &m_it.GetKey(); }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the reference to the next iterator
+       */
+      Iterator& operator++() {
+        ++m_it;
+        return *this;
+      }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the next iterator
+       */
+      Iterator operator++(int) {
+        Iterator temp = *this;
+        ++m_it;
+        return temp;
+      }
+
+      /**
+       * @brief Overloading equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators are equivalent
+       */
+      friend bool operator==(const Iterator& a_first, const Iterator& a_second) {
+        return a_first.m_it == a_second.m_it;
+      }
+
+      /**
+       * @brief Overloading anti equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators aren't equivalent
+       */
+      friend bool operator!=(const Iterator& a_first, const Iterator& a_second) {
+        return a_first.m_it != a_second.m_it;
+      }
+    };
+
+    /**
+     * @brief A range of keys, which can be iterated with a range-based for loop.
+     */
+    struct Range {
+      Iterator first;
+      Iterator last;
+
+      Iterator begin() const { return first; }
+      Iterator end() const { return last; }
+    };
+
+  private:
+    Tree m_tree;
+
+  public:
+    /**
+     * @brief Constructs a new empty set.
+     *
+     * @param a_allocator the allocator of the nodes
+     */
+    explicit BTreeSet(const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Inserts a key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the set.
+     *
+     * @param a_key the key
+     * @return if the key was inserted (false if it already existed)
+     */
+    bool Insert(const KeyType& a_key);
+
+    /**
+     * @brief Removes a key, if it exists.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the set.
+     *
+     * @param a_key the key
+     * @return if the key was removed
+     */
+    bool Remove(const KeyType& a_key);
+
+    /**
+     * @brief Replaces all keys with the given ones, building the tree bottom-up.
+     *
+     * @details Runtime: O(m), where m is the size of the array.
+     *
+     * @param a_keys the strictly increasing keys
+     */
+    template <typename ArrayAllocator>
+    void Load(const Array<KeyType, ArrayAllocator>& a_keys);
+
+    /**
+     * @brief Removes all keys.
+     *
+     * @details Runtime: O(n), where n is the size of the set.
+     */
+    void Clear();
+
+    /**
+     * @brief Checks if the given key exists.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the set.
+     *
+     * @param a_key the key to check
+     * @return if the key exists
+     */
+    [[nodiscard]] bool Exists(const KeyType& a_key) const;
+
+    /**
+     * @brief Finds the given key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the set.
+     *
+     * @param a_key the key
+     * @return the iterator of the key (end if it doesn't exist)
+     */
+    Iterator Find(const KeyType& a_key) const;
+
+    /**
+     * @brief Finds the first key not less than the given one.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the set.
+     *
+     * @param a_key the key to compare with
+     * @return the iterator of the key (end if there is none)
+     */
+    Iterator LowerBound(const KeyType& a_key) const;
+
+    /**
+     * @brief Finds the first key greater than the given one.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the set.
+     *
+     * @param a_key the key to compare with
+     * @return the iterator of the key (end if there is none)
+     */
+    Iterator UpperBound(const KeyType& a_key) const;
+
+    /**
+     * @brief Gets the keys in [a_low, a_high).
+     *
+     * @details Runtime: O(log(n)), where n is the size of the set (plus O(1) per iterated key).
+     *
+     * @param a_low the lowest key of the range
+     * @param a_high the key after the range
+     * @return the range of keys
+     */
+    Range GetRange(const KeyType& a_low, const KeyType& a_high) const;
+
+    /**
+     * @brief Gets the smallest key.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the smallest key
+     */
+    const KeyType& GetMin() const;
+
+    /**
+     * @brief Gets the greatest key.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the greatest key
+     */
+    const KeyType& GetMax() const;
+
+    /**
+     * @brief Checks if the set is empty.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the set is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Gets the number of keys.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the set
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the number of levels of the tree.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the height of the tree
+     */
+    [[nodiscard]] Size GetHeight() const;
+
+    /**
+     * @brief Converts the set to a string.
+     *
+     * @details Runtime: O(n), where n is the size of the set.
+     *
+     * @return the set as a string
+     */
+    [[nodiscard]] String ToString() const;
+
+    bool operator==(const BTreeSet& a_other) const;
+    bool operator!=(const BTreeSet& a_other) const;
+
+    // ------------------------
+    // ITERATOR-RELATED METHODS
+    // ------------------------
+    Iterator begin() const;
+    Iterator end() const;
+  };
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+  template <typename KeyType, Size node_size, typename Allocator>
+  typename BTreeSet<KeyType, node_size, Allocator>::Iterator BTreeSet<KeyType, node_size, Allocator>::begin() const {
+    return m_tree.begin();
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  typename BTreeSet<KeyType, node_size, Allocator>::Iterator BTreeSet<KeyType, node_size, Allocator>::end() const {
+    return m_tree.end();
+  }
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_set the set
+   * @return the combined ostream
+   */
+  template <typename KeyType, Size node_size, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const BTreeSet<KeyType, node_size, Allocator>& a_set) {
+    return (a_stream << a_set.ToString());
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  template <typename KeyType, Size node_size, typename Allocator>
+  BTreeSet<KeyType, node_size, Allocator>::BTreeSet(const Allocator& a_allocator)
+    : m_tree(a_allocator) {
+    // Empty
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  bool BTreeSet<KeyType, node_size, Allocator>::Insert(const KeyType& a_key) {
+    return m_tree.Insert(a_key, {});
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  bool BTreeSet<KeyType, node_size, Allocator>::Remove(const KeyType& a_key) {
+    return m_tree.Remove(a_key);
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  template <typename ArrayAllocator>
+  void BTreeSet<KeyType, node_size, Allocator>::Load(const Array<KeyType, ArrayAllocator>& a_keys) {
+    for(Size i = 1; i < a_keys.GetSize(); ++i) {
+      VERIFY(a_keys[i - 1] < a_keys[i] && "the keys have to be sorted and unique")
+    }
+
+    m_tree.Clear();
+    Size next = 0;
+    m_tree.load(a_keys.GetSize(), [&](KeyType* a_key, detail::BTreeSetValue*) {
+      std::construct_at(a_key, a_keys[next++]);
+    });
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  void BTreeSet<KeyType, node_size, Allocator>::Clear() {
+    m_tree.Clear();
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  bool BTreeSet<KeyType, node_size, Allocator>::Exists(const KeyType& a_key) const {
+    return m_tree.Exists(a_key);
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  typename BTreeSet<KeyType, node_size, Allocator>::Iterator
+  BTreeSet<KeyType, node_size, Allocator>::Find(const KeyType& a_key) const {
+    return m_tree.Find(a_key);
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  typename BTreeSet<KeyType, node_size, Allocator>::Iterator
+  BTreeSet<KeyType, node_size, Allocator>::LowerBound(const KeyType& a_key) const {
+    return m_tree.LowerBound(a_key);
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  typename BTreeSet<KeyType, node_size, Allocator>::Iterator
+  BTreeSet<KeyType, node_size, Allocator>::UpperBound(const KeyType& a_key) const {
+    return m_tree.UpperBound(a_key);
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  typename BTreeSet<KeyType, node_size, Allocator>::Range
+  BTreeSet<KeyType, node_size, Allocator>::GetRange(const KeyType& a_low, const KeyType& a_high) const {
+    const auto range = m_tree.GetRange(a_low, a_high);
+    return {range.first, range.last};
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  const KeyType& BTreeSet<KeyType, node_size, Allocator>::GetMin() const {
+    return m_tree.GetMin();
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  const KeyType& BTreeSet<KeyType, node_size, Allocator>::GetMax() const {
+    return m_tree.GetMax();
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  bool BTreeSet<KeyType, node_size, Allocator>::IsEmpty() const {
+    return m_tree.IsEmpty();
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  Size BTreeSet<KeyType, node_size, Allocator>::GetSize() const {
+    return m_tree.GetSize();
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  Size BTreeSet<KeyType, node_size, Allocator>::GetHeight() const {
+    return m_tree.GetHeight();
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  String BTreeSet<KeyType, node_size, Allocator>::ToString() const {
+    Size estimate = 10;
+    for(const KeyType& key : *this)
+      estimate += StringBuilder::Measure(key) + 2;
+
+    StringBuilder builder{estimate};
+    builder.Append("BTreeSet(");
+
+    for(Iterator it = begin(); it != end(); ++it) {
+      if(it != begin())
+        builder.Append(", ");
+      builder.Append(*it);
+    }
+
+    builder.Append(")");
+    return builder.Build();
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  bool BTreeSet<KeyType, node_size, Allocator>::operator==(const BTreeSet& a_other) const {
+    return m_tree == a_other.m_tree;
+  }
+
+  template <typename KeyType, Size node_size, typename Allocator>
+  bool BTreeSet<KeyType, node_size, Allocator>::operator!=(const BTreeSet& a_other) const {
+    return m_tree != a_other.m_tree;
+  }
+}
+
+#endif // NTL_BTREE_SET_HPP
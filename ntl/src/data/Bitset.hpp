@@ -8,21 +8,46 @@
 #ifndef NTL_BITSET_HPP
 #define NTL_BITSET_HPP
 
+#include <cstring>
+
 #include "core/Assert.hpp"
 #include "data/Byte.hpp"
+#include "data/Integer.hpp"
 #include "data/String.hpp"
 #include "data/Size.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Bits.hpp"
 
 namespace ntl {
+  /**
+   * @brief Represents the storage layouts a bitset can use.
+   */
+  enum class BitsetStorage {
+    BYTE = 0,   // one '0'/'1' character per bit
+    PACKED = 1  // 64 bits per word, supports SIMD bulk operations
+  };
+
+  template<Size capacity = 1024, BitsetStorage storage = BitsetStorage::BYTE, typename Allocator = DefaultAllocator>
+  class Bitset;
+
+  /**
+   * @brief Shorthand for a bitset using the word-packed storage layout.
+   */
+  template<Size capacity = 1024, typename Allocator = DefaultAllocator>
+  using PackedBitset = Bitset<capacity, BitsetStorage::PACKED, Allocator>;
+
   /**
    * @brief Constructs a new bitset object.
+   *
+   * @note Stores every bit as a '0'/'1' character.
    */
-  template<Size capacity = 1024>
-  class Bitset {
+  template<Size capacity, typename Allocator>
+  class Bitset<capacity, BitsetStorage::BYTE, Allocator> {
   private:
     Byte* m_bits;
     Size m_capacity,
         m_size;
+    [[no_unique_address]] Allocator m_allocator;
 
   public:
     /**
@@ -32,6 +57,15 @@ namespace ntl {
      */
     Bitset();
 
+    /**
+     * @brief Constructs a new bitset allocating its bits from the given allocator.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_allocator the allocator of the bits
+     */
+    explicit Bitset(const Allocator& a_allocator);
+
     /**
      * @brief Destructs the bitset.
      *
@@ -267,8 +301,8 @@ namespace ntl {
    * @param a_bitset the bitset
    * @return the combined ostream
    */
-  template<Size size>
-  std::ostream& operator<<(std::ostream& a_stream, const Bitset<size>& a_bitset) {
+  template<Size size, BitsetStorage storage, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const Bitset<size, storage, Allocator>& a_bitset) {
     return (a_stream << a_bitset.ToString());
   }
 
@@ -277,44 +311,54 @@ namespace ntl {
    *                                                  PUBLIC METHODS                                                   *
    ********************************************************************************************************************/
 
-  template<Size size>
-  Bitset<size>::Bitset()
-    : m_capacity{size + 1}, m_size{size} {
-    m_bits = new Byte[m_capacity];
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::BYTE, Allocator>::Bitset()
+    : Bitset(Allocator{}) {
+    // Empty
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::BYTE, Allocator>::Bitset(const Allocator& a_allocator)
+    : m_capacity{size + 1}, m_size{size}, m_allocator{a_allocator} {
+    m_bits = memory::Allocate<Byte>(m_allocator, m_capacity);
     Reset();
   }
 
-  template<Size size>
-  Bitset<size>::~Bitset() {
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::BYTE, Allocator>::~Bitset() {
     if (m_bits) {
-      delete[] m_bits;
+      memory::Deallocate(m_allocator, m_bits, m_capacity);
       m_bits = nullptr;
     }
   }
 
-  template<Size size>
-  Bitset<size>::Bitset(const Bitset& a_other)
-    : m_capacity{a_other.m_capacity}, m_size{a_other.m_size} {
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::BYTE, Allocator>::Bitset(const Bitset& a_other)
+    : m_bits{nullptr}, m_capacity{a_other.m_capacity}, m_size{a_other.m_size}, m_allocator{a_other.m_allocator} {
     if (m_capacity > 0) {
-      m_bits = new Byte[m_capacity];
+      m_bits = memory::Allocate<Byte>(m_allocator, m_capacity);
       memcpy(m_bits, a_other.m_bits, m_capacity);
     }
   }
 
-  template<Size size>
-  Bitset<size>& Bitset<size>::operator=(const Bitset& a_right) {
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::BYTE, Allocator>& Bitset<size, BitsetStorage::BYTE, Allocator>::operator=(const Bitset& a_right) {
     VERIFY(this != &a_right)
 
+    memory::Deallocate(m_allocator, m_bits, m_capacity);
+
     m_size = a_right.m_size;
     m_capacity = a_right.m_capacity;
-    m_bits = new Byte[m_capacity];
+    m_allocator = a_right.m_allocator;
+    m_bits = memory::Allocate<Byte>(m_allocator, m_capacity);
     memcpy(m_bits, a_right.m_bits, m_capacity);
 
     return *this;
   }
 
-  template<Size size>
-  Bitset<size>::Bitset(Bitset&& a_other) noexcept {
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::BYTE, Allocator>::Bitset(Bitset&& a_other) noexcept
+    : m_allocator{a_other.m_allocator} {
     VERIFY(this != &a_other)
 
     m_size = a_other.m_size;
@@ -326,12 +370,15 @@ namespace ntl {
     a_other.m_bits = nullptr;
   }
 
-  template<Size size>
-  Bitset<size>& Bitset<size>::operator=(Bitset&& a_right) noexcept {
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::BYTE, Allocator>& Bitset<size, BitsetStorage::BYTE, Allocator>::operator=(Bitset&& a_right) noexcept {
     VERIFY(this != &a_right)
 
+    memory::Deallocate(m_allocator, m_bits, m_capacity);
+
     m_size = a_right.m_size;
     m_capacity = a_right.m_capacity;
+    m_allocator = a_right.m_allocator;
     m_bits = a_right.m_bits;
 
     a_right.m_size = 0;
@@ -341,53 +388,53 @@ namespace ntl {
     return *this;
   }
 
-  template<Size size>
-  void Bitset<size>::Set(const Size a_index) {
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::BYTE, Allocator>::Set(const Size a_index) {
     m_bits[a_index] = '1';
   }
 
-  template<Size size>
-  void Bitset<size>::Reset(const Size a_index) {
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::BYTE, Allocator>::Reset(const Size a_index) {
     m_bits[a_index] = '0';
   }
 
-  template<Size size>
-  void Bitset<size>::Reset() {
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::BYTE, Allocator>::Reset() {
     memset(m_bits, '0', m_size);
   }
 
-  template<Size size>
-  void Bitset<size>::Flip(const Size a_index) {
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::BYTE, Allocator>::Flip(const Size a_index) {
     m_bits[a_index] = (m_bits[a_index] == '0') ? '1' : '0';
   }
 
-  template<Size size>
-  Byte& Bitset<size>::Get(const Size a_index) {
+  template<Size size, typename Allocator>
+  Byte& Bitset<size, BitsetStorage::BYTE, Allocator>::Get(const Size a_index) {
     return m_bits[a_index];
   }
 
-  template<Size size>
-  const Byte& Bitset<size>::Get(const Size a_index) const {
+  template<Size size, typename Allocator>
+  const Byte& Bitset<size, BitsetStorage::BYTE, Allocator>::Get(const Size a_index) const {
     return m_bits[a_index];
   }
 
-  template<Size size>
-  Size Bitset<size>::GetSize() const {
+  template<Size size, typename Allocator>
+  Size Bitset<size, BitsetStorage::BYTE, Allocator>::GetSize() const {
     return m_size;
   }
 
-  template<Size size>
-  Size Bitset<size>::GetCapacity() const {
+  template<Size size, typename Allocator>
+  Size Bitset<size, BitsetStorage::BYTE, Allocator>::GetCapacity() const {
     return m_capacity;
   }
 
-  template<Size size>
-  bool Bitset<size>::IsSet(const Size a_index) const {
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::BYTE, Allocator>::IsSet(const Size a_index) const {
     return (m_bits[a_index] == '1');
   }
 
-  template<Size size>
-  Size Bitset<size>::GetCount() const {
+  template<Size size, typename Allocator>
+  Size Bitset<size, BitsetStorage::BYTE, Allocator>::GetCount() const {
     Size result = 0;
     for (Size i = 0; i < m_size; ++i) {
       if (m_bits[i] == '1')
@@ -396,8 +443,8 @@ namespace ntl {
     return result;
   }
 
-  template<Size size>
-  bool Bitset<size>::IsNone() const {
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::BYTE, Allocator>::IsNone() const {
     for (Size i = 0; i < m_size; ++i) {
       if (m_bits[i] == '1')
         return false;
@@ -405,8 +452,8 @@ namespace ntl {
     return true;
   }
 
-  template<Size size>
-  bool Bitset<size>::IsAny() const {
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::BYTE, Allocator>::IsAny() const {
     for (Size i = 0; i < m_size; ++i) {
       if (m_bits[i] == '1')
         return true;
@@ -414,8 +461,8 @@ namespace ntl {
     return false;
   }
 
-  template<Size size>
-  bool Bitset<size>::IsEqual(const Bitset& a_other) const {
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::BYTE, Allocator>::IsEqual(const Bitset& a_other) const {
     if (m_size != a_other.m_size)
       return false;
 
@@ -431,18 +478,18 @@ namespace ntl {
     return result;
   }
 
-  template<Size size>
-  Byte& Bitset<size>::operator[](const Size a_index) {
+  template<Size size, typename Allocator>
+  Byte& Bitset<size, BitsetStorage::BYTE, Allocator>::operator[](const Size a_index) {
     return Get(a_index);
   }
 
-  template<Size size>
-  const Byte& Bitset<size>::operator[](const Size a_index) const {
+  template<Size size, typename Allocator>
+  const Byte& Bitset<size, BitsetStorage::BYTE, Allocator>::operator[](const Size a_index) const {
     return Get(a_index);
   }
 
-  template<Size size>
-  Bitset<size> Bitset<size>::operator&(const Bitset& a_other) const {
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::BYTE, Allocator> Bitset<size, BitsetStorage::BYTE, Allocator>::operator&(const Bitset& a_other) const {
     VERIFY(m_size == a_other.m_size && "Both Bitsets must have the same size")
 
     Bitset result;
@@ -453,18 +500,18 @@ namespace ntl {
     return result;
   }
 
-  template<Size size>
-  bool Bitset<size>::operator==(const Bitset& a_other) const {
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::BYTE, Allocator>::operator==(const Bitset& a_other) const {
     return IsEqual(a_other);
   }
 
-  template<Size size>
-  bool Bitset<size>::operator!=(const Bitset& a_other) const {
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::BYTE, Allocator>::operator!=(const Bitset& a_other) const {
     return (!IsEqual(a_other));
   }
 
-  template<Size size>
-  String Bitset<size>::ToString() const {
+  template<Size size, typename Allocator>
+  String Bitset<size, BitsetStorage::BYTE, Allocator>::ToString() const {
     String result = "Bitset(";
 
     for (Size i = 0; i < m_size; ++i) {
@@ -475,6 +522,782 @@ namespace ntl {
 
     return result;
   }
+
+  /**
+   * @brief Constructs a new word-packed bitset object.
+   *
+   * @note Stores 64 bits per word. Bulk operations, counting and searching use
+   * the AVX2/NEON kernels from utils/Bits.hpp when available. Bitsets of at least a cache line
+   * start at a cache line, so every aligned block of NTL_CACHE_LINE_SIZE bytes lies in a single line.
+   */
+  template<Size capacity, typename Allocator>
+  class Bitset<capacity, BitsetStorage::PACKED, Allocator> {
+  public:
+    /**
+     * @brief Iterator class to simplify iteration over the set bits of the bitset.
+     */
+    class Iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = Size;
+      using pointer = const Size*;
+      using reference = const Size&;
+
+    private:
+      const U64* m_words;
+      I64 m_index;
+
+    public:
+      /**
+       * @brief Constructs a new iterator
+       * @param a_words the words of the bitset
+       * @param a_index the index of the current set bit (-1 for the end)
+       */
+      Iterator(const U64* a_words, I64 a_index) : m_words(a_words), m_index(a_index) {}
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the index of the current set bit
+       */
+      Size operator*() const { return static_cast<Size>(m_index); }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the reference to the next iterator
+       */
+      Iterator& operator++() {
+        m_index = bits::FindFirstSet(m_words, WORD_COUNT, static_cast<Size>(m_index) + 1);
+        return *this;
+      }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the next iterator
+       */
+      const Iterator operator++(int) {
+        Iterator temp = *this;
+        ++(*this);
+        return temp;
+      }
+
+      /**
+       * @brief Overloading equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators are equivalent
+       */
+      friend bool operator==(const Iterator& a_first, const Iterator& a_second) {
+        return a_first.m_index == a_second.m_index;
+      }
+
+      /**
+       * @brief Overloading anti equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators aren't equivalent
+       */
+      friend bool operator!=(const Iterator& a_first, const Iterator& a_second) {
+        return a_first.m_index != a_second.m_index;
+      }
+    };
+
+    /**
+     * @brief The number of words used to store the bits.
+     */
+    static constexpr Size WORD_COUNT = bits::WordCount(capacity);
+
+    /**
+     * @brief The alignment of the words.
+     */
+    static constexpr Size WORD_ALIGNMENT = WORD_COUNT * sizeof(U64) >= NTL_CACHE_LINE_SIZE ? NTL_CACHE_LINE_SIZE : alignof(U64);
+
+  private:
+    U64* m_words;
+    Size m_size;
+    [[no_unique_address]] Allocator m_allocator;
+
+  public:
+    /**
+     * @brief Constructs a new bitset with all bits reset.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     */
+    Bitset();
+
+    /**
+     * @brief Constructs a new bitset with all bits reset, allocating its words from the given allocator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_allocator the allocator of the words
+     */
+    explicit Bitset(const Allocator& a_allocator);
+
+    /**
+     * @brief Destructs the bitset.
+     *
+     * @details Runtime: O(1)
+     */
+    ~Bitset();
+
+    /**
+     * @brief Copy constructor for bitset.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the bitset to be copied
+     */
+    Bitset(const Bitset& a_other);
+
+    /**
+     * @brief Copy assignment operator for bitset.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_right the other bitset whose contents are to be assigned
+     * @return a reference to the modified bitset
+     */
+    Bitset& operator=(const Bitset& a_right);
+
+    /**
+     * @brief Move constructor for bitset.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other bitset whose contents are to be moved
+     */
+    Bitset(Bitset&& a_other) noexcept;
+
+    /**
+     * @brief Move assignment operator for bitset.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_right the other bitset whose contents are to be moved
+     * @return a reference to the modified bitset
+     */
+    Bitset& operator=(Bitset&& a_right) noexcept;
+
+    /**
+     * @brief Sets the bit at a given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the bit to set
+     */
+    void Set(Size a_index);
+
+    /**
+     * @brief Sets all bits in the set.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     */
+    void Set();
+
+    /**
+     * @brief Resets the bit at a given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the bit to reset
+     */
+    void Reset(Size a_index);
+
+    /**
+     * @brief Resets all bits in the set.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     */
+    void Reset();
+
+    /**
+     * @brief Flips the bit at a given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the bit to flip
+     */
+    void Flip(Size a_index);
+
+    /**
+     * @brief Flips all bits in the set.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     */
+    void Flip();
+
+    /**
+     * @brief Gets the bit at a given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the bit to get
+     * @return the bit as the character '0' or '1'
+     *
+     * @note Returns a copy to stay comparable with the byte storage layout.
+     */
+    [[nodiscard]] Byte Get(Size a_index) const;
+
+    /**
+     * @brief Gets the size of the bitset.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the bitset
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the capacity of the bitset.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the number of bits that fit into the allocated words
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Gets the bit count of the bitset.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @return the counted bits
+     */
+    [[nodiscard]] Size GetCount() const;
+
+    /**
+     * @brief Gets the words storing the bits.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the pointer to the first word
+     */
+    [[nodiscard]] const U64* GetWords() const;
+
+    /**
+     * @brief Gets the words storing the bits.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the pointer to the first word
+     *
+     * @note Bits beyond the size of the bitset must stay reset.
+     */
+    U64* GetWords();
+
+    /**
+     * @brief Gets if the bit at a given index is set.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index to check if set
+     * @return if the bit is set
+     */
+    [[nodiscard]] bool IsSet(Size a_index) const;
+
+    /**
+     * @brief Gets if the bit at a given index is set, without checking the index even if NTL_CHECKS is enabled.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index to check if set, which must be less than the size
+     * @return if the bit is set
+     */
+    [[nodiscard]] bool IsSetUnchecked(Size a_index) const;
+
+    /**
+     * @brief Gets if no bits are set in the bitset.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @return if no bits are set
+     */
+    [[nodiscard]] bool IsNone() const;
+
+    /**
+     * @brief Gets if any bit is set in the bitset.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @return if any bit is set
+     */
+    [[nodiscard]] bool IsAny() const;
+
+    /**
+     * @brief Gets if all bits are set in the bitset.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @return if all bits are set
+     */
+    [[nodiscard]] bool IsAll() const;
+
+    /**
+     * @brief Finds the first set bit.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @return the index of the first set bit (-1 if not found)
+     */
+    [[nodiscard]] I64 FindFirst() const;
+
+    /**
+     * @brief Finds the next set bit after a given index.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_index the index to search after
+     * @return the index of the next set bit (-1 if not found)
+     */
+    [[nodiscard]] I64 FindNext(Size a_index) const;
+
+    /**
+     * @brief Checks if the bitset is equal to another bitset.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the other bitset to compare with
+     * @return if the bitsets are equal
+     */
+    [[nodiscard]] bool IsEqual(const Bitset& a_other) const;
+
+    /**
+     * @brief Gets the bit at a given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the bit to get
+     * @return if the bit is set
+     */
+    bool operator[](Size a_index) const;
+
+    /**
+     * @brief Overloading bitwise and operator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the other bitset
+     * @return the resulting bitset
+     */
+    Bitset operator&(const Bitset& a_other) const;
+
+    /**
+     * @brief Overloading bitwise or operator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the other bitset
+     * @return the resulting bitset
+     */
+    Bitset operator|(const Bitset& a_other) const;
+
+    /**
+     * @brief Overloading bitwise xor operator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the other bitset
+     * @return the resulting bitset
+     */
+    Bitset operator^(const Bitset& a_other) const;
+
+    /**
+     * @brief Overloading bitwise not operator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @return the resulting bitset
+     */
+    Bitset operator~() const;
+
+    /**
+     * @brief Overloading bitwise and assignment operator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the other bitset
+     * @return the reference to the current bitset
+     */
+    Bitset& operator&=(const Bitset& a_other);
+
+    /**
+     * @brief Overloading bitwise or assignment operator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the other bitset
+     * @return the reference to the current bitset
+     */
+    Bitset& operator|=(const Bitset& a_other);
+
+    /**
+     * @brief Overloading bitwise xor assignment operator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the other bitset
+     * @return the reference to the current bitset
+     */
+    Bitset& operator^=(const Bitset& a_other);
+
+    /**
+     * @brief Overloading equivalence operator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the bitset to compare with
+     * @return if both bitsets are equivalent
+     */
+    bool operator==(const Bitset& a_other) const;
+
+    /**
+     * @brief Overloading anti equivalence operator.
+     *
+     * @details Runtime: O(n), where n is the number of words
+     *
+     * @param a_other the bitset to compare with
+     * @return if both bitsets aren't equivalent
+     */
+    bool operator!=(const Bitset& a_other) const;
+
+    /**
+     * @brief Converts the current bitset to a string.
+     *
+     * @details Runtime: O(n), where n is the size of the bitset
+     *
+     * @return the bitset as a string, using the same format as the byte storage layout
+     */
+    [[nodiscard]] String ToString() const;
+
+    /**
+     * @brief Gets the beginning of the iterator over the set bits.
+     * @return the iterator at the first set bit
+     */
+    Iterator begin() const;
+
+    /**
+     * @brief Gets the end of the iterator over the set bits.
+     * @return the iterator at the end
+     */
+    Iterator end() const;
+
+  private:
+    /**
+     * @brief Clears the bits of the last word that are beyond the size of the bitset.
+     *
+     * @details Runtime: O(1)
+     */
+    void clearTail();
+
+    /**
+     * @brief Allocates the uninitialized words with the alignment of WORD_ALIGNMENT.
+     *
+     * @return the words
+     */
+    U64* allocateWords();
+
+    /**
+     * @brief Frees the words, if there are any.
+     */
+    void deallocateWords();
+  };
+
+  /*********************************************************************************************************************
+   *                                                  PACKED BITSET                                                    *
+   *                                                  PUBLIC METHODS                                                   *
+   ********************************************************************************************************************/
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>::Bitset()
+    : Bitset(Allocator{}) {
+    // Empty
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>::Bitset(const Allocator& a_allocator)
+    : m_size{size}, m_allocator{a_allocator} {
+    m_words = allocateWords();
+    Reset();
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>::~Bitset() {
+    deallocateWords();
+    m_words = nullptr;
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>::Bitset(const Bitset& a_other)
+    : m_size{a_other.m_size}, m_allocator{a_other.m_allocator} {
+    m_words = allocateWords();
+    memcpy(m_words, a_other.m_words, WORD_COUNT * sizeof(U64));
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>& Bitset<size, BitsetStorage::PACKED, Allocator>::operator=(const Bitset& a_right) {
+    if(this == &a_right)
+      return *this;
+
+    if(!m_words)
+      m_words = allocateWords();
+
+    m_size = a_right.m_size;
+    memcpy(m_words, a_right.m_words, WORD_COUNT * sizeof(U64));
+
+    return *this;
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>::Bitset(Bitset&& a_other) noexcept
+    : m_words{a_other.m_words}, m_size{a_other.m_size}, m_allocator{a_other.m_allocator} {
+    a_other.m_words = nullptr;
+    a_other.m_size = 0;
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>& Bitset<size, BitsetStorage::PACKED, Allocator>::operator=(Bitset&& a_right) noexcept {
+    if(this == &a_right)
+      return *this;
+
+    deallocateWords();
+
+    m_words = a_right.m_words;
+    m_size = a_right.m_size;
+    m_allocator = a_right.m_allocator;
+
+    a_right.m_words = nullptr;
+    a_right.m_size = 0;
+
+    return *this;
+  }
+
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::PACKED, Allocator>::Set(const Size a_index) {
+    ASSUME(a_index < m_size)
+    m_words[a_index / bits::WORD_BITS] |= (U64{1} << (a_index % bits::WORD_BITS));
+  }
+
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::PACKED, Allocator>::Set() {
+    memset(m_words, 0xff, WORD_COUNT * sizeof(U64));
+    clearTail();
+  }
+
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::PACKED, Allocator>::Reset(const Size a_index) {
+    ASSUME(a_index < m_size)
+    m_words[a_index / bits::WORD_BITS] &= ~(U64{1} << (a_index % bits::WORD_BITS));
+  }
+
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::PACKED, Allocator>::Reset() {
+    memset(m_words, 0, WORD_COUNT * sizeof(U64));
+  }
+
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::PACKED, Allocator>::Flip(const Size a_index) {
+    ASSUME(a_index < m_size)
+    m_words[a_index / bits::WORD_BITS] ^= (U64{1} << (a_index % bits::WORD_BITS));
+  }
+
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::PACKED, Allocator>::Flip() {
+    bits::Not(m_words, m_words, WORD_COUNT);
+    clearTail();
+  }
+
+  template<Size size, typename Allocator>
+  Byte Bitset<size, BitsetStorage::PACKED, Allocator>::Get(const Size a_index) const {
+    return IsSet(a_index) ? '1' : '0';
+  }
+
+  template<Size size, typename Allocator>
+  Size Bitset<size, BitsetStorage::PACKED, Allocator>::GetSize() const {
+    return m_size;
+  }
+
+  template<Size size, typename Allocator>
+  Size Bitset<size, BitsetStorage::PACKED, Allocator>::GetCapacity() const {
+    return WORD_COUNT * bits::WORD_BITS;
+  }
+
+  template<Size size, typename Allocator>
+  Size Bitset<size, BitsetStorage::PACKED, Allocator>::GetCount() const {
+    return bits::PopCount(m_words, WORD_COUNT);
+  }
+
+  template<Size size, typename Allocator>
+  const U64* Bitset<size, BitsetStorage::PACKED, Allocator>::GetWords() const {
+    return m_words;
+  }
+
+  template<Size size, typename Allocator>
+  U64* Bitset<size, BitsetStorage::PACKED, Allocator>::GetWords() {
+    return m_words;
+  }
+
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::PACKED, Allocator>::IsSet(const Size a_index) const {
+    ASSUME(a_index < m_size)
+    return IsSetUnchecked(a_index);
+  }
+
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::PACKED, Allocator>::IsSetUnchecked(const Size a_index) const {
+    return (m_words[a_index / bits::WORD_BITS] >> (a_index % bits::WORD_BITS)) & 1;
+  }
+
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::PACKED, Allocator>::IsNone() const {
+    return !bits::Any(m_words, WORD_COUNT);
+  }
+
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::PACKED, Allocator>::IsAny() const {
+    return bits::Any(m_words, WORD_COUNT);
+  }
+
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::PACKED, Allocator>::IsAll() const {
+    return GetCount() == m_size;
+  }
+
+  template<Size size, typename Allocator>
+  I64 Bitset<size, BitsetStorage::PACKED, Allocator>::FindFirst() const {
+    return bits::FindFirstSet(m_words, WORD_COUNT);
+  }
+
+  template<Size size, typename Allocator>
+  I64 Bitset<size, BitsetStorage::PACKED, Allocator>::FindNext(const Size a_index) const {
+    return bits::FindFirstSet(m_words, WORD_COUNT, a_index + 1);
+  }
+
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::PACKED, Allocator>::IsEqual(const Bitset& a_other) const {
+    if(m_size != a_other.m_size)
+      return false;
+
+    return bits::Equal(m_words, a_other.m_words, WORD_COUNT);
+  }
+
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::PACKED, Allocator>::operator[](const Size a_index) const {
+    return IsSet(a_index);
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator> Bitset<size, BitsetStorage::PACKED, Allocator>::operator&(const Bitset& a_other) const {
+    VERIFY(m_size == a_other.m_size && "Both Bitsets must have the same size")
+
+    Bitset result;
+    bits::And(result.m_words, m_words, a_other.m_words, WORD_COUNT);
+    return result;
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator> Bitset<size, BitsetStorage::PACKED, Allocator>::operator|(const Bitset& a_other) const {
+    VERIFY(m_size == a_other.m_size && "Both Bitsets must have the same size")
+
+    Bitset result;
+    bits::Or(result.m_words, m_words, a_other.m_words, WORD_COUNT);
+    return result;
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator> Bitset<size, BitsetStorage::PACKED, Allocator>::operator^(const Bitset& a_other) const {
+    VERIFY(m_size == a_other.m_size && "Both Bitsets must have the same size")
+
+    Bitset result;
+    bits::Xor(result.m_words, m_words, a_other.m_words, WORD_COUNT);
+    return result;
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator> Bitset<size, BitsetStorage::PACKED, Allocator>::operator~() const {
+    Bitset result;
+    bits::Not(result.m_words, m_words, WORD_COUNT);
+    result.clearTail();
+    return result;
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>& Bitset<size, BitsetStorage::PACKED, Allocator>::operator&=(const Bitset& a_other) {
+    VERIFY(m_size == a_other.m_size && "Both Bitsets must have the same size")
+    bits::And(m_words, m_words, a_other.m_words, WORD_COUNT);
+    return *this;
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>& Bitset<size, BitsetStorage::PACKED, Allocator>::operator|=(const Bitset& a_other) {
+    VERIFY(m_size == a_other.m_size && "Both Bitsets must have the same size")
+    bits::Or(m_words, m_words, a_other.m_words, WORD_COUNT);
+    return *this;
+  }
+
+  template<Size size, typename Allocator>
+  Bitset<size, BitsetStorage::PACKED, Allocator>& Bitset<size, BitsetStorage::PACKED, Allocator>::operator^=(const Bitset& a_other) {
+    VERIFY(m_size == a_other.m_size && "Both Bitsets must have the same size")
+    bits::Xor(m_words, m_words, a_other.m_words, WORD_COUNT);
+    return *this;
+  }
+
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::PACKED, Allocator>::operator==(const Bitset& a_other) const {
+    return IsEqual(a_other);
+  }
+
+  template<Size size, typename Allocator>
+  bool Bitset<size, BitsetStorage::PACKED, Allocator>::operator!=(const Bitset& a_other) const {
+    return (!IsEqual(a_other));
+  }
+
+  template<Size size, typename Allocator>
+  String Bitset<size, BitsetStorage::PACKED, Allocator>::ToString() const {
+    String result = "Bitset(";
+
+    for (Size i = 0; i < m_size; ++i)
+      result += IsSet(i) ? '1' : '0';
+
+    result += ")\n";
+
+    return result;
+  }
+
+  template<Size size, typename Allocator>
+  typename Bitset<size, BitsetStorage::PACKED, Allocator>::Iterator Bitset<size, BitsetStorage::PACKED, Allocator>::begin() const {
+    return Iterator(m_words, FindFirst());
+  }
+
+  template<Size size, typename Allocator>
+  typename Bitset<size, BitsetStorage::PACKED, Allocator>::Iterator Bitset<size, BitsetStorage::PACKED, Allocator>::end() const {
+    return Iterator(m_words, -1);
+  }
+
+  /*********************************************************************************************************************
+   *                                                  PACKED BITSET                                                    *
+   *                                                 PRIVATE METHODS                                                   *
+   ********************************************************************************************************************/
+
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::PACKED, Allocator>::clearTail() {
+    if constexpr (WORD_COUNT > 0)
+      m_words[WORD_COUNT - 1] &= bits::TailMask(size);
+  }
+
+  template<Size size, typename Allocator>
+  U64* Bitset<size, BitsetStorage::PACKED, Allocator>::allocateWords() {
+    if constexpr (WORD_COUNT == 0)
+      return nullptr;
+    else
+      return static_cast<U64*>(m_allocator.Allocate(WORD_COUNT * sizeof(U64), WORD_ALIGNMENT));
+  }
+
+  template<Size size, typename Allocator>
+  void Bitset<size, BitsetStorage::PACKED, Allocator>::deallocateWords() {
+    if (m_words)
+      m_allocator.Deallocate(m_words, WORD_COUNT * sizeof(U64), WORD_ALIGNMENT);
+  }
 }
 
 #endif // NTL_BITSET_HPP
@@ -0,0 +1,587 @@
+/**
+* @file BloomFilter.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_BLOOM_FILTER_HPP
+#define NTL_BLOOM_FILTER_HPP
+
+#include <bit>
+#include <cmath>
+#include <iostream>
+#include <type_traits>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "data/Bitset.hpp"
+#include "data/Float.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Hash.hpp"
+
+namespace ntl {
+  /**
+   * @brief Calculates the number of hashes giving the lowest false positive rate.
+   *
+   * @details The rate is lowest at bits / keys * ln(2) hashes, e.g. 7 hashes for 10 bits per key (about 1%).
+   *
+   * @param a_bits the number of bits of the filter
+   * @param a_keys the expected number of keys
+   * @return the number of hashes (at least 1)
+   */
+  constexpr Size BloomHashCount(const Size a_bits, const Size a_keys) {
+    const Size count = (a_bits * 693 + a_keys * 500) / (a_keys * 1000);
+    return count > 0 ? count : 1;
+  }
+
+  /**
+   * @brief Constructs a new bloom filter object.
+   *
+   * @details A bloom filter answers if a key may have been inserted using a fixed number of bits: every key
+   * sets hash_count bits, derived from a single hash by double hashing, and a key whose bits aren't all set was
+   * never inserted. Keys that were inserted are always reported, others only with the false positive rate.
+   *
+   * A negative lookup stops at the first bit that isn't set, so at most half of the bits being set it reads
+   * 2 bits and causes up to 2 cache misses on average. The BlockedBloomFilter needs a single one.
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam bits the number of bits of the filter
+   * @tparam hash_count the number of bits set per key (see BloomHashCount)
+   * @tparam HasherType the hasher used to hash the keys (see hash::Hasher)
+   * @tparam Allocator the allocator of the bits (see is_allocator)
+   *
+   * @note The filter isn't thread-safe.
+   */
+  template <typename KeyType, Size bits = 1 << 16, Size hash_count = 7, typename HasherType = hash::Hasher<KeyType>,
+            typename Allocator = DefaultAllocator>
+  class BloomFilter {
+    CVERIFY(bits > 0 && hash_count > 0 && "A bloom filter needs bits and hashes");
+
+  private:
+    PackedBitset<bits, Allocator> m_bits;
+    Size m_size;
+    algorithms::Hash m_algorithm;
+    [[no_unique_address]] HasherType m_hasher;
+
+  public:
+    /**
+     * @brief Constructs a new empty filter.
+     *
+     * @details Runtime: O(n), where n is the number of bits
+     *
+     * @param a_algorithm the hashing algorithm to use
+     * @param a_allocator the allocator of the bits
+     */
+    explicit BloomFilter(algorithms::Hash a_algorithm = algorithms::Hash::WyHash, const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Inserts a key.
+     *
+     * @details Runtime: O(k), where k is the number of hashes
+     *
+     * @param a_key the key to insert
+     */
+    void Insert(const KeyType& a_key);
+
+    /**
+     * @brief Inserts a key equal to the given lookup key, without converting it to the key type.
+     *
+     * @details Runtime: O(k), where k is the number of hashes
+     *
+     * @param a_key the lookup key (see hash::TransparentKey)
+     */
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    void Insert(const LookupType& a_key);
+
+    /**
+     * @brief Checks if the given key may have been inserted.
+     *
+     * @details Runtime: O(k), where k is the number of hashes
+     *
+     * @param a_key the key to check
+     * @return false if the key was never inserted, true if it was or by the false positive rate
+     */
+    [[nodiscard]] bool MayContain(const KeyType& a_key) const;
+
+    /**
+     * @brief Checks if a key equal to the given lookup key may have been inserted.
+     *
+     * @details Runtime: O(k), where k is the number of hashes
+     *
+     * @param a_key the lookup key (see hash::TransparentKey)
+     * @return false if the key was never inserted, true if it was or by the false positive rate
+     */
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    [[nodiscard]] bool MayContain(const LookupType& a_key) const;
+
+    /**
+     * @brief Adds the keys of another filter, as if they were inserted into this one.
+     *
+     * @details Runtime: O(n), where n is the number of bits
+     *
+     * @param a_other the filter using the same algorithm
+     */
+    void Merge(const BloomFilter& a_other);
+
+    /**
+     * @brief Removes all keys.
+     *
+     * @details Runtime: O(n), where n is the number of bits
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of insertions (keys inserted twice count twice).
+     *
+     * @return the number of insertions
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the bits of the filter.
+     *
+     * @return the bits
+     */
+    [[nodiscard]] const PackedBitset<bits, Allocator>& GetBits() const;
+
+    /**
+     * @brief Estimates the false positive rate from the share of set bits.
+     *
+     * @details Runtime: O(n), where n is the number of bits
+     *
+     * @return the probability that a key which was never inserted is reported
+     */
+    [[nodiscard]] Float GetFalsePositiveRate() const;
+
+    /**
+     * @brief Gets the hashing algorithm used by the hasher.
+     *
+     * @return the algorithm
+     */
+    [[nodiscard]] algorithms::Hash GetAlgorithm() const;
+
+    /**
+     * @brief Converts the filter to a string.
+     *
+     * @return the filter as string
+     */
+    [[nodiscard]] String ToString() const;
+
+  private:
+    template <typename LookupType>
+    U64 hashKey(const LookupType& a_key) const;
+    void insert(U64 a_hash);
+    [[nodiscard]] bool mayContain(U64 a_hash) const;
+  };
+
+  /**
+   * @brief Constructs a new blocked bloom filter object.
+   *
+   * @details In contrast to the BloomFilter, all bits of a key lie in a single block of 64 bytes, which the bitset
+   * aligns to a cache line: a key sets one bit in each of the 8 words of its block (a split block bloom filter),
+   * so every lookup reads exactly one cache line and tests its words without branches. The price is a slightly
+   * higher false positive rate for the same number of bits, as the keys aren't spread evenly over the blocks.
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam bits the number of bits of the filter, a multiple of BLOCK_BITS
+   * @tparam HasherType the hasher used to hash the keys (see hash::Hasher)
+   * @tparam Allocator the allocator of the bits (see is_allocator)
+   *
+   * @note The filter isn't thread-safe.
+   */
+  template <typename KeyType, Size bits = 1 << 16, typename HasherType = hash::Hasher<KeyType>,
+            typename Allocator = DefaultAllocator>
+  class BlockedBloomFilter {
+  public:
+    /**
+     * @brief The number of words of a block, which is also the number of bits set per key.
+     */
+    static constexpr Size BLOCK_WORDS = 8;
+
+    /**
+     * @brief The number of bits of a block.
+     */
+    static constexpr Size BLOCK_BITS = BLOCK_WORDS * ntl::bits::WORD_BITS;
+
+    /**
+     * @brief The number of blocks.
+     */
+    static constexpr Size BLOCKS = bits / BLOCK_BITS;
+
+    CVERIFY(bits >= BLOCK_BITS && bits % BLOCK_BITS == 0 && "The bits have to be a multiple of a block");
+    CVERIFY((PackedBitset<bits, Allocator>::WORD_ALIGNMENT >= BLOCK_WORDS * sizeof(U64)) && "Blocks have to be aligned");
+
+  private:
+    PackedBitset<bits, Allocator> m_bits;
+    Size m_size;
+    algorithms::Hash m_algorithm;
+    [[no_unique_address]] HasherType m_hasher;
+
+  public:
+    /**
+     * @brief Constructs a new empty filter.
+     *
+     * @details Runtime: O(n), where n is the number of bits
+     *
+     * @param a_algorithm the hashing algorithm to use
+     * @param a_allocator the allocator of the bits
+     */
+    explicit BlockedBloomFilter(algorithms::Hash a_algorithm = algorithms::Hash::WyHash, const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Inserts a key.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_key the key to insert
+     */
+    void Insert(const KeyType& a_key);
+
+    /**
+     * @brief Inserts a key equal to the given lookup key, without converting it to the key type.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_key the lookup key (see hash::TransparentKey)
+     */
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    void Insert(const LookupType& a_key);
+
+    /**
+     * @brief Checks if the given key may have been inserted.
+     *
+     * @details Runtime: O(1), a single cache line
+     *
+     * @param a_key the key to check
+     * @return false if the key was never inserted, true if it was or by the false positive rate
+     */
+    [[nodiscard]] bool MayContain(const KeyType& a_key) const;
+
+    /**
+     * @brief Checks if a key equal to the given lookup key may have been inserted.
+     *
+     * @details Runtime: O(1), a single cache line
+     *
+     * @param a_key the lookup key (see hash::TransparentKey)
+     * @return false if the key was never inserted, true if it was or by the false positive rate
+     */
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    [[nodiscard]] bool MayContain(const LookupType& a_key) const;
+
+    /**
+     * @brief Adds the keys of another filter, as if they were inserted into this one.
+     *
+     * @details Runtime: O(n), where n is the number of bits
+     *
+     * @param a_other the filter using the same algorithm
+     */
+    void Merge(const BlockedBloomFilter& a_other);
+
+    /**
+     * @brief Removes all keys.
+     *
+     * @details Runtime: O(n), where n is the number of bits
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of insertions (keys inserted twice count twice).
+     *
+     * @return the number of insertions
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the bits of the filter.
+     *
+     * @return the bits
+     */
+    [[nodiscard]] const PackedBitset<bits, Allocator>& GetBits() const;
+
+    /**
+     * @brief Estimates the false positive rate from the share of set bits, assuming evenly filled blocks.
+     *
+     * @details Runtime: O(n), where n is the number of bits
+     *
+     * @return the probability that a key which was never inserted is reported
+     */
+    [[nodiscard]] Float GetFalsePositiveRate() const;
+
+    /**
+     * @brief Gets the hashing algorithm used by the hasher.
+     *
+     * @return the algorithm
+     */
+    [[nodiscard]] algorithms::Hash GetAlgorithm() const;
+
+    /**
+     * @brief Converts the filter to a string.
+     *
+     * @return the filter as string
+     */
+    [[nodiscard]] String ToString() const;
+
+  private:
+    template <typename LookupType>
+    U64 hashKey(const LookupType& a_key) const;
+    void insert(U64 a_hash);
+    [[nodiscard]] bool mayContain(U64 a_hash) const;
+    static Size block(U64 a_hash);
+    static U64 mask(U64 a_hash, Size a_word);
+  };
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_filter the filter
+   * @return the combined ostream
+   */
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>& a_filter) {
+    return (a_stream << a_filter.ToString());
+  }
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_filter the filter
+   * @return the combined ostream
+   */
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const BlockedBloomFilter<KeyType, bits, HasherType, Allocator>& a_filter) {
+    return (a_stream << a_filter.ToString());
+  }
+
+  // --------------------------------------
+  // BLOOM FILTER PUBLIC AND PRIVATE METHODS
+  // --------------------------------------
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::BloomFilter(const algorithms::Hash a_algorithm,
+                                                                              const Allocator& a_allocator)
+    : m_bits(a_allocator), m_size{0}, m_algorithm{a_algorithm}, m_hasher{} {
+    // Empty
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  void BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::Insert(const KeyType& a_key) {
+    insert(hashKey(a_key));
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  void BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::Insert(const LookupType& a_key) {
+    insert(hashKey(a_key));
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  bool BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::MayContain(const KeyType& a_key) const {
+    return mayContain(hashKey(a_key));
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  bool BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::MayContain(const LookupType& a_key) const {
+    return mayContain(hashKey(a_key));
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  void BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::Merge(const BloomFilter& a_other) {
+    VERIFY(m_algorithm == a_other.m_algorithm && "Filters have to use the same algorithm")
+    m_bits |= a_other.m_bits;
+    m_size += a_other.m_size;
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  void BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::Clear() {
+    m_bits.Reset();
+    m_size = 0;
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  Size BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::GetSize() const {
+    return m_size;
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  const PackedBitset<bits, Allocator>& BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::GetBits() const {
+    return m_bits;
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  Float BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::GetFalsePositiveRate() const {
+    const double fill = static_cast<double>(m_bits.GetCount()) / bits;
+    return static_cast<Float>(std::pow(fill, static_cast<double>(hash_count)));
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  algorithms::Hash BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::GetAlgorithm() const {
+    return m_algorithm;
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  String BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::ToString() const {
+    StringBuilder builder{64};
+    builder.Append("BloomFilter(bits: ").Append(bits).Append(", hashes: ").Append(hash_count);
+    builder.Append(", size: ").Append(m_size).Append(")");
+    return builder.Build();
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  template <typename LookupType>
+  U64 BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::hashKey(const LookupType& a_key) const {
+    if constexpr(std::is_invocable_r_v<U64, const HasherType&, const LookupType&, algorithms::Hash>)
+      return m_hasher(a_key, m_algorithm);
+    else
+      return m_hasher(a_key);
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  void BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::insert(const U64 a_hash) {
+    // double hashing: the halves of the hash give the start and the (odd) step of the probed bits
+    const U64 step = std::rotl(a_hash, 32) | 1;
+    U64 position = a_hash;
+    for(Size i = 0; i < hash_count; ++i, position += step)
+      m_bits.Set(position % bits);
+    m_size++;
+  }
+
+  template <typename KeyType, Size bits, Size hash_count, typename HasherType, typename Allocator>
+  bool BloomFilter<KeyType, bits, hash_count, HasherType, Allocator>::mayContain(const U64 a_hash) const {
+    const U64 step = std::rotl(a_hash, 32) | 1;
+    U64 position = a_hash;
+    for(Size i = 0; i < hash_count; ++i, position += step) {
+      if(!m_bits.IsSet(position % bits))
+        return false;
+    }
+    return true;
+  }
+
+  // -----------------------------------------------
+  // BLOCKED BLOOM FILTER PUBLIC AND PRIVATE METHODS
+  // -----------------------------------------------
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::BlockedBloomFilter(const algorithms::Hash a_algorithm,
+                                                                              const Allocator& a_allocator)
+    : m_bits(a_allocator), m_size{0}, m_algorithm{a_algorithm}, m_hasher{} {
+    // Empty
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  void BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::Insert(const KeyType& a_key) {
+    insert(hashKey(a_key));
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  void BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::Insert(const LookupType& a_key) {
+    insert(hashKey(a_key));
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  bool BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::MayContain(const KeyType& a_key) const {
+    return mayContain(hashKey(a_key));
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  bool BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::MayContain(const LookupType& a_key) const {
+    return mayContain(hashKey(a_key));
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  void BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::Merge(const BlockedBloomFilter& a_other) {
+    VERIFY(m_algorithm == a_other.m_algorithm && "Filters have to use the same algorithm")
+    m_bits |= a_other.m_bits;
+    m_size += a_other.m_size;
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  void BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::Clear() {
+    m_bits.Reset();
+    m_size = 0;
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  Size BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::GetSize() const {
+    return m_size;
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  const PackedBitset<bits, Allocator>& BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::GetBits() const {
+    return m_bits;
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  Float BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::GetFalsePositiveRate() const {
+    const double fill = static_cast<double>(m_bits.GetCount()) / bits;
+    return static_cast<Float>(std::pow(fill, static_cast<double>(BLOCK_WORDS)));
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  algorithms::Hash BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::GetAlgorithm() const {
+    return m_algorithm;
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  String BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::ToString() const {
+    StringBuilder builder{64};
+    builder.Append("BlockedBloomFilter(bits: ").Append(bits).Append(", blocks: ").Append(BLOCKS);
+    builder.Append(", size: ").Append(m_size).Append(")");
+    return builder.Build();
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  template <typename LookupType>
+  U64 BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::hashKey(const LookupType& a_key) const {
+    if constexpr(std::is_invocable_r_v<U64, const HasherType&, const LookupType&, algorithms::Hash>)
+      return m_hasher(a_key, m_algorithm);
+    else
+      return m_hasher(a_key);
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  void BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::insert(const U64 a_hash) {
+    U64* words = m_bits.GetWords() + block(a_hash);
+    for(Size i = 0; i < BLOCK_WORDS; ++i)
+      words[i] |= mask(a_hash, i);
+    m_size++;
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  bool BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::mayContain(const U64 a_hash) const {
+    const U64* words = m_bits.GetWords() + block(a_hash);
+    // collects the missing bits of all words, so the loop has no branches and gets unrolled
+    U64 missing = 0;
+    for(Size i = 0; i < BLOCK_WORDS; ++i)
+      missing |= mask(a_hash, i) & ~words[i];
+    return missing == 0;
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  Size BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::block(const U64 a_hash) {
+    // the upper half picks the block, the lower half the bits within it
+    return static_cast<Size>(a_hash >> 32) % BLOCKS * BLOCK_WORDS;
+  }
+
+  template <typename KeyType, Size bits, typename HasherType, typename Allocator>
+  U64 BlockedBloomFilter<KeyType, bits, HasherType, Allocator>::mask(const U64 a_hash, const Size a_word) {
+    // a different odd multiplier per word, whose top 6 bits of the product pick the bit (as in Parquet)
+    constexpr U32 SALTS[BLOCK_WORDS] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+    const U32 product = static_cast<U32>(a_hash) * SALTS[a_word];
+    return U64{1} << (product >> 26);
+  }
+}
+
+#endif // NTL_BLOOM_FILTER_HPP
@@ -0,0 +1,815 @@
+/**
+* @file ColumnArray.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_COLUMN_ARRAY_HPP
+#define NTL_COLUMN_ARRAY_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+#include "data/Array.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Memory.hpp"
+#include "utils/Sort.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new array object storing records as a structure of arrays.
+   *
+   * @details Every field of the records lives in a column of its own, which is contiguous and aligned
+   * to a cache line, so scanning one field only pulls that field through the cache and SIMD loops can
+   * consume the columns directly (see GetColumn). A row is accessed through a tuple of references to
+   * its fields, which supports structured bindings:
+   *
+   *     ColumnArray<U32, float> points(1024, true);
+   *     points.Insert(1, 0.5f);
+   *     for(auto [id, weight] : points) { ... }
+   *
+   * Like Array, only the used rows hold constructed fields and the columns are relocated with memcpy
+   * for trivially relocatable fields when the array grows.
+   *
+   * @tparam Fields the types of the fields of a record
+   */
+  template <typename... Fields>
+  class ColumnArray {
+  private:
+    CVERIFY(sizeof...(Fields) > 0 && "ColumnArray needs at least one field");
+
+    std::tuple<Fields*...> m_columns;
+    Size m_used;
+    Size m_capacity;
+    bool m_growable;
+    DefaultAllocator m_allocator;
+
+    template <bool Const>
+    class RowIterator;
+
+  public:
+    /**
+     * @brief The type of the field with the given index.
+     */
+    template <Size I>
+    using Column = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    /**
+     * @brief A row proxy referring to the fields of a record.
+     */
+    using Reference = std::tuple<Fields&...>;
+
+    /**
+     * @brief A row proxy referring to the fields of a record, which can't be changed through it.
+     */
+    using ConstReference = std::tuple<const Fields&...>;
+
+    using Iterator = RowIterator<false>;
+    using ConstIterator = RowIterator<true>;
+
+    /**
+     * @brief The alignment of the columns.
+     */
+    static constexpr Size COLUMN_ALIGNMENT = std::max({Size{NTL_CACHE_LINE_SIZE}, alignof(Fields)...});
+
+    /**
+     * @brief Constructs a new array.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_capacity the number of records the columns can hold
+     * @param a_growable if the array should be able to grow when maximum capacity is reached
+     */
+    explicit ColumnArray(Size a_capacity = 1024, bool a_growable = false);
+
+    /**
+     * @brief Destroys the records and frees the columns.
+     */
+    ~ColumnArray();
+
+    /**
+     * @brief Copy Constructor.
+     *
+     * @param a_other a reference to another array
+     */
+    ColumnArray(const ColumnArray& a_other);
+
+    /**
+     * @brief Move Constructor.
+     *
+     * @param a_other a reference to another array (without columns afterwards)
+     */
+    ColumnArray(ColumnArray&& a_other) noexcept;
+
+    /**
+     * @brief Copy-Assignment operator.
+     *
+     * @param a_other a reference to another array
+     *
+     * @return the reference to the array
+     */
+    ColumnArray& operator=(const ColumnArray& a_other);
+
+    /**
+     * @brief Move-Assignment operator.
+     *
+     * @param a_other a reference to another array (without columns afterwards)
+     *
+     * @return the reference to the array
+     */
+    ColumnArray& operator=(ColumnArray&& a_other) noexcept;
+
+    /**
+     * @brief Inserts a record at the end of the array.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_fields the fields of the record, each constructing the field of its column
+     * @return the index of the record
+     */
+    template <typename... Args>
+      requires(sizeof...(Args) == sizeof...(Fields))
+    Size Insert(Args&&... a_fields);
+
+    /**
+     * @brief Inserts a record at the given index, shifting the following records back.
+     *
+     * @details Runtime: O(n), where n is the number of records after the index
+     * (using memmove for trivially relocatable fields).
+     *
+     * @param a_index the index of the new record
+     * @param a_fields the fields of the record, each constructing the field of its column
+     */
+    template <typename... Args>
+      requires(sizeof...(Args) == sizeof...(Fields))
+    void InsertAt(Size a_index, Args&&... a_fields);
+
+    /**
+     * @brief Removes the record at the given index, shifting the following records forward.
+     *
+     * @details Runtime: O(n), where n is the number of records after the index
+     * (using memmove for trivially relocatable fields).
+     *
+     * @param a_index the index of the record
+     * @return the fields of the removed record
+     */
+    std::tuple<Fields...> Remove(Size a_index);
+
+    /**
+     * @brief Swaps two records.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_first the index of the first record
+     * @param a_second the index of the second record
+     */
+    void Swap(Size a_first, Size a_second);
+
+    /**
+     * @brief Removes all records, keeping the capacity.
+     *
+     * @details Runtime: O(n), where n is the size of the array (O(1) for trivially destructible fields)
+     */
+    void Clear();
+
+    /**
+     * @brief Makes sure the columns can hold the given number of records without growing.
+     *
+     * @details Runtime: O(n), where n is the size of the array (O(1) if the capacity suffices).
+     *
+     * @param a_capacity the number of records
+     */
+    void Reserve(Size a_capacity);
+
+    /**
+     * @brief Sorts the records by the field of the given column, permuting all columns together.
+     *
+     * @details Runtime: the one of the algorithm for the indices of the records (see Array::Sort) plus O(n)
+     * moves per column, where n is the size of the array. Only the column of the key is read while sorting.
+     * Dynamic sort and merge sort are stable, radix sort falls back to dynamic sort.
+     *
+     * @tparam I the index of the column to sort by
+     * @param a_algorithm the sorting algorithm to use
+     */
+    template <Size I>
+    void Sort(algorithms::Sort a_algorithm = algorithms::Sort::DYNAMIC);
+
+    /**
+     * @brief Sorts the records by the given comparison, permuting all columns together.
+     *
+     * @details Runtime: see Sort by a column.
+     *
+     * @param a_compare the comparison of two ConstReferences returning if the left record belongs before the right one
+     * @param a_algorithm the sorting algorithm to use
+     */
+    template <typename Compare>
+    void Sort(const Compare& a_compare, algorithms::Sort a_algorithm = algorithms::Sort::DYNAMIC);
+
+    /**
+     * @brief Finds the first record whose field of the given column equals the given value.
+     *
+     * @details Runtime: O(n), where n is the size of the array (only reading the column).
+     *
+     * @tparam I the index of the column
+     * @param a_value the value to find
+     * @return the index of the record (-1 if not found)
+     */
+    template <Size I>
+    [[nodiscard]] I64 Find(const Column<I>& a_value) const;
+
+    /**
+     * @brief Gets the record at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index
+     * @return the references to the fields of the record
+     */
+    Reference Get(Size a_index);
+
+    /**
+     * @brief Gets the record at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index
+     * @return the references to the fields of the record
+     */
+    ConstReference Get(Size a_index) const;
+
+    /**
+     * @brief Gets a field of the record at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @tparam I the index of the column
+     * @param a_index the index of the record
+     * @return the field
+     */
+    template <Size I>
+    Column<I>& Get(Size a_index);
+
+    /**
+     * @brief Gets a field of the record at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @tparam I the index of the column
+     * @param a_index the index of the record
+     * @return the field
+     */
+    template <Size I>
+    const Column<I>& Get(Size a_index) const;
+
+    /**
+     * @brief Gets the used part of a column.
+     *
+     * @details Runtime: O(1). The data of the span is aligned to COLUMN_ALIGNMENT and stays valid until
+     * the array grows.
+     *
+     * @tparam I the index of the column
+     * @return the span of the fields of all records
+     */
+    template <Size I>
+    std::span<Column<I>> GetColumn();
+
+    /**
+     * @brief Gets the used part of a column.
+     *
+     * @details Runtime: O(1). The data of the span is aligned to COLUMN_ALIGNMENT and stays valid until
+     * the array grows.
+     *
+     * @tparam I the index of the column
+     * @return the span of the fields of all records
+     */
+    template <Size I>
+    std::span<const Column<I>> GetColumn() const;
+
+    /**
+     * @brief Checks if the array is empty.
+     *
+     * @return if the array is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Gets the number of records the columns can hold.
+     *
+     * @return the capacity of the array
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Gets the number of records.
+     *
+     * @return the size of the array
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the number of fields of a record.
+     *
+     * @return the number of columns
+     */
+    [[nodiscard]] static constexpr Size GetColumnCount();
+
+    Reference operator[](Size a_index);
+    ConstReference operator[](Size a_index) const;
+
+    Iterator begin();
+    Iterator end();
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+  private:
+    /**
+     * @brief Iterator over the records, dereferencing to row proxies.
+     */
+    template <bool Const>
+    class RowIterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = std::tuple<Fields...>;
+      using reference = std::conditional_t<Const, ConstReference, Reference>;
+
+    private:
+      using Owner = std::conditional_t<Const, const ColumnArray, ColumnArray>;
+
+      Owner* m_array;
+      Size m_index;
+
+    public:
+      /**
+       * @brief Constructs a new iterator
+       * @param a_array the array
+       * @param a_index the index of the record
+       */
+      RowIterator(Owner* a_array, Size a_index) : m_array{a_array}, m_index{a_index} {}
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the row proxy of the current iteration
+       */
+      reference operator*() const { return m_array->Get(m_index); }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the reference to the next iterator
+       */
+      RowIterator& operator++() {
+        m_index++;
+        return *this;
+      }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the next iterator
+       */
+      RowIterator operator++(int) {
+        RowIterator temp = *this;
+        ++(*this);
+        return temp;
+      }
+
+      /**
+       * @brief Overloading decrement operator.
+       * @return the previous iterator
+       */
+      RowIterator& operator--() {
+        m_index--;
+        return *this;
+      }
+
+      /**
+       * @brief Overloading equals operator.
+       * @param a_other the other iterator
+       * @return if both iterators point to the same record
+       */
+      bool operator==(const RowIterator& a_other) const { return m_index == a_other.m_index; }
+    };
+
+    /**
+     * @brief Calls the function with every column pointer and the type of its field.
+     *
+     * @param a_function the function taking a reference to a column pointer
+     */
+    template <typename Function>
+    void forEachColumn(const Function& a_function);
+
+    /**
+     * @brief Allocates an uninitialized column.
+     *
+     * @param a_capacity the number of fields
+     * @return the column
+     */
+    template <typename T>
+    T* allocateColumn(Size a_capacity);
+
+    /**
+     * @brief Frees a column (its fields must be destroyed already).
+     *
+     * @param a_column the column
+     * @param a_capacity the number of fields
+     */
+    template <typename T>
+    void deallocateColumn(T* a_column, Size a_capacity);
+
+    /**
+     * @brief Relocates the records into new columns.
+     *
+     * @param a_capacity the capacity of the new columns
+     */
+    void reallocate(Size a_capacity);
+
+    /**
+     * @brief Makes room for one more record (growing if allowed).
+     */
+    void ensureCapacity();
+
+    /**
+     * @brief Copies the records of the other array into the empty columns.
+     *
+     * @param a_other the other array
+     */
+    void copyFrom(const ColumnArray& a_other);
+
+    /**
+     * @brief Destroys the records and frees the columns.
+     */
+    void release();
+
+    /**
+     * @brief Sorts the records by the given comparison of record indices.
+     *
+     * @param a_compare the comparison of two indices
+     * @param a_algorithm the sorting algorithm to use
+     */
+    template <typename Compare>
+    void sortIndices(const Compare& a_compare, algorithms::Sort a_algorithm);
+  };
+
+  /**
+   * @brief A structure of arrays (see ColumnArray).
+   */
+  template <typename... Fields>
+  using SoA = ColumnArray<Fields...>;
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+
+  template <typename... Fields>
+  typename ColumnArray<Fields...>::Iterator ColumnArray<Fields...>::begin() {
+    return Iterator(this, 0);
+  }
+
+  template <typename... Fields>
+  typename ColumnArray<Fields...>::Iterator ColumnArray<Fields...>::end() {
+    return Iterator(this, m_used);
+  }
+
+  template <typename... Fields>
+  typename ColumnArray<Fields...>::ConstIterator ColumnArray<Fields...>::begin() const {
+    return ConstIterator(this, 0);
+  }
+
+  template <typename... Fields>
+  typename ColumnArray<Fields...>::ConstIterator ColumnArray<Fields...>::end() const {
+    return ConstIterator(this, m_used);
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename... Fields>
+  ColumnArray<Fields...>::ColumnArray(Size a_capacity, bool a_growable)
+    : m_columns{}, m_used{0}, m_capacity{std::max(a_capacity, Size{1})}, m_growable{a_growable} {
+    forEachColumn([&]<typename T>(T*& a_column) { a_column = allocateColumn<T>(m_capacity); });
+  }
+
+  template <typename... Fields>
+  ColumnArray<Fields...>::~ColumnArray() {
+    release();
+  }
+
+  template <typename... Fields>
+  ColumnArray<Fields...>::ColumnArray(const ColumnArray& a_other)
+    : ColumnArray(a_other.m_capacity, a_other.m_growable) {
+    copyFrom(a_other);
+  }
+
+  template <typename... Fields>
+  ColumnArray<Fields...>::ColumnArray(ColumnArray&& a_other) noexcept
+    : m_columns{std::exchange(a_other.m_columns, {})}, m_used{std::exchange(a_other.m_used, 0)},
+      m_capacity{std::exchange(a_other.m_capacity, 0)}, m_growable{a_other.m_growable} {
+    // Empty
+  }
+
+  template <typename... Fields>
+  ColumnArray<Fields...>& ColumnArray<Fields...>::operator=(const ColumnArray& a_other) {
+    if(this != &a_other) {
+      Clear();
+      Reserve(a_other.m_used);
+      m_growable = a_other.m_growable;
+      copyFrom(a_other);
+    }
+    return *this;
+  }
+
+  template <typename... Fields>
+  ColumnArray<Fields...>& ColumnArray<Fields...>::operator=(ColumnArray&& a_other) noexcept {
+    if(this != &a_other) {
+      release();
+      m_columns = std::exchange(a_other.m_columns, {});
+      m_used = std::exchange(a_other.m_used, 0);
+      m_capacity = std::exchange(a_other.m_capacity, 0);
+      m_growable = a_other.m_growable;
+    }
+    return *this;
+  }
+
+  template <typename... Fields>
+  template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Fields))
+  Size ColumnArray<Fields...>::Insert(Args&&... a_fields) {
+    ensureCapacity();
+
+    std::apply([&](Fields*... a_columns) { (std::construct_at(a_columns + m_used, std::forward<Args>(a_fields)), ...); },
+               m_columns);
+
+    return m_used++;
+  }
+
+  template <typename... Fields>
+  template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Fields))
+  void ColumnArray<Fields...>::InsertAt(Size a_index, Args&&... a_fields) {
+    VERIFY(a_index <= m_used)
+
+    // constructed up front, as the fields might refer to a record that gets shifted
+    std::tuple<Fields...> record(std::forward<Args>(a_fields)...);
+    ensureCapacity();
+
+    forEachColumn([&]<typename T>(T* a_column) {
+      if constexpr(memory::IsTriviallyRelocatable<T>::value) {
+        std::memmove(static_cast<void*>(a_column + a_index + 1), static_cast<const void*>(a_column + a_index),
+                     (m_used - a_index) * sizeof(T));
+      } else if(a_index < m_used) {
+        std::construct_at(a_column + m_used, std::move(a_column[m_used - 1]));
+        std::move_backward(a_column + a_index, a_column + m_used - 1, a_column + m_used);
+        std::destroy_at(a_column + a_index);
+      }
+    });
+
+    std::apply([&](Fields*... a_columns) {
+      std::apply([&](Fields&... a_values) { (std::construct_at(a_columns + a_index, std::move(a_values)), ...); },
+                 record);
+    }, m_columns);
+
+    m_used++;
+  }
+
+  template <typename... Fields>
+  std::tuple<Fields...> ColumnArray<Fields...>::Remove(Size a_index) {
+    VERIFY(a_index < m_used)
+
+    std::tuple<Fields...> result = std::apply(
+      [&](Fields*... a_columns) { return std::tuple<Fields...>(std::move(a_columns[a_index])...); }, m_columns);
+
+    forEachColumn([&]<typename T>(T* a_column) {
+      if constexpr(memory::IsTriviallyRelocatable<T>::value) {
+        std::destroy_at(a_column + a_index);
+        std::memmove(static_cast<void*>(a_column + a_index), static_cast<const void*>(a_column + a_index + 1),
+                     (m_used - a_index - 1) * sizeof(T));
+      } else {
+        std::move(a_column + a_index + 1, a_column + m_used, a_column + a_index);
+        std::destroy_at(a_column + m_used - 1);
+      }
+    });
+    m_used--;
+
+    return result;
+  }
+
+  template <typename... Fields>
+  void ColumnArray<Fields...>::Swap(Size a_first, Size a_second) {
+    VERIFY(a_first < m_used && a_second < m_used)
+
+    forEachColumn([&]<typename T>(T* a_column) { std::swap(a_column[a_first], a_column[a_second]); });
+  }
+
+  template <typename... Fields>
+  void ColumnArray<Fields...>::Clear() {
+    forEachColumn([&]<typename T>(T* a_column) { memory::Destroy(a_column, m_used); });
+    m_used = 0;
+  }
+
+  template <typename... Fields>
+  void ColumnArray<Fields...>::Reserve(Size a_capacity) {
+    if(a_capacity > m_capacity)
+      reallocate(a_capacity);
+  }
+
+  template <typename... Fields>
+  template <Size I>
+  void ColumnArray<Fields...>::Sort(algorithms::Sort a_algorithm) {
+    if constexpr(has_less_than<Column<I>>) {
+      const Column<I>* column = std::get<I>(m_columns);
+      sortIndices([column](const Size a_left, const Size a_right) { return column[a_left] < column[a_right]; },
+                  a_algorithm);
+    } else {
+      VERIFY(has_less_than<Column<I>>)
+    }
+  }
+
+  template <typename... Fields>
+  template <typename Compare>
+  void ColumnArray<Fields...>::Sort(const Compare& a_compare, algorithms::Sort a_algorithm) {
+    const ColumnArray& array = *this;
+    sortIndices([&](const Size a_left, const Size a_right) { return a_compare(array[a_left], array[a_right]); },
+                a_algorithm);
+  }
+
+  template <typename... Fields>
+  template <Size I>
+  I64 ColumnArray<Fields...>::Find(const Column<I>& a_value) const {
+    const Column<I>* column = std::get<I>(m_columns);
+    for(Size i = 0; i < m_used; ++i) {
+      if(column[i] == a_value)
+        return static_cast<I64>(i);
+    }
+    return -1;
+  }
+
+  template <typename... Fields>
+  typename ColumnArray<Fields...>::Reference ColumnArray<Fields...>::Get(Size a_index) {
+    VERIFY(a_index < m_used)
+    return std::apply([a_index](Fields*... a_columns) { return Reference(a_columns[a_index]...); }, m_columns);
+  }
+
+  template <typename... Fields>
+  typename ColumnArray<Fields...>::ConstReference ColumnArray<Fields...>::Get(Size a_index) const {
+    VERIFY(a_index < m_used)
+    return std::apply([a_index](Fields* const... a_columns) { return ConstReference(a_columns[a_index]...); },
+                      m_columns);
+  }
+
+  template <typename... Fields>
+  template <Size I>
+  typename ColumnArray<Fields...>::template Column<I>& ColumnArray<Fields...>::Get(Size a_index) {
+    VERIFY(a_index < m_used)
+    return std::get<I>(m_columns)[a_index];
+  }
+
+  template <typename... Fields>
+  template <Size I>
+  const typename ColumnArray<Fields...>::template Column<I>& ColumnArray<Fields...>::Get(Size a_index) const {
+    VERIFY(a_index < m_used)
+    return std::get<I>(m_columns)[a_index];
+  }
+
+  template <typename... Fields>
+  template <Size I>
+  std::span<typename ColumnArray<Fields...>::template Column<I>> ColumnArray<Fields...>::GetColumn() {
+    return {std::get<I>(m_columns), m_used};
+  }
+
+  template <typename... Fields>
+  template <Size I>
+  std::span<const typename ColumnArray<Fields...>::template Column<I>> ColumnArray<Fields...>::GetColumn() const {
+    return {std::get<I>(m_columns), m_used};
+  }
+
+  template <typename... Fields>
+  bool ColumnArray<Fields...>::IsEmpty() const {
+    return m_used == 0;
+  }
+
+  template <typename... Fields>
+  Size ColumnArray<Fields...>::GetCapacity() const {
+    return m_capacity;
+  }
+
+  template <typename... Fields>
+  Size ColumnArray<Fields...>::GetSize() const {
+    return m_used;
+  }
+
+  template <typename... Fields>
+  constexpr Size ColumnArray<Fields...>::GetColumnCount() {
+    return sizeof...(Fields);
+  }
+
+  template <typename... Fields>
+  typename ColumnArray<Fields...>::Reference ColumnArray<Fields...>::operator[](Size a_index) {
+    return Get(a_index);
+  }
+
+  template <typename... Fields>
+  typename ColumnArray<Fields...>::ConstReference ColumnArray<Fields...>::operator[](Size a_index) const {
+    return Get(a_index);
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename... Fields>
+  template <typename Function>
+  void ColumnArray<Fields...>::forEachColumn(const Function& a_function) {
+    std::apply([&](Fields*&... a_columns) { (a_function.template operator()<Fields>(a_columns), ...); }, m_columns);
+  }
+
+  template <typename... Fields>
+  template <typename T>
+  T* ColumnArray<Fields...>::allocateColumn(Size a_capacity) {
+    return static_cast<T*>(m_allocator.Allocate(a_capacity * sizeof(T), COLUMN_ALIGNMENT));
+  }
+
+  template <typename... Fields>
+  template <typename T>
+  void ColumnArray<Fields...>::deallocateColumn(T* a_column, Size a_capacity) {
+    if(a_column)
+      m_allocator.Deallocate(static_cast<void*>(a_column), a_capacity * sizeof(T), COLUMN_ALIGNMENT);
+  }
+
+  template <typename... Fields>
+  void ColumnArray<Fields...>::reallocate(Size a_capacity) {
+    forEachColumn([&]<typename T>(T*& a_column) {
+      T* temp = allocateColumn<T>(a_capacity);
+      memory::Relocate(temp, a_column, m_used);
+      deallocateColumn(a_column, m_capacity);
+      a_column = temp;
+    });
+    m_capacity = a_capacity;
+  }
+
+  template <typename... Fields>
+  void ColumnArray<Fields...>::ensureCapacity() {
+    if(m_used < m_capacity)
+      return;
+
+    ENSURE(m_growable && "ColumnArray is full")
+    reallocate(std::max(m_capacity * 2, Size{1}));
+  }
+
+  template <typename... Fields>
+  void ColumnArray<Fields...>::copyFrom(const ColumnArray& a_other) {
+    auto columns = a_other.m_columns;
+    [&]<Size... I>(std::index_sequence<I...>) {
+      (std::uninitialized_copy_n(std::get<I>(columns), a_other.m_used, std::get<I>(m_columns)), ...);
+    }(std::index_sequence_for<Fields...>{});
+    m_used = a_other.m_used;
+  }
+
+  template <typename... Fields>
+  void ColumnArray<Fields...>::release() {
+    forEachColumn([&]<typename T>(T*& a_column) {
+      memory::Destroy(a_column, m_used);
+      deallocateColumn(a_column, m_capacity);
+      a_column = nullptr;
+    });
+    m_used = 0;
+    m_capacity = 0;
+  }
+
+  template <typename... Fields>
+  template <typename Compare>
+  void ColumnArray<Fields...>::sortIndices(const Compare& a_compare, algorithms::Sort a_algorithm) {
+    if(m_used < 2)
+      return;
+
+    // only the indices are sorted, so every column is moved exactly once afterwards
+    Array<Size> order(m_used);
+    for(Size i = 0; i < m_used; ++i)
+      order.Insert(i);
+    sort::Sort(order.GetData(), m_used, a_algorithm, a_compare);
+
+    const Size* indices = order.GetData();
+    forEachColumn([&]<typename T>(T*& a_column) {
+      T* temp = allocateColumn<T>(m_capacity);
+      for(Size i = 0; i < m_used; ++i)
+        std::construct_at(temp + i, std::move(a_column[indices[i]]));
+
+      memory::Destroy(a_column, m_used);
+      deallocateColumn(a_column, m_capacity);
+      a_column = temp;
+    });
+  }
+}
+
+#endif // NTL_COLUMN_ARRAY_HPP
@@ -0,0 +1,421 @@
+/**
+* @file EytzingerArray.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_EYTZINGER_ARRAY_HPP
+#define NTL_EYTZINGER_ARRAY_HPP
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+#include "data/Array.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "utils/Memory.hpp"
+#include "utils/Search.hpp"
+
+namespace ntl {
+  /**
+   * @brief A read-only copy of a sorted range stored in Eytzinger (breadth-first) order for fast lookups.
+   *
+   * @details Node k has its children at 2k and 2k + 1, so the first levels of the implicit search tree
+   * share a few cache lines and the nodes a search visits next are always at a predictable address. The
+   * search is branchless and prefetches the cache line holding the descendants a few levels below the
+   * current node, so big tables take far fewer cache misses than a binary search over the sorted range.
+   *
+   * Lookups return the indices the elements have in the sorted range the index was built from.
+   *
+   * @tparam T the type of the elements to store (needs operator<)
+   */
+  template <typename T>
+  class EytzingerArray {
+  private:
+    // number of nodes per cache line, the descendants log2(BLOCK) levels below a node are contiguous
+    static constexpr Size BLOCK = sizeof(T) < 64 ? std::bit_floor(64 / sizeof(T)) : 1;
+    static constexpr std::align_val_t ALIGNMENT{std::max<Size>(64, alignof(T))};
+
+    T* m_data;        // node k is at m_data[k], m_data[0] is a copy of the root, read instead of missing nodes
+    Size* m_ranks;    // the index in the sorted range of every node
+    Size m_size;
+    Size m_height;
+
+  public:
+    /**
+     * @brief Constructs an empty index.
+     */
+    EytzingerArray();
+
+    /**
+     * @brief Builds the index from the given sorted elements.
+     *
+     * @details Runtime: O(n), where n is the number of elements.
+     *
+     * @param a_sorted the first element
+     * @param a_count the number of elements
+     */
+    EytzingerArray(const T* a_sorted, Size a_count);
+
+    /**
+     * @brief Builds the index from the given sorted array.
+     *
+     * @details Runtime: O(n), where n is the used size of the array.
+     *
+     * @param a_sorted the sorted array
+     */
+    template <typename Allocator>
+    explicit EytzingerArray(const Array<T, Allocator>& a_sorted);
+
+    /**
+     * @brief Constructs a new index from another index.
+     *
+     * @details Runtime: O(n), where n is the size of the other index.
+     *
+     * @param a_other the other index
+     */
+    EytzingerArray(const EytzingerArray<T>& a_other);
+
+    /**
+     * @brief Constructs a new index by taking over another index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other index (empty afterwards)
+     */
+    EytzingerArray(EytzingerArray<T>&& a_other) noexcept;
+
+    /**
+     * @brief Destructs the index.
+     */
+    ~EytzingerArray();
+
+    /**
+     * @brief Overloading copy assignment operator.
+     *
+     * @param a_other the index to copy
+     * @return the reference of the current index
+     */
+    EytzingerArray<T>& operator=(const EytzingerArray<T>& a_other);
+
+    /**
+     * @brief Overloading move assignment operator.
+     *
+     * @param a_other the index to take over (empty afterwards)
+     * @return the reference of the current index
+     */
+    EytzingerArray<T>& operator=(EytzingerArray<T>&& a_other) noexcept;
+
+    /**
+     * @brief Finds the given element.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the index.
+     *
+     * @param a_element the element to find
+     * @return the index of the last equal element in the sorted range (-1 if not found)
+     */
+    [[nodiscard]] I64 Find(const T& a_element) const;
+
+    /**
+     * @brief Finds the given elements, interleaving search::BATCH_SIZE lookups at a time to hide the memory latency.
+     *
+     * @details Runtime: O(m * log(n)), where m is the number of searched elements and n the size of the index.
+     *
+     * @param a_elements the elements to find
+     * @param a_count the number of elements to find
+     * @param a_results receives the index of the last equal element in the sorted range for every searched one (-1 if not found)
+     */
+    void FindMany(const T* a_elements, Size a_count, I64* a_results) const;
+
+    /**
+     * @brief Checks if the index contains the given element.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the index.
+     *
+     * @param a_element the element to find
+     * @return if the element is contained
+     */
+    [[nodiscard]] bool Contains(const T& a_element) const;
+
+    /**
+     * @brief Gets the number of elements.
+     *
+     * @return the number of elements
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Checks if the index is empty.
+     *
+     * @return if there are no elements
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+  private:
+    /**
+     * @brief Allocates and fills the nodes from the given sorted elements.
+     *
+     * @param a_sorted the first element
+     * @param a_count the number of elements
+     */
+    void build(const T* a_sorted, Size a_count);
+
+    /**
+     * @brief Copies the sorted elements into the subtree of the given node (in-order).
+     *
+     * @param a_sorted the first element
+     * @param a_next the index of the next sorted element to copy
+     * @param a_node the root of the subtree
+     */
+    void fill(const T* a_sorted, Size& a_next, Size a_node);
+
+    /**
+     * @brief Takes one step down the tree.
+     *
+     * @param a_node the current node
+     * @param a_element the searched element
+     * @return the child to continue at
+     */
+    [[nodiscard]] Size step(Size a_node, const T& a_element) const;
+
+    /**
+     * @brief Takes the last step down the tree, which may end at a missing node.
+     *
+     * @param a_node the current node
+     * @param a_element the searched element
+     * @return the child to continue at (or the node itself if it's missing)
+     */
+    [[nodiscard]] Size lastStep(Size a_node, const T& a_element) const;
+
+    /**
+     * @brief Gets the result of a search, which ended at the given node.
+     *
+     * @param a_node the node the search ended at
+     * @param a_element the searched element
+     * @return the index of the element in the sorted range (-1 if not found)
+     */
+    [[nodiscard]] I64 result(Size a_node, const T& a_element) const;
+
+    /**
+     * @brief Destroys the nodes and frees the memory.
+     */
+    void release();
+  };
+
+  // -------------------
+  // PUBLIC CONSTRUCTORS
+  // -------------------
+
+  template <typename T>
+  EytzingerArray<T>::EytzingerArray()
+    : m_data{nullptr}, m_ranks{nullptr}, m_size{0}, m_height{0} {
+    // Empty
+  }
+
+  template <typename T>
+  EytzingerArray<T>::EytzingerArray(const T* a_sorted, Size a_count)
+    : EytzingerArray() {
+    build(a_sorted, a_count);
+  }
+
+  template <typename T>
+  template <typename Allocator>
+  EytzingerArray<T>::EytzingerArray(const Array<T, Allocator>& a_sorted)
+    : EytzingerArray() {
+    VERIFY(a_sorted.IsSorted())
+    build(a_sorted.GetData(), a_sorted.GetSize());
+  }
+
+  template <typename T>
+  EytzingerArray<T>::EytzingerArray(const EytzingerArray<T>& a_other)
+    : EytzingerArray() {
+    *this = a_other;
+  }
+
+  template <typename T>
+  EytzingerArray<T>::EytzingerArray(EytzingerArray<T>&& a_other) noexcept
+    : m_data{std::exchange(a_other.m_data, nullptr)}, m_ranks{std::exchange(a_other.m_ranks, nullptr)},
+      m_size{std::exchange(a_other.m_size, 0)}, m_height{std::exchange(a_other.m_height, 0)} {
+    // Empty
+  }
+
+  template <typename T>
+  EytzingerArray<T>::~EytzingerArray() {
+    release();
+  }
+
+  // ----------------
+  // PUBLIC OPERATORS
+  // ----------------
+
+  template <typename T>
+  EytzingerArray<T>& EytzingerArray<T>::operator=(const EytzingerArray<T>& a_other) {
+    if(this == &a_other)
+      return *this;
+
+    release();
+    if(a_other.m_size == 0)
+      return *this;
+
+    m_data = static_cast<T*>(::operator new((a_other.m_size + 1) * sizeof(T), ALIGNMENT));
+    m_ranks = new Size[a_other.m_size + 1];
+    std::uninitialized_copy_n(a_other.m_data, a_other.m_size + 1, m_data);
+    std::copy_n(a_other.m_ranks, a_other.m_size + 1, m_ranks);
+    m_size = a_other.m_size;
+    m_height = a_other.m_height;
+
+    return *this;
+  }
+
+  template <typename T>
+  EytzingerArray<T>& EytzingerArray<T>::operator=(EytzingerArray<T>&& a_other) noexcept {
+    if(this != &a_other) {
+      release();
+      m_data = std::exchange(a_other.m_data, nullptr);
+      m_ranks = std::exchange(a_other.m_ranks, nullptr);
+      m_size = std::exchange(a_other.m_size, 0);
+      m_height = std::exchange(a_other.m_height, 0);
+    }
+
+    return *this;
+  }
+
+  // ----------------------
+  // SEARCH-RELATED METHODS
+  // ----------------------
+
+  template <typename T>
+  I64 EytzingerArray<T>::Find(const T& a_element) const {
+    if(m_size == 0)
+      return -1;
+
+    Size node = 1;
+    for(Size level = 1; level < m_height; ++level)
+      node = step(node, a_element);
+
+    return result(lastStep(node, a_element), a_element);
+  }
+
+  template <typename T>
+  void EytzingerArray<T>::FindMany(const T* a_elements, Size a_count, I64* a_results) const {
+    if(m_size == 0) {
+      std::fill_n(a_results, a_count, I64{-1});
+      return;
+    }
+
+    Size nodes[search::BATCH_SIZE];
+    for(Size first = 0; first < a_count; first += search::BATCH_SIZE) {
+      const Size batch = std::min(search::BATCH_SIZE, a_count - first);
+      const T* elements = a_elements + first;
+
+      // all searches are at the same level, so every level issues the loads of the whole batch at once
+      std::fill_n(nodes, batch, Size{1});
+      for(Size level = 1; level < m_height; ++level) {
+        for(Size i = 0; i < batch; ++i)
+          nodes[i] = step(nodes[i], elements[i]);
+      }
+
+      for(Size i = 0; i < batch; ++i)
+        a_results[first + i] = result(lastStep(nodes[i], elements[i]), elements[i]);
+    }
+  }
+
+  template <typename T>
+  bool EytzingerArray<T>::Contains(const T& a_element) const {
+    return Find(a_element) >= 0;
+  }
+
+  // -------------------------
+  // ATTRIBUTE-RELATED METHODS
+  // -------------------------
+
+  template <typename T>
+  Size EytzingerArray<T>::GetSize() const {
+    return m_size;
+  }
+
+  template <typename T>
+  bool EytzingerArray<T>::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename T>
+  void EytzingerArray<T>::build(const T* a_sorted, Size a_count) {
+    if(a_count == 0)
+      return;
+
+    m_data = static_cast<T*>(::operator new((a_count + 1) * sizeof(T), ALIGNMENT));
+    m_ranks = new Size[a_count + 1];
+    m_size = a_count;
+    m_height = std::bit_width(a_count);
+
+    Size next = 0;
+    fill(a_sorted, next, 1);
+
+    std::construct_at(m_data, m_data[1]);
+    m_ranks[0] = m_ranks[1];
+  }
+
+  template <typename T>
+  void EytzingerArray<T>::fill(const T* a_sorted, Size& a_next, Size a_node) {
+    // the recursion only goes as deep as the tree is high
+    if(a_node > m_size)
+      return;
+
+    fill(a_sorted, a_next, 2 * a_node);
+    std::construct_at(m_data + a_node, a_sorted[a_next]);
+    m_ranks[a_node] = a_next++;
+    fill(a_sorted, a_next, 2 * a_node + 1);
+  }
+
+  template <typename T>
+  Size EytzingerArray<T>::step(Size a_node, const T& a_element) const {
+    NTL_PREFETCH(m_data + a_node * BLOCK);
+    return 2 * a_node + !(a_element < m_data[a_node]);
+  }
+
+  template <typename T>
+  Size EytzingerArray<T>::lastStep(Size a_node, const T& a_element) const {
+    // the last level may be incomplete, a missing node ends the search where it is
+    const bool exists = a_node <= m_size;
+    const Size child = 2 * a_node + !(a_element < m_data[exists ? a_node : 0]);
+    return exists ? child : a_node;
+  }
+
+  template <typename T>
+  I64 EytzingerArray<T>::result(Size a_node, const T& a_element) const {
+    // the path to the node is encoded in its bits (1 = right), the last right turn was at the
+    // last node not greater than the element, which is the candidate for the last equal one
+    const Size candidate = a_node >> (std::countr_zero(a_node) + 1);
+    if(candidate == 0 || m_data[candidate] < a_element)
+      return -1;
+
+    return static_cast<I64>(m_ranks[candidate]);
+  }
+
+  template <typename T>
+  void EytzingerArray<T>::release() {
+    if(m_data) {
+      memory::Destroy(m_data, m_size + 1);
+      ::operator delete(m_data, ALIGNMENT);
+    }
+    delete[] m_ranks;
+
+    m_data = nullptr;
+    m_ranks = nullptr;
+    m_size = 0;
+    m_height = 0;
+  }
+}
+
+#endif // NTL_EYTZINGER_ARRAY_HPP
@@ -0,0 +1,404 @@
+/**
+* @file HashSet.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_HASH_SET_HPP
+#define NTL_HASH_SET_HPP
+
+#include <iostream>
+#include <type_traits>
+
+#include "core/Algorithms.hpp"
+#include "data/Bool.hpp"
+#include "data/Float.hpp"
+#include "data/Map.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Hash.hpp"
+
+namespace ntl {
+  namespace detail {
+    /**
+     * @brief The value of every key of a hash set, which takes no space in the entries.
+     */
+    struct HashSetValue {
+      bool operator==(const HashSetValue&) const = default;
+    };
+  }
+
+  /**
+   * @brief Constructs a new hash set object.
+   *
+   * @details The set is a Map whose values take no space, so it shares the Robin Hood probing,
+   * the separate distance array and the incremental resizing of the map, while an entry only holds the
+   * key (and its hash if cached).
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam HasherType the hasher used to hash the keys (see hash::Hasher)
+   * @tparam cache_hashes if the full hash should be stored in every entry (see Map)
+   * @tparam Allocator the allocator of the entry and distance arrays (see is_allocator)
+   *
+   * @note Iterators are invalidated by insertions and removals. The set isn't thread-safe.
+   */
+  template <typename KeyType, typename HasherType = hash::Hasher<KeyType>,
+            Bool cache_hashes = !std::is_trivially_copyable_v<KeyType>, typename Allocator = DefaultAllocator>
+  class HashSet {
+    using Table = Map<KeyType, detail::HashSetValue, HasherType, cache_hashes, Allocator>;
+
+  public:
+    /**
+     * @brief Iterator class to simplify iteration over the set.
+     */
+    class Iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = KeyType;
+      using pointer = const KeyType*;
+      using reference = const KeyType&;
+
+    private:
+      const Table* m_table;
+      const typename Table::Entry* m_ptr;
+
+    public:
+      /**
+       * @brief Constructs a new iterator
+       * @param a_ptr the entry of the table
+       * @param a_table the table
+       */
+      Iterator(const typename Table::Entry* a_ptr, const Table* a_table) : m_table(a_table), m_ptr(a_ptr) {}
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the key of the current iteration
+       */
+      reference operator*() const { return m_ptr->key; }
+
+      /**
+       * @brief Overloading pointer operator.
+       * @return the pointer to the key of the current iteration
+       */
+      pointer operator->() const { return &m_ptr->key; }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the reference to the next iterator
+       */
+      Iterator& operator++() {
+        m_ptr = m_table->next(m_ptr);
+        return *this;
+      }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the next iterator
+       */
+      Iterator operator++(int) {
+        Iterator temp = *this;
+        ++(*this);
+        return temp;
+      }
+
+      /**
+       * @brief Overloading equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators are equivalent
+       */
+      friend bool operator==(const Iterator& a_first, const Iterator& a_second) {
+        return a_first.m_ptr == a_second.m_ptr;
+      }
+
+      /**
+       * @brief Overloading anti equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators aren't equivalent
+       */
+      friend bool operator!=(const Iterator& a_first, const Iterator& a_second) {
+        return a_first.m_ptr != a_second.m_ptr;
+      }
+    };
+
+  private:
+    Table m_table;
+
+  public:
+    /**
+     * @brief Constructs a new set with the given parameters (see Map).
+     *
+     * @param a_capacity the initial capacity, rounded up to the next power of two
+     * @param a_algorithm the hashing algorithm to use
+     * @param a_grow_factor the factor of the capacity when to grow the set
+     * @param a_growable if the set is growable (dynamic) or static
+     * @param a_allocator the allocator of the entry and distance arrays
+     */
+    explicit HashSet(Size a_capacity = 1024, algorithms::Hash a_algorithm = algorithms::Hash::FNV1a,
+                     Float a_grow_factor = 0.7, Bool a_growable = true, const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Inserts a key.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key to insert
+     * @return if the key was inserted (false if it already existed)
+     */
+    bool Insert(const KeyType& a_key);
+
+    /**
+     * @brief Inserts a key by moving it into the set.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key to insert
+     * @return if the key was inserted (false if it already existed)
+     */
+    bool Insert(KeyType&& a_key);
+
+    /**
+     * @brief Removes a key.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key to remove
+     * @return if the key was removed (false if it didn't exist)
+     */
+    bool Remove(const KeyType& a_key);
+
+    /**
+     * @brief Checks if the given key exists.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key to check
+     * @return if the key exists
+     */
+    [[nodiscard]] bool Exists(const KeyType& a_key) const;
+
+    /**
+     * @brief Checks if a key equal to the given lookup key exists, without converting it to the key type.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the lookup key (see hash::TransparentKey)
+     * @return if the key exists
+     */
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    [[nodiscard]] bool Exists(const LookupType& a_key) const;
+
+    /**
+     * @brief Makes room for the given number of keys, so inserting them never grows the set.
+     *
+     * @details Runtime: O(n), where n is the size of the set (if the set has to grow).
+     *
+     * @param a_size the number of keys
+     */
+    void Reserve(Size a_size);
+
+    /**
+     * @brief Sets if growing migrates the keys over the following insertions and removals (see Map).
+     *
+     * @param a_incremental if resizing is incremental
+     */
+    void SetIncrementalResize(Bool a_incremental);
+
+    /**
+     * @brief Removes all keys.
+     *
+     * @details Runtime: O(n), where n is the capacity of the set.
+     */
+    void Clear();
+
+    /**
+     * @brief Checks if the set is empty.
+     *
+     * @return if there are no keys
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Gets the number of keys.
+     *
+     * @return the size
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the hashing algorithm used by the hasher.
+     *
+     * @return the algorithm
+     */
+    [[nodiscard]] algorithms::Hash GetAlgorithm() const;
+
+    /**
+     * @brief Converts the set to a string.
+     *
+     * @details Runtime: O(n), where n is the capacity of the set.
+     *
+     * @return the set as string
+     */
+    [[nodiscard]] String ToString() const;
+
+    bool operator==(const HashSet& a_other) const;
+    bool operator!=(const HashSet& a_other) const;
+
+    // ------------------------
+    // ITERATOR-RELATED METHODS
+    // ------------------------
+    Iterator begin() const;
+    Iterator end() const;
+  };
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  typename HashSet<KeyType, HasherType, cache_hashes, Allocator>::Iterator HashSet<KeyType, HasherType, cache_hashes, Allocator>::begin() const {
+    return Iterator(m_table.next(nullptr), &m_table);
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  typename HashSet<KeyType, HasherType, cache_hashes, Allocator>::Iterator HashSet<KeyType, HasherType, cache_hashes, Allocator>::end() const {
+    return Iterator(m_table.last(), &m_table);
+  }
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_set the set
+   * @return the combined ostream
+   */
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const HashSet<KeyType, HasherType, cache_hashes, Allocator>& a_set) {
+    return (a_stream << a_set.ToString());
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  HashSet<KeyType, HasherType, cache_hashes, Allocator>::HashSet(const Size a_capacity, const algorithms::Hash a_algorithm,
+                                                                 const Float a_grow_factor, const Bool a_growable,
+                                                                 const Allocator& a_allocator)
+    : m_table(a_capacity, a_algorithm, a_grow_factor, a_growable, a_allocator) {
+    // Empty
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  bool HashSet<KeyType, HasherType, cache_hashes, Allocator>::Insert(const KeyType& a_key) {
+    if(m_table.find(a_key))
+      return false;
+
+    m_table.insert(KeyType(a_key), detail::HashSetValue{});
+    return true;
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  bool HashSet<KeyType, HasherType, cache_hashes, Allocator>::Insert(KeyType&& a_key) {
+    if(m_table.find(a_key))
+      return false;
+
+    m_table.insert(std::move(a_key), detail::HashSetValue{});
+    return true;
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  bool HashSet<KeyType, HasherType, cache_hashes, Allocator>::Remove(const KeyType& a_key) {
+    auto* entry = m_table.find(a_key);
+    if(!entry)
+      return false;
+
+    m_table.remove(entry);
+    return true;
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  bool HashSet<KeyType, HasherType, cache_hashes, Allocator>::Exists(const KeyType& a_key) const {
+    return m_table.find(a_key) != nullptr;
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  bool HashSet<KeyType, HasherType, cache_hashes, Allocator>::Exists(const LookupType& a_key) const {
+    return m_table.find(a_key) != nullptr;
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void HashSet<KeyType, HasherType, cache_hashes, Allocator>::Reserve(const Size a_size) {
+    m_table.Reserve(a_size);
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void HashSet<KeyType, HasherType, cache_hashes, Allocator>::SetIncrementalResize(const Bool a_incremental) {
+    m_table.SetIncrementalResize(a_incremental);
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void HashSet<KeyType, HasherType, cache_hashes, Allocator>::Clear() {
+    m_table.Clear();
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  bool HashSet<KeyType, HasherType, cache_hashes, Allocator>::IsEmpty() const {
+    return m_table.GetSize() == 0;
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Size HashSet<KeyType, HasherType, cache_hashes, Allocator>::GetSize() const {
+    return m_table.GetSize();
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  algorithms::Hash HashSet<KeyType, HasherType, cache_hashes, Allocator>::GetAlgorithm() const {
+    return m_table.GetAlgorithm();
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  String HashSet<KeyType, HasherType, cache_hashes, Allocator>::ToString() const {
+    Size estimate = 9;
+    for(const KeyType& key : *this)
+      estimate += StringBuilder::Measure(key) + 2;
+
+    StringBuilder builder{estimate};
+    builder.Append("HashSet(");
+
+    for(Iterator it = begin(); it != end(); ++it) {
+      if(it != begin())
+        builder.Append(", ");
+      builder.Append(*it);
+    }
+
+    builder.Append(")");
+    return builder.Build();
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  bool HashSet<KeyType, HasherType, cache_hashes, Allocator>::operator==(const HashSet& a_other) const {
+    if(GetSize() != a_other.GetSize())
+      return false;
+
+    for(const KeyType& key : *this) {
+      if(!a_other.Exists(key))
+        return false;
+    }
+    return true;
+  }
+
+  template <typename KeyType, typename HasherType, Bool cache_hashes, typename Allocator>
+  bool HashSet<KeyType, HasherType, cache_hashes, Allocator>::operator!=(const HashSet& a_other) const {
+    return !(*this == a_other);
+  }
+}
+
+#endif // NTL_HASH_SET_HPP
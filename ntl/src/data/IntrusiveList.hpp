@@ -0,0 +1,617 @@
+/**
+* @file IntrusiveList.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_INTRUSIVE_LIST_HPP
+#define NTL_INTRUSIVE_LIST_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "core/Assert.hpp"
+#include "data/Size.hpp"
+
+namespace ntl {
+  /**
+   * @brief Links an object into an IntrusiveList (embed it as a member of the object).
+   *
+   * @details Copying an object doesn't copy its links, so the copy starts out unlinked.
+   */
+  struct ListHook {
+    ListHook* prev;
+    ListHook* next;
+
+    ListHook() : prev{nullptr}, next{nullptr} {}
+    ListHook(const ListHook&) : ListHook() {}
+    ListHook& operator=(const ListHook&) { return *this; }
+
+    /**
+     * @brief Checks if the hook is linked into a list.
+     * @return if the hook is linked
+     */
+    [[nodiscard]] bool IsLinked() const { return next != nullptr; }
+  };
+
+  /**
+   * @brief Constructs a new doubly linked list of objects linked through their embedded hooks.
+   *
+   * @details The list never allocates and never owns its objects: inserting links the hook of an object and
+   * removing unlinks it in O(1), so an object can be moved within a list (e.g. for LRU caches) or removed
+   * knowing only the object itself. An object has to outlive its membership and can be part of one list per hook.
+   *
+   * @tparam T the type of the linked objects
+   * @tparam Hook the member pointer to the hook of the objects
+   */
+  template<typename T, ListHook T::*Hook>
+  class IntrusiveList {
+    template <bool Const>
+    class BasicIterator;
+
+  public:
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+  private:
+    /**
+     * @brief Iterator class to simplify iteration over the intrusive list.
+     */
+    template <bool Const>
+    class BasicIterator {
+      friend class IntrusiveList;
+      template <bool> friend class BasicIterator;
+
+    public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = T;
+      using pointer = std::conditional_t<Const, const T*, T*>;
+      using reference = std::conditional_t<Const, const T&, T&>;
+
+    private:
+      ListHook* m_hook;
+
+    public:
+      /**
+       * @brief Constructs a new iterator
+       * @param a_hook the hook of the current object (the root of the list for the end)
+       */
+      explicit BasicIterator(const ListHook* a_hook) : m_hook{const_cast<ListHook*>(a_hook)} {}
+
+      /**
+       * @brief Converts a mutable iterator into a constant one.
+       * @param a_other the mutable iterator
+       */
+      template <bool OtherConst>
+        requires(Const && !OtherConst)
+      BasicIterator(const BasicIterator<OtherConst>& a_other) : m_hook{a_other.m_hook} {}
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the reference to the object of the current iteration
+       */
+      reference operator*() const { return *getOwner(m_hook); }
+
+      /**
+       * @brief Overloading pointer operator.
+       * @return the pointer to the object of the current iteration
+       */
+      pointer operator->() const { return getOwner(m_hook); }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the reference to the next iterator
+       */
+      BasicIterator& operator++() {
+        m_hook = m_hook->next;
+        return *this;
+      }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the next iterator
+       */
+      BasicIterator operator++(int) {
+        BasicIterator temp = *this;
+        m_hook = m_hook->next;
+        return temp;
+      }
+
+      /**
+       * @brief Overloading decrement operator.
+       * @return the reference to the previous iterator
+       */
+      BasicIterator& operator--() {
+        m_hook = m_hook->prev;
+        return *this;
+      }
+
+      /**
+       * @brief Overloading decrement operator.
+       * @return the previous iterator
+       */
+      BasicIterator operator--(int) {
+        BasicIterator temp = *this;
+        m_hook = m_hook->prev;
+        return temp;
+      }
+
+      /**
+       * @brief Overloading equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators are equivalent
+       */
+      friend bool operator==(const BasicIterator& a_first, const BasicIterator& a_second) {
+        return a_first.m_hook == a_second.m_hook;
+      }
+
+      /**
+       * @brief Overloading anti equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators aren't equivalent
+       */
+      friend bool operator!=(const BasicIterator& a_first, const BasicIterator& a_second) {
+        return a_first.m_hook != a_second.m_hook;
+      }
+    };
+
+    ListHook m_root;
+    Size m_size;
+
+  public:
+    /**
+     * @brief Constructs a new empty intrusive list.
+     */
+    IntrusiveList();
+
+    /**
+     * @brief Destructs the intrusive list, unlinking all objects.
+     *
+     * @details Runtime: O(n), where n is the size of the list.
+     */
+    ~IntrusiveList();
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    /**
+     * @brief Constructs a new intrusive list by taking over the objects of another one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other list (empty afterwards)
+     */
+    IntrusiveList(IntrusiveList&& a_other) noexcept;
+
+    /**
+     * @brief Overloading move assignment operator, unlinking the current objects first.
+     * @param a_other the list to take the objects from (empty afterwards)
+     * @return the reference of the current list object
+     */
+    IntrusiveList& operator=(IntrusiveList&& a_other) noexcept;
+
+    /**
+     * @brief Links the object at the front of the list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_object the object (mustn't be linked already)
+     */
+    void InsertFront(T& a_object);
+
+    /**
+     * @brief Links the object at the back of the list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_object the object (mustn't be linked already)
+     */
+    void InsertBack(T& a_object);
+
+    /**
+     * @brief Links the object after another one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_position the object in the list after which the object is inserted
+     * @param a_object the object (mustn't be linked already)
+     */
+    void InsertAfter(T& a_position, T& a_object);
+
+    /**
+     * @brief Links the object before another one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_position the object in the list before which the object is inserted
+     * @param a_object the object (mustn't be linked already)
+     */
+    void InsertBefore(T& a_position, T& a_object);
+
+    /**
+     * @brief Unlinks the object from the list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_object the object (has to be linked into this list)
+     */
+    void Remove(T& a_object);
+
+    /**
+     * @brief Unlinks the first object from the list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the object that was unlinked
+     */
+    T& RemoveFront();
+
+    /**
+     * @brief Unlinks the last object from the list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the object that was unlinked
+     */
+    T& RemoveBack();
+
+    /**
+     * @brief Moves an object of the list to its front (e.g. marking it as most recently used).
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_object the object (has to be linked into this list)
+     */
+    void MoveToFront(T& a_object);
+
+    /**
+     * @brief Moves an object of the list to its back.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_object the object (has to be linked into this list)
+     */
+    void MoveToBack(T& a_object);
+
+    /**
+     * @brief Unlinks all objects from the list.
+     *
+     * @details Runtime: O(n), where n is the size of the list.
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the first object.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the first object
+     */
+    T& GetFront() const;
+
+    /**
+     * @brief Gets the last object.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the last object
+     */
+    T& GetBack() const;
+
+    /**
+     * @brief Gets the object after the given one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_object the object in the list
+     * @return the next object (nullptr if the object is the last one)
+     */
+    T* GetNext(const T& a_object) const;
+
+    /**
+     * @brief Gets the object before the given one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_object the object in the list
+     * @return the previous object (nullptr if the object is the first one)
+     */
+    T* GetPrevious(const T& a_object) const;
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the list is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Gets the number of objects in the list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the list
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Checks if the object is linked into a list using this hook.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_object the object
+     * @return if the object is linked
+     */
+    [[nodiscard]] static bool IsLinked(const T& a_object);
+
+    // ------------------------
+    // ITERATOR-RELATED METHODS
+    // ------------------------
+    Iterator begin();
+    Iterator end();
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+  private:
+    /**
+     * @brief Gets the object embedding the given hook.
+     *
+     * @param a_hook the hook
+     * @return the object
+     */
+    static T* getOwner(const ListHook* a_hook);
+
+    /**
+     * @brief Links the hook between two neighbouring hooks.
+     *
+     * @param a_hook the hook to link
+     * @param a_prev the hook in front of the new one
+     * @param a_next the hook after the new one
+     */
+    void link(ListHook* a_hook, ListHook* a_prev, ListHook* a_next);
+
+    /**
+     * @brief Unlinks the hook from its neighbours.
+     *
+     * @param a_hook the hook to unlink
+     */
+    void unlink(ListHook* a_hook);
+
+    /**
+     * @brief Takes over the objects of another list, which has to be empty afterwards.
+     *
+     * @param a_other the other list
+     */
+    void steal(IntrusiveList& a_other);
+  };
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+  template<typename T, ListHook T::*Hook>
+  typename IntrusiveList<T, Hook>::Iterator IntrusiveList<T, Hook>::begin() {
+    return Iterator(m_root.next);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  typename IntrusiveList<T, Hook>::Iterator IntrusiveList<T, Hook>::end() {
+    return Iterator(&m_root);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  typename IntrusiveList<T, Hook>::ConstIterator IntrusiveList<T, Hook>::begin() const {
+    return ConstIterator(m_root.next);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  typename IntrusiveList<T, Hook>::ConstIterator IntrusiveList<T, Hook>::end() const {
+    return ConstIterator(&m_root);
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  template<typename T, ListHook T::*Hook>
+  IntrusiveList<T, Hook>::IntrusiveList()
+    : m_size{0} {
+    m_root.prev = &m_root;
+    m_root.next = &m_root;
+  }
+
+  template<typename T, ListHook T::*Hook>
+  IntrusiveList<T, Hook>::~IntrusiveList() {
+    Clear();
+  }
+
+  template<typename T, ListHook T::*Hook>
+  IntrusiveList<T, Hook>::IntrusiveList(IntrusiveList&& a_other) noexcept
+    : IntrusiveList() {
+    steal(a_other);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  IntrusiveList<T, Hook>& IntrusiveList<T, Hook>::operator=(IntrusiveList&& a_other) noexcept {
+    if(this != &a_other) {
+      Clear();
+      steal(a_other);
+    }
+    return *this;
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::InsertFront(T& a_object) {
+    link(&(a_object.*Hook), &m_root, m_root.next);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::InsertBack(T& a_object) {
+    link(&(a_object.*Hook), m_root.prev, &m_root);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::InsertAfter(T& a_position, T& a_object) {
+    ListHook* position = &(a_position.*Hook);
+    VERIFY(position->IsLinked())
+    link(&(a_object.*Hook), position, position->next);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::InsertBefore(T& a_position, T& a_object) {
+    ListHook* position = &(a_position.*Hook);
+    VERIFY(position->IsLinked())
+    link(&(a_object.*Hook), position->prev, position);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::Remove(T& a_object) {
+    unlink(&(a_object.*Hook));
+  }
+
+  template<typename T, ListHook T::*Hook>
+  T& IntrusiveList<T, Hook>::RemoveFront() {
+    VERIFY(m_size > 0)
+    ListHook* hook = m_root.next;
+    unlink(hook);
+    return *getOwner(hook);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  T& IntrusiveList<T, Hook>::RemoveBack() {
+    VERIFY(m_size > 0)
+    ListHook* hook = m_root.prev;
+    unlink(hook);
+    return *getOwner(hook);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::MoveToFront(T& a_object) {
+    ListHook* hook = &(a_object.*Hook);
+    if(m_root.next != hook) {
+      unlink(hook);
+      link(hook, &m_root, m_root.next);
+    }
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::MoveToBack(T& a_object) {
+    ListHook* hook = &(a_object.*Hook);
+    if(m_root.prev != hook) {
+      unlink(hook);
+      link(hook, m_root.prev, &m_root);
+    }
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::Clear() {
+    ListHook* hook = m_root.next;
+    while(hook != &m_root) {
+      ListHook* next = hook->next;
+      hook->prev = nullptr;
+      hook->next = nullptr;
+      hook = next;
+    }
+
+    m_root.prev = &m_root;
+    m_root.next = &m_root;
+    m_size = 0;
+  }
+
+  template<typename T, ListHook T::*Hook>
+  T& IntrusiveList<T, Hook>::GetFront() const {
+    VERIFY(m_size > 0)
+    return *getOwner(m_root.next);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  T& IntrusiveList<T, Hook>::GetBack() const {
+    VERIFY(m_size > 0)
+    return *getOwner(m_root.prev);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  T* IntrusiveList<T, Hook>::GetNext(const T& a_object) const {
+    const ListHook* next = (a_object.*Hook).next;
+    VERIFY(next != nullptr)
+    return next == &m_root ? nullptr : getOwner(next);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  T* IntrusiveList<T, Hook>::GetPrevious(const T& a_object) const {
+    const ListHook* prev = (a_object.*Hook).prev;
+    VERIFY(prev != nullptr)
+    return prev == &m_root ? nullptr : getOwner(prev);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  bool IntrusiveList<T, Hook>::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  template<typename T, ListHook T::*Hook>
+  Size IntrusiveList<T, Hook>::GetSize() const {
+    return m_size;
+  }
+
+  template<typename T, ListHook T::*Hook>
+  bool IntrusiveList<T, Hook>::IsLinked(const T& a_object) {
+    return (a_object.*Hook).IsLinked();
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+  template<typename T, ListHook T::*Hook>
+  T* IntrusiveList<T, Hook>::getOwner(const ListHook* a_hook) {
+    // the offset of the hook is derived from the member pointer, as offsetof doesn't accept it
+    alignas(T) static constexpr char PROBE[sizeof(T)]{};
+    const T* probe = reinterpret_cast<const T*>(PROBE);
+    const std::uintptr_t offset = reinterpret_cast<std::uintptr_t>(&(probe->*Hook)) - reinterpret_cast<std::uintptr_t>(probe);
+    return reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(a_hook) - offset);
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::link(ListHook* a_hook, ListHook* a_prev, ListHook* a_next) {
+    VERIFY(!a_hook->IsLinked())
+    a_hook->prev = a_prev;
+    a_hook->next = a_next;
+    a_prev->next = a_hook;
+    a_next->prev = a_hook;
+    m_size++;
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::unlink(ListHook* a_hook) {
+    VERIFY(a_hook->IsLinked())
+    a_hook->prev->next = a_hook->next;
+    a_hook->next->prev = a_hook->prev;
+    a_hook->prev = nullptr;
+    a_hook->next = nullptr;
+    m_size--;
+  }
+
+  template<typename T, ListHook T::*Hook>
+  void IntrusiveList<T, Hook>::steal(IntrusiveList& a_other) {
+    if(a_other.m_size == 0)
+      return;
+
+    // the first and last object point to the root of the other list, so they have to be relinked
+    m_root.next = a_other.m_root.next;
+    m_root.prev = a_other.m_root.prev;
+    m_root.next->prev = &m_root;
+    m_root.prev->next = &m_root;
+    m_size = a_other.m_size;
+
+    a_other.m_root.prev = &a_other.m_root;
+    a_other.m_root.next = &a_other.m_root;
+    a_other.m_size = 0;
+  }
+}
+
+#endif // NTL_INTRUSIVE_LIST_HPP
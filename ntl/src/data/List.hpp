@@ -8,26 +8,45 @@
 #ifndef NTL_LIST_HPP
 #define NTL_LIST_HPP
 
+#include <memory>
+#include <new>
+#include <utility>
+
 #include "core/Algorithms.hpp"
 #include "core/Assert.hpp"
 #include "data/Integer.hpp"
 #include "data/Size.hpp"
 #include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Profile.hpp"
 
 namespace ntl {
   /**
    * @brief Constructs a new linked list object.
+   *
+   * @details The nodes are allocated using the given allocator (use PoolAllocator or ArenaAllocator
+   * for lists with a lot of insertions and removals). The head node is part of the list itself.
+   *
    * @tparam T the type of the elements to store
+   * @tparam Allocator the allocator of the nodes (see is_allocator)
    */
-  template<typename T>
+  template<typename T, typename Allocator = DefaultAllocator>
   class List {
   public:
     /**
      * @brief Represents a single element in the linked list.
+     *
+     * @details The value is only constructed for the nodes holding elements, not for the head node.
      */
     struct Node {
-      T value;
+      union {
+        T value;
+      };
       Node* next;
+
+      Node() : next{nullptr} {}
+      ~Node() {}
     };
 
     /**
@@ -102,9 +121,10 @@ namespace ntl {
     };
 
   private:
-    Node *m_head,
-        *m_tail;
+    Node m_head;
+    Node* m_tail;
     Size m_size;
+    [[no_unique_address]] Allocator m_allocator;
 
   public:
     /**
@@ -112,6 +132,13 @@ namespace ntl {
      */
     List();
 
+    /**
+     * @brief Constructs a new linked list allocating its nodes using the given allocator.
+     *
+     * @param a_allocator the allocator
+     */
+    explicit List(const Allocator& a_allocator);
+
     /**
      * @brief Constructs a new linked list from another linked list.
      *
@@ -119,13 +146,36 @@ namespace ntl {
      *
      * @param a_other the other linked list
      */
-    List(const List<T>& a_other);
+    List(const List& a_other);
+
+    /**
+     * @brief Constructs a new linked list by taking over the nodes of another linked list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other linked list (empty afterwards)
+     */
+    List(List&& a_other) noexcept;
 
     /**
      * @brief Destructs the linked list.
      */
     ~List();
 
+    /**
+     * @brief Overloading assignment operator.
+     * @param a_other the linked list to copy
+     * @return the reference of the current linked list object
+     */
+    List& operator=(const List& a_other);
+
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other the linked list to take the nodes from
+     * @return the reference of the current linked list object
+     */
+    List& operator=(List&& a_other) noexcept;
+
     /**
      * @brief Inserts a new element at the front of the linked list.
      *
@@ -135,6 +185,25 @@ namespace ntl {
      */
     const Node* InsertFront(const T& a_element);
 
+    /**
+     * @brief Inserts a new element at the front of the linked list by moving it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_element the element
+     */
+    const Node* InsertFront(T&& a_element);
+
+    /**
+     * @brief Constructs a new element in place at the front of the linked list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     */
+    template <typename... Args>
+    const Node* EmplaceFront(Args&&... a_args);
+
     /**
      * @brief Inserts a new element at the back of the linked list.
      *
@@ -144,6 +213,25 @@ namespace ntl {
      */
     const Node* InsertBack(const T& a_element);
 
+    /**
+     * @brief Inserts a new element at the back of the linked list by moving it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_element the element
+     */
+    const Node* InsertBack(T&& a_element);
+
+    /**
+     * @brief Constructs a new element in place at the back of the linked list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     */
+    template <typename... Args>
+    const Node* EmplaceBack(Args&&... a_args);
+
     /**
      * @brief Inserts a new element after a given node of the linked list.
      *
@@ -154,6 +242,27 @@ namespace ntl {
      */
     const Node* InsertAfter(const Node* a_node, const T& a_element);
 
+    /**
+     * @brief Inserts a new element after a given node of the linked list by moving it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_node the node after which the element is to be inserted
+     * @param a_element the element to insert
+     */
+    const Node* InsertAfter(const Node* a_node, T&& a_element);
+
+    /**
+     * @brief Constructs a new element in place after a given node of the linked list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_node the node after which the element is to be inserted
+     * @param a_args the arguments passed to the constructor of the element
+     */
+    template <typename... Args>
+    const Node* EmplaceAfter(const Node* a_node, Args&&... a_args);
+
     /**
      * @brief Removes a element from the linked list.
      *
@@ -173,6 +282,15 @@ namespace ntl {
      */
     void RemoveAfter(const Node* a_node);
 
+    /**
+     * @brief Removes the first element from the linked list and returns it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the element that was removed (moved out of the node)
+     */
+    T RemoveFront();
+
     /**
      * @brief Removes all elements from the linked list.
      *
@@ -200,7 +318,7 @@ namespace ntl {
      * @param a_other the other linked list to compare with
      * @return if the linked lists are equal
      */
-    bool IsEqual(const List<T>& a_other) const;
+    bool IsEqual(const List& a_other) const;
 
     /**
      * @brief Gets the head node.
@@ -259,6 +377,15 @@ namespace ntl {
      */
     [[nodiscard]] const Node* GetData() const;
 
+    /**
+     * @brief Gets the allocator of the nodes.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the allocator
+     */
+    [[nodiscard]] const Allocator& GetAllocator() const;
+
     /**
      * @brief Overloading equivalence operator.
      * @param a_other the linked list to compare with
@@ -293,19 +420,44 @@ namespace ntl {
      * @return the iterator at the end
      */
     Iterator end();
+
+  private:
+    /**
+     * @brief Allocates a node and constructs its value from the given arguments.
+     *
+     * @param a_next the node following the new one
+     * @param a_args the arguments to construct the value from
+     * @return the new node
+     */
+    template<typename... Args>
+    Node* createNode(Node* a_next, Args&&... a_args);
+
+    /**
+     * @brief Destroys the value of a node and frees it.
+     *
+     * @param a_node the node
+     */
+    void destroyNode(Node* a_node);
+
+    /**
+     * @brief Swaps the nodes and allocators with another linked list.
+     *
+     * @param a_other the other linked list
+     */
+    void swap(List& a_other) noexcept;
   };
 
   // ------------------------
   // ITERATOR-RELATED METHODS
   // ------------------------
 
-  template<typename T>
-  typename List<T>::Iterator List<T>::begin() {
-    return List::Iterator(m_head->next);
+  template<typename T, typename Allocator>
+  typename List<T, Allocator>::Iterator List<T, Allocator>::begin() {
+    return List::Iterator(m_head.next);
   }
 
-  template<typename T>
-  typename List<T>::Iterator List<T>::end() {
+  template<typename T, typename Allocator>
+  typename List<T, Allocator>::Iterator List<T, Allocator>::end() {
     return List::Iterator(m_tail->next);
   }
 
@@ -319,8 +471,8 @@ namespace ntl {
    * @param a_list the list
    * @return the combined ostream
    */
-  template<typename T>
-  std::ostream& operator<<(std::ostream& a_stream, const List<T>& a_list) {
+  template<typename T, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const List<T, Allocator>& a_list) {
     return (a_stream << a_list.ToString());
   }
 
@@ -328,56 +480,78 @@ namespace ntl {
   // PUBLIC METHODS
   // --------------
 
-  template<typename T>
-  List<T>::List()
-    : m_head{new Node}, m_size{0} {
-    m_head->next = nullptr;
-    m_tail = m_head;
+  template<typename T, typename Allocator>
+  List<T, Allocator>::List()
+    : List(Allocator{}) {}
+
+  template<typename T, typename Allocator>
+  List<T, Allocator>::List(const Allocator& a_allocator)
+    : m_head{}, m_tail{&m_head}, m_size{0}, m_allocator{a_allocator} {}
+
+  template<typename T, typename Allocator>
+  List<T, Allocator>::List(const List& a_other)
+    : List(a_other.m_allocator) {
+    for (auto* curr = a_other.m_head.next; curr; curr = curr->next)
+      EmplaceBack(curr->value);
   }
 
-  template<typename T>
-  List<T>::List(const List& a_other)
-    : m_head{new Node}, m_tail{nullptr}, m_size(a_other.m_size) {
-    auto* curr1 = m_head;
-    auto* curr2 = a_other.m_head;
-    while (curr2->next) {
-      curr2 = curr2->next;
-      auto* node = new Node;
-      curr1->next = node;
-      node->next = nullptr;
-      node->value = curr2->value;
-      curr1 = node;
-    }
-    m_tail = curr1;
+  template<typename T, typename Allocator>
+  List<T, Allocator>::List(List&& a_other) noexcept
+    : List(a_other.m_allocator) {
+    swap(a_other);
   }
 
-  template<typename T>
-  List<T>::~List() {
+  template<typename T, typename Allocator>
+  List<T, Allocator>::~List() {
     Clear();
   }
 
-  template<typename T>
-  const typename List<T>::Node* List<T>::InsertFront(const T& a_element) {
-    auto* result = new Node;
+  template<typename T, typename Allocator>
+  List<T, Allocator>& List<T, Allocator>::operator=(const List& a_other) {
+    if (this != &a_other) {
+      Clear();
+      for (auto* curr = a_other.m_head.next; curr; curr = curr->next)
+        InsertBack(curr->value);
+    }
+    return *this;
+  }
 
-    if (!m_head->next)
-      m_tail = result;
+  template<typename T, typename Allocator>
+  List<T, Allocator>& List<T, Allocator>::operator=(List&& a_other) noexcept {
+    swap(a_other);
+    return *this;
+  }
 
-    result->value = a_element;
-    result->next = m_head->next;
-    m_head->next = result;
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::InsertFront(const T& a_element) {
+    return EmplaceFront(a_element);
+  }
 
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::InsertFront(T&& a_element) {
+    return EmplaceFront(std::move(a_element));
+  }
 
-    m_size++;
+  template<typename T, typename Allocator>
+  template<typename... Args>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::EmplaceFront(Args&&... a_args) {
+    return EmplaceAfter(&m_head, std::forward<Args>(a_args)...);
+  }
 
-    return result;
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::InsertBack(const T& a_element) {
+    return EmplaceBack(a_element);
   }
 
-  template<typename T>
-  const typename List<T>::Node* List<T>::InsertBack(const T& a_element) {
-    auto* result = new Node;
-    result->value = a_element;
-    result->next = nullptr;
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::InsertBack(T&& a_element) {
+    return EmplaceBack(std::move(a_element));
+  }
+
+  template<typename T, typename Allocator>
+  template<typename... Args>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::EmplaceBack(Args&&... a_args) {
+    auto* result = createNode(nullptr, std::forward<Args>(a_args)...);
     m_tail->next = result;
     m_tail = result;
 
@@ -386,15 +560,23 @@ namespace ntl {
     return result;
   }
 
-  template<typename T>
-  const typename List<T>::Node* List<T>::InsertAfter(const Node* a_node, const T& a_element) {
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::InsertAfter(const Node* a_node, const T& a_element) {
+    return EmplaceAfter(a_node, a_element);
+  }
+
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::InsertAfter(const Node* a_node, T&& a_element) {
+    return EmplaceAfter(a_node, std::move(a_element));
+  }
+
+  template<typename T, typename Allocator>
+  template<typename... Args>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::EmplaceAfter(const Node* a_node, Args&&... a_args) {
     VERIFY(a_node != nullptr)
 
     auto* node = const_cast<Node*>(a_node);
-    auto* result = new Node;
-
-    result->value = a_element;
-    result->next = node->next;
+    auto* result = createNode(node->next, std::forward<Args>(a_args)...);
 
     if (!node->next)
       m_tail = result;
@@ -406,39 +588,29 @@ namespace ntl {
     return result;
   }
 
-  template<typename T>
-  bool List<T>::RemoveElement(const T& a_element) {
-    auto* curr = m_head;
-    bool success = false;
+  template<typename T, typename Allocator>
+  bool List<T, Allocator>::RemoveElement(const T& a_element) {
+    auto* curr = &m_head;
 
     while (curr->next) {
       if (curr->next->value == a_element) {
-        auto* temp = curr->next->next;
-        delete curr->next;
-        curr->next = temp;
-
-        if (!curr->next)
-          m_tail = curr;
-
-        success = true;
-        break;
+        RemoveAfter(curr);
+        return true;
       }
       curr = curr->next;
     }
 
-    m_size--;
-
-    return success;
+    return false;
   }
 
-  template<typename T>
-  void List<T>::RemoveAfter(const Node* a_node) {
+  template<typename T, typename Allocator>
+  void List<T, Allocator>::RemoveAfter(const Node* a_node) {
     VERIFY(a_node != nullptr)
     VERIFY(a_node->next != nullptr)
 
     auto* node = const_cast<Node*>(a_node);
     auto* temp = node->next->next;
-    delete node->next;
+    destroyNode(node->next);
     node->next = temp;
 
     if (!node->next)
@@ -447,67 +619,73 @@ namespace ntl {
     m_size--;
   }
 
-  template<typename T>
-  void List<T>::Clear() {
-    auto* curr = m_head->next;
+  template<typename T, typename Allocator>
+  T List<T, Allocator>::RemoveFront() {
+    VERIFY(m_head.next != nullptr)
+
+    T result = std::move(m_head.next->value);
+    RemoveAfter(&m_head);
+    return result;
+  }
+
+  template<typename T, typename Allocator>
+  void List<T, Allocator>::Clear() {
+    auto* curr = m_head.next;
 
     while (curr) {
       auto* tmp = curr->next;
-      delete curr;
+      destroyNode(curr);
       curr = tmp;
     }
 
-    m_head->next = nullptr;
+    m_head.next = nullptr;
+    m_tail = &m_head;
     m_size = 0;
   }
 
-  template<typename T>
-  const typename List<T>::Node* List<T>::FindElement(const T& a_element) const {
-    auto* curr = m_head;
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::FindElement(const T& a_element) const {
+    auto* curr = m_head.next;
 
-    while (curr->next) {
+    while (curr && !(curr->value == a_element))
       curr = curr->next;
-      if (curr->value == a_element) {
-        break;
-      }
-    }
 
-    return curr == m_head ? nullptr : curr;
+    return curr;
   }
 
-  template<typename T>
-  const typename List<T>::Node* List<T>::GetHead() const {
-    return m_head;
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::GetHead() const {
+    return &m_head;
   }
 
-  template<typename T>
-  const typename List<T>::Node* List<T>::GetFront() const {
-    return m_head->next;
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::GetFront() const {
+    return m_head.next;
   }
 
-  template<typename T>
-  const typename List<T>::Node* List<T>::GetBack() const {
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::GetBack() const {
     return m_tail;
   }
 
-  template<typename T>
-  bool List<T>::IsEmpty() const {
-    return (!m_head->next);
+  template<typename T, typename Allocator>
+  bool List<T, Allocator>::IsEmpty() const {
+    return (!m_head.next);
   }
 
-  template<typename T>
-  Size List<T>::GetSize() const {
+  template<typename T, typename Allocator>
+  Size List<T, Allocator>::GetSize() const {
     return m_size;
   }
 
-  template<typename T>
-  bool List<T>::IsEqual(const List& a_other) const {
+  template<typename T, typename Allocator>
+  bool List<T, Allocator>::IsEqual(const List& a_other) const {
     if (m_size != a_other.m_size)
       return false;
 
     bool result = true;
-    auto* curr1 = m_head;
-    auto* curr2 = a_other.m_head;
+    auto* curr1 = &m_head;
+    auto* curr2 = &a_other.m_head;
 
     while (curr1->next && curr2->next) {
       if (curr1->next->value != curr2->next->value) {
@@ -522,39 +700,78 @@ namespace ntl {
     return result;
   }
 
-  template<typename T>
-  const typename List<T>::Node* List<T>::GetData() const {
-    return m_head;
+  template<typename T, typename Allocator>
+  const typename List<T, Allocator>::Node* List<T, Allocator>::GetData() const {
+    return &m_head;
+  }
+
+  template<typename T, typename Allocator>
+  const Allocator& List<T, Allocator>::GetAllocator() const {
+    return m_allocator;
   }
 
-  template<typename T>
-  bool List<T>::operator==(const List& a_other) const {
+  template<typename T, typename Allocator>
+  bool List<T, Allocator>::operator==(const List& a_other) const {
     return IsEqual(a_other);
   }
 
-  template<typename T>
-  bool List<T>::operator!=(const List& a_other) const {
+  template<typename T, typename Allocator>
+  bool List<T, Allocator>::operator!=(const List& a_other) const {
     return (!IsEqual(a_other));
   }
 
-  template<typename T>
-  String List<T>::ToString() const {
-    String result = "List(";
-    auto* curr = m_head;
-
-    while (true) {
-      curr = curr->next;
-      result += curr->value;
+  template<typename T, typename Allocator>
+  String List<T, Allocator>::ToString() const {
+    Size estimate = 7;
+    for (auto* curr = m_head.next; curr; curr = curr->next)
+      estimate += StringBuilder::Measure(curr->value) + 2;
 
-      if (!curr->next) {
-        result += ")\n";
-        break;
-      }
+    StringBuilder builder{estimate};
+    builder.Append("List(");
 
-      result += ", ";
+    for (auto* curr = m_head.next; curr; curr = curr->next) {
+      if (curr != m_head.next)
+        builder.Append(", ");
+      builder.Append(curr->value);
     }
 
-    return result;
+    builder.Append(")\n");
+    return builder.Build();
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template<typename T, typename Allocator>
+  template<typename... Args>
+  typename List<T, Allocator>::Node* List<T, Allocator>::createNode(Node* a_next, Args&&... a_args) {
+    auto* node = ::new(memory::Allocate<Node>(m_allocator, 1)) Node;
+    std::construct_at(&node->value, std::forward<Args>(a_args)...);
+    node->next = a_next;
+    NTL_PROFILE_RECORD(profile::RecordListAllocation());
+    return node;
+  }
+
+  template<typename T, typename Allocator>
+  void List<T, Allocator>::destroyNode(Node* a_node) {
+    std::destroy_at(&a_node->value);
+    a_node->~Node();
+    memory::Deallocate(m_allocator, a_node, 1);
+  }
+
+  template<typename T, typename Allocator>
+  void List<T, Allocator>::swap(List& a_other) noexcept {
+    std::swap(m_head.next, a_other.m_head.next);
+    std::swap(m_tail, a_other.m_tail);
+    std::swap(m_size, a_other.m_size);
+    std::swap(m_allocator, a_other.m_allocator);
+
+    // the tail of an empty list is its own head node
+    if (m_tail == &a_other.m_head)
+      m_tail = &m_head;
+    if (a_other.m_tail == &m_head)
+      a_other.m_tail = &a_other.m_head;
   }
 }
 
@@ -0,0 +1,433 @@
+/**
+* @file LruCache.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_LRU_CACHE_HPP
+#define NTL_LRU_CACHE_HPP
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "data/Integer.hpp"
+#include "data/IntrusiveList.hpp"
+#include "data/Map.hpp"
+#include "data/Size.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Hash.hpp"
+
+namespace ntl {
+  /**
+   * @brief Counts the lookups and evictions of a cache.
+   */
+  struct CacheStatistics {
+    U64 hits;
+    U64 misses;
+    U64 evictions;
+  };
+
+  /**
+   * @brief Weighs every entry of a cache as one, so the weight limit counts entries.
+   */
+  struct UnitWeigher {
+    template <typename KeyType, typename ValueType>
+    Size operator()(const KeyType&, const ValueType&) const { return 1; }
+  };
+
+  /**
+   * @brief Constructs a new cache evicting the least recently used entries.
+   *
+   * @details The entries live in nodes linked into an IntrusiveList ordered from the most to the least
+   * recently used one, and a Map finds the node of a key. A hit moves the node to the front of the list and
+   * inserting evicts from its back, so lookups, insertions and evictions are O(1). Besides the number of
+   * entries, the cache can be bounded by the total weight of its entries (e.g. their size in bytes), which
+   * the Weigher computes once per insertion.
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam ValueType the type of the cached values
+   * @tparam HasherType the hasher used to hash the keys (see hash::Hasher)
+   * @tparam Weigher a callable returning the weight of an entry from its key and value (see UnitWeigher)
+   * @tparam Allocator the allocator of the nodes (see is_allocator)
+   */
+  template <typename KeyType, typename ValueType, typename HasherType = hash::Hasher<KeyType>,
+            typename Weigher = UnitWeigher, typename Allocator = PoolAllocator>
+  class LruCache {
+  private:
+    /**
+     * @brief Represents a cached entry, which keeps its address while the map moves its slots.
+     */
+    struct Node {
+      ListHook hook;
+      KeyType key;
+      ValueType value;
+      Size weight;
+    };
+
+    Map<KeyType, Node*, HasherType> m_map;
+    IntrusiveList<Node, &Node::hook> m_list;
+    Size m_capacity,
+         m_max_weight,
+         m_weight;
+    CacheStatistics m_statistics;
+    [[no_unique_address]] Weigher m_weigher;
+    [[no_unique_address]] Allocator m_allocator;
+
+  public:
+    /**
+     * @brief Weight limit of a cache only bounded by its number of entries.
+     */
+    static constexpr Size NO_WEIGHT_LIMIT = std::numeric_limits<Size>::max();
+
+    /**
+     * @brief Constructs a new cache with the given limits.
+     *
+     * @param a_capacity the maximum number of entries
+     * @param a_max_weight the maximum total weight of the entries
+     * @param a_algorithm the hashing algorithm of the map
+     * @param a_weigher the callable weighing the entries
+     * @param a_allocator the allocator of the nodes
+     */
+    explicit LruCache(Size a_capacity, Size a_max_weight = NO_WEIGHT_LIMIT,
+                      algorithms::Hash a_algorithm = algorithms::Hash::FNV1a,
+                      const Weigher& a_weigher = Weigher{}, const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Destructs the cache and its entries.
+     */
+    ~LruCache();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another cache
+     */
+    LruCache(const LruCache& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another cache
+     *
+     * @return the reference to the cache
+     */
+    LruCache& operator=(const LruCache& a_other) = delete;
+
+    /**
+     * @brief Finds the value of the given key and marks it as the most recently used one.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @return the pointer to the value (nullptr on a miss), valid until the entry is evicted or erased
+     */
+    ValueType* Find(const KeyType& a_key);
+
+    /**
+     * @brief Copies the value of the given key and marks it as the most recently used one.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @param a_value receives the value on a hit
+     * @return if the key is cached
+     */
+    bool Get(const KeyType& a_key, ValueType& a_value);
+
+    /**
+     * @brief Finds the value of the given key without touching it or counting the lookup.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @return the pointer to the value (nullptr if the key isn't cached)
+     */
+    const ValueType* Peek(const KeyType& a_key) const;
+
+    /**
+     * @brief Checks if the given key is cached without touching it or counting the lookup.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @return if the key is cached
+     */
+    [[nodiscard]] bool Contains(const KeyType& a_key) const;
+
+    /**
+     * @brief Inserts or replaces the value of the given key as the most recently used entry, evicting the
+     * least recently used entries until both limits are met again.
+     *
+     * @details Runtime: O(1) on average (plus one step per evicted entry)
+     *
+     * @param a_key the key of the entry
+     * @param a_value the value of the entry
+     * @return if the entry is cached (false if its weight alone exceeds the weight limit)
+     */
+    bool Put(KeyType a_key, ValueType a_value);
+
+    /**
+     * @brief Removes the entry of the given key, if it is cached.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @return if an entry was removed
+     */
+    bool Erase(const KeyType& a_key);
+
+    /**
+     * @brief Removes all entries (without counting them as evictions).
+     *
+     * @details Runtime: O(n), where n is the capacity of the map
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of cached entries.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the cache
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the maximum number of entries.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the capacity of the cache
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Gets the total weight of the cached entries.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the weight of the cache
+     */
+    [[nodiscard]] Size GetWeight() const;
+
+    /**
+     * @brief Gets the maximum total weight of the entries.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the weight limit of the cache
+     */
+    [[nodiscard]] Size GetMaxWeight() const;
+
+    /**
+     * @brief Gets the hits, misses and evictions since construction or the last reset.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the statistics of the cache
+     */
+    [[nodiscard]] const CacheStatistics& GetStatistics() const;
+
+    /**
+     * @brief Resets the hits, misses and evictions to zero.
+     *
+     * @details Runtime: O(1)
+     */
+    void ResetStatistics();
+
+    /**
+     * @brief Calls the function for every entry, from the most to the least recently used one.
+     *
+     * @details Runtime: O(n), where n is the size of the cache
+     *
+     * @param a_function the function taking the key and value of an entry
+     */
+    template <typename Function>
+    void ForEach(Function&& a_function) const;
+
+  private:
+    /**
+     * @brief Evicts the least recently used entries until both limits are met.
+     */
+    void evict();
+
+    /**
+     * @brief Unlinks and destroys the given node, removing its key from the map.
+     *
+     * @param a_node the node
+     */
+    void destroyNode(Node* a_node);
+  };
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::LruCache(Size a_capacity, Size a_max_weight,
+                                                                       algorithms::Hash a_algorithm,
+                                                                       const Weigher& a_weigher,
+                                                                       const Allocator& a_allocator)
+    : m_map(std::max(a_capacity, Size{4}) * 2, a_algorithm), m_list(), m_capacity{a_capacity},
+      m_max_weight{a_max_weight}, m_weight{0}, m_statistics{}, m_weigher{a_weigher}, m_allocator{a_allocator} {
+    VERIFY(a_capacity > 0)
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::~LruCache() {
+    Clear();
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  ValueType* LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::Find(const KeyType& a_key) {
+    Node** node = m_map.TryGet(a_key);
+    if(!node) {
+      m_statistics.misses++;
+      return nullptr;
+    }
+
+    m_statistics.hits++;
+    m_list.MoveToFront(**node);
+    return &(*node)->value;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  bool LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::Get(const KeyType& a_key, ValueType& a_value) {
+    const ValueType* value = Find(a_key);
+    if(value)
+      a_value = *value;
+    return value;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  const ValueType* LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::Peek(const KeyType& a_key) const {
+    Node** node = m_map.TryGet(a_key);
+    return node ? &(*node)->value : nullptr;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  bool LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::Contains(const KeyType& a_key) const {
+    return m_map.Exists(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  bool LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::Put(KeyType a_key, ValueType a_value) {
+    const Size weight = m_weigher(std::as_const(a_key), std::as_const(a_value));
+
+    if(Node** existing = m_map.TryGet(a_key)) {
+      Node* node = *existing;
+      if(weight > m_max_weight) {
+        destroyNode(node);
+        return false;
+      }
+
+      node->value = std::move(a_value);
+      m_weight = m_weight - node->weight + weight;
+      node->weight = weight;
+      m_list.MoveToFront(*node);
+      evict();
+      return true;
+    }
+
+    if(weight > m_max_weight)
+      return false;
+
+    auto* node = ::new(memory::Allocate<Node>(m_allocator, 1)) Node{ListHook{}, a_key, std::move(a_value), weight};
+    m_list.InsertFront(*node);
+    // the map displaces entries through the moved value, so it gets a copy of the pointer
+    m_map.Insert(std::move(a_key), static_cast<Node*>(node));
+    m_weight += weight;
+    evict();
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  bool LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::Erase(const KeyType& a_key) {
+    Node** node = m_map.TryGet(a_key);
+    if(!node)
+      return false;
+
+    destroyNode(*node);
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  void LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::Clear() {
+    while(!m_list.IsEmpty()) {
+      Node& node = m_list.RemoveFront();
+      node.~Node();
+      memory::Deallocate(m_allocator, &node, 1);
+    }
+
+    m_map.Clear();
+    m_weight = 0;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  Size LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::GetSize() const {
+    return m_list.GetSize();
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  Size LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::GetCapacity() const {
+    return m_capacity;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  Size LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::GetWeight() const {
+    return m_weight;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  Size LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::GetMaxWeight() const {
+    return m_max_weight;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  const CacheStatistics& LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::GetStatistics() const {
+    return m_statistics;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  void LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::ResetStatistics() {
+    m_statistics = {};
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  template <typename Function>
+  void LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::ForEach(Function&& a_function) const {
+    for(const Node& node : m_list)
+      a_function(node.key, node.value);
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  void LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::evict() {
+    // the most recent entry fits on its own, so it is never evicted
+    while(m_list.GetSize() > m_capacity || m_weight > m_max_weight) {
+      destroyNode(&m_list.GetBack());
+      m_statistics.evictions++;
+    }
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher, typename Allocator>
+  void LruCache<KeyType, ValueType, HasherType, Weigher, Allocator>::destroyNode(Node* a_node) {
+    m_list.Remove(*a_node);
+    m_map.Remove(a_node->key);
+    m_weight -= a_node->weight;
+
+    a_node->~Node();
+    memory::Deallocate(m_allocator, a_node, 1);
+  }
+}
+
+#endif // NTL_LRU_CACHE_HPP
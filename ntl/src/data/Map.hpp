@@ -8,31 +8,88 @@
 #ifndef NTL_MAP_HPP
 #define NTL_MAP_HPP
 
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 #include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
 #include "data/Bool.hpp"
 #include "data/Integer.hpp"
 #include "data/Float.hpp"
 #include "data/Pair.hpp"
 #include "data/Size.hpp"
 #include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Hash.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Profile.hpp"
+#include "utils/Trace.hpp"
 
 namespace ntl {
   /**
    * @brief Constructs a new map object.
-   * @tparam T the type of elements to store
+   *
+   * @details The map uses open addressing with Robin Hood displacement: an entry that
+   * is further away from its home slot than the resident entry takes over the slot.
+   * This keeps the variance of probe lengths low even at high load factors and
+   * allows lookups to stop as soon as they are further away than the resident entry.
+   * The probe distances are kept in their own byte array, so probing never touches
+   * the entries until a candidate slot was found.
+   *
+   * With incremental resizing enabled (see SetIncrementalResize), growing keeps the old table
+   * next to the new one and every insertion or removal migrates a few of its slots, so no
+   * single operation rehashes the whole map. Lookups consult both tables until the migration is done.
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam ValueType the type of elements to store
+   * @tparam HasherType the hasher used to hash the keys (see hash::Hasher)
+   * @tparam cache_hashes if the full hash should be stored in every entry, so resizing never
+   * rehashes and mismatching keys are rejected without comparing them
+   * @tparam Allocator the allocator of the entry and distance arrays (see is_allocator)
    */
-  template <typename KeyType, typename ValueType>
+  template <typename KeyType, typename ValueType, typename HasherType = hash::Hasher<KeyType>,
+            Bool cache_hashes = !std::is_trivially_copyable_v<KeyType>, typename Allocator = DefaultAllocator>
   class Map {
+    template <typename, typename, Bool, typename>
+    friend class HashSet;
+
   private:
+    /**
+     * @brief Placeholder for the hash of an entry when hashes aren't cached.
+     */
+    struct NoHash {};
+
     /**
      * @brief Represents a single entry in the map.
      */
     struct Entry {
       KeyType key;
-      ValueType value;
-      Bool used;
+      // takes no space for empty value types, as used by HashSet
+      [[no_unique_address]] ValueType value;
+      [[no_unique_address]] std::conditional_t<cache_hashes, U64, NoHash> hash;
     };
 
+    /**
+     * @brief The value of an empty slot in the distance array.
+     */
+    static constexpr U8 EMPTY_SLOT = 0;
+
+    /**
+     * @brief The highest probe distance (+1) that can be stored in the distance array.
+     */
+    static constexpr U8 MAX_DISTANCE = 255;
+
+    /**
+     * @brief The number of slots of the old table migrated by every insertion or removal.
+     *
+     * @details Has to exceed 1 / grow factor, so a migration finishes before the new table has to grow.
+     */
+    static constexpr Size MIGRATION_STEP = 32;
+
   public:
     /**
      * @brief Iterator class to simplify iteration over map.
@@ -80,11 +137,7 @@ namespace ntl {
        * @return the reference to the next iterator
        */
       Iterator& operator++() {
-        do {
-          m_ptr++; // always move to next item
-          if (m_ptr >= m_map->m_entries + m_map->m_capacity)
-            break;
-        } while(m_ptr->used == false);
+        m_ptr = m_map->next(m_ptr);
         return *this;
       }
 
@@ -141,26 +194,36 @@ namespace ntl {
 
   private:
     Entry* m_entries;
+    U8* m_distances;
     algorithms::Hash m_algorithm;
     Size m_capacity,
          m_used;
     Float m_grow_factor;
     Bool m_growable;
+    [[no_unique_address]] HasherType m_hasher;
+    [[no_unique_address]] Allocator m_allocator;
+    Bool m_incremental = false;
+    // the table being migrated while an incremental resize is in progress
+    Entry* m_old_entries = nullptr;
+    U8* m_old_distances = nullptr;
+    Size m_old_capacity = 0,
+         m_migrated = 0;
 
   public:
     /**
      * @brief Constructs a new map with the given parameters.
      *
      * The default capacity of the array is 1024 with auto sorting enabled
-     * and automatic resizing disabled.
+     * and automatic resizing disabled. The capacity is rounded up to the next power of two.
      *
      * @param a_capacity the maximum capacity
      * @param a_algorithm the hashing algorithm to use
      * @param a_grow_factor the factor of the capacity when to grow the map
      * @param a_growable if the map is growable (dynamic) or static
+     * @param a_allocator the allocator of the entry and distance arrays
      */
     Map(Size a_capacity = 1024, algorithms::Hash a_algorithm = algorithms::Hash::FNV1a,
-        Float a_grow_factor = 0.7, Bool a_growable = true);
+        Float a_grow_factor = 0.7, Bool a_growable = true, const Allocator& a_allocator = Allocator{});
 
     /**
      * @brief Constructs a new map from another map with double its used size as capacity.
@@ -169,7 +232,7 @@ namespace ntl {
      *
      * @param a_other the other map
      */
-    Map(const Map<KeyType, ValueType>& a_other);
+    Map(const Map& a_other);
 
     /**
      * @brief Constructs a new map from another map with a given capacity.
@@ -179,17 +242,40 @@ namespace ntl {
      * @param a_other the other map
      * @param a_capacity the maximum capacity
      */
-    Map(const Map<KeyType, ValueType>& a_other, Size a_capacity);
+    Map(const Map& a_other, Size a_capacity);
+
+    /**
+     * @brief Constructs a new map by taking over the entries of another map.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other map (empty with no capacity afterwards)
+     */
+    Map(Map&& a_other) noexcept;
 
     /**
      * @brief Destructs the map.
      */
     ~Map();
 
+    /**
+     * @brief Overloading assignment operator.
+     * @param a_other the map to copy
+     * @return the reference of the current map object
+     */
+    Map& operator=(const Map& a_other);
+
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other the map to take the entries from
+     * @return the reference of the current map object
+     */
+    Map& operator=(Map&& a_other) noexcept;
+
     /**
      * @brief Gets the value at the given key or creates the entry.
      *
-     * @details Runtime: O(n), where n is the used size of the map.
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
      *
      * @param a_key the key of the entry
      *
@@ -200,7 +286,7 @@ namespace ntl {
     /**
      * @brief Gets the value at the given key.
      *
-     * @details Runtime: O(n), where n is the used size of the map.
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
      *
      * @param a_key the key of the entry
      *
@@ -211,7 +297,7 @@ namespace ntl {
     /**
      * @brief Finds the iterator corresponding to the given key.
      *
-     * @details Runtime: O(n), where n is the used size of the map.
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
      *
      * @param a_key the key of the entry
      *
@@ -222,31 +308,121 @@ namespace ntl {
     /**
      * @brief Checks if an entry with the given key exists.
      *
-     * @details Runtime: O(n), where n is the used size of the map.
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
      *
      * @param a_key the key to check
      * @return if the entry exists
      */
     Bool Exists(const KeyType& a_key) const;
 
+    /**
+     * @brief Gets a pointer to the value at the given key, probing only once.
+     *
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return the pointer to the value (nullptr if the key doesn't exist), valid until the next modification
+     */
+    ValueType* TryGet(const KeyType& a_key) const;
+
+    /**
+     * @brief Gets the value at the given key or creates the entry, without constructing a key for the lookup.
+     *
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
+     *
+     * @param a_key the key of the entry (e.g. a StringView or c-string for String keys)
+     *
+     * @return the value itself
+     *
+     * @note A key is only constructed if the entry doesn't exist yet.
+     */
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    ValueType& At(const LookupType& a_key);
+
+    /**
+     * @brief Gets the value at the given key, without constructing a key for the lookup.
+     *
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
+     *
+     * @param a_key the key of the entry (e.g. a StringView or c-string for String keys)
+     *
+     * @return the value itself
+     */
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    ValueType& Get(const LookupType& a_key) const;
+
+    /**
+     * @brief Finds the iterator corresponding to the given key, without constructing a key for the lookup.
+     *
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
+     *
+     * @param a_key the key of the entry (e.g. a StringView or c-string for String keys)
+     *
+     * @return the iterator for the entry itself
+     */
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    Iterator Find(const LookupType& a_key) const;
+
+    /**
+     * @brief Checks if an entry with the given key exists, without constructing a key for the lookup.
+     *
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
+     *
+     * @param a_key the key to check (e.g. a StringView or c-string for String keys)
+     * @return if the entry exists
+     */
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    Bool Exists(const LookupType& a_key) const;
+
     /**
      * @brief Inserts an entry with the given key and value.
      *
      * @details Runtime:
-     *  - no resize necessary: O(n), where n is the used size of the map.
-     *  - resize necessary: O(n), where n is the capacity of the map.
+     *  - no resize necessary: O(1) on average, O(n) in the worst case, where n is the used size of the map.
+     *  - resize necessary: O(n), where n is the capacity of the map, O(1) with incremental resizing.
      *
      * @param a_key the key of the new entry
      * @param a_value the value of the new entry
      */
     void Insert(const KeyType& a_key, const ValueType& a_value);
 
+    /**
+     * @brief Inserts an entry with the given key and value by moving them into the map.
+     *
+     * @details Runtime:
+     *  - no resize necessary: O(1) on average, O(n) in the worst case, where n is the used size of the map.
+     *  - resize necessary: O(n), where n is the capacity of the map, O(1) with incremental resizing.
+     *
+     * @param a_key the key of the new entry
+     * @param a_value the value of the new entry
+     */
+    void Insert(KeyType&& a_key, ValueType&& a_value);
+
+    /**
+     * @brief Constructs the value of a new entry from the given arguments, if the key doesn't exist yet.
+     *
+     * @details Runtime:
+     *  - no resize necessary: O(1) on average, O(n) in the worst case, where n is the used size of the map.
+     *  - resize necessary: O(n), where n is the capacity of the map, O(1) with incremental resizing.
+     *
+     * @param a_key the key of the entry
+     * @param a_args the arguments passed to the constructor of the value
+     * @return the value of the new or already existing entry
+     *
+     * @note The value is constructed once and then moved into its slot, as the slots of the
+     * map always hold constructed entries.
+     */
+    template <typename... Args>
+    ValueType& Emplace(const KeyType& a_key, Args&&... a_args);
+
     /**
      * @brief Removes the entry with the given key
      *
-     * @details Runtime: O(n), where n is the used size of the map.
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
      *
      * @param a_key the key of the entry to remove
+     *
+     * @note Uses backward-shift deletion, so no tombstones are left behind.
      */
     void Remove(const KeyType& a_key);
 
@@ -256,9 +432,44 @@ namespace ntl {
      * @details Runtime: O(n), where n is the capacity of the map.
      *
      * @param a_new_capacity the new capacity of the map
+     *
+     * @note Finishes an incremental resize in progress first.
      */
     void Resize(Size a_new_capacity);
 
+    /**
+     * @brief Grows the map so the given number of entries fit without another resize.
+     *
+     * @details Runtime: O(n) if the map has to grow, where n is the capacity of the map, O(1) otherwise.
+     *
+     * @param a_size the number of entries to make room for
+     */
+    void Reserve(Size a_size);
+
+    /**
+     * @brief Sets if growing migrates the entries incrementally instead of all at once.
+     *
+     * @details Runtime: O(1), O(n) if an incremental resize in progress has to be finished
+     * by disabling it, where n is the capacity of the map.
+     *
+     * @param a_incremental if the map should resize incrementally
+     */
+    void SetIncrementalResize(Bool a_incremental);
+
+    /**
+     * @brief Checks if an incremental resize is in progress.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the entries of an old table are still being migrated
+     */
+    [[nodiscard]] Bool IsResizing() const;
+
+    /**
+     * @brief Removes all elements, keeping the table (an old table of an incremental resize is freed).
+     *
+     * @details Runtime: O(n), where n is the capacity of the map
+     */
     void Clear();
 
     /**
@@ -270,6 +481,20 @@ namespace ntl {
      */
     Size GetSize() const;
 
+    /**
+     * @brief Gets the allocator of the entry and distance arrays.
+     *
+     * @return the allocator
+     */
+    [[nodiscard]] const Allocator& GetAllocator() const;
+
+    /**
+     * @brief Gets the hash algorithm passed to hashers accepting one.
+     *
+     * @return the hash algorithm
+     */
+    [[nodiscard]] algorithms::Hash GetAlgorithm() const;
+
     /**
      * @brief Converts the map to a string.
      *
@@ -281,6 +506,10 @@ namespace ntl {
 
     ValueType& operator[](const KeyType& a_key);
     const ValueType& operator[](const KeyType& a_key) const;
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    ValueType& operator[](const LookupType& a_key);
+    template <hash::TransparentKey<HasherType, KeyType> LookupType>
+    const ValueType& operator[](const LookupType& a_key) const;
 
     /**
      * @brief Gets the beginning of the iterator.
@@ -295,161 +524,311 @@ namespace ntl {
 
   private:
     /**
-     * @brief Converts the given key to the corresponding index.
+     * @brief Hashes the given key using the hasher of the map.
      *
-     * @details Runtime: O(n), where n is the length of the key.
+     * @details Runtime: O(1) for integral keys, O(n) for strings, where n is the length of the key.
+     *
+     * @tparam LookupType the type of the key (either KeyType or a transparent lookup type)
+     * @param a_key the key to hash
+     * @return the hash of the key
+     */
+    template <typename LookupType>
+    U64 hashKey(const LookupType& a_key) const;
+    /**
+     * @brief Converts the given hash to the corresponding home slot.
+     *
+     * @details Runtime: O(1)
      *
-     * @param a_key the key to convert
-     * @return the key converted to an index
+     * @param a_hash the hash of a key
+     * @return the index of the home slot
      */
-    Size keyToIndex(const KeyType& a_key) const;
+    Size slot(U64 a_hash) const;
     /**
-     * @brief Finds the entry corresponding to the given key.
+     * @brief Finds the entry corresponding to the given key in the current and the old table.
      *
      * @details Runtime:
      *  - key length > used size of map: O(n), where n is the length of the key.
      *  - key length = used size of map: O(n), where n is the length of the key & used size of the array.
      *  - key length < used size of map: O(n), where n is the used size of the array.
      *
+     * @tparam LookupType the type of the key (either KeyType or a transparent lookup type)
      * @param a_key the key of the entry
      * @return the pointer to the entry
      */
-    Entry* find(const KeyType& a_key) const;
+    template <typename LookupType>
+    Entry* find(const LookupType& a_key) const;
     /**
-     * @brief Calculates the hash of the given key using the given algorithm.
+     * @brief Probes the given table for the entry corresponding to the given key.
      *
-     * @details Runtime: O(n), where n is the length of the key.
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the table.
      *
-     * @param a_algorithm the algorithm to use for hashing
-     * @param a_key the key to hash
-     * @return the hashed key
+     * @tparam LookupType the type of the key (either KeyType or a transparent lookup type)
+     * @param a_entries the entry array of the table
+     * @param a_distances the distance array of the table
+     * @param a_capacity the capacity of the table
+     * @param a_hash the hash of the key
+     * @param a_key the key of the entry
+     * @return the pointer to the entry (nullptr if the key isn't stored in the table)
+     */
+    template <typename LookupType>
+    Entry* probe(Entry* a_entries, const U8* a_distances, Size a_capacity, U64 a_hash, const LookupType& a_key) const;
+    /**
+     * @brief Removes the entry at the given slot of a table using backward-shift deletion.
+     *
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the table.
+     *
+     * @param a_entries the entry array of the table
+     * @param a_distances the distance array of the table
+     * @param a_capacity the capacity of the table
+     * @param a_index the slot of the entry
+     */
+    void erase(Entry* a_entries, U8* a_distances, Size a_capacity, Size a_index);
+    /**
+     * @brief Places an entry that is known to not exist yet using Robin Hood displacement.
+     *
+     * @details Runtime: O(1) on average, O(n) in the worst case, where n is the used size of the map.
+     *
+     * @param a_hash the hash of the key (replaced by the hash of the displaced entry on failure)
+     * @param a_key the key of the entry
+     * @param a_value the value of the entry
+     * @return if the entry was placed (false if the maximum probe distance was exceeded)
+     */
+    Bool place(U64& a_hash, KeyType&& a_key, ValueType&& a_value);
+    /**
+     * @brief Inserts an entry that is known to not exist yet, growing the map if necessary.
+     *
+     * @details Runtime: O(1) on average, O(n) if a resize is necessary, where n is the capacity of the map.
+     *
+     * @param a_key the key of the entry
+     * @param a_value the value of the entry
      */
-    U64 calculateHash(algorithms::Hash a_algorithm, const String& a_key) const;
+    void insert(KeyType&& a_key, ValueType&& a_value);
+    /**
+     * @brief Rehashes the entries of the current table into a new table, leaving an old table untouched.
+     *
+     * @details Runtime: O(n), where n is the capacity of the map.
+     *
+     * @param a_new_capacity the new capacity of the current table
+     */
+    void rehash(Size a_new_capacity);
+    /**
+     * @brief Keeps the current table as the old table to migrate and allocates a new one.
+     *
+     * @details Runtime: O(n), where n is the new capacity.
+     *
+     * @param a_new_capacity the capacity of the new table
+     */
+    void startMigration(Size a_new_capacity);
+    /**
+     * @brief Moves the entries of the next slots of the old table into the current table.
+     *
+     * @details Runtime: O(n), where n is the given number of slots. Frees the old table once it is empty.
+     *
+     * @param a_slots the number of slots to migrate
+     */
+    void migrate(Size a_slots);
+    /**
+     * @brief Migrates all entries left in the old table.
+     *
+     * @details Runtime: O(n), where n is the capacity of the old table.
+     */
+    void finishMigration();
+    /**
+     * @brief Copies the tables of another map with the same capacity, merging its old table.
+     *
+     * @details Runtime: O(n), where n is the capacity of the other map.
+     *
+     * @param a_other the other map
+     */
+    void copy(const Map& a_other);
+    /**
+     * @brief Checks if the given entry belongs to the old table.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_entry a pointer to a stored entry
+     * @return if the entry is in the old table
+     */
+    Bool isOld(const Entry* a_entry) const;
 
     /**
-     * @brief Hashes the given key using the DJB2 algorithm.
+     * @brief Removes the given entry from the table holding it.
      *
-     * @details Runtime: O(n), where n is the length of the key.
+     * @details Runtime: O(1) on average
      *
-     * @param a_key the key to hash
-     * @return the hashed key
+     * @param a_entry the entry
+     */
+    void remove(Entry* a_entry);
+
+    /**
+     * @brief Gets the end of the entries, which is the end of the old table while migrating.
+     *
+     * @return the pointer past the last slot
      */
-    static U64 hashDJB2(const char* a_key);
+    Entry* last() const;
     /**
-     * @brief Hashes the given key using the SDBM algorithm.
+     * @brief Gets the next used slot after the given entry, continuing with the old table.
      *
-     * @details Runtime: O(n), where n is the length of the key.
+     * @details Runtime: O(n), where n is the number of slots skipped.
      *
-     * @param a_key the key to hash
-     * @return the hashed key
+     * @param a_entry a pointer to a stored entry (nullptr to start at the first slot)
+     * @return the pointer to the next entry (or the end)
+     */
+    Entry* next(const Entry* a_entry) const;
+    /**
+     * @brief Allocates empty entry and distance arrays for the current capacity.
+     *
+     * @details Runtime: O(n), where n is the capacity of the map.
+     */
+    void allocate();
+
+    /**
+     * @brief Calls the given body for consecutive chunks of the slots, using the default pool for
+     * tables of at least memory::PARALLEL_TOUCH_SIZE bytes (so their pages are spread over the threads).
+     *
+     * @param a_body a callable taking the first index and the index after the last one of a chunk
      */
-    static U64 hashSDBM(const char* a_key);
+    template <typename Body>
+    void forSlots(const Body& a_body) const;
+
     /**
-     * @brief Hashes the given key using the FNV-1a algorithm.
+     * @brief Destroys the given entries and frees them along with their distances.
      *
-     * @details Runtime: O(n), where n is the length of the key.
+     * @details Runtime: O(n), where n is the given capacity.
      *
-     * @param a_key the key to hash
-     * @return the hashed key
+     * @param a_entries the entry array
+     * @param a_distances the distance array
+     * @param a_capacity the capacity both arrays were allocated with
      */
-    U64 hashFNV1a(const char* a_key) const;
+    void release(Entry* a_entries, U8* a_distances, Size a_capacity);
   };
 
   // --------------
   // PUBLIC METHODS
   // --------------
-  template <typename KeyType, typename ValueType>
-  Map<KeyType, ValueType>::Map(Size a_capacity, algorithms::Hash a_algorithm, Float a_grow_factor,
-                               Bool a_growable)
-    : m_capacity{a_capacity}, m_used{0}, m_algorithm{a_algorithm}, m_grow_factor(a_grow_factor),
-      m_growable(a_growable) {
-    m_entries = new Entry[m_capacity];
-
-    for(int i = 0; i < m_capacity; i++)
-      m_entries[i].used = false;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Map(Size a_capacity, algorithms::Hash a_algorithm, Float a_grow_factor,
+                               Bool a_growable, const Allocator& a_allocator)
+    : m_capacity{std::bit_ceil(a_capacity)}, m_used{0}, m_algorithm{a_algorithm}, m_grow_factor(a_grow_factor),
+      m_growable(a_growable), m_allocator{a_allocator} {
+    VERIFY(a_capacity > 0)
+    allocate();
   }
 
-  template <typename KeyType, typename ValueType>
-  Map<KeyType, ValueType>::Map(const Map<KeyType, ValueType>& a_other)
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Map(const Map& a_other)
     : m_capacity{a_other.m_capacity}, m_used{a_other.m_used}, m_algorithm{a_other.m_algorithm},
-      m_grow_factor(a_other.m_grow_factor), m_growable(a_other.m_growable) {
-    m_entries = new Entry[m_capacity];
-
-    for(Size i = 0; i < m_capacity; ++i)
-      m_entries[i].used = false;
-
-    for(Size i = 0; i < m_capacity; ++i) {
-      if(!a_other.m_entries[i].used)
-        continue;
-
-      Insert(a_other.m_entries[i].key, a_other.m_entries[i].value);
-    }
+      m_grow_factor(a_other.m_grow_factor), m_growable(a_other.m_growable), m_hasher(a_other.m_hasher),
+      m_allocator(a_other.m_allocator), m_incremental(a_other.m_incremental) {
+    copy(a_other);
   }
 
-  template <typename KeyType, typename ValueType>
-  Map<KeyType, ValueType>::Map(const Map<KeyType, ValueType>& a_other, Size a_capacity)
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Map(const Map& a_other, Size a_capacity)
     : m_capacity{a_other.m_capacity}, m_used{a_other.m_used}, m_algorithm{a_other.m_algorithm},
-      m_grow_factor(a_other.m_grow_factor), m_growable(a_other.m_growable) {
-    m_entries = new Entry[m_capacity];
-
-    for(Size i = 0; i < m_capacity; ++i)
-      m_entries[i].used = false;
+      m_grow_factor(a_other.m_grow_factor), m_growable(a_other.m_growable), m_hasher(a_other.m_hasher),
+      m_allocator(a_other.m_allocator), m_incremental(a_other.m_incremental) {
+    copy(a_other);
+    Resize(a_capacity);
+  }
 
-    for(Size i = 0; i < m_capacity; ++i) {
-      if(!a_other.m_entries[i].used)
-        continue;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Map(Map&& a_other) noexcept
+    : m_entries{a_other.m_entries}, m_distances{a_other.m_distances}, m_algorithm{a_other.m_algorithm},
+      m_capacity{a_other.m_capacity}, m_used{a_other.m_used}, m_grow_factor(a_other.m_grow_factor),
+      m_growable(a_other.m_growable), m_hasher(std::move(a_other.m_hasher)), m_allocator(a_other.m_allocator),
+      m_incremental(a_other.m_incremental), m_old_entries{a_other.m_old_entries},
+      m_old_distances{a_other.m_old_distances}, m_old_capacity{a_other.m_old_capacity},
+      m_migrated{a_other.m_migrated} {
+    a_other.m_entries = nullptr;
+    a_other.m_distances = nullptr;
+    a_other.m_capacity = 0;
+    a_other.m_used = 0;
+    a_other.m_old_entries = nullptr;
+    a_other.m_old_distances = nullptr;
+    a_other.m_old_capacity = 0;
+    a_other.m_migrated = 0;
+  }
 
-      Insert(a_other.m_entries[i].key, a_other.m_entries[i].value);
-    }
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::~Map() {
+    release(m_entries, m_distances, m_capacity);
+    release(m_old_entries, m_old_distances, m_old_capacity);
+  }
 
-    Resize(a_capacity);
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::operator=(const Map& a_other) {
+    if(this != &a_other)
+      *this = Map(a_other);
+    return *this;
   }
 
-  template <typename KeyType, typename ValueType>
-  Map<KeyType, ValueType>::~Map() {
-    delete[] m_entries;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::operator=(Map&& a_other) noexcept {
+    std::swap(m_entries, a_other.m_entries);
+    std::swap(m_distances, a_other.m_distances);
+    std::swap(m_algorithm, a_other.m_algorithm);
+    std::swap(m_capacity, a_other.m_capacity);
+    std::swap(m_used, a_other.m_used);
+    std::swap(m_grow_factor, a_other.m_grow_factor);
+    std::swap(m_growable, a_other.m_growable);
+    std::swap(m_hasher, a_other.m_hasher);
+    std::swap(m_allocator, a_other.m_allocator);
+    std::swap(m_incremental, a_other.m_incremental);
+    std::swap(m_old_entries, a_other.m_old_entries);
+    std::swap(m_old_distances, a_other.m_old_distances);
+    std::swap(m_old_capacity, a_other.m_old_capacity);
+    std::swap(m_migrated, a_other.m_migrated);
+    return *this;
   }
 
-  template <typename KeyType, typename ValueType>
-  String Map<KeyType, ValueType>::ToString() const {
-    String result = "Map(";
-    Size appended = 0;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  String Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::ToString() const {
+    const Entry* last = this->last();
 
-    for(Size i = 0; i < m_capacity; ++i) {
-      if(!m_entries[i].used)
-        continue;
+    Size estimate = 5;
+    for(const Entry* entry = next(nullptr); entry != last; entry = next(entry))
+      estimate += StringBuilder::Measure(entry->key) + StringBuilder::Measure(entry->value) + 5;
+
+    StringBuilder builder{estimate};
+    builder.Append("Map(");
+    Size appended = 0;
 
-      result += m_entries[i].key;
-      result += " : ";
-      result.Append(m_entries[i].value);
+    for(const Entry* entry = next(nullptr); entry != last; entry = next(entry)) {
+      builder.Append(entry->key).Append(" : ").Append(entry->value);
       appended++;
 
       if(appended < m_used)
-        result += ", ";
+        builder.Append(", ");
     }
 
-    result += ")";
-
-    return result;
+    builder.Append(")");
+    return builder.Build();
   }
 
-  template<typename KeyType, typename ValueType>
-  ValueType& Map<KeyType, ValueType>::operator[](const KeyType& a_key) {
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  ValueType& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::operator[](const KeyType& a_key) {
     return At(a_key);
   }
 
-  template<typename KeyType, typename ValueType>
-  const ValueType& Map<KeyType, ValueType>::operator[](const KeyType& a_key) const {
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  const ValueType& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::operator[](const KeyType& a_key) const {
     return Get(a_key);
   }
 
-  template <typename KeyType, typename ValueType>
-  Bool Map<KeyType, ValueType>::Exists(const KeyType& a_key) const {
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Bool Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Exists(const KeyType& a_key) const {
     return find(a_key);
   }
 
-  template <typename KeyType, typename ValueType>
-  ValueType& Map<KeyType, ValueType>::At(const KeyType& a_key) {
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  ValueType* Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::TryGet(const KeyType& a_key) const {
+    auto* entry = find(a_key);
+    return entry ? &entry->value : nullptr;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  ValueType& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::At(const KeyType& a_key) {
     auto* entry = find(a_key);
 
     if(!entry) {
@@ -460,15 +839,15 @@ namespace ntl {
     return entry->value;
   }
 
-  template <typename KeyType, typename ValueType>
-  ValueType& Map<KeyType, ValueType>::Get(const KeyType& a_key) const {
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  ValueType& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Get(const KeyType& a_key) const {
     auto* entry = find(a_key);
-    VERIFY(entry && "No entry at key found")
+    ASSUME(entry && "No entry at key found")
     return entry->value;
   }
 
-  template <typename KeyType, typename ValueType>
-  typename Map<KeyType, ValueType>::Iterator Map<KeyType, ValueType>::Find(const KeyType& a_key) const {
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  typename Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Iterator Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Find(const KeyType& a_key) const {
     auto* entry = find(a_key);
     if(!entry)
       return end();
@@ -476,188 +855,510 @@ namespace ntl {
     return {entry, this};
   }
 
-  template <typename KeyType, typename ValueType>
-  void Map<KeyType, ValueType>::Insert(const KeyType& a_key, const ValueType& a_value) {
-    if(m_growable && m_used >= m_capacity * m_grow_factor)
-      Resize(m_capacity * 2);
-
-    int index = keyToIndex(a_key);
-    while(m_entries[index].used) {
-      if(m_entries[index].key == a_key) {
-        m_entries[index].value = a_value;
-        return; // Value replaced, so return early
-      }
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  ValueType& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::At(const LookupType& a_key) {
+    auto* entry = find(a_key);
 
-      index = (index + 1) % m_capacity;
+    if(!entry) {
+      Insert(KeyType(a_key), {});
+      entry = find(a_key);
     }
 
-    m_entries[index].key = a_key;
-    m_entries[index].value = a_value;
-    m_entries[index].used = true;
+    return entry->value;
+  }
 
-    m_used++;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  ValueType& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Get(const LookupType& a_key) const {
+    auto* entry = find(a_key);
+    ASSUME(entry && "No entry at key found")
+    return entry->value;
   }
 
-  template <typename KeyType, typename ValueType>
-  void Map<KeyType, ValueType>::Remove(const KeyType& a_key) {
-    int index = keyToIndex(a_key);
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  typename Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Iterator Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Find(const LookupType& a_key) const {
+    auto* entry = find(a_key);
+    if(!entry)
+      return end();
 
-    while(m_entries[index].used) {
-      if(m_entries[index].key == a_key) {
-        m_entries[index].used = false;
-        m_used--;
-        return;
-      }
-      index = (index + 1) % m_capacity;
+    return {entry, this};
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  Bool Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Exists(const LookupType& a_key) const {
+    return find(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  ValueType& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::operator[](const LookupType& a_key) {
+    return At(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <hash::TransparentKey<HasherType, KeyType> LookupType>
+  const ValueType& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::operator[](const LookupType& a_key) const {
+    return Get(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Insert(const KeyType& a_key, const ValueType& a_value) {
+    auto* entry = find(a_key);
+    if(entry) {
+      entry->value = a_value;
+      return; // Value replaced, so return early
     }
 
-    VERIFY(false && "No entry at key found")
+    KeyType key = a_key;
+    ValueType value = a_value;
+    insert(std::move(key), std::move(value));
   }
 
-  template <typename KeyType, typename ValueType>
-  void Map<KeyType, ValueType>::Resize(Size a_new_capacity) {
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Insert(KeyType&& a_key, ValueType&& a_value) {
+    auto* entry = find(a_key);
+    if(entry) {
+      entry->value = std::move(a_value);
+      return; // Value replaced, so return early
+    }
+
+    insert(std::move(a_key), std::move(a_value));
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <typename... Args>
+  ValueType& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Emplace(const KeyType& a_key, Args&&... a_args) {
+    auto* entry = find(a_key);
+    if(entry)
+      return entry->value;
+
+    insert(KeyType(a_key), ValueType(std::forward<Args>(a_args)...));
+    return find(a_key)->value;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Remove(const KeyType& a_key) {
+    auto* entry = find(a_key);
+    VERIFY(entry && "No entry at key found")
+    if(entry)
+      remove(entry);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Resize(Size a_new_capacity) {
     VERIFY(a_new_capacity >= m_used);
     VERIFY(a_new_capacity > m_capacity)
 
-    int old_capacity = m_capacity;
-    Entry* old_entries = m_entries;
+    // finishing can already grow the current table past the requested capacity
+    finishMigration();
+    if(std::bit_ceil(a_new_capacity) > m_capacity)
+      rehash(a_new_capacity);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Reserve(const Size a_size) {
+    // growing starts once the used size reaches the grow factor of the capacity
+    const Size required = m_growable ? static_cast<Size>(static_cast<Float>(a_size) / m_grow_factor) + 1 : a_size;
+    if(required > m_capacity)
+      Resize(required);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::SetIncrementalResize(const Bool a_incremental) {
+    m_incremental = a_incremental;
+    if(!m_incremental)
+      finishMigration();
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Bool Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::IsResizing() const {
+    return m_old_entries != nullptr;
+  }
 
-    m_capacity = a_new_capacity;
-    m_entries = new Entry[m_capacity];
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::rehash(Size a_new_capacity) {
+    NTL_PROFILE_SCOPE("Map::Resize");
 
-    for(Size i = 0; i < m_capacity; ++i)
-      m_entries[i].used = false;
+    Size old_capacity = m_capacity;
+    Entry* old_entries = m_entries;
+    U8* old_distances = m_distances;
+    NTL_PROFILE_RECORD(profile::RecordMapResize(old_distances, old_capacity));
+
+    m_capacity = std::bit_ceil(a_new_capacity);
+    allocate();
 
     for(Size i = 0; i < old_capacity; ++i) {
-      if(!old_entries[i].used)
+      if(old_distances[i] == EMPTY_SLOT)
         continue;
 
-      int index = keyToIndex(old_entries[i].key);
-      while(m_entries[index].used) {
-        index = (index + 1) % m_capacity;
+      Entry& old = old_entries[i];
+      U64 hash;
+      if constexpr(cache_hashes)
+        hash = old.hash;
+      else
+        hash = hashKey(old.key);
+
+      // a failed placement leaves the displaced entry in the old slot, so it
+      // can simply be retried after growing the new table
+      while(!place(hash, std::move(old.key), std::move(old.value))) {
+        if constexpr(cache_hashes)
+          old.hash = hash;
+        rehash(m_capacity * 2);
       }
-
-      m_entries[index].key = old_entries[i].key;
-      m_entries[index].value = old_entries[i].value;
-      m_entries[index].used = true;
     }
 
-    delete[] old_entries;
+    release(old_entries, old_distances, old_capacity);
   }
 
-  template<typename KeyType, typename ValueType>
-  void Map<KeyType, ValueType>::Clear() {
-    delete[] m_entries;
-
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Clear() {
+    release(m_old_entries, m_old_distances, m_old_capacity);
+    m_old_entries = nullptr;
+    m_old_distances = nullptr;
+    m_old_capacity = 0;
+    m_migrated = 0;
+
+    if(m_used == 0)
+      return;
+
+    // the keys and values are reset on the calling thread, as their allocators might not be thread-safe
+    if constexpr(!std::is_trivially_destructible_v<Entry>) {
+      for(Size i = 0; i < m_capacity; ++i) {
+        if(m_distances[i] != EMPTY_SLOT)
+          m_entries[i] = Entry{};
+      }
+    }
+    forSlots([this](const Size a_from, const Size a_to) {
+      memset(m_distances + a_from, EMPTY_SLOT, (a_to - a_from) * sizeof(U8));
+    });
     m_used = 0;
-    m_entries = new Entry[m_capacity];
-
-    for(int i = 0; i < m_capacity; i++)
-      m_entries[i].used = false;
   }
 
-  template <typename KeyType, typename ValueType>
-  Size Map<KeyType, ValueType>::GetSize() const {
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Size Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::GetSize() const {
     return m_used;
   }
 
-  template <typename KeyType, typename ValueType>
-  typename Map<KeyType, ValueType>::Iterator Map<KeyType, ValueType>::begin() const {
-    Entry* ptr = m_entries;
-    while(!ptr->used && ptr != (m_entries + m_capacity)) ptr++;
-    return Iterator(ptr, this);
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  const Allocator& Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::GetAllocator() const {
+    return m_allocator;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  algorithms::Hash Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::GetAlgorithm() const {
+    return m_algorithm;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  typename Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Iterator Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::begin() const {
+    return Iterator(next(nullptr), this);
   }
 
-  template <typename KeyType, typename ValueType>
-  typename Map<KeyType, ValueType>::Iterator Map<KeyType, ValueType>::end() const {
-    return Iterator(m_entries + m_capacity, this);
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  typename Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Iterator Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::end() const {
+    return Iterator(last(), this);
   }
 
   // ---------------
   // PRIVATE METHODS
   // ---------------
-  template <typename KeyType, typename ValueType>
-  typename Map<KeyType, ValueType>::Entry* Map<KeyType, ValueType>::find(const KeyType& a_key) const {
-    int index = keyToIndex(a_key);
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <typename LookupType>
+  typename Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Entry* Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::find(const LookupType& a_key) const {
+    if(m_used == 0)
+      return nullptr;
+
+    const U64 hash = hashKey(a_key);
+    Entry* entry = probe(m_entries, m_distances, m_capacity, hash, a_key);
+    if(!entry && m_old_entries)
+      entry = probe(m_old_entries, m_old_distances, m_old_capacity, hash, a_key);
+    return entry;
+  }
 
-    while(m_entries[index].used) {
-      if(m_entries[index].key == a_key)
-        return &m_entries[index];
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <typename LookupType>
+  typename Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Entry* Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::probe(
+    Entry* a_entries, const U8* a_distances, const Size a_capacity, const U64 a_hash, const LookupType& a_key) const {
+    Size index = static_cast<Size>(a_hash) & (a_capacity - 1);
+    U8 distance = 1;
+
+    // a resident closer to its home slot than we are to ours means the key isn't stored
+    while(a_distances[index] >= distance) {
+      if(a_distances[index] == distance) {
+        const Entry& entry = a_entries[index];
+        bool found;
+        if constexpr(cache_hashes)
+          found = entry.hash == a_hash && entry.key == a_key;
+        else
+          found = entry.key == a_key;
+
+        if(found) {
+          NTL_PROFILE_RECORD(profile::RecordMapProbe(distance));
+          return &a_entries[index];
+        }
+      }
+
+      if(distance == MAX_DISTANCE)
+        break;
 
-      index = (index + 1) % m_capacity;
+      index = (index + 1) & (a_capacity - 1);
+      distance++;
     }
 
+    NTL_PROFILE_RECORD(profile::RecordMapProbe(distance));
     return nullptr;
   }
 
-  template <typename KeyType, typename ValueType>
-  Size Map<KeyType, ValueType>::keyToIndex(const KeyType& a_key) const {
-    if constexpr(std::is_same<KeyType, String>::value) {
-      return calculateHash(m_algorithm, static_cast<String>(a_key).GetCString()) % m_capacity;
-    } else if constexpr(std::is_same<KeyType, std::string>::value) {
-      return calculateHash(m_algorithm, static_cast<std::string>(a_key).c_str()) % m_capacity;
-    } else if constexpr(std::is_integral<KeyType>::value) {
-      return static_cast<Size>(a_key) % m_capacity;
-    } else {
-      VERIFY(false && "invalid KeyType passed")
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Bool Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::place(U64& a_hash, KeyType&& a_key, ValueType&& a_value) {
+    Size index = slot(a_hash);
+    U8 distance = 1;
+
+    while(true) {
+      if(m_distances[index] == EMPTY_SLOT) {
+        m_entries[index].key = std::move(a_key);
+        m_entries[index].value = std::move(a_value);
+        if constexpr(cache_hashes)
+          m_entries[index].hash = a_hash;
+        m_distances[index] = distance;
+        return true;
+      }
+
+      // Robin Hood: take from the rich (close to home) and give to the poor
+      if(m_distances[index] < distance) {
+        std::swap(m_entries[index].key, a_key);
+        std::swap(m_entries[index].value, a_value);
+        std::swap(m_distances[index], distance);
+        if constexpr(cache_hashes)
+          std::swap(m_entries[index].hash, a_hash);
+        else
+          a_hash = hashKey(a_key);
+      }
+
+      if(distance == MAX_DISTANCE)
+        return false;
+
+      index = (index + 1) & (m_capacity - 1);
+      distance++;
     }
   }
 
-  template <typename KeyType, typename ValueType>
-  U64 Map<KeyType, ValueType>::calculateHash(algorithms::Hash a_algorithm, const String& a_key) const {
-    U64 result;
-    switch(a_algorithm) {
-      case algorithms::Hash::FNV1a:
-        result = hashFNV1a(a_key.GetCString());
-        break;
-      case algorithms::Hash::DJB2:
-        result = hashDJB2(a_key.GetCString());
-        break;
-      case algorithms::Hash::SDBM:
-        result = hashSDBM(a_key.GetCString());
-        break;
-      default:
-        VERIFY(false && "Unknown hashing algorithm");
-        break;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::insert(KeyType&& a_key, ValueType&& a_value) {
+    if(m_old_entries)
+      migrate(MIGRATION_STEP);
+
+    if(m_growable && m_used >= m_capacity * m_grow_factor) {
+      if(m_incremental) {
+        finishMigration();
+        startMigration(m_capacity > 0 ? m_capacity * 2 : 1);
+      } else {
+        Resize(m_capacity > 0 ? m_capacity * 2 : 1);
+      }
+    }
+
+    VERIFY(m_used < m_capacity && "Map is full")
+
+    U64 hash = hashKey(a_key);
+    while(!place(hash, std::move(a_key), std::move(a_value))) {
+      // the probe sequence got too long, so the displaced entry is carried over into a bigger table
+      VERIFY(m_growable && "Maximum probe distance exceeded")
+      rehash(m_capacity * 2);
+    }
+
+    m_used++;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::erase(Entry* a_entries, U8* a_distances,
+                                                                           const Size a_capacity, Size a_index) {
+    // shift the following entries of the cluster one slot back until an entry is
+    // found that is either empty or already sitting in its home slot
+    Size next = (a_index + 1) & (a_capacity - 1);
+
+    while(a_distances[next] > 1) {
+      a_entries[a_index] = std::move(a_entries[next]);
+      a_distances[a_index] = a_distances[next] - 1;
+      a_index = next;
+      next = (next + 1) & (a_capacity - 1);
+    }
+
+    a_entries[a_index] = Entry{};
+    a_distances[a_index] = EMPTY_SLOT;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::startMigration(const Size a_new_capacity) {
+    NTL_PROFILE_RECORD(profile::RecordMapResize(m_distances, m_capacity));
+
+    m_old_entries = m_entries;
+    m_old_distances = m_distances;
+    m_old_capacity = m_capacity;
+    m_migrated = 0;
+
+    m_capacity = std::bit_ceil(a_new_capacity);
+    allocate();
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::migrate(const Size a_slots) {
+    const Size last = std::min(m_migrated + a_slots, m_old_capacity);
+
+    // taking entries out by backward-shift deletion keeps the rest of the old table probeable,
+    // and a shift never refills a migrated slot as the cluster ends at the empty slot before it
+    for(; m_migrated < last; ++m_migrated) {
+      while(m_old_distances[m_migrated] != EMPTY_SLOT) {
+        Entry& old = m_old_entries[m_migrated];
+        U64 hash;
+        if constexpr(cache_hashes)
+          hash = old.hash;
+        else
+          hash = hashKey(old.key);
+
+        KeyType key = std::move(old.key);
+        ValueType value = std::move(old.value);
+        erase(m_old_entries, m_old_distances, m_old_capacity, m_migrated);
+
+        while(!place(hash, std::move(key), std::move(value)))
+          rehash(m_capacity * 2);
+      }
+    }
+
+    if(m_migrated == m_old_capacity) {
+      release(m_old_entries, m_old_distances, m_old_capacity);
+      m_old_entries = nullptr;
+      m_old_distances = nullptr;
+      m_old_capacity = 0;
+      m_migrated = 0;
     }
+  }
 
-    return result;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::finishMigration() {
+    if(m_old_entries)
+      migrate(m_old_capacity);
   }
 
-  template <typename KeyType, typename ValueType>
-  U64 Map<KeyType, ValueType>::hashDJB2(const char* a_key) {
-    U64 hash = 5381;
-    int c;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::copy(const Map& a_other) {
+    allocate();
+
+    // same capacity and hashing, so the layout can be copied slot by slot
+    memcpy(m_distances, a_other.m_distances, m_capacity * sizeof(U8));
+    for(Size i = 0; i < m_capacity; ++i) {
+      if(m_distances[i] != EMPTY_SLOT)
+        m_entries[i] = a_other.m_entries[i];
+    }
 
-    while((c = static_cast<unsigned char>(*(a_key++))))
-      hash = ((hash << 5) + hash) + c;
+    for(Size i = 0; i < a_other.m_old_capacity; ++i) {
+      if(a_other.m_old_distances[i] == EMPTY_SLOT)
+        continue;
 
-    return hash;
+      const Entry& old = a_other.m_old_entries[i];
+      U64 hash;
+      if constexpr(cache_hashes)
+        hash = old.hash;
+      else
+        hash = hashKey(old.key);
+
+      KeyType key = old.key;
+      ValueType value = old.value;
+      while(!place(hash, std::move(key), std::move(value)))
+        rehash(m_capacity * 2);
+    }
   }
 
-  template <typename KeyType, typename ValueType>
-  U64 Map<KeyType, ValueType>::hashSDBM(const char* a_key) {
-    U64 hash = 0;
-    int c;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Bool Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::isOld(const Entry* a_entry) const {
+    return m_old_entries && a_entry >= m_old_entries && a_entry < m_old_entries + m_old_capacity;
+  }
 
-    while((c = static_cast<unsigned char>(*(a_key++))))
-      hash = c + (hash << 6) + (hash << 16) - hash;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::remove(Entry* a_entry) {
+    if(isOld(a_entry))
+      erase(m_old_entries, m_old_distances, m_old_capacity, a_entry - m_old_entries);
+    else
+      erase(m_entries, m_distances, m_capacity, a_entry - m_entries);
+    m_used--;
 
-    return ((hash & 0x7FFFFFFFFFFFFFFF) | 1);
+    if(m_old_entries)
+      migrate(MIGRATION_STEP);
   }
 
-  template <typename KeyType, typename ValueType>
-  U64 Map<KeyType, ValueType>::hashFNV1a(const char* a_key) const {
-    const size_t FNV_prime = 1099511628211ULL;
-    const size_t FNV_offset = 14695981039346656037ULL;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  typename Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Entry* Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::last() const {
+    return m_old_entries ? m_old_entries + m_old_capacity : m_entries + m_capacity;
+  }
 
-    U64 hash = FNV_offset;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  typename Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::Entry* Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::next(
+    const Entry* a_entry) const {
+    Size index = 0;
+    if(a_entry && isOld(a_entry)) {
+      index = a_entry - m_old_entries + 1;
+      while(index < m_old_capacity && m_old_distances[index] == EMPTY_SLOT)
+        index++;
+      return m_old_entries + index;
+    }
 
-    int c;
-    while((c = static_cast<unsigned char>(*(a_key++))))
-      hash = (hash ^ c) * FNV_prime;
+    if(a_entry)
+      index = a_entry - m_entries + 1;
+    while(index < m_capacity && m_distances[index] == EMPTY_SLOT)
+      index++;
+    if(index < m_capacity || !m_old_entries)
+      return m_entries + index;
+
+    // the old table is iterated after the current one
+    index = 0;
+    while(index < m_old_capacity && m_old_distances[index] == EMPTY_SLOT)
+      index++;
+    return m_old_entries + index;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::allocate() {
+    m_entries = memory::Allocate<Entry>(m_allocator, m_capacity);
+    m_distances = memory::Allocate<U8>(m_allocator, m_capacity);
+    forSlots([this](const Size a_from, const Size a_to) {
+      std::uninitialized_default_construct_n(m_entries + a_from, a_to - a_from);
+      memset(m_distances + a_from, EMPTY_SLOT, (a_to - a_from) * sizeof(U8));
+    });
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <typename Body>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::forSlots(const Body& a_body) const {
+    // small tables don't start the default pool
+    if(m_capacity * sizeof(Entry) >= memory::PARALLEL_TOUCH_SIZE)
+      parallel::For(0, m_capacity, a_body);
+    else
+      a_body(0, m_capacity);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  void Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::release(Entry* a_entries, U8* a_distances,
+                                                                             Size a_capacity) {
+    if(a_entries)
+      std::destroy_n(a_entries, a_capacity);
+    memory::Deallocate(m_allocator, a_entries, a_capacity);
+    memory::Deallocate(m_allocator, a_distances, a_capacity);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  template <typename LookupType>
+  U64 Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::hashKey(const LookupType& a_key) const {
+    if constexpr(std::is_invocable_r_v<U64, const HasherType&, const LookupType&, algorithms::Hash>)
+      return m_hasher(a_key, m_algorithm);
+    else
+      return m_hasher(a_key);
+  }
 
-    return hash;
+  template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+  Size Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>::slot(U64 a_hash) const {
+    return static_cast<Size>(a_hash) & (m_capacity - 1);
   }
 }
 
@@ -0,0 +1,319 @@
+/**
+* @file MappedArray.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_MAPPED_ARRAY_HPP
+#define NTL_MAPPED_ARRAY_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "data/Array.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "data/StringView.hpp"
+#include "os/MappedFile.hpp"
+#include "os/Persist.hpp"
+#include "utils/Scan.hpp"
+#include "utils/Search.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new read-only view of an array persisted with persist::Save.
+   *
+   * @details The elements are used directly from the mapped file, so opening doesn't copy anything and
+   * the pages are read on first access.
+   *
+   * @tparam T the type of the elements (has to be trivially copyable)
+   */
+  template <typename T>
+  class MappedArray {
+    CVERIFY(std::is_trivially_copyable_v<T> && "only trivially copyable elements can be mapped")
+    CVERIFY(alignof(T) <= persist::ALIGNMENT && "the sections of a file aren't aligned any stricter")
+
+  private:
+    MappedFile m_file;
+    const T* m_data;
+    Size m_size;
+    bool m_sorted;
+
+  public:
+    /**
+     * @brief Constructs a new view that isn't open yet.
+     *
+     * @details Runtime: O(1)
+     */
+    MappedArray();
+
+    /**
+     * @brief Destroys the view, unmapping its file.
+     *
+     * @details Runtime: O(1)
+     */
+    ~MappedArray() = default;
+
+    MappedArray(const MappedArray&) = delete;
+    MappedArray(MappedArray&& a_other) noexcept;
+    MappedArray& operator=(const MappedArray&) = delete;
+    MappedArray& operator=(MappedArray&& a_other) noexcept;
+
+    /**
+     * @brief Maps the given file, closing the current one first.
+     *
+     * @details Runtime: O(1) (O(n) if verifying, where n is the size of the file)
+     *
+     * @param a_path the path of the file
+     * @param a_verify if the checksum of the elements should be verified
+     * @return false if the file couldn't be mapped or doesn't hold an array of T, otherwise true
+     */
+    bool Open(StringView a_path, bool a_verify = false);
+
+    /**
+     * @brief Unmaps the file.
+     *
+     * @details Runtime: O(1)
+     */
+    void Close();
+
+    /**
+     * @brief Finds the index of the given element.
+     *
+     * @details Runtime: O(log n) if sorted, otherwise O(n), where n is the size of the array.
+     *
+     * @param a_element the element to find
+     * @return the index of the element (-1 if not found)
+     */
+    I64 Find(const T& a_element) const;
+
+    /**
+     * @brief Checks if the array contains the given element.
+     *
+     * @details Runtime: O(log n) if sorted, otherwise O(n), where n is the size of the array.
+     *
+     * @param a_element the element to find
+     * @return if the element was found
+     */
+    [[nodiscard]] bool Contains(const T& a_element) const;
+
+    /**
+     * @brief Gets the element at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the element
+     * @return the element
+     */
+    const T& Get(Size a_index) const;
+
+    /**
+     * @brief Checks if a file is mapped.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if a file is mapped
+     */
+    [[nodiscard]] bool IsOpen() const;
+
+    /**
+     * @brief Checks if the array was sorted when it was saved.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the array is sorted
+     */
+    [[nodiscard]] bool IsSorted() const;
+
+    /**
+     * @brief Checks if the array is empty.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the array is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Gets the number of elements.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the array
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the first element of the mapped array.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the first element
+     */
+    [[nodiscard]] const T* GetData() const;
+
+    const T& operator[](Size a_index) const;
+
+    // ------------------------
+    // ITERATOR-RELATED METHODS
+    // ------------------------
+    const T* begin() const;
+    const T* end() const;
+  };
+
+  namespace persist {
+    /**
+     * @brief Saves the elements of the given array, so they can be mapped by MappedArray.
+     *
+     * @details Runtime: O(n), where n is the size of the array.
+     *
+     * @param a_array the array to save
+     * @param a_path the path of the file (replaced atomically)
+     * @return false if the file couldn't be written, otherwise true
+     */
+    template <typename T, typename Allocator>
+    bool Save(const Array<T, Allocator>& a_array, StringView a_path);
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  template <typename T>
+  MappedArray<T>::MappedArray()
+    : m_file{}, m_data{nullptr}, m_size{0}, m_sorted{false} {
+    // Empty
+  }
+
+  template <typename T>
+  MappedArray<T>::MappedArray(MappedArray&& a_other) noexcept
+    : m_file{std::move(a_other.m_file)}, m_data{std::exchange(a_other.m_data, nullptr)},
+      m_size{std::exchange(a_other.m_size, 0)}, m_sorted{std::exchange(a_other.m_sorted, false)} {
+    // Empty
+  }
+
+  template <typename T>
+  MappedArray<T>& MappedArray<T>::operator=(MappedArray&& a_other) noexcept {
+    if(this != &a_other) {
+      m_file = std::move(a_other.m_file);
+      m_data = std::exchange(a_other.m_data, nullptr);
+      m_size = std::exchange(a_other.m_size, 0);
+      m_sorted = std::exchange(a_other.m_sorted, false);
+    }
+    return *this;
+  }
+
+  template <typename T>
+  bool MappedArray<T>::Open(const StringView a_path, const bool a_verify) {
+    Close();
+    if(!m_file.Open(a_path))
+      return false;
+
+    const persist::Header* header = persist::Validate(m_file, persist::Kind::ARRAY, sizeof(T), 0, a_verify);
+    if(header == nullptr || header->section_count != 1 || header->sections[0].size != header->count * sizeof(T)) {
+      m_file.Close();
+      return false;
+    }
+
+    m_data = reinterpret_cast<const T*>(persist::GetSection(m_file, *header, 0));
+    m_size = header->count;
+    m_sorted = (header->flags & persist::SORTED) != 0;
+    return true;
+  }
+
+  template <typename T>
+  void MappedArray<T>::Close() {
+    m_file.Close();
+    m_data = nullptr;
+    m_size = 0;
+    m_sorted = false;
+  }
+
+  template <typename T>
+  I64 MappedArray<T>::Find(const T& a_element) const {
+    if(m_sorted)
+      return search::Find(m_data, m_size, a_element);
+    if constexpr(scan::scannable<T>) {
+      return scan::FindFrontBack(m_data, m_size, a_element);
+    } else {
+      for(Size i = 0; i < m_size; ++i)
+        if(m_data[i] == a_element)
+          return static_cast<I64>(i);
+      return -1;
+    }
+  }
+
+  template <typename T>
+  bool MappedArray<T>::Contains(const T& a_element) const {
+    return Find(a_element) >= 0;
+  }
+
+  template <typename T>
+  const T& MappedArray<T>::Get(const Size a_index) const {
+    VERIFY(a_index < m_size)
+    return m_data[a_index];
+  }
+
+  template <typename T>
+  bool MappedArray<T>::IsOpen() const {
+    return m_file.IsOpen();
+  }
+
+  template <typename T>
+  bool MappedArray<T>::IsSorted() const {
+    return m_sorted;
+  }
+
+  template <typename T>
+  bool MappedArray<T>::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  template <typename T>
+  Size MappedArray<T>::GetSize() const {
+    return m_size;
+  }
+
+  template <typename T>
+  const T* MappedArray<T>::GetData() const {
+    return m_data;
+  }
+
+  template <typename T>
+  const T& MappedArray<T>::operator[](const Size a_index) const {
+    return Get(a_index);
+  }
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+  template <typename T>
+  const T* MappedArray<T>::begin() const {
+    return m_data;
+  }
+
+  template <typename T>
+  const T* MappedArray<T>::end() const {
+    return m_data + m_size;
+  }
+
+  namespace persist {
+    template <typename T, typename Allocator>
+    bool Save(const Array<T, Allocator>& a_array, const StringView a_path) {
+      CVERIFY(std::is_trivially_copyable_v<T> && "only trivially copyable elements can be saved")
+
+      Header header{};
+      header.kind = Kind::ARRAY;
+      header.flags = a_array.IsSorted() ? SORTED : NONE;
+      header.element_size = sizeof(T);
+      header.count = a_array.GetSize();
+      header.capacity = a_array.GetSize();
+
+      const Block block{a_array.GetData(), a_array.GetSize() * sizeof(T)};
+      return Write(a_path, header, &block, 1);
+    }
+  }
+}
+
+#endif // NTL_MAPPED_ARRAY_HPP
@@ -0,0 +1,89 @@
+/**
+* @file MappedBitset.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "MappedBitset.hpp"
+
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "utils/Bits.hpp"
+
+namespace ntl {
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  MappedBitset::MappedBitset()
+    : m_file{}, m_words{nullptr}, m_capacity{0}, m_word_count{0} {
+    // Empty
+  }
+
+  MappedBitset::MappedBitset(MappedBitset&& a_other) noexcept
+    : m_file{std::move(a_other.m_file)}, m_words{std::exchange(a_other.m_words, nullptr)},
+      m_capacity{std::exchange(a_other.m_capacity, 0)}, m_word_count{std::exchange(a_other.m_word_count, 0)} {
+    // Empty
+  }
+
+  MappedBitset& MappedBitset::operator=(MappedBitset&& a_other) noexcept {
+    if(this != &a_other) {
+      m_file = std::move(a_other.m_file);
+      m_words = std::exchange(a_other.m_words, nullptr);
+      m_capacity = std::exchange(a_other.m_capacity, 0);
+      m_word_count = std::exchange(a_other.m_word_count, 0);
+    }
+    return *this;
+  }
+
+  bool MappedBitset::Open(const StringView a_path, const bool a_verify) {
+    Close();
+    if(!m_file.Open(a_path))
+      return false;
+
+    const persist::Header* header = persist::Validate(m_file, persist::Kind::BITSET, sizeof(U64), 0, a_verify);
+    if(header == nullptr || header->section_count != 1 || header->capacity != bits::WordCount(header->count) ||
+       header->sections[0].size != header->capacity * sizeof(U64)) {
+      m_file.Close();
+      return false;
+    }
+
+    m_words = reinterpret_cast<const U64*>(persist::GetSection(m_file, *header, 0));
+    m_capacity = header->count;
+    m_word_count = header->capacity;
+    return true;
+  }
+
+  void MappedBitset::Close() {
+    m_file.Close();
+    m_words = nullptr;
+    m_capacity = 0;
+    m_word_count = 0;
+  }
+
+  bool MappedBitset::IsSet(const Size a_index) const {
+    VERIFY(a_index < m_capacity)
+    return (m_words[a_index / bits::WORD_BITS] >> (a_index % bits::WORD_BITS)) & 1;
+  }
+
+  Size MappedBitset::GetCount() const {
+    return bits::PopCount(m_words, m_word_count);
+  }
+
+  bool MappedBitset::IsOpen() const {
+    return m_file.IsOpen();
+  }
+
+  Size MappedBitset::GetCapacity() const {
+    return m_capacity;
+  }
+
+  Size MappedBitset::GetWordCount() const {
+    return m_word_count;
+  }
+
+  const U64* MappedBitset::GetWords() const {
+    return m_words;
+  }
+}
@@ -0,0 +1,151 @@
+/**
+* @file MappedBitset.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_MAPPED_BITSET_HPP
+#define NTL_MAPPED_BITSET_HPP
+
+#include "data/Bitset.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "data/StringView.hpp"
+#include "os/MappedFile.hpp"
+#include "os/Persist.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new read-only view of a packed bitset persisted with persist::Save.
+   *
+   * @details The words are used directly from the mapped file, so the capacity is only known at runtime.
+   */
+  class MappedBitset {
+  private:
+    MappedFile m_file;
+    const U64* m_words;
+    Size m_capacity,
+        m_word_count;
+
+  public:
+    /**
+     * @brief Constructs a new view that isn't open yet.
+     *
+     * @details Runtime: O(1)
+     */
+    MappedBitset();
+
+    /**
+     * @brief Destroys the view, unmapping its file.
+     *
+     * @details Runtime: O(1)
+     */
+    ~MappedBitset() = default;
+
+    MappedBitset(const MappedBitset&) = delete;
+    MappedBitset(MappedBitset&& a_other) noexcept;
+    MappedBitset& operator=(const MappedBitset&) = delete;
+    MappedBitset& operator=(MappedBitset&& a_other) noexcept;
+
+    /**
+     * @brief Maps the given file, closing the current one first.
+     *
+     * @details Runtime: O(1) (O(n) if verifying, where n is the size of the file)
+     *
+     * @param a_path the path of the file
+     * @param a_verify if the checksum of the words should be verified
+     * @return false if the file couldn't be mapped or doesn't hold a bitset, otherwise true
+     */
+    bool Open(StringView a_path, bool a_verify = false);
+
+    /**
+     * @brief Unmaps the file.
+     *
+     * @details Runtime: O(1)
+     */
+    void Close();
+
+    /**
+     * @brief Checks if the bit at the given index is set.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the bit
+     * @return if the bit is set
+     */
+    [[nodiscard]] bool IsSet(Size a_index) const;
+
+    /**
+     * @brief Counts the set bits.
+     *
+     * @details Runtime: O(n), where n is the number of words.
+     *
+     * @return the number of set bits
+     */
+    [[nodiscard]] Size GetCount() const;
+
+    /**
+     * @brief Checks if a file is mapped.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if a file is mapped
+     */
+    [[nodiscard]] bool IsOpen() const;
+
+    /**
+     * @brief Gets the number of bits.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the capacity of the bitset
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Gets the number of words.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the number of words
+     */
+    [[nodiscard]] Size GetWordCount() const;
+
+    /**
+     * @brief Gets the words of the mapped bitset (bit i is bit i % 64 of word i / 64).
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the first word
+     */
+    [[nodiscard]] const U64* GetWords() const;
+  };
+
+  namespace persist {
+    /**
+     * @brief Saves the words of the given bitset, so they can be mapped by MappedBitset.
+     *
+     * @details Runtime: O(n), where n is the number of words.
+     *
+     * @param a_bitset the bitset to save
+     * @param a_path the path of the file (replaced atomically)
+     * @return false if the file couldn't be written, otherwise true
+     */
+    template <Size capacity, typename Allocator>
+    bool Save(const Bitset<capacity, BitsetStorage::PACKED, Allocator>& a_bitset, const StringView a_path) {
+      constexpr Size WORD_COUNT = bits::WordCount(capacity);
+
+      Header header{};
+      header.kind = Kind::BITSET;
+      header.element_size = sizeof(U64);
+      header.count = capacity;
+      header.capacity = WORD_COUNT;
+
+      const Block block{a_bitset.GetWords(), WORD_COUNT * sizeof(U64)};
+      return Write(a_path, header, &block, 1);
+    }
+  }
+}
+
+#endif // NTL_MAPPED_BITSET_HPP
@@ -0,0 +1,446 @@
+/**
+* @file MappedMap.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_MAPPED_MAP_HPP
+#define NTL_MAPPED_MAP_HPP
+
+#include <bit>
+#include <type_traits>
+#include <utility>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "data/Array.hpp"
+#include "data/Bool.hpp"
+#include "data/Integer.hpp"
+#include "data/Map.hpp"
+#include "data/Size.hpp"
+#include "data/StringView.hpp"
+#include "os/MappedFile.hpp"
+#include "os/Persist.hpp"
+#include "utils/Hash.hpp"
+
+namespace ntl {
+  namespace persist {
+    namespace detail {
+      /**
+       * @brief Marks a slot of a persisted table as empty (occupied slots store their probe distance + 1).
+       */
+      constexpr U8 EMPTY_SLOT = 0;
+
+      /**
+       * @brief Maximum probe distance of a persisted table, the table grows when it would be exceeded.
+       */
+      constexpr U8 MAX_DISTANCE = 255;
+
+      /**
+       * @brief Hashes the given key the same way Map does.
+       *
+       * @param a_hasher the hasher
+       * @param a_key the key to hash
+       * @param a_algorithm the hash algorithm passed to hashers accepting one
+       * @return the hash of the key
+       */
+      template <typename HasherType, typename KeyType>
+      U64 HashKey(const HasherType& a_hasher, const KeyType& a_key, const algorithms::Hash a_algorithm) {
+        if constexpr(std::is_invocable_r_v<U64, const HasherType&, const KeyType&, algorithms::Hash>)
+          return a_hasher(a_key, a_algorithm);
+        else
+          return a_hasher(a_key);
+      }
+    }
+  }
+
+  /**
+   * @brief Constructs a new read-only view of a map persisted with persist::Save.
+   *
+   * @details The file stores a Robin Hood table as three columns (probe distances, keys, values), so
+   * lookups run on the mapped pages directly, without copying or rehashing anything on open.
+   * A lookup scans the dense distance column first and only touches the key and value of a candidate.
+   *
+   * @tparam KeyType the type of the keys (has to be trivially copyable)
+   * @tparam ValueType the type of the values (has to be trivially copyable)
+   * @tparam HasherType the hasher of the keys (has to match the one of the saved map)
+   */
+  template <typename KeyType, typename ValueType, typename HasherType = hash::Hasher<KeyType>>
+  class MappedMap {
+    CVERIFY(std::is_trivially_copyable_v<KeyType> && std::is_trivially_copyable_v<ValueType> &&
+            "only trivially copyable keys and values can be mapped")
+    CVERIFY(alignof(KeyType) <= persist::ALIGNMENT && alignof(ValueType) <= persist::ALIGNMENT &&
+            "the sections of a file aren't aligned any stricter")
+
+  private:
+    MappedFile m_file;
+    const U8* m_distances;
+    const KeyType* m_keys;
+    const ValueType* m_values;
+    Size m_capacity,
+        m_used;
+    algorithms::Hash m_algorithm;
+    [[no_unique_address]] HasherType m_hasher;
+
+  public:
+    /**
+     * @brief Constructs a new view that isn't open yet.
+     *
+     * @details Runtime: O(1)
+     */
+    MappedMap();
+
+    /**
+     * @brief Destroys the view, unmapping its file.
+     *
+     * @details Runtime: O(1)
+     */
+    ~MappedMap() = default;
+
+    MappedMap(const MappedMap&) = delete;
+    MappedMap(MappedMap&& a_other) noexcept;
+    MappedMap& operator=(const MappedMap&) = delete;
+    MappedMap& operator=(MappedMap&& a_other) noexcept;
+
+    /**
+     * @brief Maps the given file, closing the current one first.
+     *
+     * @details Runtime: O(1) (O(n) if verifying, where n is the size of the file)
+     *
+     * @param a_path the path of the file
+     * @param a_verify if the checksum of the table should be verified
+     * @return false if the file couldn't be mapped or doesn't hold a matching map, otherwise true
+     */
+    bool Open(StringView a_path, bool a_verify = false);
+
+    /**
+     * @brief Unmaps the file.
+     *
+     * @details Runtime: O(1)
+     */
+    void Close();
+
+    /**
+     * @brief Finds the value of the given key.
+     *
+     * @details Runtime: O(1) on average, bounded by the maximum probe distance.
+     *
+     * @param a_key the key to find
+     * @return the pointer to the value (nullptr if not found)
+     */
+    const ValueType* Find(const KeyType& a_key) const;
+
+    /**
+     * @brief Checks if the given key exists in the map.
+     *
+     * @details Runtime: O(1) on average, bounded by the maximum probe distance.
+     *
+     * @param a_key the key to find
+     * @return if the key exists
+     */
+    Bool Exists(const KeyType& a_key) const;
+
+    /**
+     * @brief Gets the value of the given key, which has to exist.
+     *
+     * @details Runtime: O(1) on average, bounded by the maximum probe distance.
+     *
+     * @param a_key the key to find
+     * @return the value
+     */
+    const ValueType& Get(const KeyType& a_key) const;
+
+    /**
+     * @brief Calls the given function with every key and value of the map in slot order.
+     *
+     * @details Runtime: O(n), where n is the capacity of the table.
+     *
+     * @param a_function the function taking a key and a value
+     */
+    template <typename Function>
+    void ForEach(Function&& a_function) const;
+
+    /**
+     * @brief Checks if a file is mapped.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if a file is mapped
+     */
+    [[nodiscard]] bool IsOpen() const;
+
+    /**
+     * @brief Checks if the map is empty.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the map is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Gets the number of entries.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the map
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the number of slots of the persisted table.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the capacity of the table
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Gets the hash algorithm the map was saved with.
+     *
+     * @return the hash algorithm
+     */
+    [[nodiscard]] algorithms::Hash GetAlgorithm() const;
+
+    const ValueType& operator[](const KeyType& a_key) const;
+  };
+
+  namespace persist {
+    /**
+     * @brief Saves the entries of the given map, so they can be mapped by MappedMap.
+     *
+     * @details Runtime: O(n), where n is the capacity of the map.
+     * The entries are placed into a fresh Robin Hood table of at most 80% load, so the format doesn't depend
+     * on the in-memory layout of Map.
+     *
+     * @param a_map the map to save
+     * @param a_path the path of the file (replaced atomically)
+     * @return false if the file couldn't be written, otherwise true
+     */
+    template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+    bool Save(const Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>& a_map, StringView a_path);
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  template <typename KeyType, typename ValueType, typename HasherType>
+  MappedMap<KeyType, ValueType, HasherType>::MappedMap()
+    : m_file{}, m_distances{nullptr}, m_keys{nullptr}, m_values{nullptr}, m_capacity{0}, m_used{0},
+      m_algorithm{algorithms::Hash::FNV1a}, m_hasher{} {
+    // Empty
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  MappedMap<KeyType, ValueType, HasherType>::MappedMap(MappedMap&& a_other) noexcept
+    : m_file{std::move(a_other.m_file)}, m_distances{std::exchange(a_other.m_distances, nullptr)},
+      m_keys{std::exchange(a_other.m_keys, nullptr)}, m_values{std::exchange(a_other.m_values, nullptr)},
+      m_capacity{std::exchange(a_other.m_capacity, 0)}, m_used{std::exchange(a_other.m_used, 0)},
+      m_algorithm{a_other.m_algorithm}, m_hasher{a_other.m_hasher} {
+    // Empty
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  MappedMap<KeyType, ValueType, HasherType>& MappedMap<KeyType, ValueType, HasherType>::operator=(MappedMap&& a_other) noexcept {
+    if(this != &a_other) {
+      m_file = std::move(a_other.m_file);
+      m_distances = std::exchange(a_other.m_distances, nullptr);
+      m_keys = std::exchange(a_other.m_keys, nullptr);
+      m_values = std::exchange(a_other.m_values, nullptr);
+      m_capacity = std::exchange(a_other.m_capacity, 0);
+      m_used = std::exchange(a_other.m_used, 0);
+      m_algorithm = a_other.m_algorithm;
+      m_hasher = a_other.m_hasher;
+    }
+    return *this;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  bool MappedMap<KeyType, ValueType, HasherType>::Open(const StringView a_path, const bool a_verify) {
+    Close();
+    if(!m_file.Open(a_path))
+      return false;
+
+    const persist::Header* header = persist::Validate(m_file, persist::Kind::MAP, sizeof(KeyType), sizeof(ValueType), a_verify);
+    const bool valid = header != nullptr && header->section_count == 3 && std::has_single_bit(header->capacity) &&
+                       header->sections[0].size == header->capacity &&
+                       header->sections[1].size == header->capacity * sizeof(KeyType) &&
+                       header->sections[2].size == header->capacity * sizeof(ValueType);
+    if(!valid) {
+      m_file.Close();
+      return false;
+    }
+
+    m_distances = persist::GetSection(m_file, *header, 0);
+    m_keys = reinterpret_cast<const KeyType*>(persist::GetSection(m_file, *header, 1));
+    m_values = reinterpret_cast<const ValueType*>(persist::GetSection(m_file, *header, 2));
+    m_capacity = header->capacity;
+    m_used = header->count;
+    m_algorithm = static_cast<algorithms::Hash>(header->algorithm);
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  void MappedMap<KeyType, ValueType, HasherType>::Close() {
+    m_file.Close();
+    m_distances = nullptr;
+    m_keys = nullptr;
+    m_values = nullptr;
+    m_capacity = 0;
+    m_used = 0;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  const ValueType* MappedMap<KeyType, ValueType, HasherType>::Find(const KeyType& a_key) const {
+    if(m_used == 0)
+      return nullptr;
+
+    Size index = static_cast<Size>(persist::detail::HashKey(m_hasher, a_key, m_algorithm)) & (m_capacity - 1);
+    U8 distance = 1;
+
+    // a resident closer to its home slot than we are to ours means the key isn't stored
+    while(m_distances[index] >= distance) {
+      if(m_distances[index] == distance && m_keys[index] == a_key)
+        return &m_values[index];
+
+      if(distance == persist::detail::MAX_DISTANCE)
+        break;
+
+      index = (index + 1) & (m_capacity - 1);
+      distance++;
+    }
+    return nullptr;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  Bool MappedMap<KeyType, ValueType, HasherType>::Exists(const KeyType& a_key) const {
+    return Find(a_key) != nullptr;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  const ValueType& MappedMap<KeyType, ValueType, HasherType>::Get(const KeyType& a_key) const {
+    const ValueType* value = Find(a_key);
+    VERIFY(value != nullptr)
+    return *value;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  template <typename Function>
+  void MappedMap<KeyType, ValueType, HasherType>::ForEach(Function&& a_function) const {
+    for(Size i = 0; i < m_capacity; ++i)
+      if(m_distances[i] != persist::detail::EMPTY_SLOT)
+        a_function(m_keys[i], m_values[i]);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  bool MappedMap<KeyType, ValueType, HasherType>::IsOpen() const {
+    return m_file.IsOpen();
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  bool MappedMap<KeyType, ValueType, HasherType>::IsEmpty() const {
+    return m_used == 0;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  Size MappedMap<KeyType, ValueType, HasherType>::GetSize() const {
+    return m_used;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  Size MappedMap<KeyType, ValueType, HasherType>::GetCapacity() const {
+    return m_capacity;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  algorithms::Hash MappedMap<KeyType, ValueType, HasherType>::GetAlgorithm() const {
+    return m_algorithm;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  const ValueType& MappedMap<KeyType, ValueType, HasherType>::operator[](const KeyType& a_key) const {
+    return Get(a_key);
+  }
+
+  namespace persist {
+    template <typename KeyType, typename ValueType, typename HasherType, Bool cache_hashes, typename Allocator>
+    bool Save(const Map<KeyType, ValueType, HasherType, cache_hashes, Allocator>& a_map, const StringView a_path) {
+      CVERIFY(std::is_trivially_copyable_v<KeyType> && std::is_trivially_copyable_v<ValueType> &&
+              "only trivially copyable keys and values can be saved")
+
+      const HasherType hasher{};
+      const algorithms::Hash algorithm = a_map.GetAlgorithm();
+
+      Array<U8> distances(1, false, true);
+      Array<KeyType> keys(1, false, true);
+      Array<ValueType> values(1, false, true);
+
+      Size capacity = std::bit_ceil(a_map.GetSize() + a_map.GetSize() / 4 + 1);
+      while(true) {
+        // empty slots are value-initialized, so the file contents are deterministic
+        distances.Clear();
+        keys.Clear();
+        values.Clear();
+        distances.Reserve(capacity);
+        keys.Reserve(capacity);
+        values.Reserve(capacity);
+        for(Size i = 0; i < capacity; ++i) {
+          distances.Emplace(detail::EMPTY_SLOT);
+          keys.Emplace();
+          values.Emplace();
+        }
+
+        bool placed = true;
+        for(auto it = a_map.begin(); placed && it != a_map.end(); ++it) {
+          KeyType key = it->first;
+          ValueType value = it->second;
+          Size index = static_cast<Size>(detail::HashKey(hasher, key, algorithm)) & (capacity - 1);
+          U8 distance = 1;
+
+          while(true) {
+            if(distances[index] == detail::EMPTY_SLOT) {
+              distances[index] = distance;
+              keys[index] = key;
+              values[index] = value;
+              break;
+            }
+            // Robin Hood: the entry farther from its home slot takes over the slot
+            if(distances[index] < distance) {
+              std::swap(distances[index], distance);
+              std::swap(keys[index], key);
+              std::swap(values[index], value);
+            }
+            if(distance == detail::MAX_DISTANCE) {
+              placed = false;
+              break;
+            }
+            index = (index + 1) & (capacity - 1);
+            distance++;
+          }
+        }
+        if(placed)
+          break;
+        capacity *= 2;
+      }
+
+      Header header{};
+      header.kind = Kind::MAP;
+      header.element_size = sizeof(KeyType);
+      header.value_size = sizeof(ValueType);
+      header.count = a_map.GetSize();
+      header.capacity = capacity;
+      header.algorithm = static_cast<U32>(algorithm);
+
+      const Block blocks[] = {
+        {distances.GetData(), capacity},
+        {keys.GetData(), capacity * sizeof(KeyType)},
+        {values.GetData(), capacity * sizeof(ValueType)}
+      };
+      return Write(a_path, header, blocks, 3);
+    }
+  }
+}
+
+#endif // NTL_MAPPED_MAP_HPP
@@ -17,21 +17,21 @@ namespace ntl {
     SecondType second;
 
     // Default constructor
-    Pair() = default;
+    constexpr Pair() = default;
 
     // Parameterized constructor
-    Pair(const FirstType &first, const SecondType &second)
+    constexpr Pair(const FirstType &first, const SecondType &second)
         : first(first), second(second) {}
 
     // Copy constructor
-    Pair(const Pair &other) : first(other.first), second(other.second) {}
+    constexpr Pair(const Pair &other) : first(other.first), second(other.second) {}
 
     // Move constructor
-    Pair(Pair &&other) noexcept
+    constexpr Pair(Pair &&other) noexcept
         : first(std::move(other.first)), second(std::move(other.second)) {}
 
     // Copy assignment operator
-    Pair &operator=(const Pair &other) {
+    constexpr Pair &operator=(const Pair &other) {
       if (this != &other) {
         first = other.first;
         second = other.second;
@@ -40,7 +40,7 @@ namespace ntl {
     }
 
     // Move assignment operator
-    Pair &operator=(Pair &&other) noexcept {
+    constexpr Pair &operator=(Pair &&other) noexcept {
       if (this != &other) {
         first = std::move(other.first);
         second = std::move(other.second);
@@ -49,12 +49,12 @@ namespace ntl {
     }
 
     // Equality operator
-    bool operator==(const Pair &other) const {
+    constexpr bool operator==(const Pair &other) const {
       return first == other.first && second == other.second;
     }
 
     // Inequality operator
-    bool operator!=(const Pair &other) const { return !(*this == other); }
+    constexpr bool operator!=(const Pair &other) const { return !(*this == other); }
   };
 } // namespace ntl
 
@@ -0,0 +1,308 @@
+/**
+* @file PerfectHashMap.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_PERFECT_HASH_MAP_HPP
+#define NTL_PERFECT_HASH_MAP_HPP
+
+#include <type_traits>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "data/Integer.hpp"
+#include "data/Pair.hpp"
+#include "data/Size.hpp"
+#include "data/StringView.hpp"
+#include "utils/Hash.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new immutable map over a fixed set of keys using a minimal perfect hash.
+   *
+   * @details The map is built with hash and displace (CHD): the keys are split into buckets of about two
+   * keys by their hash, and every bucket gets the first seed that moves all of its keys into free slots of a
+   * table with exactly one slot per key. The largest buckets are placed first, while the table is still
+   * empty. The seeds are stored already mixed (as pilots, like PTHash), so a lookup hashes the key once,
+   * combines the hash with the pilot of its bucket by two multiplications and compares the key in the
+   * single slot it can be in. Declared constexpr, the whole map is built by the compiler and lives in read-only
+   * data (see MakePerfectHashMap).
+   *
+   * @tparam KeyType the type of the keys (StringView for string literals)
+   * @tparam ValueType the type of the values
+   * @tparam count the number of entries
+   * @tparam HasherType the hasher used to hash the keys, constexpr for compile time maps (see hash::Hasher)
+   * @tparam algorithm the hash algorithm passed to hashers accepting one
+   */
+  template <typename KeyType, typename ValueType, Size count, typename HasherType = hash::Hasher<KeyType>,
+            algorithms::Hash algorithm = algorithms::Hash::FNV1a>
+  class PerfectHashMap {
+  public:
+    CVERIFY(count > 0 && "A perfect hash map needs at least one entry");
+
+    /**
+     * @brief The number of buckets, each with its own seed.
+     */
+    static constexpr Size BUCKETS = (count + 1) / 2;
+
+    using Entry = Pair<KeyType, ValueType>;
+
+  private:
+    /**
+     * @brief The number of seeds tried for a bucket before giving up.
+     */
+    static constexpr U32 MAX_SEED = 1u << 16;
+
+    Entry m_entries[count];
+    U64 m_pilots[BUCKETS];
+    [[no_unique_address]] HasherType m_hasher;
+
+  public:
+    /**
+     * @brief Constructs a new map from the given entries.
+     *
+     * @details Runtime: O(n) on average, where n is the number of entries.
+     *
+     * @note Duplicate keys fail to compile when the map is built at compile time, and abort otherwise.
+     *
+     * @param a_entries the entries, whose keys have to be unique
+     */
+    constexpr explicit PerfectHashMap(const Entry (&a_entries)[count]);
+
+    /**
+     * @brief Gets the value at the given key.
+     *
+     * @details Runtime: O(1), one hash and one comparison of the key.
+     *
+     * @param a_key the key of the entry
+     * @return the value itself
+     */
+    constexpr const ValueType& Get(const KeyType& a_key) const;
+
+    /**
+     * @brief Gets a pointer to the value at the given key.
+     *
+     * @details Runtime: O(1), one hash and one comparison of the key.
+     *
+     * @param a_key the key of the entry
+     * @return the pointer to the value (nullptr if the key isn't part of the map)
+     */
+    constexpr const ValueType* TryGet(const KeyType& a_key) const;
+
+    /**
+     * @brief Checks if an entry with the given key exists.
+     *
+     * @details Runtime: O(1), one hash and one comparison of the key.
+     *
+     * @param a_key the key to check
+     * @return if the entry exists
+     */
+    [[nodiscard]] constexpr bool Exists(const KeyType& a_key) const;
+
+    /**
+     * @brief Gets the slot of the given key, which can be used to index arrays parallel to the map.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_key the key of the entry
+     * @return the slot of the key (count if the key isn't part of the map)
+     */
+    [[nodiscard]] constexpr Size IndexOf(const KeyType& a_key) const;
+
+    /**
+     * @brief Gets the number of entries.
+     *
+     * @return the size
+     */
+    [[nodiscard]] constexpr Size GetSize() const;
+
+    constexpr const ValueType& operator[](const KeyType& a_key) const;
+
+    // ------------------------
+    // ITERATOR-RELATED METHODS
+    // ------------------------
+    constexpr const Entry* begin() const;
+    constexpr const Entry* end() const;
+
+  private:
+    constexpr U64 hashKey(const KeyType& a_key) const;
+    static constexpr Size bucket(U64 a_hash);
+    static constexpr U64 pilot(U32 a_seed);
+    static constexpr Size slot(U64 a_hash, U64 a_pilot);
+  };
+
+  /**
+   * @brief Creates a perfect hash map from a braced list of entries, deducing their number.
+   *
+   * @details Declare the result as constexpr (or constinit) to build the map at compile time; duplicate keys
+   * then fail to compile.
+   * @code
+   * constexpr auto opcodes = MakePerfectHashMap<StringView, int>({{"add", 0}, {"sub", 1}, {"mul", 2}});
+   * static_assert(opcodes.Get("sub") == 1);
+   * @endcode
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam ValueType the type of the values
+   * @tparam count the number of entries
+   * @param a_entries the entries, whose keys have to be unique
+   * @return the map
+   */
+  template <typename KeyType, typename ValueType, Size count>
+  constexpr PerfectHashMap<KeyType, ValueType, count> MakePerfectHashMap(const Pair<KeyType, ValueType> (&a_entries)[count]) {
+    return PerfectHashMap<KeyType, ValueType, count>(a_entries);
+  }
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr const typename PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::Entry*
+  PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::begin() const {
+    return m_entries;
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr const typename PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::Entry*
+  PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::end() const {
+    return m_entries + count;
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::PerfectHashMap(const Entry (&a_entries)[count])
+    : m_entries{}, m_pilots{}, m_hasher{} {
+    U64 hashes[count] = {};
+    for(Size i = 0; i < count; ++i)
+      hashes[i] = hashKey(a_entries[i].first);
+
+    // sorts the entries by bucket, so the entries of a bucket are next to each other
+    Size starts[BUCKETS + 1] = {};
+    for(Size i = 0; i < count; ++i)
+      starts[bucket(hashes[i]) + 1]++;
+    for(Size b = 0; b < BUCKETS; ++b)
+      starts[b + 1] += starts[b];
+
+    Size order[count] = {};
+    Size filled[BUCKETS] = {};
+    for(Size i = 0; i < count; ++i) {
+      const Size b = bucket(hashes[i]);
+      order[starts[b] + filled[b]++] = i;
+    }
+
+    Size largest = 0;
+    for(Size b = 0; b < BUCKETS; ++b)
+      largest = filled[b] > largest ? filled[b] : largest;
+
+    bool used[count] = {};
+    Size slots[count] = {};
+    for(Size size = largest; size > 0; --size) {
+      for(Size b = 0; b < BUCKETS; ++b) {
+        if(filled[b] != size)
+          continue;
+
+        const Size first = starts[b];
+        // keys with the same hash share their slot for every seed
+        for(Size i = 1; i < size; ++i) {
+          for(Size j = 0; j < i; ++j) {
+            ENSURE(hashes[order[first + i]] != hashes[order[first + j]] && "Keys have to be unique and hash differently")
+          }
+        }
+
+        U32 seed = 0;
+        for(; seed < MAX_SEED; ++seed) {
+          // the keys of the bucket need free slots, which also differ from each other
+          bool fits = true;
+          for(Size i = 0; i < size && fits; ++i) {
+            slots[i] = slot(hashes[order[first + i]], pilot(seed));
+            fits = !used[slots[i]];
+            for(Size j = 0; j < i && fits; ++j)
+              fits = slots[j] != slots[i];
+          }
+          if(fits)
+            break;
+        }
+        ENSURE(seed < MAX_SEED && "No seed found for the bucket")
+
+        m_pilots[b] = pilot(seed);
+        for(Size i = 0; i < size; ++i) {
+          used[slots[i]] = true;
+          m_entries[slots[i]] = a_entries[order[first + i]];
+        }
+      }
+    }
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr const ValueType& PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::Get(const KeyType& a_key) const {
+    const ValueType* value = TryGet(a_key);
+    VERIFY(value && "No entry at key found")
+    return *value;
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr const ValueType* PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::TryGet(const KeyType& a_key) const {
+    const Size index = IndexOf(a_key);
+    return index < count ? &m_entries[index].second : nullptr;
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr bool PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::Exists(const KeyType& a_key) const {
+    return IndexOf(a_key) < count;
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr Size PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::IndexOf(const KeyType& a_key) const {
+    const U64 hash = hashKey(a_key);
+    const Size index = slot(hash, m_pilots[bucket(hash)]);
+    // every key has exactly one slot, so a different key in it means the key isn't part of the map
+    return m_entries[index].first == a_key ? index : count;
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr Size PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::GetSize() const {
+    return count;
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr const ValueType& PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::operator[](const KeyType& a_key) const {
+    return Get(a_key);
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr U64 PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::hashKey(const KeyType& a_key) const {
+    if constexpr(std::is_invocable_r_v<U64, const HasherType&, const KeyType&, algorithms::Hash>)
+      return m_hasher(a_key, algorithm);
+    else
+      return m_hasher(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr Size PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::bucket(const U64 a_hash) {
+    // the slot multiplies the whole hash with the pilot, so keys of the same bucket still spread over the table
+    return static_cast<Size>(a_hash >> 32) % BUCKETS;
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr U64 PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::pilot(const U32 a_seed) {
+    return hash::Mix(a_seed + 1);
+  }
+
+  template <typename KeyType, typename ValueType, Size count, typename HasherType, algorithms::Hash algorithm>
+  constexpr Size PerfectHashMap<KeyType, ValueType, count, HasherType, algorithm>::slot(const U64 a_hash, const U64 a_pilot) {
+    // spreads the hash first (while the pilot loads), so hashes differing only in their lowest bits still separate
+    const U64 spread = a_hash * 0x9E3779B97F4A7C15ULL;
+    return static_cast<Size>(((spread ^ a_pilot) * 0xC2B2AE3D27D4EB4FULL) >> 32) % count;
+  }
+}
+
+#endif // NTL_PERFECT_HASH_MAP_HPP
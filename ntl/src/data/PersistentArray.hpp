@@ -0,0 +1,674 @@
+/**
+* @file PersistentArray.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_PERSISTENT_ARRAY_HPP
+#define NTL_PERSISTENT_ARRAY_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "os/Atomic.hpp"
+#include "utils/Allocator.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new persistent array object.
+   *
+   * @details The elements are stored in chunks of WIDTH elements, which are the leaves of a trie whose inner
+   * nodes also have WIDTH children. The nodes are reference counted and shared between copies, so copying
+   * the array takes O(1) and every copy is an immutable snapshot for its readers. A modification duplicates
+   * only the chunks on the path to the element that are still shared with another copy and changes nodes
+   * owned by the array alone in place.
+   *
+   * @tparam ValueType the type of elements to store (default constructible, as chunks are always filled)
+   * @tparam Allocator the allocator of the nodes (see is_allocator)
+   *
+   * @note Different copies can be read and modified by different threads at the same time, as the reference
+   * counts are atomic. A single copy isn't thread-safe: it has to be published (see SnapshotCell) or locked.
+   */
+  template <typename ValueType, typename Allocator = DefaultAllocator>
+  class PersistentArray {
+  public:
+    /**
+     * @brief The number of elements of a chunk and children of an inner node.
+     */
+    static constexpr Size WIDTH = 32;
+
+  private:
+    static constexpr U32 BITS = 5;
+    static constexpr Size MASK = WIDTH - 1;
+
+    /**
+     * @brief The part shared by chunks and inner nodes (which are told apart by their level).
+     */
+    struct Node {
+      Atomic<U32> refs{1};
+    };
+
+    /**
+     * @brief Represents a chunk of elements.
+     */
+    struct Leaf : Node {
+      ValueType values[WIDTH];
+    };
+
+    /**
+     * @brief Represents a node of WIDTH children (nullptr past the last element).
+     */
+    struct Inner : Node {
+      Node* children[WIDTH] = {};
+    };
+
+  public:
+    /**
+     * @brief Iterator class to simplify iteration over the array.
+     */
+    class Iterator {
+      friend class PersistentArray;
+
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = ValueType;
+      using pointer = const ValueType*;
+      using reference = const ValueType&;
+
+    private:
+      const PersistentArray* m_array;
+      const Leaf* m_leaf;
+      Size m_index;
+
+    public:
+      /**
+       * @brief Constructs a new iterator
+       * @param a_array the iterated array
+       * @param a_index the index of the element
+       */
+      Iterator(const PersistentArray* a_array, Size a_index)
+        : m_array(a_array), m_leaf(a_index < a_array->m_size ? a_array->leaf(a_index) : nullptr), m_index(a_index) {}
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the element of the current iteration
+       */
+      reference operator*() const { return m_leaf->values[m_index & MASK]; }
+
+      /**
+       * @brief Overloading pointer operator.
+       * @return the pointer to the element of the current iteration
+       */
+      pointer operator->() const { return &m_leaf->values[m_index & MASK]; }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the reference to the next iterator
+       */
+      Iterator& operator++() {
+        // the next chunk is only looked up at the chunk boundaries
+        if((++m_index & MASK) == 0)
+          m_leaf = m_index < m_array->m_size ? m_array->leaf(m_index) : nullptr;
+        return *this;
+      }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the next iterator
+       */
+      Iterator operator++(int) {
+        Iterator temp = *this;
+        ++*this;
+        return temp;
+      }
+
+      /**
+       * @brief Overloading equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators are equivalent
+       */
+      friend bool operator==(const Iterator& a_first, const Iterator& a_second) {
+        return a_first.m_index == a_second.m_index;
+      }
+
+      /**
+       * @brief Overloading anti equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators aren't equivalent
+       */
+      friend bool operator!=(const Iterator& a_first, const Iterator& a_second) {
+        return !(a_first == a_second);
+      }
+    };
+
+  private:
+    Node* m_root;
+    Size m_size;
+    U32 m_shift; // the shift of the index at the root, 0 if the root is a chunk
+    [[no_unique_address]] Allocator m_allocator;
+
+  public:
+    /**
+     * @brief Constructs a new empty array.
+     *
+     * @param a_allocator the allocator of the nodes
+     */
+    explicit PersistentArray(const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Constructs a new array sharing all nodes with another array.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other array
+     */
+    PersistentArray(const PersistentArray& a_other);
+
+    /**
+     * @brief Constructs a new array by taking over the nodes of another array.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other array (empty afterwards)
+     */
+    PersistentArray(PersistentArray&& a_other) noexcept;
+
+    /**
+     * @brief Destructs the array, freeing the nodes no other copy shares.
+     */
+    ~PersistentArray();
+
+    /**
+     * @brief Overloading assignment operator.
+     * @param a_other the array to share the nodes of
+     * @return the reference of the current array object
+     */
+    PersistentArray& operator=(const PersistentArray& a_other);
+
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other the array to take the nodes from
+     * @return the reference of the current array object
+     */
+    PersistentArray& operator=(PersistentArray&& a_other) noexcept;
+
+    /**
+     * @brief Gets the element at the given index.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the array (at most 13 steps for 64-bit indices).
+     *
+     * @param a_index the index of the element
+     * @return the element itself
+     */
+    const ValueType& Get(Size a_index) const;
+
+    /**
+     * @brief Gets the element at the given index for modification, duplicating the shared chunks on its path.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the array.
+     *
+     * @param a_index the index of the element
+     * @return the element itself, valid until the next modification
+     */
+    ValueType& At(Size a_index);
+
+    /**
+     * @brief Replaces the element at the given index.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the array.
+     *
+     * @param a_index the index of the element
+     * @param a_value the new element
+     */
+    void Set(Size a_index, ValueType a_value);
+
+    /**
+     * @brief Appends an element.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the array.
+     *
+     * @param a_value the element to append
+     */
+    void PushBack(ValueType a_value);
+
+    /**
+     * @brief Removes the last element.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the array.
+     */
+    void PopBack();
+
+    /**
+     * @brief Removes all elements, freeing the nodes no other copy shares.
+     *
+     * @details Runtime: O(n), where n is the number of nodes only this array references.
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of elements.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Checks if the array has no elements.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the array is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Checks if both arrays share the same root, so their elements are equal without comparing them.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other array
+     * @return if the other array is an unmodified copy of this one
+     */
+    [[nodiscard]] bool IsSharedWith(const PersistentArray& a_other) const;
+
+    /**
+     * @brief Converts the array to a string.
+     *
+     * @details Runtime: O(n), where n is the size of the array.
+     *
+     * @return the array as a string
+     */
+    [[nodiscard]] String ToString() const;
+
+    const ValueType& operator[](Size a_index) const;
+    bool operator==(const PersistentArray& a_other) const;
+    bool operator!=(const PersistentArray& a_other) const;
+
+    // ------------------------
+    // ITERATOR-RELATED METHODS
+    // ------------------------
+    Iterator begin() const;
+    Iterator end() const;
+
+  private:
+    /**
+     * @brief Finds the chunk holding the element at the given index.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the array.
+     *
+     * @param a_index the index of the element
+     * @return the chunk
+     */
+    const Leaf* leaf(Size a_index) const;
+
+    /**
+     * @brief Walks down to the chunk of the given index, duplicating the shared nodes and creating missing ones.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the array.
+     *
+     * @param a_index the index of the element
+     * @return the chunk, owned by this array alone
+     */
+    Leaf* ownedLeaf(Size a_index);
+
+    /**
+     * @brief Gets a node that only this array references, duplicating it if it is shared.
+     *
+     * @details Runtime: O(WIDTH)
+     *
+     * @param a_node the node referenced by an owned parent (or the root)
+     * @param a_shift the shift of the level of the node
+     * @return the node itself or its duplicate
+     */
+    Node* own(Node* a_node, U32 a_shift);
+
+    /**
+     * @brief Removes the last element below the given node.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the array.
+     *
+     * @param a_node the link to the owned node, set to nullptr if the node got empty
+     * @param a_shift the shift of the level of the node
+     * @param a_index the index of the last element
+     */
+    void popBack(Node*& a_node, U32 a_shift, Size a_index);
+
+    /**
+     * @brief Drops a reference to the given node, freeing it and its children once no copy references it.
+     *
+     * @details Runtime: O(1) if the node is still shared, O(n) otherwise, where n is the number of nodes freed.
+     *
+     * @param a_node the node (may be nullptr)
+     * @param a_shift the shift of the level of the node
+     */
+    void release(Node* a_node, U32 a_shift);
+
+    /**
+     * @brief Gets the number of elements the trie can hold with its current height.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the capacity
+     */
+    [[nodiscard]] Size capacity() const;
+
+    Leaf* createLeaf();
+    Inner* createInner();
+  };
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+
+  template <typename ValueType, typename Allocator>
+  typename PersistentArray<ValueType, Allocator>::Iterator PersistentArray<ValueType, Allocator>::begin() const {
+    return Iterator(this, 0);
+  }
+
+  template <typename ValueType, typename Allocator>
+  typename PersistentArray<ValueType, Allocator>::Iterator PersistentArray<ValueType, Allocator>::end() const {
+    return Iterator(this, m_size);
+  }
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_array the array
+   * @return the combined ostream
+   */
+  template <typename ValueType, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const PersistentArray<ValueType, Allocator>& a_array) {
+    return (a_stream << a_array.ToString());
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename ValueType, typename Allocator>
+  PersistentArray<ValueType, Allocator>::PersistentArray(const Allocator& a_allocator)
+    : m_root{nullptr}, m_size{0}, m_shift{0}, m_allocator{a_allocator} {
+    // Empty
+  }
+
+  template <typename ValueType, typename Allocator>
+  PersistentArray<ValueType, Allocator>::PersistentArray(const PersistentArray& a_other)
+    : m_root{a_other.m_root}, m_size{a_other.m_size}, m_shift{a_other.m_shift}, m_allocator{a_other.m_allocator} {
+    if(m_root)
+      m_root->refs.FetchAdd(1, Atomic<U32>::MemoryOrder::Relaxed);
+  }
+
+  template <typename ValueType, typename Allocator>
+  PersistentArray<ValueType, Allocator>::PersistentArray(PersistentArray&& a_other) noexcept
+    : m_root{std::exchange(a_other.m_root, nullptr)}, m_size{std::exchange(a_other.m_size, 0)},
+      m_shift{std::exchange(a_other.m_shift, 0)}, m_allocator{a_other.m_allocator} {
+    // Empty
+  }
+
+  template <typename ValueType, typename Allocator>
+  PersistentArray<ValueType, Allocator>::~PersistentArray() {
+    release(m_root, m_shift);
+  }
+
+  template <typename ValueType, typename Allocator>
+  PersistentArray<ValueType, Allocator>& PersistentArray<ValueType, Allocator>::operator=(const PersistentArray& a_other) {
+    if(this != &a_other)
+      *this = PersistentArray(a_other);
+    return *this;
+  }
+
+  template <typename ValueType, typename Allocator>
+  PersistentArray<ValueType, Allocator>& PersistentArray<ValueType, Allocator>::operator=(PersistentArray&& a_other) noexcept {
+    std::swap(m_root, a_other.m_root);
+    std::swap(m_size, a_other.m_size);
+    std::swap(m_shift, a_other.m_shift);
+    std::swap(m_allocator, a_other.m_allocator);
+    return *this;
+  }
+
+  template <typename ValueType, typename Allocator>
+  const ValueType& PersistentArray<ValueType, Allocator>::Get(const Size a_index) const {
+    VERIFY(a_index < m_size && "Index out of bounds")
+    return leaf(a_index)->values[a_index & MASK];
+  }
+
+  template <typename ValueType, typename Allocator>
+  ValueType& PersistentArray<ValueType, Allocator>::At(const Size a_index) {
+    VERIFY(a_index < m_size && "Index out of bounds")
+    return ownedLeaf(a_index)->values[a_index & MASK];
+  }
+
+  template <typename ValueType, typename Allocator>
+  void PersistentArray<ValueType, Allocator>::Set(const Size a_index, ValueType a_value) {
+    At(a_index) = std::move(a_value);
+  }
+
+  template <typename ValueType, typename Allocator>
+  void PersistentArray<ValueType, Allocator>::PushBack(ValueType a_value) {
+    if(!m_root) {
+      m_root = createLeaf();
+    } else if(m_size == capacity()) {
+      // the trie is full, so it grows by one level above the old root
+      Inner* root = createInner();
+      root->children[0] = m_root;
+      m_root = root;
+      m_shift += BITS;
+    }
+
+    ownedLeaf(m_size)->values[m_size & MASK] = std::move(a_value);
+    m_size++;
+  }
+
+  template <typename ValueType, typename Allocator>
+  void PersistentArray<ValueType, Allocator>::PopBack() {
+    VERIFY(m_size > 0 && "Array is empty")
+
+    popBack(m_root, m_shift, --m_size);
+
+    // a root with a single child is replaced by the child
+    while(m_root && m_shift > 0 && m_size <= (Size{1} << m_shift)) {
+      Node* child = static_cast<Inner*>(m_root)->children[0];
+      child->refs.FetchAdd(1, Atomic<U32>::MemoryOrder::Relaxed);
+      release(m_root, m_shift);
+      m_root = child;
+      m_shift -= BITS;
+    }
+    if(!m_root)
+      m_shift = 0;
+  }
+
+  template <typename ValueType, typename Allocator>
+  void PersistentArray<ValueType, Allocator>::Clear() {
+    release(m_root, m_shift);
+    m_root = nullptr;
+    m_size = 0;
+    m_shift = 0;
+  }
+
+  template <typename ValueType, typename Allocator>
+  Size PersistentArray<ValueType, Allocator>::GetSize() const {
+    return m_size;
+  }
+
+  template <typename ValueType, typename Allocator>
+  bool PersistentArray<ValueType, Allocator>::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  template <typename ValueType, typename Allocator>
+  bool PersistentArray<ValueType, Allocator>::IsSharedWith(const PersistentArray& a_other) const {
+    return m_root == a_other.m_root && m_size == a_other.m_size;
+  }
+
+  template <typename ValueType, typename Allocator>
+  String PersistentArray<ValueType, Allocator>::ToString() const {
+    Size estimate = 17;
+    for(const ValueType& value : *this)
+      estimate += StringBuilder::Measure(value) + 2;
+
+    StringBuilder builder{estimate};
+    builder.Append("PersistentArray(");
+
+    for(Iterator it = begin(); it != end(); ++it) {
+      if(it != begin())
+        builder.Append(", ");
+      builder.Append(*it);
+    }
+
+    builder.Append(")");
+    return builder.Build();
+  }
+
+  template <typename ValueType, typename Allocator>
+  const ValueType& PersistentArray<ValueType, Allocator>::operator[](const Size a_index) const {
+    return Get(a_index);
+  }
+
+  template <typename ValueType, typename Allocator>
+  bool PersistentArray<ValueType, Allocator>::operator==(const PersistentArray& a_other) const {
+    if(m_size != a_other.m_size)
+      return false;
+    if(m_root == a_other.m_root)
+      return true;
+
+    for(Iterator first = begin(), second = a_other.begin(); first != end(); ++first, ++second) {
+      if(!(*first == *second))
+        return false;
+    }
+    return true;
+  }
+
+  template <typename ValueType, typename Allocator>
+  bool PersistentArray<ValueType, Allocator>::operator!=(const PersistentArray& a_other) const {
+    return !(*this == a_other);
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename ValueType, typename Allocator>
+  const typename PersistentArray<ValueType, Allocator>::Leaf* PersistentArray<ValueType, Allocator>::leaf(const Size a_index) const {
+    const Node* node = m_root;
+    for(U32 shift = m_shift; shift > 0; shift -= BITS)
+      node = static_cast<const Inner*>(node)->children[(a_index >> shift) & MASK];
+    return static_cast<const Leaf*>(node);
+  }
+
+  template <typename ValueType, typename Allocator>
+  typename PersistentArray<ValueType, Allocator>::Leaf* PersistentArray<ValueType, Allocator>::ownedLeaf(const Size a_index) {
+    Node** link = &m_root;
+
+    // every node below an owned node with a single reference is only referenced by this array
+    for(U32 shift = m_shift; shift > 0; shift -= BITS) {
+      *link = own(*link, shift);
+      Node*& child = static_cast<Inner*>(*link)->children[(a_index >> shift) & MASK];
+      if(!child)
+        child = shift == BITS ? static_cast<Node*>(createLeaf()) : static_cast<Node*>(createInner());
+      link = &child;
+    }
+
+    *link = own(*link, 0);
+    return static_cast<Leaf*>(*link);
+  }
+
+  template <typename ValueType, typename Allocator>
+  typename PersistentArray<ValueType, Allocator>::Node* PersistentArray<ValueType, Allocator>::own(Node* a_node, const U32 a_shift) {
+    if(a_node->refs.Load(Atomic<U32>::MemoryOrder::Acquire) == 1)
+      return a_node;
+
+    Node* copy;
+    if(a_shift == 0) {
+      Leaf* leaf = createLeaf();
+      std::copy_n(static_cast<Leaf*>(a_node)->values, WIDTH, leaf->values);
+      copy = leaf;
+    } else {
+      Inner* inner = createInner();
+      std::copy_n(static_cast<Inner*>(a_node)->children, WIDTH, inner->children);
+      for(Node* child : inner->children) {
+        if(child)
+          child->refs.FetchAdd(1, Atomic<U32>::MemoryOrder::Relaxed);
+      }
+      copy = inner;
+    }
+
+    // the other copies may have let go in the meantime, so this can be the last reference
+    release(a_node, a_shift);
+    return copy;
+  }
+
+  template <typename ValueType, typename Allocator>
+  void PersistentArray<ValueType, Allocator>::popBack(Node*& a_node, const U32 a_shift, const Size a_index) {
+    a_node = own(a_node, a_shift);
+
+    bool empty;
+    if(a_shift == 0) {
+      // the value is reset, so the resources it holds are freed right away
+      static_cast<Leaf*>(a_node)->values[a_index & MASK] = ValueType{};
+      empty = (a_index & MASK) == 0;
+    } else {
+      Node*& child = static_cast<Inner*>(a_node)->children[(a_index >> a_shift) & MASK];
+      popBack(child, a_shift - BITS, a_index);
+      empty = !child && ((a_index >> a_shift) & MASK) == 0;
+    }
+
+    if(empty) {
+      release(a_node, a_shift);
+      a_node = nullptr;
+    }
+  }
+
+  template <typename ValueType, typename Allocator>
+  void PersistentArray<ValueType, Allocator>::release(Node* a_node, const U32 a_shift) {
+    if(!a_node || a_node->refs.FetchSub(1, Atomic<U32>::MemoryOrder::AcquireRelease) != 1)
+      return;
+
+    if(a_shift == 0) {
+      auto* leaf = static_cast<Leaf*>(a_node);
+      leaf->~Leaf();
+      memory::Deallocate(m_allocator, leaf, 1);
+      return;
+    }
+
+    auto* inner = static_cast<Inner*>(a_node);
+    for(Node* child : inner->children)
+      release(child, a_shift - BITS);
+    inner->~Inner();
+    memory::Deallocate(m_allocator, inner, 1);
+  }
+
+  template <typename ValueType, typename Allocator>
+  Size PersistentArray<ValueType, Allocator>::capacity() const {
+    return m_shift + BITS >= sizeof(Size) * 8 ? ~Size{0} : WIDTH << m_shift;
+  }
+
+  template <typename ValueType, typename Allocator>
+  typename PersistentArray<ValueType, Allocator>::Leaf* PersistentArray<ValueType, Allocator>::createLeaf() {
+    return ::new(memory::Allocate<Leaf>(m_allocator, 1)) Leaf();
+  }
+
+  template <typename ValueType, typename Allocator>
+  typename PersistentArray<ValueType, Allocator>::Inner* PersistentArray<ValueType, Allocator>::createInner() {
+    return ::new(memory::Allocate<Inner>(m_allocator, 1)) Inner();
+  }
+}
+
+#endif // NTL_PERSISTENT_ARRAY_HPP
@@ -0,0 +1,930 @@
+/**
+* @file PersistentMap.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_PERSISTENT_MAP_HPP
+#define NTL_PERSISTENT_MAP_HPP
+
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "data/Integer.hpp"
+#include "data/Pair.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "os/Atomic.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Hash.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new persistent map object.
+   *
+   * @details The map is a hash array mapped trie: every node consumes five bits of the 64-bit hash of a key
+   * and stores the entries and children of these bits in arrays compressed by two bitmaps, so a node only
+   * holds as many slots as it uses. Keys whose hashes are equal share a collision node below the last level.
+   * The nodes are reference counted and shared between copies, so copying the map takes O(1) and every copy
+   * is an immutable snapshot for its readers. A modification duplicates only the nodes on the path to the
+   * entry that are still shared with another copy and changes nodes owned by the map alone in place.
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam ValueType the type of the values
+   * @tparam HasherType the hasher used to hash the keys (see hash::Hasher)
+   * @tparam Allocator the allocator of the nodes (see is_allocator)
+   *
+   * @note Different copies can be read and modified by different threads at the same time, as the reference
+   * counts are atomic. A single copy isn't thread-safe: it has to be published (see SnapshotCell) or locked.
+   */
+  template <typename KeyType, typename ValueType, typename HasherType = hash::Hasher<KeyType>,
+            typename Allocator = DefaultAllocator>
+  class PersistentMap {
+  private:
+    static constexpr U32 BITS = 5;
+    static constexpr U32 MASK = (1u << BITS) - 1;
+
+    /**
+     * @brief Nodes at or below this shift have used up the hash and hold colliding entries in any order.
+     */
+    static constexpr U32 COLLISION_SHIFT = 65;
+
+    /**
+     * @brief The maximum number of levels, including the collision level.
+     */
+    static constexpr Size MAX_DEPTH = COLLISION_SHIFT / BITS + 1;
+
+    /**
+     * @brief Represents a single entry in the map.
+     */
+    struct Entry {
+      KeyType key;
+      ValueType value;
+      U64 hash;
+    };
+
+    /**
+     * @brief Represents a node, whose entries and children are ordered by the hash bits of their slot.
+     */
+    struct Node {
+      Atomic<U32> refs{1};
+      U32 entry_map = 0;  // the slots holding an entry
+      U32 child_map = 0;  // the slots holding a child
+      U32 entry_count = 0;
+      U32 child_count = 0;
+      Entry* entries = nullptr;
+      Node** children = nullptr;
+    };
+
+  public:
+    /**
+     * @brief Iterator class to simplify iteration over the map in no particular order.
+     */
+    class Iterator {
+      friend class PersistentMap;
+
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = Pair<const KeyType&, const ValueType&>;
+      using pointer = void;
+      using reference = value_type;
+
+    private:
+      // the nodes from the root down to the current one, and the next child to visit of each
+      const Node* m_nodes[MAX_DEPTH];
+      U32 m_next[MAX_DEPTH];
+      Size m_depth;
+      U32 m_entry;
+
+    public:
+      /**
+       * @brief Constructs a new iterator
+       * @param a_root the root to iterate (nullptr for the end)
+       */
+      explicit Iterator(const Node* a_root) : m_depth(0), m_entry(0) {
+        if(a_root) {
+          m_nodes[0] = a_root;
+          m_next[0] = 0;
+          m_depth = 1;
+          if(a_root->entry_count == 0)
+            advance();
+        }
+      }
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the key and value of the current iteration
+       */
+      reference operator*() const { return {GetKey(), GetValue()}; }
+
+      /**
+       * @brief Gets the key of the current iteration.
+       * @return the key
+       */
+      const KeyType& GetKey() const { return m_nodes[m_depth - 1]->entries[m_entry].key; }
+
+      /**
+       * @brief Gets the value of the current iteration.
+       * @return the value
+       */
+      const ValueType& GetValue() const { return m_nodes[m_depth - 1]->entries[m_entry].value; }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the reference to the next iterator
+       */
+      Iterator& operator++() {
+        if(++m_entry == m_nodes[m_depth - 1]->entry_count)
+          advance();
+        return *this;
+      }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the next iterator
+       */
+      Iterator operator++(int) {
+        Iterator temp = *this;
+        ++*this;
+        return temp;
+      }
+
+      /**
+       * @brief Overloading equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators are equivalent
+       */
+      friend bool operator==(const Iterator& a_first, const Iterator& a_second) {
+        if(a_first.m_depth == 0 || a_second.m_depth == 0)
+          return a_first.m_depth == a_second.m_depth;
+        return a_first.m_nodes[a_first.m_depth - 1] == a_second.m_nodes[a_second.m_depth - 1] &&
+               a_first.m_entry == a_second.m_entry;
+      }
+
+      /**
+       * @brief Overloading anti equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators aren't equivalent
+       */
+      friend bool operator!=(const Iterator& a_first, const Iterator& a_second) {
+        return !(a_first == a_second);
+      }
+
+    private:
+      /**
+       * @brief Moves to the first entry of the next node holding entries, visiting the children depth-first.
+       */
+      void advance() {
+        m_entry = 0;
+        while(m_depth > 0) {
+          const Node* node = m_nodes[m_depth - 1];
+          if(m_next[m_depth - 1] == node->child_count) {
+            m_depth--;
+            continue;
+          }
+
+          const Node* child = node->children[m_next[m_depth - 1]++];
+          m_nodes[m_depth] = child;
+          m_next[m_depth] = 0;
+          m_depth++;
+          if(child->entry_count > 0)
+            return;
+        }
+      }
+    };
+
+  private:
+    Node* m_root;
+    Size m_size;
+    algorithms::Hash m_algorithm;
+    [[no_unique_address]] HasherType m_hasher;
+    [[no_unique_address]] Allocator m_allocator;
+
+  public:
+    /**
+     * @brief Constructs a new empty map.
+     *
+     * @param a_algorithm the hashing algorithm to use
+     * @param a_allocator the allocator of the nodes
+     */
+    explicit PersistentMap(algorithms::Hash a_algorithm = algorithms::Hash::FNV1a,
+                           const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Constructs a new map sharing all nodes with another map.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other map
+     */
+    PersistentMap(const PersistentMap& a_other);
+
+    /**
+     * @brief Constructs a new map by taking over the nodes of another map.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other map (empty afterwards)
+     */
+    PersistentMap(PersistentMap&& a_other) noexcept;
+
+    /**
+     * @brief Destructs the map, freeing the nodes no other copy shares.
+     */
+    ~PersistentMap();
+
+    /**
+     * @brief Overloading assignment operator.
+     * @param a_other the map to share the nodes of
+     * @return the reference of the current map object
+     */
+    PersistentMap& operator=(const PersistentMap& a_other);
+
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other the map to take the nodes from
+     * @return the reference of the current map object
+     */
+    PersistentMap& operator=(PersistentMap&& a_other) noexcept;
+
+    /**
+     * @brief Inserts an entry, or replaces the value of the entry with the given key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map (at most 14 levels).
+     *
+     * @param a_key the key of the entry
+     * @param a_value the value of the entry
+     * @return if a new entry was inserted
+     */
+    bool Insert(KeyType a_key, ValueType a_value);
+
+    /**
+     * @brief Removes the entry with the given key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return if the entry existed
+     *
+     * @note Nothing is duplicated if the key doesn't exist.
+     */
+    bool Remove(const KeyType& a_key);
+
+    /**
+     * @brief Gets the value at the given key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return the value itself
+     */
+    const ValueType& Get(const KeyType& a_key) const;
+
+    /**
+     * @brief Gets a pointer to the value at the given key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return the pointer to the value (nullptr if the key doesn't exist), valid until the next modification
+     */
+    const ValueType* TryGet(const KeyType& a_key) const;
+
+    /**
+     * @brief Checks if an entry with the given key exists.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key to check
+     * @return if the entry exists
+     */
+    [[nodiscard]] bool Exists(const KeyType& a_key) const;
+
+    /**
+     * @brief Removes all entries, freeing the nodes no other copy shares.
+     *
+     * @details Runtime: O(n), where n is the number of nodes only this map references.
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of entries.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Checks if the map has no entries.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the map is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Checks if both maps share the same root, so their entries are equal without comparing them.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other map
+     * @return if the other map is an unmodified copy of this one
+     */
+    [[nodiscard]] bool IsSharedWith(const PersistentMap& a_other) const;
+
+    /**
+     * @brief Gets the hash algorithm passed to hashers accepting one.
+     *
+     * @return the hash algorithm
+     */
+    [[nodiscard]] algorithms::Hash GetAlgorithm() const;
+
+    /**
+     * @brief Converts the map to a string.
+     *
+     * @details Runtime: O(n), where n is the size of the map.
+     *
+     * @return the map as a string
+     */
+    [[nodiscard]] String ToString() const;
+
+    const ValueType& operator[](const KeyType& a_key) const;
+    bool operator==(const PersistentMap& a_other) const;
+    bool operator!=(const PersistentMap& a_other) const;
+
+    // ------------------------
+    // ITERATOR-RELATED METHODS
+    // ------------------------
+    Iterator begin() const;
+    Iterator end() const;
+
+  private:
+    /**
+     * @brief Hashes the given key using the hasher of the map.
+     *
+     * @param a_key the key to hash
+     * @return the hash of the key
+     */
+    U64 hashKey(const KeyType& a_key) const;
+
+    /**
+     * @brief Finds the entry corresponding to the given key.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_key the key of the entry
+     * @return the pointer to the entry (nullptr if the key doesn't exist)
+     */
+    const Entry* find(const KeyType& a_key) const;
+
+    /**
+     * @brief Inserts an entry below the given node.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map.
+     *
+     * @param a_node the link to the node referenced by an owned parent (or the root)
+     * @param a_shift the shift of the hash at the level of the node
+     * @param a_entry the entry to insert
+     * @return if a new entry was inserted
+     */
+    bool insert(Node*& a_node, U32 a_shift, Entry&& a_entry);
+
+    /**
+     * @brief Removes the entry with the given key, which has to exist below the given node.
+     *
+     * @details Runtime: O(log(n)), where n is the size of the map. A child left with a single entry
+     * and no children is replaced by its entry, so the trie stays as shallow as possible.
+     *
+     * @param a_node the link to the node referenced by an owned parent (or the root)
+     * @param a_shift the shift of the hash at the level of the node
+     * @param a_hash the hash of the key
+     * @param a_key the key of the entry
+     */
+    void remove(Node*& a_node, U32 a_shift, U64 a_hash, const KeyType& a_key);
+
+    /**
+     * @brief Gets a node that only this map references, duplicating it if it is shared.
+     *
+     * @details Runtime: O(k), where k is the number of entries and children of the node.
+     *
+     * @param a_node the node
+     * @return the node itself or its duplicate
+     */
+    Node* own(Node* a_node);
+
+    /**
+     * @brief Drops a reference to the given node, freeing it and its children once no copy references it.
+     *
+     * @details Runtime: O(1) if the node is still shared, O(n) otherwise, where n is the number of entries freed.
+     *
+     * @param a_node the node (may be nullptr)
+     */
+    void release(Node* a_node);
+
+    /**
+     * @brief Inserts an entry into the entry array of an owned node.
+     *
+     * @param a_node the node
+     * @param a_index the index of the new entry
+     * @param a_entry the entry
+     */
+    void insertEntry(Node* a_node, U32 a_index, Entry&& a_entry);
+
+    /**
+     * @brief Removes an entry from the entry array of an owned node.
+     *
+     * @param a_node the node
+     * @param a_index the index of the entry
+     */
+    void eraseEntry(Node* a_node, U32 a_index);
+
+    /**
+     * @brief Inserts a child into the child array of an owned node.
+     *
+     * @param a_node the node
+     * @param a_index the index of the new child
+     * @param a_child the child
+     */
+    void insertChild(Node* a_node, U32 a_index, Node* a_child);
+
+    /**
+     * @brief Removes a child from the child array of an owned node, without releasing it.
+     *
+     * @param a_node the node
+     * @param a_index the index of the child
+     */
+    void eraseChild(Node* a_node, U32 a_index);
+
+    Node* createNode();
+
+    /**
+     * @brief Gets the slot of the given hash at the given level.
+     *
+     * @param a_hash the hash
+     * @param a_shift the shift of the hash at the level
+     * @return the bit of the slot
+     */
+    static U32 bit(U64 a_hash, U32 a_shift);
+
+    /**
+     * @brief Gets the index in a compressed array of the given slot.
+     *
+     * @param a_map the bitmap of the used slots
+     * @param a_bit the bit of the slot
+     * @return the number of used slots before it
+     */
+    static U32 index(U32 a_map, U32 a_bit);
+  };
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  typename PersistentMap<KeyType, ValueType, HasherType, Allocator>::Iterator
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::begin() const {
+    return Iterator(m_root);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  typename PersistentMap<KeyType, ValueType, HasherType, Allocator>::Iterator
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::end() const {
+    return Iterator(nullptr);
+  }
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_map the map
+   * @return the combined ostream
+   */
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const PersistentMap<KeyType, ValueType, HasherType, Allocator>& a_map) {
+    return (a_stream << a_map.ToString());
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::PersistentMap(const algorithms::Hash a_algorithm,
+                                                                          const Allocator& a_allocator)
+    : m_root{nullptr}, m_size{0}, m_algorithm{a_algorithm}, m_allocator{a_allocator} {
+    // Empty
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::PersistentMap(const PersistentMap& a_other)
+    : m_root{a_other.m_root}, m_size{a_other.m_size}, m_algorithm{a_other.m_algorithm},
+      m_hasher{a_other.m_hasher}, m_allocator{a_other.m_allocator} {
+    if(m_root)
+      m_root->refs.FetchAdd(1, Atomic<U32>::MemoryOrder::Relaxed);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::PersistentMap(PersistentMap&& a_other) noexcept
+    : m_root{std::exchange(a_other.m_root, nullptr)}, m_size{std::exchange(a_other.m_size, 0)},
+      m_algorithm{a_other.m_algorithm}, m_hasher{std::move(a_other.m_hasher)}, m_allocator{a_other.m_allocator} {
+    // Empty
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::~PersistentMap() {
+    release(m_root);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>&
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::operator=(const PersistentMap& a_other) {
+    if(this != &a_other)
+      *this = PersistentMap(a_other);
+    return *this;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>&
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::operator=(PersistentMap&& a_other) noexcept {
+    std::swap(m_root, a_other.m_root);
+    std::swap(m_size, a_other.m_size);
+    std::swap(m_algorithm, a_other.m_algorithm);
+    std::swap(m_hasher, a_other.m_hasher);
+    std::swap(m_allocator, a_other.m_allocator);
+    return *this;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  bool PersistentMap<KeyType, ValueType, HasherType, Allocator>::Insert(KeyType a_key, ValueType a_value) {
+    if(!m_root)
+      m_root = createNode();
+
+    const U64 hash = hashKey(a_key);
+    if(!insert(m_root, 0, Entry{std::move(a_key), std::move(a_value), hash}))
+      return false;
+
+    m_size++;
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  bool PersistentMap<KeyType, ValueType, HasherType, Allocator>::Remove(const KeyType& a_key) {
+    // looked up first, so a missing key never duplicates the shared nodes on its path
+    const Entry* entry = find(a_key);
+    if(!entry)
+      return false;
+
+    remove(m_root, 0, entry->hash, a_key);
+    if(--m_size == 0) {
+      release(m_root);
+      m_root = nullptr;
+    }
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  const ValueType& PersistentMap<KeyType, ValueType, HasherType, Allocator>::Get(const KeyType& a_key) const {
+    const Entry* entry = find(a_key);
+    VERIFY(entry && "No entry at key found")
+    return entry->value;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  const ValueType* PersistentMap<KeyType, ValueType, HasherType, Allocator>::TryGet(const KeyType& a_key) const {
+    const Entry* entry = find(a_key);
+    return entry ? &entry->value : nullptr;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  bool PersistentMap<KeyType, ValueType, HasherType, Allocator>::Exists(const KeyType& a_key) const {
+    return find(a_key) != nullptr;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  void PersistentMap<KeyType, ValueType, HasherType, Allocator>::Clear() {
+    release(m_root);
+    m_root = nullptr;
+    m_size = 0;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  Size PersistentMap<KeyType, ValueType, HasherType, Allocator>::GetSize() const {
+    return m_size;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  bool PersistentMap<KeyType, ValueType, HasherType, Allocator>::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  bool PersistentMap<KeyType, ValueType, HasherType, Allocator>::IsSharedWith(const PersistentMap& a_other) const {
+    return m_root == a_other.m_root;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  algorithms::Hash PersistentMap<KeyType, ValueType, HasherType, Allocator>::GetAlgorithm() const {
+    return m_algorithm;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  String PersistentMap<KeyType, ValueType, HasherType, Allocator>::ToString() const {
+    Size estimate = 15;
+    for(Iterator it = begin(); it != end(); ++it)
+      estimate += StringBuilder::Measure(it.GetKey()) + StringBuilder::Measure(it.GetValue()) + 5;
+
+    StringBuilder builder{estimate};
+    builder.Append("PersistentMap(");
+
+    for(Iterator it = begin(); it != end(); ++it) {
+      if(it != begin())
+        builder.Append(", ");
+      builder.Append(it.GetKey()).Append(" : ").Append(it.GetValue());
+    }
+
+    builder.Append(")");
+    return builder.Build();
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  const ValueType& PersistentMap<KeyType, ValueType, HasherType, Allocator>::operator[](const KeyType& a_key) const {
+    return Get(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  bool PersistentMap<KeyType, ValueType, HasherType, Allocator>::operator==(const PersistentMap& a_other) const {
+    if(m_size != a_other.m_size)
+      return false;
+    if(m_root == a_other.m_root)
+      return true;
+
+    for(Iterator it = begin(); it != end(); ++it) {
+      const ValueType* value = a_other.TryGet(it.GetKey());
+      if(!value || !(*value == it.GetValue()))
+        return false;
+    }
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  bool PersistentMap<KeyType, ValueType, HasherType, Allocator>::operator!=(const PersistentMap& a_other) const {
+    return !(*this == a_other);
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  U64 PersistentMap<KeyType, ValueType, HasherType, Allocator>::hashKey(const KeyType& a_key) const {
+    if constexpr(std::is_invocable_r_v<U64, const HasherType&, const KeyType&, algorithms::Hash>)
+      return m_hasher(a_key, m_algorithm);
+    else
+      return m_hasher(a_key);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  const typename PersistentMap<KeyType, ValueType, HasherType, Allocator>::Entry*
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::find(const KeyType& a_key) const {
+    const U64 hash = hashKey(a_key);
+    const Node* node = m_root;
+
+    for(U32 shift = 0; node; shift += BITS) {
+      if(shift >= COLLISION_SHIFT) {
+        for(U32 i = 0; i < node->entry_count; ++i) {
+          if(node->entries[i].key == a_key)
+            return &node->entries[i];
+        }
+        return nullptr;
+      }
+
+      const U32 slot = bit(hash, shift);
+      if(node->entry_map & slot) {
+        const Entry& entry = node->entries[index(node->entry_map, slot)];
+        return entry.hash == hash && entry.key == a_key ? &entry : nullptr;
+      }
+      if(!(node->child_map & slot))
+        return nullptr;
+
+      node = node->children[index(node->child_map, slot)];
+    }
+    return nullptr;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  bool PersistentMap<KeyType, ValueType, HasherType, Allocator>::insert(Node*& a_node, const U32 a_shift, Entry&& a_entry) {
+    a_node = own(a_node);
+    Node* node = a_node;
+
+    if(a_shift >= COLLISION_SHIFT) {
+      for(U32 i = 0; i < node->entry_count; ++i) {
+        if(node->entries[i].key == a_entry.key) {
+          node->entries[i].value = std::move(a_entry.value);
+          return false;
+        }
+      }
+      insertEntry(node, node->entry_count, std::move(a_entry));
+      return true;
+    }
+
+    const U32 slot = bit(a_entry.hash, a_shift);
+    if(node->child_map & slot)
+      return insert(node->children[index(node->child_map, slot)], a_shift + BITS, std::move(a_entry));
+
+    if(!(node->entry_map & slot)) {
+      insertEntry(node, index(node->entry_map, slot), std::move(a_entry));
+      node->entry_map |= slot;
+      return true;
+    }
+
+    const U32 position = index(node->entry_map, slot);
+    Entry& resident = node->entries[position];
+    if(resident.hash == a_entry.hash && resident.key == a_entry.key) {
+      resident.value = std::move(a_entry.value);
+      return false;
+    }
+
+    // both entries share the slot, so they move down into a new child that tells them apart
+    Node* child = createNode();
+    insert(child, a_shift + BITS, std::move(resident));
+    insert(child, a_shift + BITS, std::move(a_entry));
+
+    eraseEntry(node, position);
+    node->entry_map &= ~slot;
+    insertChild(node, index(node->child_map, slot), child);
+    node->child_map |= slot;
+    return true;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  void PersistentMap<KeyType, ValueType, HasherType, Allocator>::remove(Node*& a_node, const U32 a_shift,
+                                                                        const U64 a_hash, const KeyType& a_key) {
+    a_node = own(a_node);
+    Node* node = a_node;
+
+    if(a_shift >= COLLISION_SHIFT) {
+      for(U32 i = 0; i < node->entry_count; ++i) {
+        if(node->entries[i].key == a_key) {
+          eraseEntry(node, i);
+          return;
+        }
+      }
+      return;
+    }
+
+    const U32 slot = bit(a_hash, a_shift);
+    if(node->entry_map & slot) {
+      eraseEntry(node, index(node->entry_map, slot));
+      node->entry_map &= ~slot;
+      return;
+    }
+
+    const U32 position = index(node->child_map, slot);
+    remove(node->children[position], a_shift + BITS, a_hash, a_key);
+
+    // a child left with a single entry is replaced by the entry
+    Node* child = node->children[position];
+    if(child->child_count == 0 && child->entry_count <= 1) {
+      if(child->entry_count == 1) {
+        insertEntry(node, index(node->entry_map, slot), std::move(child->entries[0]));
+        node->entry_map |= slot;
+      }
+      eraseChild(node, position);
+      node->child_map &= ~slot;
+      release(child);
+    }
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  typename PersistentMap<KeyType, ValueType, HasherType, Allocator>::Node*
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::own(Node* a_node) {
+    if(a_node->refs.Load(Atomic<U32>::MemoryOrder::Acquire) == 1)
+      return a_node;
+
+    Node* copy = createNode();
+    copy->entry_map = a_node->entry_map;
+    copy->child_map = a_node->child_map;
+    copy->entry_count = a_node->entry_count;
+    copy->child_count = a_node->child_count;
+
+    copy->entries = memory::Allocate<Entry>(m_allocator, a_node->entry_count);
+    std::uninitialized_copy_n(a_node->entries, a_node->entry_count, copy->entries);
+    copy->children = memory::Allocate<Node*>(m_allocator, a_node->child_count);
+    for(U32 i = 0; i < a_node->child_count; ++i) {
+      copy->children[i] = a_node->children[i];
+      copy->children[i]->refs.FetchAdd(1, Atomic<U32>::MemoryOrder::Relaxed);
+    }
+
+    // the other copies may have let go in the meantime, so this can be the last reference
+    release(a_node);
+    return copy;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  void PersistentMap<KeyType, ValueType, HasherType, Allocator>::release(Node* a_node) {
+    if(!a_node || a_node->refs.FetchSub(1, Atomic<U32>::MemoryOrder::AcquireRelease) != 1)
+      return;
+
+    for(U32 i = 0; i < a_node->child_count; ++i)
+      release(a_node->children[i]);
+
+    std::destroy_n(a_node->entries, a_node->entry_count);
+    memory::Deallocate(m_allocator, a_node->entries, a_node->entry_count);
+    memory::Deallocate(m_allocator, a_node->children, a_node->child_count);
+    a_node->~Node();
+    memory::Deallocate(m_allocator, a_node, 1);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  void PersistentMap<KeyType, ValueType, HasherType, Allocator>::insertEntry(Node* a_node, const U32 a_index,
+                                                                             Entry&& a_entry) {
+    const U32 count = a_node->entry_count;
+    Entry* entries = memory::Allocate<Entry>(m_allocator, count + 1);
+
+    std::uninitialized_move_n(a_node->entries, a_index, entries);
+    std::construct_at(entries + a_index, std::move(a_entry));
+    std::uninitialized_move_n(a_node->entries + a_index, count - a_index, entries + a_index + 1);
+
+    std::destroy_n(a_node->entries, count);
+    memory::Deallocate(m_allocator, a_node->entries, count);
+    a_node->entries = entries;
+    a_node->entry_count = count + 1;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  void PersistentMap<KeyType, ValueType, HasherType, Allocator>::eraseEntry(Node* a_node, const U32 a_index) {
+    const U32 count = a_node->entry_count;
+    Entry* entries = memory::Allocate<Entry>(m_allocator, count - 1);
+
+    std::uninitialized_move_n(a_node->entries, a_index, entries);
+    std::uninitialized_move_n(a_node->entries + a_index + 1, count - a_index - 1, entries + a_index);
+
+    std::destroy_n(a_node->entries, count);
+    memory::Deallocate(m_allocator, a_node->entries, count);
+    a_node->entries = entries;
+    a_node->entry_count = count - 1;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  void PersistentMap<KeyType, ValueType, HasherType, Allocator>::insertChild(Node* a_node, const U32 a_index,
+                                                                             Node* a_child) {
+    const U32 count = a_node->child_count;
+    Node** children = memory::Allocate<Node*>(m_allocator, count + 1);
+
+    std::copy_n(a_node->children, a_index, children);
+    children[a_index] = a_child;
+    std::copy_n(a_node->children + a_index, count - a_index, children + a_index + 1);
+
+    memory::Deallocate(m_allocator, a_node->children, count);
+    a_node->children = children;
+    a_node->child_count = count + 1;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  void PersistentMap<KeyType, ValueType, HasherType, Allocator>::eraseChild(Node* a_node, const U32 a_index) {
+    const U32 count = a_node->child_count;
+    Node** children = memory::Allocate<Node*>(m_allocator, count - 1);
+
+    std::copy_n(a_node->children, a_index, children);
+    std::copy_n(a_node->children + a_index + 1, count - a_index - 1, children + a_index);
+
+    memory::Deallocate(m_allocator, a_node->children, count);
+    a_node->children = children;
+    a_node->child_count = count - 1;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  typename PersistentMap<KeyType, ValueType, HasherType, Allocator>::Node*
+  PersistentMap<KeyType, ValueType, HasherType, Allocator>::createNode() {
+    return ::new(memory::Allocate<Node>(m_allocator, 1)) Node;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  U32 PersistentMap<KeyType, ValueType, HasherType, Allocator>::bit(const U64 a_hash, const U32 a_shift) {
+    return 1u << ((a_hash >> a_shift) & MASK);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Allocator>
+  U32 PersistentMap<KeyType, ValueType, HasherType, Allocator>::index(const U32 a_map, const U32 a_bit) {
+    return static_cast<U32>(std::popcount(a_map & (a_bit - 1)));
+  }
+}
+
+#endif // NTL_PERSISTENT_MAP_HPP
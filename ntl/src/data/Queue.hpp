@@ -8,17 +8,20 @@
 #ifndef NTL_QUEUE_HPP
 #define NTL_QUEUE_HPP
 
+#include <utility>
+
 #include "data/List.hpp"
 
 namespace ntl {
   /**
    * @brief Constructs a new queue object.
    * @tparam T the type of the elements to store
+   * @tparam Allocator the allocator of the nodes of the internal linked list (see is_allocator)
    */
-  template<typename T>
+  template<typename T, typename Allocator = DefaultAllocator>
   class Queue {
   private:
-    List<T> m_data;
+    List<T, Allocator> m_data;
 
   public:
     /**
@@ -30,11 +33,23 @@ namespace ntl {
      */
     Queue();
 
+    /**
+     * @brief Constructs a new queue allocating its elements using the given allocator.
+     *
+     * @param a_allocator the allocator
+     */
+    explicit Queue(const Allocator& a_allocator);
+
     /**
      * @brief Destroys the queue.
      */
     ~Queue() = default;
 
+    Queue(const Queue&) = default;
+    Queue(Queue&&) noexcept = default;
+    Queue& operator=(const Queue&) = default;
+    Queue& operator=(Queue&&) noexcept = default;
+
     /**
      * @brief Puts a new element at the end of the queue.
      *
@@ -46,6 +61,25 @@ namespace ntl {
      */
     void Put(const T& a_element);
 
+    /**
+     * @brief Puts a new element at the end of the queue by moving it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_element the element to add
+     */
+    void Put(T&& a_element);
+
+    /**
+     * @brief Puts a new element at the end of the queue by constructing it in place.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     */
+    template<typename... Args>
+    void Emplace(Args&&... a_args);
+
     /**
      * @brief Removes the first/oldest element from the queue and returns it.
      *
@@ -53,8 +87,7 @@ namespace ntl {
      *
      * @return the element that was removed from the start of the queue
      *
-     * @note Uses GetFront and RemoveAfter to remove the element from the
-     * internal linked list.
+     * @note Uses RemoveFront to move the element out of the internal linked list.
      */
     T Get();
 
@@ -91,34 +124,47 @@ namespace ntl {
     [[nodiscard]] bool IsEmpty() const;
   };
 
-  template<typename T>
-  Queue<T>::Queue()
-    : m_data{List<T>()} {}
+  template<typename T, typename Allocator>
+  Queue<T, Allocator>::Queue()
+    : m_data{} {}
+
+  template<typename T, typename Allocator>
+  Queue<T, Allocator>::Queue(const Allocator& a_allocator)
+    : m_data{a_allocator} {}
 
-  template<typename T>
-  void Queue<T>::Put(const T& a_element) {
+  template<typename T, typename Allocator>
+  void Queue<T, Allocator>::Put(const T& a_element) {
     m_data.InsertBack(a_element);
   }
 
-  template<typename T>
-  T Queue<T>::Get() {
-    T result = m_data.GetFront()->value;
-    m_data.RemoveAfter(m_data.GetHead());
-    return result;
+  template<typename T, typename Allocator>
+  void Queue<T, Allocator>::Put(T&& a_element) {
+    m_data.InsertBack(std::move(a_element));
+  }
+
+  template<typename T, typename Allocator>
+  template<typename... Args>
+  void Queue<T, Allocator>::Emplace(Args&&... a_args) {
+    m_data.EmplaceBack(std::forward<Args>(a_args)...);
+  }
+
+  template<typename T, typename Allocator>
+  T Queue<T, Allocator>::Get() {
+    return m_data.RemoveFront();
   }
 
-  template<typename T>
-  const T& Queue<T>::Peek() const {
+  template<typename T, typename Allocator>
+  const T& Queue<T, Allocator>::Peek() const {
     return m_data.GetFront()->value;
   }
 
-  template<typename T>
-  Size Queue<T>::GetSize() const {
+  template<typename T, typename Allocator>
+  Size Queue<T, Allocator>::GetSize() const {
     return m_data.GetSize();
   }
 
-  template<typename T>
-  bool Queue<T>::IsEmpty() const {
+  template<typename T, typename Allocator>
+  bool Queue<T, Allocator>::IsEmpty() const {
     return m_data.IsEmpty();
   }
 }
@@ -0,0 +1,455 @@
+/**
+* @file RingQueue.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_RING_QUEUE_HPP
+#define NTL_RING_QUEUE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "data/Size.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Memory.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new queue object storing its elements in a growable ring buffer.
+   *
+   * @details The capacity is always a power of two, so wrapping around is a single mask. Putting
+   * and getting elements never allocates unless the buffer is full, which doubles its capacity.
+   *
+   * @tparam T the type of the elements to store
+   * @tparam Allocator the allocator of the ring buffer (see is_allocator)
+   */
+  template<typename T, typename Allocator = DefaultAllocator>
+  class RingQueue {
+  private:
+    T* m_data;
+    Size m_head,
+         m_size,
+         m_capacity;
+    [[no_unique_address]] Allocator m_allocator;
+
+  public:
+    /**
+     * @brief Default capacity of the ring buffer, allocated on the first Put.
+     */
+    static constexpr Size DEFAULT_CAPACITY = 16;
+
+    /**
+     * @brief Constructs a new empty queue (allocating nothing).
+     *
+     * @details Runtime: O(1)
+     */
+    RingQueue();
+
+    /**
+     * @brief Constructs a new empty queue allocating its buffer using the given allocator.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_allocator the allocator
+     */
+    explicit RingQueue(const Allocator& a_allocator);
+
+    /**
+     * @brief Constructs a new queue from another queue.
+     *
+     * @details Runtime: O(n), where n is the size of the other queue.
+     *
+     * @param a_other the other queue
+     */
+    RingQueue(const RingQueue& a_other);
+
+    /**
+     * @brief Constructs a new queue by taking over the elements of another queue.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other queue (empty with no capacity afterwards)
+     */
+    RingQueue(RingQueue&& a_other) noexcept;
+
+    /**
+     * @brief Destroys the queue.
+     */
+    ~RingQueue();
+
+    /**
+     * @brief Overloading copy assignment operator.
+     * @param a_other the queue to copy the elements from
+     * @return the reference of the current queue object
+     */
+    RingQueue& operator=(const RingQueue& a_other);
+
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other the queue to take the elements from (empty with no capacity afterwards)
+     * @return the reference of the current queue object
+     */
+    RingQueue& operator=(RingQueue&& a_other) noexcept;
+
+    /**
+     * @brief Puts a new element at the end of the queue.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_element the element to add
+     */
+    void Put(const T& a_element);
+
+    /**
+     * @brief Puts a new element at the end of the queue by moving it.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_element the element to add
+     */
+    void Put(T&& a_element);
+
+    /**
+     * @brief Puts a new element at the end of the queue by constructing it in place.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     */
+    template<typename... Args>
+    void Emplace(Args&&... a_args);
+
+    /**
+     * @brief Puts copies of the given elements at the end of the queue in their order.
+     *
+     * @details Runtime: O(m), where m is the number of elements to add (growing at most once).
+     *
+     * @param a_elements the first element to add
+     * @param a_count the number of elements to add
+     */
+    void PutMany(const T* a_elements, Size a_count);
+
+    /**
+     * @brief Removes the first/oldest element from the queue and returns it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the element that was removed from the start of the queue
+     */
+    T Get();
+
+    /**
+     * @brief Removes up to the given number of the oldest elements from the queue.
+     *
+     * @details Runtime: O(m), where m is the number of removed elements.
+     *
+     * @param a_elements receives the removed elements from the oldest one on (moved into existing objects)
+     * @param a_count the maximum number of elements to remove
+     * @return the number of removed elements
+     */
+    Size GetMany(T* a_elements, Size a_count);
+
+    /**
+     * @brief Peeks at the first/oldest element in the queue without copying it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the element that is at the start of the queue
+     */
+    const T& Peek() const;
+
+    /**
+     * @brief Peeks at the first/oldest element in the queue without copying it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the element that is at the start of the queue
+     */
+    T& Peek();
+
+    /**
+     * @brief Makes sure the queue can hold the given number of elements without growing.
+     *
+     * @details Runtime: O(n), where n is the size of the queue (O(1) if the capacity suffices).
+     *
+     * @param a_capacity the number of elements (rounded up to the next power of two)
+     */
+    void Reserve(Size a_capacity);
+
+    /**
+     * @brief Removes all elements from the queue, keeping its capacity.
+     *
+     * @details Runtime: O(n), where n is the size of the queue (O(1) for trivially destructible types)
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the size of the queue.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the queue
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the number of elements the queue can hold before growing.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the capacity of the queue
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the queue is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Gets the allocator of the ring buffer.
+     *
+     * @return the allocator
+     */
+    [[nodiscard]] const Allocator& GetAllocator() const;
+
+  private:
+    /**
+     * @brief Gets the slot of the element at the given position in the queue.
+     *
+     * @param a_position the position (0 is the oldest element)
+     * @return the slot in the ring buffer
+     */
+    T* slot(Size a_position) const;
+
+    /**
+     * @brief Moves the elements into a new buffer of the given capacity, so they start at its first slot.
+     *
+     * @details Runtime: O(n), where n is the size of the queue
+     *
+     * @param a_capacity the new capacity (a power of two, at least the size)
+     */
+    void reallocate(Size a_capacity);
+
+    /**
+     * @brief Destroys all elements and frees the buffer.
+     */
+    void release();
+  };
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template<typename T, typename Allocator>
+  RingQueue<T, Allocator>::RingQueue()
+    : RingQueue(Allocator{}) {
+    // Empty
+  }
+
+  template<typename T, typename Allocator>
+  RingQueue<T, Allocator>::RingQueue(const Allocator& a_allocator)
+    : m_data{nullptr}, m_head{0}, m_size{0}, m_capacity{0}, m_allocator{a_allocator} {
+    // Empty
+  }
+
+  template<typename T, typename Allocator>
+  RingQueue<T, Allocator>::RingQueue(const RingQueue& a_other)
+    : RingQueue(a_other.m_allocator) {
+    Reserve(a_other.m_size);
+    for(Size i = 0; i < a_other.m_size; ++i)
+      std::construct_at(m_data + i, *a_other.slot(i));
+    m_size = a_other.m_size;
+  }
+
+  template<typename T, typename Allocator>
+  RingQueue<T, Allocator>::RingQueue(RingQueue&& a_other) noexcept
+    : m_data{a_other.m_data}, m_head{a_other.m_head}, m_size{a_other.m_size}, m_capacity{a_other.m_capacity},
+      m_allocator{a_other.m_allocator} {
+    a_other.m_data = nullptr;
+    a_other.m_head = 0;
+    a_other.m_size = 0;
+    a_other.m_capacity = 0;
+  }
+
+  template<typename T, typename Allocator>
+  RingQueue<T, Allocator>::~RingQueue() {
+    release();
+  }
+
+  template<typename T, typename Allocator>
+  RingQueue<T, Allocator>& RingQueue<T, Allocator>::operator=(const RingQueue& a_other) {
+    if(this != &a_other)
+      *this = RingQueue(a_other);
+    return *this;
+  }
+
+  template<typename T, typename Allocator>
+  RingQueue<T, Allocator>& RingQueue<T, Allocator>::operator=(RingQueue&& a_other) noexcept {
+    if(this != &a_other) {
+      release();
+      m_data = a_other.m_data;
+      m_head = a_other.m_head;
+      m_size = a_other.m_size;
+      m_capacity = a_other.m_capacity;
+      m_allocator = a_other.m_allocator;
+      a_other.m_data = nullptr;
+      a_other.m_head = 0;
+      a_other.m_size = 0;
+      a_other.m_capacity = 0;
+    }
+    return *this;
+  }
+
+  template<typename T, typename Allocator>
+  void RingQueue<T, Allocator>::Put(const T& a_element) {
+    Emplace(a_element);
+  }
+
+  template<typename T, typename Allocator>
+  void RingQueue<T, Allocator>::Put(T&& a_element) {
+    Emplace(std::move(a_element));
+  }
+
+  template<typename T, typename Allocator>
+  template<typename... Args>
+  void RingQueue<T, Allocator>::Emplace(Args&&... a_args) {
+    if(m_size == m_capacity)
+      reallocate(m_capacity > 0 ? m_capacity * 2 : DEFAULT_CAPACITY);
+
+    std::construct_at(slot(m_size), std::forward<Args>(a_args)...);
+    m_size++;
+  }
+
+  template<typename T, typename Allocator>
+  void RingQueue<T, Allocator>::PutMany(const T* a_elements, Size a_count) {
+    Reserve(m_size + a_count);
+
+    // the free slots wrap around at most once
+    const Size tail = (m_head + m_size) & (m_capacity - 1);
+    const Size first = std::min(a_count, m_capacity - tail);
+    std::uninitialized_copy_n(a_elements, first, m_data + tail);
+    std::uninitialized_copy_n(a_elements + first, a_count - first, m_data);
+
+    m_size += a_count;
+  }
+
+  template<typename T, typename Allocator>
+  T RingQueue<T, Allocator>::Get() {
+    VERIFY(m_size > 0)
+
+    T* first = m_data + m_head;
+    T result = std::move(*first);
+    std::destroy_at(first);
+
+    m_head = (m_head + 1) & (m_capacity - 1);
+    m_size--;
+
+    return result;
+  }
+
+  template<typename T, typename Allocator>
+  Size RingQueue<T, Allocator>::GetMany(T* a_elements, Size a_count) {
+    const Size count = std::min(a_count, m_size);
+
+    const Size first = std::min(count, m_capacity - m_head);
+    std::move(m_data + m_head, m_data + m_head + first, a_elements);
+    std::move(m_data, m_data + count - first, a_elements + first);
+    memory::Destroy(m_data + m_head, first);
+    memory::Destroy(m_data, count - first);
+
+    m_head = m_capacity > 0 ? (m_head + count) & (m_capacity - 1) : 0;
+    m_size -= count;
+
+    return count;
+  }
+
+  template<typename T, typename Allocator>
+  const T& RingQueue<T, Allocator>::Peek() const {
+    VERIFY(m_size > 0)
+    return m_data[m_head];
+  }
+
+  template<typename T, typename Allocator>
+  T& RingQueue<T, Allocator>::Peek() {
+    VERIFY(m_size > 0)
+    return m_data[m_head];
+  }
+
+  template<typename T, typename Allocator>
+  void RingQueue<T, Allocator>::Reserve(Size a_capacity) {
+    if(a_capacity > m_capacity)
+      reallocate(std::bit_ceil(std::max(a_capacity, DEFAULT_CAPACITY)));
+  }
+
+  template<typename T, typename Allocator>
+  void RingQueue<T, Allocator>::Clear() {
+    for(Size i = 0; i < m_size; ++i)
+      memory::Destroy(slot(i), 1);
+    m_head = 0;
+    m_size = 0;
+  }
+
+  template<typename T, typename Allocator>
+  Size RingQueue<T, Allocator>::GetSize() const {
+    return m_size;
+  }
+
+  template<typename T, typename Allocator>
+  Size RingQueue<T, Allocator>::GetCapacity() const {
+    return m_capacity;
+  }
+
+  template<typename T, typename Allocator>
+  bool RingQueue<T, Allocator>::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  template<typename T, typename Allocator>
+  const Allocator& RingQueue<T, Allocator>::GetAllocator() const {
+    return m_allocator;
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template<typename T, typename Allocator>
+  T* RingQueue<T, Allocator>::slot(Size a_position) const {
+    return m_data + ((m_head + a_position) & (m_capacity - 1));
+  }
+
+  template<typename T, typename Allocator>
+  void RingQueue<T, Allocator>::reallocate(Size a_capacity) {
+    T* data = memory::Allocate<T>(m_allocator, a_capacity);
+
+    // the elements occupy at most two ranges: from the head to the end and from the start on
+    const Size first = std::min(m_size, m_capacity - m_head);
+    memory::Relocate(data, m_data + m_head, first);
+    memory::Relocate(data + first, m_data, m_size - first);
+
+    memory::Deallocate(m_allocator, m_data, m_capacity);
+    m_data = data;
+    m_head = 0;
+    m_capacity = a_capacity;
+  }
+
+  template<typename T, typename Allocator>
+  void RingQueue<T, Allocator>::release() {
+    Clear();
+    memory::Deallocate(m_allocator, m_data, m_capacity);
+    m_data = nullptr;
+    m_capacity = 0;
+  }
+}
+
+#endif // NTL_RING_QUEUE_HPP
@@ -0,0 +1,767 @@
+/**
+* @file SmallArray.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_SMALL_ARRAY_HPP
+#define NTL_SMALL_ARRAY_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <utility>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "data/Array.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Memory.hpp"
+#include "utils/Sort.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new growable array object storing up to N elements inline.
+   *
+   * @details Small arrays never touch the heap. Only once more than N elements are inserted, the
+   * elements are relocated into a heap buffer of the allocator, which doubles whenever it is full,
+   * like a growable Array. Moving a small array relocates its inline elements, moving a spilled one
+   * hands over the heap buffer.
+   *
+   * @tparam T the type of the elements to store
+   * @tparam N the number of elements stored inline
+   * @tparam Allocator the allocator of the heap buffer (see is_allocator)
+   */
+  template <typename T, Size N, typename Allocator = DefaultAllocator>
+  class SmallArray {
+  private:
+    CVERIFY(N > 0 && "N must not be zero");
+
+    /**
+     * @brief The inline storage, whose elements are only constructed when used.
+     */
+    union Storage {
+      T values[N];
+
+      Storage() {}
+      ~Storage() {}
+    };
+
+    T* m_data;
+    Size m_used;
+    Size m_capacity;
+    bool m_sorted;
+    Allocator m_allocator;
+    Storage m_storage;
+
+  public:
+    using Iterator = T*;
+    using ConstIterator = const T*;
+
+    /**
+     * @brief Constructs a new empty array.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_allocator the allocator used once the array spills to the heap
+     */
+    explicit SmallArray(const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Constructs a new array holding copies of the given elements in their order.
+     *
+     * @details Runtime: O(m), where m is the number of elements.
+     *
+     * @param a_elements the elements
+     * @param a_allocator the allocator used once the array spills to the heap
+     */
+    SmallArray(std::initializer_list<T> a_elements, const Allocator& a_allocator = Allocator{});
+
+    /**
+     * @brief Destroys the elements and frees the heap buffer (if any).
+     */
+    ~SmallArray();
+
+    /**
+     * @brief Copy Constructor.
+     *
+     * @param a_other a reference to another array
+     */
+    SmallArray(const SmallArray& a_other);
+
+    /**
+     * @brief Move Constructor.
+     *
+     * @param a_other a reference to another array (empty afterwards)
+     */
+    SmallArray(SmallArray&& a_other) noexcept;
+
+    /**
+     * @brief Copy-Assignment operator.
+     *
+     * @param a_other a reference to another array
+     *
+     * @return the reference to the array
+     */
+    SmallArray& operator=(const SmallArray& a_other);
+
+    /**
+     * @brief Move-Assignment operator.
+     *
+     * @param a_other a reference to another array (empty afterwards)
+     *
+     * @return the reference to the array
+     */
+    SmallArray& operator=(SmallArray&& a_other) noexcept;
+
+    /**
+     * @brief Inserts an element at the end of the array.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_element the element to add
+     * @return the index of the element
+     */
+    Size Insert(const T& a_element);
+
+    /**
+     * @brief Inserts an element at the end of the array by moving it.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_element the element to add
+     * @return the index of the element
+     */
+    Size Insert(T&& a_element);
+
+    /**
+     * @brief Constructs a new element at the end of the array.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     * @return the index of the element
+     */
+    template <typename... Args>
+    Size Emplace(Args&&... a_args);
+
+    /**
+     * @brief Inserts an element at the given index, shifting the following elements back.
+     *
+     * @details Runtime: O(n), where n is the number of elements after the index
+     * (using memmove for trivially relocatable types).
+     *
+     * @param a_element the element to add
+     * @param a_index the index of the new element
+     */
+    void Insert(const T& a_element, Size a_index);
+
+    /**
+     * @brief Inserts an element at the given index by moving it, shifting the following elements back.
+     *
+     * @details Runtime: O(n), where n is the number of elements after the index
+     * (using memmove for trivially relocatable types).
+     *
+     * @param a_element the element to add
+     * @param a_index the index of the new element
+     */
+    void Insert(T&& a_element, Size a_index);
+
+    /**
+     * @brief Removes the element at the given index, shifting the following elements forward.
+     *
+     * @details Runtime: O(n), where n is the number of elements after the index
+     * (using memmove for trivially relocatable types).
+     *
+     * @param a_index the index of the element
+     * @return the removed element
+     */
+    T Remove(Size a_index);
+
+    /**
+     * @brief Removes the given element.
+     *
+     * @details Runtime: O(n), where n is the size of the array.
+     *
+     * @param a_element the element to remove
+     * @return the index of the removed element (-1 if not found)
+     */
+    I64 RemoveElement(const T& a_element);
+
+    /**
+     * @brief Removes all elements from the array, keeping its capacity.
+     *
+     * @details Runtime: O(n), where n is the size of the array (O(1) for trivially destructible types)
+     */
+    void Clear();
+
+    /**
+     * @brief Makes sure the array can hold the given number of elements without growing.
+     *
+     * @details Runtime: O(n), where n is the size of the array (O(1) if the capacity suffices).
+     *
+     * @param a_capacity the number of elements
+     */
+    void Reserve(Size a_capacity);
+
+    /**
+     * @brief Sorts the array using the given sorting algorithm (see Array::Sort).
+     *
+     * @details Runtime: depends on the algorithm
+     *
+     * @param a_algorithm the sorting algorithm
+     */
+    void Sort(algorithms::Sort a_algorithm = algorithms::Sort::DYNAMIC);
+
+    /**
+     * @brief Searches the element, using binary search if the array is sorted.
+     *
+     * @details Runtime: O(log(n)) if sorted, O(n) otherwise, where n is the size of the array.
+     *
+     * @param a_element the element to find
+     * @return the index of the element (the last equal one if sorted, -1 if not found)
+     */
+    [[nodiscard]] I64 Find(const T& a_element) const;
+
+    /**
+     * @brief Gets the element at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index
+     * @return the element
+     */
+    const T& Get(Size a_index) const;
+
+    /**
+     * @brief Gets the element at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index
+     * @return the element
+     */
+    T& Get(Size a_index);
+
+    /**
+     * @brief Gets the first element.
+     *
+     * @return the first element
+     */
+    const T& GetFirst() const;
+
+    /**
+     * @brief Gets the first element.
+     *
+     * @return the first element
+     */
+    T& GetFirst();
+
+    /**
+     * @brief Gets the last element.
+     *
+     * @return the last element
+     */
+    const T& GetLast() const;
+
+    /**
+     * @brief Gets the last element.
+     *
+     * @return the last element
+     */
+    T& GetLast();
+
+    /**
+     * @brief Checks if the array is equal to another one.
+     *
+     * @details Runtime: O(n), where n is the size of the array.
+     *
+     * @param a_other the other array
+     * @return if both hold equal elements in the same order
+     */
+    [[nodiscard]] bool IsEqual(const SmallArray& a_other) const;
+
+    /**
+     * @brief Checks if the array is empty.
+     *
+     * @return if the array is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Checks if the array is known to be sorted.
+     *
+     * @return if the array is sorted
+     */
+    [[nodiscard]] bool IsSorted() const;
+
+    /**
+     * @brief Checks if the elements are still stored inline.
+     *
+     * @return if the array didn't spill to the heap
+     */
+    [[nodiscard]] bool IsInline() const;
+
+    /**
+     * @brief Gets the number of elements the array can hold before growing.
+     *
+     * @return the capacity of the array
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Gets the size of the array.
+     *
+     * @return the number of elements
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the elements.
+     *
+     * @return the first element
+     */
+    [[nodiscard]] const T* GetData() const;
+
+    /**
+     * @brief Gets the elements.
+     *
+     * @return the first element
+     */
+    [[nodiscard]] T* GetData();
+
+    /**
+     * @brief Gets the allocator of the heap buffer.
+     *
+     * @return the allocator
+     */
+    [[nodiscard]] const Allocator& GetAllocator() const;
+
+    T& operator[](Size a_index);
+    const T& operator[](Size a_index) const;
+    bool operator==(const SmallArray& a_other) const;
+    bool operator!=(const SmallArray& a_other) const;
+
+    /**
+     * @brief Returns a string representation of the array.
+     *
+     * @return the string, e.g. "SmallArray(1, 2, 3)\n"
+     */
+    [[nodiscard]] String ToString() const;
+
+    Iterator begin();
+    Iterator end();
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+  private:
+    /**
+     * @brief Relocates the elements into a new heap buffer.
+     *
+     * @param a_capacity the capacity of the new buffer (bigger than N)
+     */
+    void reallocate(Size a_capacity);
+
+    /**
+     * @brief Frees the heap buffer (if any) and switches back to the inline storage.
+     *
+     * @details The elements must have been destroyed or relocated before.
+     */
+    void release();
+
+    /**
+     * @brief Takes over the elements of the other array, which is empty and inline afterwards.
+     *
+     * @param a_other the other array
+     */
+    void steal(SmallArray& a_other);
+  };
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_array the array
+   * @return the combined ostream
+   */
+  template <typename T, Size N, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const SmallArray<T, N, Allocator>& a_array) {
+    return (a_stream << a_array.ToString());
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename T, Size N, typename Allocator>
+  SmallArray<T, N, Allocator>::SmallArray(const Allocator& a_allocator)
+    : m_data{m_storage.values}, m_used{0}, m_capacity{N}, m_sorted{true}, m_allocator(a_allocator) {
+    // Empty
+  }
+
+  template <typename T, Size N, typename Allocator>
+  SmallArray<T, N, Allocator>::SmallArray(std::initializer_list<T> a_elements, const Allocator& a_allocator)
+    : SmallArray(a_allocator) {
+    Reserve(a_elements.size());
+    for(const T& element : a_elements)
+      std::construct_at(m_data + m_used++, element);
+    m_sorted = m_used < 2;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  SmallArray<T, N, Allocator>::~SmallArray() {
+    memory::Destroy(m_data, m_used);
+    release();
+  }
+
+  template <typename T, Size N, typename Allocator>
+  SmallArray<T, N, Allocator>::SmallArray(const SmallArray& a_other) : SmallArray(a_other.m_allocator) {
+    Reserve(a_other.m_used);
+    for(; m_used < a_other.m_used; ++m_used)
+      std::construct_at(m_data + m_used, a_other.m_data[m_used]);
+    m_sorted = a_other.m_sorted;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  SmallArray<T, N, Allocator>::SmallArray(SmallArray&& a_other) noexcept : SmallArray(a_other.m_allocator) {
+    steal(a_other);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  SmallArray<T, N, Allocator>& SmallArray<T, N, Allocator>::operator=(const SmallArray& a_other) {
+    if(this != &a_other) {
+      Clear();
+      Reserve(a_other.m_used);
+      for(; m_used < a_other.m_used; ++m_used)
+        std::construct_at(m_data + m_used, a_other.m_data[m_used]);
+      m_sorted = a_other.m_sorted;
+    }
+    return *this;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  SmallArray<T, N, Allocator>& SmallArray<T, N, Allocator>::operator=(SmallArray&& a_other) noexcept {
+    if(this != &a_other) {
+      memory::Destroy(m_data, m_used);
+      m_used = 0;
+      release();
+      m_allocator = a_other.m_allocator;
+      steal(a_other);
+    }
+    return *this;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  Size SmallArray<T, N, Allocator>::Insert(const T& a_element) {
+    return Emplace(a_element);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  Size SmallArray<T, N, Allocator>::Insert(T&& a_element) {
+    return Emplace(std::move(a_element));
+  }
+
+  template <typename T, Size N, typename Allocator>
+  template <typename... Args>
+  Size SmallArray<T, N, Allocator>::Emplace(Args&&... a_args) {
+    if(m_used == m_capacity) {
+      // the arguments might refer to an element of this array, so construct before reallocating
+      T element(std::forward<Args>(a_args)...);
+      reallocate(m_capacity * 2);
+      std::construct_at(m_data + m_used, std::move(element));
+    } else {
+      std::construct_at(m_data + m_used, std::forward<Args>(a_args)...);
+    }
+    m_sorted = false;
+
+    return m_used++;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  void SmallArray<T, N, Allocator>::Insert(const T& a_element, Size a_index) {
+    Insert(T(a_element), a_index);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  void SmallArray<T, N, Allocator>::Insert(T&& a_element, Size a_index) {
+    VERIFY(a_index <= m_used)
+
+    if(m_used == m_capacity)
+      reallocate(m_capacity * 2);
+
+    if constexpr(memory::IsTriviallyRelocatable<T>::value) {
+      std::memmove(static_cast<void*>(m_data + a_index + 1), static_cast<const void*>(m_data + a_index),
+                   (m_used - a_index) * sizeof(T));
+    } else if(a_index < m_used) {
+      std::construct_at(m_data + m_used, std::move(m_data[m_used - 1]));
+      std::move_backward(m_data + a_index, m_data + m_used - 1, m_data + m_used);
+      std::destroy_at(m_data + a_index);
+    }
+    std::construct_at(m_data + a_index, std::move(a_element));
+
+    m_used++;
+    m_sorted = false;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  T SmallArray<T, N, Allocator>::Remove(Size a_index) {
+    VERIFY(a_index < m_used)
+
+    T result = std::move(m_data[a_index]);
+
+    if constexpr(memory::IsTriviallyRelocatable<T>::value) {
+      std::destroy_at(m_data + a_index);
+      std::memmove(static_cast<void*>(m_data + a_index), static_cast<const void*>(m_data + a_index + 1),
+                   (m_used - a_index - 1) * sizeof(T));
+    } else {
+      std::move(m_data + a_index + 1, m_data + m_used, m_data + a_index);
+      std::destroy_at(m_data + m_used - 1);
+    }
+    m_used--;
+
+    return result;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  I64 SmallArray<T, N, Allocator>::RemoveElement(const T& a_element) {
+    const I64 index = Find(a_element);
+    if(index >= 0)
+      Remove(static_cast<Size>(index));
+    return index;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  void SmallArray<T, N, Allocator>::Clear() {
+    memory::Destroy(m_data, m_used);
+    m_used = 0;
+    m_sorted = true;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  void SmallArray<T, N, Allocator>::Reserve(Size a_capacity) {
+    if(a_capacity > m_capacity)
+      reallocate(std::max(a_capacity, m_capacity * 2));
+  }
+
+  template <typename T, Size N, typename Allocator>
+  void SmallArray<T, N, Allocator>::Sort(algorithms::Sort a_algorithm) {
+    if constexpr(has_less_than<T>) {
+      sort::Sort(m_data, m_used, a_algorithm);
+      m_sorted = true;
+    } else {
+      VERIFY(has_less_than<T>)
+    }
+  }
+
+  template <typename T, Size N, typename Allocator>
+  I64 SmallArray<T, N, Allocator>::Find(const T& a_element) const {
+    if constexpr(has_less_than<T>) {
+      if(m_sorted) {
+        // the element can only be right before its upper bound
+        const T* bound = std::upper_bound(m_data, m_data + m_used, a_element);
+        if(bound != m_data && !(*(bound - 1) < a_element))
+          return static_cast<I64>(bound - 1 - m_data);
+        return -1;
+      }
+    }
+
+    for(Size i = 0; i < m_used; ++i) {
+      if(m_data[i] == a_element)
+        return static_cast<I64>(i);
+    }
+    return -1;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  const T& SmallArray<T, N, Allocator>::Get(Size a_index) const {
+    VERIFY(a_index < m_used)
+    return m_data[a_index];
+  }
+
+  template <typename T, Size N, typename Allocator>
+  T& SmallArray<T, N, Allocator>::Get(Size a_index) {
+    VERIFY(a_index < m_used)
+    return m_data[a_index];
+  }
+
+  template <typename T, Size N, typename Allocator>
+  const T& SmallArray<T, N, Allocator>::GetFirst() const {
+    return Get(0);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  T& SmallArray<T, N, Allocator>::GetFirst() {
+    return Get(0);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  const T& SmallArray<T, N, Allocator>::GetLast() const {
+    return Get(m_used - 1);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  T& SmallArray<T, N, Allocator>::GetLast() {
+    return Get(m_used - 1);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  bool SmallArray<T, N, Allocator>::IsEqual(const SmallArray& a_other) const {
+    return std::equal(begin(), end(), a_other.begin(), a_other.end());
+  }
+
+  template <typename T, Size N, typename Allocator>
+  bool SmallArray<T, N, Allocator>::IsEmpty() const {
+    return m_used == 0;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  bool SmallArray<T, N, Allocator>::IsSorted() const {
+    return m_sorted;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  bool SmallArray<T, N, Allocator>::IsInline() const {
+    return m_data == m_storage.values;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  Size SmallArray<T, N, Allocator>::GetCapacity() const {
+    return m_capacity;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  Size SmallArray<T, N, Allocator>::GetSize() const {
+    return m_used;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  const T* SmallArray<T, N, Allocator>::GetData() const {
+    return m_data;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  T* SmallArray<T, N, Allocator>::GetData() {
+    return m_data;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  const Allocator& SmallArray<T, N, Allocator>::GetAllocator() const {
+    return m_allocator;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  T& SmallArray<T, N, Allocator>::operator[](Size a_index) {
+    return Get(a_index);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  const T& SmallArray<T, N, Allocator>::operator[](Size a_index) const {
+    return Get(a_index);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  bool SmallArray<T, N, Allocator>::operator==(const SmallArray& a_other) const {
+    return IsEqual(a_other);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  bool SmallArray<T, N, Allocator>::operator!=(const SmallArray& a_other) const {
+    return !IsEqual(a_other);
+  }
+
+  template <typename T, Size N, typename Allocator>
+  String SmallArray<T, N, Allocator>::ToString() const {
+    Size estimate = 13;
+    for(Size i = 0; i < m_used; ++i)
+      estimate += StringBuilder::Measure(m_data[i]) + 2;
+
+    StringBuilder builder{estimate};
+    builder.Append("SmallArray(");
+
+    for(Size i = 0; i < m_used; ++i) {
+      if(i > 0)
+        builder.Append(", ");
+      builder.Append(m_data[i]);
+    }
+
+    builder.Append(")\n");
+    return builder.Build();
+  }
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+
+  template <typename T, Size N, typename Allocator>
+  typename SmallArray<T, N, Allocator>::Iterator SmallArray<T, N, Allocator>::begin() {
+    return m_data;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  typename SmallArray<T, N, Allocator>::Iterator SmallArray<T, N, Allocator>::end() {
+    return m_data + m_used;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  typename SmallArray<T, N, Allocator>::ConstIterator SmallArray<T, N, Allocator>::begin() const {
+    return m_data;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  typename SmallArray<T, N, Allocator>::ConstIterator SmallArray<T, N, Allocator>::end() const {
+    return m_data + m_used;
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename T, Size N, typename Allocator>
+  void SmallArray<T, N, Allocator>::reallocate(Size a_capacity) {
+    T* temp = memory::Allocate<T>(m_allocator, a_capacity);
+
+    memory::Relocate(temp, m_data, m_used);
+
+    release();
+    m_data = temp;
+    m_capacity = a_capacity;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  void SmallArray<T, N, Allocator>::release() {
+    if(!IsInline())
+      memory::Deallocate(m_allocator, m_data, m_capacity);
+
+    m_data = m_storage.values;
+    m_capacity = N;
+  }
+
+  template <typename T, Size N, typename Allocator>
+  void SmallArray<T, N, Allocator>::steal(SmallArray& a_other) {
+    if(a_other.IsInline()) {
+      memory::Relocate(m_storage.values, a_other.m_data, a_other.m_used);
+    } else {
+      m_data = a_other.m_data;
+      m_capacity = a_other.m_capacity;
+      a_other.m_data = a_other.m_storage.values;
+      a_other.m_capacity = N;
+    }
+
+    m_used = a_other.m_used;
+    m_sorted = a_other.m_sorted;
+    a_other.m_used = 0;
+    a_other.m_sorted = true;
+  }
+}
+
+#endif // NTL_SMALL_ARRAY_HPP
@@ -8,17 +8,20 @@
 #ifndef NTL_STACK_HPP
 #define NTL_STACK_HPP
 
+#include <utility>
+
 #include "data/List.hpp"
 
 namespace ntl {
   /**
    * @brief Constructs a new stack object.
    * @tparam T the type of the elements to store
+   * @tparam Allocator the allocator of the nodes of the internal linked list (see is_allocator)
    */
-  template<typename T>
+  template<typename T, typename Allocator = DefaultAllocator>
   class Stack {
   private:
-    List<T> m_data;
+    List<T, Allocator> m_data;
 
   public:
     /**
@@ -30,11 +33,23 @@ namespace ntl {
      */
     Stack();
 
+    /**
+     * @brief Constructs a new stack allocating its elements using the given allocator.
+     *
+     * @param a_allocator the allocator
+     */
+    explicit Stack(const Allocator& a_allocator);
+
     /**
      * @brief Destroys the stack.
      */
     ~Stack() = default;
 
+    Stack(const Stack&) = default;
+    Stack(Stack&&) noexcept = default;
+    Stack& operator=(const Stack&) = default;
+    Stack& operator=(Stack&&) noexcept = default;
+
     /**
      * @brief Pushes a new element onto the top of the stack.
      *
@@ -46,6 +61,25 @@ namespace ntl {
      */
     void Push(const T& a_element);
 
+    /**
+     * @brief Pushes a new element onto the top of the stack by moving it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_element the element to add
+     */
+    void Push(T&& a_element);
+
+    /**
+     * @brief Pushes a new element onto the top of the stack by constructing it in place.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     */
+    template<typename... Args>
+    void Emplace(Args&&... a_args);
+
     /**
      * @brief Removes the top element from the stack and returns it.
      *
@@ -53,8 +87,7 @@ namespace ntl {
      *
      * @return the element that was removed from the top of the stack
      *
-     * @note Uses GetFront and RemoveAfter to remove the element from the
-     * internal linked list.
+     * @note Uses RemoveFront to move the element out of the internal linked list.
      */
     T Pop();
 
@@ -91,34 +124,47 @@ namespace ntl {
     [[nodiscard]] bool IsEmpty() const;
   };
 
-  template<typename T>
-  Stack<T>::Stack()
-    : m_data{List<T>()} {}
+  template<typename T, typename Allocator>
+  Stack<T, Allocator>::Stack()
+    : m_data{} {}
+
+  template<typename T, typename Allocator>
+  Stack<T, Allocator>::Stack(const Allocator& a_allocator)
+    : m_data{a_allocator} {}
 
-  template<typename T>
-  void Stack<T>::Push(const T& a_element) {
+  template<typename T, typename Allocator>
+  void Stack<T, Allocator>::Push(const T& a_element) {
     m_data.InsertFront(a_element);
   }
 
-  template<typename T>
-  T Stack<T>::Pop() {
-    T result = m_data.GetFront()->value;
-    m_data.RemoveAfter(m_data.GetHead());
-    return result;
+  template<typename T, typename Allocator>
+  void Stack<T, Allocator>::Push(T&& a_element) {
+    m_data.InsertFront(std::move(a_element));
+  }
+
+  template<typename T, typename Allocator>
+  template<typename... Args>
+  void Stack<T, Allocator>::Emplace(Args&&... a_args) {
+    m_data.EmplaceFront(std::forward<Args>(a_args)...);
+  }
+
+  template<typename T, typename Allocator>
+  T Stack<T, Allocator>::Pop() {
+    return m_data.RemoveFront();
   }
 
-  template<typename T>
-  const T& Stack<T>::Peek() const {
+  template<typename T, typename Allocator>
+  const T& Stack<T, Allocator>::Peek() const {
     return m_data.GetFront()->value;
   }
 
-  template<typename T>
-  Size Stack<T>::GetSize() const {
+  template<typename T, typename Allocator>
+  Size Stack<T, Allocator>::GetSize() const {
     return m_data.GetSize();
   }
 
-  template<typename T>
-  bool Stack<T>::IsEmpty() const {
+  template<typename T, typename Allocator>
+  bool Stack<T, Allocator>::IsEmpty() const {
     return m_data.IsEmpty();
   }
 }
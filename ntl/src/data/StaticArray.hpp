@@ -0,0 +1,665 @@
+/**
+* @file StaticArray.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_STATIC_ARRAY_HPP
+#define NTL_STATIC_ARRAY_HPP
+
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <utility>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "data/Array.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Sort.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new array object storing up to N elements inline, without ever allocating.
+   *
+   * @details Only the used slots hold constructed elements, like in Array. All methods but ToString
+   * are constexpr, so the array can be built and sorted while compiling. Inserting into a full
+   * array is a verify failure.
+   *
+   * @tparam T the type of the elements to store
+   * @tparam N the capacity of the array
+   */
+  template <typename T, Size N>
+  class StaticArray {
+  private:
+    CVERIFY(N > 0 && "N must not be zero");
+
+    /**
+     * @brief The inline storage, whose elements are only constructed when used.
+     */
+    union Storage {
+      T values[N];
+
+      constexpr Storage() {}
+      constexpr ~Storage() {}
+    };
+
+    Storage m_storage;
+    Size m_used;
+    bool m_sorted;
+
+  public:
+    using Iterator = T*;
+    using ConstIterator = const T*;
+
+    /**
+     * @brief Constructs a new empty array.
+     *
+     * @details Runtime: O(1)
+     */
+    constexpr StaticArray();
+
+    /**
+     * @brief Constructs a new array holding copies of the given elements in their order.
+     *
+     * @details Runtime: O(m), where m is the number of elements.
+     *
+     * @param a_elements the elements (at most N)
+     */
+    constexpr StaticArray(std::initializer_list<T> a_elements);
+
+    /**
+     * @brief Destroys the used elements.
+     */
+    constexpr ~StaticArray();
+
+    /**
+     * @brief Copy Constructor.
+     *
+     * @param a_other a reference to another array
+     */
+    constexpr StaticArray(const StaticArray& a_other);
+
+    /**
+     * @brief Move Constructor, moving the elements one by one.
+     *
+     * @param a_other a reference to another array
+     */
+    constexpr StaticArray(StaticArray&& a_other) noexcept;
+
+    /**
+     * @brief Copy-Assignment operator.
+     *
+     * @param a_other a reference to another array
+     *
+     * @return the reference to the array
+     */
+    constexpr StaticArray& operator=(const StaticArray& a_other);
+
+    /**
+     * @brief Move-Assignment operator, moving the elements one by one.
+     *
+     * @param a_other a reference to another array
+     *
+     * @return the reference to the array
+     */
+    constexpr StaticArray& operator=(StaticArray&& a_other) noexcept;
+
+    /**
+     * @brief Inserts an element at the end of the array.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_element the element to add
+     * @return the index of the element
+     */
+    constexpr Size Insert(const T& a_element);
+
+    /**
+     * @brief Inserts an element at the end of the array by moving it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_element the element to add
+     * @return the index of the element
+     */
+    constexpr Size Insert(T&& a_element);
+
+    /**
+     * @brief Constructs a new element at the end of the array.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     * @return the index of the element
+     */
+    template <typename... Args>
+    constexpr Size Emplace(Args&&... a_args);
+
+    /**
+     * @brief Inserts an element at the given index, shifting the following elements back.
+     *
+     * @details Runtime: O(n), where n is the number of elements after the index.
+     *
+     * @param a_element the element to add
+     * @param a_index the index of the new element
+     */
+    constexpr void Insert(const T& a_element, Size a_index);
+
+    /**
+     * @brief Inserts an element at the given index by moving it, shifting the following elements back.
+     *
+     * @details Runtime: O(n), where n is the number of elements after the index.
+     *
+     * @param a_element the element to add
+     * @param a_index the index of the new element
+     */
+    constexpr void Insert(T&& a_element, Size a_index);
+
+    /**
+     * @brief Removes the element at the given index, shifting the following elements forward.
+     *
+     * @details Runtime: O(n), where n is the number of elements after the index.
+     *
+     * @param a_index the index of the element
+     * @return the removed element
+     */
+    constexpr T Remove(Size a_index);
+
+    /**
+     * @brief Removes the given element.
+     *
+     * @details Runtime: O(n), where n is the size of the array.
+     *
+     * @param a_element the element to remove
+     * @return the index of the removed element (-1 if not found)
+     */
+    constexpr I64 RemoveElement(const T& a_element);
+
+    /**
+     * @brief Removes all elements from the array.
+     *
+     * @details Runtime: O(n), where n is the size of the array (O(1) for trivially destructible types)
+     */
+    constexpr void Clear();
+
+    /**
+     * @brief Sorts the array using the given sorting algorithm (see Array::Sort).
+     *
+     * @details Runtime: depends on the algorithm. While compiling, std::sort is used instead.
+     *
+     * @param a_algorithm the sorting algorithm
+     */
+    constexpr void Sort(algorithms::Sort a_algorithm = algorithms::Sort::DYNAMIC);
+
+    /**
+     * @brief Searches the element, using binary search if the array is sorted.
+     *
+     * @details Runtime: O(log(n)) if sorted, O(n) otherwise, where n is the size of the array.
+     *
+     * @param a_element the element to find
+     * @return the index of the element (the last equal one if sorted, -1 if not found)
+     */
+    [[nodiscard]] constexpr I64 Find(const T& a_element) const;
+
+    /**
+     * @brief Gets the element at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index
+     * @return the element
+     */
+    constexpr const T& Get(Size a_index) const;
+
+    /**
+     * @brief Gets the element at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index
+     * @return the element
+     */
+    constexpr T& Get(Size a_index);
+
+    /**
+     * @brief Gets the first element.
+     *
+     * @return the first element
+     */
+    constexpr const T& GetFirst() const;
+
+    /**
+     * @brief Gets the first element.
+     *
+     * @return the first element
+     */
+    constexpr T& GetFirst();
+
+    /**
+     * @brief Gets the last element.
+     *
+     * @return the last element
+     */
+    constexpr const T& GetLast() const;
+
+    /**
+     * @brief Gets the last element.
+     *
+     * @return the last element
+     */
+    constexpr T& GetLast();
+
+    /**
+     * @brief Checks if the array is equal to another one.
+     *
+     * @details Runtime: O(n), where n is the size of the array.
+     *
+     * @param a_other the other array
+     * @return if both hold equal elements in the same order
+     */
+    [[nodiscard]] constexpr bool IsEqual(const StaticArray& a_other) const;
+
+    /**
+     * @brief Checks if the array is empty.
+     *
+     * @return if the array is empty
+     */
+    [[nodiscard]] constexpr bool IsEmpty() const;
+
+    /**
+     * @brief Checks if the array is full.
+     *
+     * @return if the array holds N elements
+     */
+    [[nodiscard]] constexpr bool IsFull() const;
+
+    /**
+     * @brief Checks if the array is known to be sorted.
+     *
+     * @return if the array is sorted
+     */
+    [[nodiscard]] constexpr bool IsSorted() const;
+
+    /**
+     * @brief Gets the capacity of the array.
+     *
+     * @return N
+     */
+    [[nodiscard]] static constexpr Size GetCapacity();
+
+    /**
+     * @brief Gets the size of the array.
+     *
+     * @return the number of elements
+     */
+    [[nodiscard]] constexpr Size GetSize() const;
+
+    /**
+     * @brief Gets the elements.
+     *
+     * @return the first element
+     */
+    [[nodiscard]] constexpr const T* GetData() const;
+
+    /**
+     * @brief Gets the elements.
+     *
+     * @return the first element
+     */
+    [[nodiscard]] constexpr T* GetData();
+
+    constexpr T& operator[](Size a_index);
+    constexpr const T& operator[](Size a_index) const;
+    constexpr bool operator==(const StaticArray& a_other) const;
+    constexpr bool operator!=(const StaticArray& a_other) const;
+
+    /**
+     * @brief Returns a string representation of the array.
+     *
+     * @return the string, e.g. "StaticArray(1, 2, 3)\n"
+     */
+    [[nodiscard]] String ToString() const;
+
+    constexpr Iterator begin();
+    constexpr Iterator end();
+    constexpr ConstIterator begin() const;
+    constexpr ConstIterator end() const;
+
+  private:
+    /**
+     * @brief Moves the elements from the index on back by one slot, leaving the slot at the index destroyed.
+     *
+     * @param a_index the index of the gap
+     */
+    constexpr void openGap(Size a_index);
+  };
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_array the array
+   * @return the combined ostream
+   */
+  template <typename T, Size N>
+  std::ostream& operator<<(std::ostream& a_stream, const StaticArray<T, N>& a_array) {
+    return (a_stream << a_array.ToString());
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename T, Size N>
+  constexpr StaticArray<T, N>::StaticArray() : m_used{0}, m_sorted{true} {
+    // Empty
+  }
+
+  template <typename T, Size N>
+  constexpr StaticArray<T, N>::StaticArray(std::initializer_list<T> a_elements) : StaticArray() {
+    VERIFY(a_elements.size() <= N)
+
+    for(const T& element : a_elements)
+      std::construct_at(&m_storage.values[m_used++], element);
+    m_sorted = m_used < 2;
+  }
+
+  template <typename T, Size N>
+  constexpr StaticArray<T, N>::~StaticArray() {
+    Clear();
+  }
+
+  template <typename T, Size N>
+  constexpr StaticArray<T, N>::StaticArray(const StaticArray& a_other) : m_used{0}, m_sorted{a_other.m_sorted} {
+    for(; m_used < a_other.m_used; ++m_used)
+      std::construct_at(&m_storage.values[m_used], a_other.m_storage.values[m_used]);
+  }
+
+  template <typename T, Size N>
+  constexpr StaticArray<T, N>::StaticArray(StaticArray&& a_other) noexcept : m_used{0}, m_sorted{a_other.m_sorted} {
+    for(; m_used < a_other.m_used; ++m_used)
+      std::construct_at(&m_storage.values[m_used], std::move(a_other.m_storage.values[m_used]));
+    a_other.Clear();
+  }
+
+  template <typename T, Size N>
+  constexpr StaticArray<T, N>& StaticArray<T, N>::operator=(const StaticArray& a_other) {
+    if(this != &a_other) {
+      Clear();
+      for(; m_used < a_other.m_used; ++m_used)
+        std::construct_at(&m_storage.values[m_used], a_other.m_storage.values[m_used]);
+      m_sorted = a_other.m_sorted;
+    }
+    return *this;
+  }
+
+  template <typename T, Size N>
+  constexpr StaticArray<T, N>& StaticArray<T, N>::operator=(StaticArray&& a_other) noexcept {
+    if(this != &a_other) {
+      Clear();
+      for(; m_used < a_other.m_used; ++m_used)
+        std::construct_at(&m_storage.values[m_used], std::move(a_other.m_storage.values[m_used]));
+      m_sorted = a_other.m_sorted;
+      a_other.Clear();
+    }
+    return *this;
+  }
+
+  template <typename T, Size N>
+  constexpr Size StaticArray<T, N>::Insert(const T& a_element) {
+    return Emplace(a_element);
+  }
+
+  template <typename T, Size N>
+  constexpr Size StaticArray<T, N>::Insert(T&& a_element) {
+    return Emplace(std::move(a_element));
+  }
+
+  template <typename T, Size N>
+  template <typename... Args>
+  constexpr Size StaticArray<T, N>::Emplace(Args&&... a_args) {
+    VERIFY(m_used < N)
+
+    std::construct_at(&m_storage.values[m_used], std::forward<Args>(a_args)...);
+    m_sorted = false;
+
+    return m_used++;
+  }
+
+  template <typename T, Size N>
+  constexpr void StaticArray<T, N>::Insert(const T& a_element, Size a_index) {
+    Insert(T(a_element), a_index);
+  }
+
+  template <typename T, Size N>
+  constexpr void StaticArray<T, N>::Insert(T&& a_element, Size a_index) {
+    VERIFY(a_index <= m_used && m_used < N)
+
+    openGap(a_index);
+    std::construct_at(&m_storage.values[a_index], std::move(a_element));
+    m_used++;
+    m_sorted = false;
+  }
+
+  template <typename T, Size N>
+  constexpr T StaticArray<T, N>::Remove(Size a_index) {
+    VERIFY(a_index < m_used)
+
+    T result = std::move(m_storage.values[a_index]);
+    std::move(m_storage.values + a_index + 1, m_storage.values + m_used, m_storage.values + a_index);
+    std::destroy_at(&m_storage.values[--m_used]);
+
+    return result;
+  }
+
+  template <typename T, Size N>
+  constexpr I64 StaticArray<T, N>::RemoveElement(const T& a_element) {
+    const I64 index = Find(a_element);
+    if(index >= 0)
+      Remove(static_cast<Size>(index));
+    return index;
+  }
+
+  template <typename T, Size N>
+  constexpr void StaticArray<T, N>::Clear() {
+    if constexpr(!std::is_trivially_destructible_v<T>) {
+      for(Size i = 0; i < m_used; ++i)
+        std::destroy_at(&m_storage.values[i]);
+    }
+    m_used = 0;
+    m_sorted = true;
+  }
+
+  template <typename T, Size N>
+  constexpr void StaticArray<T, N>::Sort(algorithms::Sort a_algorithm) {
+    if constexpr(has_less_than<T>) {
+      if consteval {
+        std::sort(m_storage.values, m_storage.values + m_used);
+      } else {
+        sort::Sort(m_storage.values, m_used, a_algorithm);
+      }
+      m_sorted = true;
+    } else {
+      VERIFY(has_less_than<T>)
+    }
+  }
+
+  template <typename T, Size N>
+  constexpr I64 StaticArray<T, N>::Find(const T& a_element) const {
+    if constexpr(has_less_than<T>) {
+      if(m_sorted) {
+        // the element can only be right before its upper bound
+        const T* bound = std::upper_bound(m_storage.values, m_storage.values + m_used, a_element);
+        if(bound != m_storage.values && !(*(bound - 1) < a_element))
+          return static_cast<I64>(bound - 1 - m_storage.values);
+        return -1;
+      }
+    }
+
+    for(Size i = 0; i < m_used; ++i) {
+      if(m_storage.values[i] == a_element)
+        return static_cast<I64>(i);
+    }
+    return -1;
+  }
+
+  template <typename T, Size N>
+  constexpr const T& StaticArray<T, N>::Get(Size a_index) const {
+    VERIFY(a_index < m_used)
+    return m_storage.values[a_index];
+  }
+
+  template <typename T, Size N>
+  constexpr T& StaticArray<T, N>::Get(Size a_index) {
+    VERIFY(a_index < m_used)
+    return m_storage.values[a_index];
+  }
+
+  template <typename T, Size N>
+  constexpr const T& StaticArray<T, N>::GetFirst() const {
+    return Get(0);
+  }
+
+  template <typename T, Size N>
+  constexpr T& StaticArray<T, N>::GetFirst() {
+    return Get(0);
+  }
+
+  template <typename T, Size N>
+  constexpr const T& StaticArray<T, N>::GetLast() const {
+    return Get(m_used - 1);
+  }
+
+  template <typename T, Size N>
+  constexpr T& StaticArray<T, N>::GetLast() {
+    return Get(m_used - 1);
+  }
+
+  template <typename T, Size N>
+  constexpr bool StaticArray<T, N>::IsEqual(const StaticArray& a_other) const {
+    return std::equal(begin(), end(), a_other.begin(), a_other.end());
+  }
+
+  template <typename T, Size N>
+  constexpr bool StaticArray<T, N>::IsEmpty() const {
+    return m_used == 0;
+  }
+
+  template <typename T, Size N>
+  constexpr bool StaticArray<T, N>::IsFull() const {
+    return m_used == N;
+  }
+
+  template <typename T, Size N>
+  constexpr bool StaticArray<T, N>::IsSorted() const {
+    return m_sorted;
+  }
+
+  template <typename T, Size N>
+  constexpr Size StaticArray<T, N>::GetCapacity() {
+    return N;
+  }
+
+  template <typename T, Size N>
+  constexpr Size StaticArray<T, N>::GetSize() const {
+    return m_used;
+  }
+
+  template <typename T, Size N>
+  constexpr const T* StaticArray<T, N>::GetData() const {
+    return m_storage.values;
+  }
+
+  template <typename T, Size N>
+  constexpr T* StaticArray<T, N>::GetData() {
+    return m_storage.values;
+  }
+
+  template <typename T, Size N>
+  constexpr T& StaticArray<T, N>::operator[](Size a_index) {
+    return Get(a_index);
+  }
+
+  template <typename T, Size N>
+  constexpr const T& StaticArray<T, N>::operator[](Size a_index) const {
+    return Get(a_index);
+  }
+
+  template <typename T, Size N>
+  constexpr bool StaticArray<T, N>::operator==(const StaticArray& a_other) const {
+    return IsEqual(a_other);
+  }
+
+  template <typename T, Size N>
+  constexpr bool StaticArray<T, N>::operator!=(const StaticArray& a_other) const {
+    return !IsEqual(a_other);
+  }
+
+  template <typename T, Size N>
+  String StaticArray<T, N>::ToString() const {
+    Size estimate = 14;
+    for(Size i = 0; i < m_used; ++i)
+      estimate += StringBuilder::Measure(m_storage.values[i]) + 2;
+
+    StringBuilder builder{estimate};
+    builder.Append("StaticArray(");
+
+    for(Size i = 0; i < m_used; ++i) {
+      if(i > 0)
+        builder.Append(", ");
+      builder.Append(m_storage.values[i]);
+    }
+
+    builder.Append(")\n");
+    return builder.Build();
+  }
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+
+  template <typename T, Size N>
+  constexpr typename StaticArray<T, N>::Iterator StaticArray<T, N>::begin() {
+    return m_storage.values;
+  }
+
+  template <typename T, Size N>
+  constexpr typename StaticArray<T, N>::Iterator StaticArray<T, N>::end() {
+    return m_storage.values + m_used;
+  }
+
+  template <typename T, Size N>
+  constexpr typename StaticArray<T, N>::ConstIterator StaticArray<T, N>::begin() const {
+    return m_storage.values;
+  }
+
+  template <typename T, Size N>
+  constexpr typename StaticArray<T, N>::ConstIterator StaticArray<T, N>::end() const {
+    return m_storage.values + m_used;
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename T, Size N>
+  constexpr void StaticArray<T, N>::openGap(Size a_index) {
+    if(a_index == m_used)
+      return;
+
+    std::construct_at(&m_storage.values[m_used], std::move(m_storage.values[m_used - 1]));
+    std::move_backward(m_storage.values + a_index, m_storage.values + m_used - 1, m_storage.values + m_used);
+    std::destroy_at(&m_storage.values[a_index]);
+  }
+}
+
+#endif // NTL_STATIC_ARRAY_HPP
@@ -7,7 +7,13 @@
 
 #include "String.hpp"
 
-#include "data/Array.hpp"
+#include <atomic>
+#include <functional>
+#include <utility>
+
+#include "data/StaticArray.hpp"
+#include "utils/Profile.hpp"
+#include "utils/Trace.hpp"
 
 namespace ntl {
   /*********************************************************************************************************************
@@ -57,240 +63,256 @@ namespace ntl {
    ********************************************************************************************************************/
 
   String::String()
-    : m_capacity{DEFAULT_STRING_SIZE}, m_used{0}, m_data{new char[m_capacity + 1]} {
+    : m_capacity{NTL_STRING_SSO_CAPACITY}, m_used{0}, m_data{m_local}
+#if NTL_STRING_CACHE_HASH
+    , m_hash{0}
+#endif
+  {
     m_data[m_used] = '\0';
   }
 
   String::String(char a_char)
-    : m_capacity{DEFAULT_STRING_SIZE}, m_used{1}, m_data{new char[m_capacity + 1]} {
+    : m_capacity{NTL_STRING_SSO_CAPACITY}, m_used{1}, m_data{m_local}
+#if NTL_STRING_CACHE_HASH
+    , m_hash{0}
+#endif
+  {
     m_data[m_used - 1] = a_char;
     m_data[m_used] = '\0';
   }
 
   String::String(const char* a_string)
-    : m_used{std::strlen(a_string)}, m_data{new char[(m_used * 2) + 1]} {
+    : String() {
     VERIFY(a_string != nullptr)
+    assign(a_string, std::strlen(a_string));
+  }
 
-    m_capacity = m_used * 2;
-    std::copy_n(a_string, m_used, m_data);
-    m_data[m_used] = '\0';
+  String::String(StringView a_view)
+    : String() {
+    assign(a_view.GetData(), a_view.GetLength());
   }
 
-  String::~String() { delete[] m_data; }
+  String::~String() { release(); }
 
   String::String(const String& a_other)
-    : m_capacity{a_other.m_used * 2}, m_used{a_other.m_used}, m_data{new char[m_capacity + 1]} {
-    std::copy_n(a_other.m_data, m_used, m_data);
-    m_data[m_used] = '\0';
+    : String() {
+    assign(a_other.m_data, a_other.m_used);
   }
 
-  String::String(String&& a_other) noexcept : String() { swap(*this, a_other); }
+  String::String(String&& a_other) noexcept : String() { *this = std::move(a_other); }
 
   /*********************************************************************************************************************
    *                                                     STRING                                                        *
    *                                                 PUBLIC METHODS                                                    *
    ********************************************************************************************************************/
 
-  String& String::Append(const String& a_other) {
-    const Size total_len = m_used + a_other.m_used;
-
-    if (total_len >= m_capacity) {
-      Resize(total_len * 2);
+  void String::Reserve(const Size a_capacity) {
+    if (a_capacity > m_capacity) {
+      Resize(a_capacity);
     }
+  }
 
-    for (Size i = 0; i < a_other.m_used; ++i) {
-      m_data[m_used + i] = a_other.m_data[i];
-    }
+  void String::ShrinkToFit() {
+    if (isLocal() || m_used == m_capacity)
+      return;
 
-    m_used = total_len;
-    m_data[m_used] = '\0';
+    char* data = m_used <= NTL_STRING_SSO_CAPACITY ? m_local : new char[m_used + 1];
+    std::memcpy(data, m_data, m_used + 1);
+    if (data != m_local)
+      NTL_PROFILE_RECORD(profile::RecordStringAllocation());
+    NTL_PROFILE_RECORD(profile::RecordStringCopy(m_used));
 
+    release();
+    m_data = data;
+    m_capacity = isLocal() ? NTL_STRING_SSO_CAPACITY : m_used;
+  }
+
+  String& String::Append(const String& a_other) {
+    append(a_other.m_data, a_other.m_used);
     return *this;
   }
 
   String& String::Append(const char* a_other) {
-    const Size other_len = std::strlen(a_other);
-    const Size total_len = m_used + other_len;
-
-    if (total_len >= m_capacity) {
-      Resize(total_len * 2);
-    }
-
-    for (Size i = 0; i < other_len; ++i) {
-      m_data[m_used + i] = a_other[i];
-    }
-
-    m_used = total_len;
-    m_data[m_used] = '\0';
+    VERIFY(a_other != nullptr)
+    append(a_other, std::strlen(a_other));
     return *this;
   }
 
   String& String::Append(const char a_other) {
-    const Size total_len = m_used + 1;
-
-    if (total_len >= m_capacity) {
-      Resize(total_len * 2);
-    }
-
-    m_data[m_used] = a_other;
+    append(&a_other, 1);
+    return *this;
+  }
 
-    m_used = total_len;
-    m_data[m_used] = '\0';
+  String& String::Append(const int a_other) {
+    appendNumber(a_other);
     return *this;
   }
 
-  String& String::Append(const int a_other) { return Append(std::to_string(a_other).c_str()); }
+  String& String::Append(const Size a_other) {
+    appendNumber(a_other);
+    return *this;
+  }
 
-  String& String::Append(const Size a_other) { return Append(std::to_string(a_other).c_str()); }
+  String& String::Append(const double a_other) {
+    appendNumber(a_other);
+    return *this;
+  }
 
-  String& String::Append(const double a_other) { return Append(std::to_string(a_other).c_str()); }
+  String& String::Append(const float a_other) {
+    appendNumber(a_other);
+    return *this;
+  }
 
-  String& String::Append(const float a_other) { return Append(std::to_string(a_other).c_str()); }
+  String& String::Append(const bool a_other) { return a_other ? Append(StringView{"true", 4}) : Append(StringView{"false", 5}); }
 
-  String& String::Append(const bool a_other) { return Append(a_other ? "true" : "false"); }
+  String& String::Append(const StringView a_other) {
+    append(a_other.GetData(), a_other.GetLength());
+    return *this;
+  }
 
   String& String::Remove(const char a_other) { return Replace(a_other, '\0'); }
 
   String& String::Clear() {
-    delete[] m_data;
+    invalidateHash();
+    if (!isLocal() && m_capacity > NTL_STRING_MAX_RETAINED_CAPACITY) {
+      release();
+      m_data = m_local;
+      m_capacity = NTL_STRING_SSO_CAPACITY;
+    }
+
     m_used = 0;
-    m_data = new char[m_capacity + 1];
     m_data[m_used] = '\0';
 
     return *this;
   }
 
   void String::Resize(const Size a_capacity) {
-    VERIFY(a_capacity >= (m_used + 1))
+    VERIFY(a_capacity >= m_used)
     VERIFY(a_capacity > m_capacity)
 
-    m_capacity = a_capacity;
-    auto* temp = new char[m_capacity];
-
-    for (Size i = 0; i < m_used; ++i) {
-      temp[i] = m_data[i];
-    }
-    temp[m_used] = '\0';
+    auto* temp = new char[a_capacity + 1];
+    std::memcpy(temp, m_data, m_used + 1);
+    NTL_PROFILE_RECORD(profile::RecordStringAllocation());
+    NTL_PROFILE_RECORD(profile::RecordStringCopy(m_used));
 
-    delete[] m_data;
+    release();
     m_data = temp;
+    m_capacity = a_capacity;
   }
 
-  Array<String> String::Split(const Size a_index) const {
+  StaticArray<String, 2> String::Split(const Size a_index) const {
     VERIFY(a_index < m_used)
 
-    Array<String> result{2, false};
-    result.Insert(String{});
-    result.Insert(String{});
-
-    Size i = 0;
-    for (; i <= a_index; ++i) {
-      result[0].Append(m_data[i]);
-    }
-    for (; i < m_used; ++i) {
-      result[1].Append(m_data[i]);
-    }
+    StaticArray<String, 2> result;
+    result.Insert(String{StringView{m_data, a_index + 1}});
+    result.Insert(String{StringView{m_data + a_index + 1, m_used - a_index - 1}});
 
     return result;
   }
 
-  Size String::Find(const char a_char) const {
-    Size index = 0;
+  Size String::Find(const char a_char) const { return StringView{*this}.Find(a_char); }
 
-    while (index < m_used && m_data[index] != a_char) {
-      index++;
-    }
-
-    return index >= m_used ? -1 : index;
-  }
-
-  Size String::Find(const String& a_sequence) const {
+  Size String::Find(const StringView a_sequence) const {
     VERIFY(!a_sequence.IsEmpty())
+    return chars::Find(m_data, m_used, a_sequence.GetData(), a_sequence.GetLength());
+  }
 
-    for (Size i = 0; i < m_used; ++i) {
-      if (m_data[i] != a_sequence[0])
-        continue;
+  bool String::Contains(const char a_char) const { return Find(a_char) != StringView::NPOS; }
 
-      bool found = true;
+  bool String::Contains(const StringView a_sequence) const { return Find(a_sequence) != StringView::NPOS; }
 
-      for (Size j = 1; j < a_sequence.m_used; ++j) {
-        if (m_data[i + j] != a_sequence[j]) {
-          found = false;
-          break;
-        }
-      }
+  bool String::StartsWith(const StringView a_prefix) const { return StringView{*this}.StartsWith(a_prefix); }
 
-      if (found) {
-        return i;
-      }
-    }
-
-    return -1;
-  }
+  bool String::EndsWith(const StringView a_suffix) const { return StringView{*this}.EndsWith(a_suffix); }
 
-  String& String::Replace(const String& a_old, const String& a_new) {
+  String& String::Replace(const StringView a_old, const StringView a_new) {
     VERIFY(!a_old.IsEmpty())
+    NTL_PROFILE_SCOPE("String::Replace");
 
-    Size seq_idx = -1;
+    if (aliases(a_old) || aliases(a_new))
+      return Replace(StringView{String{a_old}}, StringView{String{a_new}});
 
-    for (Size i = 0; i < m_used; ++i) {
-      if (m_data[i] != a_old[0])
-        continue;
+    const Size seq_idx = Find(a_old);
 
-      bool found = true;
+    if (seq_idx == StringView::NPOS)
+      return (*this);
 
-      for (Size j = 1; j < a_old.m_used; ++j) {
-        if (m_data[i + j] != a_old[j]) {
-          found = false;
-          break;
-        }
-      }
+    const Size new_length = m_used - a_old.GetLength() + a_new.GetLength();
+    const Size tail_length = m_used - seq_idx - a_old.GetLength();
+    invalidateHash();
 
-      if (found) {
-        seq_idx = i;
-        break;
-      }
+    if (new_length > m_capacity) {
+      Resize(new_length * NTL_STRING_GROWTH_FACTOR);
     }
 
-    if (seq_idx == -1)
-      return (*this);
+    // shift the tail (including the null terminator) in place, then copy the replacement
+    if (a_old.GetLength() != a_new.GetLength())
+      std::memmove(m_data + seq_idx + a_new.GetLength(), m_data + seq_idx + a_old.GetLength(), tail_length + 1);
+    std::memcpy(m_data + seq_idx, a_new.GetData(), a_new.GetLength());
 
-    if (a_old.m_used == a_new.m_used) {
-      for (Size new_idx = 0; new_idx < a_new.m_used; ++new_idx) {
-        m_data[seq_idx + new_idx] = a_new[new_idx];
-      }
-    } else {
-      // TODO: improve replacing of bigger string
-      const Size new_length = m_used - (a_old.m_used - a_new.m_used);
+    m_used = new_length;
 
-      if (new_length <= m_capacity) {
-        Resize(m_capacity * 2);
-      }
+    return (*this);
+  }
 
-      auto* temp = new char[m_capacity + 1];
-      for (Size i = 0; i < seq_idx; ++i) {
-        temp[i] = m_data[i];
-      }
+  String& String::ReplaceAll(const StringView a_old, const StringView a_new) {
+    VERIFY(!a_old.IsEmpty())
+    NTL_PROFILE_SCOPE("String::ReplaceAll");
 
-      for (Size i = 0; i < a_new.m_used; ++i) {
-        temp[seq_idx + i] = a_new.m_data[i];
-      }
+    if (aliases(a_old) || aliases(a_new))
+      return ReplaceAll(StringView{String{a_old}}, StringView{String{a_new}});
+
+    const Size old_length = a_old.GetLength();
+    const Size new_length = a_new.GetLength();
 
-      for (Size i = seq_idx; i < m_used; ++i) {
-        temp[a_new.m_used + i] = m_data[a_old.m_used + i];
+    if (new_length <= old_length) {
+      // the result is never longer than the source, so write it over the source from left to right
+      Size read = 0, write = 0;
+      invalidateHash();
+
+      for (Size found; (found = chars::Find(m_data + read, m_used - read, a_old.GetData(), old_length)) != chars::NPOS;) {
+        std::memmove(m_data + write, m_data + read, found);
+        write += found;
+        std::memcpy(m_data + write, a_new.GetData(), new_length);
+        write += new_length;
+        read += found + old_length;
       }
 
-      delete[] m_data;
-      m_data = temp;
+      if (read == 0)
+        return (*this);
 
-      m_used = new_length;
+      std::memmove(m_data + write, m_data + read, m_used - read);
+      m_used = write + m_used - read;
       m_data[m_used] = '\0';
+
+      return (*this);
     }
 
-    return (*this);
+    Size count = 0;
+    for (Size read = 0, found; (found = chars::Find(m_data + read, m_used - read, a_old.GetData(), old_length)) != chars::NPOS;) {
+      read += found + old_length;
+      count++;
+    }
+
+    if (count == 0)
+      return (*this);
+
+    String result{};
+    result.Reserve(m_used + count * (new_length - old_length));
+
+    Size read = 0;
+    for (Size found; (found = chars::Find(m_data + read, m_used - read, a_old.GetData(), old_length)) != chars::NPOS;) {
+      result.append(m_data + read, found);
+      result.append(a_new.GetData(), new_length);
+      read += found + old_length;
+    }
+    result.append(m_data + read, m_used - read);
+
+    return (*this = std::move(result));
   }
 
   String& String::Replace(const char a_old, const char a_new) {
+    invalidateHash();
     if (a_new == '\0') {
       Size i = 0;
       for (; i < m_used; ++i) {
@@ -315,19 +337,31 @@ namespace ntl {
   }
 
   String& String::ToLowerCase() {
-    std::transform(begin(), end(), m_data, [](const unsigned char a_char) { return std::tolower(a_char); });
+    invalidateHash();
+    chars::ToLower(m_data, m_used);
     return (*this);
   }
 
   String& String::ToUpperCase() {
-    std::transform(begin(), end(), m_data, [](const unsigned char a_char) { return std::toupper(a_char); });
+    invalidateHash();
+    chars::ToUpper(m_data, m_used);
     return (*this);
   }
 
   Size String::GetHash() const {
-    Size hash{0};
-    hash::Combine(hash, *m_data, m_used);
+#if NTL_STRING_CACHE_HASH
+    // relaxed, as threads reading the same string may calculate it concurrently, which yields the same value
+    std::atomic_ref<Size> cached{m_hash};
+    Size hash = cached.load(std::memory_order_relaxed);
+    if (hash == 0) {
+      hash = static_cast<Size>(hash::WyHash(m_data, m_used));
+      hash += hash == 0;
+      cached.store(hash, std::memory_order_relaxed);
+    }
     return hash;
+#else
+    return static_cast<Size>(hash::WyHash(m_data, m_used));
+#endif
   }
 
   const char& String::Get(const Size a_index) const {
@@ -335,18 +369,13 @@ namespace ntl {
     return m_data[a_index];
   }
 
-  char& String::Get(const Size a_index) { return m_data[a_index]; }
+  char& String::Get(const Size a_index) {
+    invalidateHash();
+    return m_data[a_index];
+  }
 
   bool String::IsEqual(const String& a_other) const {
-    if (m_used != a_other.m_used)
-      return false;
-
-    for (Size i = 0; i < m_used; ++i) {
-      if (m_data[i] != a_other.m_data[i])
-        return false;
-    }
-
-    return true;
+    return m_used == a_other.m_used && chars::Equal(m_data, a_other.m_data, m_used);
   }
 
   bool String::IsEqual(const char* a_other) const {
@@ -365,45 +394,78 @@ namespace ntl {
   bool String::IsEmpty() const { return m_used == 0; }
 
   void swap(String& a_left, String& a_right) noexcept {
-    std::swap(a_left.m_capacity, a_right.m_capacity);
-    std::swap(a_left.m_used, a_right.m_used);
-    std::swap(a_left.m_data, a_right.m_data);
+    if (!a_left.isLocal() && !a_right.isLocal()) {
+      std::swap(a_left.m_capacity, a_right.m_capacity);
+      std::swap(a_left.m_used, a_right.m_used);
+      std::swap(a_left.m_data, a_right.m_data);
+#if NTL_STRING_CACHE_HASH
+      std::swap(a_left.m_hash, a_right.m_hash);
+#endif
+      return;
+    }
+
+    // inline buffers can't be exchanged by swapping pointers
+    String temp{std::move(a_left)};
+    a_left = std::move(a_right);
+    a_right = std::move(temp);
   }
 
-  String::Iterator String::begin() { return {m_data}; }
+  String::Iterator String::begin() {
+    invalidateHash();
+    return {m_data};
+  }
 
-  String::Iterator String::end() { return {m_data + m_used}; }
+  String::Iterator String::end() {
+    invalidateHash();
+    return {m_data + m_used};
+  }
 
   /*********************************************************************************************************************
    *                                                     STRING                                                        *
    *                                              OVERLOADED OPERATORS                                                 *
    ********************************************************************************************************************/
 
-  String& String::operator=(const String& a_other) {
-    m_used = a_other.m_used;
-    m_capacity = a_other.m_capacity;
-    m_data = new char[m_capacity + 1];
+  String::operator StringView() const { return {m_data, m_used}; }
 
-    std::copy_n(a_other.m_data, m_used, m_data);
-
-    m_data[m_used] = '\0';
+  String& String::operator=(const String& a_other) {
+    if (this != &a_other) {
+      assign(a_other.m_data, a_other.m_used);
+    }
 
     return (*this);
   }
 
-  String& String::operator=(const char* a_string) {
-    VERIFY(a_string != nullptr)
+  String& String::operator=(String&& a_other) noexcept {
+    if (this == &a_other)
+      return (*this);
 
-    const Size new_length = std::strlen(a_string);
+    release();
 
-    if (new_length >= m_capacity) {
-      Resize(new_length * 2);
+    if (a_other.isLocal()) {
+      std::memcpy(m_local, a_other.m_local, a_other.m_used + 1);
+      m_data = m_local;
+      m_capacity = NTL_STRING_SSO_CAPACITY;
+    } else {
+      m_data = a_other.m_data;
+      m_capacity = a_other.m_capacity;
     }
+    m_used = a_other.m_used;
+#if NTL_STRING_CACHE_HASH
+    m_hash = std::exchange(a_other.m_hash, 0);
+#endif
 
-    std::copy_n(a_string, new_length, m_data);
+    a_other.m_data = a_other.m_local;
+    a_other.m_capacity = NTL_STRING_SSO_CAPACITY;
+    a_other.m_used = 0;
+    a_other.m_local[0] = '\0';
 
-    m_used = new_length;
-    m_data[m_used] = '\0';
+    return (*this);
+  }
+
+  String& String::operator=(const char* a_string) {
+    VERIFY(a_string != nullptr)
+
+    assign(a_string, std::strlen(a_string));
 
     return (*this);
   }
@@ -441,6 +503,7 @@ namespace ntl {
 
   String operator+(const String& a_left, const String& a_right) {
     String result{};
+    result.Reserve(a_left.m_used + a_right.m_used);
     result.Append(a_left);
     result.Append(a_right);
 
@@ -449,6 +512,7 @@ namespace ntl {
 
   String operator+(const String& a_left, const char* a_right) {
     String result{};
+    result.Reserve(a_left.m_used + std::strlen(a_right));
     result.Append(a_left);
     result.Append(a_right);
 
@@ -507,16 +571,28 @@ namespace ntl {
     return result;
   }
 
+  String operator+(String&& a_left, const String& a_right) { return std::move(a_left.Append(a_right)); }
+
+  String operator+(String&& a_left, const char* a_right) { return std::move(a_left.Append(a_right)); }
+
+  String operator+(String&& a_left, const char a_right) { return std::move(a_left.Append(a_right)); }
+
+  String operator+(String&& a_left, const int a_right) { return std::move(a_left.Append(a_right)); }
+
+  String operator+(String&& a_left, const Size a_right) { return std::move(a_left.Append(a_right)); }
+
+  String operator+(String&& a_left, const double a_right) { return std::move(a_left.Append(a_right)); }
+
+  String operator+(String&& a_left, const float a_right) { return std::move(a_left.Append(a_right)); }
+
+  String operator+(String&& a_left, const bool a_right) { return std::move(a_left.Append(a_right)); }
+
   bool operator<(const String& a_left, const String& a_right) {
-    if (a_left.m_data == nullptr) return a_right.m_data != nullptr;
-    if (a_right.m_data == nullptr) return false;
-    return strcmp(a_left.m_data, a_right.m_data) < 0;
+    return chars::Compare(a_left.m_data, a_left.m_used, a_right.m_data, a_right.m_used) < 0;
   }
 
   bool operator>(const String& a_left, const String& a_right) {
-    if (a_left.m_data == nullptr) return false;
-    if (a_right.m_data == nullptr) return true;
-    return strcmp(a_left.m_data, a_right.m_data) > 0;
+    return chars::Compare(a_left.m_data, a_left.m_used, a_right.m_data, a_right.m_used) > 0;
   }
 
   std::ostream& operator<<(std::ostream& a_stream, const String& a_string) {
@@ -528,4 +604,68 @@ namespace ntl {
    *                                                     STRING                                                        *
    *                                                 PRIVATE METHODS                                                   *
    ********************************************************************************************************************/
+
+  bool String::isLocal() const { return m_data == m_local; }
+
+  bool String::aliases(const StringView a_view) const {
+    const std::less_equal<const char*> less_equal{};
+    return less_equal(m_data, a_view.GetData()) && less_equal(a_view.GetData(), m_data + m_capacity);
+  }
+
+  void String::assign(const char* a_data, const Size a_length) {
+    invalidateHash();
+    if (a_length <= m_capacity) {
+      std::memmove(m_data, a_data, a_length);
+    } else {
+      // the old buffer is freed after copying, as the characters might point into it
+      auto* temp = new char[a_length + 1];
+      std::memcpy(temp, a_data, a_length);
+      NTL_PROFILE_RECORD(profile::RecordStringAllocation());
+
+      release();
+      m_data = temp;
+      m_capacity = a_length;
+    }
+
+    NTL_PROFILE_RECORD(profile::RecordStringCopy(a_length));
+    m_used = a_length;
+    m_data[m_used] = '\0';
+  }
+
+  void String::append(const char* a_data, const Size a_length) {
+    invalidateHash();
+    const Size total_len = m_used + a_length;
+
+    if (total_len > m_capacity) {
+      // the old buffer is freed after copying, as the characters might point into it
+      const auto capacity = std::max(total_len, static_cast<Size>(total_len * NTL_STRING_GROWTH_FACTOR));
+      auto* temp = new char[capacity + 1];
+      std::memcpy(temp, m_data, m_used);
+      std::memcpy(temp + m_used, a_data, a_length);
+      NTL_PROFILE_RECORD(profile::RecordStringAllocation());
+      NTL_PROFILE_RECORD(profile::RecordStringCopy(m_used));
+
+      release();
+      m_data = temp;
+      m_capacity = capacity;
+    } else {
+      std::memmove(m_data + m_used, a_data, a_length);
+    }
+
+    NTL_PROFILE_RECORD(profile::RecordStringCopy(a_length));
+    m_used = total_len;
+    m_data[m_used] = '\0';
+  }
+
+  void String::release() {
+    if (!isLocal()) {
+      delete[] m_data;
+    }
+  }
+
+  void String::invalidateHash() {
+#if NTL_STRING_CACHE_HASH
+    m_hash = 0;
+#endif
+  }
 } // namespace ntl
@@ -9,20 +9,49 @@
 #define NTL_STRING_HPP
 
 #include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
 #include <ostream>
+#include <type_traits>
 
 #include "core/Assert.hpp"
 #include "data/Size.hpp"
+#include "data/StringView.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Chars.hpp"
 #include "utils/Hash.hpp"
 
-#define DEFAULT_STRING_SIZE 1024
+// number of characters (without the null terminator) stored inline without allocating
+#ifndef NTL_STRING_SSO_CAPACITY
+  #define NTL_STRING_SSO_CAPACITY 23
+#endif
+
+// factor by which the required capacity is multiplied when a string has to grow
+#ifndef NTL_STRING_GROWTH_FACTOR
+  #define NTL_STRING_GROWTH_FACTOR 2
+#endif
+
+// biggest heap capacity that is kept for reuse when a string gets cleared
+#ifndef NTL_STRING_MAX_RETAINED_CAPACITY
+  #define NTL_STRING_MAX_RETAINED_CAPACITY 1024
+#endif
+
+// keeps the hash of a string until it gets modified, at the cost of one word per string
+#ifndef NTL_STRING_CACHE_HASH
+  #define NTL_STRING_CACHE_HASH 1
+#endif
 
 namespace ntl {
-  template<typename T>
-  class Array;
+  template<typename T, Size N>
+  class StaticArray;
 
   /**
    * @brief String class representing a collection of characters.
+   *
+   * @details Strings of up to NTL_STRING_SSO_CAPACITY characters are stored in an inline
+   * buffer (small-string optimization) and never allocate. Longer strings are stored on the
+   * heap, growing by NTL_STRING_GROWTH_FACTOR whenever they run out of capacity.
    */
   class String {
   public:
@@ -91,6 +120,10 @@ namespace ntl {
   private:
     Size m_capacity, m_used;
     char* m_data;
+    char m_local[NTL_STRING_SSO_CAPACITY + 1];
+#if NTL_STRING_CACHE_HASH
+    mutable Size m_hash; // 0 while it isn't calculated
+#endif
 
   public:
     /**
@@ -118,6 +151,15 @@ namespace ntl {
      */
     String(const char* a_string);
 
+    /**
+     * @brief Creates a String object by copying the characters of a view.
+     *
+     * @details Runtime: O(n), where n is the length of the view
+     *
+     * @param a_view a view
+     */
+    explicit String(StringView a_view);
+
     /**
      * @brief Default Destructor.
      *
@@ -144,6 +186,23 @@ namespace ntl {
      */
     String(String&& a_other) noexcept;
 
+    /**
+     * @brief Reserves capacity for at least the given number of characters.
+     *
+     * @details Runtime: O(n), where n is the length of the string (if the capacity grows)
+     *
+     * @param a_capacity the number of characters to reserve (without the null terminator)
+     */
+    void Reserve(Size a_capacity);
+
+    /**
+     * @brief Shrinks the capacity to the length of the string, moving it back into the
+     * inline buffer if it fits.
+     *
+     * @details Runtime: O(n), where n is the length of the string
+     */
+    void ShrinkToFit();
+
     /**
      * @brief Appends another string to the current string.
      *
@@ -224,6 +283,43 @@ namespace ntl {
      */
     String& Append(bool a_other);
 
+    /**
+     * @brief Appends the characters of a view to the current string.
+     *
+     * @details Runtime: O(n), where n is the length of the view
+     *
+     * @param a_other the view
+     * @return the reference to the current string
+     */
+    String& Append(StringView a_other);
+
+    /**
+     * @brief Appends an integer of any other width or signedness to the current string.
+     *
+     * @details Runtime: O(n), where n is the number of digits of the integer
+     *
+     * @param a_other the integer
+     * @return the reference to the current string
+     */
+    template <typename T>
+      requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>)
+    String& Append(T a_other);
+
+    /**
+     * @brief Appends up to the given number of characters written directly into the buffer of the string.
+     *
+     * @details Runtime: O(m), where m is the number of written characters (O(n + m) if the string grows,
+     * where n is the length of the string).
+     * Lets producers like file reads fill the string without going through a temporary buffer.
+     *
+     * @tparam Function the type of the writer
+     * @param a_count the maximum number of characters to append
+     * @param a_writer called with the first free character and the count, returns how many it wrote
+     * @return the number of appended characters
+     */
+    template <typename Function>
+    Size AppendWith(Size a_count, Function&& a_writer);
+
     /**
      * @brief Removes a character from the current string.
      *
@@ -238,6 +334,8 @@ namespace ntl {
      * @brief Clears the content of the string.
      *
      * @details Runtime: O(1)
+     *
+     * @note Heap buffers up to NTL_STRING_MAX_RETAINED_CAPACITY are kept for reuse.
      */
     String& Clear();
 
@@ -253,12 +351,13 @@ namespace ntl {
     /**
      * @brief Splits the string at a given index.
      *
-     * @details Runtime: O(n), where n is the length of the string
+     * @details Runtime: O(n), where n is the length of the string. The parts are returned inline,
+     * so only parts too long to be stored inline allocate.
      *
      * @param a_index an index
-     * @return the vector containing the seperated string
+     * @return the array containing the seperated string
      */
-    Array<String> Split(Size a_index) const;
+    StaticArray<String, 2> Split(Size a_index) const;
 
     /**
      * @brief Finds the first occurrence of a given char.
@@ -273,24 +372,79 @@ namespace ntl {
     /**
      * @brief Finds the first occurrence of a given sequence.
      *
+     * @details Runtime: O(n*m), where n is the length of the string and m the length of the sequence
+     * (vectorized, so usually close to O(n))
+     *
+     * @param a_sequence a non-empty sequence
+     * @return the index of the first occurrence (-1 if not found)
+     */
+    [[nodiscard]] Size Find(StringView a_sequence) const;
+
+    /**
+     * @brief Checks if the string contains the given char.
+     *
      * @details Runtime: O(n), where n is the length of the string
      *
-     * @param a_sequence a sequence
-     * @return the index of the first occurrence
+     * @param a_char a char
+     * @return if the char was found
+     */
+    [[nodiscard]] bool Contains(char a_char) const;
+
+    /**
+     * @brief Checks if the string contains the given sequence.
+     *
+     * @details Runtime: O(n*m), where n is the length of the string and m the length of the sequence
+     *
+     * @param a_sequence a non-empty sequence
+     * @return if the sequence was found
+     */
+    [[nodiscard]] bool Contains(StringView a_sequence) const;
+
+    /**
+     * @brief Checks if the string starts with the given sequence.
+     *
+     * @details Runtime: O(n), where n is the length of the sequence
+     *
+     * @param a_prefix the prefix
+     * @return if the string starts with the prefix
      */
-    [[nodiscard]] Size Find(const String& a_sequence) const;
+    [[nodiscard]] bool StartsWith(StringView a_prefix) const;
 
     /**
-     * @brief Replaces a given string with another string.
+     * @brief Checks if the string ends with the given sequence.
+     *
+     * @details Runtime: O(n), where n is the length of the sequence
+     *
+     * @param a_suffix the suffix
+     * @return if the string ends with the suffix
+     */
+    [[nodiscard]] bool EndsWith(StringView a_suffix) const;
+
+    /**
+     * @brief Replaces the first occurrence of a given sequence with another sequence.
+     *
+     * @details Runtime: O(n*m), where n is the length of the string
+     * and m is the length of the old sequence string that will be replaced
+     *
+     * @param a_old an old non-empty sequence to replace
+     * @param a_new a new sequence to replace the old one with
+     * @return the reference to the current string object
+     */
+    String& Replace(StringView a_old, StringView a_new);
+
+    /**
+     * @brief Replaces every occurrence of a given sequence with another sequence.
      *
      * @details Runtime: O(n*m), where n is the length of the string
      * and m is the length of the old sequence string that will be replaced
      *
-     * @param a_old an old string to replace
-     * @param a_new a new string to replace the old one with
+     * Shrinking replacements are done in place, growing ones allocate the result exactly once.
+     *
+     * @param a_old an old non-empty sequence to replace
+     * @param a_new a new sequence to replace the old ones with
      * @return the reference to the current string object
      */
-    String& Replace(const String& a_old, const String& a_new);
+    String& ReplaceAll(StringView a_old, StringView a_new);
 
     /**
      * @brief Replaces a given char with another one.
@@ -304,16 +458,16 @@ namespace ntl {
     String& Replace(char a_old, char a_new);
 
     /**
-     * @brief Gets a copy of the string in lowercase.
+     * @brief Converts the ASCII letters of the string to lowercase.
      *
      * @details Runtime: O(n), where n is the length of the string
      *
-     * @return the lowercase string object
+     * @return the reference to the current string object
      */
     String& ToLowerCase();
 
     /**
-     * @brief Converts the string to be uppercase.
+     * @brief Converts the ASCII letters of the string to uppercase.
      *
      * @details Runtime: O(n), where n is the length of the string
      *
@@ -324,9 +478,13 @@ namespace ntl {
     /**
      * @brief Gets the hash of the current string.
      *
-     * @details Runtime: O(1)
+     * @details Runtime: O(n), where n is the length of the string (O(1) once it is cached, see
+     * NTL_STRING_CACHE_HASH). The characters are hashed with WyHash, so hashing takes a word per step.
      *
      * @return the generated hash
+     *
+     * @note Every modification drops the cached hash, including getting a mutable reference or iterator.
+     * Characters written through such a reference after calling this method aren't noticed though.
      */
     [[nodiscard]] Size GetHash() const;
 
@@ -425,6 +583,12 @@ namespace ntl {
      */
     friend void swap(String& a_left, String& a_right) noexcept;
 
+    /**
+     * @brief Overloading conversion operator.
+     * @return the view of the content of the string
+     */
+    operator StringView() const;
+
     /**
      * @brief Gets the beginning of the iterator.
      * @return the iterator at the beginning
@@ -444,6 +608,13 @@ namespace ntl {
      */
     String& operator=(const String& a_other);
 
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other a string (empty afterwards)
+     * @return the reference to the current string object
+     */
+    String& operator=(String&& a_other) noexcept;
+
     /**
      * @brief Overloading assignment operator.
      * @param a_string a c-string
@@ -613,6 +784,71 @@ namespace ntl {
      */
     friend String operator+(const String& a_left, bool a_right);
 
+    /**
+     * @brief Overloading addition operator for temporaries, which appends in place,
+     * so chains like a + b + c don't create a new string for every operand.
+     * @param a_left the temporary string to append to
+     * @param a_right the string to append
+     * @return the concatenated string object
+     */
+    friend String operator+(String&& a_left, const String& a_right);
+
+    /**
+     * @brief Overloading addition operator for temporaries, which appends in place.
+     * @param a_left the temporary string to append to
+     * @param a_right the c-string to append
+     * @return the concatenated string object
+     */
+    friend String operator+(String&& a_left, const char* a_right);
+
+    /**
+     * @brief Overloading addition operator for temporaries, which appends in place.
+     * @param a_left the temporary string to append to
+     * @param a_right the char to append
+     * @return the concatenated string object
+     */
+    friend String operator+(String&& a_left, char a_right);
+
+    /**
+     * @brief Overloading addition operator for temporaries, which appends in place.
+     * @param a_left the temporary string to append to
+     * @param a_right the integer to append
+     * @return the concatenated string object
+     */
+    friend String operator+(String&& a_left, int a_right);
+
+    /**
+     * @brief Overloading addition operator for temporaries, which appends in place.
+     * @param a_left the temporary string to append to
+     * @param a_right the size_t to append
+     * @return the concatenated string object
+     */
+    friend String operator+(String&& a_left, Size a_right);
+
+    /**
+     * @brief Overloading addition operator for temporaries, which appends in place.
+     * @param a_left the temporary string to append to
+     * @param a_right the double to append
+     * @return the concatenated string object
+     */
+    friend String operator+(String&& a_left, double a_right);
+
+    /**
+     * @brief Overloading addition operator for temporaries, which appends in place.
+     * @param a_left the temporary string to append to
+     * @param a_right the float to append
+     * @return the concatenated string object
+     */
+    friend String operator+(String&& a_left, float a_right);
+
+    /**
+     * @brief Overloading addition operator for temporaries, which appends in place.
+     * @param a_left the temporary string to append to
+     * @param a_right the bool to append
+     * @return the concatenated string object
+     */
+    friend String operator+(String&& a_left, bool a_right);
+
     /**
      * @brief Overloading less than operator.
      * @param a_left the left string to compare
@@ -636,9 +872,140 @@ namespace ntl {
      * @return the combined ostream
      */
     friend std::ostream& operator<<(std::ostream& a_stream, const String& a_string);
+
+  private:
+    /**
+     * @brief Checks if the characters are stored in the inline buffer.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the string is stored inline
+     */
+    [[nodiscard]] bool isLocal() const;
+
+    /**
+     * @brief Checks if the given view points into the buffer of the string.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_view the view to check
+     * @return if the view aliases the string
+     */
+    [[nodiscard]] bool aliases(StringView a_view) const;
+
+    /**
+     * @brief Replaces the content of the string with the given characters.
+     *
+     * @details Runtime: O(n), where n is the number of characters
+     *
+     * @param a_data the characters (may point into the string itself)
+     * @param a_length the number of characters
+     */
+    void assign(const char* a_data, Size a_length);
+
+    /**
+     * @brief Appends the given characters to the string.
+     *
+     * @details Runtime: O(n), where n is the number of characters
+     *
+     * @param a_data the characters (may point into the string itself)
+     * @param a_length the number of characters
+     */
+    void append(const char* a_data, Size a_length);
+
+    /**
+     * @brief Formats the given number directly into the buffer of the string using to_chars.
+     *
+     * @details Runtime: O(n), where n is the number of digits of the number
+     *
+     * @param a_value the number to append (floating point numbers use fixed notation
+     * with 6 decimals, just like std::to_string)
+     */
+    template <typename T>
+    void appendNumber(T a_value);
+
+    /**
+     * @brief Frees the heap buffer, if there is one.
+     *
+     * @details Runtime: O(1)
+     */
+    void release();
+
+    /**
+     * @brief Drops the cached hash, as the characters are about to change.
+     *
+     * @details Runtime: O(1)
+     */
+    void invalidateHash();
   };
+
+  template <typename T>
+    requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>)
+  String& String::Append(const T a_other) {
+    appendNumber(a_other);
+    return *this;
+  }
+
+  template <typename Function>
+  Size String::AppendWith(const Size a_count, Function&& a_writer) {
+    if (m_used + a_count > m_capacity)
+      Resize((m_used + a_count) * NTL_STRING_GROWTH_FACTOR);
+    invalidateHash();
+
+    const Size written = a_writer(m_data + m_used, a_count);
+    VERIFY(written <= a_count)
+
+    m_used += written;
+    m_data[m_used] = '\0';
+    return written;
+  }
+
+  template <typename T>
+  void String::appendNumber(const T a_value) {
+    Size reserve = std::is_floating_point_v<T> ? 32 : std::numeric_limits<T>::digits10 + 3;
+    invalidateHash();
+
+    while (true) {
+      if (m_used + reserve > m_capacity) {
+        Resize((m_used + reserve) * NTL_STRING_GROWTH_FACTOR);
+      }
+
+      std::to_chars_result result;
+      if constexpr (std::is_floating_point_v<T>) {
+        result = std::to_chars(m_data + m_used, m_data + m_capacity, a_value, std::chars_format::fixed, 6);
+      } else {
+        result = std::to_chars(m_data + m_used, m_data + m_capacity, a_value);
+      }
+
+      if (result.ec == std::errc{}) {
+        m_used = result.ptr - m_data;
+        m_data[m_used] = '\0';
+        return;
+      }
+
+      // only huge floating point numbers need more than the initial estimate
+      reserve *= 16;
+    }
+  }
 } // namespace ntl
 
+namespace ntl::hash {
+  /**
+   * @brief Hasher for String keys.
+   *
+   * @details The hasher is transparent, so string views and c-strings hash the same
+   * as the equal String and can be used for lookups without constructing one.
+   */
+  template <>
+  struct Hasher<String> {
+    using is_transparent = void;
+
+    U64 operator()(const StringView& a_key, const algorithms::Hash a_algorithm) const {
+      return Calculate(a_algorithm, a_key.GetData(), a_key.GetLength());
+    }
+  };
+}
+
 namespace std {
   template<>
   struct hash<ntl::String> {
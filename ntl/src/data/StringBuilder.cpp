@@ -0,0 +1,43 @@
+/**
+ * @file StringBuilder.cpp
+ * @author Marcus Gugacs
+ * @date 10/14/2026
+ * @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+ */
+
+#include "StringBuilder.hpp"
+
+namespace ntl {
+  /*********************************************************************************************************************
+   *                                                  STRING BUILDER                                                   *
+   *                                                  CONSTRUCTORS                                                     *
+   ********************************************************************************************************************/
+
+  StringBuilder::StringBuilder()
+    : m_result{} {
+    // Empty
+  }
+
+  StringBuilder::StringBuilder(const Size a_capacity)
+    : m_result{} {
+    m_result.Reserve(a_capacity);
+  }
+
+  /*********************************************************************************************************************
+   *                                                  STRING BUILDER                                                   *
+   *                                                 PUBLIC METHODS                                                    *
+   ********************************************************************************************************************/
+
+  StringBuilder& StringBuilder::Reserve(const Size a_capacity) {
+    m_result.Reserve(a_capacity);
+    return *this;
+  }
+
+  Size StringBuilder::GetLength() const { return m_result.GetLength(); }
+
+  StringView StringBuilder::GetView() const { return m_result; }
+
+  void StringBuilder::Clear() { m_result.Clear(); }
+
+  String StringBuilder::Build() { return std::move(m_result); }
+} // namespace ntl
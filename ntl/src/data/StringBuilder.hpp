@@ -0,0 +1,186 @@
+/**
+ * @file StringBuilder.hpp
+ * @author Marcus Gugacs
+ * @date 10/14/2026
+ * @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+ */
+
+#ifndef NTL_STRING_BUILDER_HPP
+#define NTL_STRING_BUILDER_HPP
+
+#include <concepts>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringView.hpp"
+
+namespace ntl {
+  /**
+   * @brief Builder for strings put together from many pieces.
+   *
+   * @details All pieces are appended to a single buffer, numbers are formatted in place and
+   * no temporary strings are created. If the final length can be estimated up front
+   * (see Reserve and Measure) the whole string is built with one allocation.
+   */
+  class StringBuilder {
+  private:
+    String m_result;
+
+  public:
+    /**
+     * @brief Constructs an empty builder.
+     *
+     * @details Runtime: O(1)
+     */
+    StringBuilder();
+
+    /**
+     * @brief Constructs an empty builder with room for at least the given number of characters.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_capacity the number of characters to reserve
+     */
+    explicit StringBuilder(Size a_capacity);
+
+    /**
+     * @brief Appends the given value to the string being built.
+     *
+     * @details Runtime: O(n), where n is the length of the formatted value
+     *
+     * @param a_value any value the String can append or anything with data() and size()
+     * @return the reference to the current builder
+     */
+    template <typename T>
+    StringBuilder& Append(const T& a_value);
+
+    /**
+     * @brief Reserves room for at least the given number of characters in total.
+     *
+     * @details Runtime: O(n), where n is the length of the string built so far
+     *
+     * @param a_capacity the number of characters to reserve
+     * @return the reference to the current builder
+     */
+    StringBuilder& Reserve(Size a_capacity);
+
+    /**
+     * @brief Gets the length of the string built so far.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the length of the string
+     */
+    [[nodiscard]] Size GetLength() const;
+
+    /**
+     * @brief Gets a view of the string built so far.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the view (invalidated by the next append)
+     */
+    [[nodiscard]] StringView GetView() const;
+
+    /**
+     * @brief Clears the string built so far, keeping its buffer for reuse.
+     *
+     * @details Runtime: O(1)
+     */
+    void Clear();
+
+    /**
+     * @brief Moves the built string out of the builder, which is empty afterwards.
+     *
+     * @details Runtime: O(1) (O(n) for strings stored inline)
+     *
+     * @return the built string
+     */
+    [[nodiscard]] String Build();
+
+    /**
+     * @brief Gets an upper bound for the number of characters the given value appends.
+     *
+     * @details Runtime: O(1) (O(n) for c-strings)
+     *
+     * @param a_value the value to measure
+     * @return the estimated length (0 if unknown)
+     */
+    template <typename T>
+    [[nodiscard]] static Size Measure(const T& a_value);
+
+    /**
+     * @brief Concatenates all given values, allocating at most once.
+     *
+     * @details Runtime: O(n), where n is the length of the resulting string
+     *
+     * @param a_values the values to concatenate
+     * @return the concatenated string
+     */
+    template <typename... Args>
+    [[nodiscard]] static String Concat(const Args&... a_values);
+
+    /**
+     * @brief Overloading the left shift operator.
+     * @param a_value the value to append
+     * @return the reference to the current builder
+     */
+    template <typename T>
+    StringBuilder& operator<<(const T& a_value);
+  };
+
+  /*********************************************************************************************************************
+   *                                                  STRING BUILDER                                                   *
+   *                                                 TEMPLATE METHODS                                                  *
+   ********************************************************************************************************************/
+
+  template <typename T>
+  StringBuilder& StringBuilder::Append(const T& a_value) {
+    if constexpr (requires { a_value.data(); a_value.size(); } && !std::is_same_v<T, String>) {
+      m_result.Append(StringView{a_value.data(), a_value.size()});
+    } else {
+      m_result.Append(a_value);
+    }
+
+    return *this;
+  }
+
+  template <typename T>
+  Size StringBuilder::Measure(const T& a_value) {
+    if constexpr (std::is_same_v<T, String> || std::is_same_v<T, StringView>) {
+      return a_value.GetLength();
+    } else if constexpr (std::is_convertible_v<T, const char*>) {
+      return std::strlen(a_value);
+    } else if constexpr (std::is_same_v<T, char>) {
+      return 1;
+    } else if constexpr (std::is_same_v<T, bool>) {
+      return 5;
+    } else if constexpr (std::is_integral_v<T>) {
+      return std::numeric_limits<T>::digits10 + 2;
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return 32;
+    } else if constexpr (requires { { a_value.size() } -> std::convertible_to<Size>; }) {
+      return a_value.size();
+    } else {
+      return 0;
+    }
+  }
+
+  template <typename... Args>
+  String StringBuilder::Concat(const Args&... a_values) {
+    StringBuilder builder{(Size{0} + ... + Measure(a_values))};
+    (builder.Append(a_values), ...);
+    return builder.Build();
+  }
+
+  template <typename T>
+  StringBuilder& StringBuilder::operator<<(const T& a_value) {
+    return Append(a_value);
+  }
+} // namespace ntl
+
+#endif // NTL_STRING_BUILDER_HPP
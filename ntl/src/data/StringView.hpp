@@ -0,0 +1,510 @@
+/**
+ * @file StringView.hpp
+ * @author Marcus Gugacs
+ * @date 10/14/2026
+ * @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+ */
+
+#ifndef NTL_STRING_VIEW_HPP
+#define NTL_STRING_VIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include "core/Assert.hpp"
+#include "data/Size.hpp"
+#include "utils/Chars.hpp"
+#include "utils/Hash.hpp"
+
+namespace ntl {
+  template <typename Delimiter>
+  class SplitView;
+
+  /**
+   * @brief Non-owning view of a sequence of characters.
+   *
+   * @details The viewed characters don't have to be null terminated and must outlive the view.
+   */
+  class StringView {
+  private:
+    const char* m_data;
+    Size m_length;
+
+  public:
+    /**
+     * @brief Index returned by the search functions if nothing was found.
+     */
+    static constexpr Size NPOS = static_cast<Size>(-1);
+
+    /**
+     * @brief Constructs an empty view.
+     *
+     * @details Runtime: O(1)
+     */
+    constexpr StringView()
+      : m_data{""}, m_length{0} {
+      // Empty
+    }
+
+    /**
+     * @brief Constructs a view of the given c-string.
+     *
+     * @details Runtime: O(n), where n is the length of the c-string
+     *
+     * @param a_string a c-string
+     */
+    constexpr StringView(const char* a_string)
+      : m_data{a_string}, m_length{std::char_traits<char>::length(a_string)} {
+      // Empty
+    }
+
+    /**
+     * @brief Constructs a view of the given characters.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_data the first character
+     * @param a_length the number of characters
+     */
+    constexpr StringView(const char* a_data, const Size a_length)
+      : m_data{a_data}, m_length{a_length} {
+      // Empty
+    }
+
+    /**
+     * @brief Gets the viewed characters (not necessarily null terminated).
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the pointer to the first character
+     */
+    [[nodiscard]] constexpr const char* GetData() const { return m_data; }
+
+    /**
+     * @brief Gets the number of viewed characters.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the length of the view
+     */
+    [[nodiscard]] constexpr Size GetLength() const { return m_length; }
+
+    /**
+     * @brief Gets if the view is empty.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the view is empty
+     */
+    [[nodiscard]] constexpr bool IsEmpty() const { return m_length == 0; }
+
+    /**
+     * @brief Gets the character at the given index.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_index the index of the character
+     * @return the character itself
+     */
+    [[nodiscard]] constexpr const char& Get(const Size a_index) const {
+      VERIFY(a_index < m_length && "Index out of bounds")
+      return m_data[a_index];
+    }
+
+    /**
+     * @brief Checks if the view is equal to another view.
+     *
+     * @details Runtime: O(n), where n is the length of the view
+     *
+     * @param a_other the other view to compare with
+     * @return if the views are equal
+     */
+    [[nodiscard]] constexpr bool IsEqual(const StringView& a_other) const {
+      return m_length == a_other.m_length &&
+             std::char_traits<char>::compare(m_data, a_other.m_data, m_length) == 0;
+    }
+
+    /**
+     * @brief Compares the view lexicographically with another view.
+     *
+     * @details Runtime: O(n), where n is the length of the shorter view
+     *
+     * @param a_other the other view to compare with
+     * @return a negative value if the view is smaller, zero if they are equal and a positive value otherwise
+     */
+    [[nodiscard]] constexpr int Compare(const StringView& a_other) const {
+      const int result = std::char_traits<char>::compare(m_data, a_other.m_data, std::min(m_length, a_other.m_length));
+
+      if (result != 0)
+        return result;
+
+      return m_length < a_other.m_length ? -1 : (m_length > a_other.m_length ? 1 : 0);
+    }
+
+    /**
+     * @brief Checks if the view starts with the given view.
+     *
+     * @details Runtime: O(n), where n is the length of the prefix
+     *
+     * @param a_prefix the prefix
+     * @return if the view starts with the prefix
+     */
+    [[nodiscard]] constexpr bool StartsWith(const StringView& a_prefix) const {
+      return a_prefix.m_length <= m_length && Substr(0, a_prefix.m_length).IsEqual(a_prefix);
+    }
+
+    /**
+     * @brief Checks if the view ends with the given view.
+     *
+     * @details Runtime: O(n), where n is the length of the suffix
+     *
+     * @param a_suffix the suffix
+     * @return if the view ends with the suffix
+     */
+    [[nodiscard]] constexpr bool EndsWith(const StringView& a_suffix) const {
+      return a_suffix.m_length <= m_length && Substr(m_length - a_suffix.m_length).IsEqual(a_suffix);
+    }
+
+    /**
+     * @brief Gets a view of a part of the viewed characters.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_from the index of the first character
+     * @param a_length the maximum number of characters (clamped to the end of the view)
+     * @return the view of the part
+     */
+    [[nodiscard]] constexpr StringView Substr(const Size a_from, const Size a_length = NPOS) const {
+      VERIFY(a_from <= m_length && "Index out of bounds")
+      return StringView{m_data + a_from, std::min(a_length, m_length - a_from)};
+    }
+
+    /**
+     * @brief Searches the first occurrence of the given character.
+     *
+     * @details Runtime: O(n), where n is the length of the view (uses memchr at runtime)
+     *
+     * @param a_char the character to find
+     * @param a_from the index to start searching from
+     * @return the index of the character (NPOS if not found)
+     */
+    [[nodiscard]] constexpr Size Find(const char a_char, const Size a_from = 0) const {
+      if (a_from >= m_length)
+        return NPOS;
+
+      const char* found = std::char_traits<char>::find(m_data + a_from, m_length - a_from, a_char);
+      return found ? static_cast<Size>(found - m_data) : NPOS;
+    }
+
+    /**
+     * @brief Searches the first occurrence of the given sequence.
+     *
+     * @details Runtime: O(n * m), where n is the length of the view and m the length of the sequence
+     * (vectorized at runtime)
+     *
+     * @param a_sequence the sequence to find
+     * @param a_from the index to start searching from
+     * @return the index of the first character of the sequence (NPOS if not found)
+     */
+    [[nodiscard]] constexpr Size Find(const StringView& a_sequence, Size a_from = 0) const {
+      if (a_sequence.IsEmpty())
+        return a_from <= m_length ? a_from : NPOS;
+
+      if !consteval {
+        if (a_from >= m_length)
+          return NPOS;
+
+        const Size found = chars::Find(m_data + a_from, m_length - a_from, a_sequence.m_data, a_sequence.m_length);
+        return found == chars::NPOS ? NPOS : a_from + found;
+      }
+
+      while (a_from + a_sequence.m_length <= m_length) {
+        // jump to the next candidate with memchr, then compare the rest
+        a_from = Find(a_sequence.m_data[0], a_from);
+
+        if (a_from == NPOS || a_from + a_sequence.m_length > m_length)
+          return NPOS;
+
+        if (std::char_traits<char>::compare(m_data + a_from + 1, a_sequence.m_data + 1, a_sequence.m_length - 1) == 0)
+          return a_from;
+
+        a_from++;
+      }
+
+      return NPOS;
+    }
+
+    /**
+     * @brief Searches the first character matching the given predicate.
+     *
+     * @details Runtime: O(n), where n is the length of the view
+     *
+     * @param a_predicate a callable taking a char and returning a bool
+     * @param a_from the index to start searching from
+     * @return the index of the character (NPOS if not found)
+     */
+    template <typename Predicate>
+      requires std::is_invocable_r_v<bool, const Predicate&, char>
+    [[nodiscard]] constexpr Size FindIf(const Predicate& a_predicate, const Size a_from = 0) const {
+      for (Size i = a_from; i < m_length; ++i) {
+        if (a_predicate(m_data[i]))
+          return i;
+      }
+
+      return NPOS;
+    }
+
+    /**
+     * @brief Splits the view lazily at every occurrence of the delimiter.
+     *
+     * @details Runtime: O(1), every piece is found while iterating. The pieces are views
+     * of this view, so nothing gets allocated or copied.
+     *
+     * Consecutive delimiters produce empty pieces and a trailing delimiter produces a trailing
+     * empty piece, while an empty view produces no pieces at all.
+     *
+     * @param a_delimiter a character, a non-empty view or a predicate taking a char
+     * @return the range of pieces
+     */
+    template <typename Delimiter>
+      requires(std::is_same_v<Delimiter, char> || std::is_same_v<Delimiter, StringView> ||
+               std::is_invocable_r_v<bool, const Delimiter&, char>)
+    [[nodiscard]] constexpr SplitView<Delimiter> Split(const Delimiter& a_delimiter) const;
+
+    /**
+     * @brief Splits the view lazily at every occurrence of the delimiter sequence.
+     *
+     * @details Runtime: O(1), every piece is found while iterating.
+     *
+     * @param a_delimiter a non-empty c-string
+     * @return the range of pieces
+     */
+    [[nodiscard]] constexpr SplitView<StringView> Split(const char* a_delimiter) const;
+
+    /**
+     * @brief Gets the beginning of the iterator.
+     * @return the iterator at the beginning
+     */
+    [[nodiscard]] constexpr const char* begin() const { return m_data; }
+
+    /**
+     * @brief Gets the end of the iterator.
+     * @return the iterator at the end
+     */
+    [[nodiscard]] constexpr const char* end() const { return m_data + m_length; }
+
+    /**
+     * @brief Overloading subscript operator.
+     * @param a_index a index
+     * @return the char at a given index
+     */
+    constexpr const char& operator[](const Size a_index) const { return Get(a_index); }
+
+    /**
+     * @brief Overloading equivalence operator.
+     * @param a_left the left view to compare
+     * @param a_right the right view to compare
+     * @return if both views are equivalent
+     */
+    friend constexpr bool operator==(const StringView& a_left, const StringView& a_right) {
+      return a_left.IsEqual(a_right);
+    }
+
+    /**
+     * @brief Overloading less operator.
+     * @param a_left the left view to compare
+     * @param a_right the right view to compare
+     * @return if the left view is lexicographically smaller than the right one
+     */
+    friend constexpr bool operator<(const StringView& a_left, const StringView& a_right) {
+      return a_left.Compare(a_right) < 0;
+    }
+
+    /**
+     * @brief Overloading greater operator.
+     * @param a_left the left view to compare
+     * @param a_right the right view to compare
+     * @return if the left view is lexicographically greater than the right one
+     */
+    friend constexpr bool operator>(const StringView& a_left, const StringView& a_right) {
+      return a_left.Compare(a_right) > 0;
+    }
+
+    /**
+     * @brief Overloading the left shift operator.
+     * @param a_stream the ostream
+     * @param a_view the view
+     * @return the combined ostream
+     */
+    friend std::ostream& operator<<(std::ostream& a_stream, const StringView& a_view) {
+      return a_stream.write(a_view.m_data, static_cast<std::streamsize>(a_view.m_length));
+    }
+  };
+
+  /**
+   * @brief Lazy range over the pieces of a view separated by a delimiter.
+   *
+   * @details The delimiter is either a single character (searched with memchr), a non-empty
+   * sequence of characters or a predicate taking a char.
+   *
+   * @tparam Delimiter the type of the delimiter
+   */
+  template <typename Delimiter>
+  class SplitView {
+  public:
+    /**
+     * @brief Forward iterator yielding the pieces as views.
+     */
+    class Iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = StringView;
+      using pointer = const StringView*;
+      using reference = const StringView&;
+
+    private:
+      StringView m_rest;
+      StringView m_current;
+      const Delimiter* m_delimiter;
+      bool m_has_rest;
+      bool m_done;
+
+    public:
+      /**
+       * @brief Constructs the end iterator.
+       */
+      constexpr Iterator()
+        : m_rest{}, m_current{}, m_delimiter{nullptr}, m_has_rest{false}, m_done{true} {
+        // Empty
+      }
+
+      /**
+       * @brief Constructs an iterator at the first piece of the given source.
+       * @param a_source the view to split
+       * @param a_delimiter the delimiter (must outlive the iterator)
+       */
+      constexpr Iterator(const StringView a_source, const Delimiter& a_delimiter)
+        : m_rest{a_source}, m_current{}, m_delimiter{&a_delimiter}, m_has_rest{!a_source.IsEmpty()}, m_done{false} {
+        advance();
+      }
+
+      constexpr reference operator*() const { return m_current; }
+
+      constexpr pointer operator->() const { return &m_current; }
+
+      constexpr Iterator& operator++() {
+        advance();
+        return *this;
+      }
+
+      constexpr Iterator operator++(int) {
+        Iterator temp = *this;
+        advance();
+        return temp;
+      }
+
+      friend constexpr bool operator==(const Iterator& a_first, const Iterator& a_second) {
+        if (a_first.m_done || a_second.m_done)
+          return a_first.m_done == a_second.m_done;
+
+        return a_first.m_current.GetData() == a_second.m_current.GetData() &&
+               a_first.m_has_rest == a_second.m_has_rest;
+      }
+
+    private:
+      /**
+       * @brief Moves to the next piece.
+       *
+       * @details Runtime: O(n), where n is the length of the piece
+       */
+      constexpr void advance() {
+        if (!m_has_rest) {
+          m_done = true;
+          return;
+        }
+
+        Size index, length;
+
+        if constexpr (std::is_same_v<Delimiter, char>) {
+          index = m_rest.Find(*m_delimiter);
+          length = 1;
+        } else if constexpr (std::is_same_v<Delimiter, StringView>) {
+          VERIFY(!m_delimiter->IsEmpty() && "Delimiter must not be empty")
+          index = m_rest.Find(*m_delimiter);
+          length = m_delimiter->GetLength();
+        } else {
+          index = m_rest.FindIf(*m_delimiter);
+          length = 1;
+        }
+
+        if (index == StringView::NPOS) {
+          m_current = m_rest;
+          m_has_rest = false;
+        } else {
+          m_current = m_rest.Substr(0, index);
+          m_rest = m_rest.Substr(index + length);
+        }
+      }
+    };
+
+  private:
+    StringView m_source;
+    Delimiter m_delimiter;
+
+  public:
+    /**
+     * @brief Constructs a range over the pieces of the given view.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_source the view to split
+     * @param a_delimiter the delimiter
+     */
+    constexpr SplitView(const StringView a_source, const Delimiter& a_delimiter)
+      : m_source{a_source}, m_delimiter{a_delimiter} {
+      // Empty
+    }
+
+    /**
+     * @brief Gets the beginning of the iterator.
+     * @return the iterator at the first piece
+     */
+    [[nodiscard]] constexpr Iterator begin() const { return Iterator{m_source, m_delimiter}; }
+
+    /**
+     * @brief Gets the end of the iterator.
+     * @return the iterator past the last piece
+     */
+    [[nodiscard]] constexpr Iterator end() const { return Iterator{}; }
+  };
+
+  template <typename Delimiter>
+    requires(std::is_same_v<Delimiter, char> || std::is_same_v<Delimiter, StringView> ||
+             std::is_invocable_r_v<bool, const Delimiter&, char>)
+  constexpr SplitView<Delimiter> StringView::Split(const Delimiter& a_delimiter) const {
+    return SplitView<Delimiter>{*this, a_delimiter};
+  }
+
+  constexpr SplitView<StringView> StringView::Split(const char* a_delimiter) const {
+    return SplitView<StringView>{*this, StringView{a_delimiter}};
+  }
+} // namespace ntl
+
+namespace ntl::hash {
+  /**
+   * @brief Hasher for StringView keys.
+   */
+  template <>
+  struct Hasher<StringView> {
+    constexpr U64 operator()(const StringView& a_key, const algorithms::Hash a_algorithm) const {
+      return Calculate(a_algorithm, a_key.GetData(), a_key.GetLength());
+    }
+  };
+}
+
+#endif // NTL_STRING_VIEW_HPP
@@ -0,0 +1,938 @@
+/**
+* @file UnrolledList.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_UNROLLED_LIST_HPP
+#define NTL_UNROLLED_LIST_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "utils/Allocator.hpp"
+
+namespace ntl {
+  namespace detail {
+    /**
+     * @brief Number of elements per node filling about two cache lines (but at least 4).
+     */
+    template <typename T>
+    inline constexpr Size UNROLLED_NODE_CAPACITY =
+      std::max<Size>(4, (2 * NTL_CACHE_LINE_SIZE - sizeof(void*) - sizeof(Size)) / sizeof(T));
+  }
+
+  /**
+   * @brief Constructs a new unrolled linked list object.
+   *
+   * @details Every node stores up to K elements in an inline array, so iterating touches one cache miss per
+   * node instead of one per element and there is one allocation per K elements. Full nodes are split in half
+   * when inserting into their middle, and nodes that drop below half of their capacity are merged with their
+   * successor, so the nodes stay at least half full.
+   * Positions are iterators, which are invalidated by insertions and removals touching their node.
+   *
+   * @tparam T the type of the elements to store
+   * @tparam K the maximum number of elements per node
+   * @tparam Allocator the allocator of the nodes (see is_allocator)
+   */
+  template<typename T, Size K = detail::UNROLLED_NODE_CAPACITY<T>, typename Allocator = DefaultAllocator>
+  class UnrolledList {
+    CVERIFY(K >= 2 && "a node has to hold at least two elements to be split")
+
+    template <bool Const>
+    class BasicIterator;
+
+  public:
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+  private:
+    /**
+     * @brief Represents a node holding up to K elements.
+     *
+     * @details Only the first count values are constructed.
+     */
+    struct Node {
+      Node* next;
+      Size count;
+      union {
+        T values[K];
+      };
+
+      Node() : next{nullptr}, count{0} {}
+      ~Node() {}
+    };
+
+    /**
+     * @brief Marks the position in front of the first element (see GetHead).
+     */
+    static constexpr Size HEAD_INDEX = std::numeric_limits<Size>::max();
+
+    /**
+     * @brief Iterator class to simplify iteration over the unrolled linked list.
+     */
+    template <bool Const>
+    class BasicIterator {
+      friend class UnrolledList;
+      template <bool> friend class BasicIterator;
+
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = T;
+      using pointer = std::conditional_t<Const, const T*, T*>;
+      using reference = std::conditional_t<Const, const T&, T&>;
+
+    private:
+      Node* m_node;
+      Size m_index;
+      Node* const* m_first;
+
+      /**
+       * @brief Constructs the position in front of the first element of a list.
+       * @param a_first the first node of the list, which is read once the position is incremented
+       */
+      explicit BasicIterator(Node* const* a_first) : m_node{nullptr}, m_index{HEAD_INDEX}, m_first{a_first} {}
+
+    public:
+      /**
+       * @brief Constructs a new iterator
+       * @param a_node the node of the element
+       * @param a_index the index of the element in its node
+       */
+      BasicIterator(Node* a_node, Size a_index) : m_node{a_node}, m_index{a_index}, m_first{nullptr} {}
+
+      /**
+       * @brief Converts a mutable iterator into a constant one.
+       * @param a_other the mutable iterator
+       */
+      template <bool OtherConst>
+        requires(Const && !OtherConst)
+      BasicIterator(const BasicIterator<OtherConst>& a_other)
+        : m_node{a_other.m_node}, m_index{a_other.m_index}, m_first{a_other.m_first} {}
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the reference to the value of the current iteration
+       */
+      reference operator*() const { return m_node->values[m_index]; }
+
+      /**
+       * @brief Overloading pointer operator.
+       * @return the pointer to the value of the current iteration
+       */
+      pointer operator->() const { return &m_node->values[m_index]; }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the reference to the next iterator
+       */
+      BasicIterator& operator++() {
+        if(m_index == HEAD_INDEX) {
+          m_node = *m_first;
+          m_index = 0;
+          return *this;
+        }
+        if(++m_index == m_node->count) {
+          m_node = m_node->next;
+          m_index = 0;
+        }
+        return *this;
+      }
+
+      /**
+       * @brief Overloading increment operator.
+       * @return the next iterator
+       */
+      BasicIterator operator++(int) {
+        BasicIterator temp = *this;
+        ++*this;
+        return temp;
+      }
+
+      /**
+       * @brief Overloading equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators are equivalent
+       */
+      friend bool operator==(const BasicIterator& a_first, const BasicIterator& a_second) {
+        return a_first.m_node == a_second.m_node && a_first.m_index == a_second.m_index;
+      }
+
+      /**
+       * @brief Overloading anti equivalence operator.
+       * @param a_first the iterator to compare
+       * @param a_second the iterator to compare with
+       * @return if both iterators aren't equivalent
+       */
+      friend bool operator!=(const BasicIterator& a_first, const BasicIterator& a_second) {
+        return !(a_first == a_second);
+      }
+    };
+
+    Node* m_first;
+    Node* m_last;
+    Size m_size;
+    [[no_unique_address]] Allocator m_allocator;
+
+  public:
+    /**
+     * @brief Constructs a new unrolled linked list.
+     */
+    UnrolledList();
+
+    /**
+     * @brief Constructs a new unrolled linked list allocating its nodes using the given allocator.
+     *
+     * @param a_allocator the allocator
+     */
+    explicit UnrolledList(const Allocator& a_allocator);
+
+    /**
+     * @brief Constructs a new unrolled linked list from another one.
+     *
+     * @details Runtime: O(n), where n is the size of the passed list.
+     *
+     * @param a_other the other list
+     */
+    UnrolledList(const UnrolledList& a_other);
+
+    /**
+     * @brief Constructs a new unrolled linked list by taking over the nodes of another one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other list (empty afterwards)
+     */
+    UnrolledList(UnrolledList&& a_other) noexcept;
+
+    /**
+     * @brief Destructs the unrolled linked list.
+     */
+    ~UnrolledList();
+
+    /**
+     * @brief Overloading assignment operator.
+     * @param a_other the list to copy
+     * @return the reference of the current list object
+     */
+    UnrolledList& operator=(const UnrolledList& a_other);
+
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other the list to take the nodes from
+     * @return the reference of the current list object
+     */
+    UnrolledList& operator=(UnrolledList&& a_other) noexcept;
+
+    /**
+     * @brief Inserts a new element at the front of the list.
+     *
+     * @details Runtime: O(K)
+     *
+     * @param a_element the element
+     * @return the position of the element
+     */
+    Iterator InsertFront(const T& a_element);
+
+    /**
+     * @brief Inserts a new element at the front of the list by moving it.
+     *
+     * @details Runtime: O(K)
+     *
+     * @param a_element the element
+     * @return the position of the element
+     */
+    Iterator InsertFront(T&& a_element);
+
+    /**
+     * @brief Constructs a new element in place at the front of the list.
+     *
+     * @details Runtime: O(K)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     * @return the position of the element
+     */
+    template <typename... Args>
+    Iterator EmplaceFront(Args&&... a_args);
+
+    /**
+     * @brief Inserts a new element at the back of the list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_element the element
+     * @return the position of the element
+     */
+    Iterator InsertBack(const T& a_element);
+
+    /**
+     * @brief Inserts a new element at the back of the list by moving it.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_element the element
+     * @return the position of the element
+     */
+    Iterator InsertBack(T&& a_element);
+
+    /**
+     * @brief Constructs a new element in place at the back of the list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     * @return the position of the element
+     */
+    template <typename... Args>
+    Iterator EmplaceBack(Args&&... a_args);
+
+    /**
+     * @brief Inserts a new element after the given position.
+     *
+     * @details Runtime: O(K)
+     *
+     * @param a_position the position after which the element is inserted (GetHead for the front)
+     * @param a_element the element to insert
+     * @return the position of the element
+     */
+    Iterator InsertAfter(ConstIterator a_position, const T& a_element);
+
+    /**
+     * @brief Inserts a new element after the given position by moving it.
+     *
+     * @details Runtime: O(K)
+     *
+     * @param a_position the position after which the element is inserted (GetHead for the front)
+     * @param a_element the element to insert
+     * @return the position of the element
+     */
+    Iterator InsertAfter(ConstIterator a_position, T&& a_element);
+
+    /**
+     * @brief Constructs a new element in place after the given position.
+     *
+     * @details Runtime: O(K)
+     *
+     * @param a_position the position after which the element is inserted (GetHead for the front)
+     * @param a_args the arguments passed to the constructor of the element
+     * @return the position of the element
+     */
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator a_position, Args&&... a_args);
+
+    /**
+     * @brief Removes a element from the list.
+     *
+     * @details Runtime: O(n), where n is the size of the list.
+     *
+     * @param a_element the element to remove
+     * @return if an element was removed from the list
+     */
+    bool RemoveElement(const T& a_element);
+
+    /**
+     * @brief Removes the element after the given position.
+     *
+     * @details Runtime: O(K)
+     *
+     * @param a_position the position after which the element is removed (GetHead for the front)
+     */
+    void RemoveAfter(ConstIterator a_position);
+
+    /**
+     * @brief Removes the first element from the list and returns it.
+     *
+     * @details Runtime: O(K)
+     *
+     * @return the element that was removed (moved out of the node)
+     */
+    T RemoveFront();
+
+    /**
+     * @brief Removes all elements from the list.
+     *
+     * @details Runtime: O(n), where n is the size of the list
+     */
+    void Clear();
+
+    /**
+     * @brief Finds the position of the given element.
+     *
+     * @details Runtime: O(n), where n is the size of the list
+     *
+     * @param a_element the element to find
+     * @return the position of the element (end if not found)
+     */
+    ConstIterator FindElement(const T& a_element) const;
+
+    /**
+     * @brief Checks if the list is equal to another one.
+     *
+     * @details Runtime:
+     *  - O(n), where n is the size of the list.
+     *  - Ω(1), when both lists have a different size.
+     *
+     * @param a_other the other list to compare with
+     * @return if the lists are equal
+     */
+    bool IsEqual(const UnrolledList& a_other) const;
+
+    /**
+     * @brief Gets the position in front of the first element.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the position in front of the first element
+     *
+     * @note this position doesn't refer to an element, it can be passed to InsertAfter and RemoveAfter or be
+     * incremented to the first element
+     */
+    ConstIterator GetHead() const;
+
+    /**
+     * @brief Gets the first element.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the first element
+     */
+    const T& GetFront() const;
+
+    /**
+     * @brief Gets the last element.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the last element
+     */
+    const T& GetBack() const;
+
+    /**
+     * @brief Checks if the list is empty.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if the list is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Gets the number of elements in the list.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the list
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the number of allocated nodes.
+     *
+     * @details Runtime: O(n / K), where n is the size of the list.
+     *
+     * @return the number of nodes
+     */
+    [[nodiscard]] Size GetNodeCount() const;
+
+    /**
+     * @brief Gets the allocator of the nodes.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the allocator
+     */
+    [[nodiscard]] const Allocator& GetAllocator() const;
+
+    /**
+     * @brief Overloading equivalence operator.
+     * @param a_other the list to compare with
+     * @return if both lists are equivalent
+     */
+    bool operator==(const UnrolledList& a_other) const;
+
+    /**
+     * @brief Overloading anti equivalence operator.
+     * @param a_other the list to compare with
+     * @return if both lists aren't equivalent
+     */
+    bool operator!=(const UnrolledList& a_other) const;
+
+    /**
+     * @brief Converts the list to a string.
+     *
+     * @details Runtime: O(n), where n is the size of the list.
+     *
+     * @return the list as a string
+     */
+    [[nodiscard]] String ToString() const;
+
+    // ------------------------
+    // ITERATOR-RELATED METHODS
+    // ------------------------
+    Iterator begin();
+    Iterator end();
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+  private:
+    /**
+     * @brief Constructs an element at the given index of a node, splitting the node if it is full.
+     *
+     * @param a_node the node
+     * @param a_index the index to insert at (at most the count of the node)
+     * @param a_args the arguments to construct the element from
+     * @return the position of the element
+     */
+    template <typename... Args>
+    Iterator insertAt(Node* a_node, Size a_index, Args&&... a_args);
+
+    /**
+     * @brief Removes the element at the given index of a node, merging or freeing the node if it gets sparse.
+     *
+     * @param a_previous the node in front of the node (only needed if the node holds a single element)
+     * @param a_node the node
+     * @param a_index the index of the element
+     */
+    void removeAt(Node* a_previous, Node* a_node, Size a_index);
+
+    /**
+     * @brief Allocates an empty node and links it after the given one.
+     *
+     * @param a_previous the node in front of the new one (nullptr to insert it at the front)
+     * @return the new node
+     */
+    Node* createNode(Node* a_previous);
+
+    /**
+     * @brief Unlinks the given empty node and frees it.
+     *
+     * @param a_previous the node in front of the node (nullptr for the first node)
+     * @param a_node the node
+     */
+    void destroyNode(Node* a_previous, Node* a_node);
+
+    /**
+     * @brief Moves the elements of a node starting at the given index to the end of another node.
+     *
+     * @param a_source the node to move from
+     * @param a_from the index of the first element to move
+     * @param a_target the node to move to
+     */
+    static void relocate(Node* a_source, Size a_from, Node* a_target);
+
+    /**
+     * @brief Swaps the nodes and allocators with another list.
+     *
+     * @param a_other the other list
+     */
+    void swap(UnrolledList& a_other) noexcept;
+  };
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::Iterator UnrolledList<T, K, Allocator>::begin() {
+    return Iterator(m_first, 0);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::Iterator UnrolledList<T, K, Allocator>::end() {
+    return Iterator(nullptr, 0);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::ConstIterator UnrolledList<T, K, Allocator>::begin() const {
+    return ConstIterator(m_first, 0);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::ConstIterator UnrolledList<T, K, Allocator>::end() const {
+    return ConstIterator(nullptr, 0);
+  }
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Overloading the left shift operator.
+   * @param a_stream the ostream
+   * @param a_list the list
+   * @return the combined ostream
+   */
+  template<typename T, Size K, typename Allocator>
+  std::ostream& operator<<(std::ostream& a_stream, const UnrolledList<T, K, Allocator>& a_list) {
+    return (a_stream << a_list.ToString());
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  template<typename T, Size K, typename Allocator>
+  UnrolledList<T, K, Allocator>::UnrolledList()
+    : UnrolledList(Allocator{}) {
+    // Empty
+  }
+
+  template<typename T, Size K, typename Allocator>
+  UnrolledList<T, K, Allocator>::UnrolledList(const Allocator& a_allocator)
+    : m_first{nullptr}, m_last{nullptr}, m_size{0}, m_allocator{a_allocator} {
+    // Empty
+  }
+
+  template<typename T, Size K, typename Allocator>
+  UnrolledList<T, K, Allocator>::UnrolledList(const UnrolledList& a_other)
+    : UnrolledList(a_other.m_allocator) {
+    for(const T& element : a_other)
+      EmplaceBack(element);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  UnrolledList<T, K, Allocator>::UnrolledList(UnrolledList&& a_other) noexcept
+    : UnrolledList(a_other.m_allocator) {
+    swap(a_other);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  UnrolledList<T, K, Allocator>::~UnrolledList() {
+    Clear();
+  }
+
+  template<typename T, Size K, typename Allocator>
+  UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::operator=(const UnrolledList& a_other) {
+    if(this != &a_other) {
+      Clear();
+      for(const T& element : a_other)
+        EmplaceBack(element);
+    }
+    return *this;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::operator=(UnrolledList&& a_other) noexcept {
+    swap(a_other);
+    return *this;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::Iterator UnrolledList<T, K, Allocator>::InsertFront(const T& a_element) {
+    return EmplaceFront(a_element);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::Iterator UnrolledList<T, K, Allocator>::InsertFront(T&& a_element) {
+    return EmplaceFront(std::move(a_element));
+  }
+
+  template<typename T, Size K, typename Allocator>
+  template<typename... Args>
+  typename UnrolledList<T, K, Allocator>::Iterator UnrolledList<T, K, Allocator>::EmplaceFront(Args&&... a_args) {
+    // a full first node gets a new node in front, so repeated front insertions don't split
+    if(m_first == nullptr || m_first->count == K)
+      createNode(nullptr);
+    return insertAt(m_first, 0, std::forward<Args>(a_args)...);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::Iterator UnrolledList<T, K, Allocator>::InsertBack(const T& a_element) {
+    return EmplaceBack(a_element);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::Iterator UnrolledList<T, K, Allocator>::InsertBack(T&& a_element) {
+    return EmplaceBack(std::move(a_element));
+  }
+
+  template<typename T, Size K, typename Allocator>
+  template<typename... Args>
+  typename UnrolledList<T, K, Allocator>::Iterator UnrolledList<T, K, Allocator>::EmplaceBack(Args&&... a_args) {
+    // appending fills the nodes completely instead of splitting them
+    if(m_last == nullptr || m_last->count == K)
+      createNode(m_last);
+
+    Node* node = m_last;
+    std::construct_at(&node->values[node->count], std::forward<Args>(a_args)...);
+    m_size++;
+    return Iterator(node, node->count++);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::Iterator
+  UnrolledList<T, K, Allocator>::InsertAfter(const ConstIterator a_position, const T& a_element) {
+    return EmplaceAfter(a_position, a_element);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::Iterator
+  UnrolledList<T, K, Allocator>::InsertAfter(const ConstIterator a_position, T&& a_element) {
+    return EmplaceAfter(a_position, std::move(a_element));
+  }
+
+  template<typename T, Size K, typename Allocator>
+  template<typename... Args>
+  typename UnrolledList<T, K, Allocator>::Iterator
+  UnrolledList<T, K, Allocator>::EmplaceAfter(const ConstIterator a_position, Args&&... a_args) {
+    if(a_position.m_index == HEAD_INDEX)
+      return EmplaceFront(std::forward<Args>(a_args)...);
+
+    VERIFY(a_position.m_node != nullptr && a_position.m_index < a_position.m_node->count)
+    if(a_position.m_node == m_last && a_position.m_index + 1 == m_last->count)
+      return EmplaceBack(std::forward<Args>(a_args)...);
+    return insertAt(a_position.m_node, a_position.m_index + 1, std::forward<Args>(a_args)...);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  bool UnrolledList<T, K, Allocator>::RemoveElement(const T& a_element) {
+    Node* previous = nullptr;
+    for(Node* node = m_first; node; previous = node, node = node->next) {
+      for(Size i = 0; i < node->count; ++i) {
+        if(node->values[i] == a_element) {
+          removeAt(previous, node, i);
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  void UnrolledList<T, K, Allocator>::RemoveAfter(const ConstIterator a_position) {
+    if(a_position.m_index == HEAD_INDEX) {
+      VERIFY(m_first != nullptr)
+      removeAt(nullptr, m_first, 0);
+      return;
+    }
+
+    Node* node = a_position.m_node;
+    VERIFY(node != nullptr && a_position.m_index < node->count)
+    if(a_position.m_index + 1 < node->count) {
+      removeAt(nullptr, node, a_position.m_index + 1);
+    } else {
+      VERIFY(node->next != nullptr)
+      removeAt(node, node->next, 0);
+    }
+  }
+
+  template<typename T, Size K, typename Allocator>
+  T UnrolledList<T, K, Allocator>::RemoveFront() {
+    VERIFY(m_first != nullptr)
+
+    T result = std::move(m_first->values[0]);
+    removeAt(nullptr, m_first, 0);
+    return result;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  void UnrolledList<T, K, Allocator>::Clear() {
+    Node* node = m_first;
+    while(node) {
+      Node* next = node->next;
+      std::destroy_n(node->values, node->count);
+      node->~Node();
+      memory::Deallocate(m_allocator, node, 1);
+      node = next;
+    }
+
+    m_first = nullptr;
+    m_last = nullptr;
+    m_size = 0;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::ConstIterator UnrolledList<T, K, Allocator>::FindElement(const T& a_element) const {
+    for(Node* node = m_first; node; node = node->next)
+      for(Size i = 0; i < node->count; ++i)
+        if(node->values[i] == a_element)
+          return ConstIterator(node, i);
+    return end();
+  }
+
+  template<typename T, Size K, typename Allocator>
+  bool UnrolledList<T, K, Allocator>::IsEqual(const UnrolledList& a_other) const {
+    return m_size == a_other.m_size && std::equal(begin(), end(), a_other.begin());
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::ConstIterator UnrolledList<T, K, Allocator>::GetHead() const {
+    return ConstIterator(&m_first);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  const T& UnrolledList<T, K, Allocator>::GetFront() const {
+    VERIFY(m_first != nullptr)
+    return m_first->values[0];
+  }
+
+  template<typename T, Size K, typename Allocator>
+  const T& UnrolledList<T, K, Allocator>::GetBack() const {
+    VERIFY(m_last != nullptr)
+    return m_last->values[m_last->count - 1];
+  }
+
+  template<typename T, Size K, typename Allocator>
+  bool UnrolledList<T, K, Allocator>::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  Size UnrolledList<T, K, Allocator>::GetSize() const {
+    return m_size;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  Size UnrolledList<T, K, Allocator>::GetNodeCount() const {
+    Size count = 0;
+    for(Node* node = m_first; node; node = node->next)
+      count++;
+    return count;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  const Allocator& UnrolledList<T, K, Allocator>::GetAllocator() const {
+    return m_allocator;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  bool UnrolledList<T, K, Allocator>::operator==(const UnrolledList& a_other) const {
+    return IsEqual(a_other);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  bool UnrolledList<T, K, Allocator>::operator!=(const UnrolledList& a_other) const {
+    return !IsEqual(a_other);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  String UnrolledList<T, K, Allocator>::ToString() const {
+    Size estimate = 15;
+    for(const T& element : *this)
+      estimate += StringBuilder::Measure(element) + 2;
+
+    StringBuilder builder{estimate};
+    builder.Append("UnrolledList(");
+
+    bool first = true;
+    for(const T& element : *this) {
+      if(!first)
+        builder.Append(", ");
+      builder.Append(element);
+      first = false;
+    }
+
+    builder.Append(")\n");
+    return builder.Build();
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+  template<typename T, Size K, typename Allocator>
+  template<typename... Args>
+  typename UnrolledList<T, K, Allocator>::Iterator UnrolledList<T, K, Allocator>::insertAt(Node* a_node, Size a_index, Args&&... a_args) {
+    // the arguments might refer to an element, which is moved around below
+    T element(std::forward<Args>(a_args)...);
+
+    if(a_node->count == K) {
+      Node* next = createNode(a_node);
+      relocate(a_node, K / 2, next);
+      if(a_index > K / 2) {
+        a_index -= K / 2;
+        a_node = next;
+      }
+    }
+
+    T* values = a_node->values;
+    if(a_index == a_node->count) {
+      std::construct_at(&values[a_index], std::move(element));
+    } else {
+      std::construct_at(&values[a_node->count], std::move(values[a_node->count - 1]));
+      std::move_backward(values + a_index, values + a_node->count - 1, values + a_node->count);
+      values[a_index] = std::move(element);
+    }
+
+    a_node->count++;
+    m_size++;
+    return Iterator(a_node, a_index);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  void UnrolledList<T, K, Allocator>::removeAt(Node* a_previous, Node* a_node, const Size a_index) {
+    T* values = a_node->values;
+    std::move(values + a_index + 1, values + a_node->count, values + a_index);
+    std::destroy_at(&values[--a_node->count]);
+    m_size--;
+
+    if(a_node->count == 0) {
+      destroyNode(a_previous, a_node);
+    } else if(a_node->count < K / 2 && a_node->next && a_node->count + a_node->next->count <= K) {
+      Node* next = a_node->next;
+      relocate(next, 0, a_node);
+      destroyNode(a_node, next);
+    }
+  }
+
+  template<typename T, Size K, typename Allocator>
+  typename UnrolledList<T, K, Allocator>::Node* UnrolledList<T, K, Allocator>::createNode(Node* a_previous) {
+    auto* node = ::new(memory::Allocate<Node>(m_allocator, 1)) Node;
+    if(a_previous == nullptr) {
+      node->next = m_first;
+      m_first = node;
+    } else {
+      node->next = a_previous->next;
+      a_previous->next = node;
+    }
+
+    if(node->next == nullptr)
+      m_last = node;
+    return node;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  void UnrolledList<T, K, Allocator>::destroyNode(Node* a_previous, Node* a_node) {
+    if(a_previous == nullptr)
+      m_first = a_node->next;
+    else
+      a_previous->next = a_node->next;
+
+    if(m_last == a_node)
+      m_last = a_previous;
+
+    a_node->~Node();
+    memory::Deallocate(m_allocator, a_node, 1);
+  }
+
+  template<typename T, Size K, typename Allocator>
+  void UnrolledList<T, K, Allocator>::relocate(Node* a_source, const Size a_from, Node* a_target) {
+    const Size count = a_source->count - a_from;
+    for(Size i = 0; i < count; ++i)
+      std::construct_at(&a_target->values[a_target->count + i], std::move(a_source->values[a_from + i]));
+    std::destroy_n(a_source->values + a_from, count);
+
+    a_target->count += count;
+    a_source->count = a_from;
+  }
+
+  template<typename T, Size K, typename Allocator>
+  void UnrolledList<T, K, Allocator>::swap(UnrolledList& a_other) noexcept {
+    std::swap(m_first, a_other.m_first);
+    std::swap(m_last, a_other.m_last);
+    std::swap(m_size, a_other.m_size);
+    std::swap(m_allocator, a_other.m_allocator);
+  }
+}
+
+#endif // NTL_UNROLLED_LIST_HPP
@@ -0,0 +1,59 @@
+/**
+* @file AdaptiveLock.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "AdaptiveLock.hpp"
+
+#include "core/Platform.hpp"
+#include "utils/Trace.hpp"
+
+namespace ntl {
+  namespace {
+    using Order = Atomic<U32>::MemoryOrder;
+
+    constexpr U32 FREE = 0;
+    constexpr U32 LOCKED = 1;
+    constexpr U32 CONTENDED = 2; // locked and somebody may sleep
+  }
+
+  AdaptiveLock::AdaptiveLock(const U32 a_spin_count) : m_state{FREE}, m_spin_count{a_spin_count} {
+    // Empty
+  }
+
+  void AdaptiveLock::Acquire() {
+    U32 state = FREE;
+    if(!m_state.CompareExchangeStrong(state, LOCKED, Order::Acquire, Order::Relaxed))
+      acquireContended(state);
+  }
+
+  bool AdaptiveLock::TryAcquire() {
+    U32 state = FREE;
+    return m_state.CompareExchangeStrong(state, LOCKED, Order::Acquire, Order::Relaxed);
+  }
+
+  void AdaptiveLock::Release() {
+    if(m_state.Exchange(FREE, Order::Release) == CONTENDED)
+      m_state.NotifyOne();
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  void AdaptiveLock::acquireContended(U32 a_state) {
+    NTL_PROFILE_SCOPE("AdaptiveLock::Acquire");
+    for(U32 i = 0; i < m_spin_count && a_state != CONTENDED; ++i) {
+      NTL_PAUSE();
+      a_state = m_state.Load(Order::Relaxed);
+      if(a_state == FREE && m_state.CompareExchangeWeak(a_state, LOCKED, Order::Acquire, Order::Relaxed))
+        return;
+    }
+
+    // the lock can't tell if other threads sleep, so it stays contended once somebody slept
+    while(m_state.Exchange(CONTENDED, Order::Acquire) != FREE)
+      m_state.Wait(CONTENDED, Order::Relaxed);
+  }
+}
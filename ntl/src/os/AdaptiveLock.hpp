@@ -0,0 +1,89 @@
+/**
+* @file AdaptiveLock.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_ADAPTIVE_LOCK_HPP
+#define NTL_ADAPTIVE_LOCK_HPP
+
+#include "data/Integer.hpp"
+#include "os/Atomic.hpp"
+
+namespace ntl {
+  /**
+   * @brief A mutual-exclusive lock that spins for a while before it sleeps.
+   *
+   * @details Most critical sections end sooner than a round trip through the kernel, so a waiting
+   * thread first spins (reading the lock and pausing the core) for a bounded number of rounds. Only
+   * then it marks the lock as contended and sleeps on it (a futex on Linux). An uncontended Acquire
+   * and Release take a single atomic operation each, and Release only enters the kernel if somebody
+   * sleeps.
+   *
+   * @note Unlike Lock, it can't be used with a Condition.
+   */
+  class AdaptiveLock {
+  private:
+    Atomic<U32> m_state;
+    U32 m_spin_count;
+
+  public:
+    /**
+     * @brief Default number of spinning rounds before sleeping.
+     */
+    static constexpr U32 DEFAULT_SPIN_COUNT = 100;
+
+    /**
+     * @brief Constructs a new lock.
+     *
+     * @param a_spin_count the number of spinning rounds before sleeping (0 sleeps right away)
+     */
+    explicit AdaptiveLock(U32 a_spin_count = DEFAULT_SPIN_COUNT);
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another lock
+     */
+    AdaptiveLock(const AdaptiveLock& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another lock
+     *
+     * @return the reference to the lock
+     */
+    AdaptiveLock& operator=(const AdaptiveLock& a_other) = delete;
+
+    /**
+     * @brief Locks the lock. The calling thread spins and then sleeps while the lock is not available.
+     */
+    void Acquire();
+
+    /**
+     * @brief Attempts to lock the lock.
+     *
+     * @return Returns true if the lock was acquired successfully, otherwise returns false.
+     */
+    bool TryAcquire();
+
+    /**
+     * @brief Unlocks the lock and wakes one sleeping thread, if there is any.
+     *
+     * @note Releasing a lock that was acquired by a different thread results in undefined behaviour.
+     */
+    void Release();
+
+  private:
+    /**
+     * @brief Spins and then sleeps until the lock is acquired (after the first attempt failed).
+     *
+     * @param a_state the state seen by the first attempt
+     */
+    void acquireContended(U32 a_state);
+  };
+}
+
+#endif // NTL_ADAPTIVE_LOCK_HPP
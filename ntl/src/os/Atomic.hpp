@@ -12,6 +12,7 @@
 #include <type_traits>
 
 #include <core/Assert.hpp>
+#include <core/Platform.hpp>
 
 namespace ntl {
   template <typename T>
@@ -71,6 +72,102 @@ namespace ntl {
       return m_value.fetch_sub(arg, ConvertMemoryOrder(a_order));
     }
 
+    T FetchAnd(T arg, MemoryOrder a_order = MemoryOrder::SequentiallyConsistent) {
+      return m_value.fetch_and(arg, ConvertMemoryOrder(a_order));
+    }
+
+    T FetchOr(T arg, MemoryOrder a_order = MemoryOrder::SequentiallyConsistent) {
+      return m_value.fetch_or(arg, ConvertMemoryOrder(a_order));
+    }
+
+    /**
+     * @brief Sleeps as long as the value equals the given one (a futex wait on Linux).
+     *
+     * @details May return spuriously, so callers have to check the value again.
+     *
+     * @param a_old the value to sleep on
+     * @param a_order the memory order of the loads
+     */
+    void Wait(T a_old, MemoryOrder a_order = MemoryOrder::SequentiallyConsistent) const {
+      m_value.wait(a_old, ConvertMemoryOrder(a_order));
+    }
+
+    /**
+     * @brief Wakes one thread sleeping in Wait.
+     */
+    void NotifyOne() noexcept {
+      m_value.notify_one();
+    }
+
+    /**
+     * @brief Wakes all threads sleeping in Wait.
+     */
+    void NotifyAll() noexcept {
+      m_value.notify_all();
+    }
+
+    // --------------------------
+    // COMPILE-TIME MEMORY ORDERS
+    // --------------------------
+
+    // resolved while compiling instead of converting the order on every call, e.g. FetchAdd<Order::Relaxed>(1)
+
+    template <MemoryOrder order>
+    T Load() const {
+      constexpr std::memory_order memory_order = ConvertMemoryOrder(order);
+      return m_value.load(memory_order);
+    }
+
+    template <MemoryOrder order>
+    void Store(T a_value) {
+      constexpr std::memory_order memory_order = ConvertMemoryOrder(order);
+      m_value.store(a_value, memory_order);
+    }
+
+    template <MemoryOrder order>
+    T Exchange(T a_value) {
+      constexpr std::memory_order memory_order = ConvertMemoryOrder(order);
+      return m_value.exchange(a_value, memory_order);
+    }
+
+    template <MemoryOrder success, MemoryOrder failure>
+    bool CompareExchangeWeak(T& expected, T a_value) {
+      constexpr std::memory_order success_order = ConvertMemoryOrder(success);
+      constexpr std::memory_order failure_order = ConvertMemoryOrder(failure);
+      return m_value.compare_exchange_weak(expected, a_value, success_order, failure_order);
+    }
+
+    template <MemoryOrder success, MemoryOrder failure>
+    bool CompareExchangeStrong(T& expected, T a_value) {
+      constexpr std::memory_order success_order = ConvertMemoryOrder(success);
+      constexpr std::memory_order failure_order = ConvertMemoryOrder(failure);
+      return m_value.compare_exchange_strong(expected, a_value, success_order, failure_order);
+    }
+
+    template <MemoryOrder order>
+    T FetchAdd(T arg) {
+      constexpr std::memory_order memory_order = ConvertMemoryOrder(order);
+      return m_value.fetch_add(arg, memory_order);
+    }
+
+    template <MemoryOrder order>
+    T FetchSub(T arg) {
+      constexpr std::memory_order memory_order = ConvertMemoryOrder(order);
+      return m_value.fetch_sub(arg, memory_order);
+    }
+
+    template <MemoryOrder order>
+    T FetchAnd(T arg) {
+      constexpr std::memory_order memory_order = ConvertMemoryOrder(order);
+      return m_value.fetch_and(arg, memory_order);
+    }
+
+    template <MemoryOrder order>
+    T FetchOr(T arg) {
+      constexpr std::memory_order memory_order = ConvertMemoryOrder(order);
+      return m_value.fetch_or(arg, memory_order);
+    }
+
     T operator++() noexcept { return FetchAdd(1) + 1; }
     T operator++(int) noexcept { return FetchAdd(1); }
     T operator--() noexcept { return FetchSub(1) - 1; }
@@ -84,7 +181,7 @@ namespace ntl {
     }
 
   private:
-    static std::memory_order ConvertMemoryOrder(MemoryOrder a_order) {
+    static constexpr std::memory_order ConvertMemoryOrder(MemoryOrder a_order) {
       switch(a_order) {
         case MemoryOrder::Relaxed: return std::memory_order_relaxed;
         case MemoryOrder::Consume: return std::memory_order_consume;
@@ -96,6 +193,19 @@ namespace ntl {
       }
     }
   };
+
+  /**
+   * @brief An atomic on a cache line of its own, so updates of neighbouring atomics (e.g. in an array
+   * of per-thread atomics) don't invalidate each other.
+   *
+   * @tparam T the type of the value
+   */
+  template <typename T>
+  class alignas(NTL_CACHE_LINE_SIZE) PaddedAtomic : public Atomic<T> {
+  public:
+    using Atomic<T>::Atomic;
+    using Atomic<T>::operator=;
+  };
 }
 
 #endif // NTL_ATOMIC_HPP
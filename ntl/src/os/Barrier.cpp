@@ -0,0 +1,52 @@
+/**
+* @file Barrier.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Barrier.hpp"
+
+#include "core/Assert.hpp"
+#include "os/Futex.hpp"
+
+namespace ntl {
+  namespace {
+    using Order = Atomic<U32>::MemoryOrder;
+
+    constexpr U32 SLEEPING = 1u << 31;
+    constexpr U32 PHASE = SLEEPING - 1;
+  }
+
+  Barrier::Barrier(const U32 a_count) : m_remaining{a_count}, m_phase{0}, m_count{a_count} {
+    VERIFY(a_count > 0)
+  }
+
+  bool Barrier::ArriveAndWait() {
+    U32 phase = m_phase.Load(Order::Acquire);
+
+    if(m_remaining.FetchSub(1, Order::AcquireRelease) == 1) {
+      // nobody can arrive for the next phase before it starts, so the counter can be reset first
+      m_remaining.Store(m_count, Order::Relaxed);
+      if((m_phase.Exchange(((phase & PHASE) + 1) & PHASE, Order::AcquireRelease) & SLEEPING) != 0)
+        futex::WakeAll(m_phase);
+      return true;
+    }
+
+    const U32 current = phase & PHASE;
+    while((phase & PHASE) == current) {
+      // a failed exchange reloads the phase
+      if((phase & SLEEPING) == 0 &&
+         !m_phase.CompareExchangeWeak(phase, phase | SLEEPING, Order::Acquire, Order::Acquire))
+        continue;
+
+      futex::Wait(m_phase, phase | SLEEPING);
+      phase = m_phase.Load(Order::Acquire);
+    }
+    return false;
+  }
+
+  U32 Barrier::GetCount() const {
+    return m_count;
+  }
+}
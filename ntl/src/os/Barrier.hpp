@@ -0,0 +1,68 @@
+/**
+* @file Barrier.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_BARRIER_HPP
+#define NTL_BARRIER_HPP
+
+#include "data/Integer.hpp"
+#include "os/Atomic.hpp"
+
+namespace ntl {
+  /**
+   * @brief A reusable rendezvous point for a fixed number of threads.
+   *
+   * @details Every phase ends once the given number of threads arrived, which releases all of them
+   * and starts the next phase. Threads sleep on a futex word holding the number of the phase, and
+   * the last thread only enters the kernel if somebody sleeps.
+   */
+  class Barrier {
+  private:
+    Atomic<U32> m_remaining;
+    Atomic<U32> m_phase;
+    U32 m_count;
+
+  public:
+    /**
+     * @brief Constructs a new barrier.
+     *
+     * @param a_count the number of threads of every phase (at least 1)
+     */
+    explicit Barrier(U32 a_count);
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another barrier
+     */
+    Barrier(const Barrier& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another barrier
+     *
+     * @return the reference to the barrier
+     */
+    Barrier& operator=(const Barrier& a_other) = delete;
+
+    /**
+     * @brief Arrives at the barrier and blocks the calling thread until all threads of the phase arrived.
+     *
+     * @return true for exactly one thread of every phase (the last one), otherwise false
+     */
+    bool ArriveAndWait();
+
+    /**
+     * @brief Gets the number of threads of every phase.
+     *
+     * @return the number of threads
+     */
+    [[nodiscard]] U32 GetCount() const;
+  };
+}
+
+#endif // NTL_BARRIER_HPP
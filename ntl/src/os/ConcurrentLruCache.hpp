@@ -0,0 +1,325 @@
+/**
+* @file ConcurrentLruCache.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_CONCURRENT_LRU_CACHE_HPP
+#define NTL_CONCURRENT_LRU_CACHE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+#include "data/Integer.hpp"
+#include "data/LruCache.hpp"
+#include "data/Size.hpp"
+#include "os/AdaptiveLock.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Hash.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new thread-safe cache evicting the least recently used entries of each shard.
+   *
+   * @details The entries are striped across a power-of-two number of shards by the high bits of their
+   * hash, like in ConcurrentMap. Every shard is an LruCache with its share of both limits, guarded by its own
+   * AdaptiveLock on its own cache line. As every hit reorders the entries of its shard, all operations lock
+   * exclusively, but only for a few instructions. The recency order is only kept per shard, so the evicted
+   * entry is the least recently used one of its shard. Values are returned as copies, as references would
+   * outlive the lock of their shard.
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam ValueType the type of the cached values
+   * @tparam HasherType the hasher used to hash the keys (see hash::Hasher)
+   * @tparam Weigher a callable returning the weight of an entry from its key and value (see UnitWeigher)
+   */
+  template <typename KeyType, typename ValueType, typename HasherType = hash::Hasher<KeyType>,
+            typename Weigher = UnitWeigher>
+  class ConcurrentLruCache {
+  private:
+    using Cache = LruCache<KeyType, ValueType, HasherType, Weigher>;
+
+    /**
+     * @brief A part of the cache with its own lock.
+     */
+    struct alignas(NTL_CACHE_LINE_SIZE) Shard {
+      AdaptiveLock lock;
+      Cache cache;
+
+      Shard(Size a_capacity, Size a_max_weight, algorithms::Hash a_algorithm, const Weigher& a_weigher)
+        : lock(), cache(a_capacity, a_max_weight, a_algorithm, a_weigher) {}
+    };
+
+    Shard* m_shards;
+    Size m_shard_count;
+    U32 m_shard_shift;
+    algorithms::Hash m_algorithm;
+    [[no_unique_address]] HasherType m_hasher;
+    [[no_unique_address]] DefaultAllocator m_allocator;
+
+  public:
+    /**
+     * @brief Default number of shards.
+     */
+    static constexpr Size DEFAULT_SHARD_COUNT = 16;
+
+    /**
+     * @brief Constructs a new cache with the given limits, which are split evenly across the shards.
+     *
+     * @param a_capacity the maximum number of entries of all shards together
+     * @param a_max_weight the maximum total weight of the entries of all shards together
+     * @param a_shard_count the number of shards (rounded up to the next power of two)
+     * @param a_algorithm the hashing algorithm to use
+     * @param a_weigher the callable weighing the entries
+     */
+    explicit ConcurrentLruCache(Size a_capacity, Size a_max_weight = Cache::NO_WEIGHT_LIMIT,
+                                Size a_shard_count = DEFAULT_SHARD_COUNT,
+                                algorithms::Hash a_algorithm = algorithms::Hash::FNV1a,
+                                const Weigher& a_weigher = Weigher{});
+
+    /**
+     * @brief Destructs the cache.
+     */
+    ~ConcurrentLruCache();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another cache
+     */
+    ConcurrentLruCache(const ConcurrentLruCache& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another cache
+     *
+     * @return the reference to the cache
+     */
+    ConcurrentLruCache& operator=(const ConcurrentLruCache& a_other) = delete;
+
+    /**
+     * @brief Copies the value of the given key and marks it as the most recently used one of its shard.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @param a_value receives the value on a hit
+     * @return if the key is cached
+     */
+    bool Get(const KeyType& a_key, ValueType& a_value);
+
+    /**
+     * @brief Inserts or replaces the value of the given key, evicting from its shard (see LruCache::Put).
+     *
+     * @details Runtime: O(1) on average (plus one step per evicted entry)
+     *
+     * @param a_key the key of the entry
+     * @param a_value the value of the entry
+     * @return if the entry is cached (false if its weight alone exceeds the weight limit of a shard)
+     */
+    bool Put(KeyType a_key, ValueType a_value);
+
+    /**
+     * @brief Removes the entry of the given key, if it is cached.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @return if an entry was removed
+     */
+    bool Erase(const KeyType& a_key);
+
+    /**
+     * @brief Checks if the given key is cached without touching it or counting the lookup.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @return if the key is cached
+     */
+    [[nodiscard]] bool Contains(const KeyType& a_key) const;
+
+    /**
+     * @brief Removes all entries.
+     *
+     * @details Runtime: O(n), where n is the capacity of all shards
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of cached entries (the sum of all shards at slightly different times).
+     *
+     * @details Runtime: O(s), where s is the number of shards
+     *
+     * @return the size of the cache
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the hits, misses and evictions summed over all shards.
+     *
+     * @details Runtime: O(s), where s is the number of shards
+     *
+     * @return the statistics of the cache
+     */
+    [[nodiscard]] CacheStatistics GetStatistics() const;
+
+    /**
+     * @brief Gets the number of shards of the cache.
+     *
+     * @return the number of shards
+     */
+    [[nodiscard]] Size GetShardCount() const;
+
+  private:
+    /**
+     * @brief Gets the shard of the given key.
+     *
+     * @param a_key the key
+     * @return the reference to the shard
+     */
+    Shard& shard(const KeyType& a_key) const;
+  };
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::ConcurrentLruCache(Size a_capacity, Size a_max_weight,
+                                                                                 Size a_shard_count,
+                                                                                 algorithms::Hash a_algorithm,
+                                                                                 const Weigher& a_weigher)
+    : m_shard_count{std::bit_ceil(std::max(a_shard_count, Size{1}))}, m_algorithm{a_algorithm} {
+    VERIFY(m_shard_count <= 65536)
+    VERIFY(a_capacity >= m_shard_count && "every shard has to hold at least one entry")
+
+    m_shard_shift = 64 - static_cast<U32>(std::countr_zero(m_shard_count));
+
+    const Size capacity = (a_capacity + m_shard_count - 1) / m_shard_count;
+    const Size max_weight = a_max_weight == Cache::NO_WEIGHT_LIMIT
+                              ? a_max_weight
+                              : (a_max_weight + m_shard_count - 1) / m_shard_count;
+    m_shards = memory::Allocate<Shard>(m_allocator, m_shard_count);
+    for(Size i = 0; i < m_shard_count; ++i)
+      std::construct_at(m_shards + i, capacity, max_weight, a_algorithm, a_weigher);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::~ConcurrentLruCache() {
+    std::destroy_n(m_shards, m_shard_count);
+    memory::Deallocate(m_allocator, m_shards, m_shard_count);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  bool ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::Get(const KeyType& a_key, ValueType& a_value) {
+    Shard& target = shard(a_key);
+
+    target.lock.Acquire();
+    const bool found = target.cache.Get(a_key, a_value);
+    target.lock.Release();
+
+    return found;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  bool ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::Put(KeyType a_key, ValueType a_value) {
+    Shard& target = shard(a_key);
+
+    target.lock.Acquire();
+    const bool cached = target.cache.Put(std::move(a_key), std::move(a_value));
+    target.lock.Release();
+
+    return cached;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  bool ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::Erase(const KeyType& a_key) {
+    Shard& target = shard(a_key);
+
+    target.lock.Acquire();
+    const bool erased = target.cache.Erase(a_key);
+    target.lock.Release();
+
+    return erased;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  bool ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::Contains(const KeyType& a_key) const {
+    Shard& target = shard(a_key);
+
+    target.lock.Acquire();
+    const bool contains = target.cache.Contains(a_key);
+    target.lock.Release();
+
+    return contains;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  void ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::Clear() {
+    for(Size i = 0; i < m_shard_count; ++i) {
+      m_shards[i].lock.Acquire();
+      m_shards[i].cache.Clear();
+      m_shards[i].lock.Release();
+    }
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  Size ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::GetSize() const {
+    Size size = 0;
+    for(Size i = 0; i < m_shard_count; ++i) {
+      m_shards[i].lock.Acquire();
+      size += m_shards[i].cache.GetSize();
+      m_shards[i].lock.Release();
+    }
+    return size;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  CacheStatistics ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::GetStatistics() const {
+    CacheStatistics statistics{};
+    for(Size i = 0; i < m_shard_count; ++i) {
+      m_shards[i].lock.Acquire();
+      const CacheStatistics& shard = m_shards[i].cache.GetStatistics();
+      statistics.hits += shard.hits;
+      statistics.misses += shard.misses;
+      statistics.evictions += shard.evictions;
+      m_shards[i].lock.Release();
+    }
+    return statistics;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  Size ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::GetShardCount() const {
+    return m_shard_count;
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename KeyType, typename ValueType, typename HasherType, typename Weigher>
+  typename ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::Shard&
+  ConcurrentLruCache<KeyType, ValueType, HasherType, Weigher>::shard(const KeyType& a_key) const {
+    if(m_shard_count == 1)
+      return m_shards[0];
+
+    U64 hash;
+    if constexpr(std::is_invocable_r_v<U64, const HasherType&, const KeyType&, algorithms::Hash>)
+      hash = m_hasher(a_key, m_algorithm);
+    else
+      hash = m_hasher(a_key);
+
+    return m_shards[hash >> m_shard_shift];
+  }
+}
+
+#endif // NTL_CONCURRENT_LRU_CACHE_HPP
@@ -0,0 +1,363 @@
+/**
+* @file ConcurrentMap.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_CONCURRENT_MAP_HPP
+#define NTL_CONCURRENT_MAP_HPP
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+#include "data/Array.hpp"
+#include "data/Integer.hpp"
+#include "data/Map.hpp"
+#include "data/Pair.hpp"
+#include "data/Size.hpp"
+#include "os/SharedLock.hpp"
+#include "utils/Allocator.hpp"
+#include "utils/Hash.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new thread-safe map object.
+   *
+   * @details The entries are striped across a power-of-two number of shards by the high bits of their
+   * hash. Every shard is a Map guarded by its own SharedLock on its own cache line, so threads only
+   * contend if they access the same shard, and readers of a shard don't block each other. Values are
+   * returned as copies, as references would outlive the lock of their shard.
+   *
+   * @tparam KeyType the type of the keys
+   * @tparam ValueType the type of elements to store
+   * @tparam HasherType the hasher used to hash the keys (see hash::Hasher)
+   */
+  template <typename KeyType, typename ValueType, typename HasherType = hash::Hasher<KeyType>>
+  class ConcurrentMap {
+  private:
+    /**
+     * @brief A part of the map with its own lock.
+     */
+    struct alignas(NTL_CACHE_LINE_SIZE) Shard {
+      SharedLock lock;
+      Map<KeyType, ValueType, HasherType> map;
+
+      Shard(Size a_capacity, algorithms::Hash a_algorithm) : lock(), map(a_capacity, a_algorithm) {}
+    };
+
+    Shard* m_shards;
+    Size m_shard_count;
+    U32 m_shard_shift;
+    algorithms::Hash m_algorithm;
+    [[no_unique_address]] HasherType m_hasher;
+    [[no_unique_address]] DefaultAllocator m_allocator;
+
+  public:
+    /**
+     * @brief Default number of shards, enough to keep contention low with dozens of threads.
+     */
+    static constexpr Size DEFAULT_SHARD_COUNT = 64;
+
+    /**
+     * @brief Constructs a new map with the given parameters.
+     *
+     * @param a_capacity the initial capacity of all shards together
+     * @param a_shard_count the number of shards (rounded up to the next power of two)
+     * @param a_algorithm the hashing algorithm to use
+     */
+    explicit ConcurrentMap(Size a_capacity = 1024, Size a_shard_count = DEFAULT_SHARD_COUNT,
+                           algorithms::Hash a_algorithm = algorithms::Hash::FNV1a);
+
+    /**
+     * @brief Destructs the map.
+     */
+    ~ConcurrentMap();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another map
+     */
+    ConcurrentMap(const ConcurrentMap& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another map
+     *
+     * @return the reference to the map
+     */
+    ConcurrentMap& operator=(const ConcurrentMap& a_other) = delete;
+
+    /**
+     * @brief Inserts a new entry or replaces the value of an existing one.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @param a_value the value of the entry
+     * @return if a new entry was inserted
+     */
+    bool InsertOrAssign(KeyType a_key, ValueType a_value);
+
+    /**
+     * @brief Gets the value of the given key, computing and inserting it first if the key doesn't exist.
+     *
+     * @details Runtime: O(1) on average (plus the runtime of the computation)
+     *
+     * The computation runs at most once per missing key while the shard is locked for writing, so it
+     * must not access the map itself.
+     *
+     * @param a_key the key of the entry
+     * @param a_compute a callable returning the value for a missing key
+     * @return a copy of the existing or computed value
+     */
+    template <typename Compute>
+    ValueType ComputeIfAbsent(const KeyType& a_key, const Compute& a_compute);
+
+    /**
+     * @brief Removes the entry of the given key, if it exists.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @return if an entry was removed
+     */
+    bool Erase(const KeyType& a_key);
+
+    /**
+     * @brief Gets a copy of the value of the given key.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @param a_value receives the value, if the key exists
+     * @return if the key exists
+     */
+    bool Find(const KeyType& a_key, ValueType& a_value) const;
+
+    /**
+     * @brief Checks if the given key exists.
+     *
+     * @details Runtime: O(1) on average
+     *
+     * @param a_key the key of the entry
+     * @return if the key exists
+     */
+    [[nodiscard]] bool Exists(const KeyType& a_key) const;
+
+    /**
+     * @brief Removes all entries of the map.
+     *
+     * @details Runtime: O(n), where n is the capacity of the map
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of entries in the map (the sum of all shards at slightly different times).
+     *
+     * @details Runtime: O(s), where s is the number of shards
+     *
+     * @return the size of the map
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the number of shards of the map.
+     *
+     * @return the number of shards
+     */
+    [[nodiscard]] Size GetShardCount() const;
+
+    /**
+     * @brief Copies all entries of the map at a single point in time.
+     *
+     * @details Runtime: O(n + s), where n is the size of the map and s is the number of shards
+     *
+     * All shards are locked for reading at the same time, so writers only wait for the copy and the
+     * snapshot never contains half of a concurrent sequence of writes to different shards.
+     *
+     * @return the entries, which can be iterated independent of the map
+     */
+    [[nodiscard]] Array<Pair<KeyType, ValueType>> GetSnapshot() const;
+
+  private:
+    /**
+     * @brief Gets the shard of the given key.
+     *
+     * @param a_key the key
+     * @return the reference to the shard
+     */
+    Shard& shard(const KeyType& a_key) const;
+  };
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  ConcurrentMap<KeyType, ValueType, HasherType>::ConcurrentMap(Size a_capacity, Size a_shard_count,
+                                                               algorithms::Hash a_algorithm)
+    : m_shard_count{std::bit_ceil(std::max(a_shard_count, Size{1}))}, m_algorithm{a_algorithm} {
+    VERIFY(m_shard_count <= 65536)
+
+    // the home slots of the shard maps use the low bits of the hash, the shards the high ones
+    m_shard_shift = 64 - static_cast<U32>(std::countr_zero(m_shard_count));
+
+    const Size capacity = std::max(a_capacity / m_shard_count, Size{8});
+    m_shards = memory::Allocate<Shard>(m_allocator, m_shard_count);
+    for(Size i = 0; i < m_shard_count; ++i)
+      std::construct_at(m_shards + i, capacity, a_algorithm);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  ConcurrentMap<KeyType, ValueType, HasherType>::~ConcurrentMap() {
+    std::destroy_n(m_shards, m_shard_count);
+    memory::Deallocate(m_allocator, m_shards, m_shard_count);
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  bool ConcurrentMap<KeyType, ValueType, HasherType>::InsertOrAssign(KeyType a_key, ValueType a_value) {
+    Shard& target = shard(a_key);
+
+    target.lock.StartWrite();
+    const Size before = target.map.GetSize();
+    target.map.Insert(std::move(a_key), std::move(a_value));
+    const bool inserted = target.map.GetSize() != before;
+    target.lock.EndWrite();
+
+    return inserted;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  template <typename Compute>
+  ValueType ConcurrentMap<KeyType, ValueType, HasherType>::ComputeIfAbsent(const KeyType& a_key,
+                                                                          const Compute& a_compute) {
+    Shard& target = shard(a_key);
+
+    // most calls find the value, which only needs the shared access
+    target.lock.StartRead();
+    if(target.map.Exists(a_key)) {
+      ValueType value = target.map.Get(a_key);
+      target.lock.EndRead();
+      return value;
+    }
+    target.lock.EndRead();
+
+    target.lock.StartWrite();
+    // another thread may have inserted the key between the two locks
+    ValueType value = target.map.Exists(a_key) ? target.map.Get(a_key) : target.map.Emplace(a_key, a_compute());
+    target.lock.EndWrite();
+
+    return value;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  bool ConcurrentMap<KeyType, ValueType, HasherType>::Erase(const KeyType& a_key) {
+    Shard& target = shard(a_key);
+
+    target.lock.StartWrite();
+    const bool exists = target.map.Exists(a_key);
+    if(exists)
+      target.map.Remove(a_key);
+    target.lock.EndWrite();
+
+    return exists;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  bool ConcurrentMap<KeyType, ValueType, HasherType>::Find(const KeyType& a_key, ValueType& a_value) const {
+    Shard& target = shard(a_key);
+
+    target.lock.StartRead();
+    const bool exists = target.map.Exists(a_key);
+    if(exists)
+      a_value = target.map.Get(a_key);
+    target.lock.EndRead();
+
+    return exists;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  bool ConcurrentMap<KeyType, ValueType, HasherType>::Exists(const KeyType& a_key) const {
+    Shard& target = shard(a_key);
+
+    target.lock.StartRead();
+    const bool exists = target.map.Exists(a_key);
+    target.lock.EndRead();
+
+    return exists;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  void ConcurrentMap<KeyType, ValueType, HasherType>::Clear() {
+    for(Size i = 0; i < m_shard_count; ++i) {
+      m_shards[i].lock.StartWrite();
+      m_shards[i].map.Clear();
+      m_shards[i].lock.EndWrite();
+    }
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  Size ConcurrentMap<KeyType, ValueType, HasherType>::GetSize() const {
+    Size size = 0;
+    for(Size i = 0; i < m_shard_count; ++i) {
+      m_shards[i].lock.StartRead();
+      size += m_shards[i].map.GetSize();
+      m_shards[i].lock.EndRead();
+    }
+    return size;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  Size ConcurrentMap<KeyType, ValueType, HasherType>::GetShardCount() const {
+    return m_shard_count;
+  }
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  Array<Pair<KeyType, ValueType>> ConcurrentMap<KeyType, ValueType, HasherType>::GetSnapshot() const {
+    // always locked in the same order, writers only ever hold a single shard
+    Size size = 0;
+    for(Size i = 0; i < m_shard_count; ++i) {
+      m_shards[i].lock.StartRead();
+      size += m_shards[i].map.GetSize();
+    }
+
+    Array<Pair<KeyType, ValueType>> snapshot(std::max(size, Size{1}));
+    for(Size i = 0; i < m_shard_count; ++i) {
+      for(const auto& entry : m_shards[i].map)
+        snapshot.Insert(entry);
+      m_shards[i].lock.EndRead();
+    }
+
+    return snapshot;
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename KeyType, typename ValueType, typename HasherType>
+  typename ConcurrentMap<KeyType, ValueType, HasherType>::Shard&
+  ConcurrentMap<KeyType, ValueType, HasherType>::shard(const KeyType& a_key) const {
+    if(m_shard_count == 1)
+      return m_shards[0];
+
+    U64 hash;
+    if constexpr(std::is_invocable_r_v<U64, const HasherType&, const KeyType&, algorithms::Hash>)
+      hash = m_hasher(a_key, m_algorithm);
+    else
+      hash = m_hasher(a_key);
+
+    return m_shards[hash >> m_shard_shift];
+  }
+}
+
+#endif // NTL_CONCURRENT_MAP_HPP
@@ -7,15 +7,26 @@
 
 #include "Condition.hpp"
 
+#include <cerrno>
+
 #include "core/Assert.hpp"
+#include "core/Platform.hpp"
 
 namespace ntl {
   Condition::Condition(Lock* a_lock)
     : m_condition(), m_lock(a_lock) {
-    pthread_cond_init(&m_condition, nullptr);
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+#ifndef NTL_PLATFORM_APPLE
+    // timed waits use the clock of time::Clock, which isn't adjusted like the realtime clock
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+#endif
+    pthread_cond_init(&m_condition, &attributes);
+    pthread_condattr_destroy(&attributes);
   }
 
   Condition::~Condition() {
+    pthread_cond_destroy(&m_condition);
     m_lock = nullptr;
   }
 
@@ -28,6 +39,27 @@ namespace ntl {
       m_lock->Release();
   }
 
+  bool Condition::WaitFor(const std::chrono::nanoseconds a_timeout, const bool a_acquire) {
+    return WaitUntil(time::Deadline(a_timeout), a_acquire);
+  }
+
+  bool Condition::WaitUntil(const time::Clock::time_point a_deadline, const bool a_acquire) {
+    VERIFY(m_lock && "m_lock shouldn't be a nullptr")
+
+#ifdef NTL_PLATFORM_APPLE
+    const timespec timeout = time::ToTimespec(a_deadline - time::Clock::now());
+    const int result = pthread_cond_timedwait_relative_np(&m_condition, &m_lock->m_mutex, &timeout);
+#else
+    const timespec deadline = time::ToTimespec(a_deadline);
+    const int result = pthread_cond_timedwait(&m_condition, &m_lock->m_mutex, &deadline);
+#endif
+
+    if (!a_acquire)
+      m_lock->Release();
+
+    return result != ETIMEDOUT;
+  }
+
   void Condition::Signal() {
     pthread_cond_signal(&m_condition);
   }
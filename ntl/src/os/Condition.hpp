@@ -8,9 +8,12 @@
 #ifndef NTL_CONDITION_HPP
 #define NTL_CONDITION_HPP
 
+#include <chrono>
+
 #include <pthread.h>
 
 #include "os/Lock.hpp"
+#include "os/Time.hpp"
 
 namespace ntl {
   /**
@@ -64,6 +67,26 @@ namespace ntl {
      */
     void Wait(bool a_acquire = true);
 
+    /**
+     * @brief Waits for a condition, but for at most the given duration.
+     *
+     * @param a_timeout the maximum duration to wait
+     * @param a_acquire if the condition should re-acquire the lock after waiting
+     *
+     * @return Returns false if the timeout passed, otherwise returns true.
+     */
+    bool WaitFor(std::chrono::nanoseconds a_timeout, bool a_acquire = true);
+
+    /**
+     * @brief Waits for a condition, but until the given point in time at most.
+     *
+     * @param a_deadline the point in time to stop waiting at
+     * @param a_acquire if the condition should re-acquire the lock after waiting
+     *
+     * @return Returns false if the deadline passed, otherwise returns true.
+     */
+    bool WaitUntil(time::Clock::time_point a_deadline, bool a_acquire = true);
+
     /**
      * @brief Signals the condition to a single waiting thread.
      */
@@ -0,0 +1,61 @@
+/**
+* @file Counter.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Counter.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+namespace ntl {
+  namespace {
+    using Order = Atomic<I64>::MemoryOrder;
+
+    Atomic<Size> g_next_thread{0};
+
+    /**
+     * @brief Gets the index of the calling thread, which is assigned on first use.
+     */
+    Size threadIndex() {
+      thread_local const Size index = g_next_thread.FetchAdd<Atomic<Size>::MemoryOrder::Relaxed>(1);
+      return index;
+    }
+  }
+
+  Counter::Counter(Size a_shard_count) {
+    if(a_shard_count == 0)
+      a_shard_count = std::thread::hardware_concurrency();
+
+    m_shard_count = std::bit_ceil(std::max(a_shard_count, Size{1}));
+    m_shards = new PaddedAtomic<I64>[m_shard_count];
+    Reset();
+  }
+
+  Counter::~Counter() {
+    delete[] m_shards;
+  }
+
+  void Counter::Add(const I64 a_value) {
+    m_shards[threadIndex() & (m_shard_count - 1)].FetchAdd<Order::Relaxed>(a_value);
+  }
+
+  I64 Counter::Sum() const {
+    I64 sum = 0;
+    for(Size i = 0; i < m_shard_count; ++i)
+      sum += m_shards[i].Load<Order::Relaxed>();
+    return sum;
+  }
+
+  void Counter::Reset() {
+    for(Size i = 0; i < m_shard_count; ++i)
+      m_shards[i].Store<Order::Relaxed>(0);
+  }
+
+  Size Counter::GetShardCount() const {
+    return m_shard_count;
+  }
+}
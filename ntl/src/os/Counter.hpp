@@ -0,0 +1,94 @@
+/**
+* @file Counter.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_COUNTER_HPP
+#define NTL_COUNTER_HPP
+
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "os/Atomic.hpp"
+
+namespace ntl {
+  /**
+   * @brief A counter for statistics that many threads add to, but that is rarely read.
+   *
+   * @details The count is split into shards on cache lines of their own, and every thread adds to
+   * the shard of its own (assigned round-robin on its first use of any counter). So as long as there
+   * aren't more threads than shards, adding never bounces a cache line between cores. Reading the
+   * count sums up all shards.
+   */
+  class Counter {
+  private:
+    PaddedAtomic<I64>* m_shards;
+    Size m_shard_count;
+
+  public:
+    /**
+     * @brief Constructs a new counter at 0.
+     *
+     * @param a_shard_count the number of shards (0 uses the number of CPUs, rounded up to the next power of two)
+     */
+    explicit Counter(Size a_shard_count = 0);
+
+    /**
+     * @brief Default Destructor.
+     */
+    ~Counter();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another counter
+     */
+    Counter(const Counter& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another counter
+     *
+     * @return the reference to the counter
+     */
+    Counter& operator=(const Counter& a_other) = delete;
+
+    /**
+     * @brief Adds the given value to the shard of the calling thread.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_value the value to add (negative values subtract)
+     */
+    void Add(I64 a_value = 1);
+
+    /**
+     * @brief Sums up all shards.
+     *
+     * @details Runtime: O(s), where s is the number of shards
+     *
+     * Concurrent additions may or may not be included, so the sum is only exact if nobody adds.
+     *
+     * @return the count
+     */
+    [[nodiscard]] I64 Sum() const;
+
+    /**
+     * @brief Resets all shards to 0.
+     *
+     * @details Runtime: O(s), where s is the number of shards
+     */
+    void Reset();
+
+    /**
+     * @brief Gets the number of shards.
+     *
+     * @return the number of shards
+     */
+    [[nodiscard]] Size GetShardCount() const;
+  };
+}
+
+#endif // NTL_COUNTER_HPP
@@ -0,0 +1,76 @@
+/**
+* @file DistributedSharedLock.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "DistributedSharedLock.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+#include "core/Assert.hpp"
+#include "os/Atomic.hpp"
+
+#ifdef NTL_PLATFORM_LINUX
+  #include <sched.h>
+#endif
+
+namespace ntl {
+  namespace {
+    Atomic<Size> g_next_thread{0};
+
+    /**
+     * @brief Gets the CPU the calling thread runs on (or a fixed number per thread if unknown).
+     */
+    Size currentCpu() {
+#ifdef NTL_PLATFORM_LINUX
+      const int cpu = sched_getcpu();
+      if(cpu >= 0)
+        return static_cast<Size>(cpu);
+#endif
+      thread_local const Size thread = g_next_thread.FetchAdd(1, Atomic<Size>::MemoryOrder::Relaxed);
+      return thread;
+    }
+  }
+
+  DistributedSharedLock::DistributedSharedLock(Size a_slot_count) {
+    if(a_slot_count == 0)
+      a_slot_count = std::thread::hardware_concurrency();
+
+    m_slot_count = std::bit_ceil(std::max(a_slot_count, Size{1}));
+    m_slots = new Slot[m_slot_count];
+  }
+
+  DistributedSharedLock::~DistributedSharedLock() {
+    delete[] m_slots;
+  }
+
+  Size DistributedSharedLock::StartRead() {
+    const Size slot = currentCpu() & (m_slot_count - 1);
+    m_slots[slot].lock.StartRead();
+    return slot;
+  }
+
+  void DistributedSharedLock::EndRead(const Size a_slot) {
+    VERIFY(a_slot < m_slot_count)
+    m_slots[a_slot].lock.EndRead();
+  }
+
+  void DistributedSharedLock::StartWrite() {
+    // always in the same order, so concurrent writers can't deadlock
+    for(Size i = 0; i < m_slot_count; ++i)
+      m_slots[i].lock.StartWrite();
+  }
+
+  void DistributedSharedLock::EndWrite() {
+    for(Size i = m_slot_count; i > 0; --i)
+      m_slots[i - 1].lock.EndWrite();
+  }
+
+  Size DistributedSharedLock::GetSlotCount() const {
+    return m_slot_count;
+  }
+}
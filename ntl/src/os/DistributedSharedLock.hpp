@@ -0,0 +1,106 @@
+/**
+* @file DistributedSharedLock.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_DISTRIBUTED_SHARED_LOCK_HPP
+#define NTL_DISTRIBUTED_SHARED_LOCK_HPP
+
+#include "core/Platform.hpp"
+#include "data/Size.hpp"
+#include "os/ReadWriteLock.hpp"
+
+namespace ntl {
+  /**
+   * @brief A reader-writer lock for data that is read very often and written rarely.
+   *
+   * @details Holds a ReadWriteLock per CPU, each on its own cache line. Readers only lock the one of
+   * the CPU they run on, so readers on different CPUs never write to the same cache line. Writers
+   * lock all of them in order, which makes a write access as expensive as one per CPU.
+   *
+   * As the calling thread may move to a different CPU during the read access, StartRead returns the
+   * slot it locked, which has to be passed to EndRead.
+   */
+  class DistributedSharedLock {
+  private:
+    /**
+     * @brief A lock on its own cache line.
+     */
+    struct alignas(NTL_CACHE_LINE_SIZE) Slot {
+      ReadWriteLock lock;
+    };
+
+    Slot* m_slots;
+    Size m_slot_count;
+
+  public:
+    /**
+     * @brief Constructs a new lock.
+     *
+     * @param a_slot_count the number of slots (0 uses the number of CPUs, rounded up to the next power of two)
+     */
+    explicit DistributedSharedLock(Size a_slot_count = 0);
+
+    /**
+     * @brief Default Destructor.
+     */
+    ~DistributedSharedLock();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another lock
+     */
+    DistributedSharedLock(const DistributedSharedLock& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another lock
+     *
+     * @return the reference to the lock
+     */
+    DistributedSharedLock& operator=(const DistributedSharedLock& a_other) = delete;
+
+    /**
+     * @brief Starts the shared read access on the slot of the current CPU.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the locked slot, which has to be passed to EndRead
+     */
+    Size StartRead();
+
+    /**
+     * @brief Ends the shared read access.
+     *
+     * @param a_slot the slot returned by StartRead
+     */
+    void EndRead(Size a_slot);
+
+    /**
+     * @brief Starts the exclusive write access by locking all slots.
+     *
+     * @details Runtime: O(s), where s is the number of slots
+     */
+    void StartWrite();
+
+    /**
+     * @brief Ends the exclusive write access.
+     *
+     * @details Runtime: O(s), where s is the number of slots
+     */
+    void EndWrite();
+
+    /**
+     * @brief Gets the number of slots.
+     *
+     * @return the number of slots
+     */
+    [[nodiscard]] Size GetSlotCount() const;
+  };
+}
+
+#endif // NTL_DISTRIBUTED_SHARED_LOCK_HPP
@@ -0,0 +1,52 @@
+/**
+* @file Executor.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Executor.hpp"
+
+#include <chrono>
+
+namespace ntl {
+  namespace {
+    using Order = Atomic<Size>::MemoryOrder;
+
+    // how long a blocked Spawn sleeps before looking for pending tasks again
+    constexpr std::chrono::microseconds SLOT_WAIT{200};
+  }
+
+  Executor::Executor(ThreadPool& a_pool, const Size a_max_in_flight)
+    : m_pool{&a_pool}, m_max_in_flight{a_max_in_flight}, m_slots{static_cast<U32>(a_max_in_flight)}, m_running{0} {
+    // Empty
+  }
+
+  Executor::~Executor() {
+    detail::HelpUntil(*m_pool, [this] { return m_running.Load(Order::Acquire) == 0; });
+  }
+
+  detail::ScheduleAwaiter Executor::Schedule() const { return detail::ScheduleAwaiter{m_pool}; }
+
+  ThreadPool& Executor::GetPool() const { return *m_pool; }
+
+  Size Executor::GetMaxInFlight() const { return m_max_in_flight; }
+
+  void Executor::acquireSlot() {
+    m_running.FetchAdd(1, Order::Relaxed);
+    if(m_max_in_flight == 0)
+      return;
+
+    // the slots are held by tasks which are pending or running, so help with them instead of just sleeping
+    while(!m_slots.TryWait()) {
+      if(!m_pool->RunPending() && m_slots.WaitFor(SLOT_WAIT))
+        return;
+    }
+  }
+
+  void Executor::releaseSlot() {
+    if(m_max_in_flight > 0)
+      m_slots.Post();
+    m_running.FetchSub(1, Order::Release);
+  }
+}
@@ -0,0 +1,975 @@
+/**
+* @file Executor.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_EXECUTOR_HPP
+#define NTL_EXECUTOR_HPP
+
+#include <sched.h>
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "data/Array.hpp"
+#include "data/Pair.hpp"
+#include "data/Size.hpp"
+#include "os/Atomic.hpp"
+#include "os/LightweightSemaphore.hpp"
+#include "os/ThreadPool.hpp"
+
+namespace ntl {
+  template <typename T>
+  class Future;
+
+  /**
+   * @brief The value of a finished Future<void> within the results of WhenAll.
+   */
+  struct Unit {
+    bool operator==(const Unit& a_other) const = default;
+  };
+
+  namespace detail {
+    template <typename T>
+    using FutureValue = std::conditional_t<std::is_void_v<T>, Unit, T>;
+
+    /**
+     * @brief A callback run by the thread finishing a future, which deletes it afterwards.
+     */
+    struct FutureCallback {
+      void (*run)(FutureCallback*);
+
+      constexpr explicit FutureCallback(void (*a_run)(FutureCallback*)) : run{a_run} {
+        // Empty
+      }
+    };
+
+    // marks a finished state in place of its callback
+    inline FutureCallback g_future_ready{nullptr};
+
+    /**
+     * @brief The state shared by a future and the task (or promise) producing its value.
+     *
+     * @details The callback pointer is the only synchronization: it is nullptr while the value is
+     * pending, points to the registered callback while waiting for it and to g_future_ready once the
+     * value is set. So registering a callback and setting the value race on a single exchange, and
+     * whoever comes second runs the callback.
+     */
+    template <typename T>
+    class FutureState {
+    private:
+      using Order = typename Atomic<Size>::MemoryOrder;
+      using CallbackOrder = typename Atomic<FutureCallback*>::MemoryOrder;
+
+      Atomic<Size> m_references;
+      Atomic<FutureCallback*> m_callback;
+      ThreadPool* m_pool;
+      union {
+        FutureValue<T> m_value;
+      };
+
+    public:
+      explicit FutureState(ThreadPool& a_pool) : m_references{1}, m_callback{nullptr}, m_pool{&a_pool} {
+        // Empty
+      }
+
+      ~FutureState() {
+        if(IsReady())
+          std::destroy_at(&m_value);
+      }
+
+      FutureState(const FutureState& a_other) = delete;
+      FutureState& operator=(const FutureState& a_other) = delete;
+
+      void Acquire() { m_references.FetchAdd(1, Order::Relaxed); }
+
+      void Release() {
+        if(m_references.FetchSub(1, Order::AcquireRelease) == 1)
+          delete this;
+      }
+
+      template <typename... Args>
+      void SetValue(Args&&... a_args) {
+        std::construct_at(&m_value, std::forward<Args>(a_args)...);
+        FutureCallback* callback = m_callback.Exchange(&g_future_ready, CallbackOrder::AcquireRelease);
+        VERIFY(callback != &g_future_ready && "The value of a future can only be set once")
+        if(callback)
+          callback->run(callback);
+      }
+
+      void SetCallback(FutureCallback* a_callback) {
+        FutureCallback* expected = nullptr;
+        if(!m_callback.CompareExchangeStrong(expected, a_callback, CallbackOrder::AcquireRelease,
+                                            CallbackOrder::Acquire)) {
+          VERIFY(expected == &g_future_ready && "A future can only have a single continuation")
+          a_callback->run(a_callback);
+        }
+      }
+
+      [[nodiscard]] bool IsReady() const { return m_callback.Load(CallbackOrder::Acquire) == &g_future_ready; }
+
+      [[nodiscard]] FutureValue<T>& GetValue() { return m_value; }
+
+      [[nodiscard]] ThreadPool& GetPool() const { return *m_pool; }
+    };
+
+    /**
+     * @brief Sets the state to the result of the given callable.
+     *
+     * @param a_state the state
+     * @param a_function a callable without parameters returning the value type of the state
+     */
+    template <typename T, typename Function>
+    void Fulfill(FutureState<T>& a_state, Function& a_function) {
+      if constexpr(std::is_void_v<T>) {
+        a_function();
+        a_state.SetValue();
+      } else {
+        a_state.SetValue(a_function());
+      }
+    }
+
+    /**
+     * @brief Gives the combinators access to the state of futures.
+     */
+    struct FutureAccess {
+      template <typename T>
+      static FutureState<T>* Take(Future<T>& a_future) { return std::exchange(a_future.m_state, nullptr); }
+
+      template <typename T>
+      static Future<T> Make(FutureState<T>* a_state) { return Future<T>(a_state); }
+
+      template <typename T>
+      static ThreadPool& GetPool(const Future<T>& a_future) { return a_future.m_state->GetPool(); }
+    };
+
+    /**
+     * @brief Calls the given callable with the value of the future on the thread finishing it.
+     *
+     * @param a_future the future to consume
+     * @param a_function a callable taking the value (Unit for void), which has to be cheap
+     */
+    template <typename T, typename Function>
+    void Listen(Future<T>&& a_future, Function&& a_function) {
+      struct Listener : FutureCallback {
+        std::decay_t<Function> function;
+        FutureState<T>* state;
+
+        Listener(Function&& a_function, FutureState<T>* a_state)
+          : FutureCallback{&Listener::invoke}, function(std::forward<Function>(a_function)), state{a_state} {
+          // Empty
+        }
+
+        static void invoke(FutureCallback* a_callback) {
+          auto* listener = static_cast<Listener*>(a_callback);
+          listener->function(std::move(listener->state->GetValue()));
+          listener->state->Release();
+          delete listener;
+        }
+      };
+
+      FutureState<T>* state = FutureAccess::Take(a_future);
+      VERIFY(state && "The future has no state")
+      state->SetCallback(new Listener(std::forward<Function>(a_function), state));
+    }
+
+    template <typename T, typename Function>
+    struct ThenResultOf {
+      using Type = std::invoke_result_t<Function&, T&&>;
+    };
+
+    template <typename Function>
+    struct ThenResultOf<void, Function> {
+      using Type = std::invoke_result_t<Function&>;
+    };
+
+    template <typename T, typename Function>
+    using ThenResult = typename ThenResultOf<T, std::decay_t<Function>>::Type;
+
+    inline void ResumeCoroutine(void* a_address) { std::coroutine_handle<>::from_address(a_address).resume(); }
+
+    /**
+     * @brief Resumes a coroutine on the pool once the awaited future is finished.
+     */
+    struct ResumeCallback : FutureCallback {
+      std::coroutine_handle<> handle;
+      ThreadPool* pool;
+
+      ResumeCallback(const std::coroutine_handle<> a_handle, ThreadPool& a_pool)
+        : FutureCallback{&ResumeCallback::invoke}, handle{a_handle}, pool{&a_pool} {
+        // Empty
+      }
+
+      static void invoke(FutureCallback* a_callback) {
+        auto* callback = static_cast<ResumeCallback*>(a_callback);
+        ThreadPool* pool = callback->pool;
+        void* address = callback->handle.address();
+        delete callback;
+        pool->Submit(ThreadPool::Task{&ResumeCoroutine, address, nullptr});
+      }
+    };
+
+    /**
+     * @brief Awaiting it continues the coroutine on a thread of the pool.
+     */
+    struct ScheduleAwaiter {
+      ThreadPool* pool;
+
+      [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+      void await_suspend(const std::coroutine_handle<> a_handle) const {
+        pool->Submit(ThreadPool::Task{&ResumeCoroutine, a_handle.address(), nullptr});
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief The promise of coroutines returning a future, which sets it on co_return.
+     */
+    template <typename T>
+    class CoroutinePromise {
+    protected:
+      FutureState<T>* m_state;
+
+    public:
+      explicit CoroutinePromise(ThreadPool& a_pool) : m_state{new FutureState<T>(a_pool)} {
+        // Empty
+      }
+
+      ~CoroutinePromise() { m_state->Release(); }
+
+      std::suspend_never initial_suspend() noexcept { return {}; }
+
+      std::suspend_never final_suspend() noexcept { return {}; }
+
+      void unhandled_exception() noexcept { std::terminate(); }
+
+      template <typename U>
+      void return_value(U&& a_value) { m_state->SetValue(std::forward<U>(a_value)); }
+    };
+
+    template <>
+    class CoroutinePromise<void> {
+    protected:
+      FutureState<void>* m_state;
+
+    public:
+      explicit CoroutinePromise(ThreadPool& a_pool) : m_state{new FutureState<void>(a_pool)} {
+        // Empty
+      }
+
+      ~CoroutinePromise() { m_state->Release(); }
+
+      std::suspend_never initial_suspend() noexcept { return {}; }
+
+      std::suspend_never final_suspend() noexcept { return {}; }
+
+      void unhandled_exception() noexcept { std::terminate(); }
+
+      void return_void() { m_state->SetValue(); }
+    };
+
+    /**
+     * @brief Executes pending tasks of the pool (or yields) until the given callable returns true.
+     *
+     * @param a_pool the pool
+     * @param a_done a callable without parameters
+     */
+    template <typename Done>
+    void HelpUntil(ThreadPool& a_pool, const Done& a_done) {
+      while(!a_done()) {
+        if(!a_pool.RunPending())
+          sched_yield();
+      }
+    }
+  }
+
+  /**
+   * @brief Runs callables on a ThreadPool and hands out futures for their results.
+   *
+   * @details The pool does the work-stealing: tasks spawned by a task are executed by the same worker
+   * (newest first), while idle workers steal the oldest ones. Continuations attached with Future::Then
+   * are scheduled the same way as soon as their future is finished, so stages like parse, sort and build
+   * overlap without any thread blocking. The executor only adds the futures and, if a limit is given,
+   * backpressure: Spawn waits while the limit of tasks is in flight (executing pending tasks meanwhile),
+   * so a fast producer stage can't queue up unbounded amounts of work and memory.
+   *
+   * Waiting for a future (Get, Wait, a blocking Spawn) executes pending tasks of the pool instead of
+   * sleeping, so it may be called within tasks as well.
+   */
+  class Executor {
+  private:
+    ThreadPool* m_pool;
+    Size m_max_in_flight;
+    LightweightSemaphore m_slots;
+    Atomic<Size> m_running;
+
+  public:
+    /**
+     * @brief Constructs a new executor using the given pool.
+     *
+     * @param a_pool the pool executing the tasks
+     * @param a_max_in_flight the maximum number of spawned tasks which didn't finish yet (0 for no limit)
+     */
+    explicit Executor(ThreadPool& a_pool = ThreadPool::GetDefault(), Size a_max_in_flight = 0);
+
+    /**
+     * @brief Waits for all spawned tasks (not for their continuations).
+     */
+    ~Executor();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another executor
+     */
+    Executor(const Executor& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another executor
+     *
+     * @return the reference to the executor
+     */
+    Executor& operator=(const Executor& a_other) = delete;
+
+    /**
+     * @brief Runs the given callable as a task of the pool.
+     *
+     * @details Runtime: O(1) (amortized), waits while the limit of tasks is in flight
+     *
+     * @param a_function a callable without parameters, which is moved into the task
+     * @return the future receiving the result of the callable
+     */
+    template <typename Function>
+    auto Spawn(Function&& a_function) -> Future<std::invoke_result_t<std::decay_t<Function>&>>;
+
+    /**
+     * @brief Moves the awaiting coroutine onto a thread of the pool (co_await executor.Schedule()).
+     *
+     * @return the awaitable
+     */
+    [[nodiscard]] detail::ScheduleAwaiter Schedule() const;
+
+    /**
+     * @brief Gets the pool executing the tasks.
+     *
+     * @return the reference to the pool
+     */
+    [[nodiscard]] ThreadPool& GetPool() const;
+
+    /**
+     * @brief Gets the maximum number of spawned tasks in flight.
+     *
+     * @return the limit (0 for no limit)
+     */
+    [[nodiscard]] Size GetMaxInFlight() const;
+
+  private:
+    /**
+     * @brief Registers a spawned task, waiting for a free slot if the number of tasks is limited.
+     */
+    void acquireSlot();
+
+    /**
+     * @brief Unregisters a finished task, freeing its slot.
+     */
+    void releaseSlot();
+  };
+
+  /**
+   * @brief The result of an asynchronous operation, which becomes available once it finished.
+   *
+   * @details Futures are move-only handles to a state shared with the producing task. Get consumes
+   * the value (as do Then and co_await), so every future has a single consumer. Dropping a future
+   * which isn't finished detaches it, the task runs anyways and its result is discarded.
+   *
+   * Functions returning a future can be coroutines: they start right away on the calling thread,
+   * co_await other futures (resuming on the pool) and co_return the value. If the first parameter
+   * is an Executor, its pool is used, otherwise the default one.
+   *
+   * @tparam T the type of the value (void for none)
+   */
+  template <typename T>
+  class Future {
+  friend struct detail::FutureAccess;
+
+  private:
+    detail::FutureState<T>* m_state;
+
+  public:
+    using ValueType = T;
+
+    /**
+     * @brief The promise type making functions returning a future coroutines.
+     */
+    struct promise_type : detail::CoroutinePromise<T> {
+      promise_type();
+
+      template <typename... Args>
+      explicit promise_type(Executor& a_executor, Args&... a_args);
+
+      Future get_return_object();
+    };
+
+    /**
+     * @brief Constructs a future without a state (see IsValid).
+     */
+    Future();
+
+    /**
+     * @brief Move Constructor.
+     *
+     * @param a_other an rvalue-reference to another future
+     */
+    Future(Future&& a_other) noexcept;
+
+    /**
+     * @brief Move-Assignment operator.
+     *
+     * @param a_other an rvalue-reference to another future
+     *
+     * @return the reference to the future
+     */
+    Future& operator=(Future&& a_other) noexcept;
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another future
+     */
+    Future(const Future& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another future
+     *
+     * @return the reference to the future
+     */
+    Future& operator=(const Future& a_other) = delete;
+
+    /**
+     * @brief Releases the state, detaching a task which isn't finished.
+     */
+    ~Future();
+
+    /**
+     * @brief Checks if the future has a state, i.e. wasn't default constructed or consumed.
+     *
+     * @return if the future has a state
+     */
+    [[nodiscard]] bool IsValid() const;
+
+    /**
+     * @brief Checks if the value is available.
+     *
+     * @return if the value is available
+     */
+    [[nodiscard]] bool IsReady() const;
+
+    /**
+     * @brief Waits until the value is available, executing pending tasks of the pool meanwhile.
+     */
+    void Wait() const;
+
+    /**
+     * @brief Waits for the value and moves it out of the future, which becomes invalid.
+     *
+     * @return the value
+     */
+    T Get();
+
+    /**
+     * @brief Attaches a continuation, which is run as a task of the pool once the value is available.
+     *
+     * @details Runtime: O(1), consumes the future
+     *
+     * @param a_function a callable taking the value (nothing for void), which is moved into the task
+     * @return the future receiving the result of the continuation
+     */
+    template <typename Function>
+    auto Then(Function&& a_function) -> Future<detail::ThenResult<T, Function>>;
+
+    [[nodiscard]] bool await_ready() const;
+
+    void await_suspend(std::coroutine_handle<> a_handle);
+
+    T await_resume();
+
+  private:
+    /**
+     * @brief Constructs a future owning a reference of the given state.
+     *
+     * @param a_state the state
+     */
+    explicit Future(detail::FutureState<T>* a_state);
+  };
+
+  /**
+   * @brief Sets the value of a future from outside of a task, e.g. on completion of I/O.
+   *
+   * @tparam T the type of the value (void for none)
+   */
+  template <typename T>
+  class Promise {
+  private:
+    detail::FutureState<T>* m_state;
+    bool m_retrieved;
+
+  public:
+    /**
+     * @brief Constructs a new promise, whose future uses the given pool for its continuations.
+     *
+     * @param a_pool the pool
+     */
+    explicit Promise(ThreadPool& a_pool = ThreadPool::GetDefault());
+
+    /**
+     * @brief Move Constructor.
+     *
+     * @param a_other an rvalue-reference to another promise
+     */
+    Promise(Promise&& a_other) noexcept;
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another promise
+     */
+    Promise(const Promise& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another promise
+     *
+     * @return the reference to the promise
+     */
+    Promise& operator=(const Promise& a_other) = delete;
+
+    /**
+     * @brief Releases the state, which has to be set by then.
+     */
+    ~Promise();
+
+    /**
+     * @brief Gets the future of the promise, which can only be done once.
+     *
+     * @return the future
+     */
+    [[nodiscard]] Future<T> GetFuture();
+
+    /**
+     * @brief Sets the value, running the continuation of the future.
+     *
+     * @param a_args the arguments to construct the value with (none for void)
+     */
+    template <typename... Args>
+    void Set(Args&&... a_args);
+  };
+
+  /**
+   * @brief Combines futures into one finishing after all of them.
+   *
+   * @details Runtime: O(n), where n is the number of futures, consumes the futures
+   *
+   * @param a_futures the futures
+   * @return the future receiving the values in the order of the futures (Unit for void futures)
+   */
+  template <typename... Ts>
+  Future<std::tuple<detail::FutureValue<Ts>...>> WhenAll(Future<Ts>... a_futures);
+
+  /**
+   * @brief Combines futures of the same type into one finishing after all of them.
+   *
+   * @details Runtime: O(n), where n is the number of futures, consumes the futures
+   *
+   * @param a_futures the futures
+   * @return the future receiving the values in the order of the futures (Unit for void futures)
+   */
+  template <typename T, typename Allocator>
+  Future<Array<detail::FutureValue<T>>> WhenAll(Array<Future<T>, Allocator>& a_futures);
+
+  /**
+   * @brief Combines futures of the same type into one finishing with the first of them.
+   *
+   * @details Runtime: O(n), where n is the number of futures, consumes the futures (the other values are discarded)
+   *
+   * @param a_futures the futures (at least one)
+   * @return the future receiving the index of the first finished future and its value
+   */
+  template <typename T, typename Allocator>
+  Future<Pair<Size, detail::FutureValue<T>>> WhenAny(Array<Future<T>, Allocator>& a_futures);
+
+  /**
+   * @brief Combines futures of the same type into one finishing with the first of them.
+   *
+   * @details Runtime: O(n), where n is the number of futures, consumes the futures (the other values are discarded)
+   *
+   * @param a_first the first future
+   * @param a_rest the other futures
+   * @return the future receiving the index of the first finished future and its value
+   */
+  template <typename T, typename... Rest>
+    requires (std::is_same_v<Rest, Future<T>> && ...)
+  Future<Pair<Size, detail::FutureValue<T>>> WhenAny(Future<T> a_first, Rest... a_rest);
+
+  // -------------------------
+  // EXECUTOR PUBLIC METHODS
+  // -------------------------
+
+  template <typename Function>
+  auto Executor::Spawn(Function&& a_function) -> Future<std::invoke_result_t<std::decay_t<Function>&>> {
+    using ResultType = std::invoke_result_t<std::decay_t<Function>&>;
+
+    struct Job {
+      std::decay_t<Function> function;
+      detail::FutureState<ResultType>* state;
+      Executor* executor;
+
+      static void run(void* a_job) {
+        auto* job = static_cast<Job*>(a_job);
+        Executor* executor = job->executor;
+        detail::Fulfill(*job->state, job->function);
+        job->state->Release();
+        delete job;
+        executor->releaseSlot();
+      }
+    };
+
+    acquireSlot();
+    auto* state = new detail::FutureState<ResultType>(*m_pool);
+    state->Acquire();
+    m_pool->Submit(ThreadPool::Task{&Job::run, new Job{std::forward<Function>(a_function), state, this}, nullptr});
+    return detail::FutureAccess::Make(state);
+  }
+
+  // ---------------------------------------
+  // FUTURE PUBLIC AND PRIVATE METHODS
+  // ---------------------------------------
+
+  template <typename T>
+  Future<T>::promise_type::promise_type() : detail::CoroutinePromise<T>(ThreadPool::GetDefault()) {
+    // Empty
+  }
+
+  template <typename T>
+  template <typename... Args>
+  Future<T>::promise_type::promise_type(Executor& a_executor, Args&...)
+    : detail::CoroutinePromise<T>(a_executor.GetPool()) {
+    // Empty
+  }
+
+  template <typename T>
+  Future<T> Future<T>::promise_type::get_return_object() {
+    this->m_state->Acquire();
+    return Future(this->m_state);
+  }
+
+  template <typename T>
+  Future<T>::Future() : m_state{nullptr} {
+    // Empty
+  }
+
+  template <typename T>
+  Future<T>::Future(detail::FutureState<T>* a_state) : m_state{a_state} {
+    // Empty
+  }
+
+  template <typename T>
+  Future<T>::Future(Future&& a_other) noexcept : m_state{std::exchange(a_other.m_state, nullptr)} {
+    // Empty
+  }
+
+  template <typename T>
+  Future<T>& Future<T>::operator=(Future&& a_other) noexcept {
+    if(this != &a_other) {
+      if(m_state)
+        m_state->Release();
+      m_state = std::exchange(a_other.m_state, nullptr);
+    }
+    return *this;
+  }
+
+  template <typename T>
+  Future<T>::~Future() {
+    if(m_state)
+      m_state->Release();
+  }
+
+  template <typename T>
+  bool Future<T>::IsValid() const {
+    return m_state != nullptr;
+  }
+
+  template <typename T>
+  bool Future<T>::IsReady() const {
+    return m_state && m_state->IsReady();
+  }
+
+  template <typename T>
+  void Future<T>::Wait() const {
+    VERIFY(m_state && "The future has no state")
+    detail::HelpUntil(m_state->GetPool(), [this] { return m_state->IsReady(); });
+  }
+
+  template <typename T>
+  T Future<T>::Get() {
+    Wait();
+    detail::FutureState<T>* state = std::exchange(m_state, nullptr);
+    if constexpr(std::is_void_v<T>) {
+      state->Release();
+    } else {
+      T value = std::move(state->GetValue());
+      state->Release();
+      return value;
+    }
+  }
+
+  template <typename T>
+  template <typename Function>
+  auto Future<T>::Then(Function&& a_function) -> Future<detail::ThenResult<T, Function>> {
+    using ResultType = detail::ThenResult<T, Function>;
+
+    // the callback submits itself as the task computing the result
+    struct Job : detail::FutureCallback {
+      std::decay_t<Function> function;
+      detail::FutureState<T>* source;
+      detail::FutureState<ResultType>* target;
+
+      Job(Function&& a_function, detail::FutureState<T>* a_source, detail::FutureState<ResultType>* a_target)
+        : detail::FutureCallback{&Job::submit}, function(std::forward<Function>(a_function)), source{a_source},
+          target{a_target} {
+        // Empty
+      }
+
+      static void submit(detail::FutureCallback* a_callback) {
+        auto* job = static_cast<Job*>(a_callback);
+        job->source->GetPool().Submit(ThreadPool::Task{&Job::run, job, nullptr});
+      }
+
+      static void run(void* a_job) {
+        auto* job = static_cast<Job*>(a_job);
+        auto call = [job]() -> ResultType {
+          if constexpr(std::is_void_v<T>)
+            return job->function();
+          else
+            return job->function(std::move(job->source->GetValue()));
+        };
+        detail::Fulfill(*job->target, call);
+        job->source->Release();
+        job->target->Release();
+        delete job;
+      }
+    };
+
+    VERIFY(m_state && "The future has no state")
+    detail::FutureState<T>* source = std::exchange(m_state, nullptr);
+    auto* target = new detail::FutureState<ResultType>(source->GetPool());
+    target->Acquire();
+    source->SetCallback(new Job(std::forward<Function>(a_function), source, target));
+    return detail::FutureAccess::Make(target);
+  }
+
+  template <typename T>
+  bool Future<T>::await_ready() const {
+    return IsReady();
+  }
+
+  template <typename T>
+  void Future<T>::await_suspend(const std::coroutine_handle<> a_handle) {
+    VERIFY(m_state && "The future has no state")
+    m_state->SetCallback(new detail::ResumeCallback(a_handle, m_state->GetPool()));
+  }
+
+  template <typename T>
+  T Future<T>::await_resume() {
+    return Get();
+  }
+
+  // -------------------------
+  // PROMISE PUBLIC METHODS
+  // -------------------------
+
+  template <typename T>
+  Promise<T>::Promise(ThreadPool& a_pool) : m_state{new detail::FutureState<T>(a_pool)}, m_retrieved{false} {
+    // Empty
+  }
+
+  template <typename T>
+  Promise<T>::Promise(Promise&& a_other) noexcept
+    : m_state{std::exchange(a_other.m_state, nullptr)}, m_retrieved{a_other.m_retrieved} {
+    // Empty
+  }
+
+  template <typename T>
+  Promise<T>::~Promise() {
+    if(m_state) {
+      VERIFY(m_state->IsReady() && "A promise has to be set before it is destroyed")
+      m_state->Release();
+    }
+  }
+
+  template <typename T>
+  Future<T> Promise<T>::GetFuture() {
+    VERIFY(m_state && !m_retrieved && "The future of a promise can only be retrieved once")
+    m_retrieved = true;
+    m_state->Acquire();
+    return detail::FutureAccess::Make(m_state);
+  }
+
+  template <typename T>
+  template <typename... Args>
+  void Promise<T>::Set(Args&&... a_args) {
+    VERIFY(m_state && "The promise has no state")
+    m_state->SetValue(std::forward<Args>(a_args)...);
+  }
+
+  // -------------------------
+  // COMBINATORS
+  // -------------------------
+
+  template <typename... Ts>
+  Future<std::tuple<detail::FutureValue<Ts>...>> WhenAll(Future<Ts>... a_futures) {
+    using ResultType = std::tuple<detail::FutureValue<Ts>...>;
+    using Order = Atomic<Size>::MemoryOrder;
+
+    if constexpr(sizeof...(Ts) == 0) {
+      Promise<ResultType> promise{};
+      promise.Set();
+      return promise.GetFuture();
+    } else {
+      struct Shared {
+        std::tuple<std::optional<detail::FutureValue<Ts>>...> values;
+        Atomic<Size> remaining{sizeof...(Ts)};
+        detail::FutureState<ResultType>* result = nullptr;
+      };
+
+      VERIFY((a_futures.IsValid() && ...) && "The futures need a state")
+      std::tuple<Future<Ts>&...> futures{a_futures...};
+      auto* result = new detail::FutureState<ResultType>(detail::FutureAccess::GetPool(std::get<0>(futures)));
+      result->Acquire();
+      auto* shared = new Shared{};
+      shared->result = result;
+
+      // the last finished future sets the result, which may already happen while listening
+      [&]<Size... I>(std::index_sequence<I...>) {
+        (detail::Listen(std::move(std::get<I>(futures)), [shared](auto&& a_value) {
+          std::get<I>(shared->values).emplace(std::move(a_value));
+          if(shared->remaining.FetchSub(1, Order::AcquireRelease) == 1) {
+            shared->result->SetValue(std::apply([](auto&... a_values) { return ResultType(std::move(*a_values)...); },
+                                                shared->values));
+            shared->result->Release();
+            delete shared;
+          }
+        }), ...);
+      }(std::index_sequence_for<Ts...>{});
+
+      return detail::FutureAccess::Make(result);
+    }
+  }
+
+  template <typename T, typename Allocator>
+  Future<Array<detail::FutureValue<T>>> WhenAll(Array<Future<T>, Allocator>& a_futures) {
+    using ValueType = detail::FutureValue<T>;
+    using ResultType = Array<ValueType>;
+    using Order = Atomic<Size>::MemoryOrder;
+
+    const Size count = a_futures.GetSize();
+    if(count == 0) {
+      Promise<ResultType> promise{};
+      promise.Set(Size{1});
+      return promise.GetFuture();
+    }
+
+    struct Shared {
+      std::unique_ptr<std::optional<ValueType>[]> values;
+      Atomic<Size> remaining{0};
+      detail::FutureState<ResultType>* result = nullptr;
+    };
+
+    auto* result = new detail::FutureState<ResultType>(detail::FutureAccess::GetPool(a_futures[0]));
+    result->Acquire();
+    auto* shared = new Shared{};
+    shared->values = std::make_unique<std::optional<ValueType>[]>(count);
+    shared->remaining.Store(count, Order::Relaxed);
+    shared->result = result;
+
+    for(Size i = 0; i < count; ++i) {
+      detail::Listen(std::move(a_futures[i]), [shared, i, count](ValueType&& a_value) {
+        shared->values[i].emplace(std::move(a_value));
+        if(shared->remaining.FetchSub(1, Order::AcquireRelease) == 1) {
+          ResultType values(count);
+          for(Size j = 0; j < count; ++j)
+            values.Insert(std::move(*shared->values[j]));
+          shared->result->SetValue(std::move(values));
+          shared->result->Release();
+          delete shared;
+        }
+      });
+    }
+
+    return detail::FutureAccess::Make(result);
+  }
+
+  template <typename T, typename Allocator>
+  Future<Pair<Size, detail::FutureValue<T>>> WhenAny(Array<Future<T>, Allocator>& a_futures) {
+    using ValueType = detail::FutureValue<T>;
+    using ResultType = Pair<Size, ValueType>;
+    using Order = Atomic<Size>::MemoryOrder;
+
+    const Size count = a_futures.GetSize();
+    VERIFY(count > 0 && "WhenAny needs at least one future")
+
+    struct Shared {
+      Atomic<bool> finished{false};
+      Atomic<Size> remaining{0};
+      detail::FutureState<ResultType>* result = nullptr;
+    };
+
+    auto* result = new detail::FutureState<ResultType>(detail::FutureAccess::GetPool(a_futures[0]));
+    result->Acquire();
+    auto* shared = new Shared{};
+    shared->remaining.Store(count, Order::Relaxed);
+    shared->result = result;
+
+    // the first finished future sets the result, the last one cleans up
+    for(Size i = 0; i < count; ++i) {
+      detail::Listen(std::move(a_futures[i]), [shared, i](ValueType&& a_value) {
+        if(!shared->finished.Exchange(true, Atomic<bool>::MemoryOrder::AcquireRelease)) {
+          ResultType first{};
+          first.first = i;
+          first.second = std::move(a_value);
+          shared->result->SetValue(std::move(first));
+          shared->result->Release();
+        }
+        if(shared->remaining.FetchSub(1, Order::AcquireRelease) == 1)
+          delete shared;
+      });
+    }
+
+    return detail::FutureAccess::Make(result);
+  }
+
+  template <typename T, typename... Rest>
+    requires (std::is_same_v<Rest, Future<T>> && ...)
+  Future<Pair<Size, detail::FutureValue<T>>> WhenAny(Future<T> a_first, Rest... a_rest) {
+    Array<Future<T>> futures(1 + sizeof...(Rest));
+    futures.Insert(std::move(a_first));
+    (futures.Insert(std::move(a_rest)), ...);
+    return WhenAny(futures);
+  }
+}
+
+#endif // NTL_EXECUTOR_HPP
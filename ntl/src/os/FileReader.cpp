@@ -0,0 +1,322 @@
+/**
+* @file FileReader.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "FileReader.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "core/Assert.hpp"
+
+namespace ntl {
+  namespace {
+    // upper bound of the chunks passed to a single vectored read (the minimum IOV_MAX of POSIX)
+    constexpr Size MAX_VECTORS = 16;
+  }
+
+  // ------------------------
+  // ITERATOR-RELATED METHODS
+  // ------------------------
+  FileReader::RecordIterator::RecordIterator(FileReader* a_reader, const char a_delimiter, const bool a_lines)
+    : m_reader{a_reader}, m_record{}, m_delimiter{a_delimiter}, m_lines{a_lines} {
+    if(m_reader != nullptr)
+      ++*this;
+  }
+
+  FileReader::RecordIterator::reference FileReader::RecordIterator::operator*() const {
+    return m_record;
+  }
+
+  FileReader::RecordIterator::pointer FileReader::RecordIterator::operator->() const {
+    return &m_record;
+  }
+
+  FileReader::RecordIterator& FileReader::RecordIterator::operator++() {
+    const bool read = m_lines ? m_reader->ReadLine(m_record) : m_reader->ReadRecord(m_record, m_delimiter);
+    if(!read)
+      m_reader = nullptr;
+    return *this;
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  FileReader::FileReader(const Size a_buffer_size)
+    : m_descriptor{-1}, m_buffer{nullptr}, m_capacity{std::max<Size>(a_buffer_size, 1)}, m_begin{0}, m_end{0},
+      m_eof{false} {
+    m_buffer = new Byte[m_capacity];
+  }
+
+  FileReader::FileReader(const StringView a_path, const Size a_buffer_size)
+    : FileReader(a_buffer_size) {
+    Open(a_path);
+  }
+
+  FileReader::~FileReader() {
+    Close();
+    delete[] m_buffer;
+  }
+
+  FileReader::FileReader(FileReader&& a_other) noexcept
+    : m_descriptor{std::exchange(a_other.m_descriptor, -1)}, m_buffer{std::exchange(a_other.m_buffer, nullptr)},
+      m_capacity{std::exchange(a_other.m_capacity, 0)}, m_begin{std::exchange(a_other.m_begin, 0)},
+      m_end{std::exchange(a_other.m_end, 0)}, m_eof{std::exchange(a_other.m_eof, false)} {
+    // Empty
+  }
+
+  FileReader& FileReader::operator=(FileReader&& a_other) noexcept {
+    if(this != &a_other) {
+      Close();
+      std::swap(m_buffer, a_other.m_buffer);
+      std::swap(m_capacity, a_other.m_capacity);
+      m_descriptor = std::exchange(a_other.m_descriptor, -1);
+      m_begin = std::exchange(a_other.m_begin, 0);
+      m_end = std::exchange(a_other.m_end, 0);
+      m_eof = std::exchange(a_other.m_eof, false);
+    }
+    return *this;
+  }
+
+  bool FileReader::Open(const StringView a_path) {
+    Close();
+    if(m_buffer == nullptr) {
+      m_capacity = DEFAULT_BUFFER_SIZE;
+      m_buffer = new Byte[m_capacity];
+    }
+
+    const String path{a_path};
+    m_descriptor = ::open(path.GetCString(), O_RDONLY);
+    if(m_descriptor < 0)
+      return false;
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    ::posix_fadvise(m_descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    return true;
+  }
+
+  void FileReader::Close() {
+    if(m_descriptor >= 0)
+      ::close(m_descriptor);
+    m_descriptor = -1;
+    m_begin = 0;
+    m_end = 0;
+    m_eof = false;
+  }
+
+  Size FileReader::Read(void* a_data, const Size a_size) {
+    Byte* data = static_cast<Byte*>(a_data);
+    Size total = drain(data, a_size);
+
+    // whatever is at least as big as the buffer skips it, so it's only copied once
+    if(a_size - total >= m_capacity)
+      return total + readFile(data + total, a_size - total);
+
+    while(total < a_size && fill())
+      total += drain(data + total, a_size - total);
+    return total;
+  }
+
+  Size FileReader::Read(const ReadChunk* a_chunks, const Size a_count) {
+    Size total = 0,
+        index = 0,
+        offset = 0;
+
+    const auto advance = [&](Size a_bytes) {
+      total += a_bytes;
+      while(index < a_count && a_bytes >= a_chunks[index].size - offset) {
+        a_bytes -= a_chunks[index].size - offset;
+        offset = 0;
+        ++index;
+      }
+      offset += a_bytes;
+    };
+
+    // the buffered bytes go first, afterwards the file is read into the chunks directly
+    while(index < a_count && m_begin < m_end)
+      advance(drain(static_cast<Byte*>(a_chunks[index].data) + offset, a_chunks[index].size - offset));
+    advance(0);
+
+    while(index < a_count && m_descriptor >= 0 && !m_eof) {
+      iovec vectors[MAX_VECTORS];
+      const Size count = std::min(MAX_VECTORS, a_count - index);
+      for(Size i = 0; i < count; ++i) {
+        const Size skip = i == 0 ? offset : 0;
+        vectors[i].iov_base = static_cast<Byte*>(a_chunks[index + i].data) + skip;
+        vectors[i].iov_len = a_chunks[index + i].size - skip;
+      }
+
+      const ssize_t read = ::readv(m_descriptor, vectors, static_cast<int>(count));
+      if(read < 0 && errno == EINTR)
+        continue;
+      if(read <= 0) {
+        m_eof = true;
+        break;
+      }
+      advance(static_cast<Size>(read));
+    }
+    return total;
+  }
+
+  Size FileReader::Read(String& a_string, const Size a_count) {
+    return a_string.AppendWith(a_count, [this](char* a_data, const Size a_size) {
+      return Read(a_data, a_size);
+    });
+  }
+
+  Size FileReader::ReadAll(String& a_string) {
+    const Size hint = remaining();
+    a_string.Reserve(a_string.GetLength() + hint);
+
+    Size total = 0;
+    for(Size chunk = hint > 0 ? hint : m_capacity; ; chunk *= 2) {
+      const Size read = Read(a_string, chunk);
+      total += read;
+      if(read < chunk || IsEnd())
+        return total;
+    }
+  }
+
+  bool FileReader::ReadRecord(StringView& a_record, const char a_delimiter) {
+    Size scanned = 0;
+
+    while(true) {
+      const Byte* begin = m_buffer + m_begin;
+      const Size available = m_end - m_begin;
+
+      const void* found = std::memchr(begin + scanned, a_delimiter, available - scanned);
+      if(found != nullptr) {
+        const Size length = static_cast<Size>(static_cast<const Byte*>(found) - begin);
+        a_record = StringView{reinterpret_cast<const char*>(begin), length};
+        m_begin += length + 1;
+        return true;
+      }
+      scanned = available;
+
+      // a record filling the whole buffer needs a bigger one
+      if(available == m_capacity)
+        grow();
+
+      if(!fill()) {
+        if(m_begin == m_end)
+          return false;
+
+        // the last record doesn't need to end with a delimiter
+        a_record = StringView{reinterpret_cast<const char*>(m_buffer + m_begin), m_end - m_begin};
+        m_begin = m_end;
+        return true;
+      }
+    }
+  }
+
+  bool FileReader::ReadLine(StringView& a_line) {
+    if(!ReadRecord(a_line, '\n'))
+      return false;
+
+    if(!a_line.IsEmpty() && a_line[a_line.GetLength() - 1] == '\r')
+      a_line = a_line.Substr(0, a_line.GetLength() - 1);
+    return true;
+  }
+
+  FileReader::Records FileReader::GetRecords(const char a_delimiter) {
+    return {this, a_delimiter, false};
+  }
+
+  FileReader::Records FileReader::GetLines() {
+    return {this, '\n', true};
+  }
+
+  bool FileReader::IsOpen() const {
+    return m_descriptor >= 0;
+  }
+
+  bool FileReader::IsEnd() {
+    return m_begin == m_end && !fill();
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+  Size FileReader::readFile(void* a_data, const Size a_size) {
+    Byte* data = static_cast<Byte*>(a_data);
+    Size total = 0;
+
+    while(total < a_size && m_descriptor >= 0 && !m_eof) {
+      const ssize_t read = ::read(m_descriptor, data + total, a_size - total);
+      if(read < 0 && errno == EINTR)
+        continue;
+      if(read <= 0) {
+        m_eof = true;
+        break;
+      }
+      total += static_cast<Size>(read);
+    }
+    return total;
+  }
+
+  bool FileReader::fill() {
+    if(m_descriptor < 0 || m_eof)
+      return false;
+
+    if(m_begin > 0) {
+      std::memmove(m_buffer, m_buffer + m_begin, m_end - m_begin);
+      m_end -= m_begin;
+      m_begin = 0;
+    }
+    if(m_end == m_capacity)
+      return false;
+
+    while(true) {
+      const ssize_t read = ::read(m_descriptor, m_buffer + m_end, m_capacity - m_end);
+      if(read < 0 && errno == EINTR)
+        continue;
+      if(read <= 0) {
+        m_eof = true;
+        return false;
+      }
+      m_end += static_cast<Size>(read);
+      return true;
+    }
+  }
+
+  Size FileReader::drain(void* a_data, const Size a_size) {
+    const Size count = std::min(a_size, m_end - m_begin);
+    std::memcpy(a_data, m_buffer + m_begin, count);
+    m_begin += count;
+    return count;
+  }
+
+  void FileReader::grow() {
+    const Size capacity = m_capacity * 2;
+    auto* buffer = new Byte[capacity];
+    std::memcpy(buffer, m_buffer + m_begin, m_end - m_begin);
+
+    delete[] m_buffer;
+    m_buffer = buffer;
+    m_capacity = capacity;
+    m_end -= m_begin;
+    m_begin = 0;
+  }
+
+  Size FileReader::remaining() const {
+    struct stat status{};
+    if(m_descriptor < 0 || ::fstat(m_descriptor, &status) != 0 || !S_ISREG(status.st_mode))
+      return 0;
+
+    const off_t position = ::lseek(m_descriptor, 0, SEEK_CUR);
+    if(position < 0 || position > status.st_size)
+      return 0;
+    return static_cast<Size>(status.st_size - position) + (m_end - m_begin);
+  }
+}
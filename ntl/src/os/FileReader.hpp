@@ -0,0 +1,389 @@
+/**
+* @file FileReader.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_FILE_READER_HPP
+#define NTL_FILE_READER_HPP
+
+#include <iterator>
+
+#include "data/Array.hpp"
+#include "data/Byte.hpp"
+#include "data/Size.hpp"
+#include "data/String.hpp"
+#include "data/StringView.hpp"
+
+namespace ntl {
+  /**
+   * @brief Describes a block of memory to read into.
+   */
+  struct ReadChunk {
+    void* data;
+    Size size;
+  };
+
+  /**
+   * @brief Constructs a new buffered reader of a file.
+   *
+   * @details Small reads and record splitting are served from an internal buffer, while bigger reads go
+   * straight into the destination, so data is never copied twice. Records are returned as views into the
+   * buffer, which only grows to hold the longest record, so files of any size are streamed in constant memory.
+   */
+  class FileReader {
+  public:
+    /**
+     * @brief Iterator over the records of a reader, yielding views valid until the next increment.
+     */
+    class RecordIterator {
+    public:
+      using iterator_category = std::input_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = StringView;
+      using pointer = const StringView*;
+      using reference = const StringView&;
+
+    private:
+      FileReader* m_reader;
+      StringView m_record;
+      char m_delimiter;
+      bool m_lines;
+
+    public:
+      /**
+       * @brief Constructs a new iterator, reading the first record.
+       * @param a_reader the reader (nullptr for the end)
+       * @param a_delimiter the character separating the records
+       * @param a_lines if the records are lines (see ReadLine)
+       */
+      RecordIterator(FileReader* a_reader, char a_delimiter, bool a_lines);
+
+      /**
+       * @brief Overloading reference operator.
+       * @return the current record
+       */
+      reference operator*() const;
+
+      /**
+       * @brief Overloading pointer operator.
+       * @return the pointer to the current record
+       */
+      pointer operator->() const;
+
+      /**
+       * @brief Overloading increment operator, reading the next record.
+       * @return the reference to the iterator
+       */
+      RecordIterator& operator++();
+
+      /**
+       * @brief Overloading equals operator, which only compares whether both iterators reached the end.
+       */
+      friend bool operator==(const RecordIterator& a_first, const RecordIterator& a_second) {
+        return a_first.m_reader == a_second.m_reader;
+      }
+
+      /**
+       * @brief Overloading not-equals operator.
+       */
+      friend bool operator!=(const RecordIterator& a_first, const RecordIterator& a_second) {
+        return !(a_first == a_second);
+      }
+    };
+
+    /**
+     * @brief Range over the remaining records of a reader.
+     */
+    class Records {
+    private:
+      FileReader* m_reader;
+      char m_delimiter;
+      bool m_lines;
+
+    public:
+      Records(FileReader* a_reader, char a_delimiter, bool a_lines)
+        : m_reader(a_reader), m_delimiter(a_delimiter), m_lines(a_lines) {}
+
+      RecordIterator begin() const { return {m_reader, m_delimiter, m_lines}; }
+      RecordIterator end() const { return {nullptr, m_delimiter, m_lines}; }
+    };
+
+  private:
+    int m_descriptor;
+    Byte* m_buffer;
+    Size m_capacity,
+        m_begin,
+        m_end;
+    bool m_eof;
+
+  public:
+    /**
+     * @brief Default size of the internal buffer.
+     */
+    static constexpr Size DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+    /**
+     * @brief Constructs a new reader that isn't open yet.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_buffer_size the initial size of the internal buffer
+     */
+    explicit FileReader(Size a_buffer_size = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * @brief Constructs a new reader and opens the given file.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_path the path of the file
+     * @param a_buffer_size the initial size of the internal buffer
+     */
+    explicit FileReader(StringView a_path, Size a_buffer_size = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * @brief Destroys the reader, closing its file.
+     *
+     * @details Runtime: O(1)
+     */
+    ~FileReader();
+
+    FileReader(const FileReader&) = delete;
+    FileReader& operator=(const FileReader&) = delete;
+
+    /**
+     * @brief Moves the file and buffer of the other reader into the new one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the reader to move
+     */
+    FileReader(FileReader&& a_other) noexcept;
+
+    /**
+     * @brief Moves the file and buffer of the other reader into this one, closing the current file.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the reader to move
+     * @return the reference to this reader
+     */
+    FileReader& operator=(FileReader&& a_other) noexcept;
+
+    /**
+     * @brief Opens the given file for reading, closing the current one first.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_path the path of the file
+     * @return false if the file couldn't be opened, otherwise true
+     */
+    bool Open(StringView a_path);
+
+    /**
+     * @brief Closes the file, dropping buffered data.
+     *
+     * @details Runtime: O(1)
+     */
+    void Close();
+
+    /**
+     * @brief Reads up to the given number of bytes.
+     *
+     * @details Runtime: O(m), where m is the number of bytes.
+     * Only returns fewer bytes than requested at the end of the file or on an error.
+     *
+     * @param a_data the destination
+     * @param a_size the number of bytes to read
+     * @return the number of bytes read
+     */
+    Size Read(void* a_data, Size a_size);
+
+    /**
+     * @brief Reads into the given chunks in their order, using a single vectored read where possible.
+     *
+     * @details Runtime: O(m), where m is the total size of the chunks.
+     *
+     * @param a_chunks the chunks to fill
+     * @param a_count the number of chunks
+     * @return the number of bytes read in total
+     */
+    Size Read(const ReadChunk* a_chunks, Size a_count);
+
+    /**
+     * @brief Reads up to the given number of characters, appending them to the string.
+     *
+     * @details Runtime: O(m), where m is the number of characters.
+     *
+     * @param a_string the string to append to
+     * @param a_count the number of characters to read
+     * @return the number of characters read
+     */
+    Size Read(String& a_string, Size a_count);
+
+    /**
+     * @brief Reads up to the given number of bytes, appending them to the array.
+     *
+     * @details Runtime: O(m), where m is the number of bytes.
+     *
+     * @tparam Allocator the allocator of the array
+     * @param a_array the array to append to
+     * @param a_count the number of bytes to read
+     * @return the number of bytes read
+     */
+    template<typename Allocator>
+    Size Read(Array<Byte, Allocator>& a_array, Size a_count);
+
+    /**
+     * @brief Reads the rest of the file, appending it to the string.
+     *
+     * @details Runtime: O(m), where m is the number of remaining bytes (growing the string at most once for
+     * regular files).
+     *
+     * @param a_string the string to append to
+     * @return the number of characters read
+     */
+    Size ReadAll(String& a_string);
+
+    /**
+     * @brief Reads the rest of the file, appending it to the array.
+     *
+     * @details Runtime: O(m), where m is the number of remaining bytes.
+     *
+     * @tparam Allocator the allocator of the array
+     * @param a_array the array to append to
+     * @return the number of bytes read
+     */
+    template<typename Allocator>
+    Size ReadAll(Array<Byte, Allocator>& a_array);
+
+    /**
+     * @brief Reads the next record ending with the delimiter (or the end of the file).
+     *
+     * @details Runtime: O(m), where m is the length of the record.
+     *
+     * @param a_record receives the record without its delimiter (valid until the next read)
+     * @param a_delimiter the character separating the records
+     * @return false if there are no more records, otherwise true
+     */
+    bool ReadRecord(StringView& a_record, char a_delimiter);
+
+    /**
+     * @brief Reads the next line, dropping the line break ("\n" or "\r\n").
+     *
+     * @details Runtime: O(m), where m is the length of the line.
+     *
+     * @param a_line receives the line (valid until the next read)
+     * @return false if there are no more lines, otherwise true
+     */
+    bool ReadLine(StringView& a_line);
+
+    /**
+     * @brief Gets a range over the remaining records.
+     *
+     * @param a_delimiter the character separating the records
+     * @return the range of records
+     */
+    Records GetRecords(char a_delimiter);
+
+    /**
+     * @brief Gets a range over the remaining lines (see ReadLine).
+     *
+     * @return the range of lines
+     */
+    Records GetLines();
+
+    /**
+     * @brief Checks if a file is open.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if a file is open
+     */
+    [[nodiscard]] bool IsOpen() const;
+
+    /**
+     * @brief Checks if all bytes of the file have been consumed.
+     *
+     * @details Runtime: O(1) (may read the next block to find out)
+     *
+     * @return if the end of the file is reached
+     */
+    [[nodiscard]] bool IsEnd();
+
+  private:
+    /**
+     * @brief Reads directly from the file, retrying interrupted reads.
+     *
+     * @details Runtime: O(m), where m is the number of bytes.
+     *
+     * @param a_data the destination
+     * @param a_size the number of bytes to read
+     * @return the number of bytes read (fewer only at the end of the file or on an error)
+     */
+    Size readFile(void* a_data, Size a_size);
+
+    /**
+     * @brief Moves the buffered bytes to the front and reads as much as fits behind them.
+     *
+     * @details Runtime: O(b), where b is the size of the buffer.
+     *
+     * @return false if nothing could be read, otherwise true
+     */
+    bool fill();
+
+    /**
+     * @brief Moves up to the given number of buffered bytes into the destination.
+     *
+     * @details Runtime: O(m), where m is the number of bytes.
+     *
+     * @param a_data the destination
+     * @param a_size the maximum number of bytes
+     * @return the number of bytes moved
+     */
+    Size drain(void* a_data, Size a_size);
+
+    /**
+     * @brief Doubles the size of the internal buffer, keeping the buffered bytes.
+     *
+     * @details Runtime: O(b), where b is the size of the buffer.
+     */
+    void grow();
+
+    /**
+     * @brief Gets the number of bytes left in the file, including the buffered ones.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the number of remaining bytes (0 if unknown, e.g. for pipes)
+     */
+    Size remaining() const;
+  };
+
+  template<typename Allocator>
+  Size FileReader::Read(Array<Byte, Allocator>& a_array, const Size a_count) {
+    const Size size = a_array.GetSize();
+    a_array.Reserve(size + a_count);
+
+    // bytes are trivial, so they can be written through GetData and committed with Use
+    const Size read = Read(a_array.GetData() + size, a_count);
+    a_array.Use(size + read);
+    return read;
+  }
+
+  template<typename Allocator>
+  Size FileReader::ReadAll(Array<Byte, Allocator>& a_array) {
+    Size total = 0;
+    const Size hint = remaining();
+    for(Size chunk = hint > 0 ? hint : m_capacity; ; chunk *= 2) {
+      const Size read = Read(a_array, chunk);
+      total += read;
+      if(read < chunk || IsEnd())
+        return total;
+    }
+  }
+}
+
+#endif // NTL_FILE_READER_HPP
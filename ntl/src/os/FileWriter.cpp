@@ -0,0 +1,205 @@
+/**
+* @file FileWriter.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "FileWriter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "core/Assert.hpp"
+#include "data/String.hpp"
+
+namespace ntl {
+  namespace {
+    // upper bound of the chunks passed to a single vectored write (the minimum IOV_MAX of POSIX)
+    constexpr Size MAX_VECTORS = 16;
+  }
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  FileWriter::FileWriter(const Size a_buffer_size)
+    : m_descriptor{-1}, m_buffer{nullptr}, m_capacity{std::max<Size>(a_buffer_size, 1)}, m_used{0}, m_failed{false} {
+    m_buffer = new Byte[m_capacity];
+  }
+
+  FileWriter::FileWriter(const StringView a_path, const bool a_append, const Size a_buffer_size)
+    : FileWriter(a_buffer_size) {
+    Open(a_path, a_append);
+  }
+
+  FileWriter::~FileWriter() {
+    Close();
+    delete[] m_buffer;
+  }
+
+  FileWriter::FileWriter(FileWriter&& a_other) noexcept
+    : m_descriptor{std::exchange(a_other.m_descriptor, -1)}, m_buffer{std::exchange(a_other.m_buffer, nullptr)},
+      m_capacity{std::exchange(a_other.m_capacity, 0)}, m_used{std::exchange(a_other.m_used, 0)},
+      m_failed{std::exchange(a_other.m_failed, false)} {
+    // Empty
+  }
+
+  FileWriter& FileWriter::operator=(FileWriter&& a_other) noexcept {
+    if(this != &a_other) {
+      Close();
+      std::swap(m_buffer, a_other.m_buffer);
+      std::swap(m_capacity, a_other.m_capacity);
+      m_descriptor = std::exchange(a_other.m_descriptor, -1);
+      m_used = std::exchange(a_other.m_used, 0);
+      m_failed = std::exchange(a_other.m_failed, false);
+    }
+    return *this;
+  }
+
+  bool FileWriter::Open(const StringView a_path, const bool a_append) {
+    Close();
+    if(m_buffer == nullptr) {
+      m_capacity = DEFAULT_BUFFER_SIZE;
+      m_buffer = new Byte[m_capacity];
+    }
+
+    const String path{a_path};
+    m_descriptor = ::open(path.GetCString(), O_WRONLY | O_CREAT | (a_append ? O_APPEND : O_TRUNC), 0644);
+    return m_descriptor >= 0;
+  }
+
+  bool FileWriter::Close() {
+    if(m_descriptor < 0)
+      return true;
+
+    const bool success = Flush() && ::close(m_descriptor) == 0;
+    m_descriptor = -1;
+    m_used = 0;
+    m_failed = false;
+    return success;
+  }
+
+  bool FileWriter::Flush() {
+    if(m_used > 0) {
+      WriteChunk chunk{m_buffer, m_used};
+      writeFile(&chunk, 1);
+      m_used = 0;
+    }
+    return !m_failed;
+  }
+
+  bool FileWriter::Write(const void* a_data, const Size a_size) {
+    const WriteChunk chunk{a_data, a_size};
+    return Write(&chunk, 1);
+  }
+
+  bool FileWriter::Write(const WriteChunk* a_chunks, const Size a_count) {
+    Size total = 0;
+    for(Size i = 0; i < a_count; ++i)
+      total += a_chunks[i].size;
+
+    if(m_used + total <= m_capacity) {
+      for(Size i = 0; i < a_count; ++i) {
+        std::memcpy(m_buffer + m_used, a_chunks[i].data, a_chunks[i].size);
+        m_used += a_chunks[i].size;
+      }
+      return !m_failed;
+    }
+
+    // the buffered bytes lead the first vectored write, the chunks themselves are never copied
+    WriteChunk chunks[MAX_VECTORS];
+    Size count = 0;
+    if(m_used > 0)
+      chunks[count++] = {m_buffer, m_used};
+    m_used = 0;
+
+    for(Size i = 0; i < a_count; ++i) {
+      chunks[count++] = a_chunks[i];
+      if(count == MAX_VECTORS) {
+        writeFile(chunks, count);
+        count = 0;
+      }
+    }
+    if(count > 0)
+      writeFile(chunks, count);
+    return !m_failed;
+  }
+
+  bool FileWriter::Write(const StringView a_view) {
+    return Write(a_view.GetData(), a_view.GetLength());
+  }
+
+  bool FileWriter::Write(const char a_char) {
+    if(m_used == m_capacity)
+      Flush();
+    if(m_capacity == 0)
+      return Write(&a_char, 1);
+
+    m_buffer[m_used++] = static_cast<Byte>(a_char);
+    return !m_failed;
+  }
+
+  bool FileWriter::WriteLine(const StringView a_line) {
+    const WriteChunk chunks[] = {{a_line.GetData(), a_line.GetLength()}, {"\n", 1}};
+    return Write(chunks, 2);
+  }
+
+  bool FileWriter::IsOpen() const {
+    return m_descriptor >= 0;
+  }
+
+  Size FileWriter::GetBufferedSize() const {
+    return m_used;
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+  bool FileWriter::writeFile(WriteChunk* a_chunks, const Size a_count) {
+    Size index = 0;
+
+    while(true) {
+      while(index < a_count && a_chunks[index].size == 0)
+        ++index;
+      if(index == a_count)
+        return true;
+
+      if(m_descriptor < 0) {
+        m_failed = true;
+        return false;
+      }
+
+      iovec vectors[MAX_VECTORS];
+      const Size count = std::min(MAX_VECTORS, a_count - index);
+      for(Size i = 0; i < count; ++i) {
+        vectors[i].iov_base = const_cast<void*>(a_chunks[index + i].data);
+        vectors[i].iov_len = a_chunks[index + i].size;
+      }
+
+      const ssize_t written = ::writev(m_descriptor, vectors, static_cast<int>(count));
+      if(written < 0 && errno == EINTR)
+        continue;
+      if(written < 0) {
+        m_failed = true;
+        return false;
+      }
+
+      // drop the completely written chunks and advance into a partially written one
+      Size rest = static_cast<Size>(written);
+      while(rest > 0 && rest >= a_chunks[index].size) {
+        rest -= a_chunks[index].size;
+        ++index;
+      }
+      if(rest > 0) {
+        a_chunks[index].data = static_cast<const Byte*>(a_chunks[index].data) + rest;
+        a_chunks[index].size -= rest;
+      }
+    }
+  }
+}
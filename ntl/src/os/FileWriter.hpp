@@ -0,0 +1,224 @@
+/**
+* @file FileWriter.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_FILE_WRITER_HPP
+#define NTL_FILE_WRITER_HPP
+
+#include "data/Array.hpp"
+#include "data/Byte.hpp"
+#include "data/Size.hpp"
+#include "data/StringView.hpp"
+
+namespace ntl {
+  /**
+   * @brief Describes a block of memory to write.
+   */
+  struct WriteChunk {
+    const void* data;
+    Size size;
+  };
+
+  /**
+   * @brief Constructs a new buffered writer of a file.
+   *
+   * @details Small writes are collected in an internal buffer. Writes that don't fit into it are passed to
+   * the file together with the buffered bytes in a single vectored write, so they're never copied.
+   */
+  class FileWriter {
+  private:
+    int m_descriptor;
+    Byte* m_buffer;
+    Size m_capacity,
+        m_used;
+    bool m_failed;
+
+  public:
+    /**
+     * @brief Default size of the internal buffer.
+     */
+    static constexpr Size DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+    /**
+     * @brief Constructs a new writer that isn't open yet.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_buffer_size the size of the internal buffer
+     */
+    explicit FileWriter(Size a_buffer_size = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * @brief Constructs a new writer and opens the given file.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_path the path of the file
+     * @param a_append if the file should be appended to instead of truncated
+     * @param a_buffer_size the size of the internal buffer
+     */
+    explicit FileWriter(StringView a_path, bool a_append = false, Size a_buffer_size = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * @brief Destroys the writer, flushing and closing its file.
+     *
+     * @details Runtime: O(b), where b is the number of buffered bytes.
+     */
+    ~FileWriter();
+
+    FileWriter(const FileWriter&) = delete;
+    FileWriter& operator=(const FileWriter&) = delete;
+
+    /**
+     * @brief Moves the file and buffer of the other writer into the new one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the writer to move
+     */
+    FileWriter(FileWriter&& a_other) noexcept;
+
+    /**
+     * @brief Moves the file and buffer of the other writer into this one, closing the current file.
+     *
+     * @details Runtime: O(b), where b is the number of bytes buffered for the current file.
+     *
+     * @param a_other the writer to move
+     * @return the reference to this writer
+     */
+    FileWriter& operator=(FileWriter&& a_other) noexcept;
+
+    /**
+     * @brief Opens the given file for writing, closing the current one first.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_path the path of the file (created if it doesn't exist)
+     * @param a_append if the file should be appended to instead of truncated
+     * @return false if the file couldn't be opened, otherwise true
+     */
+    bool Open(StringView a_path, bool a_append = false);
+
+    /**
+     * @brief Flushes and closes the file.
+     *
+     * @details Runtime: O(b), where b is the number of buffered bytes.
+     *
+     * @return false if any write failed since opening, otherwise true
+     */
+    bool Close();
+
+    /**
+     * @brief Writes the buffered bytes to the file.
+     *
+     * @details Runtime: O(b), where b is the number of buffered bytes.
+     *
+     * @return false if any write failed since opening, otherwise true
+     */
+    bool Flush();
+
+    /**
+     * @brief Writes the given bytes.
+     *
+     * @details Runtime: O(m), where m is the number of bytes.
+     *
+     * @param a_data the first byte
+     * @param a_size the number of bytes
+     * @return false if any write failed since opening, otherwise true
+     */
+    bool Write(const void* a_data, Size a_size);
+
+    /**
+     * @brief Writes the given chunks in their order, using a single vectored write where possible.
+     *
+     * @details Runtime: O(m), where m is the total size of the chunks.
+     *
+     * @param a_chunks the chunks to write
+     * @param a_count the number of chunks
+     * @return false if any write failed since opening, otherwise true
+     */
+    bool Write(const WriteChunk* a_chunks, Size a_count);
+
+    /**
+     * @brief Writes the characters of the given view (strings convert implicitly).
+     *
+     * @details Runtime: O(m), where m is the length of the view.
+     *
+     * @param a_view the characters to write
+     * @return false if any write failed since opening, otherwise true
+     */
+    bool Write(StringView a_view);
+
+    /**
+     * @brief Writes the given character.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_char the character to write
+     * @return false if any write failed since opening, otherwise true
+     */
+    bool Write(char a_char);
+
+    /**
+     * @brief Writes the given bytes.
+     *
+     * @details Runtime: O(m), where m is the size of the array.
+     *
+     * @tparam Allocator the allocator of the array
+     * @param a_array the bytes to write
+     * @return false if any write failed since opening, otherwise true
+     */
+    template<typename Allocator>
+    bool Write(const Array<Byte, Allocator>& a_array);
+
+    /**
+     * @brief Writes the characters of the given view followed by a line break.
+     *
+     * @details Runtime: O(m), where m is the length of the view.
+     *
+     * @param a_line the line to write
+     * @return false if any write failed since opening, otherwise true
+     */
+    bool WriteLine(StringView a_line);
+
+    /**
+     * @brief Checks if a file is open.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if a file is open
+     */
+    [[nodiscard]] bool IsOpen() const;
+
+    /**
+     * @brief Gets the number of bytes waiting in the internal buffer.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the number of buffered bytes
+     */
+    [[nodiscard]] Size GetBufferedSize() const;
+
+  private:
+    /**
+     * @brief Writes all given chunks to the file, retrying partial and interrupted writes.
+     *
+     * @details Runtime: O(m), where m is the total size of the chunks.
+     *
+     * @param a_chunks the chunks to write (modified while writing)
+     * @param a_count the number of chunks
+     * @return false if a write failed, otherwise true
+     */
+    bool writeFile(WriteChunk* a_chunks, Size a_count);
+  };
+
+  template<typename Allocator>
+  bool FileWriter::Write(const Array<Byte, Allocator>& a_array) {
+    return Write(a_array.GetData(), a_array.GetSize());
+  }
+}
+
+#endif // NTL_FILE_WRITER_HPP
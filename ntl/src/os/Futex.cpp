@@ -0,0 +1,80 @@
+/**
+* @file Futex.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Futex.hpp"
+
+#include <climits>
+
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+
+#ifdef NTL_PLATFORM_LINUX
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#else
+  #include <thread>
+#endif
+
+namespace ntl {
+  namespace futex {
+    CVERIFY(sizeof(Atomic<U32>) == sizeof(U32) && "the futex word has to be the atomic itself")
+
+#ifdef NTL_PLATFORM_LINUX
+    namespace {
+      long futex(Atomic<U32>& a_word, const int a_operation, const U32 a_value,
+                 const timespec* a_timeout = nullptr, const U32 a_bitset = 0) {
+        return syscall(SYS_futex, reinterpret_cast<U32*>(&a_word), a_operation, a_value, a_timeout, nullptr, a_bitset);
+      }
+    }
+
+    void Wait(Atomic<U32>& a_word, const U32 a_expected) {
+      futex(a_word, FUTEX_WAIT_PRIVATE, a_expected);
+    }
+
+    bool WaitUntil(Atomic<U32>& a_word, const U32 a_expected, const time::Clock::time_point a_deadline) {
+      // the absolute timeout of FUTEX_WAIT_BITSET uses CLOCK_MONOTONIC, the clock of steady_clock
+      const timespec deadline = time::ToTimespec(a_deadline);
+      futex(a_word, FUTEX_WAIT_BITSET_PRIVATE, a_expected, &deadline, FUTEX_BITSET_MATCH_ANY);
+      return time::Clock::now() < a_deadline;
+    }
+
+    void Wake(Atomic<U32>& a_word, const U32 a_count) {
+      futex(a_word, FUTEX_WAKE_PRIVATE, a_count);
+    }
+
+    void WakeAll(Atomic<U32>& a_word) {
+      futex(a_word, FUTEX_WAKE_PRIVATE, INT_MAX);
+    }
+#else
+    void Wait(Atomic<U32>& a_word, const U32 a_expected) {
+      a_word.Wait(a_expected);
+    }
+
+    bool WaitUntil(Atomic<U32>& a_word, const U32 a_expected, const time::Clock::time_point a_deadline) {
+      // without a timed wait of the platform, poll with short naps (the wakes then are no-ops)
+      while(a_word.Load() == a_expected) {
+        if(time::Clock::now() >= a_deadline)
+          return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+      }
+      return true;
+    }
+
+    void Wake(Atomic<U32>& a_word, const U32 a_count) {
+      if(a_count == 1)
+        a_word.NotifyOne();
+      else
+        a_word.NotifyAll();
+    }
+
+    void WakeAll(Atomic<U32>& a_word) {
+      a_word.NotifyAll();
+    }
+#endif
+  }
+}
@@ -0,0 +1,57 @@
+/**
+* @file Futex.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_FUTEX_HPP
+#define NTL_FUTEX_HPP
+
+#include "data/Integer.hpp"
+#include "os/Atomic.hpp"
+#include "os/Time.hpp"
+
+namespace ntl {
+  namespace futex {
+    /**
+     * @brief Sleeps as long as the given word holds the expected value.
+     *
+     * @details The comparison and going to sleep happen atomically, so a change (followed by a wake)
+     * between a check of the caller and this call isn't lost. May return spuriously.
+     *
+     * @param a_word the word to sleep on
+     * @param a_expected the value to sleep on
+     */
+    void Wait(Atomic<U32>& a_word, U32 a_expected);
+
+    /**
+     * @brief Sleeps as long as the given word holds the expected value, but not beyond the deadline.
+     *
+     * @details May return spuriously, just like Wait.
+     *
+     * @param a_word the word to sleep on
+     * @param a_expected the value to sleep on
+     * @param a_deadline the point in time to stop sleeping at
+     * @return false if the deadline passed, otherwise true
+     */
+    bool WaitUntil(Atomic<U32>& a_word, U32 a_expected, time::Clock::time_point a_deadline);
+
+    /**
+     * @brief Wakes up to the given number of threads sleeping on the word.
+     *
+     * @param a_word the word
+     * @param a_count the maximum number of threads to wake
+     */
+    void Wake(Atomic<U32>& a_word, U32 a_count);
+
+    /**
+     * @brief Wakes all threads sleeping on the word.
+     *
+     * @param a_word the word
+     */
+    void WakeAll(Atomic<U32>& a_word);
+  }
+}
+
+#endif // NTL_FUTEX_HPP
@@ -0,0 +1,72 @@
+/**
+* @file Latch.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Latch.hpp"
+
+#include "core/Assert.hpp"
+#include "os/Futex.hpp"
+
+namespace ntl {
+  namespace {
+    using Order = Atomic<U32>::MemoryOrder;
+
+    constexpr U32 SLEEPING = 1u << 31;
+    constexpr U32 COUNT = SLEEPING - 1;
+  }
+
+  Latch::Latch(const U32 a_count) : m_count{a_count} {
+    VERIFY(a_count <= COUNT)
+  }
+
+  void Latch::CountDown(const U32 a_count) {
+    const U32 count = m_count.FetchSub(a_count, Order::AcquireRelease);
+    VERIFY((count & COUNT) >= a_count && "the latch was counted down too often")
+
+    if((count & COUNT) == a_count && (count & SLEEPING) != 0)
+      futex::WakeAll(m_count);
+  }
+
+  void Latch::Wait() const {
+    U32 count = m_count.Load(Order::Acquire);
+    while((count & COUNT) != 0) {
+      // a failed exchange reloads the counter
+      if((count & SLEEPING) == 0 &&
+         !m_count.CompareExchangeWeak(count, count | SLEEPING, Order::Acquire, Order::Acquire))
+        continue;
+
+      futex::Wait(m_count, count | SLEEPING);
+      count = m_count.Load(Order::Acquire);
+    }
+  }
+
+  bool Latch::TryWait() const {
+    return (m_count.Load(Order::Acquire) & COUNT) == 0;
+  }
+
+  bool Latch::WaitFor(const std::chrono::nanoseconds a_timeout) const {
+    return WaitUntil(time::Deadline(a_timeout));
+  }
+
+  bool Latch::WaitUntil(const time::Clock::time_point a_deadline) const {
+    U32 count = m_count.Load(Order::Acquire);
+    while((count & COUNT) != 0) {
+      if((count & SLEEPING) == 0 &&
+         !m_count.CompareExchangeWeak(count, count | SLEEPING, Order::Acquire, Order::Acquire))
+        continue;
+
+      if(!futex::WaitUntil(m_count, count | SLEEPING, a_deadline))
+        return TryWait();
+      count = m_count.Load(Order::Acquire);
+    }
+    return true;
+  }
+
+  void Latch::ArriveAndWait() {
+    CountDown();
+    Wait();
+  }
+}
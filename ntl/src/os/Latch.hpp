@@ -0,0 +1,96 @@
+/**
+* @file Latch.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_LATCH_HPP
+#define NTL_LATCH_HPP
+
+#include <chrono>
+
+#include "data/Integer.hpp"
+#include "os/Atomic.hpp"
+#include "os/Time.hpp"
+
+namespace ntl {
+  /**
+   * @brief A single-use countdown that releases all waiting threads once it reaches 0.
+   *
+   * @details The counter is a futex word whose highest bit marks sleeping threads, so the kernel is
+   * only entered to sleep or if somebody sleeps when the counter reaches 0. Releasing the waiters
+   * doesn't touch the latch after the counter reached 0, so a waiter may destroy it right away.
+   */
+  class Latch {
+  private:
+    // waiting doesn't change the latch, but marks the counter and sleeps on it
+    mutable Atomic<U32> m_count;
+
+  public:
+    /**
+     * @brief Constructs a new latch.
+     *
+     * @param a_count the number of count downs to wait for (less than 2^31)
+     */
+    explicit Latch(U32 a_count);
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another latch
+     */
+    Latch(const Latch& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another latch
+     *
+     * @return the reference to the latch
+     */
+    Latch& operator=(const Latch& a_other) = delete;
+
+    /**
+     * @brief Decrements the counter, releasing all waiting threads if it reaches 0.
+     *
+     * @param a_count the value to subtract (at most the remaining count)
+     */
+    void CountDown(U32 a_count = 1);
+
+    /**
+     * @brief Blocks the calling thread until the counter reaches 0.
+     */
+    void Wait() const;
+
+    /**
+     * @brief Checks if the counter reached 0.
+     *
+     * @return if the counter reached 0
+     */
+    [[nodiscard]] bool TryWait() const;
+
+    /**
+     * @brief Blocks the calling thread until the counter reaches 0, but for at most the given duration.
+     *
+     * @param a_timeout the maximum duration to wait
+     * @return if the counter reached 0
+     */
+    bool WaitFor(std::chrono::nanoseconds a_timeout) const;
+
+    /**
+     * @brief Blocks the calling thread until the counter reaches 0, but until the given point in time at most.
+     *
+     * @param a_deadline the point in time to stop waiting at
+     * @return if the counter reached 0
+     */
+    bool WaitUntil(time::Clock::time_point a_deadline) const;
+
+    /**
+     * @brief Decrements the counter and blocks the calling thread until it reaches 0.
+     */
+    void ArriveAndWait();
+  };
+}
+
+#endif // NTL_LATCH_HPP
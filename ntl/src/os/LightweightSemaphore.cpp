@@ -0,0 +1,84 @@
+/**
+* @file LightweightSemaphore.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "LightweightSemaphore.hpp"
+
+#include "core/Platform.hpp"
+#include "os/Futex.hpp"
+
+namespace ntl {
+  namespace {
+    using Order = Atomic<U32>::MemoryOrder;
+
+    constexpr U32 SPIN_COUNT = 64;
+  }
+
+  LightweightSemaphore::LightweightSemaphore(const U32 a_value) : m_value{a_value}, m_waiting{0} {
+    // Empty
+  }
+
+  void LightweightSemaphore::Wait() {
+    if(spin())
+      return;
+
+    // registering before the last check pairs with Post adding before it checks for waiters
+    m_waiting.FetchAdd(1);
+    while(!TryWait())
+      futex::Wait(m_value, 0);
+    m_waiting.FetchSub(1, Order::Relaxed);
+  }
+
+  bool LightweightSemaphore::TryWait() {
+    U32 value = m_value.Load();
+    while(value > 0) {
+      if(m_value.CompareExchangeWeak(value, value - 1, Order::Acquire, Order::Relaxed))
+        return true;
+    }
+    return false;
+  }
+
+  bool LightweightSemaphore::WaitFor(const std::chrono::nanoseconds a_timeout) {
+    return WaitUntil(time::Deadline(a_timeout));
+  }
+
+  bool LightweightSemaphore::WaitUntil(const time::Clock::time_point a_deadline) {
+    if(spin())
+      return true;
+
+    m_waiting.FetchAdd(1);
+    bool acquired = TryWait();
+    while(!acquired && futex::WaitUntil(m_value, 0, a_deadline))
+      acquired = TryWait();
+    m_waiting.FetchSub(1, Order::Relaxed);
+
+    // a value posted right at the deadline still counts
+    return acquired || TryWait();
+  }
+
+  void LightweightSemaphore::Post(const U32 a_count) {
+    m_value.FetchAdd(a_count);
+    if(m_waiting.Load() > 0)
+      futex::Wake(m_value, a_count);
+  }
+
+  U32 LightweightSemaphore::GetValue() const {
+    return m_value.Load(Order::Relaxed);
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  bool LightweightSemaphore::spin() {
+    for(U32 i = 0; i < SPIN_COUNT; ++i) {
+      if(TryWait())
+        return true;
+      NTL_PAUSE();
+    }
+    return false;
+  }
+}
@@ -0,0 +1,108 @@
+/**
+* @file LightweightSemaphore.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_LIGHTWEIGHT_SEMAPHORE_HPP
+#define NTL_LIGHTWEIGHT_SEMAPHORE_HPP
+
+#include <chrono>
+
+#include "data/Integer.hpp"
+#include "os/Atomic.hpp"
+#include "os/Time.hpp"
+
+namespace ntl {
+  /**
+   * @brief A counting semaphore within a process that only enters the kernel to sleep or to wake a sleeper.
+   *
+   * @details The value is a futex word and the number of sleeping threads is tracked next to it, so
+   * Post is a single atomic addition (and a load) as long as nobody waits. Waiting threads first spin
+   * for a few rounds, as the value is often posted right after.
+   *
+   * @note Unlike Semaphore, it can't be shared across processes.
+   */
+  class LightweightSemaphore {
+  private:
+    Atomic<U32> m_value;
+    Atomic<U32> m_waiting;
+
+  public:
+    /**
+     * @brief Constructs a new semaphore instance.
+     *
+     * @param a_value the initial value of the semaphore
+     */
+    explicit LightweightSemaphore(U32 a_value = 0);
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another semaphore
+     */
+    LightweightSemaphore(const LightweightSemaphore& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another semaphore
+     *
+     * @return the reference to the semaphore
+     */
+    LightweightSemaphore& operator=(const LightweightSemaphore& a_other) = delete;
+
+    /**
+     * @brief Decrements the semaphore, blocking the calling thread while its value is 0.
+     */
+    void Wait();
+
+    /**
+     * @brief Decrements the semaphore, if its value is greater than 0.
+     *
+     * @return Returns true if the semaphore was decremented, otherwise returns false.
+     */
+    bool TryWait();
+
+    /**
+     * @brief Decrements the semaphore, blocking the calling thread for at most the given duration.
+     *
+     * @param a_timeout the maximum duration to wait
+     * @return Returns true if the semaphore was decremented, otherwise returns false.
+     */
+    bool WaitFor(std::chrono::nanoseconds a_timeout);
+
+    /**
+     * @brief Decrements the semaphore, blocking the calling thread until the given point in time at most.
+     *
+     * @param a_deadline the point in time to stop waiting at
+     * @return Returns true if the semaphore was decremented, otherwise returns false.
+     */
+    bool WaitUntil(time::Clock::time_point a_deadline);
+
+    /**
+     * @brief Increments the semaphore, waking as many sleeping threads as possible.
+     *
+     * @param a_count the value to add
+     */
+    void Post(U32 a_count = 1);
+
+    /**
+     * @brief Gets the value of the semaphore.
+     *
+     * @return the value of the semaphore
+     */
+    [[nodiscard]] U32 GetValue() const;
+
+  private:
+    /**
+     * @brief Spins for a few rounds, trying to decrement the semaphore.
+     *
+     * @return if the semaphore was decremented
+     */
+    bool spin();
+  };
+}
+
+#endif // NTL_LIGHTWEIGHT_SEMAPHORE_HPP
@@ -7,6 +7,8 @@
 
 #include "Lock.hpp"
 
+#include "utils/Profile.hpp"
+
 namespace ntl {
   Lock::Lock() : m_mutex() {
     pthread_mutex_init(&m_mutex, nullptr);
@@ -17,11 +19,16 @@ namespace ntl {
   }
 
   void Lock::Acquire() {
+#if NTL_PROFILE
+    profile::TimedAcquire(profile::LockKind::LOCK, [this] { return pthread_mutex_trylock(&m_mutex) == 0; },
+                          [this] { pthread_mutex_lock(&m_mutex); });
+#else
     pthread_mutex_lock(&m_mutex);
+#endif
   }
 
   bool Lock::TryAcquire() {
-    return pthread_mutex_trylock(&m_mutex);
+    return pthread_mutex_trylock(&m_mutex) == 0;
   }
 
   void Lock::Release() {
@@ -0,0 +1,99 @@
+/**
+* @file MappedFile.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "MappedFile.hpp"
+
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "core/Platform.hpp"
+#include "data/String.hpp"
+
+namespace ntl {
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+  MappedFile::MappedFile()
+    : m_data{nullptr}, m_size{0} {
+    // Empty
+  }
+
+  MappedFile::~MappedFile() {
+    Close();
+  }
+
+  MappedFile::MappedFile(MappedFile&& a_other) noexcept
+    : m_data{std::exchange(a_other.m_data, nullptr)}, m_size{std::exchange(a_other.m_size, 0)} {
+    // Empty
+  }
+
+  MappedFile& MappedFile::operator=(MappedFile&& a_other) noexcept {
+    if(this != &a_other) {
+      Close();
+      m_data = std::exchange(a_other.m_data, nullptr);
+      m_size = std::exchange(a_other.m_size, 0);
+    }
+    return *this;
+  }
+
+  bool MappedFile::Open(const StringView a_path, const bool a_populate) {
+    Close();
+
+    const String path{a_path};
+    const int descriptor = ::open(path.GetCString(), O_RDONLY);
+    if(descriptor < 0)
+      return false;
+
+    struct stat status{};
+    if(::fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+      ::close(descriptor);
+      return false;
+    }
+
+    int flags = MAP_SHARED;
+#ifdef NTL_PLATFORM_LINUX
+    if(a_populate)
+      flags |= MAP_POPULATE;
+#endif
+    void* data = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, flags, descriptor, 0);
+    // the mapping keeps its own reference to the file
+    ::close(descriptor);
+    if(data == MAP_FAILED)
+      return false;
+
+#ifndef NTL_PLATFORM_LINUX
+    if(a_populate)
+      ::madvise(data, static_cast<size_t>(status.st_size), MADV_WILLNEED);
+#endif
+    m_data = static_cast<const Byte*>(data);
+    m_size = static_cast<Size>(status.st_size);
+    return true;
+  }
+
+  void MappedFile::Close() {
+    if(m_data != nullptr)
+      ::munmap(const_cast<Byte*>(m_data), m_size);
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  bool MappedFile::IsOpen() const {
+    return m_data != nullptr;
+  }
+
+  const Byte* MappedFile::GetData() const {
+    return m_data;
+  }
+
+  Size MappedFile::GetSize() const {
+    return m_size;
+  }
+}
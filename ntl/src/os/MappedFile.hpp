@@ -0,0 +1,111 @@
+/**
+* @file MappedFile.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_MAPPED_FILE_HPP
+#define NTL_MAPPED_FILE_HPP
+
+#include "data/Byte.hpp"
+#include "data/Size.hpp"
+#include "data/StringView.hpp"
+
+namespace ntl {
+  /**
+   * @brief Constructs a new read-only memory mapping of a file.
+   *
+   * @details The file is mapped shared, so it is paged in lazily on first access and the pages are
+   * shared with every other process mapping the same file. The mapping is released on destruction.
+   */
+  class MappedFile {
+  private:
+    const Byte* m_data;
+    Size m_size;
+
+  public:
+    /**
+     * @brief Constructs a new mapping that isn't open yet.
+     *
+     * @details Runtime: O(1)
+     */
+    MappedFile();
+
+    /**
+     * @brief Destroys the mapping, unmapping the file if it is open.
+     *
+     * @details Runtime: O(1)
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Moves the mapping of the other object into the new one.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the mapping to move
+     */
+    MappedFile(MappedFile&& a_other) noexcept;
+
+    /**
+     * @brief Moves the mapping of the other object into this one, unmapping the current file.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the mapping to move
+     * @return the reference to this mapping
+     */
+    MappedFile& operator=(MappedFile&& a_other) noexcept;
+
+    /**
+     * @brief Maps the given file read-only, unmapping the current file first.
+     *
+     * @details Runtime: O(1) (the pages are faulted in on first access unless populated)
+     *
+     * @param a_path the path of the file
+     * @param a_populate if all pages should be read ahead right away
+     * @return false if the file couldn't be opened or mapped, otherwise true
+     */
+    bool Open(StringView a_path, bool a_populate = false);
+
+    /**
+     * @brief Unmaps the file.
+     *
+     * @details Runtime: O(1)
+     */
+    void Close();
+
+    /**
+     * @brief Checks if a file is mapped.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return if a file is mapped
+     */
+    [[nodiscard]] bool IsOpen() const;
+
+    /**
+     * @brief Gets the first byte of the mapped file.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the first byte (nullptr if no file is mapped)
+     */
+    [[nodiscard]] const Byte* GetData() const;
+
+    /**
+     * @brief Gets the size of the mapped file in bytes.
+     *
+     * @details Runtime: O(1)
+     *
+     * @return the size of the file
+     */
+    [[nodiscard]] Size GetSize() const;
+  };
+}
+
+#endif // NTL_MAPPED_FILE_HPP
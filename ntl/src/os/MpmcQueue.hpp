@@ -0,0 +1,345 @@
+/**
+* @file MpmcQueue.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_MPMC_QUEUE_HPP
+#define NTL_MPMC_QUEUE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+
+#include "core/Platform.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "os/Atomic.hpp"
+#include "os/Parking.hpp"
+
+namespace ntl {
+  /**
+   * @brief A bounded lock-free queue passing elements between any number of producer and consumer threads.
+   *
+   * @details Implements the queue of Dmitry Vyukov: every slot of the power-of-two ring buffer carries a
+   * sequence number telling which lap of the producers (or consumers) may use it next. Producers claim a
+   * slot by advancing the tail with a compare-exchange once its sequence matches, construct the element
+   * and publish it through the sequence. Consumers do the same with the head. Head and tail each have a
+   * cache line of their own, so producers and consumers don't invalidate each other.
+   *
+   * The Try* operations never block and don't wake sleeping threads, so they only cost a few loads
+   * and stores (plus a compare-exchange). Put and Get sleep while the queue is full (or empty) and wake the threads
+   * sleeping in the opposite operation, which costs a fence. So a side may only sleep if the other
+   * side uses the blocking operations as well.
+   *
+   * @tparam T the type of the elements to pass
+   */
+  template <typename T>
+  class MpmcQueue {
+  private:
+    using Order = typename Atomic<Size>::MemoryOrder;
+
+    /**
+     * @brief A slot of the ring buffer.
+     */
+    struct Cell {
+      Atomic<Size> sequence;
+      union {
+        T value;
+      };
+
+      Cell() {}
+      ~Cell() {}
+    };
+
+    alignas(NTL_CACHE_LINE_SIZE) Atomic<Size> m_tail;
+    alignas(NTL_CACHE_LINE_SIZE) Atomic<Size> m_head;
+    alignas(NTL_CACHE_LINE_SIZE) Cell* m_cells;
+    Size m_capacity;
+
+    Parking m_not_full;
+    Parking m_not_empty;
+
+  public:
+    /**
+     * @brief Constructs a new queue with the given capacity.
+     *
+     * @param a_capacity the maximum number of elements (rounded up to the next power of two, at least 2)
+     */
+    explicit MpmcQueue(Size a_capacity = 1024);
+
+    /**
+     * @brief Destroys the remaining elements of the queue.
+     */
+    ~MpmcQueue();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another queue
+     */
+    MpmcQueue(const MpmcQueue& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another queue
+     *
+     * @return the reference to the queue
+     */
+    MpmcQueue& operator=(const MpmcQueue& a_other) = delete;
+
+    /**
+     * @brief Constructs a new element at the end of the queue, if it isn't full.
+     *
+     * @details Runtime: O(1) (lock-free)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     * @return if the element was added
+     */
+    template <typename... Args>
+    bool TryEmplace(Args&&... a_args);
+
+    /**
+     * @brief Puts an element at the end of the queue, if it isn't full.
+     *
+     * @details Runtime: O(1) (lock-free)
+     *
+     * @param a_element the element to add (only moved from if it was added)
+     * @return if the element was added
+     */
+    bool TryPut(T&& a_element);
+
+    /**
+     * @brief Puts a copy of the element at the end of the queue, if it isn't full.
+     *
+     * @details Runtime: O(1) (lock-free)
+     *
+     * @param a_element the element to add
+     * @return if the element was added
+     */
+    bool TryPut(const T& a_element);
+
+    /**
+     * @brief Removes the oldest element from the queue, if it isn't empty.
+     *
+     * @details Runtime: O(1) (lock-free)
+     *
+     * @param a_element receives the removed element
+     * @return if an element was removed
+     */
+    bool TryGet(T& a_element);
+
+    /**
+     * @brief Puts an element at the end of the queue, sleeping while it is full.
+     *
+     * @param a_element the element to add
+     */
+    void Put(T a_element);
+
+    /**
+     * @brief Removes the oldest element from the queue, sleeping while it is empty.
+     *
+     * @return the removed element
+     */
+    T Get();
+
+    /**
+     * @brief Gets the number of elements in the queue (only exact if no thread is active).
+     *
+     * @return the size of the queue
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the maximum number of elements in the queue.
+     *
+     * @return the capacity of the queue
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Checks if the queue is empty (only exact if no thread is active).
+     *
+     * @return if the queue is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+  private:
+    /**
+     * @brief Claims the next free slot at the end of the queue.
+     *
+     * @return the slot to construct the element in (nullptr if the queue is full)
+     */
+    Cell* claimBack();
+
+    /**
+     * @brief Claims the oldest element of the queue.
+     *
+     * @return the slot of the element (nullptr if the queue is empty)
+     */
+    Cell* claimFront();
+
+    /**
+     * @brief Publishes the element constructed in a slot returned by claimBack.
+     *
+     * @param a_cell the slot
+     */
+    void push(Cell* a_cell);
+
+    /**
+     * @brief Destroys the element of a slot returned by claimFront and frees the slot.
+     *
+     * @param a_cell the slot
+     */
+    void pop(Cell* a_cell);
+  };
+
+  template <typename T>
+  MpmcQueue<T>::MpmcQueue(const Size a_capacity)
+    : m_tail{0}, m_head{0}, m_capacity{std::bit_ceil(std::max(a_capacity, Size{2}))} {
+    m_cells = new Cell[m_capacity];
+    for(Size i = 0; i < m_capacity; ++i)
+      m_cells[i].sequence.Store(i, Order::Relaxed);
+  }
+
+  template <typename T>
+  MpmcQueue<T>::~MpmcQueue() {
+    const Size tail = m_tail.Load(Order::Relaxed);
+    for(Size i = m_head.Load(Order::Relaxed); i != tail; ++i)
+      std::destroy_at(&m_cells[i & (m_capacity - 1)].value);
+    delete[] m_cells;
+  }
+
+  template <typename T>
+  template <typename... Args>
+  bool MpmcQueue<T>::TryEmplace(Args&&... a_args) {
+    Cell* cell = claimBack();
+    if(!cell)
+      return false;
+
+    std::construct_at(&cell->value, std::forward<Args>(a_args)...);
+    push(cell);
+    return true;
+  }
+
+  template <typename T>
+  bool MpmcQueue<T>::TryPut(T&& a_element) {
+    return TryEmplace(std::move(a_element));
+  }
+
+  template <typename T>
+  bool MpmcQueue<T>::TryPut(const T& a_element) {
+    return TryEmplace(a_element);
+  }
+
+  template <typename T>
+  bool MpmcQueue<T>::TryGet(T& a_element) {
+    Cell* cell = claimFront();
+    if(!cell)
+      return false;
+
+    a_element = std::move(cell->value);
+    pop(cell);
+    return true;
+  }
+
+  template <typename T>
+  void MpmcQueue<T>::Put(T a_element) {
+    Cell* cell = claimBack();
+    if(!cell)
+      m_not_full.Wait([&] { return (cell = claimBack()) != nullptr; });
+
+    std::construct_at(&cell->value, std::move(a_element));
+    push(cell);
+    m_not_empty.Notify();
+  }
+
+  template <typename T>
+  T MpmcQueue<T>::Get() {
+    Cell* cell = claimFront();
+    if(!cell)
+      m_not_empty.Wait([&] { return (cell = claimFront()) != nullptr; });
+
+    T element = std::move(cell->value);
+    pop(cell);
+    m_not_full.Notify();
+    return element;
+  }
+
+  template <typename T>
+  Size MpmcQueue<T>::GetSize() const {
+    const Size head = m_head.Load(Order::Acquire);
+    const Size tail = m_tail.Load(Order::Acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  template <typename T>
+  Size MpmcQueue<T>::GetCapacity() const {
+    return m_capacity;
+  }
+
+  template <typename T>
+  bool MpmcQueue<T>::IsEmpty() const {
+    return GetSize() == 0;
+  }
+
+  template <typename T>
+  typename MpmcQueue<T>::Cell* MpmcQueue<T>::claimBack() {
+    Size tail = m_tail.Load(Order::Relaxed);
+    while(true) {
+      Cell* cell = &m_cells[tail & (m_capacity - 1)];
+      const Size sequence = cell->sequence.Load(Order::Acquire);
+      const I64 difference = static_cast<I64>(sequence - tail);
+
+      if(difference == 0) {
+        // the slot is free in this lap, so try to claim it (a failure reloads the tail)
+        if(m_tail.CompareExchangeWeak(tail, tail + 1, Order::Relaxed, Order::Relaxed))
+          return cell;
+      } else if(difference < 0) {
+        // the slot still holds the element of the previous lap
+        return nullptr;
+      } else {
+        tail = m_tail.Load(Order::Relaxed);
+      }
+    }
+  }
+
+  template <typename T>
+  typename MpmcQueue<T>::Cell* MpmcQueue<T>::claimFront() {
+    Size head = m_head.Load(Order::Relaxed);
+    while(true) {
+      Cell* cell = &m_cells[head & (m_capacity - 1)];
+      const Size sequence = cell->sequence.Load(Order::Acquire);
+      const I64 difference = static_cast<I64>(sequence - (head + 1));
+
+      if(difference == 0) {
+        if(m_head.CompareExchangeWeak(head, head + 1, Order::Relaxed, Order::Relaxed))
+          return cell;
+      } else if(difference < 0) {
+        // the element of this lap wasn't published yet
+        return nullptr;
+      } else {
+        head = m_head.Load(Order::Relaxed);
+      }
+    }
+  }
+
+  template <typename T>
+  void MpmcQueue<T>::push(Cell* a_cell) {
+    // the slot was claimed at the position equal to its sequence, which now marks it as filled
+    a_cell->sequence.Store(a_cell->sequence.Load(Order::Relaxed) + 1, Order::Release);
+  }
+
+  template <typename T>
+  void MpmcQueue<T>::pop(Cell* a_cell) {
+    std::destroy_at(&a_cell->value);
+
+    // the slot is free again for the producers of the next lap
+    a_cell->sequence.Store(a_cell->sequence.Load(Order::Relaxed) + m_capacity - 1, Order::Release);
+  }
+}
+
+#endif // NTL_MPMC_QUEUE_HPP
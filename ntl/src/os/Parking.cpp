@@ -0,0 +1,25 @@
+/**
+* @file Parking.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Parking.hpp"
+
+namespace ntl {
+  Parking::Parking()
+    : m_lock(), m_condition(&m_lock), m_waiting{0} {
+    // Empty
+  }
+
+  void Parking::Notify() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(m_waiting.Load(Atomic<Size>::MemoryOrder::Relaxed) == 0)
+      return;
+
+    m_lock.Acquire();
+    m_condition.Broadcast();
+    m_lock.Release();
+  }
+}
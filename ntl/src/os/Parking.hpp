@@ -0,0 +1,85 @@
+/**
+* @file Parking.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_PARKING_HPP
+#define NTL_PARKING_HPP
+
+#include <atomic>
+
+#include "data/Size.hpp"
+#include "os/Atomic.hpp"
+#include "os/Condition.hpp"
+#include "os/Lock.hpp"
+
+namespace ntl {
+  /**
+   * @brief A place for threads to sleep until a lock-free operation can succeed.
+   *
+   * @details Waiting threads register themselves before they check their condition again, and
+   * notifying threads only take the lock if anybody is registered. So notifying costs a fence and
+   * a load as long as nobody sleeps, and no wakeup is lost between the check and going to sleep.
+   */
+  class Parking {
+  private:
+    Lock m_lock;
+    Condition m_condition;
+    Atomic<Size> m_waiting;
+
+  public:
+    /**
+     * @brief Constructs a new parking without waiting threads.
+     */
+    Parking();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another parking
+     */
+    Parking(const Parking& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another parking
+     *
+     * @return the reference to the parking
+     */
+    Parking& operator=(const Parking& a_other) = delete;
+
+    /**
+     * @brief Sleeps until the given callable succeeds, which is retried after every notification.
+     *
+     * @param a_try a callable returning if it succeeded
+     */
+    template <typename Try>
+    void Wait(const Try& a_try);
+
+    /**
+     * @brief Wakes all waiting threads, so they retry (called after a change they may wait for).
+     *
+     * @details Runtime: O(1) if nobody waits
+     */
+    void Notify();
+  };
+
+  template <typename Try>
+  void Parking::Wait(const Try& a_try) {
+    m_lock.Acquire();
+    m_waiting.FetchAdd(1);
+
+    // pairs with the fence of Notify, so either the retry sees the change or Notify sees the waiter
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while(!a_try())
+      m_condition.Wait();
+
+    m_waiting.FetchSub(1, Atomic<Size>::MemoryOrder::Relaxed);
+    m_lock.Release();
+  }
+}
+
+#endif // NTL_PARKING_HPP
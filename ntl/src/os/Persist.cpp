@@ -0,0 +1,172 @@
+/**
+* @file Persist.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Persist.hpp"
+
+#include <bit>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "core/Assert.hpp"
+#include "data/String.hpp"
+
+namespace ntl {
+  namespace persist {
+    CVERIFY(sizeof(Header) == 128 && "the header layout is part of the file format")
+    CVERIFY(sizeof(Header) % ALIGNMENT == 0 && "the first section has to start aligned")
+
+    namespace {
+      constexpr U64 PRIME_1 = 0x9E3779B185EBCA87ULL;
+      constexpr U64 PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+      constexpr U64 PRIME_3 = 0x165667B19E3779F9ULL;
+
+      constexpr U64 round(const U64 a_accumulator, const U64 a_word) {
+        return std::rotl(a_accumulator + a_word * PRIME_2, 31) * PRIME_1;
+      }
+
+      U64 load(const Byte* a_data) {
+        U64 word;
+        std::memcpy(&word, a_data, sizeof(word));
+        return word;
+      }
+
+      Size align(const Size a_offset) {
+        return (a_offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+      }
+
+      bool writeAll(const int a_descriptor, const void* a_data, Size a_size) {
+        const Byte* data = static_cast<const Byte*>(a_data);
+        while(a_size > 0) {
+          const ssize_t written = ::write(a_descriptor, data, a_size);
+          if(written < 0) {
+            if(errno == EINTR)
+              continue;
+            return false;
+          }
+          data += written;
+          a_size -= static_cast<Size>(written);
+        }
+        return true;
+      }
+
+      bool writePadding(const int a_descriptor, const Size a_size) {
+        static constexpr Byte ZEROS[ALIGNMENT]{};
+        return writeAll(a_descriptor, ZEROS, a_size);
+      }
+    }
+
+    U64 Checksum(const void* a_data, const Size a_size, const U64 a_seed) {
+      const Byte* data = static_cast<const Byte*>(a_data);
+      const Byte* const end = data + a_size;
+
+      U64 lanes[4] = {a_seed + PRIME_1 + PRIME_2, a_seed + PRIME_2, a_seed, a_seed - PRIME_1};
+      for(; data + 32 <= end; data += 32) {
+        lanes[0] = round(lanes[0], load(data));
+        lanes[1] = round(lanes[1], load(data + 8));
+        lanes[2] = round(lanes[2], load(data + 16));
+        lanes[3] = round(lanes[3], load(data + 24));
+      }
+
+      U64 result = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+      result += static_cast<U64>(a_size);
+      for(; data + 8 <= end; data += 8)
+        result = std::rotl(result ^ round(0, load(data)), 27) * PRIME_1 + PRIME_3;
+      for(; data < end; ++data)
+        result = std::rotl(result ^ (*data * PRIME_3), 11) * PRIME_1;
+
+      result ^= result >> 33;
+      result *= PRIME_2;
+      result ^= result >> 29;
+      result *= PRIME_3;
+      result ^= result >> 32;
+      return result;
+    }
+
+    bool Write(const StringView a_path, Header& a_header, const Block* a_blocks, const Size a_count) {
+      VERIFY(a_count <= MAX_SECTIONS)
+
+      a_header.magic = MAGIC;
+      a_header.version = VERSION;
+      a_header.byte_order = ENDIANNESS_MARKER;
+      a_header.section_count = static_cast<U32>(a_count);
+      a_header.checksum = 0;
+      a_header.reserved = 0;
+
+      Size offset = sizeof(Header);
+      for(Size i = 0; i < MAX_SECTIONS; ++i) {
+        if(i < a_count) {
+          a_header.sections[i] = {offset, a_blocks[i].size};
+          a_header.checksum = Checksum(a_blocks[i].data, a_blocks[i].size, a_header.checksum);
+          offset = align(offset + a_blocks[i].size);
+        } else {
+          a_header.sections[i] = {0, 0};
+        }
+      }
+
+      const String path{a_path};
+      String temporary{path};
+      temporary.Append(".tmp");
+
+      const int descriptor = ::open(temporary.GetCString(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if(descriptor < 0)
+        return false;
+
+      bool success = writeAll(descriptor, &a_header, sizeof(Header));
+      for(Size i = 0; success && i < a_count; ++i) {
+        success = writeAll(descriptor, a_blocks[i].data, a_blocks[i].size);
+        const Size end = a_header.sections[i].offset + a_blocks[i].size;
+        if(success && i + 1 < a_count)
+          success = writePadding(descriptor, align(end) - end);
+      }
+      success = ::fsync(descriptor) == 0 && success;
+      success = ::close(descriptor) == 0 && success;
+
+      if(!success || std::rename(temporary.GetCString(), path.GetCString()) != 0) {
+        std::remove(temporary.GetCString());
+        return false;
+      }
+      return true;
+    }
+
+    const Header* Validate(const MappedFile& a_file, const Kind a_kind, const Size a_element_size,
+                           const Size a_value_size, const bool a_verify) {
+      if(!a_file.IsOpen() || a_file.GetSize() < sizeof(Header))
+        return nullptr;
+
+      const Header* header = reinterpret_cast<const Header*>(a_file.GetData());
+      if(header->magic != MAGIC || header->version != VERSION || header->byte_order != ENDIANNESS_MARKER)
+        return nullptr;
+      if(header->kind != a_kind || header->element_size != a_element_size || header->value_size != a_value_size)
+        return nullptr;
+      if(header->section_count > MAX_SECTIONS)
+        return nullptr;
+
+      U64 checksum = 0;
+      for(Size i = 0; i < header->section_count; ++i) {
+        const Section& section = header->sections[i];
+        if(section.offset % ALIGNMENT != 0 || section.offset > a_file.GetSize() ||
+           section.size > a_file.GetSize() - section.offset)
+          return nullptr;
+        if(a_verify)
+          checksum = Checksum(a_file.GetData() + section.offset, section.size, checksum);
+      }
+
+      if(a_verify && checksum != header->checksum)
+        return nullptr;
+      return header;
+    }
+
+    const Byte* GetSection(const MappedFile& a_file, const Header& a_header, const Size a_index) {
+      VERIFY(a_index < a_header.section_count)
+      return a_file.GetData() + a_header.sections[a_index].offset;
+    }
+  }
+}
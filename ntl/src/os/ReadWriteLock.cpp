@@ -0,0 +1,133 @@
+/**
+* @file ReadWriteLock.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "ReadWriteLock.hpp"
+
+#include "core/Platform.hpp"
+#include "utils/Trace.hpp"
+
+namespace ntl {
+  namespace {
+    using Order = Atomic<U32>::MemoryOrder;
+
+    constexpr U32 WRITER = 1u << 31;   // a writer is active
+    constexpr U32 PENDING = 1u << 30;  // a writer waits, so no new readers may start
+    constexpr U32 SLEEPING = 1u << 29; // some thread may sleep on the state
+    constexpr U32 READERS = SLEEPING - 1;
+
+    constexpr U32 SPIN_COUNT = 64;
+  }
+
+  ReadWriteLock::ReadWriteLock() : m_state{0} {
+    // Empty
+  }
+
+  void ReadWriteLock::StartRead() {
+    U32 state = m_state.Load(Order::Relaxed);
+    if((state & (WRITER | PENDING)) != 0 ||
+       !m_state.CompareExchangeWeak(state, state + 1, Order::Acquire, Order::Relaxed))
+      startReadContended(state);
+  }
+
+  bool ReadWriteLock::TryStartRead() {
+    U32 state = m_state.Load(Order::Relaxed);
+    while((state & (WRITER | PENDING)) == 0) {
+      if(m_state.CompareExchangeWeak(state, state + 1, Order::Acquire, Order::Relaxed))
+        return true;
+    }
+    return false;
+  }
+
+  void ReadWriteLock::StartWrite() {
+    U32 state = 0;
+    if(!m_state.CompareExchangeWeak(state, WRITER, Order::Acquire, Order::Relaxed))
+      startWriteContended(state);
+  }
+
+  bool ReadWriteLock::TryStartWrite() {
+    U32 state = m_state.Load(Order::Relaxed);
+    while((state & (WRITER | READERS)) == 0) {
+      if(m_state.CompareExchangeWeak(state, WRITER | (state & SLEEPING), Order::Acquire, Order::Relaxed))
+        return true;
+    }
+    return false;
+  }
+
+  void ReadWriteLock::EndRead() {
+    const U32 state = m_state.FetchSub(1, Order::Release);
+
+    // only the last reader can unblock a writer
+    if((state & READERS) == 1 && (state & SLEEPING) != 0)
+      wake();
+  }
+
+  void ReadWriteLock::EndWrite() {
+    if((m_state.FetchAnd(~WRITER, Order::Release) & SLEEPING) != 0)
+      wake();
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  void ReadWriteLock::startReadContended(U32 a_state) {
+    NTL_PROFILE_SCOPE("ReadWriteLock::StartRead");
+    U32 spins = 0;
+
+    while(true) {
+      if((a_state & (WRITER | PENDING)) == 0) {
+        // a failed exchange reloads the state
+        if(m_state.CompareExchangeWeak(a_state, a_state + 1, Order::Acquire, Order::Relaxed))
+          return;
+        continue;
+      }
+      wait(a_state, spins);
+    }
+  }
+
+  void ReadWriteLock::startWriteContended(U32 a_state) {
+    NTL_PROFILE_SCOPE("ReadWriteLock::StartWrite");
+    U32 spins = 0;
+
+    while(true) {
+      if((a_state & (WRITER | READERS)) == 0) {
+        // clears the pending flag, writers still waiting set it again
+        if(m_state.CompareExchangeWeak(a_state, WRITER | (a_state & SLEEPING), Order::Acquire, Order::Relaxed))
+          return;
+        continue;
+      }
+      if((a_state & PENDING) == 0) {
+        if(m_state.CompareExchangeWeak(a_state, a_state | PENDING, Order::Relaxed, Order::Relaxed))
+          a_state |= PENDING;
+        continue;
+      }
+      wait(a_state, spins);
+    }
+  }
+
+  void ReadWriteLock::wait(U32& a_state, U32& a_spins) {
+    if(a_spins < SPIN_COUNT) {
+      ++a_spins;
+      NTL_PAUSE();
+      a_state = m_state.Load(Order::Relaxed);
+      return;
+    }
+
+    if((a_state & SLEEPING) == 0 &&
+       !m_state.CompareExchangeWeak(a_state, a_state | SLEEPING, Order::Relaxed, Order::Relaxed))
+      return;
+
+    // returns right away if the state changed since it was loaded
+    m_state.Wait(a_state | SLEEPING, Order::Relaxed);
+    a_state = m_state.Load(Order::Relaxed);
+  }
+
+  void ReadWriteLock::wake() {
+    m_state.FetchAnd(~SLEEPING, Order::Relaxed);
+    m_state.NotifyAll();
+  }
+}
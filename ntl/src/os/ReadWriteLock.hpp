@@ -0,0 +1,119 @@
+/**
+* @file ReadWriteLock.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_READ_WRITE_LOCK_HPP
+#define NTL_READ_WRITE_LOCK_HPP
+
+#include "data/Integer.hpp"
+#include "os/Atomic.hpp"
+
+namespace ntl {
+  /**
+   * @brief A reader-writer lock built on a single atomic counter.
+   *
+   * @details The state holds the number of readers and flags for an active writer, a waiting writer
+   * and sleeping threads. An uncontended StartRead and EndRead take a single atomic operation each,
+   * without any mutex. Waiting threads spin for a short while and then sleep on the state (a futex
+   * on Linux), and only releases that may unblock a sleeper enter the kernel. A waiting writer keeps
+   * new readers out, so writers don't starve under a steady stream of readers.
+   *
+   * @note The lock isn't recursive: a thread starting a second read access while a writer waits
+   * deadlocks.
+   */
+  class ReadWriteLock {
+  private:
+    Atomic<U32> m_state;
+
+  public:
+    /**
+     * @brief Default Constructor.
+     */
+    ReadWriteLock();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another lock
+     */
+    ReadWriteLock(const ReadWriteLock& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another lock
+     *
+     * @return the reference to the lock
+     */
+    ReadWriteLock& operator=(const ReadWriteLock& a_other) = delete;
+
+    /**
+     * @brief Starts the shared read access. The calling thread will block while a writer is active or waiting.
+     */
+    void StartRead();
+
+    /**
+     * @brief Attempts to start the shared read access.
+     *
+     * @return Returns true if the read access was started, otherwise returns false.
+     */
+    bool TryStartRead();
+
+    /**
+     * @brief Starts the exclusive write access. The calling thread will block while any access is active.
+     */
+    void StartWrite();
+
+    /**
+     * @brief Attempts to start the exclusive write access.
+     *
+     * @return Returns true if the write access was started, otherwise returns false.
+     */
+    bool TryStartWrite();
+
+    /**
+     * @brief Ends the shared read access.
+     */
+    void EndRead();
+
+    /**
+     * @brief Ends the exclusive write access.
+     *
+     * @note Ending a write access that was started by a different thread results in undefined behaviour.
+     */
+    void EndWrite();
+
+  private:
+    /**
+     * @brief Waits until the read access can be started (after the first attempt failed).
+     *
+     * @param a_state the state seen by the first attempt
+     */
+    void startReadContended(U32 a_state);
+
+    /**
+     * @brief Waits until the write access can be started (after the first attempt failed).
+     *
+     * @param a_state the state seen by the first attempt
+     */
+    void startWriteContended(U32 a_state);
+
+    /**
+     * @brief Spins for a while and then sleeps until the given state changes.
+     *
+     * @param a_state the last loaded state, receives the new one
+     * @param a_spins the number of rounds spun so far
+     */
+    void wait(U32& a_state, U32& a_spins);
+
+    /**
+     * @brief Wakes all sleeping threads after a release.
+     */
+    void wake();
+  };
+}
+
+#endif // NTL_READ_WRITE_LOCK_HPP
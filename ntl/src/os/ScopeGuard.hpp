@@ -0,0 +1,126 @@
+/**
+* @file ScopeGuard.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_SCOPE_GUARD_HPP
+#define NTL_SCOPE_GUARD_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include "data/Size.hpp"
+
+namespace ntl {
+  /**
+   * @brief Holds a lock with Acquire and Release (e.g. SpinLock or AdaptiveLock) for the lifetime of the guard.
+   *
+   * @details The generic counterpart of ScopeLock.
+   *
+   * @tparam LockType the type of the lock
+   */
+  template <typename LockType>
+  class ScopeGuard {
+  private:
+    LockType* m_lock;
+
+  public:
+    /**
+     * @brief Acquires the given lock.
+     *
+     * @param a_lock the lock
+     */
+    explicit ScopeGuard(LockType* a_lock) : m_lock{a_lock} {
+      m_lock->Acquire();
+    }
+
+    /**
+     * @brief Releases the lock.
+     */
+    ~ScopeGuard() {
+      m_lock->Release();
+    }
+
+    ScopeGuard(const ScopeGuard& a_other) = delete;
+    ScopeGuard& operator=(const ScopeGuard& a_other) = delete;
+  };
+
+  /**
+   * @brief Holds the shared read access of a lock (e.g. SharedLock or ReadWriteLock) for the lifetime of the guard.
+   *
+   * @details Keeps the value returned by StartRead, if any (e.g. the slot of a DistributedSharedLock),
+   * and passes it to EndRead.
+   *
+   * @tparam LockType the type of the lock
+   */
+  template <typename LockType>
+  class ScopeRead {
+  private:
+    static constexpr bool has_token = !std::is_void_v<decltype(std::declval<LockType&>().StartRead())>;
+    using Token = std::conditional_t<has_token, Size, bool>;
+
+    LockType* m_lock;
+    Token m_token;
+
+  public:
+    /**
+     * @brief Starts the read access of the given lock.
+     *
+     * @param a_lock the lock
+     */
+    explicit ScopeRead(LockType* a_lock) : m_lock{a_lock}, m_token{} {
+      if constexpr(has_token)
+        m_token = m_lock->StartRead();
+      else
+        m_lock->StartRead();
+    }
+
+    /**
+     * @brief Ends the read access.
+     */
+    ~ScopeRead() {
+      if constexpr(has_token)
+        m_lock->EndRead(m_token);
+      else
+        m_lock->EndRead();
+    }
+
+    ScopeRead(const ScopeRead& a_other) = delete;
+    ScopeRead& operator=(const ScopeRead& a_other) = delete;
+  };
+
+  /**
+   * @brief Holds the exclusive write access of a lock (e.g. SharedLock or ReadWriteLock) for the lifetime of the guard.
+   *
+   * @tparam LockType the type of the lock
+   */
+  template <typename LockType>
+  class ScopeWrite {
+  private:
+    LockType* m_lock;
+
+  public:
+    /**
+     * @brief Starts the write access of the given lock.
+     *
+     * @param a_lock the lock
+     */
+    explicit ScopeWrite(LockType* a_lock) : m_lock{a_lock} {
+      m_lock->StartWrite();
+    }
+
+    /**
+     * @brief Ends the write access.
+     */
+    ~ScopeWrite() {
+      m_lock->EndWrite();
+    }
+
+    ScopeWrite(const ScopeWrite& a_other) = delete;
+    ScopeWrite& operator=(const ScopeWrite& a_other) = delete;
+  };
+}
+
+#endif // NTL_SCOPE_GUARD_HPP
@@ -7,10 +7,12 @@
 
 #include "Semaphore.hpp"
 
+#include <cerrno>
+
 namespace ntl {
   Semaphore::Semaphore(const bool a_shared_process, const U32 a_value)
     : m_sem() {
-    sem_init(&m_sem, a_shared_process ? 0 : 1, a_value);
+    sem_init(&m_sem, a_shared_process ? 1 : 0, a_value);
   }
 
   Semaphore::~Semaphore() {
@@ -21,6 +23,29 @@ namespace ntl {
     return (sem_wait(&m_sem) == 0);
   }
 
+  bool Semaphore::TryWait() {
+    return (sem_trywait(&m_sem) == 0);
+  }
+
+  bool Semaphore::WaitFor(const std::chrono::nanoseconds a_timeout) {
+    return WaitUntil(time::Deadline(a_timeout));
+  }
+
+  bool Semaphore::WaitUntil(const time::Clock::time_point a_deadline) {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 30))
+    const timespec deadline = time::ToTimespec(a_deadline);
+    int result;
+    while((result = sem_clockwait(&m_sem, CLOCK_MONOTONIC, &deadline)) != 0 && errno == EINTR) {}
+#else
+    // sem_timedwait only takes a deadline of the realtime clock
+    const timespec deadline = time::ToTimespec(std::chrono::system_clock::now().time_since_epoch() +
+                                               (a_deadline - time::Clock::now()));
+    int result;
+    while((result = sem_timedwait(&m_sem, &deadline)) != 0 && errno == EINTR) {}
+#endif
+    return result == 0;
+  }
+
   bool Semaphore::Post() {
     return (sem_post(&m_sem) == 0);
   }
@@ -8,15 +8,19 @@
 #ifndef NTL_SEMAPHORE_HPP
 #define NTL_SEMAPHORE_HPP
 
+#include <chrono>
+
 #include <semaphore.h>
 
 #include "data/Integer.hpp"
+#include "os/Time.hpp"
 
 namespace ntl {
   /**
    * @brief A class that provides synchronization mechanism using mutual-exclusives.
    *
-   * @note The Lock class currently is just a wrapper around the pthread_mutex_t
+   * @note The Semaphore class currently is just a wrapper around the sem_t, so every Post is a
+   * system call. Use LightweightSemaphore within a single process.
    */
   class Semaphore {
   private:
@@ -60,6 +64,29 @@ namespace ntl {
     * @return Returns true if the semaphore waited successfully, otherwise returns false.
     */
     bool Wait();
+
+    /**
+     * @brief Decrements the semaphore, if its value is greater than 0.
+     *
+     * @return Returns true if the semaphore was decremented, otherwise returns false.
+     */
+    bool TryWait();
+
+    /**
+     * @brief Decrements the semaphore, blocking the calling thread for at most the given duration.
+     *
+     * @param a_timeout the maximum duration to wait
+     * @return Returns true if the semaphore was decremented, otherwise returns false.
+     */
+    bool WaitFor(std::chrono::nanoseconds a_timeout);
+
+    /**
+     * @brief Decrements the semaphore, blocking the calling thread until the given point in time at most.
+     *
+     * @param a_deadline the point in time to stop waiting at
+     * @return Returns true if the semaphore was decremented, otherwise returns false.
+     */
+    bool WaitUntil(time::Clock::time_point a_deadline);
     /**
      * @brief Increments the semaphore. If the semaphore's value was 0, then
      * another thread/process will be woken up.
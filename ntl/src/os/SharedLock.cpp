@@ -7,64 +7,48 @@
 
 #include "SharedLock.hpp"
 
+#include "utils/Profile.hpp"
+
 namespace ntl {
   SharedLock::SharedLock()
-    : m_mutex(), m_no_writers_left(), m_is_only_access(), m_reader_count(0), m_writer_count(0), m_is_writing(false) {
-    pthread_mutex_init(&m_mutex, nullptr);
-    pthread_cond_init(&m_is_only_access, nullptr);
-    pthread_cond_init(&m_no_writers_left, nullptr);
+    : m_lock() {
+    pthread_rwlockattr_t attributes;
+    pthread_rwlockattr_init(&attributes);
+#ifdef __GLIBC__
+    // glibc prefers readers by default, which lets a steady stream of readers starve writers
+    pthread_rwlockattr_setkind_np(&attributes, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+    pthread_rwlock_init(&m_lock, &attributes);
+    pthread_rwlockattr_destroy(&attributes);
   }
 
   SharedLock::~SharedLock() {
-    pthread_mutex_destroy(&m_mutex);
-    pthread_cond_destroy(&m_is_only_access);
-    pthread_cond_destroy(&m_no_writers_left);
+    pthread_rwlock_destroy(&m_lock);
   }
 
   void SharedLock::StartRead() {
-    pthread_mutex_lock(&m_mutex);
-
-    while (m_writer_count != 0) {
-      pthread_cond_wait(&m_no_writers_left, &m_mutex);
-    }
-    ++m_reader_count;
-
-    pthread_mutex_unlock(&m_mutex);
+#if NTL_PROFILE
+    profile::TimedAcquire(profile::LockKind::SHARED_READ, [this] { return pthread_rwlock_tryrdlock(&m_lock) == 0; },
+                          [this] { pthread_rwlock_rdlock(&m_lock); });
+#else
+    pthread_rwlock_rdlock(&m_lock);
+#endif
   }
 
   void SharedLock::StartWrite() {
-    pthread_mutex_lock(&m_mutex);
-
-    // incrementing writer count before waiting to avoid writers starvation
-    ++m_writer_count;
-    while (m_reader_count != 0 || m_is_writing) {
-      pthread_cond_wait(&m_is_only_access, &m_mutex);
-    }
-    m_is_writing = true;
-
-    pthread_mutex_unlock(&m_mutex);
+#if NTL_PROFILE
+    profile::TimedAcquire(profile::LockKind::SHARED_WRITE, [this] { return pthread_rwlock_trywrlock(&m_lock) == 0; },
+                          [this] { pthread_rwlock_wrlock(&m_lock); });
+#else
+    pthread_rwlock_wrlock(&m_lock);
+#endif
   }
 
   void SharedLock::EndRead() {
-    pthread_mutex_lock(&m_mutex);
-
-    --m_reader_count;
-    if (m_reader_count == 0 && m_writer_count > 0)
-      pthread_cond_broadcast(&m_is_only_access);
-
-    pthread_mutex_unlock(&m_mutex);
+    pthread_rwlock_unlock(&m_lock);
   }
 
   void SharedLock::EndWrite() {
-    pthread_mutex_lock(&m_mutex);
-
-    --m_writer_count;
-    m_is_writing = false;
-    if (m_writer_count > 0)
-      pthread_cond_broadcast(&m_is_only_access);
-    else
-      pthread_cond_broadcast(&m_no_writers_left);
-
-    pthread_mutex_unlock(&m_mutex);
+    pthread_rwlock_unlock(&m_lock);
   }
 }
@@ -16,17 +16,13 @@ namespace ntl {
    * The advantage of using SharedMutex over Mutex is that it separates read- and write accesses.
    * This allows simultaneous read accesses while exclusively allowing a single write access.
    *
-   * @note The SharedLock class currently is just a wrapper around the pthread_mutex_t in
-   * combination with pthread_cond_t to ease safety of critical sections.
+   * @note The SharedLock class is a wrapper around pthread_rwlock_t, so uncontended read accesses
+   * only take a single atomic operation instead of a mutex. Waiting writers are preferred over new
+   * readers to avoid writer starvation.
    */
   class SharedLock {
   private:
-    pthread_mutex_t m_mutex;
-    pthread_cond_t m_no_writers_left;
-    pthread_cond_t m_is_only_access;
-    int m_reader_count;
-    int m_writer_count;
-    bool m_is_writing;
+    pthread_rwlock_t m_lock;
 
   public:
     /**
@@ -0,0 +1,317 @@
+/**
+* @file SnapshotCell.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_SNAPSHOT_CELL_HPP
+#define NTL_SNAPSHOT_CELL_HPP
+
+#include <cstdint>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "data/Integer.hpp"
+#include "os/Atomic.hpp"
+
+namespace ntl {
+  namespace detail {
+    /**
+     * @brief A published version, freed once neither the cell nor a snapshot references it.
+     */
+    template <typename T>
+    struct SnapshotVersion {
+      T value;
+      Atomic<I64> refs;
+    };
+  }
+
+  template <typename T>
+  class SnapshotCell;
+
+  /**
+   * @brief A reference to a version published by a SnapshotCell, which stays unchanged while it is held.
+   *
+   * @tparam T the type of the published values
+   */
+  template <typename T>
+  class Snapshot {
+    friend class SnapshotCell<T>;
+
+  private:
+    detail::SnapshotVersion<T>* m_version;
+
+    /**
+     * @brief Takes over a reference to the given version.
+     *
+     * @param a_version the version
+     */
+    explicit Snapshot(detail::SnapshotVersion<T>* a_version) : m_version{a_version} {
+      // Empty
+    }
+
+  public:
+    /**
+     * @brief Constructs a new snapshot referencing the same version as another snapshot.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_other the other snapshot
+     */
+    Snapshot(const Snapshot& a_other) : m_version{a_other.m_version} {
+      if(m_version)
+        m_version->refs.FetchAdd(1, Atomic<I64>::MemoryOrder::Relaxed);
+    }
+
+    /**
+     * @brief Constructs a new snapshot by taking over the reference of another snapshot.
+     *
+     * @param a_other the other snapshot (referencing nothing afterwards)
+     */
+    Snapshot(Snapshot&& a_other) noexcept : m_version{std::exchange(a_other.m_version, nullptr)} {
+      // Empty
+    }
+
+    /**
+     * @brief Drops the reference, freeing the version if it was replaced and this was the last reference.
+     */
+    ~Snapshot() { release(m_version); }
+
+    /**
+     * @brief Overloading assignment operator.
+     * @param a_other the snapshot to reference the version of
+     * @return the reference of the current snapshot object
+     */
+    Snapshot& operator=(const Snapshot& a_other) {
+      if(this != &a_other)
+        *this = Snapshot(a_other);
+      return *this;
+    }
+
+    /**
+     * @brief Overloading move assignment operator.
+     * @param a_other the snapshot to take the reference from
+     * @return the reference of the current snapshot object
+     */
+    Snapshot& operator=(Snapshot&& a_other) noexcept {
+      std::swap(m_version, a_other.m_version);
+      return *this;
+    }
+
+    /**
+     * @brief Gets the value of the version.
+     *
+     * @return the value itself
+     */
+    const T& Get() const { return m_version->value; }
+
+    const T& operator*() const { return Get(); }
+    const T* operator->() const { return &Get(); }
+
+    /**
+     * @brief Checks if both snapshots reference the same version.
+     *
+     * @param a_other the other snapshot
+     * @return if the versions are the same
+     */
+    bool operator==(const Snapshot& a_other) const { return m_version == a_other.m_version; }
+
+  private:
+    /**
+     * @brief Drops a reference to the given version, freeing it if it was the last one.
+     *
+     * @param a_version the version (may be nullptr)
+     */
+    static void release(detail::SnapshotVersion<T>* a_version) {
+      if(a_version && a_version->refs.FetchSub(1, Atomic<I64>::MemoryOrder::AcquireRelease) == 1)
+        delete a_version;
+    }
+  };
+
+  /**
+   * @brief Publishes immutable versions of a value to readers through an atomic pointer swap.
+   *
+   * @details Readers load a Snapshot of the current version, which keeps it alive while the writer prepares
+   * and publishes the next one. Together with the persistent containers (see PersistentArray and
+   * PersistentMap) a writer copies the current version in O(1) and only duplicates what it changes.
+   *
+   * Loading never locks: the pointer word carries a count of the readers that are just loading it in its
+   * upper 16 bits. A reader borrows a reference by incrementing that count, takes a reference of its own on
+   * the version and returns the borrowed one. If the version was replaced in the meantime, the publisher
+   * already handed the borrowed count over to the version, so the reader returns it there instead. So a
+   * version is never freed while it is loaded, without hazard pointers or epochs.
+   *
+   * @tparam T the type of the published values
+   *
+   * @note Requires 64-bit pointers with the upper 16 bits unused, as on x86-64 and AArch64. At most
+   * 65535 threads may be loading at the same time.
+   */
+  template <typename T>
+  class SnapshotCell {
+  private:
+    using Order = typename Atomic<U64>::MemoryOrder;
+
+    static constexpr U32 COUNT_SHIFT = 48;
+    static constexpr U64 BORROWED = U64{1} << COUNT_SHIFT;
+    static constexpr U64 POINTER_MASK = BORROWED - 1;
+
+    CVERIFY(sizeof(void*) == sizeof(U64) && "SnapshotCell requires 64-bit pointers");
+
+    mutable Atomic<U64> m_word;
+
+  public:
+    /**
+     * @brief Constructs a new cell publishing the given value.
+     *
+     * @param a_value the first version
+     */
+    explicit SnapshotCell(T a_value = T{});
+
+    /**
+     * @brief Drops the reference to the current version.
+     */
+    ~SnapshotCell();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another cell
+     */
+    SnapshotCell(const SnapshotCell& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another cell
+     *
+     * @return the reference to the cell
+     */
+    SnapshotCell& operator=(const SnapshotCell& a_other) = delete;
+
+    /**
+     * @brief Gets the current version.
+     *
+     * @details Runtime: O(1), lock-free
+     *
+     * @return the snapshot of the current version
+     */
+    [[nodiscard]] Snapshot<T> Load() const;
+
+    /**
+     * @brief Replaces the current version, which is freed once the last snapshot of it is gone.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_value the new version
+     */
+    void Publish(T a_value);
+
+    /**
+     * @brief Replaces the current version only if it is still the given one, so concurrent writers
+     * don't overwrite each other.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_expected the version the new one was derived from
+     * @param a_value the new version
+     * @return if the new version was published (it is dropped otherwise)
+     */
+    bool CompareAndPublish(const Snapshot<T>& a_expected, T a_value);
+
+  private:
+    /**
+     * @brief Hands the borrowed count of a replaced word over to its version and drops the cell's reference.
+     *
+     * @param a_word the replaced word
+     */
+    static void retire(U64 a_word);
+
+    static U64 pack(detail::SnapshotVersion<T>* a_version);
+    static detail::SnapshotVersion<T>* version(U64 a_word);
+  };
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename T>
+  SnapshotCell<T>::SnapshotCell(T a_value) : m_word{pack(new detail::SnapshotVersion<T>{std::move(a_value), Atomic<I64>{1}})} {
+    // Empty
+  }
+
+  template <typename T>
+  SnapshotCell<T>::~SnapshotCell() {
+    const U64 word = m_word.Load(Order::Acquire);
+    VERIFY((word >> COUNT_SHIFT) == 0 && "Cell destroyed while a snapshot was loaded")
+    Snapshot<T>::release(version(word));
+  }
+
+  template <typename T>
+  Snapshot<T> SnapshotCell<T>::Load() const {
+    const U64 word = m_word.FetchAdd(BORROWED, Order::Acquire);
+    detail::SnapshotVersion<T>* current = version(word);
+    current->refs.FetchAdd(1, Atomic<I64>::MemoryOrder::Relaxed);
+
+    // returns the borrowed reference to the word, or to the version if the word was replaced
+    U64 expected = m_word.Load(Order::Relaxed);
+    while(version(expected) == current) {
+      // releases the reference taken above to the publisher reading the count
+      if(m_word.CompareExchangeWeak(expected, expected - BORROWED, Order::Release, Order::Relaxed))
+        return Snapshot<T>(current);
+    }
+    Snapshot<T>::release(current);
+    return Snapshot<T>(current);
+  }
+
+  template <typename T>
+  void SnapshotCell<T>::Publish(T a_value) {
+    const U64 word = pack(new detail::SnapshotVersion<T>{std::move(a_value), Atomic<I64>{1}});
+    retire(m_word.Exchange(word, Order::AcquireRelease));
+  }
+
+  template <typename T>
+  bool SnapshotCell<T>::CompareAndPublish(const Snapshot<T>& a_expected, T a_value) {
+    U64 expected = m_word.Load(Order::Relaxed);
+    if(version(expected) != a_expected.m_version)
+      return false;
+
+    auto* next = new detail::SnapshotVersion<T>{std::move(a_value), Atomic<I64>{1}};
+    // only the borrowed count may change while the version stays the same
+    while(!m_word.CompareExchangeWeak(expected, pack(next), Order::AcquireRelease, Order::Relaxed)) {
+      if(version(expected) != a_expected.m_version) {
+        delete next;
+        return false;
+      }
+    }
+
+    retire(expected);
+    return true;
+  }
+
+  // ---------------
+  // PRIVATE METHODS
+  // ---------------
+
+  template <typename T>
+  void SnapshotCell<T>::retire(const U64 a_word) {
+    detail::SnapshotVersion<T>* replaced = version(a_word);
+    // added before the cell's reference is dropped, so the readers returning them never free the version early
+    replaced->refs.FetchAdd(static_cast<I64>(a_word >> COUNT_SHIFT), Atomic<I64>::MemoryOrder::Relaxed);
+    Snapshot<T>::release(replaced);
+  }
+
+  template <typename T>
+  U64 SnapshotCell<T>::pack(detail::SnapshotVersion<T>* a_version) {
+    const auto word = static_cast<U64>(reinterpret_cast<std::uintptr_t>(a_version));
+    VERIFY((word & ~POINTER_MASK) == 0 && "Pointer uses the bits of the borrowed count")
+    return word;
+  }
+
+  template <typename T>
+  detail::SnapshotVersion<T>* SnapshotCell<T>::version(const U64 a_word) {
+    return reinterpret_cast<detail::SnapshotVersion<T>*>(static_cast<std::uintptr_t>(a_word & POINTER_MASK));
+  }
+}
+
+#endif // NTL_SNAPSHOT_CELL_HPP
@@ -0,0 +1,43 @@
+/**
+* @file SpinLock.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "SpinLock.hpp"
+
+#include <algorithm>
+
+#include "core/Platform.hpp"
+
+namespace ntl {
+  namespace {
+    using Order = Atomic<U32>::MemoryOrder;
+
+    constexpr U32 MAX_BACKOFF = 64;
+  }
+
+  SpinLock::SpinLock() : m_locked{0} {
+    // Empty
+  }
+
+  void SpinLock::Acquire() {
+    U32 backoff = 1;
+    while(m_locked.Exchange(1, Order::Acquire) != 0) {
+      do {
+        for(U32 i = 0; i < backoff; ++i)
+          NTL_PAUSE();
+        backoff = std::min(backoff * 2, MAX_BACKOFF);
+      } while(m_locked.Load(Order::Relaxed) != 0);
+    }
+  }
+
+  bool SpinLock::TryAcquire() {
+    return m_locked.Load(Order::Relaxed) == 0 && m_locked.Exchange(1, Order::Acquire) == 0;
+  }
+
+  void SpinLock::Release() {
+    m_locked.Store(0, Order::Release);
+  }
+}
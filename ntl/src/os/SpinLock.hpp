@@ -0,0 +1,68 @@
+/**
+* @file SpinLock.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_SPIN_LOCK_HPP
+#define NTL_SPIN_LOCK_HPP
+
+#include "data/Integer.hpp"
+#include "os/Atomic.hpp"
+
+namespace ntl {
+  /**
+   * @brief A mutual-exclusive lock that busy-waits instead of sleeping.
+   *
+   * @details Waiting threads only read the lock (which keeps its cache line shared) and pause the
+   * core with exponentially more pause instructions between the reads, until the lock looks free and
+   * they try to take it. Only suited for critical sections of a few instructions and never more
+   * threads than cores, as a preempted owner lets all waiters burn their time slices.
+   */
+  class SpinLock {
+  private:
+    Atomic<U32> m_locked;
+
+  public:
+    /**
+     * @brief Default Constructor.
+     */
+    SpinLock();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another lock
+     */
+    SpinLock(const SpinLock& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another lock
+     *
+     * @return the reference to the lock
+     */
+    SpinLock& operator=(const SpinLock& a_other) = delete;
+
+    /**
+     * @brief Locks the lock, spinning until it is available.
+     */
+    void Acquire();
+
+    /**
+     * @brief Attempts to lock the lock.
+     *
+     * @return Returns true if the lock was acquired successfully, otherwise returns false.
+     */
+    bool TryAcquire();
+
+    /**
+     * @brief Unlocks the lock.
+     */
+    void Release();
+  };
+}
+
+#endif // NTL_SPIN_LOCK_HPP
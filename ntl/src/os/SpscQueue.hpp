@@ -0,0 +1,312 @@
+/**
+* @file SpscQueue.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_SPSC_QUEUE_HPP
+#define NTL_SPSC_QUEUE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+#include "data/Size.hpp"
+#include "os/Atomic.hpp"
+#include "os/Parking.hpp"
+#include "utils/Allocator.hpp"
+
+namespace ntl {
+  /**
+   * @brief A bounded wait-free queue passing elements from a single producer to a single consumer thread.
+   *
+   * @details The elements live in a ring buffer with a power-of-two capacity. The producer only writes
+   * the tail and the consumer only writes the head, each on its own cache line. Both sides cache the
+   * last seen index of the other one, so they only touch the cache line of the other side when the
+   * queue looks full (or empty).
+   *
+   * The Try* operations never block and don't wake sleeping threads, so they only cost a few loads
+   * and stores. Put and Get sleep while the queue is full (or empty) and wake the threads
+   * sleeping in the opposite operation, which costs a fence. So a side may only sleep if the other
+   * side uses the blocking operations as well.
+   *
+   * @tparam T the type of the elements to pass
+   */
+  template <typename T>
+  class SpscQueue {
+  private:
+    using Order = typename Atomic<Size>::MemoryOrder;
+
+    // written by the consumer
+    alignas(NTL_CACHE_LINE_SIZE) Atomic<Size> m_head;
+    Size m_cached_tail;
+
+    // written by the producer
+    alignas(NTL_CACHE_LINE_SIZE) Atomic<Size> m_tail;
+    Size m_cached_head;
+
+    alignas(NTL_CACHE_LINE_SIZE) T* m_data;
+    Size m_capacity;
+    DefaultAllocator m_allocator;
+
+    Parking m_not_full;
+    Parking m_not_empty;
+
+  public:
+    /**
+     * @brief Constructs a new queue with the given capacity.
+     *
+     * @param a_capacity the maximum number of elements (rounded up to the next power of two)
+     */
+    explicit SpscQueue(Size a_capacity = 1024);
+
+    /**
+     * @brief Destroys the remaining elements of the queue.
+     */
+    ~SpscQueue();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another queue
+     */
+    SpscQueue(const SpscQueue& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another queue
+     *
+     * @return the reference to the queue
+     */
+    SpscQueue& operator=(const SpscQueue& a_other) = delete;
+
+    /**
+     * @brief Constructs a new element at the end of the queue, if it isn't full (producer only).
+     *
+     * @details Runtime: O(1) (wait-free)
+     *
+     * @param a_args the arguments passed to the constructor of the element
+     * @return if the element was added
+     */
+    template <typename... Args>
+    bool TryEmplace(Args&&... a_args);
+
+    /**
+     * @brief Puts an element at the end of the queue, if it isn't full (producer only).
+     *
+     * @details Runtime: O(1) (wait-free)
+     *
+     * @param a_element the element to add (only moved from if it was added)
+     * @return if the element was added
+     */
+    bool TryPut(T&& a_element);
+
+    /**
+     * @brief Puts a copy of the element at the end of the queue, if it isn't full (producer only).
+     *
+     * @details Runtime: O(1) (wait-free)
+     *
+     * @param a_element the element to add
+     * @return if the element was added
+     */
+    bool TryPut(const T& a_element);
+
+    /**
+     * @brief Removes the oldest element from the queue, if it isn't empty (consumer only).
+     *
+     * @details Runtime: O(1) (wait-free)
+     *
+     * @param a_element receives the removed element
+     * @return if an element was removed
+     */
+    bool TryGet(T& a_element);
+
+    /**
+     * @brief Puts an element at the end of the queue, sleeping while it is full (producer only).
+     *
+     * @param a_element the element to add
+     */
+    void Put(T a_element);
+
+    /**
+     * @brief Removes the oldest element from the queue, sleeping while it is empty (consumer only).
+     *
+     * @return the removed element
+     */
+    T Get();
+
+    /**
+     * @brief Gets the number of elements in the queue (only exact if neither side is active).
+     *
+     * @return the size of the queue
+     */
+    [[nodiscard]] Size GetSize() const;
+
+    /**
+     * @brief Gets the maximum number of elements in the queue.
+     *
+     * @return the capacity of the queue
+     */
+    [[nodiscard]] Size GetCapacity() const;
+
+    /**
+     * @brief Checks if the queue is empty (only exact if neither side is active).
+     *
+     * @return if the queue is empty
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+  private:
+    /**
+     * @brief Gets the free slot at the end of the queue (producer only).
+     *
+     * @return the slot (nullptr if the queue is full)
+     */
+    T* back();
+
+    /**
+     * @brief Publishes the element constructed in the slot returned by back.
+     */
+    void push();
+
+    /**
+     * @brief Gets the oldest element of the queue (consumer only).
+     *
+     * @return the element (nullptr if the queue is empty)
+     */
+    T* front();
+
+    /**
+     * @brief Destroys the element returned by front and frees its slot.
+     */
+    void pop();
+  };
+
+  template <typename T>
+  SpscQueue<T>::SpscQueue(const Size a_capacity)
+    : m_head{0}, m_cached_tail{0}, m_tail{0}, m_cached_head{0}, m_capacity{std::bit_ceil(std::max(a_capacity, Size{1}))} {
+    m_data = memory::Allocate<T>(m_allocator, m_capacity);
+  }
+
+  template <typename T>
+  SpscQueue<T>::~SpscQueue() {
+    const Size tail = m_tail.Load(Order::Relaxed);
+    for(Size i = m_head.Load(Order::Relaxed); i != tail; ++i)
+      std::destroy_at(m_data + (i & (m_capacity - 1)));
+    memory::Deallocate(m_allocator, m_data, m_capacity);
+  }
+
+  template <typename T>
+  template <typename... Args>
+  bool SpscQueue<T>::TryEmplace(Args&&... a_args) {
+    T* slot = back();
+    if(!slot)
+      return false;
+
+    std::construct_at(slot, std::forward<Args>(a_args)...);
+    push();
+    return true;
+  }
+
+  template <typename T>
+  bool SpscQueue<T>::TryPut(T&& a_element) {
+    return TryEmplace(std::move(a_element));
+  }
+
+  template <typename T>
+  bool SpscQueue<T>::TryPut(const T& a_element) {
+    return TryEmplace(a_element);
+  }
+
+  template <typename T>
+  bool SpscQueue<T>::TryGet(T& a_element) {
+    T* slot = front();
+    if(!slot)
+      return false;
+
+    a_element = std::move(*slot);
+    pop();
+    return true;
+  }
+
+  template <typename T>
+  void SpscQueue<T>::Put(T a_element) {
+    T* slot = back();
+    if(!slot)
+      m_not_full.Wait([&] { return (slot = back()) != nullptr; });
+
+    std::construct_at(slot, std::move(a_element));
+    push();
+    m_not_empty.Notify();
+  }
+
+  template <typename T>
+  T SpscQueue<T>::Get() {
+    T* slot = front();
+    if(!slot)
+      m_not_empty.Wait([&] { return (slot = front()) != nullptr; });
+
+    T element = std::move(*slot);
+    pop();
+    m_not_full.Notify();
+    return element;
+  }
+
+  template <typename T>
+  Size SpscQueue<T>::GetSize() const {
+    // the head is loaded first, as it never passes the tail
+    const Size head = m_head.Load(Order::Acquire);
+    return m_tail.Load(Order::Acquire) - head;
+  }
+
+  template <typename T>
+  Size SpscQueue<T>::GetCapacity() const {
+    return m_capacity;
+  }
+
+  template <typename T>
+  bool SpscQueue<T>::IsEmpty() const {
+    return GetSize() == 0;
+  }
+
+  template <typename T>
+  T* SpscQueue<T>::back() {
+    const Size tail = m_tail.Load(Order::Relaxed);
+    if(tail - m_cached_head == m_capacity) {
+      m_cached_head = m_head.Load(Order::Acquire);
+      if(tail - m_cached_head == m_capacity)
+        return nullptr;
+    }
+    return m_data + (tail & (m_capacity - 1));
+  }
+
+  template <typename T>
+  void SpscQueue<T>::push() {
+    m_tail.Store(m_tail.Load(Order::Relaxed) + 1, Order::Release);
+  }
+
+  template <typename T>
+  T* SpscQueue<T>::front() {
+    const Size head = m_head.Load(Order::Relaxed);
+    if(head == m_cached_tail) {
+      m_cached_tail = m_tail.Load(Order::Acquire);
+      if(head == m_cached_tail)
+        return nullptr;
+    }
+    return m_data + (head & (m_capacity - 1));
+  }
+
+  template <typename T>
+  void SpscQueue<T>::pop() {
+    const Size head = m_head.Load(Order::Relaxed);
+    std::destroy_at(m_data + (head & (m_capacity - 1)));
+    m_head.Store(head + 1, Order::Release);
+  }
+}
+
+#endif // NTL_SPSC_QUEUE_HPP
@@ -0,0 +1,202 @@
+/**
+* @file ThreadPool.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "ThreadPool.hpp"
+
+#include <sched.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "core/Assert.hpp"
+
+namespace ntl {
+  namespace {
+    using Order = Atomic<Size>::MemoryOrder;
+
+    // the worker the current thread belongs to (if any)
+    thread_local const ThreadPool* t_pool = nullptr;
+    thread_local Size t_index = 0;
+  }
+
+  ThreadPool::ThreadPool(const Size a_threads)
+    : m_workers{nullptr}, m_starts{nullptr}, m_worker_count{a_threads}, m_sleep_lock{}, m_wake{&m_sleep_lock},
+      m_queued{0}, m_sleeping{0}, m_next{0}, m_stop{false} {
+    if (m_worker_count == 0) {
+      const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+      m_worker_count = processors > 0 ? static_cast<Size>(processors) : 1;
+    }
+
+    m_workers = new Worker[m_worker_count];
+    m_starts = new Start[m_worker_count];
+
+    for (Size i = 0; i < m_worker_count; ++i) {
+      m_starts[i] = Start{this, i};
+      const int result = pthread_create(&m_workers[i].thread, nullptr, &ThreadPool::workerMain, &m_starts[i]);
+      ENSURE(result == 0 && "Failed to create worker thread");
+    }
+  }
+
+  ThreadPool::~ThreadPool() {
+    m_sleep_lock.Acquire();
+    m_stop.Store(true);
+    m_wake.Broadcast();
+    m_sleep_lock.Release();
+
+    for (Size i = 0; i < m_worker_count; ++i)
+      pthread_join(m_workers[i].thread, nullptr);
+
+    for (Size i = 0; i < m_worker_count; ++i)
+      delete[] m_workers[i].tasks;
+
+    delete[] m_workers;
+    delete[] m_starts;
+  }
+
+  Size ThreadPool::GetThreadCount() const { return m_worker_count; }
+
+  void ThreadPool::Submit(const Task a_task) {
+    const Size index = t_pool == this ? t_index : m_next.FetchAdd(1, Order::Relaxed) % m_worker_count;
+    Worker& worker = m_workers[index];
+
+    worker.lock.Acquire();
+    if (worker.count == worker.capacity) {
+      const Size capacity = worker.capacity > 0 ? worker.capacity * 2 : 64;
+      auto* tasks = new Task[capacity];
+
+      // unroll the ring buffer into the new one
+      for (Size i = 0; i < worker.count; ++i)
+        tasks[i] = worker.tasks[(worker.head + i) % worker.capacity];
+
+      delete[] worker.tasks;
+      worker.tasks = tasks;
+      worker.capacity = capacity;
+      worker.head = 0;
+    }
+    worker.tasks[(worker.head + worker.count) % worker.capacity] = a_task;
+    worker.count++;
+    worker.lock.Release();
+
+    m_queued.FetchAdd(1);
+    wake();
+  }
+
+  bool ThreadPool::RunPending() {
+    Task task{};
+    if (!take(t_pool == this ? t_index : m_worker_count, task))
+      return false;
+
+    execute(task);
+    return true;
+  }
+
+  ThreadPool& ThreadPool::GetDefault() {
+    static ThreadPool pool{[] {
+      const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+      return processors > 1 ? static_cast<Size>(processors - 1) : Size{1};
+    }()};
+    return pool;
+  }
+
+  void* ThreadPool::workerMain(void* a_start) {
+    const auto* start = static_cast<Start*>(a_start);
+    ThreadPool& pool = *start->pool;
+
+    t_pool = &pool;
+    t_index = start->index;
+
+    Task task{};
+    while (true) {
+      if (pool.take(t_index, task)) {
+        execute(task);
+        continue;
+      }
+
+      pool.m_sleep_lock.Acquire();
+      pool.m_sleeping.FetchAdd(1);
+      while (pool.m_queued.Load() == 0 && !pool.m_stop.Load())
+        pool.m_wake.Wait();
+      pool.m_sleeping.FetchSub(1);
+      const bool stop = pool.m_stop.Load() && pool.m_queued.Load() == 0;
+      pool.m_sleep_lock.Release();
+
+      if (stop)
+        return nullptr;
+    }
+  }
+
+  bool ThreadPool::take(const Size a_index, Task& a_task) {
+    if (m_queued.Load(Order::Relaxed) == 0)
+      return false;
+
+    // own tasks are taken from the back
+    if (a_index < m_worker_count) {
+      Worker& worker = m_workers[a_index];
+      worker.lock.Acquire();
+      if (worker.count > 0) {
+        worker.count--;
+        a_task = worker.tasks[(worker.head + worker.count) % worker.capacity];
+        worker.lock.Release();
+        m_queued.FetchSub(1);
+        return true;
+      }
+      worker.lock.Release();
+    }
+
+    // tasks of other workers are stolen from the front
+    for (Size i = 1; i <= m_worker_count; ++i) {
+      Worker& victim = m_workers[(a_index + i) % m_worker_count];
+      if (!victim.lock.TryAcquire())
+        continue;
+
+      if (victim.count > 0) {
+        a_task = victim.tasks[victim.head];
+        victim.head = (victim.head + 1) % victim.capacity;
+        victim.count--;
+        victim.lock.Release();
+        m_queued.FetchSub(1);
+        return true;
+      }
+      victim.lock.Release();
+    }
+
+    return false;
+  }
+
+  void ThreadPool::execute(const Task& a_task) {
+    a_task.function(a_task.argument);
+
+    if (a_task.group)
+      a_task.group->m_pending.FetchSub(1, Order::Release);
+  }
+
+  void ThreadPool::wake() {
+    // the sleeping counter is raised before a worker checks the queue, so either it sees the task or we see it
+    if (m_sleeping.Load() == 0)
+      return;
+
+    m_sleep_lock.Acquire();
+    m_wake.Signal();
+    m_sleep_lock.Release();
+  }
+
+  TaskGroup::TaskGroup(ThreadPool& a_pool)
+    : m_pool{&a_pool}, m_pending{0} {
+    // Empty
+  }
+
+  TaskGroup::~TaskGroup() { Wait(); }
+
+  void TaskGroup::Wait() {
+    while (m_pending.Load(Order::Acquire) > 0) {
+      if (!m_pool->RunPending())
+        sched_yield();
+    }
+  }
+
+  ThreadPool& TaskGroup::GetPool() const { return *m_pool; }
+}
@@ -0,0 +1,237 @@
+/**
+* @file ThreadPool.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_THREAD_POOL_HPP
+#define NTL_THREAD_POOL_HPP
+
+#include <pthread.h>
+
+#include "data/Size.hpp"
+#include "os/Atomic.hpp"
+#include "os/Condition.hpp"
+#include "os/Lock.hpp"
+
+namespace ntl {
+  class TaskGroup;
+
+  /**
+   * @brief A pool of worker threads executing tasks using work-stealing.
+   *
+   * @details Every worker owns a deque of tasks. Tasks submitted by a worker are pushed onto its own
+   * deque and popped from the back again (newest first, which keeps the data hot in its cache), while
+   * idle workers steal from the front of the other deques (oldest first, which are usually the biggest
+   * pieces of work). Tasks submitted from other threads are distributed round-robin. Workers without
+   * work sleep on a condition until new tasks are submitted.
+   *
+   * Tasks are plain function pointers with an argument, so submitting doesn't allocate. Use a TaskGroup
+   * to wait for a set of tasks, which lets the waiting thread execute pending tasks in the meantime.
+   */
+  class ThreadPool {
+  friend class TaskGroup;
+
+  public:
+    struct Task {
+      void (*function)(void*);
+      void* argument;
+      TaskGroup* group;
+    };
+
+  private:
+    struct Worker {
+      Lock lock;
+      Task* tasks = nullptr;
+      Size capacity = 0;
+      Size head = 0;
+      Size count = 0;
+      pthread_t thread{};
+    };
+
+    struct Start {
+      ThreadPool* pool;
+      Size index;
+    };
+
+    Worker* m_workers;
+    Start* m_starts;
+    Size m_worker_count;
+
+    Lock m_sleep_lock;
+    Condition m_wake;
+    Atomic<Size> m_queued;
+    Atomic<Size> m_sleeping;
+    Atomic<Size> m_next;
+    Atomic<bool> m_stop;
+
+  public:
+    /**
+     * @brief Starts a pool with the given number of worker threads.
+     *
+     * @param a_threads the number of workers (0 to use one per available processor)
+     */
+    explicit ThreadPool(Size a_threads = 0);
+
+    /**
+     * @brief Finishes all queued tasks and joins the workers.
+     */
+    ~ThreadPool();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another pool
+     */
+    ThreadPool(const ThreadPool& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another pool
+     *
+     * @return the reference to the pool
+     */
+    ThreadPool& operator=(const ThreadPool& a_other) = delete;
+
+    /**
+     * @brief Gets the number of worker threads.
+     *
+     * @return the number of workers
+     */
+    [[nodiscard]] Size GetThreadCount() const;
+
+    /**
+     * @brief Queues a task for execution.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_task the task (the argument must stay valid until the task ran)
+     */
+    void Submit(Task a_task);
+
+    /**
+     * @brief Executes a single pending task on the calling thread, if there is one.
+     *
+     * @details Runtime: O(t), where t is the number of workers (plus the runtime of the task)
+     *
+     * @return if a task was executed
+     */
+    bool RunPending();
+
+    /**
+     * @brief Gets the pool shared by the library, which has one worker less than there
+     * are processors (the thread waiting for the results helps executing them).
+     *
+     * @return the reference to the default pool
+     */
+    static ThreadPool& GetDefault();
+
+  private:
+    /**
+     * @brief Entry point of the worker threads.
+     *
+     * @param a_start the Start of the worker
+     * @return nothing
+     */
+    static void* workerMain(void* a_start);
+
+    /**
+     * @brief Takes a task from the own deque (if any) or steals one from the others.
+     *
+     * @param a_index the index of the own worker (m_worker_count for other threads)
+     * @param a_task the taken task
+     * @return if a task was taken
+     */
+    bool take(Size a_index, Task& a_task);
+
+    /**
+     * @brief Executes the given task and notifies its group.
+     *
+     * @param a_task the task
+     */
+    static void execute(const Task& a_task);
+
+    /**
+     * @brief Wakes a sleeping worker, if there is one.
+     */
+    void wake();
+  };
+
+  /**
+   * @brief A set of tasks which can be waited for.
+   *
+   * @details Waiting executes other pending tasks of the pool instead of blocking,
+   * so groups can be nested (tasks can start and wait for groups of their own).
+   */
+  class TaskGroup {
+  friend class ThreadPool;
+
+  private:
+    ThreadPool* m_pool;
+    Atomic<Size> m_pending;
+
+  public:
+    /**
+     * @brief Creates a new group of tasks executed by the given pool.
+     *
+     * @param a_pool the pool
+     */
+    explicit TaskGroup(ThreadPool& a_pool = ThreadPool::GetDefault());
+
+    /**
+     * @brief Waits for all tasks of the group.
+     */
+    ~TaskGroup();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another group
+     */
+    TaskGroup(const TaskGroup& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another group
+     *
+     * @return the reference to the group
+     */
+    TaskGroup& operator=(const TaskGroup& a_other) = delete;
+
+    /**
+     * @brief Runs the given callable as a task of the group.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_function a callable without parameters (must stay valid until Wait returned)
+     */
+    template <typename Function>
+    void Run(Function& a_function);
+
+    /**
+     * @brief Waits until all tasks of the group have been executed.
+     *
+     * @details Executes pending tasks of the pool while waiting.
+     */
+    void Wait();
+
+    /**
+     * @brief Gets the pool executing the tasks of the group.
+     *
+     * @return the reference to the pool
+     */
+    [[nodiscard]] ThreadPool& GetPool() const;
+  };
+
+  template <typename Function>
+  void TaskGroup::Run(Function& a_function) {
+    m_pending.FetchAdd(1, Atomic<Size>::MemoryOrder::Relaxed);
+    m_pool->Submit(ThreadPool::Task{[](void* a_argument) { (*static_cast<Function*>(a_argument))(); },
+                                    static_cast<void*>(&a_function), this});
+  }
+}
+
+#endif // NTL_THREAD_POOL_HPP
@@ -0,0 +1,35 @@
+/**
+* @file Time.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Time.hpp"
+
+#include <algorithm>
+
+namespace ntl {
+  namespace time {
+    timespec ToTimespec(const Clock::duration a_duration) {
+      const auto nanoseconds = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(a_duration).count(),
+                                        std::chrono::nanoseconds::rep{0});
+
+      timespec result{};
+      result.tv_sec = static_cast<time_t>(nanoseconds / 1000000000);
+      result.tv_nsec = static_cast<long>(nanoseconds % 1000000000);
+      return result;
+    }
+
+    timespec ToTimespec(const Clock::time_point a_time_point) {
+      return ToTimespec(a_time_point.time_since_epoch());
+    }
+
+    Clock::time_point Deadline(const std::chrono::nanoseconds a_duration) {
+      const Clock::time_point now = Clock::now();
+      if(a_duration > Clock::time_point::max() - now)
+        return Clock::time_point::max();
+      return now + std::chrono::duration_cast<Clock::duration>(a_duration);
+    }
+  }
+}
@@ -0,0 +1,47 @@
+/**
+* @file Time.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_TIME_HPP
+#define NTL_TIME_HPP
+
+#include <chrono>
+#include <ctime>
+
+namespace ntl {
+  namespace time {
+    /**
+     * @brief The clock of all timed waits, which is never adjusted (CLOCK_MONOTONIC on Linux).
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Converts the given duration to a timespec.
+     *
+     * @param a_duration the duration (negative durations are clamped to zero)
+     * @return the timespec
+     */
+    timespec ToTimespec(Clock::duration a_duration);
+
+    /**
+     * @brief Converts the given point in time to a timespec relative to the epoch of the clock.
+     *
+     * @param a_time_point the point in time
+     * @return the timespec
+     */
+    timespec ToTimespec(Clock::time_point a_time_point);
+
+    /**
+     * @brief Gets the point in time after the given duration from now, saturating instead of overflowing.
+     *
+     * @param a_duration the duration
+     * @return the point in time
+     */
+    Clock::time_point Deadline(std::chrono::nanoseconds a_duration);
+  }
+}
+
+#endif // NTL_TIME_HPP
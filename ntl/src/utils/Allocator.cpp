@@ -0,0 +1,404 @@
+/**
+* @file Allocator.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Allocator.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+#include "os/Lock.hpp"
+#include "utils/Parallel.hpp"
+
+#ifdef NTL_PLATFORM_LINUX
+  #include <sys/syscall.h>
+
+  #ifndef MAP_HUGE_SHIFT
+    #define MAP_HUGE_SHIFT 26
+  #endif
+#endif
+
+namespace ntl {
+  namespace {
+    constexpr Size CLASS_COUNT = PoolAllocator::MAX_BLOCK_SIZE / PoolAllocator::GRANULARITY;
+
+    // a thread gives its blocks of a class to the shared lists once it caches this many
+    constexpr Size MAX_CACHED_BLOCKS = 2 * PoolAllocator::SLAB_SIZE / PoolAllocator::GRANULARITY;
+
+    struct FreeBlock {
+      FreeBlock* next;
+    };
+
+    struct Slab {
+      Slab* next;
+    };
+
+    struct SharedPool {
+      Lock lock;
+      FreeBlock* lists[CLASS_COUNT]{};
+      Slab* slabs = nullptr;
+    };
+
+    // never destroyed, so threads (and static containers) may still free blocks during shutdown
+    SharedPool& getSharedPool() {
+      static auto* pool = new SharedPool{};
+      return *pool;
+    }
+
+    // trivially destructible, so they can still be used after the flusher of the thread ran
+    thread_local FreeBlock* t_lists[CLASS_COUNT];
+    thread_local Size t_counts[CLASS_COUNT];
+    thread_local bool t_exited = false;
+
+    void pushShared(const Size a_class, FreeBlock* a_first, FreeBlock* a_last) {
+      SharedPool& pool = getSharedPool();
+      pool.lock.Acquire();
+      a_last->next = pool.lists[a_class];
+      pool.lists[a_class] = a_first;
+      pool.lock.Release();
+    }
+
+    void flushCache(const Size a_class) {
+      FreeBlock* first = t_lists[a_class];
+      if(!first)
+        return;
+
+      FreeBlock* last = first;
+      while(last->next)
+        last = last->next;
+
+      pushShared(a_class, first, last);
+      t_lists[a_class] = nullptr;
+      t_counts[a_class] = 0;
+    }
+
+    struct CacheFlusher {
+      ~CacheFlusher() {
+        for(Size i = 0; i < CLASS_COUNT; ++i)
+          flushCache(i);
+        t_exited = true;
+      }
+    };
+
+    thread_local CacheFlusher t_flusher;
+
+    FreeBlock* refill(const Size a_class) {
+      SharedPool& pool = getSharedPool();
+
+      // the blocks given back by other threads are taken first
+      pool.lock.Acquire();
+      FreeBlock* blocks = pool.lists[a_class];
+      pool.lists[a_class] = nullptr;
+      pool.lock.Release();
+
+      if(blocks)
+        return blocks;
+
+      const Size block_size = (a_class + 1) * PoolAllocator::GRANULARITY;
+      auto* memory = static_cast<char*>(::operator new(PoolAllocator::SLAB_SIZE));
+
+      // the slabs are linked to the shared pool, so they stay reachable
+      auto* slab = reinterpret_cast<Slab*>(memory);
+      pool.lock.Acquire();
+      slab->next = pool.slabs;
+      pool.slabs = slab;
+      pool.lock.Release();
+
+      // the first granule holds the slab link, the blocks follow
+      FreeBlock* first = nullptr;
+      for(Size i = (PoolAllocator::SLAB_SIZE - PoolAllocator::GRANULARITY) / block_size; i > 0; --i) {
+        auto* block = reinterpret_cast<FreeBlock*>(memory + PoolAllocator::GRANULARITY + (i - 1) * block_size);
+        block->next = first;
+        first = block;
+      }
+      return first;
+    }
+
+    Size sizeClass(const Size a_size) {
+      return (std::max(a_size, Size{1}) - 1) / PoolAllocator::GRANULARITY;
+    }
+
+    bool isPooled(const Size a_size, const Size a_alignment) {
+      return a_size <= PoolAllocator::MAX_BLOCK_SIZE && a_alignment <= PoolAllocator::GRANULARITY;
+    }
+
+    constexpr Size HUGE_PAGE_2MB = Size{1} << 21;
+    constexpr Size HUGE_PAGE_1GB = Size{1} << 30;
+
+    // pages faulted in by a single task of the pool
+    constexpr Size PAGES_PER_TOUCH = 512;
+
+    Size getBasePageSize() {
+      static const Size size = static_cast<Size>(::sysconf(_SC_PAGESIZE));
+      return size;
+    }
+
+    // the mapped length of a block, which stays the same if mapping huge pages fell back to base pages
+    Size getMappedSize(const Size a_size, const PageSize a_pages) {
+      Size granularity = getBasePageSize();
+      if(a_pages == PageSize::TRANSPARENT || a_pages == PageSize::HUGE_2MB)
+        granularity = HUGE_PAGE_2MB;
+      else if(a_pages == PageSize::HUGE_1GB)
+        granularity = HUGE_PAGE_1GB;
+      return (a_size + granularity - 1) / granularity * granularity;
+    }
+
+    void* mapHugePages(const Size a_length, const PageSize a_pages) {
+#ifdef NTL_PLATFORM_LINUX
+      const int shift = a_pages == PageSize::HUGE_1GB ? 30 : 21;
+      void* data = ::mmap(nullptr, a_length, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (shift << MAP_HUGE_SHIFT), -1, 0);
+      return data == MAP_FAILED ? nullptr : data;
+#else
+      static_cast<void>(a_length);
+      static_cast<void>(a_pages);
+      return nullptr;
+#endif
+    }
+
+    // maps base pages starting at a multiple of the alignment, so the kernel can merge them into huge pages
+    void* mapBasePages(const Size a_length, const Size a_alignment, const bool a_transparent) {
+      const Size padding = a_alignment > getBasePageSize() ? a_alignment : 0;
+      void* data = ::mmap(nullptr, a_length + padding, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      ENSURE(data != MAP_FAILED && "Failed to map memory")
+
+      auto* begin = static_cast<char*>(data);
+      if(padding > 0) {
+        const auto address = reinterpret_cast<std::uintptr_t>(begin);
+        const Size head = (a_alignment - address % a_alignment) % a_alignment;
+        if(head > 0)
+          ::munmap(begin, head);
+        if(padding > head)
+          ::munmap(begin + head + a_length, padding - head);
+        begin += head;
+      }
+
+#ifdef NTL_PLATFORM_LINUX
+      if(a_transparent)
+        ::madvise(begin, a_length, MADV_HUGEPAGE);
+#else
+      static_cast<void>(a_transparent);
+#endif
+      return begin;
+    }
+
+    void applyNumaPolicy(void* a_data, const Size a_length, const LargePagePolicy& a_policy) {
+#ifdef NTL_PLATFORM_LINUX
+      // MPOL_BIND and MPOL_INTERLEAVE of linux/mempolicy.h, called directly to not depend on libnuma
+      constexpr long BIND = 2;
+      constexpr long INTERLEAVE = 3;
+      if(a_policy.numa == NumaPolicy::LOCAL)
+        return;
+
+      const unsigned long nodes = a_policy.nodes;
+      const long mode = a_policy.numa == NumaPolicy::BIND ? BIND : INTERLEAVE;
+      // the result is ignored, without NUMA support the pages are simply placed locally
+      static_cast<void>(::syscall(SYS_mbind, a_data, a_length, mode, &nodes, sizeof(nodes) * 8 + 1, 0));
+#else
+      static_cast<void>(a_data);
+      static_cast<void>(a_length);
+      static_cast<void>(a_policy);
+#endif
+    }
+
+    void touchPages(void* a_data, const Size a_size) {
+      const Size page = getBasePageSize();
+      auto* bytes = static_cast<volatile char*>(a_data);
+      parallel::For(0, (a_size + page - 1) / page, [bytes, page](const Size a_from, const Size a_to) {
+        for(Size i = a_from; i < a_to; ++i)
+          bytes[i * page] = 0;
+      }, PAGES_PER_TOUCH);
+    }
+  }
+
+  // --------------
+  // POOL ALLOCATOR
+  // --------------
+
+  void* PoolAllocator::Allocate(const Size a_size, const Size a_alignment) {
+    if(!isPooled(a_size, a_alignment))
+      return DefaultAllocator{}.Allocate(a_size, a_alignment);
+
+    const Size size_class = sizeClass(a_size);
+
+    if(t_exited) {
+      FreeBlock* blocks = refill(size_class);
+      if(blocks->next) {
+        FreeBlock* last = blocks->next;
+        while(last->next)
+          last = last->next;
+        pushShared(size_class, blocks->next, last);
+      }
+      return blocks;
+    }
+
+    // registers the flusher of the thread
+    static_cast<void>(&t_flusher);
+
+    FreeBlock* block = t_lists[size_class];
+    if(!block) {
+      block = refill(size_class);
+      t_counts[size_class] = 0;
+      for(FreeBlock* curr = block; curr; curr = curr->next)
+        t_counts[size_class]++;
+    }
+
+    t_lists[size_class] = block->next;
+    t_counts[size_class]--;
+    return block;
+  }
+
+  void PoolAllocator::Deallocate(void* a_pointer, const Size a_size, const Size a_alignment) {
+    if(!a_pointer)
+      return;
+
+    if(!isPooled(a_size, a_alignment)) {
+      DefaultAllocator{}.Deallocate(a_pointer, a_size, a_alignment);
+      return;
+    }
+
+    const Size size_class = sizeClass(a_size);
+    auto* block = static_cast<FreeBlock*>(a_pointer);
+
+    if(t_exited) {
+      pushShared(size_class, block, block);
+      return;
+    }
+
+    block->next = t_lists[size_class];
+    t_lists[size_class] = block;
+
+    // threads which mostly free blocks of others don't hoard them
+    if(++t_counts[size_class] > MAX_CACHED_BLOCKS)
+      flushCache(size_class);
+  }
+
+  // --------------------
+  // LARGE PAGE ALLOCATOR
+  // --------------------
+
+  void* LargePageAllocator::Allocate(const Size a_size, const Size a_alignment) {
+    if(a_size < m_policy.threshold)
+      return DefaultAllocator{}.Allocate(a_size, a_alignment);
+
+    VERIFY(a_alignment <= getBasePageSize() && "Mapped blocks are aligned to pages")
+    const Size length = getMappedSize(a_size, m_policy.pages);
+
+    void* data = nullptr;
+    if(m_policy.pages == PageSize::HUGE_2MB || m_policy.pages == PageSize::HUGE_1GB)
+      data = mapHugePages(length, m_policy.pages);
+    if(!data)
+      data = mapBasePages(length, m_policy.pages == PageSize::SMALL ? getBasePageSize() : HUGE_PAGE_2MB,
+                          m_policy.pages != PageSize::SMALL);
+
+    // the policy only applies to pages which weren't touched yet
+    applyNumaPolicy(data, length, m_policy);
+    if(m_policy.parallel_touch && a_size >= memory::PARALLEL_TOUCH_SIZE)
+      touchPages(data, a_size);
+
+    return data;
+  }
+
+  void LargePageAllocator::Deallocate(void* a_pointer, const Size a_size, const Size a_alignment) {
+    if(!a_pointer)
+      return;
+
+    if(a_size < m_policy.threshold) {
+      DefaultAllocator{}.Deallocate(a_pointer, a_size, a_alignment);
+      return;
+    }
+
+    ::munmap(a_pointer, getMappedSize(a_size, m_policy.pages));
+  }
+
+  // -----
+  // ARENA
+  // -----
+
+  Arena::Arena(const Size a_block_size)
+    : m_blocks{nullptr}, m_current{nullptr}, m_end{nullptr}, m_block_size{std::max(a_block_size, Size{256})},
+      m_allocated{0} {
+    // Empty
+  }
+
+  Arena::~Arena() {
+    while(m_blocks) {
+      Block* previous = m_blocks->previous;
+      ::operator delete(static_cast<void*>(m_blocks), m_blocks->size);
+      m_blocks = previous;
+    }
+  }
+
+  void* Arena::Allocate(const Size a_size, const Size a_alignment) {
+    VERIFY(std::has_single_bit(a_alignment))
+
+    auto address = reinterpret_cast<std::uintptr_t>(m_current);
+    Size padding = (a_alignment - address % a_alignment) % a_alignment;
+
+    if(!m_current || static_cast<Size>(m_end - m_current) < padding + a_size) {
+      grow(a_size, a_alignment);
+      address = reinterpret_cast<std::uintptr_t>(m_current);
+      padding = (a_alignment - address % a_alignment) % a_alignment;
+    }
+
+    void* result = m_current + padding;
+    m_current += padding + a_size;
+    m_allocated += a_size;
+    return result;
+  }
+
+  void Arena::Deallocate(void* a_pointer, const Size a_size) {
+    // only the most recent allocation can be given back by rewinding
+    if(static_cast<char*>(a_pointer) + a_size == m_current) {
+      m_current = static_cast<char*>(a_pointer);
+      m_allocated -= a_size;
+    }
+  }
+
+  void Arena::Reset() {
+    if(!m_blocks)
+      return;
+
+    // keep the biggest block, which is always the most recent one
+    Block* keep = m_blocks;
+    Block* curr = keep->previous;
+    while(curr) {
+      Block* previous = curr->previous;
+      ::operator delete(static_cast<void*>(curr), curr->size);
+      curr = previous;
+    }
+
+    keep->previous = nullptr;
+    m_blocks = keep;
+    m_current = reinterpret_cast<char*>(keep) + sizeof(Block);
+    m_end = reinterpret_cast<char*>(keep) + keep->size;
+    m_allocated = 0;
+  }
+
+  Size Arena::GetAllocatedSize() const {
+    return m_allocated;
+  }
+
+  void Arena::grow(const Size a_size, const Size a_alignment) {
+    const Size needed = sizeof(Block) + a_size + a_alignment;
+    Size size = m_blocks ? std::min(m_blocks->size * 2, MAX_BLOCK_SIZE) : m_block_size;
+    size = std::max(size, needed);
+
+    auto* block = static_cast<Block*>(::operator new(size));
+    block->previous = m_blocks;
+    block->size = size;
+
+    m_blocks = block;
+    m_current = reinterpret_cast<char*>(block) + sizeof(Block);
+    m_end = reinterpret_cast<char*>(block) + size;
+  }
+}
@@ -0,0 +1,370 @@
+/**
+* @file Allocator.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_ALLOCATOR_UTILS_HPP
+#define NTL_ALLOCATOR_UTILS_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <new>
+
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+
+namespace ntl {
+  /**
+   * @brief Allocators hand out untyped blocks of memory, which the containers construct their elements in.
+   *
+   * @details Allocators are copied into the containers using them, so stateful allocators should be
+   * handles to a shared resource (like ArenaAllocator) and compare equal if they share it.
+   */
+  template <typename A>
+  concept is_allocator = std::copy_constructible<A> && requires(A& a_allocator, void* a_pointer, Size a_size) {
+    { a_allocator.Allocate(a_size, a_size) } -> std::same_as<void*>;
+    a_allocator.Deallocate(a_pointer, a_size, a_size);
+  };
+
+  /**
+   * @brief Allocator using the global operator new and delete.
+   */
+  struct DefaultAllocator {
+    /**
+     * @brief Allocates a block of memory.
+     *
+     * @param a_size the size of the block in bytes
+     * @param a_alignment the alignment of the block
+     * @return the block
+     */
+    void* Allocate(const Size a_size, const Size a_alignment) {
+      if(a_alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        return ::operator new(a_size, std::align_val_t{a_alignment});
+      return ::operator new(a_size);
+    }
+
+    /**
+     * @brief Frees a block of memory allocated by this allocator.
+     *
+     * @param a_pointer the block
+     * @param a_size the size of the block in bytes
+     * @param a_alignment the alignment of the block
+     */
+    void Deallocate(void* a_pointer, const Size a_size, const Size a_alignment) {
+      if(a_alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        ::operator delete(a_pointer, a_size, std::align_val_t{a_alignment});
+      else
+        ::operator delete(a_pointer, a_size);
+    }
+
+    bool operator==(const DefaultAllocator&) const = default;
+  };
+
+  /**
+   * @brief Allocator recycling small blocks through per-thread free lists, which are refilled from slabs.
+   *
+   * @details Blocks of up to MAX_BLOCK_SIZE bytes are rounded up to a multiple of GRANULARITY and
+   * taken from the free list of the calling thread, so allocating and freeing nodes usually takes a
+   * few instructions and no lock. Empty free lists are refilled from the blocks other (exited) threads
+   * gave back or by cutting a new slab of SLAB_SIZE bytes into blocks. Slabs are kept for the lifetime
+   * of the process and their blocks may move between threads. Bigger or over-aligned blocks use the
+   * DefaultAllocator.
+   */
+  struct PoolAllocator {
+    static constexpr Size GRANULARITY = 16;
+    static constexpr Size MAX_BLOCK_SIZE = 256;
+    static constexpr Size SLAB_SIZE = 64 * 1024;
+
+    /**
+     * @brief Allocates a block of memory.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_size the size of the block in bytes
+     * @param a_alignment the alignment of the block
+     * @return the block
+     */
+    void* Allocate(Size a_size, Size a_alignment);
+
+    /**
+     * @brief Frees a block of memory allocated by this allocator.
+     *
+     * @details Runtime: O(1) (amortized)
+     *
+     * @param a_pointer the block
+     * @param a_size the size of the block in bytes
+     * @param a_alignment the alignment of the block
+     */
+    void Deallocate(void* a_pointer, Size a_size, Size a_alignment);
+
+    bool operator==(const PoolAllocator&) const = default;
+  };
+
+  /**
+   * @brief A region of memory handing out blocks by bumping a pointer, which are all freed at once.
+   *
+   * @details The memory is allocated in blocks growing geometrically up to MAX_BLOCK_SIZE. Freeing
+   * single allocations only gives back the most recent one, everything else is freed by Reset or the
+   * destructor, so containers built in an arena can be thrown away together without visiting them
+   * (their elements must be trivially destructible or destroyed before).
+   *
+   * Use ArenaAllocator to let containers allocate from an arena.
+   */
+  class Arena {
+  private:
+    struct Block {
+      Block* previous;
+      Size size;
+    };
+
+    Block* m_blocks;
+    char* m_current;
+    char* m_end;
+    Size m_block_size;
+    Size m_allocated;
+
+  public:
+    static constexpr Size DEFAULT_BLOCK_SIZE = 64 * 1024;
+    static constexpr Size MAX_BLOCK_SIZE = 16 * 1024 * 1024;
+
+    /**
+     * @brief Constructs a new arena.
+     *
+     * @param a_block_size the size of the first block in bytes (allocated on the first use)
+     */
+    explicit Arena(Size a_block_size = DEFAULT_BLOCK_SIZE);
+
+    /**
+     * @brief Frees all blocks of the arena.
+     */
+    ~Arena();
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another arena
+     */
+    Arena(const Arena& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another arena
+     *
+     * @return the reference to the arena
+     */
+    Arena& operator=(const Arena& a_other) = delete;
+
+    /**
+     * @brief Allocates a block of memory.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_size the size of the block in bytes
+     * @param a_alignment the alignment of the block
+     * @return the block
+     */
+    void* Allocate(Size a_size, Size a_alignment);
+
+    /**
+     * @brief Frees a block of memory, which only has an effect for the most recent allocation.
+     *
+     * @details Runtime: O(1)
+     *
+     * @param a_pointer the block
+     * @param a_size the size of the block in bytes
+     */
+    void Deallocate(void* a_pointer, Size a_size);
+
+    /**
+     * @brief Frees all allocations at once. The biggest block is kept for reuse.
+     *
+     * @details Runtime: O(b), where b is the number of blocks
+     */
+    void Reset();
+
+    /**
+     * @brief Gets the number of bytes handed out since the last reset.
+     *
+     * @return the allocated bytes
+     */
+    [[nodiscard]] Size GetAllocatedSize() const;
+
+  private:
+    /**
+     * @brief Allocates a new block, which is big enough for the given allocation.
+     *
+     * @param a_size the size of the allocation in bytes
+     * @param a_alignment the alignment of the allocation
+     */
+    void grow(Size a_size, Size a_alignment);
+  };
+
+  /**
+   * @brief Allocator handing out the memory of an arena, which must outlive the containers using it.
+   */
+  class ArenaAllocator {
+  private:
+    Arena* m_arena;
+
+  public:
+    /**
+     * @brief Constructs a new allocator for the given arena.
+     *
+     * @param a_arena the arena
+     */
+    explicit ArenaAllocator(Arena& a_arena) : m_arena{&a_arena} {}
+
+    /**
+     * @brief Allocates a block of memory from the arena.
+     *
+     * @param a_size the size of the block in bytes
+     * @param a_alignment the alignment of the block
+     * @return the block
+     */
+    void* Allocate(const Size a_size, const Size a_alignment) { return m_arena->Allocate(a_size, a_alignment); }
+
+    /**
+     * @brief Frees a block of memory of the arena (see Arena::Deallocate).
+     *
+     * @param a_pointer the block
+     * @param a_size the size of the block in bytes
+     */
+    void Deallocate(void* a_pointer, const Size a_size, Size) { m_arena->Deallocate(a_pointer, a_size); }
+
+    /**
+     * @brief Gets the arena of the allocator.
+     *
+     * @return the reference to the arena
+     */
+    [[nodiscard]] Arena& GetArena() const { return *m_arena; }
+
+    bool operator==(const ArenaAllocator&) const = default;
+  };
+
+  /**
+   * @brief The pages a LargePageAllocator maps its blocks with.
+   */
+  enum class PageSize : U8 {
+    SMALL,        // the base pages of the system (usually 4 KiB)
+    TRANSPARENT,  // base pages, which the kernel is asked to merge into 2 MiB pages (transparent huge pages)
+    HUGE_2MB,     // reserved 2 MiB pages, falling back to TRANSPARENT if the system has none left
+    HUGE_1GB      // reserved 1 GiB pages, falling back to TRANSPARENT if the system has none left
+  };
+
+  /**
+   * @brief The NUMA nodes the pages of a LargePageAllocator are placed on.
+   */
+  enum class NumaPolicy : U8 {
+    LOCAL,        // the node of the thread touching a page first
+    BIND,         // only the nodes of the mask
+    INTERLEAVE    // round-robin over the nodes of the mask
+  };
+
+  /**
+   * @brief Configures how a LargePageAllocator maps its blocks.
+   */
+  struct LargePagePolicy {
+    PageSize pages = PageSize::TRANSPARENT;
+    NumaPolicy numa = NumaPolicy::LOCAL;
+    U64 nodes = ~U64{0};              // the nodes used by BIND and INTERLEAVE (bit i for node i)
+    bool parallel_touch = true;       // fault in blocks of at least memory::PARALLEL_TOUCH_SIZE by the default pool
+    Size threshold = 2 * 1024 * 1024; // smaller blocks are allocated by the DefaultAllocator
+
+    bool operator==(const LargePagePolicy&) const = default;
+  };
+
+  /**
+   * @brief Allocator mapping big blocks directly from the system, backed by huge pages and placed on NUMA nodes.
+   *
+   * @details Tables of many gigabytes on base pages need a TLB entry per 4 KiB, so nearly every random
+   * access misses the TLB. Blocks of at least the threshold of the policy are mapped on their own, using
+   * (transparent) huge pages, and get the NUMA policy applied before any page is touched. Only then the
+   * pages are faulted in, by the threads of the default pool if parallel_touch is set: the kernel zeroes
+   * them in parallel and, with the LOCAL policy, places them on the nodes of the threads which will
+   * process the table in parallel later on. Smaller blocks use the DefaultAllocator.
+   *
+   * Huge pages and NUMA policies are only applied on Linux, other systems map base pages.
+   * The NUMA policy is a hint, it is silently ignored if the system doesn't support it.
+   */
+  class LargePageAllocator {
+  private:
+    LargePagePolicy m_policy;
+
+  public:
+    /**
+     * @brief Constructs a new allocator using the given policy.
+     *
+     * @param a_policy the policy
+     */
+    explicit LargePageAllocator(const LargePagePolicy& a_policy = LargePagePolicy{}) : m_policy{a_policy} {}
+
+    /**
+     * @brief Allocates a block of memory.
+     *
+     * @details Runtime: O(n / t) for mapped blocks, where n is the number of pages and t the number of threads
+     * touching them, O(1) otherwise
+     *
+     * @param a_size the size of the block in bytes
+     * @param a_alignment the alignment of the block (at most the page size for mapped blocks)
+     * @return the block
+     */
+    void* Allocate(Size a_size, Size a_alignment);
+
+    /**
+     * @brief Frees a block of memory allocated by this allocator.
+     *
+     * @param a_pointer the block
+     * @param a_size the size of the block in bytes
+     * @param a_alignment the alignment of the block
+     */
+    void Deallocate(void* a_pointer, Size a_size, Size a_alignment);
+
+    /**
+     * @brief Gets the policy of the allocator.
+     *
+     * @return the policy
+     */
+    [[nodiscard]] const LargePagePolicy& GetPolicy() const { return m_policy; }
+
+    bool operator==(const LargePageAllocator&) const = default;
+  };
+
+  namespace memory {
+    /**
+     * @brief Blocks of at least this many bytes are initialized by the threads of a pool.
+     */
+    constexpr Size PARALLEL_TOUCH_SIZE = 16 * 1024 * 1024;
+
+    /**
+     * @brief Allocates uninitialized memory for the given number of objects.
+     *
+     * @param a_allocator the allocator to use
+     * @param a_count the number of objects
+     * @return the memory (nullptr if the count is 0)
+     */
+    template <typename T, is_allocator Allocator>
+    T* Allocate(Allocator& a_allocator, const Size a_count) {
+      if(a_count == 0)
+        return nullptr;
+      return static_cast<T*>(a_allocator.Allocate(a_count * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * @brief Frees memory allocated by Allocate (the objects must be destroyed already).
+     *
+     * @param a_allocator the allocator used for the allocation
+     * @param a_pointer the memory
+     * @param a_count the number of objects
+     */
+    template <typename T, is_allocator Allocator>
+    void Deallocate(Allocator& a_allocator, T* a_pointer, const Size a_count) {
+      if(a_pointer)
+        a_allocator.Deallocate(static_cast<void*>(a_pointer), a_count * sizeof(T), alignof(T));
+    }
+  }
+}
+
+#endif // NTL_ALLOCATOR_UTILS_HPP
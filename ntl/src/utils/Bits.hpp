@@ -0,0 +1,260 @@
+/**
+* @file Bits.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_BITS_UTILS_HPP
+#define NTL_BITS_UTILS_HPP
+
+#include <bit>
+
+#include "core/Platform.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+
+#if defined(NTL_SIMD_AVX2)
+  #include <immintrin.h>
+#elif defined(NTL_SIMD_NEON)
+  #include <arm_neon.h>
+#endif
+
+/**
+ * @brief Kernels operating on arrays of 64-bit words. Every kernel has a scalar tail,
+ * so the word count doesn't need to be a multiple of the vector width.
+ */
+namespace ntl::bits {
+  /**
+   * @brief The number of bits stored in a single word.
+   */
+  constexpr Size WORD_BITS = 64;
+
+  /**
+   * @brief Gets the number of words needed to store the given number of bits.
+   *
+   * @param a_bits the number of bits
+   * @return the number of words
+   */
+  constexpr Size WordCount(const Size a_bits) {
+    return (a_bits + WORD_BITS - 1) / WORD_BITS;
+  }
+
+  /**
+   * @brief Gets the mask of the bits in use within the last word.
+   *
+   * @param a_bits the number of bits
+   * @return the mask of the used bits in the last word
+   */
+  constexpr U64 TailMask(const Size a_bits) {
+    return (a_bits % WORD_BITS == 0) ? ~U64{0} : ((U64{1} << (a_bits % WORD_BITS)) - 1);
+  }
+
+  /**
+   * @brief Computes a_dst[i] = a_left[i] & a_right[i].
+   *
+   * @details Runtime: O(n), where n is the number of words
+   */
+  inline void And(U64* a_dst, const U64* a_left, const U64* a_right, const Size a_count) {
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    for(; i + 4 <= a_count; i += 4) {
+      const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_left + i));
+      const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_right + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(a_dst + i), _mm256_and_si256(left, right));
+    }
+#elif defined(NTL_SIMD_NEON)
+    for(; i + 2 <= a_count; i += 2)
+      vst1q_u64(a_dst + i, vandq_u64(vld1q_u64(a_left + i), vld1q_u64(a_right + i)));
+#endif
+    for(; i < a_count; ++i)
+      a_dst[i] = a_left[i] & a_right[i];
+  }
+
+  /**
+   * @brief Computes a_dst[i] = a_left[i] | a_right[i].
+   *
+   * @details Runtime: O(n), where n is the number of words
+   */
+  inline void Or(U64* a_dst, const U64* a_left, const U64* a_right, const Size a_count) {
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    for(; i + 4 <= a_count; i += 4) {
+      const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_left + i));
+      const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_right + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(a_dst + i), _mm256_or_si256(left, right));
+    }
+#elif defined(NTL_SIMD_NEON)
+    for(; i + 2 <= a_count; i += 2)
+      vst1q_u64(a_dst + i, vorrq_u64(vld1q_u64(a_left + i), vld1q_u64(a_right + i)));
+#endif
+    for(; i < a_count; ++i)
+      a_dst[i] = a_left[i] | a_right[i];
+  }
+
+  /**
+   * @brief Computes a_dst[i] = a_left[i] ^ a_right[i].
+   *
+   * @details Runtime: O(n), where n is the number of words
+   */
+  inline void Xor(U64* a_dst, const U64* a_left, const U64* a_right, const Size a_count) {
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    for(; i + 4 <= a_count; i += 4) {
+      const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_left + i));
+      const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_right + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(a_dst + i), _mm256_xor_si256(left, right));
+    }
+#elif defined(NTL_SIMD_NEON)
+    for(; i + 2 <= a_count; i += 2)
+      vst1q_u64(a_dst + i, veorq_u64(vld1q_u64(a_left + i), vld1q_u64(a_right + i)));
+#endif
+    for(; i < a_count; ++i)
+      a_dst[i] = a_left[i] ^ a_right[i];
+  }
+
+  /**
+   * @brief Computes a_dst[i] = ~a_src[i].
+   *
+   * @details Runtime: O(n), where n is the number of words
+   *
+   * @note The caller is responsible for clearing the unused bits of the last word.
+   */
+  inline void Not(U64* a_dst, const U64* a_src, const Size a_count) {
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    const __m256i ones = _mm256_set1_epi64x(-1);
+    for(; i + 4 <= a_count; i += 4) {
+      const __m256i src = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_src + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(a_dst + i), _mm256_xor_si256(src, ones));
+    }
+#elif defined(NTL_SIMD_NEON)
+    for(; i + 2 <= a_count; i += 2)
+      vst1q_u64(a_dst + i, vreinterpretq_u64_u8(vmvnq_u8(vreinterpretq_u8_u64(vld1q_u64(a_src + i)))));
+#endif
+    for(; i < a_count; ++i)
+      a_dst[i] = ~a_src[i];
+  }
+
+  /**
+   * @brief Counts the set bits in the given words.
+   *
+   * @details Runtime: O(n), where n is the number of words
+   *
+   * @note The AVX2 path uses the nibble lookup (vpshufb) + vpsadbw population count.
+   */
+  inline Size PopCount(const U64* a_words, const Size a_count) {
+    Size i = 0, result = 0;
+#if defined(NTL_SIMD_AVX2)
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i total = _mm256_setzero_si256();
+    for(; i + 4 <= a_count; i += 4) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_words + i));
+      const __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low_mask));
+      const __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask));
+      total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+    result += static_cast<Size>(_mm256_extract_epi64(total, 0)) + static_cast<Size>(_mm256_extract_epi64(total, 1)) +
+              static_cast<Size>(_mm256_extract_epi64(total, 2)) + static_cast<Size>(_mm256_extract_epi64(total, 3));
+#elif defined(NTL_SIMD_NEON)
+    for(; i + 2 <= a_count; i += 2)
+      result += vaddvq_u8(vcntq_u8(vreinterpretq_u8_u64(vld1q_u64(a_words + i))));
+#endif
+    for(; i < a_count; ++i)
+      result += static_cast<Size>(std::popcount(a_words[i]));
+    return result;
+  }
+
+  /**
+   * @brief Checks if any bit is set in the given words.
+   *
+   * @details Runtime: O(n), where n is the number of words
+   */
+  inline bool Any(const U64* a_words, const Size a_count) {
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    for(; i + 4 <= a_count; i += 4) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_words + i));
+      if(!_mm256_testz_si256(v, v))
+        return true;
+    }
+#elif defined(NTL_SIMD_NEON)
+    for(; i + 2 <= a_count; i += 2) {
+      if(vmaxvq_u32(vreinterpretq_u32_u64(vld1q_u64(a_words + i))) != 0)
+        return true;
+    }
+#endif
+    for(; i < a_count; ++i) {
+      if(a_words[i])
+        return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Finds the first set bit at or after the given bit index.
+   *
+   * @details Runtime: O(n), where n is the number of words
+   *
+   * @param a_words the words to search
+   * @param a_count the number of words
+   * @param a_from the bit index to start searching from
+   * @return the index of the first set bit (-1 if not found)
+   */
+  inline I64 FindFirstSet(const U64* a_words, const Size a_count, const Size a_from = 0) {
+    Size i = a_from / WORD_BITS;
+    if(i >= a_count)
+      return -1;
+
+    // handle the partial first word, then whole words
+    const U64 first = a_words[i] & (~U64{0} << (a_from % WORD_BITS));
+    if(first)
+      return static_cast<I64>(i * WORD_BITS + std::countr_zero(first));
+    i++;
+
+#if defined(NTL_SIMD_AVX2)
+    for(; i + 4 <= a_count; i += 4) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_words + i));
+      if(!_mm256_testz_si256(v, v))
+        break;
+    }
+#elif defined(NTL_SIMD_NEON)
+    for(; i + 2 <= a_count; i += 2) {
+      if(vmaxvq_u32(vreinterpretq_u32_u64(vld1q_u64(a_words + i))) != 0)
+        break;
+    }
+#endif
+    for(; i < a_count; ++i) {
+      if(a_words[i])
+        return static_cast<I64>(i * WORD_BITS + std::countr_zero(a_words[i]));
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Checks if two word arrays are equal.
+   *
+   * @details Runtime: O(n), where n is the number of words
+   */
+  inline bool Equal(const U64* a_left, const U64* a_right, const Size a_count) {
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    for(; i + 4 <= a_count; i += 4) {
+      const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_left + i));
+      const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_right + i));
+      const __m256i diff = _mm256_xor_si256(left, right);
+      if(!_mm256_testz_si256(diff, diff))
+        return false;
+    }
+#endif
+    for(; i < a_count; ++i) {
+      if(a_left[i] != a_right[i])
+        return false;
+    }
+    return true;
+  }
+}
+
+#endif // NTL_BITS_UTILS_HPP
@@ -0,0 +1,36 @@
+/**
+* @file CacheAligned.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_CACHE_ALIGNED_UTILS_HPP
+#define NTL_CACHE_ALIGNED_UTILS_HPP
+
+#include "core/Platform.hpp"
+
+namespace ntl {
+  /**
+   * @brief Wraps a value into a cache line of its own.
+   *
+   * @details The wrapper is aligned to and padded up to a multiple of NTL_CACHE_LINE_SIZE, so values
+   * written by different threads (e.g. the elements of an array of per-thread state) never share a
+   * cache line and don't invalidate each other. It is an aggregate, so CacheAligned<T>{...}
+   * initializes the value directly.
+   *
+   * @tparam T the type of the value
+   */
+  template <typename T>
+  struct alignas(NTL_CACHE_LINE_SIZE) CacheAligned {
+    T value;
+
+    T& operator*() { return value; }
+    const T& operator*() const { return value; }
+
+    T* operator->() { return &value; }
+    const T* operator->() const { return &value; }
+  };
+}
+
+#endif // NTL_CACHE_ALIGNED_UTILS_HPP
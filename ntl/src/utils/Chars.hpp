@@ -0,0 +1,232 @@
+/**
+* @file Chars.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_CHARS_UTILS_HPP
+#define NTL_CHARS_UTILS_HPP
+
+#include <bit>
+#include <cstring>
+
+#include "core/Platform.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+
+#if defined(NTL_SIMD_AVX2)
+  #include <immintrin.h>
+#elif defined(NTL_SIMD_SSE2)
+  #include <emmintrin.h>
+#elif defined(NTL_SIMD_NEON)
+  #include <arm_neon.h>
+#endif
+
+/**
+ * @brief Kernels operating on arrays of characters. Every kernel has a scalar tail,
+ * so the length doesn't need to be a multiple of the vector width.
+ */
+namespace ntl::chars {
+  /**
+   * @brief Index returned by the search kernels if nothing was found.
+   */
+  constexpr Size NPOS = static_cast<Size>(-1);
+
+  /**
+   * @brief Gets the index of the first position at which the given characters differ.
+   *
+   * @details Runtime: O(n), where n is the number of characters
+   *
+   * @return the index of the first difference (a_count if all characters are equal)
+   */
+  inline Size Mismatch(const char* a_left, const char* a_right, const Size a_count) {
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    for(; i + 32 <= a_count; i += 32) {
+      const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_left + i));
+      const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_right + i));
+      const U32 equal = static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right)));
+      if(equal != 0xffffffffu)
+        return i + std::countr_one(equal);
+    }
+#elif defined(NTL_SIMD_SSE2)
+    for(; i + 16 <= a_count; i += 16) {
+      const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_left + i));
+      const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_right + i));
+      const U32 equal = static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(left, right)));
+      if(equal != 0xffffu)
+        return i + std::countr_one(equal);
+    }
+#endif
+    for(; i < a_count; ++i) {
+      if(a_left[i] != a_right[i])
+        return i;
+    }
+    return a_count;
+  }
+
+  /**
+   * @brief Checks if the given characters are equal.
+   *
+   * @details Runtime: O(n), where n is the number of characters
+   */
+  inline bool Equal(const char* a_left, const char* a_right, const Size a_count) {
+    return Mismatch(a_left, a_right, a_count) == a_count;
+  }
+
+  /**
+   * @brief Compares the given character sequences lexicographically (as unsigned chars, like strcmp).
+   *
+   * @details Runtime: O(n), where n is the length of the shorter sequence
+   *
+   * @return a negative value if the left sequence is smaller, zero if they are equal and a positive value otherwise
+   */
+  inline int Compare(const char* a_left, const Size a_left_length, const char* a_right, const Size a_right_length) {
+    const Size length = a_left_length < a_right_length ? a_left_length : a_right_length;
+    const Size index = Mismatch(a_left, a_right, length);
+
+    if(index < length)
+      return static_cast<unsigned char>(a_left[index]) < static_cast<unsigned char>(a_right[index]) ? -1 : 1;
+
+    return a_left_length < a_right_length ? -1 : (a_left_length > a_right_length ? 1 : 0);
+  }
+
+  /**
+   * @brief Searches the first occurrence of a needle in a haystack.
+   *
+   * @details Runtime: O(n * m), where n is the length of the haystack and m the length of the needle
+   *
+   * @note The vector paths compare the first and the last character of the needle against a whole
+   * block of candidate positions at once and only verify the remaining characters of the matches.
+   *
+   * @return the index of the needle (NPOS if not found, 0 for an empty needle)
+   */
+  inline Size Find(const char* a_haystack, const Size a_length, const char* a_needle, const Size a_needle_length) {
+    if(a_needle_length == 0)
+      return 0;
+    if(a_needle_length > a_length)
+      return NPOS;
+    if(a_needle_length == 1) {
+      const void* found = std::memchr(a_haystack, a_needle[0], a_length);
+      return found ? static_cast<Size>(static_cast<const char*>(found) - a_haystack) : NPOS;
+    }
+
+    const Size last = a_needle_length - 1;
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    const __m256i first_char = _mm256_set1_epi8(a_needle[0]);
+    const __m256i last_char = _mm256_set1_epi8(a_needle[last]);
+    for(; i + last + 32 <= a_length; i += 32) {
+      const __m256i first_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_haystack + i));
+      const __m256i last_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_haystack + i + last));
+      U32 mask = static_cast<U32>(_mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(first_char, first_block), _mm256_cmpeq_epi8(last_char, last_block))));
+
+      for(; mask != 0; mask &= mask - 1) {
+        const Size candidate = i + std::countr_zero(mask);
+        if(std::memcmp(a_haystack + candidate + 1, a_needle + 1, last - 1) == 0)
+          return candidate;
+      }
+    }
+#elif defined(NTL_SIMD_SSE2)
+    const __m128i first_char = _mm_set1_epi8(a_needle[0]);
+    const __m128i last_char = _mm_set1_epi8(a_needle[last]);
+    for(; i + last + 16 <= a_length; i += 16) {
+      const __m128i first_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_haystack + i));
+      const __m128i last_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_haystack + i + last));
+      U32 mask = static_cast<U32>(_mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(first_char, first_block), _mm_cmpeq_epi8(last_char, last_block))));
+
+      for(; mask != 0; mask &= mask - 1) {
+        const Size candidate = i + std::countr_zero(mask);
+        if(std::memcmp(a_haystack + candidate + 1, a_needle + 1, last - 1) == 0)
+          return candidate;
+      }
+    }
+#endif
+    for(; i + last < a_length; ++i) {
+      // jump to the next candidate with memchr, then compare the rest
+      const void* found = std::memchr(a_haystack + i, a_needle[0], a_length - last - i);
+      if(!found)
+        return NPOS;
+
+      i = static_cast<Size>(static_cast<const char*>(found) - a_haystack);
+      if(a_haystack[i + last] == a_needle[last] && std::memcmp(a_haystack + i + 1, a_needle + 1, last - 1) == 0)
+        return i;
+    }
+    return NPOS;
+  }
+
+  /**
+   * @brief Converts the ASCII letters of the given characters to lower case in place.
+   *
+   * @details Runtime: O(n), where n is the number of characters
+   */
+  inline void ToLower(char* a_data, const Size a_count) {
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    const __m256i above = _mm256_set1_epi8('A' - 1), below = _mm256_set1_epi8('Z' + 1), bit = _mm256_set1_epi8(0x20);
+    for(; i + 32 <= a_count; i += 32) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_data + i));
+      const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(v, above), _mm256_cmpgt_epi8(below, v));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(a_data + i), _mm256_or_si256(v, _mm256_and_si256(upper, bit)));
+    }
+#elif defined(NTL_SIMD_SSE2)
+    const __m128i above = _mm_set1_epi8('A' - 1), below = _mm_set1_epi8('Z' + 1), bit = _mm_set1_epi8(0x20);
+    for(; i + 16 <= a_count; i += 16) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_data + i));
+      const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, above), _mm_cmpgt_epi8(below, v));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(a_data + i), _mm_or_si128(v, _mm_and_si128(upper, bit)));
+    }
+#elif defined(NTL_SIMD_NEON)
+    const uint8x16_t first = vdupq_n_u8('A'), range = vdupq_n_u8('Z' - 'A'), bit = vdupq_n_u8(0x20);
+    for(; i + 16 <= a_count; i += 16) {
+      const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(a_data + i));
+      const uint8x16_t upper = vcleq_u8(vsubq_u8(v, first), range);
+      vst1q_u8(reinterpret_cast<uint8_t*>(a_data + i), vorrq_u8(v, vandq_u8(upper, bit)));
+    }
+#endif
+    for(; i < a_count; ++i) {
+      if(a_data[i] >= 'A' && a_data[i] <= 'Z')
+        a_data[i] = static_cast<char>(a_data[i] | 0x20);
+    }
+  }
+
+  /**
+   * @brief Converts the ASCII letters of the given characters to upper case in place.
+   *
+   * @details Runtime: O(n), where n is the number of characters
+   */
+  inline void ToUpper(char* a_data, const Size a_count) {
+    Size i = 0;
+#if defined(NTL_SIMD_AVX2)
+    const __m256i above = _mm256_set1_epi8('a' - 1), below = _mm256_set1_epi8('z' + 1), bit = _mm256_set1_epi8(0x20);
+    for(; i + 32 <= a_count; i += 32) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_data + i));
+      const __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(v, above), _mm256_cmpgt_epi8(below, v));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(a_data + i), _mm256_xor_si256(v, _mm256_and_si256(lower, bit)));
+    }
+#elif defined(NTL_SIMD_SSE2)
+    const __m128i above = _mm_set1_epi8('a' - 1), below = _mm_set1_epi8('z' + 1), bit = _mm_set1_epi8(0x20);
+    for(; i + 16 <= a_count; i += 16) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_data + i));
+      const __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(v, above), _mm_cmpgt_epi8(below, v));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(a_data + i), _mm_xor_si128(v, _mm_and_si128(lower, bit)));
+    }
+#elif defined(NTL_SIMD_NEON)
+    const uint8x16_t first = vdupq_n_u8('a'), range = vdupq_n_u8('z' - 'a'), bit = vdupq_n_u8(0x20);
+    for(; i + 16 <= a_count; i += 16) {
+      const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(a_data + i));
+      const uint8x16_t lower = vcleq_u8(vsubq_u8(v, first), range);
+      vst1q_u8(reinterpret_cast<uint8_t*>(a_data + i), veorq_u8(v, vandq_u8(lower, bit)));
+    }
+#endif
+    for(; i < a_count; ++i) {
+      if(a_data[i] >= 'a' && a_data[i] <= 'z')
+        a_data[i] = static_cast<char>(a_data[i] & ~0x20);
+    }
+  }
+}
+
+#endif // NTL_CHARS_UTILS_HPP
@@ -8,17 +8,327 @@
 #ifndef NTL_HASH_UTILS_HPP
 #define NTL_HASH_UTILS_HPP
 
+#include <bit>
+#include <concepts>
+#include <cstring>
 #include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "core/Algorithms.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
 
 namespace ntl::hash {
   /**
+   * @brief Mixes the bits of the given value, so that every input bit affects every output bit.
+   *
+   * @details Runtime: O(1)
+   *
+   * @param a_value the value to mix
+   * @return the mixed value
+   *
+   * @note This is the 64-bit finalizer of MurmurHash3.
+   */
+  constexpr U64 Mix(U64 a_value) {
+    a_value ^= a_value >> 33;
+    a_value *= 0xff51afd7ed558ccdULL;
+    a_value ^= a_value >> 33;
+    a_value *= 0xc4ceb9fe1a85ec53ULL;
+    a_value ^= a_value >> 33;
+    return a_value;
+  }
+
+  /**
+   * @brief Hashes the given bytes using the DJB2 algorithm.
+   *
+   * @details Runtime: O(n), where n is the length of the key.
+   *
+   * @param a_key the key to hash
+   * @param a_length the length of the key
+   * @return the hashed key
+   */
+  constexpr U64 DJB2(const char* a_key, const Size a_length) {
+    U64 hash = 5381;
+
+    for(Size i = 0; i < a_length; ++i)
+      hash = ((hash << 5) + hash) + static_cast<unsigned char>(a_key[i]);
+
+    return hash;
+  }
+
+  /**
+   * @brief Hashes the given bytes using the SDBM algorithm.
+   *
+   * @details Runtime: O(n), where n is the length of the key.
+   *
+   * @param a_key the key to hash
+   * @param a_length the length of the key
+   * @return the hashed key
+   */
+  constexpr U64 SDBM(const char* a_key, const Size a_length) {
+    U64 hash = 0;
+
+    for(Size i = 0; i < a_length; ++i)
+      hash = static_cast<unsigned char>(a_key[i]) + (hash << 6) + (hash << 16) - hash;
+
+    return ((hash & 0x7FFFFFFFFFFFFFFF) | 1);
+  }
+
+  /**
+   * @brief Hashes the given bytes using the FNV-1a algorithm.
+   *
+   * @details Runtime: O(n), where n is the length of the key.
+   *
+   * @param a_key the key to hash
+   * @param a_length the length of the key
+   * @return the hashed key
+   */
+  constexpr U64 FNV1a(const char* a_key, const Size a_length) {
+    constexpr U64 FNV_prime = 1099511628211ULL;
+    constexpr U64 FNV_offset = 14695981039346656037ULL;
+
+    U64 hash = FNV_offset;
+
+    for(Size i = 0; i < a_length; ++i)
+      hash = (hash ^ static_cast<unsigned char>(a_key[i])) * FNV_prime;
+
+    return hash;
+  }
+
+  namespace detail {
+    /**
+     * @brief Multiplies two 64-bit values into 128 bits.
+     *
+     * @param a_low the first factor, replaced by the lower half of the product
+     * @param a_high the second factor, replaced by the upper half of the product
+     */
+    constexpr void Multiply(U64& a_low, U64& a_high) {
+#if defined(__SIZEOF_INT128__)
+      __extension__ using U128 = unsigned __int128;
+      const U128 product = static_cast<U128>(a_low) * a_high;
+      a_low = static_cast<U64>(product);
+      a_high = static_cast<U64>(product >> 64);
+#else
+      const U64 low_low = (a_low & 0xFFFFFFFF) * (a_high & 0xFFFFFFFF);
+      const U64 low_high = (a_low & 0xFFFFFFFF) * (a_high >> 32);
+      const U64 high_low = (a_low >> 32) * (a_high & 0xFFFFFFFF);
+      const U64 high_high = (a_low >> 32) * (a_high >> 32);
+      const U64 middle = (low_low >> 32) + (low_high & 0xFFFFFFFF) + (high_low & 0xFFFFFFFF);
+      a_low = (middle << 32) | (low_low & 0xFFFFFFFF);
+      a_high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+#endif
+    }
+
+    /**
+     * @brief Multiplies two 64-bit values and folds the 128-bit product into 64 bits.
+     */
+    constexpr U64 MultiplyMix(U64 a_left, U64 a_right) {
+      Multiply(a_left, a_right);
+      return a_left ^ a_right;
+    }
+
+    /**
+     * @brief Reads a little-endian integer from unaligned bytes.
+     *
+     * @tparam T the unsigned integer type to read
+     * @param a_bytes the bytes (at least sizeof(T) of them)
+     * @return the integer
+     */
+    template <typename T>
+    constexpr T Read(const char* a_bytes) {
+      T value = 0;
+      if consteval {
+        for(Size i = 0; i < sizeof(T); ++i)
+          value |= static_cast<T>(static_cast<unsigned char>(a_bytes[i])) << (8 * i);
+      } else {
+        std::memcpy(&value, a_bytes, sizeof(T));
+        if constexpr(std::endian::native == std::endian::big)
+          value = std::byteswap(value);
+      }
+      return value;
+    }
+  }
+
+  /**
+   * @brief Hashes the given bytes using the wyhash algorithm (final version 4.2).
+   *
+   * @details Runtime: O(n), where n is the length of the key. In contrast to the other algorithms, which
+   * consume one byte per step, wyhash reads 16 bytes per step (48 bytes in three independent lanes for long
+   * keys) and mixes them with 128-bit multiplications. Keys of up to 16 bytes take two overlapping reads
+   * and no loop at all.
+   *
+   * @param a_key the key to hash
+   * @param a_length the length of the key
+   * @param a_seed the seed, to get independent hash functions
+   * @return the hashed key
+   *
+   * @source: https://github.com/wangyi-fudan/wyhash
+   */
+  constexpr U64 WyHash(const char* a_key, const Size a_length, U64 a_seed = 0) {
+    constexpr U64 SECRET[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+    using detail::MultiplyMix;
+
+    const char* p = a_key;
+    a_seed ^= MultiplyMix(a_seed ^ SECRET[0], SECRET[1]);
+
+    U64 a = 0, b = 0;
+    if(a_length <= 16) {
+      if(a_length >= 4) {
+        // two overlapping pairs of 4 bytes cover every length from 4 to 16
+        const Size offset = (a_length >> 3) << 2;
+        a = (static_cast<U64>(detail::Read<U32>(p)) << 32) | detail::Read<U32>(p + offset);
+        b = (static_cast<U64>(detail::Read<U32>(p + a_length - 4)) << 32) | detail::Read<U32>(p + a_length - 4 - offset);
+      } else if(a_length > 0) {
+        a = (static_cast<U64>(static_cast<unsigned char>(p[0])) << 16) |
+            (static_cast<U64>(static_cast<unsigned char>(p[a_length >> 1])) << 8) |
+            static_cast<unsigned char>(p[a_length - 1]);
+      }
+    } else {
+      Size remaining = a_length;
+      if(remaining > 48) {
+        U64 lane1 = a_seed, lane2 = a_seed;
+        do {
+          a_seed = MultiplyMix(detail::Read<U64>(p) ^ SECRET[1], detail::Read<U64>(p + 8) ^ a_seed);
+          lane1 = MultiplyMix(detail::Read<U64>(p + 16) ^ SECRET[2], detail::Read<U64>(p + 24) ^ lane1);
+          lane2 = MultiplyMix(detail::Read<U64>(p + 32) ^ SECRET[3], detail::Read<U64>(p + 40) ^ lane2);
+          p += 48;
+          remaining -= 48;
+        } while(remaining > 48);
+        a_seed ^= lane1 ^ lane2;
+      }
+      while(remaining > 16) {
+        a_seed = MultiplyMix(detail::Read<U64>(p) ^ SECRET[1], detail::Read<U64>(p + 8) ^ a_seed);
+        p += 16;
+        remaining -= 16;
+      }
+      // the last 16 bytes, which may overlap with the bytes already consumed
+      a = detail::Read<U64>(p + remaining - 16);
+      b = detail::Read<U64>(p + remaining - 8);
+    }
+
+    a ^= SECRET[1];
+    b ^= a_seed;
+    detail::Multiply(a, b);
+    return MultiplyMix(a ^ SECRET[0] ^ a_length, b ^ SECRET[1]);
+  }
+
+  /**
+   * @brief Calculates the hash of the given bytes using the given algorithm.
+   *
+   * @details Runtime: O(n), where n is the length of the key.
+   *
+   * @param a_algorithm the algorithm to use for hashing
+   * @param a_key the key to hash
+   * @param a_length the length of the key
+   * @return the hashed key
+   */
+  constexpr U64 Calculate(const algorithms::Hash a_algorithm, const char* a_key, const Size a_length) {
+    switch(a_algorithm) {
+      case algorithms::Hash::DJB2:
+        return DJB2(a_key, a_length);
+      case algorithms::Hash::SDBM:
+        return SDBM(a_key, a_length);
+      case algorithms::Hash::WyHash:
+        return WyHash(a_key, a_length);
+      case algorithms::Hash::FNV1a:
+      default:
+        return FNV1a(a_key, a_length);
+    }
+  }
+
+  /**
+   * @brief Default hasher used by the hash based containers.
+   *
+   * @details A hasher is any type callable with either (const T&) or (const T&, algorithms::Hash)
+   * returning a U64. The second form receives the algorithm the container was created with,
+   * which is how string keys honour algorithms::Hash. Custom key types can either specialize
+   * this template or pass their own hasher type to the container.
+   *
+   * The primary template falls back to std::hash and mixes its result, because many std::hash
+   * implementations are the identity function.
+   *
+   * @tparam T the type of the key to hash
+   */
+  template <typename T, typename = void>
+  struct Hasher {
+    U64 operator()(const T& a_key) const {
+      return Mix(static_cast<U64>(std::hash<T>{}(a_key)));
+    }
+  };
+
+  /**
+   * @brief Hasher for integral, enumeration and pointer keys.
+   */
+  template <typename T>
+  struct Hasher<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>>> {
+    constexpr U64 operator()(const T& a_key) const {
+      if constexpr(std::is_pointer_v<T>)
+        return Mix(reinterpret_cast<UPtr>(a_key));
+      else
+        return Mix(static_cast<U64>(a_key));
+    }
+  };
+
+  /**
+   * @brief Hasher for std::string keys (transparent for std::string_view and c-strings).
+   */
+  template <>
+  struct Hasher<std::string> {
+    using is_transparent = void;
+
+    U64 operator()(const std::string_view a_key, const algorithms::Hash a_algorithm) const {
+      return Calculate(a_algorithm, a_key.data(), a_key.size());
+    }
+  };
+
+  /**
+   * @brief Checks if a container with the given hasher and key type can be searched by the
+   * given lookup type without converting it to the key type first.
+   *
+   * @details This is the case if the hasher is marked as transparent (has an is_transparent
+   * member type) and the keys can be compared with the lookup type directly. A transparent
+   * hasher has to produce the same hash for a lookup as for the equal key.
+   */
+  template <typename LookupType, typename HasherType, typename KeyType>
+  concept TransparentKey = requires { typename HasherType::is_transparent; } &&
+                           !std::is_same_v<std::remove_cvref_t<LookupType>, KeyType> &&
+                           requires(const KeyType& a_key, const LookupType& a_lookup) {
+                             { a_key == a_lookup } -> std::convertible_to<bool>;
+                           };
+
+  /**
+   * @brief Hashes the given value with its Hasher, so strings take the word-at-a-time WyHash.
+   *
+   * @param a_value the value to hash
+   * @return the hash of the value
+   */
+  template <typename T>
+  U64 Of(const T& a_value) {
+    if constexpr(std::is_invocable_r_v<U64, const Hasher<T>&, const T&, algorithms::Hash>)
+      return Hasher<T>{}(a_value, algorithms::Hash::WyHash);
+    else
+      return Hasher<T>{}(a_value);
+  }
+
+  /**
+   * @brief Combines the hashes of the given values into the seed.
+   *
+   * @details Runtime: O(n), where n is the total size of the values. The values are hashed with their
+   * Hasher (see Of) instead of std::hash, so integers get mixed and strings hashed word by word.
+   *
+   * @param seed the hash to combine the values into
+   * @param v the first value
+   * @param rest the remaining values
+   *
    * @source: https://stackoverflow.com/a/57595105
    */
   template <typename T, typename... Rest>
   void Combine(std::size_t& seed, const T& v, const Rest&... rest) {
-    seed ^= std::hash<T>{}(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= static_cast<std::size_t>(Of(v)) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
     (Combine(seed, rest), ...);
-  };
+  }
 }
 
 #endif // NTL_HASH_UTILS_HPP
@@ -0,0 +1,69 @@
+/**
+* @file Memory.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_MEMORY_UTILS_HPP
+#define NTL_MEMORY_UTILS_HPP
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "data/Size.hpp"
+
+namespace ntl::memory {
+  /**
+   * @brief Checks if objects of the given type can be moved to another address by copying their bytes.
+   *
+   * @details Defaults to trivially copyable types. Types that don't store pointers into themselves
+   * can specialize this trait to be relocated with memcpy as well.
+   *
+   * @tparam T the type to check
+   */
+  template <typename T>
+  struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+  /**
+   * @brief Destroys the given number of objects.
+   *
+   * @details Runtime: O(n), where n is the number of objects (O(1) for trivially destructible types)
+   *
+   * @param a_first the first object to destroy
+   * @param a_count the number of objects
+   */
+  template <typename T>
+  void Destroy(T* a_first, const Size a_count) {
+    if constexpr(!std::is_trivially_destructible_v<T>) {
+      for(Size i = 0; i < a_count; ++i)
+        std::destroy_at(a_first + i);
+    }
+  }
+
+  /**
+   * @brief Moves the given number of objects into uninitialized memory and destroys the originals.
+   *
+   * @details Runtime: O(n), where n is the number of objects
+   *
+   * @param a_dst the uninitialized destination (must not overlap the source)
+   * @param a_src the objects to relocate
+   * @param a_count the number of objects
+   */
+  template <typename T>
+  void Relocate(T* a_dst, T* a_src, const Size a_count) {
+    if constexpr(IsTriviallyRelocatable<T>::value) {
+      if(a_count > 0)
+        std::memcpy(static_cast<void*>(a_dst), static_cast<const void*>(a_src), a_count * sizeof(T));
+    } else {
+      for(Size i = 0; i < a_count; ++i) {
+        std::construct_at(a_dst + i, std::move(a_src[i]));
+        std::destroy_at(a_src + i);
+      }
+    }
+  }
+}
+
+#endif // NTL_MEMORY_UTILS_HPP
@@ -0,0 +1,238 @@
+/**
+* @file Parallel.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_PARALLEL_UTILS_HPP
+#define NTL_PARALLEL_UTILS_HPP
+
+#include <algorithm>
+#include <memory>
+
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "os/Atomic.hpp"
+#include "os/ThreadPool.hpp"
+#include "utils/Sort.hpp"
+
+/**
+ * @brief Algorithms splitting index ranges into chunks which are processed by the threads of a pool.
+ * The calling thread processes a chunk as well and helps with the others while waiting.
+ */
+namespace ntl::parallel {
+  /**
+   * @brief Default minimum number of elements per chunk. Smaller ranges are processed on the calling thread.
+   */
+  constexpr Size DEFAULT_GRAIN = 16384;
+
+  namespace detail {
+    /**
+     * @brief Gets the number of chunks to split the given number of elements into.
+     *
+     * @param a_count the number of elements
+     * @param a_grain the minimum number of elements per chunk
+     * @param a_max_chunks the maximum number of chunks
+     * @return the number of chunks (at least 1)
+     */
+    inline Size chunkCount(const Size a_count, const Size a_grain, const Size a_max_chunks) {
+      const Size chunks = (a_count + std::max(a_grain, Size{1}) - 1) / std::max(a_grain, Size{1});
+      return std::max(Size{1}, std::min(chunks, a_max_chunks));
+    }
+  }
+
+  /**
+   * @brief Calls the body for consecutive chunks of the given range in parallel.
+   *
+   * @details Runtime: O(n / t), where n is the size of the range and t the number of threads
+   *
+   * @param a_from the first index
+   * @param a_to the index after the last one
+   * @param a_body a callable taking the first index and the index after the last one of a chunk
+   * @param a_grain the minimum number of indices per chunk
+   * @param a_pool the pool to use
+   */
+  template <typename Body>
+  void For(const Size a_from, const Size a_to, const Body& a_body, const Size a_grain = DEFAULT_GRAIN,
+           ThreadPool& a_pool = ThreadPool::GetDefault()) {
+    if(a_to <= a_from)
+      return;
+
+    const Size count = a_to - a_from;
+    // a few chunks per thread, so threads finishing early can steal the remaining ones
+    const Size chunks = detail::chunkCount(count, a_grain, (a_pool.GetThreadCount() + 1) * 4);
+
+    if(chunks == 1) {
+      a_body(a_from, a_to);
+      return;
+    }
+
+    struct Chunk {
+      const Body* body;
+      Size from;
+      Size to;
+
+      void operator()() const { (*body)(from, to); }
+    };
+
+    auto* parts = new Chunk[chunks];
+    for(Size i = 0; i < chunks; ++i)
+      parts[i] = Chunk{&a_body, a_from + count * i / chunks, a_from + count * (i + 1) / chunks};
+
+    TaskGroup group{a_pool};
+    for(Size i = 1; i < chunks; ++i)
+      group.Run(parts[i]);
+
+    parts[0]();
+    group.Wait();
+
+    delete[] parts;
+  }
+
+  /**
+   * @brief Reduces the given range in parallel.
+   *
+   * @details Runtime: O(n / t + c), where n is the size of the range, t the number of threads and c the number of chunks
+   *
+   * @param a_from the first index
+   * @param a_to the index after the last one
+   * @param a_identity the result of an empty range
+   * @param a_body a callable taking the first index and the index after the last one of a chunk, returning its result
+   * @param a_combine a callable combining two results (applied in the order of the chunks)
+   * @param a_grain the minimum number of indices per chunk
+   * @param a_pool the pool to use
+   * @return the combined result of all chunks
+   */
+  template <typename T, typename Body, typename Combine>
+  T Reduce(const Size a_from, const Size a_to, T a_identity, const Body& a_body, const Combine& a_combine,
+           const Size a_grain = DEFAULT_GRAIN, ThreadPool& a_pool = ThreadPool::GetDefault()) {
+    if(a_to <= a_from)
+      return a_identity;
+
+    const Size count = a_to - a_from;
+    const Size chunks = detail::chunkCount(count, a_grain, (a_pool.GetThreadCount() + 1) * 4);
+
+    if(chunks == 1)
+      return a_combine(std::move(a_identity), a_body(a_from, a_to));
+
+    std::allocator<T> allocator{};
+    T* results = allocator.allocate(chunks);
+
+    For(0, chunks, [&](const Size a_first, const Size a_last) {
+      for(Size i = a_first; i < a_last; ++i)
+        std::construct_at(results + i, a_body(a_from + count * i / chunks, a_from + count * (i + 1) / chunks));
+    }, 1, a_pool);
+
+    T result = std::move(a_identity);
+    for(Size i = 0; i < chunks; ++i)
+      result = a_combine(std::move(result), std::move(results[i]));
+
+    std::destroy_n(results, chunks);
+    allocator.deallocate(results, chunks);
+
+    return result;
+  }
+
+  /**
+   * @brief Sorts the given elements using a parallel merge sort (stable).
+   *
+   * @details Runtime: O(n*log(n) / t + n), where n is the number of elements and t the number of threads.
+   *
+   * The elements are split into one chunk per thread, which are sorted in parallel using sort::MergeSort.
+   * Neighbouring chunks are then merged pairwise in parallel, halving the number of chunks every round.
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_compare the comparison returning if the left element belongs before the right one
+   * @param a_grain the minimum number of elements per chunk
+   * @param a_pool the pool to use
+   */
+  template <typename T, typename Compare = sort::Less<T>>
+  void Sort(T* a_data, const Size a_count, Compare a_compare = {}, const Size a_grain = DEFAULT_GRAIN,
+            ThreadPool& a_pool = ThreadPool::GetDefault()) {
+    const Size chunks = detail::chunkCount(a_count, a_grain, a_pool.GetThreadCount() + 1);
+
+    if(chunks == 1) {
+      sort::MergeSort(a_data, a_count, a_compare);
+      return;
+    }
+
+    const auto boundary = [&](const Size a_chunk) { return a_count * std::min(a_chunk, chunks) / chunks; };
+
+    For(0, chunks, [&](const Size a_first, const Size a_last) {
+      for(Size i = a_first; i < a_last; ++i)
+        sort::MergeSort(a_data + boundary(i), boundary(i + 1) - boundary(i), a_compare);
+    }, 1, a_pool);
+
+    for(Size width = 1; width < chunks; width *= 2) {
+      For(0, (chunks + 2 * width - 1) / (2 * width), [&](const Size a_first, const Size a_last) {
+        for(Size pair = a_first; pair < a_last; ++pair) {
+          const Size from = boundary(2 * pair * width);
+          const Size middle = boundary(2 * pair * width + width);
+          const Size to = boundary(2 * pair * width + 2 * width);
+
+          sort::Merge(a_data + from, middle - from, to - middle, a_compare);
+        }
+      }, 1, a_pool);
+    }
+  }
+
+  /**
+   * @brief Searches the first element matching the predicate in parallel.
+   *
+   * @details Runtime: O(n / t), where n is the number of elements and t the number of threads.
+   *
+   * Chunks behind an already found match stop early, so the result is the same as of a sequential search.
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_predicate a callable taking an element and returning if it matches
+   * @param a_grain the minimum number of elements per chunk
+   * @param a_pool the pool to use
+   * @return the index of the first match (-1 if not found)
+   */
+  template <typename T, typename Predicate>
+  I64 FindIf(const T* a_data, const Size a_count, const Predicate& a_predicate, const Size a_grain = DEFAULT_GRAIN,
+             ThreadPool& a_pool = ThreadPool::GetDefault()) {
+    using Order = Atomic<Size>::MemoryOrder;
+    Atomic<Size> found{a_count};
+
+    For(0, a_count, [&](const Size a_first, const Size a_last) {
+      for(Size i = a_first; i < a_last; ++i) {
+        // every now and then check if an earlier chunk found a match already
+        if((i == a_first || i % 1024 == 0) && i >= found.Load(Order::Relaxed))
+          return;
+
+        if(a_predicate(a_data[i])) {
+          Size current = found.Load(Order::Relaxed);
+          while(i < current && !found.CompareExchangeWeak(current, i, Order::Relaxed, Order::Relaxed));
+          return;
+        }
+      }
+    }, a_grain, a_pool);
+
+    const Size result = found.Load();
+    return result == a_count ? -1 : static_cast<I64>(result);
+  }
+
+  /**
+   * @brief Searches the first element equal to the given one in parallel.
+   *
+   * @details Runtime: O(n / t), where n is the number of elements and t the number of threads.
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_element the element to find
+   * @param a_grain the minimum number of elements per chunk
+   * @param a_pool the pool to use
+   * @return the index of the first match (-1 if not found)
+   */
+  template <typename T>
+  I64 Find(const T* a_data, const Size a_count, const T& a_element, const Size a_grain = DEFAULT_GRAIN,
+           ThreadPool& a_pool = ThreadPool::GetDefault()) {
+    return FindIf(a_data, a_count, [&a_element](const T& a_other) { return a_other == a_element; }, a_grain, a_pool);
+  }
+}
+
+#endif // NTL_PARALLEL_UTILS_HPP
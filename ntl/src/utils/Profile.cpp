@@ -0,0 +1,198 @@
+/**
+* @file Profile.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Profile.hpp"
+
+#include <algorithm>
+
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "os/Atomic.hpp"
+
+namespace ntl::profile {
+  namespace {
+    using Order = Atomic<U64>::MemoryOrder;
+
+    /**
+     * @brief A relaxed counter starting at zero.
+     */
+    struct Counter {
+      Atomic<U64> value{0};
+
+      void Add(const U64 a_amount) { value.FetchAdd<Order::Relaxed>(a_amount); }
+
+      void Max(const U64 a_value) {
+        U64 current = value.Load<Order::Relaxed>();
+        while(current < a_value && !value.CompareExchangeWeak<Order::Relaxed, Order::Relaxed>(current, a_value)) {}
+      }
+
+      [[nodiscard]] U64 Get() const { return value.Load<Order::Relaxed>(); }
+
+      void Reset() { value.Store<Order::Relaxed>(0); }
+    };
+
+    struct alignas(NTL_CACHE_LINE_SIZE) MapCounters {
+      Counter lookups, probes[PROBE_BUCKETS], resizes, max_cluster;
+    };
+
+    struct alignas(NTL_CACHE_LINE_SIZE) ArrayCounters {
+      Counter resizes, moves, sorted;
+    };
+
+    struct alignas(NTL_CACHE_LINE_SIZE) StringCounters {
+      Counter allocations, copied_bytes;
+    };
+
+    struct alignas(NTL_CACHE_LINE_SIZE) ListCounters {
+      Counter allocations;
+    };
+
+    struct alignas(NTL_CACHE_LINE_SIZE) LockCounters {
+      Counter acquisitions, contentions, wait_nanoseconds;
+    };
+
+    MapCounters g_map;
+    ArrayCounters g_array;
+    StringCounters g_string;
+    ListCounters g_list;
+    LockCounters g_locks[3];
+
+    LockStatistics snapshot(const LockCounters& a_counters) {
+      return {a_counters.acquisitions.Get(), a_counters.contentions.Get(), a_counters.wait_nanoseconds.Get()};
+    }
+
+    void append(StringBuilder& a_builder, const char* a_name, const LockStatistics& a_lock) {
+      a_builder.Append(a_name).Append(": acquisitions=").Append(a_lock.acquisitions)
+               .Append(", contentions=").Append(a_lock.contentions)
+               .Append(", wait=").Append(a_lock.wait_nanoseconds).Append("ns\n");
+    }
+  }
+
+  Statistics GetStatistics() {
+    Statistics statistics{};
+
+    statistics.map.lookups = g_map.lookups.Get();
+    for(Size i = 0; i < PROBE_BUCKETS; ++i)
+      statistics.map.probes[i] = g_map.probes[i].Get();
+    statistics.map.resizes = g_map.resizes.Get();
+    statistics.map.max_cluster = g_map.max_cluster.Get();
+
+    statistics.array = {g_array.resizes.Get(), g_array.moves.Get(), g_array.sorted.Get()};
+    statistics.string = {g_string.allocations.Get(), g_string.copied_bytes.Get()};
+    statistics.list = {g_list.allocations.Get()};
+
+    statistics.lock = snapshot(g_locks[static_cast<Size>(LockKind::LOCK)]);
+    statistics.shared_read = snapshot(g_locks[static_cast<Size>(LockKind::SHARED_READ)]);
+    statistics.shared_write = snapshot(g_locks[static_cast<Size>(LockKind::SHARED_WRITE)]);
+
+    return statistics;
+  }
+
+  void Reset() {
+    g_map.lookups.Reset();
+    for(Counter& bucket : g_map.probes)
+      bucket.Reset();
+    g_map.resizes.Reset();
+    g_map.max_cluster.Reset();
+
+    g_array.resizes.Reset();
+    g_array.moves.Reset();
+    g_array.sorted.Reset();
+
+    g_string.allocations.Reset();
+    g_string.copied_bytes.Reset();
+
+    g_list.allocations.Reset();
+
+    for(LockCounters& lock : g_locks) {
+      lock.acquisitions.Reset();
+      lock.contentions.Reset();
+      lock.wait_nanoseconds.Reset();
+    }
+  }
+
+  String ToString(const Statistics& a_statistics) {
+    StringBuilder builder{};
+
+    const MapStatistics& map = a_statistics.map;
+    builder.Append("Map: lookups=").Append(map.lookups).Append(", probes=[");
+    for(Size i = 0; i < PROBE_BUCKETS; ++i)
+      builder.Append(i ? ", " : "").Append(map.probes[i]);
+    builder.Append("], resizes=").Append(map.resizes).Append(", max cluster=").Append(map.max_cluster).Append('\n');
+
+    builder.Append("Array: resizes=").Append(a_statistics.array.resizes)
+           .Append(", moves=").Append(a_statistics.array.moves)
+           .Append(", sorted=").Append(a_statistics.array.sorted).Append('\n');
+    builder.Append("String: allocations=").Append(a_statistics.string.allocations)
+           .Append(", copied=").Append(a_statistics.string.copied_bytes).Append("B\n");
+    builder.Append("List: allocations=").Append(a_statistics.list.allocations).Append('\n');
+
+    append(builder, "Lock", a_statistics.lock);
+    append(builder, "SharedLock (read)", a_statistics.shared_read);
+    append(builder, "SharedLock (write)", a_statistics.shared_write);
+
+    return builder.Build();
+  }
+
+  void RecordMapProbe(const Size a_length) {
+    g_map.lookups.Add(1);
+    g_map.probes[std::clamp(a_length, Size{1}, PROBE_BUCKETS) - 1].Add(1);
+  }
+
+  void RecordMapResize(const U8* a_distances, const Size a_capacity) {
+    g_map.resizes.Add(1);
+
+    Size longest = 0, current = 0;
+    for(Size i = 0; i < a_capacity; ++i) {
+      current = a_distances[i] == 0 ? 0 : current + 1;
+      longest = std::max(longest, current);
+    }
+    g_map.max_cluster.Max(longest);
+  }
+
+  void RecordArrayResize(const Size a_relocated) {
+    g_array.resizes.Add(1);
+    g_array.moves.Add(a_relocated);
+  }
+
+  void RecordArrayMoves(const Size a_moved) {
+    g_array.moves.Add(a_moved);
+  }
+
+  void RecordArraySort(const Size a_count) {
+    g_array.sorted.Add(a_count);
+  }
+
+  void RecordStringAllocation() {
+    g_string.allocations.Add(1);
+  }
+
+  void RecordStringCopy(const Size a_bytes) {
+    g_string.copied_bytes.Add(a_bytes);
+  }
+
+  void RecordListAllocation() {
+    g_list.allocations.Add(1);
+  }
+
+  void RecordLock(const LockKind a_kind, const bool a_contended, const U64 a_wait_nanoseconds) {
+    LockCounters& lock = g_locks[static_cast<Size>(a_kind)];
+    lock.acquisitions.Add(1);
+    if(a_contended) {
+      lock.contentions.Add(1);
+      lock.wait_nanoseconds.Add(a_wait_nanoseconds);
+    }
+  }
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  std::ostream& operator<<(std::ostream& a_stream, const Statistics& a_statistics) {
+    return (a_stream << ToString(a_statistics));
+  }
+}
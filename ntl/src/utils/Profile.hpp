@@ -0,0 +1,237 @@
+/**
+* @file Profile.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_PROFILE_UTILS_HPP
+#define NTL_PROFILE_UTILS_HPP
+
+#include <chrono>
+#include <ostream>
+
+#include "core/Platform.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "os/Time.hpp"
+#include "utils/Trace.hpp"
+
+#if NTL_PROFILE
+  // runs the recording statement only in profiling builds, so it costs nothing otherwise
+  #define NTL_PROFILE_RECORD(statement) statement
+#else
+  #define NTL_PROFILE_RECORD(statement) static_cast<void>(0)
+#endif
+
+namespace ntl {
+  class String;
+}
+
+/**
+ * @brief Process-wide counters of the containers and locks, summed over all their instances.
+ *
+ * @details The counters are only recorded if NTL_PROFILE is 1 (the default of debug builds, see core/Platform.hpp).
+ * Defining NTL_PROFILE as 1 for a release build enables them for canaries; all translation units have to use the
+ * same value. Every counter is a relaxed atomic on the cache line of its container, so the counts of concurrent
+ * updates are exact, but a snapshot may mix updates of different moments.
+ */
+namespace ntl::profile {
+  /**
+   * @brief Number of buckets of the probe length histogram, the last one collects all longer probes.
+   */
+  constexpr Size PROBE_BUCKETS = 16;
+
+  /**
+   * @brief Kinds of the recorded lock acquisitions.
+   */
+  enum class LockKind {
+    LOCK = 0,         // Lock::Acquire
+    SHARED_READ = 1,  // SharedLock::StartRead
+    SHARED_WRITE = 2  // SharedLock::StartWrite
+  };
+
+  /**
+   * @brief Counters of all Maps.
+   */
+  struct MapStatistics {
+    U64 lookups;                // finds of keys
+    U64 probes[PROBE_BUCKETS];  // lookups by the number of slots they inspected (1, 2, ..., PROBE_BUCKETS or more)
+    U64 resizes;                // reallocations of the slots
+    U64 max_cluster;            // longest run of occupied slots seen right before a resize
+  };
+
+  /**
+   * @brief Counters of all Arrays.
+   */
+  struct ArrayStatistics {
+    U64 resizes;  // reallocations of the elements
+    U64 moves;    // elements shifted by inserting or removing and relocated by reallocating
+    U64 sorted;   // elements passed to Sort
+  };
+
+  /**
+   * @brief Counters of all Strings.
+   */
+  struct StringStatistics {
+    U64 allocations;   // heap buffers allocated (short strings stay in the local buffer)
+    U64 copied_bytes;  // characters copied into buffers by assigning, appending and reallocating
+  };
+
+  /**
+   * @brief Counters of all Lists.
+   */
+  struct ListStatistics {
+    U64 allocations;  // nodes allocated
+  };
+
+  /**
+   * @brief Counters of one kind of lock acquisition.
+   */
+  struct LockStatistics {
+    U64 acquisitions;       // all blocking acquisitions
+    U64 contentions;        // acquisitions that had to wait
+    U64 wait_nanoseconds;   // total time spent waiting
+  };
+
+  /**
+   * @brief Snapshot of all counters.
+   */
+  struct Statistics {
+    MapStatistics map;
+    ArrayStatistics array;
+    StringStatistics string;
+    ListStatistics list;
+    LockStatistics lock;
+    LockStatistics shared_read;
+    LockStatistics shared_write;
+  };
+
+  /**
+   * @brief Takes a snapshot of all counters.
+   *
+   * @return the current statistics (all zero if NTL_PROFILE is 0)
+   */
+  [[nodiscard]] Statistics GetStatistics();
+
+  /**
+   * @brief Sets all counters back to zero.
+   */
+  void Reset();
+
+  /**
+   * @brief Formats the given statistics, one line per container and lock.
+   *
+   * @param a_statistics the statistics to format
+   * @return the formatted statistics
+   */
+  [[nodiscard]] String ToString(const Statistics& a_statistics);
+
+  /**
+   * @brief Records a Map lookup.
+   *
+   * @param a_length the number of inspected slots
+   */
+  void RecordMapProbe(Size a_length);
+
+  /**
+   * @brief Records a Map resize and the longest cluster of the table it replaces.
+   *
+   * @param a_distances the probe distances of the old slots (0 if empty)
+   * @param a_capacity the number of old slots
+   */
+  void RecordMapResize(const U8* a_distances, Size a_capacity);
+
+  /**
+   * @brief Records an Array reallocation.
+   *
+   * @param a_relocated the number of relocated elements
+   */
+  void RecordArrayResize(Size a_relocated);
+
+  /**
+   * @brief Records elements shifted by an Array insertion or removal.
+   *
+   * @param a_moved the number of shifted elements
+   */
+  void RecordArrayMoves(Size a_moved);
+
+  /**
+   * @brief Records an Array sort.
+   *
+   * @param a_count the number of sorted elements
+   */
+  void RecordArraySort(Size a_count);
+
+  /**
+   * @brief Records a String heap allocation.
+   */
+  void RecordStringAllocation();
+
+  /**
+   * @brief Records characters copied into a String buffer.
+   *
+   * @param a_bytes the number of copied characters
+   */
+  void RecordStringCopy(Size a_bytes);
+
+  /**
+   * @brief Records a List node allocation.
+   */
+  void RecordListAllocation();
+
+  /**
+   * @brief Records a lock acquisition.
+   *
+   * @param a_kind the kind of acquisition
+   * @param a_contended if the acquisition had to wait
+   * @param a_wait_nanoseconds the time spent waiting
+   */
+  void RecordLock(LockKind a_kind, bool a_contended, U64 a_wait_nanoseconds);
+
+  /**
+   * @brief Acquires a lock and records it, only timing the wait if trying to acquire it failed.
+   *
+   * @param a_kind the kind of acquisition
+   * @param a_try_acquire a callable trying to acquire the lock without blocking, returning if it succeeded
+   * @param a_acquire a callable acquiring the lock, blocking until it's free
+   */
+  template <typename TryAcquire, typename Acquire>
+  void TimedAcquire(LockKind a_kind, const TryAcquire& a_try_acquire, const Acquire& a_acquire);
+
+  // ---------------------------
+  // GLOBAL OVERLOADED OPERATORS
+  // ---------------------------
+
+  /**
+   * @brief Writes the formatted statistics into the given stream (see ToString).
+   *
+   * @param a_stream the stream
+   * @param a_statistics the statistics
+   * @return the stream
+   */
+  std::ostream& operator<<(std::ostream& a_stream, const Statistics& a_statistics);
+
+  // --------------
+  // PUBLIC METHODS
+  // --------------
+
+  template <typename TryAcquire, typename Acquire>
+  void TimedAcquire(const LockKind a_kind, const TryAcquire& a_try_acquire, const Acquire& a_acquire) {
+    if(a_try_acquire()) {
+      RecordLock(a_kind, false, 0);
+      return;
+    }
+
+    // the zone only covers the wait, as the uncontended acquisitions would flood the trace
+    NTL_PROFILE_SCOPE(a_kind == LockKind::LOCK        ? "Lock::Acquire"
+                      : a_kind == LockKind::SHARED_READ ? "SharedLock::StartRead"
+                                                        : "SharedLock::StartWrite");
+    const auto start = time::Clock::now();
+    a_acquire();
+    const auto waited = std::chrono::duration_cast<std::chrono::nanoseconds>(time::Clock::now() - start);
+    RecordLock(a_kind, true, static_cast<U64>(waited.count()));
+  }
+}
+
+#endif // NTL_PROFILE_UTILS_HPP
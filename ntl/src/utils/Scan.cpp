@@ -0,0 +1,184 @@
+/**
+* @file Scan.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Scan.hpp"
+
+#include <cstring>
+
+#include "core/Assert.hpp"
+#include "core/Platform.hpp"
+
+namespace ntl::scan {
+  namespace {
+    // bytes compared at once, which is a single register with AVX-512 and two or four registers otherwise
+    constexpr Size VECTOR_SIZE = 64;
+
+    // only aligned like T and allowed to alias T, so vectors can be loaded from any array of T
+    template <typename T>
+    using Vector [[gnu::vector_size(VECTOR_SIZE), gnu::aligned(alignof(T)), gnu::may_alias]] = T;
+
+    // the lanes of a comparison are all ones (-1) if it holds, so subtracting it counts
+    template <typename T>
+    using Mask = decltype(Vector<T>{} == Vector<T>{});
+
+    template <typename T>
+    constexpr Size LANES = VECTOR_SIZE / sizeof(T);
+
+    // returns a reference, so no vector is passed between functions compiled for different targets
+    template <typename T>
+    const Vector<T>& load(const T* a_data) {
+      return *reinterpret_cast<const Vector<T>*>(a_data);
+    }
+
+    template <typename T>
+    bool any(const Mask<T>& a_mask) {
+      U64 words[VECTOR_SIZE / sizeof(U64)];
+      std::memcpy(words, &a_mask, VECTOR_SIZE);
+
+      U64 result = 0;
+      for(const U64 word : words)
+        result |= word;
+      return result != 0;
+    }
+  }
+
+  template <scannable T>
+  NTL_TARGET_CLONES I64 Find(const T* a_data, const Size a_count, const T a_value) {
+    Size i = 0;
+    for(; i + LANES<T> <= a_count; i += LANES<T>) {
+      if(any<T>(load(a_data + i) == a_value))
+        break;
+    }
+    for(; i < a_count; ++i) {
+      if(a_data[i] == a_value)
+        return static_cast<I64>(i);
+    }
+    return -1;
+  }
+
+  template <scannable T>
+  NTL_TARGET_CLONES I64 FindFrontBack(const T* a_data, const Size a_count, const T a_value) {
+    // the k-th front block and the k-th back block hold the values the scalar search checks in the same
+    // steps, so the first pair of blocks with a match holds the result
+    Size front = 0;
+    Size back = a_count;
+    for(; back - front >= 2 * LANES<T>; front += LANES<T>, back -= LANES<T>) {
+      const bool front_hit = any<T>(load(a_data + front) == a_value);
+      const bool back_hit = any<T>(load(a_data + back - LANES<T>) == a_value);
+      if(front_hit || back_hit)
+        break;
+    }
+
+    // the scalar search of the remaining values continues with the same steps
+    for(Size from = front, to = back; from < to; ++from, --to) {
+      if(a_data[from] == a_value)
+        return static_cast<I64>(from);
+      if(a_data[to - 1] == a_value)
+        return static_cast<I64>(to - 1);
+    }
+    return -1;
+  }
+
+  template <scannable T>
+  NTL_TARGET_CLONES Size Count(const T* a_data, const Size a_count, const T a_value) {
+    // the lanes of 8 and 16 bit masks overflow, so they're added up before
+    constexpr Size FLUSH = sizeof(T) == 1 ? 127 : sizeof(T) == 2 ? 32767 : static_cast<Size>(-1);
+
+    Size result = 0;
+    Size i = 0;
+    while(i + LANES<T> <= a_count) {
+      Mask<T> counts{};
+      for(Size block = 0; block < FLUSH && i + LANES<T> <= a_count; ++block, i += LANES<T>)
+        counts -= load(a_data + i) == a_value;
+
+      for(Size lane = 0; lane < LANES<T>; ++lane)
+        result += static_cast<Size>(counts[lane]);
+    }
+    for(; i < a_count; ++i)
+      result += a_data[i] == a_value;
+    return result;
+  }
+
+  template <scannable T>
+  NTL_TARGET_CLONES T Min(const T* a_data, const Size a_count) {
+    VERIFY(a_count > 0)
+
+    T result = a_data[0];
+    Size i = 0;
+    if(a_count >= LANES<T>) {
+      Vector<T> minimum = load(a_data);
+      for(i = LANES<T>; i + LANES<T> <= a_count; i += LANES<T>) {
+        const Vector<T> values = load(a_data + i);
+        minimum = values < minimum ? values : minimum;
+      }
+      for(Size lane = 0; lane < LANES<T>; ++lane)
+        result = minimum[lane] < result ? minimum[lane] : result;
+    }
+    for(; i < a_count; ++i)
+      result = a_data[i] < result ? a_data[i] : result;
+    return result;
+  }
+
+  template <scannable T>
+  NTL_TARGET_CLONES T Max(const T* a_data, const Size a_count) {
+    VERIFY(a_count > 0)
+
+    T result = a_data[0];
+    Size i = 0;
+    if(a_count >= LANES<T>) {
+      Vector<T> maximum = load(a_data);
+      for(i = LANES<T>; i + LANES<T> <= a_count; i += LANES<T>) {
+        const Vector<T> values = load(a_data + i);
+        maximum = maximum < values ? values : maximum;
+      }
+      for(Size lane = 0; lane < LANES<T>; ++lane)
+        result = result < maximum[lane] ? maximum[lane] : result;
+    }
+    for(; i < a_count; ++i)
+      result = result < a_data[i] ? a_data[i] : result;
+    return result;
+  }
+
+  template <scannable T>
+  NTL_TARGET_CLONES SumType<T> Sum(const T* a_data, const Size a_count) {
+    using Wide [[gnu::vector_size(LANES<T> * sizeof(SumType<T>))]] = SumType<T>;
+
+    Wide sums{};
+    Size i = 0;
+    for(; i + LANES<T> <= a_count; i += LANES<T>)
+      sums += __builtin_convertvector(load(a_data + i), Wide);
+
+    SumType<T> result = 0;
+    for(Size lane = 0; lane < LANES<T>; ++lane)
+      result += sums[lane];
+    for(; i < a_count; ++i)
+      result += a_data[i];
+    return result;
+  }
+
+#define NTL_SCAN_INSTANTIATE(T)                          \
+  template I64 Find<T>(const T*, Size, T);               \
+  template I64 FindFrontBack<T>(const T*, Size, T);      \
+  template Size Count<T>(const T*, Size, T);             \
+  template T Min<T>(const T*, Size);                     \
+  template T Max<T>(const T*, Size);                     \
+  template SumType<T> Sum<T>(const T*, Size);
+
+  NTL_SCAN_INSTANTIATE(char)
+  NTL_SCAN_INSTANTIATE(I8)
+  NTL_SCAN_INSTANTIATE(U8)
+  NTL_SCAN_INSTANTIATE(I16)
+  NTL_SCAN_INSTANTIATE(U16)
+  NTL_SCAN_INSTANTIATE(I32)
+  NTL_SCAN_INSTANTIATE(U32)
+  NTL_SCAN_INSTANTIATE(I64)
+  NTL_SCAN_INSTANTIATE(U64)
+  NTL_SCAN_INSTANTIATE(float)
+  NTL_SCAN_INSTANTIATE(double)
+
+#undef NTL_SCAN_INSTANTIATE
+}
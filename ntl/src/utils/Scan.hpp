@@ -0,0 +1,170 @@
+/**
+* @file Scan.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_SCAN_UTILS_HPP
+#define NTL_SCAN_UTILS_HPP
+
+#include <concepts>
+#include <type_traits>
+
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+
+/**
+ * @brief Kernels scanning arrays of arithmetic values.
+ *
+ * @details The kernels of the scannable types are compiled for AVX-512, AVX2 and the baseline of the target
+ * (see NTL_TARGET_CLONES), so the best version the CPU supports is picked at load time. Every kernel compares
+ * whole vectors of 64 bytes at a time and has a scalar tail, so the count doesn't need to be a multiple of the
+ * vector width.
+ */
+namespace ntl::scan {
+  /**
+   * @brief The types with vectorized kernels (the fixed width integers, char, float and double).
+   */
+  template <typename T>
+  concept scannable = std::same_as<T, char> || std::same_as<T, I8> || std::same_as<T, U8> ||
+                      std::same_as<T, I16> || std::same_as<T, U16> || std::same_as<T, I32> ||
+                      std::same_as<T, U32> || std::same_as<T, I64> || std::same_as<T, U64> ||
+                      std::same_as<T, float> || std::same_as<T, double>;
+
+  /**
+   * @brief The type the values are summed up in (64 bit integers or double), so sums don't overflow early.
+   */
+  template <typename T>
+  using SumType = std::conditional_t<std::is_floating_point_v<T>, double,
+                                     std::conditional_t<std::is_signed_v<T>, I64, U64>>;
+
+  /**
+   * @brief Searches the first value equal to the given one.
+   *
+   * @details Runtime: O(n), where n is the number of values
+   *
+   * @param a_data the first value
+   * @param a_count the number of values
+   * @param a_value the value to find
+   * @return the index of the value (-1 if not found)
+   */
+  template <scannable T>
+  I64 Find(const T* a_data, Size a_count, T a_value);
+
+  /**
+   * @brief Searches a value equal to the given one from both ends at once.
+   *
+   * @details Runtime: O(n), where n is the number of values
+   *
+   * Returns the same index as checking the first, the last, the second, the second to last value and so on.
+   *
+   * @param a_data the first value
+   * @param a_count the number of values
+   * @param a_value the value to find
+   * @return the index of the value (-1 if not found)
+   */
+  template <scannable T>
+  I64 FindFrontBack(const T* a_data, Size a_count, T a_value);
+
+  /**
+   * @brief Counts the values equal to the given one.
+   *
+   * @details Runtime: O(n), where n is the number of values
+   *
+   * @param a_data the first value
+   * @param a_count the number of values
+   * @param a_value the value to count
+   * @return the number of equal values
+   */
+  template <scannable T>
+  Size Count(const T* a_data, Size a_count, T a_value);
+
+  /**
+   * @brief Gets the smallest value (unspecified if a floating point value is NaN).
+   *
+   * @details Runtime: O(n), where n is the number of values
+   *
+   * @param a_data the first value
+   * @param a_count the number of values (at least one)
+   * @return the smallest value
+   */
+  template <scannable T>
+  T Min(const T* a_data, Size a_count);
+
+  /**
+   * @brief Gets the biggest value (unspecified if a floating point value is NaN).
+   *
+   * @details Runtime: O(n), where n is the number of values
+   *
+   * @param a_data the first value
+   * @param a_count the number of values (at least one)
+   * @return the biggest value
+   */
+  template <scannable T>
+  T Max(const T* a_data, Size a_count);
+
+  /**
+   * @brief Sums the values up.
+   *
+   * @details Runtime: O(n), where n is the number of values
+   *
+   * Every lane of the vectors sums up its own share, so floating point sums may differ from a sequential
+   * sum in the last bits.
+   *
+   * @param a_data the first value
+   * @param a_count the number of values
+   * @return the sum (0 if there are no values)
+   */
+  template <scannable T>
+  SumType<T> Sum(const T* a_data, Size a_count);
+
+  /**
+   * @brief Checks if the predicate holds for any value.
+   *
+   * @details Runtime: O(n), where n is the number of values
+   *
+   * The predicate is evaluated for blocks of values without branching, so the compiler can vectorize
+   * simple predicates. It may be evaluated for values after the first one it holds for.
+   *
+   * @param a_data the first value
+   * @param a_count the number of values
+   * @param a_predicate the predicate
+   * @return if the predicate holds for any value (false if there are no values)
+   */
+  template <typename T, typename Predicate>
+  bool Any(const T* a_data, const Size a_count, const Predicate& a_predicate) {
+    constexpr Size BLOCK = 64 / sizeof(T) > 0 ? 64 / sizeof(T) : 1;
+
+    Size i = 0;
+    for(; i + BLOCK <= a_count; i += BLOCK) {
+      bool hit = false;
+      for(Size j = 0; j < BLOCK; ++j)
+        hit |= static_cast<bool>(a_predicate(a_data[i + j]));
+      if(hit)
+        return true;
+    }
+    for(; i < a_count; ++i) {
+      if(a_predicate(a_data[i]))
+        return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Checks if the predicate holds for all values.
+   *
+   * @details Runtime: O(n), where n is the number of values (see Any)
+   *
+   * @param a_data the first value
+   * @param a_count the number of values
+   * @param a_predicate the predicate
+   * @return if the predicate holds for all values (true if there are no values)
+   */
+  template <typename T, typename Predicate>
+  bool All(const T* a_data, const Size a_count, const Predicate& a_predicate) {
+    return !Any(a_data, a_count, [&](const T& a_value) { return !a_predicate(a_value); });
+  }
+}
+
+#endif // NTL_SCAN_UTILS_HPP
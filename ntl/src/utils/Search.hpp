@@ -0,0 +1,105 @@
+/**
+* @file Search.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_SEARCH_UTILS_HPP
+#define NTL_SEARCH_UTILS_HPP
+
+#include <algorithm>
+
+#include "core/Platform.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+
+/**
+ * @brief Searching algorithms operating on sorted contiguous ranges of elements. All of them
+ * only need operator< and return the index of the last element equal to the searched one.
+ */
+namespace ntl::search {
+  /**
+   * @brief Number of lookups FindMany interleaves, so their cache misses overlap.
+   */
+  constexpr Size BATCH_SIZE = 16;
+
+  /**
+   * @brief Searches the given element in the sorted range using a branchless binary search.
+   *
+   * @details Runtime: O(log(n)), where n is the number of elements.
+   *
+   * Every step halves the range using a conditional move instead of a branch and prefetches both
+   * possible middles of the next step, so the pipeline neither stalls on mispredictions nor on memory.
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_element the element to find
+   * @return the index of the last equal element (-1 if not found)
+   */
+  template <typename T>
+  I64 Find(const T* a_data, const Size a_count, const T& a_element) {
+    if(a_count == 0)
+      return -1;
+
+    const T* base = a_data;
+    for(Size count = a_count; count > 1;) {
+      const Size half = count / 2;
+      count -= half;
+
+      NTL_PREFETCH(base + count / 2);
+      NTL_PREFETCH(base + half + count / 2);
+      base = a_element < base[half] ? base : base + half;
+    }
+
+    // base is the last element not greater than the searched one (or the first one if there is none)
+    return *base < a_element || a_element < *base ? -1 : static_cast<I64>(base - a_data);
+  }
+
+  /**
+   * @brief Searches the given elements in the sorted range, interleaving BATCH_SIZE lookups at a time.
+   *
+   * @details Runtime: O(m * log(n)), where m is the number of searched elements and n the number of elements.
+   *
+   * All lookups of a batch take the same steps through the range, so every step issues the loads
+   * of the whole batch before they are needed, which hides most of the memory latency of big ranges.
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_elements the elements to find
+   * @param a_element_count the number of elements to find
+   * @param a_results receives the index of the last equal element for every searched one (-1 if not found)
+   */
+  template <typename T>
+  void FindMany(const T* a_data, const Size a_count, const T* a_elements, const Size a_element_count, I64* a_results) {
+    if(a_count == 0) {
+      std::fill_n(a_results, a_element_count, I64{-1});
+      return;
+    }
+
+    const T* bases[BATCH_SIZE];
+    for(Size first = 0; first < a_element_count; first += BATCH_SIZE) {
+      const Size batch = std::min(BATCH_SIZE, a_element_count - first);
+      const T* elements = a_elements + first;
+
+      std::fill_n(bases, batch, a_data);
+      for(Size count = a_count; count > 1;) {
+        const Size half = count / 2;
+        count -= half;
+
+        for(Size i = 0; i < batch; ++i) {
+          NTL_PREFETCH(bases[i] + count / 2);
+          NTL_PREFETCH(bases[i] + half + count / 2);
+          bases[i] = elements[i] < bases[i][half] ? bases[i] : bases[i] + half;
+        }
+      }
+
+      for(Size i = 0; i < batch; ++i) {
+        const bool found = !(*bases[i] < elements[i]) && !(elements[i] < *bases[i]);
+        a_results[first + i] = found ? static_cast<I64>(bases[i] - a_data) : -1;
+      }
+    }
+  }
+}
+
+#endif // NTL_SEARCH_UTILS_HPP
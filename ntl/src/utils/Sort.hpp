@@ -0,0 +1,727 @@
+/**
+* @file Sort.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_SORT_UTILS_HPP
+#define NTL_SORT_UTILS_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "core/Algorithms.hpp"
+#include "core/Assert.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+
+/**
+ * @brief Sorting algorithms operating on contiguous ranges of elements. All of them only
+ * need a strict weak ordering (operator< by default) and move the elements instead of copying them.
+ */
+namespace ntl::sort {
+  /**
+   * @brief Ranges smaller than this are sorted using insertion sort.
+   */
+  constexpr Size INSERTION_SORT_THRESHOLD = 24;
+
+  /**
+   * @brief Ranges bigger than this use the median of medians (ninther) as pivot instead of the median of 3.
+   */
+  constexpr Size NINTHER_THRESHOLD = 128;
+
+  /**
+   * @brief Number of elements an insertion sort may move before an already partitioned range is given up on.
+   */
+  constexpr Size PARTIAL_INSERTION_SORT_LIMIT = 8;
+
+  /**
+   * @brief Length of the runs sorted using insertion sort before merge sort starts merging them.
+   */
+  constexpr Size MERGE_RUN_LENGTH = 32;
+
+  /**
+   * @brief Ranges smaller than this are sorted using comparisons instead of radix sort by the dynamic sort.
+   * For numbers it's multiplied by their size, as every byte is another pass over the elements.
+   */
+  constexpr Size RADIX_SORT_THRESHOLD = 256;
+
+  /**
+   * @brief Number of nested bucket splits after which the string radix sort falls back to comparisons
+   * (bounds the recursion depth for keys with long shared prefixes).
+   */
+  constexpr Size STRING_RADIX_MAX_LEVELS = 32;
+
+  /**
+   * @brief Default comparison used by the sorting algorithms.
+   */
+  template <typename T>
+  struct Less {
+    constexpr bool operator()(const T& a_left, const T& a_right) const { return a_left < a_right; }
+  };
+
+  /**
+   * @brief Integral (except bool) and floating point types of up to 8 bytes, whose operator< order is
+   * the order of their bits after flipping the sign.
+   */
+  template <typename T>
+  concept radix_sortable_number = ((std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_floating_point_v<T>) &&
+                                  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+  /**
+   * @brief String types whose operator< compares the characters lexicographically as unsigned bytes.
+   */
+  template <typename T>
+  concept radix_sortable_string = std::movable<T> && requires(const T& a_value) {
+    { a_value.GetCString() } -> std::convertible_to<const char*>;
+    { a_value.GetLength() } -> std::convertible_to<Size>;
+  };
+
+  /**
+   * @brief Types which can be sorted using RadixSort.
+   */
+  template <typename T>
+  concept radix_sortable = radix_sortable_number<T> || radix_sortable_string<T>;
+
+  /**
+   * @brief Sorts the given elements using the insertion sort algorithm (stable).
+   *
+   * @details Runtime: O(n^2) & Ω(n), where n is the number of elements
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_compare the comparison returning if the left element belongs before the right one
+   */
+  template <typename T, typename Compare = Less<T>>
+  void InsertionSort(T* a_data, const Size a_count, Compare a_compare = {}) {
+    for(Size i = 1; i < a_count; ++i) {
+      if(!a_compare(a_data[i], a_data[i - 1]))
+        continue;
+
+      T temp = std::move(a_data[i]);
+      Size j = i;
+      do {
+        a_data[j] = std::move(a_data[j - 1]);
+        --j;
+      } while(j > 0 && a_compare(temp, a_data[j - 1]));
+      a_data[j] = std::move(temp);
+    }
+  }
+
+  /**
+   * @brief Sorts the given elements using the heap sort algorithm.
+   *
+   * @details Runtime: O(n*log(n)) & Ω(n*log(n)), where n is the number of elements
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_compare the comparison returning if the left element belongs before the right one
+   */
+  template <typename T, typename Compare = Less<T>>
+  void HeapSort(T* a_data, const Size a_count, Compare a_compare = {}) {
+    const auto sift_down = [&](Size a_root, const Size a_size) {
+      T temp = std::move(a_data[a_root]);
+
+      for(Size child; (child = 2 * a_root + 1) < a_size; a_root = child) {
+        if(child + 1 < a_size && a_compare(a_data[child], a_data[child + 1]))
+          child++;
+        if(!a_compare(temp, a_data[child]))
+          break;
+        a_data[a_root] = std::move(a_data[child]);
+      }
+      a_data[a_root] = std::move(temp);
+    };
+
+    for(Size i = a_count / 2; i > 0; --i)
+      sift_down(i - 1, a_count);
+
+    for(Size i = a_count; i > 1; --i) {
+      std::swap(a_data[0], a_data[i - 1]);
+      sift_down(0, i - 1);
+    }
+  }
+
+  namespace detail {
+    /**
+     * @brief Sorts the three given elements.
+     */
+    template <typename T, typename Compare>
+    void sort3(T* a_first, T* a_second, T* a_third, Compare& a_compare) {
+      if(a_compare(*a_second, *a_first))
+        std::swap(*a_first, *a_second);
+      if(a_compare(*a_third, *a_second)) {
+        std::swap(*a_second, *a_third);
+        if(a_compare(*a_second, *a_first))
+          std::swap(*a_first, *a_second);
+      }
+    }
+
+    /**
+     * @brief Insertion sort giving up once more than PARTIAL_INSERTION_SORT_LIMIT elements were moved.
+     *
+     * @return if the range got sorted
+     */
+    template <typename T, typename Compare>
+    bool partialInsertionSort(T* a_data, const Size a_count, Compare& a_compare) {
+      Size moves = 0;
+
+      for(Size i = 1; i < a_count; ++i) {
+        if(!a_compare(a_data[i], a_data[i - 1]))
+          continue;
+
+        T temp = std::move(a_data[i]);
+        Size j = i;
+        do {
+          a_data[j] = std::move(a_data[j - 1]);
+          --j;
+        } while(j > 0 && a_compare(temp, a_data[j - 1]));
+        a_data[j] = std::move(temp);
+
+        moves += i - j;
+        if(moves > PARTIAL_INSERTION_SORT_LIMIT)
+          return false;
+      }
+
+      return true;
+    }
+
+    /**
+     * @brief Partitions the range around its first element, putting elements equal to the pivot on the right.
+     *
+     * @details The pivot has to be the median of 3 (or the ninther), so that the loops find an element
+     * bigger than or equal to the pivot without checking the bounds.
+     *
+     * @return the final index of the pivot and if the range was partitioned already
+     */
+    template <typename T, typename Compare>
+    std::pair<Size, bool> partitionRight(T* a_data, const Size a_count, Compare& a_compare) {
+      T pivot = std::move(a_data[0]);
+      Size first = 0, last = a_count;
+
+      while(a_compare(a_data[++first], pivot));
+
+      if(first == 1) {
+        while(first < last && !a_compare(a_data[--last], pivot));
+      } else {
+        while(!a_compare(a_data[--last], pivot));
+      }
+
+      const bool partitioned = first >= last;
+
+      while(first < last) {
+        std::swap(a_data[first], a_data[last]);
+        while(a_compare(a_data[++first], pivot));
+        while(!a_compare(a_data[--last], pivot));
+      }
+
+      const Size pivot_index = first - 1;
+      a_data[0] = std::move(a_data[pivot_index]);
+      a_data[pivot_index] = std::move(pivot);
+
+      return {pivot_index, partitioned};
+    }
+
+    /**
+     * @brief Partitions the range around its first element, putting elements equal to the pivot on the left.
+     *
+     * @details Used if the pivot is equal to the element before the range, in which case every element
+     * on the left is equal to the pivot and doesn't need to be sorted anymore.
+     *
+     * @return the final index of the pivot
+     */
+    template <typename T, typename Compare>
+    Size partitionLeft(T* a_data, const Size a_count, Compare& a_compare) {
+      T pivot = std::move(a_data[0]);
+      Size first = 0, last = a_count;
+
+      while(a_compare(pivot, a_data[--last]));
+
+      if(last + 1 == a_count) {
+        while(first < last && !a_compare(pivot, a_data[++first]));
+      } else {
+        while(!a_compare(pivot, a_data[++first]));
+      }
+
+      while(first < last) {
+        std::swap(a_data[first], a_data[last]);
+        while(a_compare(pivot, a_data[--last]));
+        while(!a_compare(pivot, a_data[++first]));
+      }
+
+      a_data[0] = std::move(a_data[last]);
+      a_data[last] = std::move(pivot);
+
+      return last;
+    }
+
+    /**
+     * @brief Pattern-defeating quick sort loop, recursing into the smaller part of every partition.
+     *
+     * @param a_bad_allowed number of highly unbalanced partitions left before falling back to heap sort
+     * @param a_leftmost if the range starts at the beginning of the whole array (no element before it)
+     */
+    template <typename T, typename Compare>
+    void introSort(T* a_data, Size a_count, Compare& a_compare, Size a_bad_allowed, bool a_leftmost) {
+      while(true) {
+        if(a_count < INSERTION_SORT_THRESHOLD) {
+          InsertionSort(a_data, a_count, a_compare);
+          return;
+        }
+
+        const Size middle = a_count / 2;
+        if(a_count > NINTHER_THRESHOLD) {
+          sort3(a_data, a_data + middle, a_data + a_count - 1, a_compare);
+          sort3(a_data + 1, a_data + middle - 1, a_data + a_count - 2, a_compare);
+          sort3(a_data + 2, a_data + middle + 1, a_data + a_count - 3, a_compare);
+          sort3(a_data + middle - 1, a_data + middle, a_data + middle + 1, a_compare);
+          std::swap(a_data[0], a_data[middle]);
+        } else {
+          sort3(a_data + middle, a_data, a_data + a_count - 1, a_compare);
+        }
+
+        // the pivot equals the element before the range, so skip all elements equal to it
+        if(!a_leftmost && !a_compare(a_data[-1], a_data[0])) {
+          const Size pivot_index = partitionLeft(a_data, a_count, a_compare);
+          a_data += pivot_index + 1;
+          a_count -= pivot_index + 1;
+          continue;
+        }
+
+        const auto [pivot_index, partitioned] = partitionRight(a_data, a_count, a_compare);
+        const Size left_count = pivot_index, right_count = a_count - pivot_index - 1;
+        T* right = a_data + pivot_index + 1;
+
+        if(left_count < a_count / 8 || right_count < a_count / 8) {
+          if(--a_bad_allowed == 0) {
+            HeapSort(a_data, a_count, a_compare);
+            return;
+          }
+
+          // swap some elements around to break patterns which lead to bad pivots
+          if(left_count >= INSERTION_SORT_THRESHOLD) {
+            std::swap(a_data[0], a_data[left_count / 4]);
+            std::swap(a_data[left_count - 1], a_data[left_count - left_count / 4]);
+          }
+          if(right_count >= INSERTION_SORT_THRESHOLD) {
+            std::swap(right[0], right[right_count / 4]);
+            std::swap(right[right_count - 1], right[right_count - right_count / 4]);
+          }
+        } else if(partitioned && partialInsertionSort(a_data, left_count, a_compare) &&
+                  partialInsertionSort(right, right_count, a_compare)) {
+          return;
+        }
+
+        if(left_count < right_count) {
+          introSort(a_data, left_count, a_compare, a_bad_allowed, a_leftmost);
+          a_data = right;
+          a_count = right_count;
+          a_leftmost = false;
+        } else {
+          introSort(right, right_count, a_compare, a_bad_allowed, false);
+          a_count = left_count;
+        }
+      }
+    }
+
+    /**
+     * @brief Merges the two sorted ranges [a_data, a_data + a_left) and [a_data + a_left, a_data + a_left + a_right).
+     *
+     * @param a_buffer uninitialized memory for at least min(a_left, a_right) elements
+     */
+    template <typename T, typename Compare>
+    void merge(T* a_data, const Size a_left, const Size a_right, T* a_buffer, Compare& a_compare) {
+      T* right = a_data + a_left;
+
+      if(a_left <= a_right) {
+        // move the left half out of the way and merge from the front
+        for(Size i = 0; i < a_left; ++i)
+          std::construct_at(a_buffer + i, std::move(a_data[i]));
+
+        Size i = 0, j = 0, k = 0;
+        while(i < a_left && j < a_right) {
+          if(a_compare(right[j], a_buffer[i]))
+            a_data[k++] = std::move(right[j++]);
+          else
+            a_data[k++] = std::move(a_buffer[i++]);
+        }
+        while(i < a_left)
+          a_data[k++] = std::move(a_buffer[i++]);
+
+        std::destroy_n(a_buffer, a_left);
+      } else {
+        // move the right half out of the way and merge from the back
+        for(Size i = 0; i < a_right; ++i)
+          std::construct_at(a_buffer + i, std::move(right[i]));
+
+        Size i = a_left, j = a_right;
+        while(i > 0 && j > 0) {
+          if(a_compare(a_buffer[j - 1], a_data[i - 1])) {
+            a_data[i + j - 1] = std::move(a_data[i - 1]);
+            --i;
+          } else {
+            a_data[i + j - 1] = std::move(a_buffer[j - 1]);
+            --j;
+          }
+        }
+        while(j > 0) {
+          a_data[j - 1] = std::move(a_buffer[j - 1]);
+          --j;
+        }
+
+        std::destroy_n(a_buffer, a_right);
+      }
+    }
+  }
+
+  /**
+   * @brief Sorts the given elements using pattern-defeating quick sort (not stable).
+   *
+   * @details Runtime: O(n*log(n)) & Ω(n), where n is the number of elements.
+   *
+   * Pivots are chosen as median of 3 (ninther for big ranges), ranges with many equal elements are
+   * partitioned in linear time, already sorted ranges are detected and too many unbalanced partitions
+   * fall back to heap sort, which bounds both the runtime and the recursion depth.
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_compare the comparison returning if the left element belongs before the right one
+   */
+  template <typename T, typename Compare = Less<T>>
+  void IntroSort(T* a_data, const Size a_count, Compare a_compare = {}) {
+    if(a_count > 1)
+      detail::introSort(a_data, a_count, a_compare, std::bit_width(a_count), true);
+  }
+
+  /**
+   * @brief Sorts the given elements using bottom-up merge sort (stable).
+   *
+   * @details Runtime: O(n*log(n)) & Ω(n), where n is the number of elements.
+   *
+   * Runs of MERGE_RUN_LENGTH elements are sorted using insertion sort first, then merged using a single
+   * buffer of n / 2 elements. Neighbouring runs which are already in order aren't merged at all.
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_compare the comparison returning if the left element belongs before the right one
+   */
+  template <typename T, typename Compare = Less<T>>
+  void MergeSort(T* a_data, const Size a_count, Compare a_compare = {}) {
+    for(Size from = 0; from < a_count; from += MERGE_RUN_LENGTH)
+      InsertionSort(a_data + from, std::min(MERGE_RUN_LENGTH, a_count - from), a_compare);
+
+    if(a_count <= MERGE_RUN_LENGTH)
+      return;
+
+    std::allocator<T> allocator{};
+    T* buffer = allocator.allocate(a_count / 2);
+
+    for(Size width = MERGE_RUN_LENGTH; width < a_count; width *= 2) {
+      for(Size from = 0; from + width < a_count; from += 2 * width) {
+        const Size middle = from + width, to = std::min(from + 2 * width, a_count);
+
+        if(a_compare(a_data[middle], a_data[middle - 1]))
+          detail::merge(a_data + from, width, to - middle, buffer, a_compare);
+      }
+    }
+
+    allocator.deallocate(buffer, a_count / 2);
+  }
+
+  /**
+   * @brief Merges two neighbouring sorted ranges [a_data, a_data + a_left) and [a_data + a_left, a_data + a_left + a_right) (stable).
+   *
+   * @details Runtime: O(n), where n is the total number of elements.
+   *
+   * Only the smaller range is moved into a temporary buffer.
+   *
+   * @param a_data the first element of the left range
+   * @param a_left the number of elements in the left range
+   * @param a_right the number of elements in the right range
+   * @param a_compare the comparison returning if the left element belongs before the right one
+   */
+  template <typename T, typename Compare = Less<T>>
+  void Merge(T* a_data, const Size a_left, const Size a_right, Compare a_compare = {}) {
+    if(a_left == 0 || a_right == 0 || !a_compare(a_data[a_left], a_data[a_left - 1]))
+      return;
+
+    const Size buffer_size = std::min(a_left, a_right);
+    std::allocator<T> allocator{};
+    T* buffer = allocator.allocate(buffer_size);
+
+    detail::merge(a_data, a_left, a_right, buffer, a_compare);
+
+    allocator.deallocate(buffer, buffer_size);
+  }
+
+  namespace detail {
+    /**
+     * @brief Unsigned integer of the same size as T.
+     */
+    template <typename T>
+    using RadixKey = std::conditional_t<sizeof(T) == 1, U8,
+                     std::conditional_t<sizeof(T) == 2, U16, std::conditional_t<sizeof(T) == 4, U32, U64>>>;
+
+    /**
+     * @brief Maps a number onto an unsigned key with the same order.
+     *
+     * @param a_value the number
+     * @return the key
+     */
+    template <typename T>
+    constexpr RadixKey<T> radixKey(const T a_value) {
+      using Key = RadixKey<T>;
+      constexpr Key sign = static_cast<Key>(Key{1} << (sizeof(T) * 8 - 1));
+
+      if constexpr(std::is_floating_point_v<T>) {
+        // negative values are ordered reversed, so all their bits are flipped, positive ones only get the sign bit
+        const Key bits = std::bit_cast<Key>(a_value);
+        return (bits & sign) ? static_cast<Key>(~bits) : static_cast<Key>(bits | sign);
+      } else if constexpr(std::is_signed_v<T>) {
+        return static_cast<Key>(static_cast<Key>(a_value) ^ sign);
+      } else {
+        return static_cast<Key>(a_value);
+      }
+    }
+
+    /**
+     * @brief Sorts numbers using a least significant digit radix sort over bytes (stable).
+     *
+     * @details Runtime: O(n * k), where n is the number of elements and k the size of an element in bytes.
+     *
+     * The histograms of all bytes are counted in a single pass and bytes which are equal for all elements are skipped.
+     */
+    template <typename T>
+    void lsdRadixSort(T* a_data, const Size a_count) {
+      constexpr Size passes = sizeof(T);
+      Size counts[passes][256] = {};
+
+      for(Size i = 0; i < a_count; ++i) {
+        const auto key = radixKey(a_data[i]);
+        for(Size pass = 0; pass < passes; ++pass)
+          counts[pass][(key >> (pass * 8)) & 0xff]++;
+      }
+
+      std::allocator<T> allocator{};
+      T* buffer = allocator.allocate(a_count);
+      T* from = a_data;
+      T* to = buffer;
+
+      for(Size pass = 0; pass < passes; ++pass) {
+        Size* count = counts[pass];
+        const auto digit = [pass](const T a_value) { return (radixKey(a_value) >> (pass * 8)) & 0xff; };
+
+        if(count[digit(from[0])] == a_count)
+          continue;
+
+        for(Size bucket = 0, offset = 0; bucket < 256; ++bucket) {
+          const Size size = count[bucket];
+          count[bucket] = offset;
+          offset += size;
+        }
+
+        for(Size i = 0; i < a_count; ++i)
+          to[count[digit(from[i])]++] = from[i];
+
+        std::swap(from, to);
+      }
+
+      if(from != a_data)
+        std::copy(from, from + a_count, a_data);
+
+      allocator.deallocate(buffer, a_count);
+    }
+
+    /**
+     * @brief Sorts strings using the in-place most significant digit radix sort known as American flag sort.
+     *
+     * @details Runtime: O(n * k), where n is the number of elements and k the length of the distinguishing prefixes.
+     *
+     * @param a_data the first element
+     * @param a_count the number of elements
+     * @param a_depth the number of leading characters shared by all elements
+     * @param a_level the number of bucket splits above this range
+     */
+    template <typename T>
+    void americanFlagSort(T* a_data, const Size a_count, Size a_depth, const Size a_level) {
+      if(a_level > STRING_RADIX_MAX_LEVELS) {
+        IntroSort(a_data, a_count);
+        return;
+      }
+
+      // bucket 0 holds the strings ending at the current depth, which are equal and come first
+      const auto bucket = [&a_depth](const T& a_value) -> Size {
+        const Size length = a_value.GetLength();
+        return a_depth < length ? static_cast<unsigned char>(a_value.GetCString()[a_depth]) + Size{1} : 0;
+      };
+
+      Size next[257];
+      Size ends[257];
+
+      while(true) {
+        if(a_count < INSERTION_SORT_THRESHOLD) {
+          InsertionSort(a_data, a_count);
+          return;
+        }
+
+        std::fill_n(ends, 257, Size{0});
+        for(Size i = 0; i < a_count; ++i)
+          ends[bucket(a_data[i])]++;
+
+        // all strings share the next character, so there's nothing to permute
+        const Size first = bucket(a_data[0]);
+        if(ends[first] == a_count) {
+          if(first == 0)
+            return;
+          a_depth++;
+          continue;
+        }
+
+        for(Size b = 0, offset = 0; b < 257; ++b) {
+          next[b] = offset;
+          offset += ends[b];
+          ends[b] = offset;
+        }
+
+        for(Size b = 0; b < 257; ++b) {
+          while(next[b] < ends[b]) {
+            const Size target = bucket(a_data[next[b]]);
+            if(target == b)
+              next[b]++;
+            else
+              std::swap(a_data[next[b]], a_data[next[target]++]);
+          }
+        }
+
+        for(Size b = 1; b < 257; ++b) {
+          const Size size = ends[b] - ends[b - 1];
+          if(size > 1)
+            americanFlagSort(a_data + ends[b - 1], size, a_depth + 1, a_level + 1);
+        }
+        return;
+      }
+    }
+  }
+
+  /**
+   * @brief Sorts the given elements by their bytes instead of comparing them.
+   *
+   * @details Runtime: O(n * k), where n is the number of elements and k the size of the keys.
+   *
+   * Numbers use a least significant digit radix sort (stable, needs a buffer of n elements), strings
+   * use the in-place American flag sort (equal strings may be reordered). The elements are ordered
+   * like operator< orders them.
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   */
+  template <typename T>
+    requires radix_sortable<T>
+  void RadixSort(T* a_data, const Size a_count) {
+    if(a_count < INSERTION_SORT_THRESHOLD) {
+      InsertionSort(a_data, a_count);
+      return;
+    }
+
+    if constexpr(radix_sortable_number<T>)
+      detail::lsdRadixSort(a_data, a_count);
+    else
+      detail::americanFlagSort(a_data, a_count, 0, 0);
+  }
+
+  /**
+   * @brief Sorts the given elements using the given algorithm.
+   *
+   * @details DYNAMIC
+   *  - returns after a linear scan if the elements are sorted already (and reverses strictly descending ones),
+   *  - uses insertion sort for small ranges,
+   *  - uses RadixSort for big ranges of radix sortable types compared by operator<,
+   *  - uses IntroSort for arithmetic, enumeration and pointer types compared by operator<, where equal elements
+   *    are indistinguishable,
+   *  - and the stable MergeSort for all other types.
+   *
+   * QUICK_SORT and INTRO_SORT both use IntroSort. PARALLEL_MERGE_SORT uses MergeSort on the calling
+   * thread (see parallel::Sort for the parallel version). RADIX_SORT falls back to DYNAMIC unless the type is
+   * radix sortable and compared by operator<.
+   *
+   * @param a_data the first element
+   * @param a_count the number of elements
+   * @param a_algorithm the sorting algorithm to use
+   * @param a_compare the comparison returning if the left element belongs before the right one
+   */
+  template <typename T, typename Compare = Less<T>>
+  void Sort(T* a_data, const Size a_count, const algorithms::Sort a_algorithm, Compare a_compare = {}) {
+    switch(a_algorithm) {
+      case algorithms::Sort::INSERTION_SORT:
+        InsertionSort(a_data, a_count, a_compare);
+        break;
+      case algorithms::Sort::QUICK_SORT:
+      case algorithms::Sort::INTRO_SORT:
+        IntroSort(a_data, a_count, a_compare);
+        break;
+      case algorithms::Sort::MERGE_SORT:
+      case algorithms::Sort::PARALLEL_MERGE_SORT:
+        MergeSort(a_data, a_count, a_compare);
+        break;
+      case algorithms::Sort::HEAP_SORT:
+        HeapSort(a_data, a_count, a_compare);
+        break;
+      case algorithms::Sort::RADIX_SORT:
+        if constexpr(radix_sortable<T> && std::is_same_v<Compare, Less<T>>) {
+          RadixSort(a_data, a_count);
+        } else {
+          Sort(a_data, a_count, algorithms::Sort::DYNAMIC, a_compare);
+        }
+        break;
+      case algorithms::Sort::DYNAMIC:
+      default: {
+        VERIFY(a_algorithm == algorithms::Sort::DYNAMIC)
+
+        if(a_count < 2)
+          return;
+
+        Size ascending = 1;
+        while(ascending < a_count && !a_compare(a_data[ascending], a_data[ascending - 1]))
+          ascending++;
+        if(ascending == a_count)
+          return;
+
+        if(ascending == 1) {
+          Size descending = 1;
+          while(descending < a_count && a_compare(a_data[descending], a_data[descending - 1]))
+            descending++;
+          if(descending == a_count) {
+            std::reverse(a_data, a_data + a_count);
+            return;
+          }
+        }
+
+        if(a_count < INSERTION_SORT_THRESHOLD) {
+          InsertionSort(a_data, a_count, a_compare);
+          return;
+        }
+
+        if constexpr(radix_sortable<T> && std::is_same_v<Compare, Less<T>>) {
+          constexpr Size threshold = radix_sortable_number<T> ? RADIX_SORT_THRESHOLD * sizeof(T) : RADIX_SORT_THRESHOLD;
+          if(a_count >= threshold) {
+            RadixSort(a_data, a_count);
+            return;
+          }
+        }
+
+        if constexpr((std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+                      std::is_same_v<Compare, Less<T>>)
+          IntroSort(a_data, a_count, a_compare);
+        else
+          MergeSort(a_data, a_count, a_compare);
+        break;
+      }
+    }
+  }
+}
+
+#endif // NTL_SORT_UTILS_HPP
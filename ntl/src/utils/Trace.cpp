@@ -0,0 +1,175 @@
+/**
+* @file Trace.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include "Trace.hpp"
+
+#include <chrono>
+
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+#include "os/Atomic.hpp"
+#include "os/FileWriter.hpp"
+#include "os/SpinLock.hpp"
+#include "os/Time.hpp"
+
+namespace ntl::trace {
+  namespace {
+    using Order = Atomic<Size>::MemoryOrder;
+
+    struct Event {
+      const char* name;
+      U64 begin;
+      U64 end;
+    };
+
+    /**
+     * @brief Ring buffer of one thread, written only by that thread and read only while flushing.
+     */
+    struct Buffer {
+      Event events[BUFFER_CAPACITY];
+      Atomic<Size> head{0};
+      Atomic<Size> tail{0};
+      Atomic<Size> retired{0};
+      U32 thread;
+      Buffer* next;
+    };
+
+    // a spin lock, as the zones of the blocking locks would otherwise record into the registry they wait for
+    SpinLock g_lock;
+    Buffer* g_buffers = nullptr;
+    U32 g_next_thread = 0;
+    Atomic<U64> g_dropped{0};
+
+    /**
+     * @brief Frees the buffer of the thread when the thread ends, or retires it if events are left for the next flush.
+     */
+    struct Owner {
+      Buffer* buffer = nullptr;
+
+      ~Owner() {
+        if(!buffer)
+          return;
+
+        g_lock.Acquire();
+        if(buffer->head.Load<Order::Relaxed>() != buffer->tail.Load<Order::Relaxed>()) {
+          buffer->retired.Store<Order::Release>(1);
+        } else {
+          Buffer** link = &g_buffers;
+          while(*link != buffer)
+            link = &(*link)->next;
+          *link = buffer->next;
+          delete buffer;
+        }
+        g_lock.Release();
+
+        buffer = nullptr;
+      }
+    };
+
+    thread_local Owner t_owner;
+
+    Buffer& buffer() {
+      if(!t_owner.buffer) {
+        auto* created = new Buffer{};
+
+        g_lock.Acquire();
+        created->thread = g_next_thread++;
+        created->next = g_buffers;
+        g_buffers = created;
+        g_lock.Release();
+
+        t_owner.buffer = created;
+      }
+      return *t_owner.buffer;
+    }
+
+    // microseconds with three decimals, as the viewers expect microseconds
+    void appendMicroseconds(StringBuilder& a_builder, const U64 a_nanoseconds) {
+      const U64 fraction = a_nanoseconds % 1000;
+      a_builder.Append(a_nanoseconds / 1000).Append('.');
+      if(fraction < 100)
+        a_builder.Append('0');
+      if(fraction < 10)
+        a_builder.Append('0');
+      a_builder.Append(fraction);
+    }
+
+    void appendEvent(StringBuilder& a_builder, const Event& a_event, const U32 a_thread, const bool a_first) {
+      a_builder.Append(a_first ? "\n{\"name\":\"" : ",\n{\"name\":\"");
+      for(const char* c = a_event.name; *c; ++c) {
+        if(*c == '"' || *c == '\\')
+          a_builder.Append('\\');
+        a_builder.Append(*c);
+      }
+      a_builder.Append("\",\"cat\":\"ntl\",\"ph\":\"X\",\"ts\":");
+      appendMicroseconds(a_builder, a_event.begin);
+      a_builder.Append(",\"dur\":");
+      appendMicroseconds(a_builder, a_event.end - a_event.begin);
+      a_builder.Append(",\"pid\":1,\"tid\":").Append(a_thread).Append('}');
+    }
+  }
+
+  U64 Now() {
+    static const time::Clock::time_point epoch = time::Clock::now();
+    return static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(time::Clock::now() - epoch).count());
+  }
+
+  void Record(const char* a_name, const U64 a_begin, const U64 a_end) {
+    Buffer& target = buffer();
+
+    const Size head = target.head.Load<Order::Relaxed>();
+    if(head - target.tail.Load<Order::Acquire>() == BUFFER_CAPACITY) {
+      g_dropped.FetchAdd<Atomic<U64>::MemoryOrder::Relaxed>(1);
+      return;
+    }
+
+    target.events[head % BUFFER_CAPACITY] = {a_name, a_begin, a_end};
+    target.head.Store<Order::Release>(head + 1);
+  }
+
+  String Flush() {
+    StringBuilder builder{};
+    builder.Append("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    bool first = true;
+    g_lock.Acquire();
+    for(Buffer** link = &g_buffers; *link;) {
+      Buffer* current = *link;
+      // read before draining, so no event recorded before retiring is missed
+      const bool retired = current->retired.Load<Order::Acquire>() != 0;
+
+      const Size head = current->head.Load<Order::Acquire>();
+      for(Size i = current->tail.Load<Order::Relaxed>(); i != head; ++i) {
+        appendEvent(builder, current->events[i % BUFFER_CAPACITY], current->thread, first);
+        first = false;
+      }
+      current->tail.Store<Order::Release>(head);
+
+      if(retired) {
+        *link = current->next;
+        delete current;
+      } else {
+        link = &current->next;
+      }
+    }
+    g_lock.Release();
+
+    builder.Append("\n]}\n");
+    return builder.Build();
+  }
+
+  bool Flush(const StringView a_path) {
+    const String document = Flush();
+
+    FileWriter writer{};
+    return writer.Open(a_path) && writer.Write(StringView{document}) && writer.Close();
+  }
+
+  U64 GetDroppedCount() {
+    return g_dropped.Load<Atomic<U64>::MemoryOrder::Relaxed>();
+  }
+}
@@ -0,0 +1,127 @@
+/**
+* @file Trace.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_TRACE_UTILS_HPP
+#define NTL_TRACE_UTILS_HPP
+
+#include "core/Platform.hpp"
+#include "data/Integer.hpp"
+#include "data/Size.hpp"
+#include "data/StringView.hpp"
+
+#define NTL_TRACE_CONCAT_IMPL(a, b) a##b
+#define NTL_TRACE_CONCAT(a, b) NTL_TRACE_CONCAT_IMPL(a, b)
+
+#if NTL_PROFILE
+  // records the time from here to the end of the enclosing scope as a zone of the given name
+  #define NTL_PROFILE_SCOPE(name) const ::ntl::trace::Zone NTL_TRACE_CONCAT(ntl_trace_zone_, __LINE__){name}
+#else
+  #define NTL_PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
+
+namespace ntl {
+  class String;
+}
+
+/**
+ * @brief Timelines of named zones, exported in the Chrome trace event format (chrome://tracing, Perfetto).
+ *
+ * @details Every thread records its zones into its own ring buffer of BUFFER_CAPACITY events, which only it writes
+ * and only the flusher reads, so recording never locks. A full buffer drops the events until the next flush.
+ * The buffers of finished threads are kept until their events are flushed. The zones are only placed if
+ * NTL_PROFILE is 1 (see NTL_PROFILE_SCOPE), the functions themselves are always available.
+ */
+namespace ntl::trace {
+  /**
+   * @brief Number of events every thread buffers between two flushes.
+   */
+  constexpr Size BUFFER_CAPACITY = 8192;
+
+  /**
+   * @brief Gets the current time of the trace.
+   *
+   * @return the nanoseconds since the start of the process
+   */
+  [[nodiscard]] U64 Now();
+
+  /**
+   * @brief Records a finished zone into the buffer of the calling thread.
+   *
+   * @details Runtime: O(1)
+   *
+   * @param a_name the name of the zone, which has to outlive the next flush (usually a literal)
+   * @param a_begin the time the zone began (see Now)
+   * @param a_end the time the zone ended (see Now)
+   */
+  void Record(const char* a_name, U64 a_begin, U64 a_end);
+
+  /**
+   * @brief Drains the recorded events of all threads into a trace event document.
+   *
+   * @details Runtime: O(n + t), where n is the number of recorded events and t the number of threads
+   *
+   * @return the JSON document of the drained events
+   */
+  [[nodiscard]] String Flush();
+
+  /**
+   * @brief Drains the recorded events of all threads into a trace event file.
+   *
+   * @param a_path the path of the file, which gets overwritten
+   * @return if the file was written
+   */
+  bool Flush(StringView a_path);
+
+  /**
+   * @brief Gets the number of events dropped because a buffer was full.
+   *
+   * @return the number of dropped events since the start of the process
+   */
+  [[nodiscard]] U64 GetDroppedCount();
+
+  /**
+   * @brief Records the lifetime of the object as a zone (see NTL_PROFILE_SCOPE).
+   */
+  class Zone {
+  private:
+    const char* m_name;
+    U64 m_begin;
+
+  public:
+    /**
+     * @brief Begins a zone.
+     *
+     * @param a_name the name of the zone, which has to outlive the next flush (usually a literal)
+     */
+    explicit Zone(const char* a_name) : m_name{a_name}, m_begin{Now()} {
+      // Empty
+    }
+
+    /**
+     * @brief Ends the zone and records it.
+     */
+    ~Zone() { Record(m_name, m_begin, Now()); }
+
+    /**
+     * @brief Deletes Copy Constructor.
+     *
+     * @param a_other a reference to another zone
+     */
+    Zone(const Zone& a_other) = delete;
+
+    /**
+     * @brief Deletes Copy-Assignment operator.
+     *
+     * @param a_other a reference to another zone
+     *
+     * @return the reference to the zone
+     */
+    Zone& operator=(const Zone& a_other) = delete;
+  };
+}
+
+#endif // NTL_TRACE_UTILS_HPP
@@ -0,0 +1,41 @@
+/**
+* @file Process.hpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#ifndef NTL_TESTS_PROCESS_HPP
+#define NTL_TESTS_PROCESS_HPP
+
+#include <csignal>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace ntl::test {
+  /**
+   * @brief Runs a function in a child process, so failing ENSURE checks can be tested.
+   *
+   * @param a_function the function to run
+   * @return if the function aborted the child process
+   */
+  template <typename Function>
+  bool Aborts(const Function& a_function) {
+    const pid_t child = fork();
+    if(child == 0) {
+      // the failed check is expected, so its message is dropped
+      const int null = open("/dev/null", O_WRONLY);
+      dup2(null, STDOUT_FILENO);
+      a_function();
+      _exit(0);
+    }
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    return WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT;
+  }
+}
+
+#endif // NTL_TESTS_PROCESS_HPP
@@ -7,7 +7,17 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Process.hpp"
 #include "data/Array.hpp"
+#include "os/ThreadPool.hpp"
+#include "utils/Parallel.hpp"
 
 TEST_CASE("Array functionality validation", "[data]") {
   using namespace ntl;
@@ -47,6 +57,20 @@ TEST_CASE("Array functionality validation", "[data]") {
     REQUIRE(array2.Get(2) == 8);
   }
 
+  SECTION("accessing elements without checks") {
+    Array<int> array(8);
+    for(int i = 0; i < 8; ++i)
+      array.Insert(i * i);
+
+    const Array<int>& view = array;
+    for(Size i = 0; i < 8; ++i) {
+      REQUIRE(view.GetUnchecked(i) == view[i]);
+      REQUIRE(&array.GetUnchecked(i) == &array.Get(i));
+    }
+    array.GetUnchecked(3) = 42;
+    REQUIRE(array[3] == 42);
+  }
+
   SECTION("adding elements to array") {
     Array<int> array(2, false);
     array.Insert(8);
@@ -306,6 +330,54 @@ TEST_CASE("Array functionality validation", "[data]") {
     REQUIRE(array.Find(8.8) == 1);
   }
 
+  SECTION("inserting into the automatically sorted array") {
+    Array<int> array(16, true, true);
+
+    REQUIRE(array.Insert(5) == 0);
+    REQUIRE(array.Insert(1) == 0);
+    REQUIRE(array.Insert(9) == 2);
+    REQUIRE(array.Insert(5) == 2);
+    array.Insert(3, 0);
+    array.Emplace(7);
+
+    REQUIRE(array.ToString() == "Array(1, 3, 5, 5, 7, 9)\n");
+    REQUIRE(array.Find(4) == -1);
+    REQUIRE(array.Find(10) == -1);
+    REQUIRE(array.Find(0) == -1);
+    REQUIRE(array.Find(9) == 5);
+
+    std::mt19937 random{3};
+    for (int i = 0; i < 2000; ++i)
+      array.Insert(static_cast<int>(random() % 1000));
+
+    REQUIRE(array.GetSize() == 2006);
+    for (Size i = 1; i < array.GetSize(); ++i)
+      REQUIRE(array[i - 1] <= array[i]);
+  }
+
+  SECTION("inserting elements in bulk") {
+    Array<int> sorted(4, true, true);
+    sorted.InsertBulk(std::initializer_list<int>{8, 2, 6});
+    sorted.Insert(4);
+
+    Array<int> more(8);
+    more.Insert(7);
+    more.Insert(1);
+    more.Insert(4);
+    sorted.InsertBulk(more);
+
+    REQUIRE(sorted.ToString() == "Array(1, 2, 4, 4, 6, 7, 8)\n");
+    REQUIRE(sorted.Find(7) == 5);
+
+    Array<String> unsorted(2, false, true);
+    unsorted.Insert(String{"z"});
+    const String values[] = {"b", "a", "c"};
+    unsorted.InsertBulk(values);
+
+    REQUIRE(unsorted.GetSize() == 4);
+    REQUIRE(unsorted.ToString() == "Array(z, b, a, c)\n");
+  }
+
   SECTION("sorting elements in the array using insertion sort") {
     Array<float> array(8, false);
 
@@ -558,4 +630,588 @@ TEST_CASE("Array functionality validation", "[data]") {
     }
     REQUIRE(idx == 3);
   }
+
+  SECTION("moving elements into the array") {
+    struct Counter {
+      int value = 0;
+      int* copies = nullptr;
+
+      Counter(int a_value, int* a_copies) : value(a_value), copies(a_copies) {}
+      Counter(const Counter& a_other) : value(a_other.value), copies(a_other.copies) { (*copies)++; }
+      Counter(Counter&& a_other) noexcept = default;
+      Counter& operator=(const Counter& a_other) { value = a_other.value; copies = a_other.copies; (*copies)++; return *this; }
+      Counter& operator=(Counter&& a_other) noexcept = default;
+    };
+
+    int copies = 0;
+    Array<Counter> array(1, false, true);
+    for (int i = 0; i < 64; ++i) {
+      array.Emplace(i, &copies);
+    }
+    array.Insert(Counter{100, &copies}, 0);
+    array.EmplaceAt(32, 200, &copies);
+    Counter removed = array.Remove(0);
+
+    REQUIRE(copies == 0);
+    REQUIRE(removed.value == 100);
+    REQUIRE(array.GetSize() == 65);
+    REQUIRE(array[30].value == 30);
+    REQUIRE(array[31].value == 200);
+    REQUIRE(array[32].value == 31);
+    REQUIRE(array[64].value == 63);
+  }
+
+  SECTION("growing an array of strings") {
+    Array<String> array(1, false, true);
+    for (int i = 0; i < 100; ++i) {
+      array.Insert(String{"value"} + i);
+    }
+    array.Insert(array[0], 0);
+
+    Array<String> moved(std::move(array));
+    REQUIRE(array.GetSize() == 0);
+    REQUIRE(moved.GetSize() == 101);
+    REQUIRE(moved[0] == "value0");
+    REQUIRE(moved[1] == "value0");
+    REQUIRE(moved[100] == "value99");
+    REQUIRE(moved.Remove(100) == "value99");
+
+    Array<String> copy(1);
+    copy = moved;
+    moved.Clear();
+    REQUIRE(copy.GetSize() == 100);
+    REQUIRE(copy[50] == "value49");
+  }
+
+  SECTION("sorting big arrays using every algorithm") {
+    std::mt19937 random{42};
+    const Size size = 5000;
+
+    const auto check = [](const Array<int>& a_array) {
+      for (Size i = 1; i < a_array.GetSize(); ++i) {
+        if (a_array[i] < a_array[i - 1])
+          return false;
+      }
+      return true;
+    };
+
+    for (const auto algorithm : {algorithms::Sort::DYNAMIC, algorithms::Sort::QUICK_SORT, algorithms::Sort::INTRO_SORT,
+                                 algorithms::Sort::MERGE_SORT, algorithms::Sort::HEAP_SORT,
+                                 algorithms::Sort::PARALLEL_MERGE_SORT, algorithms::Sort::RADIX_SORT}) {
+      Array<int> shuffled(size), ascending(size), descending(size), equal(size), organ_pipe(size), few_values(size);
+
+      for (Size i = 0; i < size; ++i) {
+        shuffled.Insert(static_cast<int>(random()));
+        ascending.Insert(static_cast<int>(i));
+        descending.Insert(static_cast<int>(size - i));
+        equal.Insert(7);
+        organ_pipe.Insert(static_cast<int>(i < size / 2 ? i : size - i));
+        few_values.Insert(static_cast<int>(random() % 4));
+      }
+
+      I64 sum = 0;
+      for (int value : shuffled)
+        sum += value;
+
+      for (Array<int>* array : {&shuffled, &ascending, &descending, &equal, &organ_pipe, &few_values}) {
+        array->Sort(algorithm);
+        REQUIRE(array->GetSize() == size);
+        REQUIRE(check(*array));
+      }
+
+      I64 sorted_sum = 0;
+      for (int value : shuffled)
+        sorted_sum += value;
+      REQUIRE(sorted_sum == sum);
+    }
+  }
+
+  SECTION("sorting stably") {
+    struct Entry {
+      int key;
+      int order;
+
+      bool operator<(const Entry& a_other) const { return key < a_other.key; }
+    };
+
+    std::mt19937 random{7};
+
+    for (const auto algorithm : {algorithms::Sort::DYNAMIC, algorithms::Sort::MERGE_SORT, algorithms::Sort::INSERTION_SORT,
+                                 algorithms::Sort::PARALLEL_MERGE_SORT}) {
+      Array<Entry> array(1000);
+      for (int i = 0; i < 1000; ++i)
+        array.Insert(Entry{static_cast<int>(random() % 10), i});
+
+      array.Sort(algorithm);
+
+      for (Size i = 1; i < array.GetSize(); ++i) {
+        REQUIRE(array[i - 1].key <= array[i].key);
+        if (array[i - 1].key == array[i].key)
+          REQUIRE(array[i - 1].order < array[i].order);
+      }
+    }
+  }
+
+  SECTION("radix sorting elements without a radix key") {
+    struct Entry {
+      int key;
+
+      bool operator==(const Entry& a_other) const { return key == a_other.key; }
+      bool operator<(const Entry& a_other) const { return key < a_other.key; }
+    };
+
+    // falls back to the dynamic sort, so the binary search of Find still sees sorted elements
+    Array<Entry> array(1000);
+    for (int i = 0; i < 1000; ++i)
+      array.Insert(Entry{(i * 7919) % 1000});
+    array.Sort(algorithms::Sort::RADIX_SORT);
+
+    for (Size i = 1; i < array.GetSize(); ++i)
+      REQUIRE(array[i - 1].key < array[i].key);
+    REQUIRE(array.Find(Entry{0}) == 0);
+    REQUIRE(array.Find(Entry{123}) == 123);
+    REQUIRE(array.Find(Entry{999}) == 999);
+    REQUIRE(array.Find(Entry{1000}) == -1);
+  }
+
+  SECTION("sorting and searching in parallel") {
+    std::mt19937 random{13};
+    const Size size = 200000;
+
+    Array<int> array(size, false);
+    for (Size i = 0; i < size; ++i)
+      array.Insert(static_cast<int>(random() % 100000));
+
+    array.Sort(algorithms::Sort::PARALLEL_MERGE_SORT);
+    REQUIRE(array.GetSize() == size);
+    for (Size i = 1; i < size; ++i)
+      REQUIRE_FALSE(array[i] < array[i - 1]);
+
+    Array<int> unsorted(size, false);
+    for (Size i = 0; i < size; ++i)
+      unsorted.Insert(static_cast<int>(i % 1000));
+    unsorted[150000] = -1;
+    unsorted[190000] = -1;
+
+    const I64 last = static_cast<I64>(size) - 1;
+    REQUIRE(unsorted.Find(-1, 0, last, algorithms::Search::PARALLEL_SEARCH) == 150000);
+    REQUIRE(unsorted.Find(-1, 150001, last, algorithms::Search::PARALLEL_SEARCH) == 190000);
+    REQUIRE(unsorted.Find(-2, 0, last, algorithms::Search::PARALLEL_SEARCH) == -1);
+    REQUIRE(unsorted.Find(999, 0, last, algorithms::Search::PARALLEL_SEARCH) == 999);
+  }
+
+  SECTION("sorting stably in parallel with small chunks") {
+    struct Entry {
+      int key;
+      int order;
+
+      bool operator<(const Entry& a_other) const { return key < a_other.key; }
+    };
+
+    ThreadPool pool{3};
+    std::mt19937 random{21};
+
+    for (const Size size : {Size{0}, Size{1}, Size{5}, Size{1000}, Size{12345}}) {
+      Array<Entry> array(size + 1, false);
+      for (Size i = 0; i < size; ++i)
+        array.Insert(Entry{static_cast<int>(random() % 50), static_cast<int>(i)});
+
+      parallel::Sort(array.GetData(), array.GetSize(), sort::Less<Entry>{}, 100, pool);
+
+      for (Size i = 1; i < array.GetSize(); ++i) {
+        REQUIRE(array[i - 1].key <= array[i].key);
+        if (array[i - 1].key == array[i].key)
+          REQUIRE(array[i - 1].order < array[i].order);
+      }
+    }
+  }
+
+  SECTION("transforming and reducing in parallel") {
+    ThreadPool pool{4};
+    const Size size = 100000;
+
+    Array<I64> array(size, false);
+    for (Size i = 0; i < size; ++i)
+      array.Insert(static_cast<I64>(i));
+
+    I64* data = array.GetData();
+    parallel::For(0, size, [data](const Size a_from, const Size a_to) {
+      for (Size i = a_from; i < a_to; ++i)
+        data[i] *= 2;
+    }, 1000, pool);
+
+    const I64 sum = parallel::Reduce(0, size, I64{0}, [data](const Size a_from, const Size a_to) {
+      I64 partial = 0;
+      for (Size i = a_from; i < a_to; ++i)
+        partial += data[i];
+      return partial;
+    }, [](const I64 a_left, const I64 a_right) { return a_left + a_right; }, 1000, pool);
+
+    REQUIRE(sum == static_cast<I64>(size) * static_cast<I64>(size - 1));
+    REQUIRE(parallel::FindIf(data, size, [](const I64 a_value) { return a_value > 1000; }, 1000, pool) == 501);
+
+    // reductions combine the chunks in order
+    const String joined = parallel::Reduce(0, 20, String{}, [](const Size a_from, const Size a_to) {
+      String part{};
+      for (Size i = a_from; i < a_to; ++i)
+        part.Append(static_cast<char>('a' + i));
+      return part;
+    }, [](String a_left, const String& a_right) { return std::move(a_left.Append(a_right)); }, 3, pool);
+    REQUIRE(joined == "abcdefghijklmnopqrst");
+
+    // nested groups help executing the tasks while waiting
+    Atomic<Size> count{0};
+    parallel::For(0, 64, [&](const Size a_from, const Size a_to) {
+      for (Size i = a_from; i < a_to; ++i) {
+        parallel::For(0, 100, [&](const Size a_inner_from, const Size a_inner_to) {
+          count.FetchAdd(a_inner_to - a_inner_from);
+        }, 10, pool);
+      }
+    }, 1, pool);
+    REQUIRE(count.Load() == 6400);
+  }
+
+  SECTION("searching sorted arrays without branches") {
+    for (Size size = 1; size < 40; ++size) {
+      Array<int> array(size, false);
+      for (Size i = 0; i < size; ++i)
+        array.Insert(static_cast<int>(i - i % 3));
+      array.Sort();
+
+      const I64 last = static_cast<I64>(size) - 1;
+      for (int value = -1; value <= static_cast<int>(size); ++value) {
+        const I64 expected = array.Find(value, 0, last, algorithms::Search::BINARY_SEARCH);
+        REQUIRE(array.Find(value, 0, last, algorithms::Search::BRANCHLESS_SEARCH) == expected);
+        REQUIRE(array.Find(value, last / 2, last, algorithms::Search::BRANCHLESS_SEARCH) ==
+                array.Find(value, last / 2, last, algorithms::Search::BINARY_SEARCH));
+
+        I64 result = 0;
+        array.FindMany(&value, 1, &result);
+        REQUIRE(result == expected);
+      }
+    }
+  }
+
+  SECTION("sorting numbers using radix sort") {
+    std::mt19937_64 random{99};
+
+    const auto check = [](const auto& a_array, auto a_expected) {
+      std::sort(a_expected.begin(), a_expected.end());
+      for (Size i = 0; i < a_array.GetSize(); ++i) {
+        if (!(a_array[i] == a_expected[i]))
+          return false;
+      }
+      return a_array.GetSize() == a_expected.size();
+    };
+
+    for (const auto algorithm : {algorithms::Sort::RADIX_SORT, algorithms::Sort::DYNAMIC}) {
+      Array<U64> unsigned_keys(20000, false);
+      Array<I64> signed_keys(20000, false);
+      Array<I8> small_keys(20000, false);
+      Array<double> floating_keys(20010, false);
+      std::vector<U64> unsigned_expected;
+      std::vector<I64> signed_expected;
+      std::vector<I8> small_expected;
+      std::vector<double> floating_expected;
+
+      for (Size i = 0; i < 20000; ++i) {
+        const U64 value = random();
+        // only the low bytes differ for some keys, so passes are skipped for those
+        const U64 key = i % 2 ? value : value & 0xffff;
+
+        unsigned_keys.Insert(key);
+        signed_keys.Insert(static_cast<I64>(value));
+        small_keys.Insert(static_cast<I8>(value));
+        floating_keys.Insert(static_cast<double>(static_cast<I64>(value)) / 1e9);
+        unsigned_expected.push_back(key);
+        signed_expected.push_back(static_cast<I64>(value));
+        small_expected.push_back(static_cast<I8>(value));
+        floating_expected.push_back(static_cast<double>(static_cast<I64>(value)) / 1e9);
+      }
+
+      for (const double special : {0.0, -1.5, 1.5, -1e300, 1e300, std::numeric_limits<double>::infinity(),
+                                   -std::numeric_limits<double>::infinity()}) {
+        floating_keys.Insert(special);
+        floating_expected.push_back(special);
+      }
+
+      unsigned_keys.Sort(algorithm);
+      signed_keys.Sort(algorithm);
+      small_keys.Sort(algorithm);
+      floating_keys.Sort(algorithm);
+
+      REQUIRE(check(unsigned_keys, unsigned_expected));
+      REQUIRE(check(signed_keys, signed_expected));
+      REQUIRE(check(small_keys, small_expected));
+      REQUIRE(check(floating_keys, floating_expected));
+      REQUIRE(floating_keys[0] == -std::numeric_limits<double>::infinity());
+    }
+  }
+
+  SECTION("sorting strings using radix sort") {
+    std::mt19937 random{5};
+
+    for (const auto algorithm : {algorithms::Sort::RADIX_SORT, algorithms::Sort::DYNAMIC}) {
+      Array<String> array(5300, false);
+      std::vector<std::string> expected;
+
+      for (Size i = 0; i < 5000; ++i) {
+        String value{};
+        // long shared prefixes, empty strings, prefixes of each other and bytes above 127
+        if (i % 3 == 0)
+          value.Append("a shared prefix which is longer than usual/");
+        const Size length = random() % 12;
+        for (Size j = 0; j < length; ++j)
+          value.Append(static_cast<char>(i % 7 == 0 ? 'a' + random() % 3 : random() % 255 + 1));
+
+        expected.emplace_back(value.GetCString(), value.GetLength());
+        array.Insert(std::move(value));
+      }
+
+      // long equal runs of characters nest many bucket splits
+      for (Size i = 0; i < 300; ++i) {
+        String value{};
+        for (Size j = 0; j < i; ++j)
+          value.Append('z');
+
+        expected.emplace_back(value.GetCString(), value.GetLength());
+        array.Insert(std::move(value));
+      }
+
+      array.Sort(algorithm);
+
+      // std::string compares the characters as unsigned bytes like String does
+      std::sort(expected.begin(), expected.end());
+
+      REQUIRE(array.GetSize() == expected.size());
+      for (Size i = 0; i < array.GetSize(); ++i)
+        REQUIRE(array[i] == expected[i].c_str());
+      for (Size i = 1; i < array.GetSize(); ++i)
+        REQUIRE_FALSE(array[i] < array[i - 1]);
+    }
+  }
+
+  SECTION("sorting big arrays of strings") {
+    Array<String> array(300);
+    for (int i = 299; i >= 0; --i)
+      array.Insert(String{"value"} + (i * 7919) % 300);
+
+    array.Sort(algorithms::Sort::MERGE_SORT);
+    for (Size i = 1; i < array.GetSize(); ++i)
+      REQUIRE(array[i - 1] < array[i]);
+
+    array.Sort(algorithms::Sort::INTRO_SORT);
+    REQUIRE(array[0] == "value0");
+    REQUIRE(array[299] == "value99");
+  }
+
+  SECTION("sorting an array of strings") {
+    Array<String> array(8, false);
+    array.Insert("d");
+    array.Insert("bb");
+    array.Insert("ccc");
+    array.Insert("a");
+
+    array.Sort(algorithms::Sort::INSERTION_SORT);
+    REQUIRE(array.GetSize() == 4);
+    REQUIRE(array[0] == "a");
+    REQUIRE(array[1] == "bb");
+    REQUIRE(array[2] == "ccc");
+    REQUIRE(array[3] == "d");
+  }
+
+  SECTION("constructing from an initializer list and iterators") {
+    Array<int> array{3, 1, 2};
+    REQUIRE(array.GetSize() == 3);
+    REQUIRE(array[0] == 3);
+    REQUIRE(array[2] == 2);
+
+    const std::vector<int> values{5, 4, 6};
+    Array<int> sorted(values.begin(), values.end(), true);
+    REQUIRE(sorted.GetSize() == 3);
+    REQUIRE(sorted[0] == 4);
+    REQUIRE(sorted[1] == 5);
+    REQUIRE(sorted[2] == 6);
+
+    Array<String> strings{String{"a"}, String{"b"}};
+    REQUIRE(strings.GetSize() == 2);
+    REQUIRE(strings[1] == "b");
+  }
+
+  SECTION("reserving and shrinking the capacity") {
+    Array<int> array(4, false, true);
+    array.Reserve(100);
+    REQUIRE(array.GetCapacity() == 100);
+    array.Reserve(10);
+    REQUIRE(array.GetCapacity() == 100);
+
+    for(int i = 0; i < 10; ++i)
+      array.Insert(i);
+    array.ShrinkToFit();
+    REQUIRE(array.GetCapacity() == 10);
+    REQUIRE(array[9] == 9);
+  }
+
+  SECTION("inserting ranges") {
+    const std::vector<int> values{7, 8, 9};
+
+    Array<int> array(2, false, true);
+    array.Insert(1);
+    array.Insert(2);
+    array.InsertRange(values.begin(), values.end());
+    REQUIRE(array.GetSize() == 5);
+    REQUIRE(array[4] == 9);
+
+    array.InsertRange(values.begin(), values.end(), 1);
+    REQUIRE(array.GetSize() == 8);
+    const int expected[] = {1, 7, 8, 9, 2, 7, 8, 9};
+    for(Size i = 0; i < array.GetSize(); ++i)
+      REQUIRE(array[i] == expected[i]);
+
+    Array<String> strings(2, false, true);
+    strings.Insert("a");
+    strings.Insert("d");
+    const std::vector<String> middle{"b", "c"};
+    strings.InsertRange(middle.begin(), middle.end(), 1);
+    REQUIRE(strings.GetSize() == 4);
+    REQUIRE(strings[0] == "a");
+    REQUIRE(strings[1] == "b");
+    REQUIRE(strings[2] == "c");
+    REQUIRE(strings[3] == "d");
+
+    Array<int> sorted(8, true);
+    sorted.Insert(5);
+    sorted.Insert(1);
+    sorted.InsertRange(values.begin(), values.end(), 0);
+    REQUIRE(sorted.GetSize() == 5);
+    REQUIRE(sorted[0] == 1);
+    REQUIRE(sorted[1] == 5);
+    REQUIRE(sorted[4] == 9);
+  }
+
+  SECTION("inserting ranges past the capacity of a non growable array") {
+    const std::vector<int> values{7, 8, 9};
+
+    REQUIRE(test::Aborts([&values] {
+      Array<int> array(4, false, false);
+      array.Insert(1);
+      array.Insert(2);
+      array.InsertRange(values.begin(), values.end());
+    }));
+    REQUIRE(test::Aborts([&values] {
+      Array<int> array(4, false, false);
+      array.Insert(1);
+      array.Insert(2);
+      array.InsertRange(values.begin(), values.end(), 1);
+    }));
+
+    // ranges which fit don't grow the array
+    Array<int> array(5, false, false);
+    array.Insert(1);
+    array.Insert(2);
+    array.InsertRange(values.begin(), values.begin() + 2, 1);
+    array.InsertRange(values.begin() + 2, values.end());
+    REQUIRE(array.GetCapacity() == 5);
+    REQUIRE(array.GetSize() == 5);
+    const int expected[] = {1, 7, 8, 2, 9};
+    for(Size i = 0; i < array.GetSize(); ++i)
+      REQUIRE(array[i] == expected[i]);
+  }
+
+  SECTION("removing ranges") {
+    Array<int> array{0, 1, 2, 3, 4, 5};
+    array.RemoveRange(1, 3);
+    REQUIRE(array.GetSize() == 4);
+    REQUIRE(array[0] == 0);
+    REQUIRE(array[1] == 3);
+    REQUIRE(array[3] == 5);
+    array.RemoveRange(2, 2);
+    REQUIRE(array.GetSize() == 4);
+
+    Array<String> strings{String{"a"}, String{"b"}, String{"c"}, String{"d"}};
+    strings.RemoveRange(0, 2);
+    REQUIRE(strings.GetSize() == 2);
+    REQUIRE(strings[0] == "c");
+    REQUIRE(strings[1] == "d");
+  }
+
+  SECTION("removing elements by a predicate") {
+    Array<int> array(100);
+    for(int i = 0; i < 100; ++i)
+      array.Insert(i);
+
+    REQUIRE(array.RemoveIf([](const int a_value) { return a_value % 3 == 0; }) == 34);
+    REQUIRE(array.GetSize() == 66);
+    REQUIRE(array[0] == 1);
+    REQUIRE(array[1] == 2);
+    REQUIRE(array[2] == 4);
+
+    Array<String> strings{String{"keep"}, String{"drop"}, String{"keep"}};
+    REQUIRE(strings.RemoveIf([](const String& a_value) { return a_value == "drop"; }) == 1);
+    REQUIRE(strings.GetSize() == 2);
+    REQUIRE(strings[1] == "keep");
+  }
+
+  SECTION("scanning arrays of numbers") {
+    Array<I32> array(1000);
+    for(I32 i = 0; i < 1000; ++i)
+      array.Insert((i * 37) % 1000 - 500);
+
+    REQUIRE(array.Count(7) == 1);
+    REQUIRE(array.Contains(-500));
+    REQUIRE(!array.Contains(500));
+    REQUIRE(array.Min() == -500);
+    REQUIRE(array.Max() == 499);
+    REQUIRE(array.Sum() == -500);
+    REQUIRE(array.Any([](const I32 a_value) { return a_value > 498; }));
+    REQUIRE(!array.Any([](const I32 a_value) { return a_value > 499; }));
+    REQUIRE(array.All([](const I32 a_value) { return a_value >= -500; }));
+    REQUIRE(!array.All([](const I32 a_value) { return a_value < 0; }));
+
+    Array<I32> empty(4);
+    REQUIRE(empty.Count(0) == 0);
+    REQUIRE(empty.Sum() == 0);
+    REQUIRE(!empty.Any([](const I32) { return true; }));
+    REQUIRE(empty.All([](const I32) { return false; }));
+  }
+
+  SECTION("scanning arrays of small integers and floating point numbers") {
+    Array<U8> bytes(40000);
+    for(Size i = 0; i < 40000; ++i)
+      bytes.Insert(static_cast<U8>(i % 200));
+
+    REQUIRE(bytes.Count(7) == 200);
+    REQUIRE(bytes.Min() == 0);
+    REQUIRE(bytes.Max() == 199);
+    REQUIRE(bytes.Sum() == 200 * (199 * 200 / 2));
+
+    Array<double> doubles(333);
+    for(Size i = 0; i < 333; ++i)
+      doubles.Insert(static_cast<double>(i) * 0.5);
+
+    REQUIRE(doubles.Count(10.0) == 1);
+    REQUIRE(doubles.Min() == 0.0);
+    REQUIRE(doubles.Max() == 166.0);
+    REQUIRE(doubles.Sum() == 0.5 * (332 * 333 / 2));
+  }
+
+  SECTION("searching unsorted arrays from both ends") {
+    std::mt19937 generator{42};
+    for(Size size = 1; size < 300; size += 7) {
+      Array<I16> array(size);
+      for(Size i = 0; i < size; ++i)
+        array.Insert(static_cast<I16>(generator() % 16));
+
+      for(I16 value = 0; value < 17; ++value) {
+        I64 expected = -1;
+        for(I64 from = 0, to = static_cast<I64>(size) - 1; from <= to && expected < 0; ++from, --to) {
+          if(array[from] == value)
+            expected = from;
+          else if(array[to] == value)
+            expected = to;
+        }
+        REQUIRE(array.Find(value) == expected);
+      }
+    }
+  }
 }
@@ -0,0 +1,66 @@
+/**
+* @file ArrayStack.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include "data/ArrayStack.hpp"
+#include "data/String.hpp"
+
+TEST_CASE("ArrayStack functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new stack") {
+    ArrayStack<int> stack{};
+    REQUIRE(stack.GetSize() == 0);
+    REQUIRE(stack.IsEmpty());
+    REQUIRE(stack.GetCapacity() == ArrayStack<int>::DEFAULT_CAPACITY);
+  }
+
+  SECTION("pushing and popping elements") {
+    ArrayStack<int> stack{2};
+    for(int i = 0; i < 100; ++i)
+      stack.Push(i);
+    REQUIRE(stack.GetSize() == 100);
+    REQUIRE(stack.Peek() == 99);
+
+    for(int i = 99; i >= 0; --i)
+      REQUIRE(stack.Pop() == i);
+    REQUIRE(stack.IsEmpty());
+  }
+
+  SECTION("pushing and popping many elements") {
+    ArrayStack<int> stack{};
+    int elements[5] = {1, 2, 3, 4, 5};
+    stack.PushMany(elements, 5);
+    stack.Emplace(6);
+
+    int results[10]{};
+    REQUIRE(stack.PopMany(results, 4) == 4);
+    REQUIRE(results[0] == 6);
+    REQUIRE(results[3] == 3);
+    REQUIRE(stack.GetSize() == 2);
+    REQUIRE(stack.PopMany(results, 10) == 2);
+    REQUIRE(results[1] == 1);
+    REQUIRE(stack.IsEmpty());
+  }
+
+  SECTION("reserving and peeking without copying") {
+    ArrayStack<String> stack{};
+    stack.Reserve(1000);
+    REQUIRE(stack.GetCapacity() == 1000);
+
+    stack.Push(String{"top"});
+    stack.Peek().Append(String{"!"});
+    REQUIRE(stack.Peek() == "top!");
+
+    ArrayStack<String> copy(stack);
+    REQUIRE(copy.Pop() == "top!");
+    REQUIRE(stack.GetSize() == 1);
+    stack.Clear();
+    REQUIRE(stack.IsEmpty());
+  }
+}
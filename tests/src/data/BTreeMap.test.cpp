@@ -0,0 +1,204 @@
+/**
+* @file BTreeMap.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <map>
+#include <random>
+
+#include "data/BTreeMap.hpp"
+
+TEST_CASE("BTreeMap functionality validation", "[data]") {
+  using namespace ntl;
+
+  // small nodes, so a few hundred entries already need several levels
+  using SmallMap = BTreeMap<int, int, 64>;
+
+  SECTION("constructing new map") {
+    BTreeMap<int, int> map{};
+
+    REQUIRE(map.IsEmpty());
+    REQUIRE(map.GetSize() == 0);
+    REQUIRE(map.GetHeight() == 0);
+    REQUIRE(map.begin() == map.end());
+    REQUIRE(map.LowerBound(5) == map.end());
+    REQUIRE(map.ToString() == String{"BTreeMap()"});
+  }
+
+  SECTION("inserting, replacing and getting entries") {
+    BTreeMap<String, int> map{};
+    REQUIRE(map.Insert("pear", 3));
+    REQUIRE(map.Insert("apple", 1));
+    REQUIRE(map.Insert("fig", 2));
+    REQUIRE_FALSE(map.Insert("fig", 20));
+
+    REQUIRE(map.GetSize() == 3);
+    REQUIRE(map.Get("fig") == 20);
+    REQUIRE(map.TryGet("kiwi") == nullptr);
+    REQUIRE(map.Exists("apple"));
+    REQUIRE(map.GetMin() == "apple");
+    REQUIRE(map.GetMax() == "pear");
+
+    map["kiwi"] = 4;
+    REQUIRE(map.ToString() == String{"BTreeMap(apple : 1, fig : 20, kiwi : 4, pear : 3)"});
+  }
+
+  SECTION("growing and shrinking the tree") {
+    SmallMap map{};
+    for(int i = 0; i < 1000; ++i)
+      REQUIRE(map.Insert(i * 7 % 1000, i));
+
+    REQUIRE(map.GetSize() == 1000);
+    REQUIRE(map.GetHeight() > 2);
+
+    int expected = 0;
+    for(auto [key, value] : map) {
+      REQUIRE(key == expected++);
+      REQUIRE(value * 7 % 1000 == key);
+    }
+
+    for(int i = 0; i < 1000; i += 2)
+      REQUIRE(map.Remove(i));
+    REQUIRE_FALSE(map.Remove(0));
+    REQUIRE(map.GetSize() == 500);
+    REQUIRE(map.GetMin() == 1);
+
+    for(int i = 1; i < 1000; i += 2)
+      REQUIRE(map.Remove(i));
+    REQUIRE(map.IsEmpty());
+    REQUIRE(map.GetHeight() == 0);
+  }
+
+  SECTION("finding bounds and ranges") {
+    SmallMap map{};
+    for(int i = 0; i < 500; ++i)
+      map.Insert(i * 10, i);
+
+    REQUIRE(map.LowerBound(50).GetKey() == 50);
+    REQUIRE(map.LowerBound(51).GetKey() == 60);
+    REQUIRE(map.UpperBound(50).GetKey() == 60);
+    REQUIRE(map.LowerBound(4991) == map.end());
+    REQUIRE(map.Find(55) == map.end());
+    REQUIRE(map.Find(70).GetValue() == 7);
+
+    int count = 0, sum = 0;
+    for(auto entry : map.GetRange(1000, 2000)) {
+      count++;
+      sum += entry.second;
+    }
+    REQUIRE(count == 100);
+    REQUIRE(sum == (100 + 199) * 100 / 2);
+
+    const auto empty = map.GetRange(2000, 1000);
+    REQUIRE(empty.begin() == empty.end());
+  }
+
+  SECTION("bulk-loading sorted entries") {
+    Array<Pair<int, int>> entries(10000);
+    for(int i = 0; i < 10000; ++i)
+      entries.Insert({i * 2, i});
+
+    SmallMap map{};
+    map.Insert(-1, -1);
+    map.Load(entries);
+
+    REQUIRE(map.GetSize() == 10000);
+    REQUIRE_FALSE(map.Exists(-1));
+    REQUIRE(map.Get(19998) == 9999);
+    REQUIRE(map.LowerBound(3).GetKey() == 4);
+
+    // the loaded tree takes further updates
+    for(int i = 0; i < 10000; ++i)
+      map.Insert(i * 2 + 1, -i);
+    for(int i = 0; i < 20000; i += 3)
+      map.Remove(i);
+
+    int previous = -1;
+    Size size = 0;
+    for(auto entry : map) {
+      REQUIRE(entry.first > previous);
+      REQUIRE(entry.first % 3 != 0);
+      previous = entry.first;
+      size++;
+    }
+    REQUIRE(size == map.GetSize());
+  }
+
+  SECTION("bulk-loading few entries into a filled map") {
+    SmallMap map{};
+    for(int i = 0; i < 100; ++i)
+      map.Insert(i, i);
+
+    map.Load(Array<Pair<int, int>>(1));
+    REQUIRE(map.GetSize() == 0);
+    REQUIRE_FALSE(map.Exists(5));
+    REQUIRE(map.begin() == map.end());
+
+    for(int i = 0; i < 100; ++i)
+      map.Insert(i, i);
+    Array<Pair<int, int>> single(1);
+    single.Insert({500, 1});
+    map.Load(single);
+    REQUIRE(map.GetSize() == 1);
+    REQUIRE_FALSE(map.Exists(5));
+    REQUIRE(map.Get(500) == 1);
+  }
+
+  SECTION("copying, moving and comparing maps") {
+    SmallMap map{};
+    for(int i = 0; i < 300; ++i)
+      map.Insert(i, i * i);
+
+    SmallMap copy(map);
+    REQUIRE(copy == map);
+    copy.Insert(42, 0);
+    REQUIRE(copy != map);
+
+    SmallMap moved(std::move(copy));
+    REQUIRE(copy.IsEmpty());
+    REQUIRE(moved.Get(42) == 0);
+
+    copy = map;
+    REQUIRE(copy == map);
+    map = std::move(moved);
+    REQUIRE(map.Get(42) == 0);
+  }
+
+  SECTION("random operations match std::map") {
+    std::mt19937 random{7};
+    BTreeMap<int, String, 96> map{};
+    std::map<int, String> expected{};
+
+    for(int step = 0; step < 20000; ++step) {
+      const int key = static_cast<int>(random() % 2000);
+      if(random() % 3 == 0) {
+        REQUIRE(map.Remove(key) == (expected.erase(key) == 1));
+      } else {
+        const String value = String().Append(step);
+        REQUIRE(map.Insert(key, value) == !expected.contains(key));
+        expected[key] = value;
+      }
+
+      if(step % 1000 == 0) {
+        const int bound = static_cast<int>(random() % 2000);
+        const auto it = map.LowerBound(bound);
+        const auto reference = expected.lower_bound(bound);
+        REQUIRE((it == map.end()) == (reference == expected.end()));
+        if(reference != expected.end())
+          REQUIRE(it.GetKey() == reference->first);
+      }
+    }
+
+    REQUIRE(map.GetSize() == expected.size());
+    auto reference = expected.begin();
+    for(auto [key, value] : map) {
+      REQUIRE(key == reference->first);
+      REQUIRE(value == reference->second);
+      ++reference;
+    }
+  }
+}
@@ -0,0 +1,102 @@
+/**
+* @file BTreeSet.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <random>
+#include <set>
+
+#include "data/BTreeSet.hpp"
+
+TEST_CASE("BTreeSet functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("inserting and removing keys") {
+    BTreeSet<int> set{};
+    REQUIRE(set.Insert(3));
+    REQUIRE(set.Insert(1));
+    REQUIRE(set.Insert(2));
+    REQUIRE_FALSE(set.Insert(2));
+
+    REQUIRE(set.GetSize() == 3);
+    REQUIRE(set.Exists(1));
+    REQUIRE(set.ToString() == String{"BTreeSet(1, 2, 3)"});
+
+    REQUIRE(set.Remove(2));
+    REQUIRE_FALSE(set.Remove(2));
+    REQUIRE(set.ToString() == String{"BTreeSet(1, 3)"});
+  }
+
+  SECTION("bulk-loading and querying ranges") {
+    Array<int> keys(5000);
+    for(int i = 0; i < 5000; ++i)
+      keys.Insert(i * 3);
+
+    BTreeSet<int, 64> set{};
+    set.Load(keys);
+
+    REQUIRE(set.GetSize() == 5000);
+    REQUIRE(set.GetHeight() > 2);
+    REQUIRE(set.GetMin() == 0);
+    REQUIRE(set.GetMax() == 14997);
+    REQUIRE(*set.LowerBound(10) == 12);
+    REQUIRE(*set.UpperBound(12) == 15);
+    REQUIRE(set.Find(13) == set.end());
+
+    int count = 0;
+    for(const int key : set.GetRange(300, 600)) {
+      REQUIRE(key % 3 == 0);
+      count++;
+    }
+    REQUIRE(count == 100);
+  }
+
+  SECTION("bulk-loading few keys into a filled set") {
+    BTreeSet<int, 64> set{};
+    for(int i = 0; i < 100; ++i)
+      set.Insert(i);
+
+    set.Load(Array<int>(1));
+    REQUIRE(set.GetSize() == 0);
+    REQUIRE_FALSE(set.Exists(5));
+    REQUIRE(set.begin() == set.end());
+
+    for(int i = 0; i < 100; ++i)
+      set.Insert(i);
+    Array<int> single(1);
+    single.Insert(500);
+    set.Load(single);
+    REQUIRE(set.GetSize() == 1);
+    REQUIRE_FALSE(set.Exists(5));
+    REQUIRE(set.GetMin() == 500);
+    REQUIRE(set.GetMax() == 500);
+  }
+
+  SECTION("random operations match std::set") {
+    std::mt19937 random{11};
+    BTreeSet<U64, 64> set{};
+    std::set<U64> expected{};
+
+    for(int step = 0; step < 20000; ++step) {
+      const U64 key = random() % 3000;
+      if(random() % 2 == 0)
+        REQUIRE(set.Remove(key) == (expected.erase(key) == 1));
+      else
+        REQUIRE(set.Insert(key) == expected.insert(key).second);
+    }
+
+    REQUIRE(set.GetSize() == expected.size());
+    auto reference = expected.begin();
+    for(const U64 key : set)
+      REQUIRE(key == *reference++);
+
+    BTreeSet<U64, 64> copy(set);
+    REQUIRE(copy == set);
+    copy.Remove(*copy.begin());
+    REQUIRE(copy != set);
+  }
+}
@@ -131,4 +131,158 @@ TEST_CASE("Bitset functionality validation", "[data]") {
     REQUIRE(bitset1 == bitset2);
     REQUIRE(!(bitset1 != bitset2));
   }
-}
\ No newline at end of file
+}
+TEST_CASE("Packed bitset functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new packed bitset") {
+    PackedBitset bitset{};
+    REQUIRE(bitset.GetSize() == 1024);
+    REQUIRE(bitset.GetCapacity() == 1024);
+    REQUIRE(bitset.IsNone());
+
+    PackedBitset<70> odd{};
+    REQUIRE(odd.GetSize() == 70);
+    REQUIRE(odd.GetCapacity() == 128);
+  }
+
+  SECTION("setting, resetting and flipping bits") {
+    PackedBitset<130> bitset{};
+
+    bitset.Set(0);
+    bitset.Set(64);
+    bitset.Set(129);
+    REQUIRE(bitset.IsSet(0));
+    REQUIRE(bitset.IsSet(64));
+    REQUIRE(bitset.IsSet(129));
+    REQUIRE(!bitset.IsSet(1));
+    REQUIRE(bitset.Get(64) == '1');
+    REQUIRE(bitset.Get(65) == '0');
+    REQUIRE(bitset[129]);
+
+    bitset.Reset(64);
+    REQUIRE(!bitset.IsSet(64));
+
+    bitset.Flip(64);
+    REQUIRE(bitset.IsSet(64));
+    bitset.Flip(64);
+    REQUIRE(!bitset.IsSet(64));
+
+    bitset.Reset();
+    REQUIRE(bitset.IsNone());
+  }
+
+  SECTION("testing bits without checks") {
+    PackedBitset<130> bitset{};
+    bitset.Set(3);
+    bitset.Set(128);
+    for(Size i = 0; i < bitset.GetSize(); ++i)
+      REQUIRE(bitset.IsSetUnchecked(i) == bitset.IsSet(i));
+    REQUIRE(bitset.IsSetUnchecked(128));
+    REQUIRE_FALSE(bitset.IsSetUnchecked(129));
+  }
+
+  SECTION("setting and flipping all bits keeps the tail clear") {
+    PackedBitset<70> bitset{};
+
+    bitset.Set();
+    REQUIRE(bitset.IsAll());
+    REQUIRE(bitset.GetCount() == 70);
+
+    bitset.Flip();
+    REQUIRE(bitset.IsNone());
+    REQUIRE(bitset.GetCount() == 0);
+
+    REQUIRE((~bitset).GetCount() == 70);
+  }
+
+  SECTION("counting set bits") {
+    PackedBitset<1000> bitset{};
+    for (Size i = 0; i < 1000; i += 3)
+      bitset.Set(i);
+
+    REQUIRE(bitset.GetCount() == 334);
+    REQUIRE(bitset.IsAny());
+    REQUIRE(!bitset.IsAll());
+  }
+
+  SECTION("bulk operations between bitsets") {
+    PackedBitset<300> a{};
+    PackedBitset<300> b{};
+    for (Size i = 0; i < 300; i += 2)
+      a.Set(i);
+    for (Size i = 0; i < 300; i += 3)
+      b.Set(i);
+
+    auto both = a & b;
+    auto either = a | b;
+    auto one = a ^ b;
+
+    for (Size i = 0; i < 300; ++i) {
+      REQUIRE(both.IsSet(i) == (i % 2 == 0 && i % 3 == 0));
+      REQUIRE(either.IsSet(i) == (i % 2 == 0 || i % 3 == 0));
+      REQUIRE(one.IsSet(i) == ((i % 2 == 0) != (i % 3 == 0)));
+    }
+
+    a &= b;
+    REQUIRE(a == both);
+    a |= one;
+    REQUIRE(a == either);
+    a ^= both;
+    REQUIRE(a == one);
+  }
+
+  SECTION("finding set bits") {
+    PackedBitset<600> bitset{};
+    REQUIRE(bitset.FindFirst() == -1);
+
+    bitset.Set(5);
+    bitset.Set(63);
+    bitset.Set(64);
+    bitset.Set(599);
+
+    REQUIRE(bitset.FindFirst() == 5);
+    REQUIRE(bitset.FindNext(5) == 63);
+    REQUIRE(bitset.FindNext(63) == 64);
+    REQUIRE(bitset.FindNext(64) == 599);
+    REQUIRE(bitset.FindNext(599) == -1);
+  }
+
+  SECTION("iterating over set bits") {
+    PackedBitset<512> bitset{};
+    const Size expected[] = {1, 100, 256, 257, 511};
+    for (Size i : expected)
+      bitset.Set(i);
+
+    Size idx = 0;
+    for (Size i : bitset) {
+      REQUIRE(i == expected[idx]);
+      idx++;
+    }
+    REQUIRE(idx == 5);
+  }
+
+  SECTION("converting packed bitset to string") {
+    PackedBitset<4> bitset{};
+
+    bitset.Flip(2);
+    REQUIRE(bitset.ToString() == String{"Bitset(0010)\n"});
+  }
+
+  SECTION("copying and moving packed bitsets") {
+    PackedBitset<100> bitset{};
+    bitset.Set(42);
+
+    PackedBitset<100> copy{bitset};
+    REQUIRE(copy == bitset);
+
+    PackedBitset<100> moved{std::move(copy)};
+    REQUIRE(moved.IsSet(42));
+
+    PackedBitset<100> assigned{};
+    assigned = moved;
+    REQUIRE(assigned == bitset);
+    assigned.Reset(42);
+    REQUIRE(assigned != bitset);
+  }
+}
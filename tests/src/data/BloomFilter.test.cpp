@@ -0,0 +1,139 @@
+/**
+* @file BloomFilter.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <bit>
+
+#include "data/BloomFilter.hpp"
+#include "data/String.hpp"
+
+namespace {
+  constexpr ntl::Size BITS = 1 << 16;
+  constexpr ntl::Size KEYS = BITS / 10;
+
+  // counts the reported keys out of the given range, none of which were inserted
+  template <typename FilterType>
+  ntl::Size countFalsePositives(const FilterType& a_filter, const ntl::U64 a_begin, const ntl::U64 a_end) {
+    ntl::Size count = 0;
+    for(ntl::U64 key = a_begin; key < a_end; ++key)
+      count += a_filter.MayContain(key) ? 1 : 0;
+    return count;
+  }
+}
+
+TEST_CASE("BloomFilter functionality validation", "[data]") {
+  using namespace ntl;
+
+  STATIC_REQUIRE(BloomHashCount(BITS, KEYS) == 7);
+  STATIC_REQUIRE(BloomHashCount(8, 100) == 1);
+
+  SECTION("inserting keys") {
+    BloomFilter<U64, BITS, BloomHashCount(BITS, KEYS)> filter{};
+    REQUIRE(filter.GetSize() == 0);
+    REQUIRE(filter.GetFalsePositiveRate() == 0.0f);
+    REQUIRE_FALSE(filter.MayContain(1));
+
+    for(U64 key = 0; key < KEYS; ++key)
+      filter.Insert(key * 3);
+    REQUIRE(filter.GetSize() == KEYS);
+    REQUIRE(filter.ToString() == String{"BloomFilter(bits: 65536, hashes: 7, size: 6553)"});
+
+    // no false negatives, and about 1% false positives for 10 bits per key
+    for(U64 key = 0; key < KEYS; ++key)
+      REQUIRE(filter.MayContain(key * 3));
+    const Size falsePositives = countFalsePositives(filter, 1u << 20, (1u << 20) + 100000);
+    REQUIRE(falsePositives < 1500);
+    REQUIRE(filter.GetFalsePositiveRate() > 0.005f);
+    REQUIRE(filter.GetFalsePositiveRate() < 0.015f);
+
+    filter.Clear();
+    REQUIRE(filter.GetSize() == 0);
+    REQUIRE_FALSE(filter.MayContain(0));
+  }
+
+  SECTION("merging filters") {
+    BloomFilter<int, 1024, 3> first{};
+    BloomFilter<int, 1024, 3> second{};
+    first.Insert(1);
+    second.Insert(2);
+    REQUIRE_FALSE(first.MayContain(2));
+
+    first.Merge(second);
+    REQUIRE(first.GetSize() == 2);
+    REQUIRE(first.MayContain(1));
+    REQUIRE(first.MayContain(2));
+  }
+
+  SECTION("looking up string keys") {
+    BloomFilter<String, 4096, 4> filter(algorithms::Hash::FNV1a);
+    REQUIRE(filter.GetAlgorithm() == algorithms::Hash::FNV1a);
+
+    filter.Insert(String{"a key that is long enough to live on the heap"});
+    filter.Insert(StringView{"short"});
+    REQUIRE(filter.MayContain(String{"short"}));
+    REQUIRE(filter.MayContain(StringView{"a key that is long enough to live on the heap"}));
+    REQUIRE_FALSE(filter.MayContain(StringView{"shorter"}));
+  }
+}
+
+TEST_CASE("BlockedBloomFilter functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("inserting keys") {
+    BlockedBloomFilter<U64, BITS> filter{};
+    STATIC_REQUIRE(decltype(filter)::BLOCKS == BITS / 512);
+    REQUIRE_FALSE(filter.MayContain(1));
+
+    for(U64 key = 0; key < KEYS; ++key)
+      filter.Insert(key * 3);
+    REQUIRE(filter.GetSize() == KEYS);
+    REQUIRE(filter.ToString() == String{"BlockedBloomFilter(bits: 65536, blocks: 128, size: 6553)"});
+
+    // no false negatives, and a bit more false positives than the classic filter
+    for(U64 key = 0; key < KEYS; ++key)
+      REQUIRE(filter.MayContain(key * 3));
+    const Size falsePositives = countFalsePositives(filter, 1u << 20, (1u << 20) + 100000);
+    REQUIRE(falsePositives < 2500);
+    REQUIRE(filter.GetFalsePositiveRate() < 0.025f);
+
+    filter.Clear();
+    REQUIRE(filter.GetSize() == 0);
+    REQUIRE_FALSE(filter.MayContain(0));
+  }
+
+  SECTION("keeping a key in one block") {
+    BlockedBloomFilter<int, 512 * 4> filter{};
+    const U64* words = filter.GetBits().GetWords();
+    REQUIRE(reinterpret_cast<UPtr>(words) % 64 == 0);
+
+    // the key sets one bit in every word of a single block
+    filter.Insert(42);
+    REQUIRE(filter.GetBits().GetCount() == 8);
+    Size block = 4;
+    for(Size i = 0; i < 4 * 8; ++i) {
+      if(words[i] != 0) {
+        REQUIRE(std::popcount(words[i]) == 1);
+        REQUIRE((block == 4 || block == i / 8));
+        block = i / 8;
+      }
+    }
+    REQUIRE(block < 4);
+  }
+
+  SECTION("merging filters") {
+    BlockedBloomFilter<int, 1024> first{};
+    BlockedBloomFilter<int, 1024> second{};
+    first.Insert(1);
+    second.Insert(2);
+
+    first.Merge(second);
+    REQUIRE(first.GetSize() == 2);
+    REQUIRE(first.MayContain(1));
+    REQUIRE(first.MayContain(2));
+  }
+}
@@ -0,0 +1,161 @@
+/**
+* @file ColumnArray.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+
+#include "Process.hpp"
+#include "data/ColumnArray.hpp"
+#include "data/String.hpp"
+
+TEST_CASE("ColumnArray functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new array") {
+    ColumnArray<U32, float, String> array(16);
+    REQUIRE(array.IsEmpty());
+    REQUIRE(array.GetCapacity() == 16);
+    REQUIRE(array.GetColumnCount() == 3);
+  }
+
+  SECTION("inserting and accessing records") {
+    ColumnArray<U32, String> array(2, true);
+    for(U32 i = 0; i < 100; ++i)
+      REQUIRE(array.Insert(i, String{"name"} + static_cast<int>(i)) == i);
+
+    REQUIRE(array.GetSize() == 100);
+    REQUIRE(array.Get<0>(42) == 42);
+    REQUIRE(array.Get<1>(42) == "name42");
+
+    auto [id, name] = array[7];
+    id = 70;
+    name = "seven";
+    REQUIRE(array.Get<0>(7) == 70);
+    REQUIRE(array.Get<1>(7) == "seven");
+  }
+
+  SECTION("inserting past the capacity of a non growable array") {
+    REQUIRE(test::Aborts([] {
+      ColumnArray<U32, float> array(2);
+      array.Insert(1u, 1.0f);
+      array.Insert(2u, 2.0f);
+      array.Insert(3u, 3.0f);
+    }));
+    REQUIRE(test::Aborts([] {
+      ColumnArray<U32, float> array(2);
+      array.Insert(1u, 1.0f);
+      array.Insert(2u, 2.0f);
+      array.InsertAt(0, 3u, 3.0f);
+    }));
+
+    ColumnArray<U32, float> array(2);
+    array.Insert(1u, 1.0f);
+    array.Insert(2u, 2.0f);
+    REQUIRE(array.GetCapacity() == 2);
+    REQUIRE(array.GetSize() == 2);
+  }
+
+  SECTION("inserting and removing records in the middle") {
+    ColumnArray<int, String> array(8);
+    array.Insert(1, "a");
+    array.Insert(3, "c");
+    array.InsertAt(1, 2, "b");
+    array.InsertAt(0, 0, "-");
+    REQUIRE(array.GetSize() == 4);
+    for(int i = 0; i < 4; ++i)
+      REQUIRE(array.Get<0>(i) == i);
+    REQUIRE(array.Get<1>(2) == "b");
+
+    auto [value, name] = array.Remove(1);
+    REQUIRE(value == 1);
+    REQUIRE(name == "a");
+    REQUIRE(array.GetSize() == 3);
+    REQUIRE(array.Get<1>(1) == "b");
+
+    array.Swap(0, 2);
+    REQUIRE(array.Get<0>(0) == 3);
+    REQUIRE(array.Get<1>(2) == "-");
+  }
+
+  SECTION("sorting permutes all columns") {
+    ColumnArray<int, String> array(64);
+    for(int i = 0; i < 50; ++i)
+      array.Insert((i * 17) % 50, String{"v"} + (i * 17) % 50);
+
+    array.Sort<0>();
+    for(int i = 0; i < 50; ++i) {
+      REQUIRE(array.Get<0>(i) == i);
+      REQUIRE(array.Get<1>(i) == String{"v"} + i);
+    }
+
+    array.Sort([](const auto& a_left, const auto& a_right) { return std::get<0>(a_left) > std::get<0>(a_right); });
+    REQUIRE(array.Get<0>(0) == 49);
+    REQUIRE(array.Get<1>(0) == "v49");
+    REQUIRE(array.Find<1>("v0") == 49);
+  }
+
+  SECTION("scanning aligned columns") {
+    ColumnArray<U32, double> array(1000);
+    for(U32 i = 0; i < 1000; ++i)
+      array.Insert(i, 0.5);
+
+    auto ids = array.GetColumn<0>();
+    auto weights = array.GetColumn<1>();
+    REQUIRE(ids.size() == 1000);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ids.data()) % NTL_CACHE_LINE_SIZE == 0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(weights.data()) % NTL_CACHE_LINE_SIZE == 0);
+
+    U64 sum = 0;
+    double total = 0;
+    for(Size i = 0; i < ids.size(); ++i) {
+      sum += ids[i];
+      total += weights[i];
+    }
+    REQUIRE(sum == 499500);
+    REQUIRE(total == 500.0);
+  }
+
+  SECTION("iterating over rows") {
+    ColumnArray<int, int> array(4);
+    array.Insert(1, 10);
+    array.Insert(2, 20);
+
+    int sum = 0;
+    for(auto [key, value] : array) {
+      value += key;
+      sum += value;
+    }
+    REQUIRE(sum == 33);
+    REQUIRE(array.Get<1>(1) == 22);
+
+    const ColumnArray<int, int>& view = array;
+    int keys = 0;
+    for(auto [key, value] : view)
+      keys += key;
+    REQUIRE(keys == 3);
+  }
+
+  SECTION("copying and moving arrays") {
+    ColumnArray<int, String> array(4);
+    array.Insert(1, "a very long string that is stored on the heap");
+    array.Insert(2, "b");
+
+    ColumnArray<int, String> copy{array};
+    REQUIRE(copy.GetSize() == 2);
+    REQUIRE(copy.Get<1>(0) == "a very long string that is stored on the heap");
+
+    ColumnArray<int, String> moved{std::move(copy)};
+    REQUIRE(moved.GetSize() == 2);
+    REQUIRE(copy.IsEmpty());
+
+    copy = moved;
+    REQUIRE(copy.Get<0>(1) == 2);
+    array = std::move(moved);
+    REQUIRE(array.Get<1>(1) == "b");
+  }
+}
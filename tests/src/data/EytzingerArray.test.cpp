@@ -0,0 +1,92 @@
+/**
+* @file EytzingerArray.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "data/Array.hpp"
+#include "data/EytzingerArray.hpp"
+#include "data/String.hpp"
+
+TEST_CASE("EytzingerArray functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("finding elements in indices of every size") {
+    for (Size size = 0; size < 70; ++size) {
+      // every value twice, so the last equal element can be checked
+      Array<int> sorted(2 * size + 1, false);
+      for (Size i = 0; i < 2 * size; ++i)
+        sorted.Insert(static_cast<int>(i / 2) * 10);
+      sorted.Sort();
+
+      const EytzingerArray<int> index{sorted};
+      REQUIRE(index.GetSize() == 2 * size);
+      REQUIRE(index.IsEmpty() == (size == 0));
+
+      for (int value = -10; value <= static_cast<int>(size) * 10; value += 5) {
+        const I64 expected = value >= 0 && value % 10 == 0 && value / 10 < static_cast<int>(size) ? value / 5 + 1 : -1;
+        REQUIRE(index.Find(value) == expected);
+        REQUIRE(index.Contains(value) == (expected >= 0));
+      }
+    }
+  }
+
+  SECTION("finding many elements at once") {
+    std::mt19937 random{3};
+    const Size size = 100000;
+
+    Array<U64> sorted(size, false);
+    for (Size i = 0; i < size; ++i)
+      sorted.Insert(random() % 1000000);
+    sorted.Sort();
+
+    const EytzingerArray<U64> index{sorted};
+
+    std::vector<U64> keys;
+    for (Size i = 0; i < 1000; ++i)
+      keys.push_back(i % 2 ? sorted[random() % size] : random() % 1000000);
+
+    std::vector<I64> results(keys.size()), array_results(keys.size());
+    index.FindMany(keys.data(), keys.size(), results.data());
+    sorted.FindMany(keys.data(), keys.size(), array_results.data());
+
+    for (Size i = 0; i < keys.size(); ++i) {
+      const I64 expected = sorted.Find(keys[i]);
+      REQUIRE(results[i] == expected);
+      REQUIRE(array_results[i] == expected);
+      REQUIRE(index.Find(keys[i]) == expected);
+      if (i % 2)
+        REQUIRE(expected >= 0);
+    }
+  }
+
+  SECTION("copying and moving indices of strings") {
+    Array<String> sorted(4, true);
+    sorted.Insert("delta");
+    sorted.Insert("alpha");
+    sorted.Insert("charlie");
+    sorted.Insert("bravo");
+
+    EytzingerArray<String> index{sorted};
+    EytzingerArray<String> copy{index};
+    EytzingerArray<String> moved{std::move(index)};
+
+    REQUIRE(index.IsEmpty());
+    REQUIRE(index.Find(String{"alpha"}) == -1);
+    REQUIRE(copy.Find(String{"charlie"}) == 2);
+    REQUIRE(moved.Find(String{"delta"}) == 3);
+    REQUIRE(moved.Find(String{"echo"}) == -1);
+
+    copy = EytzingerArray<String>{};
+    REQUIRE(copy.GetSize() == 0);
+    copy = moved;
+    REQUIRE(copy.Find(String{"alpha"}) == 0);
+  }
+}
@@ -0,0 +1,101 @@
+/**
+* @file HashSet.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <random>
+#include <unordered_set>
+
+#include "data/HashSet.hpp"
+#include "data/String.hpp"
+
+TEST_CASE("HashSet functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("inserting and removing keys") {
+    HashSet<int> set{};
+    REQUIRE(set.IsEmpty());
+    REQUIRE(set.begin() == set.end());
+    REQUIRE(set.ToString() == String{"HashSet()"});
+
+    REQUIRE(set.Insert(3));
+    REQUIRE(set.Insert(1));
+    REQUIRE_FALSE(set.Insert(3));
+
+    REQUIRE(set.GetSize() == 2);
+    REQUIRE(set.Exists(1));
+    REQUIRE(set.Exists(3));
+    REQUIRE_FALSE(set.Exists(2));
+    REQUIRE((set.ToString() == String{"HashSet(1, 3)"} || set.ToString() == String{"HashSet(3, 1)"}));
+
+    REQUIRE(set.Remove(3));
+    REQUIRE_FALSE(set.Remove(3));
+    REQUIRE(set.ToString() == String{"HashSet(1)"});
+
+    set.Clear();
+    REQUIRE(set.IsEmpty());
+    REQUIRE_FALSE(set.Exists(1));
+  }
+
+  SECTION("looking up string keys") {
+    HashSet<String> set(4, algorithms::Hash::WyHash);
+    REQUIRE(set.GetAlgorithm() == algorithms::Hash::WyHash);
+
+    String key{"a key that is long enough to live on the heap"};
+    REQUIRE(set.Insert(std::move(key)));
+    REQUIRE(set.Insert(String{"short"}));
+    REQUIRE_FALSE(set.Insert(String{"short"}));
+
+    REQUIRE(set.Exists(StringView{"short"}));
+    REQUIRE(set.Exists(StringView{"a key that is long enough to live on the heap"}));
+    REQUIRE_FALSE(set.Exists(StringView{"shorter"}));
+
+    for(const String& element : set)
+      REQUIRE(set.Exists(element));
+  }
+
+  SECTION("random operations match std::unordered_set") {
+    for(const bool incremental : {false, true}) {
+      std::mt19937 random{23};
+      HashSet<U64> set(8);
+      set.SetIncrementalResize(incremental);
+      std::unordered_set<U64> expected{};
+
+      for(int step = 0; step < 20000; ++step) {
+        const U64 key = random() % 4000;
+        if(random() % 3 == 0)
+          REQUIRE(set.Remove(key) == (expected.erase(key) == 1));
+        else
+          REQUIRE(set.Insert(key) == expected.insert(key).second);
+      }
+
+      REQUIRE(set.GetSize() == expected.size());
+      Size count = 0;
+      for(const U64 key : set) {
+        REQUIRE(expected.contains(key));
+        count++;
+      }
+      REQUIRE(count == expected.size());
+
+      HashSet<U64> copy(set);
+      REQUIRE(copy == set);
+      copy.Remove(*copy.begin());
+      REQUIRE(copy != set);
+      copy.Insert(1u << 20);
+      REQUIRE(copy.GetSize() == set.GetSize());
+      REQUIRE(copy != set);
+    }
+  }
+
+  SECTION("reserving room") {
+    HashSet<int> set(2, algorithms::Hash::FNV1a, 0.7, false);
+    set.Reserve(1000);
+    for(int i = 0; i < 1000; ++i)
+      REQUIRE(set.Insert(i));
+    REQUIRE(set.GetSize() == 1000);
+  }
+}
@@ -0,0 +1,124 @@
+/**
+* @file IntrusiveList.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include "data/IntrusiveList.hpp"
+
+namespace {
+  struct Entry {
+    int key;
+    ntl::ListHook lru;
+    ntl::ListHook timer;
+
+    explicit Entry(const int a_key) : key(a_key) {}
+  };
+
+  using LruList = ntl::IntrusiveList<Entry, &Entry::lru>;
+  using TimerList = ntl::IntrusiveList<Entry, &Entry::timer>;
+
+  int keys(const LruList& a_list) {
+    int result = 0;
+    for(const Entry& entry : a_list)
+      result = result * 10 + entry.key;
+    return result;
+  }
+}
+
+TEST_CASE("IntrusiveList functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new list") {
+    LruList list{};
+
+    REQUIRE(list.IsEmpty());
+    REQUIRE(list.GetSize() == 0);
+    REQUIRE(list.begin() == list.end());
+  }
+
+  SECTION("linking and unlinking objects") {
+    Entry a{1}, b{2}, c{3}, d{4};
+    LruList list{};
+    list.InsertBack(b);
+    list.InsertFront(a);
+    list.InsertAfter(b, d);
+    list.InsertBefore(d, c);
+
+    REQUIRE(list.GetSize() == 4);
+    REQUIRE(keys(list) == 1234);
+    REQUIRE(&list.GetFront() == &a);
+    REQUIRE(&list.GetBack() == &d);
+    REQUIRE(list.GetNext(b) == &c);
+    REQUIRE(list.GetPrevious(b) == &a);
+    REQUIRE(list.GetPrevious(a) == nullptr);
+    REQUIRE(list.GetNext(d) == nullptr);
+
+    list.Remove(b);
+    REQUIRE_FALSE(LruList::IsLinked(b));
+    REQUIRE(&list.RemoveFront() == &a);
+    REQUIRE(&list.RemoveBack() == &d);
+    REQUIRE(keys(list) == 3);
+
+    list.Clear();
+    REQUIRE(list.IsEmpty());
+    REQUIRE_FALSE(LruList::IsLinked(c));
+  }
+
+  SECTION("moving objects for LRU order") {
+    Entry a{1}, b{2}, c{3};
+    LruList list{};
+    list.InsertFront(a);
+    list.InsertFront(b);
+    list.InsertFront(c);
+    REQUIRE(keys(list) == 321);
+
+    list.MoveToFront(a);
+    REQUIRE(keys(list) == 132);
+    list.MoveToBack(a);
+    list.MoveToBack(a);
+    REQUIRE(keys(list) == 321);
+    REQUIRE(&list.RemoveBack() == &a);
+  }
+
+  SECTION("linking objects into multiple lists") {
+    Entry a{1}, b{2};
+    LruList lru{};
+    TimerList timers{};
+    lru.InsertBack(a);
+    lru.InsertBack(b);
+    timers.InsertBack(b);
+
+    REQUIRE(TimerList::IsLinked(b));
+    REQUIRE_FALSE(TimerList::IsLinked(a));
+    REQUIRE(timers.GetFront().key == 2);
+
+    // copies start out unlinked
+    const Entry copy{b};
+    REQUIRE_FALSE(LruList::IsLinked(copy));
+  }
+
+  SECTION("moving lists and iterating backwards") {
+    Entry a{1}, b{2}, c{3};
+    LruList list{};
+    list.InsertBack(a);
+    list.InsertBack(b);
+    list.InsertBack(c);
+
+    LruList moved(std::move(list));
+    REQUIRE(list.IsEmpty());
+    REQUIRE(moved.GetSize() == 3);
+
+    int result = 0;
+    for(auto it = moved.end(); it != moved.begin();)
+      result = result * 10 + (--it)->key;
+    REQUIRE(result == 321);
+
+    list = std::move(moved);
+    REQUIRE(keys(list) == 123);
+    REQUIRE(moved.IsEmpty());
+  }
+}
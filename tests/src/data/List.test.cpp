@@ -95,6 +95,17 @@ TEST_CASE("List functionality validation", "[data]") {
     REQUIRE(list.IsEmpty());
   }
 
+  SECTION("removing missing element from the list") {
+    List<int> list{};
+    list.InsertFront(2);
+    list.InsertFront(4);
+
+    REQUIRE_FALSE(list.RemoveElement(8));
+    REQUIRE(list.GetSize() == 2);
+    REQUIRE(list.RemoveElement(2));
+    REQUIRE(list.ToString() == String{"List(4)\n"});
+  }
+
   SECTION("removing element after node from the list") {
     List<int> list{};
     auto* added = list.InsertFront(2);
@@ -160,4 +171,39 @@ TEST_CASE("List functionality validation", "[data]") {
       value *= 2;
     }
   }
+
+  SECTION("moving elements into the list") {
+    List<String> list{};
+    String value{"moved"};
+    list.InsertBack(std::move(value));
+    list.EmplaceBack("back");
+    list.EmplaceFront("front");
+    list.InsertAfter(list.GetFront(), String{"after"});
+
+    REQUIRE(value.GetLength() == 0);
+    REQUIRE(list.GetSize() == 4);
+    REQUIRE(list.ToString() == String{"List(front, after, moved, back)\n"});
+    REQUIRE(list.RemoveFront() == "front");
+    REQUIRE(list.GetSize() == 3);
+  }
+
+  SECTION("moving and assigning lists") {
+    List<int> list{};
+    list.InsertBack(2);
+    list.InsertBack(4);
+
+    List<int> moved(std::move(list));
+    REQUIRE(list.IsEmpty());
+    REQUIRE(moved.GetSize() == 2);
+
+    List<int> copy{};
+    copy.InsertBack(8);
+    copy = moved;
+    REQUIRE(copy == moved);
+
+    moved.Clear();
+    moved.InsertBack(16);
+    REQUIRE(moved.GetSize() == 1);
+    REQUIRE(moved.GetBack()->value == 16);
+  }
 }
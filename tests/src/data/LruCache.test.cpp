@@ -0,0 +1,125 @@
+/**
+* @file LruCache.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include "data/LruCache.hpp"
+#include "data/String.hpp"
+
+namespace {
+  struct LengthWeigher {
+    ntl::Size operator()(const int&, const ntl::String& a_value) const { return a_value.GetSize(); }
+  };
+}
+
+TEST_CASE("LruCache functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new cache") {
+    LruCache<int, int> cache{8};
+
+    REQUIRE(cache.GetSize() == 0);
+    REQUIRE(cache.GetCapacity() == 8);
+    REQUIRE(cache.GetMaxWeight() == LruCache<int, int>::NO_WEIGHT_LIMIT);
+    REQUIRE(cache.Find(1) == nullptr);
+    REQUIRE(cache.GetStatistics().misses == 1);
+  }
+
+  SECTION("putting and finding entries") {
+    LruCache<String, int> cache{4};
+    REQUIRE(cache.Put("one", 1));
+    REQUIRE(cache.Put("two", 2));
+    REQUIRE(cache.Put("one", 11));
+    REQUIRE(cache.GetSize() == 2);
+
+    int* value = cache.Find("one");
+    REQUIRE(value != nullptr);
+    REQUIRE(*value == 11);
+    *value = 12;
+
+    int copy = 0;
+    REQUIRE(cache.Get("one", copy));
+    REQUIRE(copy == 12);
+    REQUIRE_FALSE(cache.Get("three", copy));
+
+    REQUIRE(cache.GetStatistics().hits == 2);
+    REQUIRE(cache.GetStatistics().misses == 1);
+    cache.ResetStatistics();
+    REQUIRE(cache.GetStatistics().hits == 0);
+  }
+
+  SECTION("evicting the least recently used entry") {
+    LruCache<int, int> cache{3};
+    cache.Put(1, 1);
+    cache.Put(2, 2);
+    cache.Put(3, 3);
+
+    // touching 1 makes 2 the least recently used entry
+    REQUIRE(cache.Find(1) != nullptr);
+    REQUIRE(*cache.Peek(2) == 2);
+    cache.Put(4, 4);
+
+    REQUIRE(cache.GetSize() == 3);
+    REQUIRE_FALSE(cache.Contains(2));
+    REQUIRE(cache.Contains(1));
+    REQUIRE(cache.GetStatistics().evictions == 1);
+
+    int order = 0;
+    cache.ForEach([&](const int& a_key, const int&) { order = order * 10 + a_key; });
+    REQUIRE(order == 413);
+  }
+
+  SECTION("erasing and clearing entries") {
+    LruCache<int, String> cache{4};
+    cache.Put(1, "a");
+    cache.Put(2, "b");
+
+    REQUIRE(cache.Erase(1));
+    REQUIRE_FALSE(cache.Erase(1));
+    REQUIRE(cache.GetSize() == 1);
+
+    cache.Clear();
+    REQUIRE(cache.GetSize() == 0);
+    REQUIRE(cache.Peek(2) == nullptr);
+    REQUIRE(cache.GetStatistics().evictions == 0);
+  }
+
+  SECTION("limiting the weight of the entries") {
+    LruCache<int, String, hash::Hasher<int>, LengthWeigher> cache{100, 10};
+    cache.Put(1, "aaaa");
+    cache.Put(2, "bbbb");
+    REQUIRE(cache.GetWeight() == 8);
+
+    cache.Put(3, "cccc");
+    REQUIRE(cache.GetWeight() == 8);
+    REQUIRE_FALSE(cache.Contains(1));
+
+    // replacing a value updates the weight
+    cache.Put(2, "bb");
+    REQUIRE(cache.GetWeight() == 6);
+
+    // entries heavier than the whole cache are never cached
+    REQUIRE_FALSE(cache.Put(4, "eleven char"));
+    REQUIRE_FALSE(cache.Put(3, "eleven char"));
+    REQUIRE_FALSE(cache.Contains(3));
+    REQUIRE(cache.GetWeight() == 2);
+  }
+
+  SECTION("cycling through many keys") {
+    LruCache<int, int> cache{64};
+    for(int i = 0; i < 10000; ++i) {
+      cache.Put(i, i);
+      if(i >= 16)
+        REQUIRE(cache.Find(i - 16) != nullptr);
+    }
+
+    REQUIRE(cache.GetSize() == 64);
+    REQUIRE(cache.GetStatistics().evictions == 10000 - 64);
+    for(int i = 10000 - 64; i < 10000; ++i)
+      REQUIRE(*cache.Peek(i) == i);
+  }
+}
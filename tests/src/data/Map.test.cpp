@@ -5,10 +5,30 @@
 * @copyright Copyright (c) 2024 Marcus Gugacs. All rights reserved.
 */
 
+#include <unordered_map>
+
 #include <catch2/catch_all.hpp>
 
 #include "data/Map.hpp"
 
+namespace {
+  struct Point {
+    int x, y;
+    bool operator==(const Point& a_other) const { return x == a_other.x && y == a_other.y; }
+  };
+
+  struct PointHasher {
+    ntl::U64 operator()(const Point& a_key) const {
+      return ntl::hash::Mix((static_cast<ntl::U64>(a_key.x) << 32) ^ static_cast<ntl::U32>(a_key.y));
+    }
+  };
+
+  // forces every key into the same home slot
+  struct CollidingHasher {
+    ntl::U64 operator()(const int&) const { return 0; }
+  };
+}
+
 TEST_CASE("Map functionality validation", "[datatypes]") {
   using namespace ntl;
 
@@ -102,6 +122,17 @@ TEST_CASE("Map functionality validation", "[datatypes]") {
     REQUIRE(map.Get(3) == 300);
   }
 
+  SECTION("Integral Key: Getting values by pointer") {
+    Map<int, int> map(10);
+    map.Insert(1, 100);
+
+    int* value = map.TryGet(1);
+    REQUIRE(value != nullptr);
+    *value = 150;
+    REQUIRE(map.Get(1) == 150);
+    REQUIRE(map.TryGet(2) == nullptr);
+  }
+
   SECTION("Integral Key: Remove") {
     Map<int, int> map(10);
     map.Insert(1, 100);
@@ -126,8 +157,9 @@ TEST_CASE("Map functionality validation", "[datatypes]") {
     map.Insert(1, 100);
     map.Insert(2, 200);
 
+    // integer keys are mixed, so the order of the entries isn't the insertion order
     auto result = map.ToString();
-    REQUIRE(result == "Map(1 : 100, 2 : 200)");
+    REQUIRE((result == "Map(1 : 100, 2 : 200)" || result == "Map(2 : 200, 1 : 100)"));
   }
 
   SECTION("Integral Key: Duplicate Insert") {
@@ -156,14 +188,55 @@ TEST_CASE("Map functionality validation", "[datatypes]") {
     auto begin = testMap.begin();
     auto end = testMap.end();
 
-    REQUIRE(begin != end);
-    REQUIRE(begin->second == 1);
+    // integer keys are mixed, so every value has to be visited exactly once in any order
+    int visited = 0;
+    for(; begin != end; ++begin) {
+      REQUIRE(begin->first == begin->second);
+      visited |= 1 << begin->second;
+    }
+    REQUIRE(visited == 0b1110);
+  }
 
-    REQUIRE(++begin != end);
-    REQUIRE(begin->second == 2);
+  SECTION("Integral Key: Removing keeps colliding entries reachable") {
+    Map<int, int> map(16, algorithms::Hash::FNV1a, 0.9, false);
+    for (int i = 0; i < 8; ++i) {
+      map.Insert(i * 16, i);
+    }
 
-    REQUIRE(++begin != end);
-    REQUIRE(begin->second == 3);
+    map.Remove(2 * 16);
+    map.Remove(5 * 16);
+
+    REQUIRE(map.GetSize() == 6);
+    REQUIRE(map.Exists(2 * 16) == false);
+    REQUIRE(map.Exists(5 * 16) == false);
+    for (int i : {0, 1, 3, 4, 6, 7}) {
+      REQUIRE(map.Get(i * 16) == i);
+    }
+
+    map.Insert(5 * 16, 50);
+    REQUIRE(map.Get(5 * 16) == 50);
+    REQUIRE(map.GetSize() == 7);
+  }
+
+  SECTION("Integral Key: High load factor with interleaved removal") {
+    Map<int, int> map(1024, algorithms::Hash::FNV1a, 0.9, true);
+    for (int i = 0; i < 900; ++i) {
+      map.Insert(i * 7, i);
+    }
+    for (int i = 0; i < 900; i += 2) {
+      map.Remove(i * 7);
+    }
+
+    REQUIRE(map.GetSize() == 450);
+    int counter = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+      REQUIRE(it->second % 2 == 1);
+      counter++;
+    }
+    REQUIRE(counter == 450);
+    for (int i = 0; i < 900; ++i) {
+      REQUIRE(map.Exists(i * 7) == (i % 2 == 1));
+    }
   }
 
   SECTION("Integral Key: Iterating through all elements") {
@@ -174,4 +247,262 @@ TEST_CASE("Map functionality validation", "[datatypes]") {
     }
     REQUIRE(counter == testMap.GetSize());
   }
-}
\ No newline at end of file
+
+  SECTION("Custom Key: Hasher policy") {
+    Map<Point, int, PointHasher> map(8);
+    for (int i = 0; i < 100; ++i) {
+      map.Insert({i, -i}, i);
+    }
+
+    REQUIRE(map.GetSize() == 100);
+    for (int i = 0; i < 100; ++i) {
+      REQUIRE(map.Get({i, -i}) == i);
+    }
+    REQUIRE(map.Exists({1, 1}) == false);
+  }
+
+  SECTION("Integral Key: Colliding hashes") {
+    Map<int, int, CollidingHasher> map(64, algorithms::Hash::FNV1a, 0.9, false);
+    for (int i = 0; i < 32; ++i) {
+      map.Insert(i, i * 10);
+    }
+    map.Remove(0);
+    map.Remove(17);
+
+    REQUIRE(map.GetSize() == 30);
+    for (int i = 0; i < 32; ++i) {
+      REQUIRE(map.Exists(i) == (i != 0 && i != 17));
+    }
+  }
+
+  SECTION("Cached Hashes: Resizing and copying") {
+    Map<int, int, hash::Hasher<int>, true> map(2);
+    for (int i = 0; i < 500; ++i) {
+      map.Insert(i, i);
+    }
+
+    Map<int, int, hash::Hasher<int>, true> copy(map, 2048);
+    map.Clear();
+
+    REQUIRE(copy.GetSize() == 500);
+    for (int i = 0; i < 500; ++i) {
+      REQUIRE(copy.Get(i) == i);
+    }
+  }
+
+  SECTION("Clear: Keeping the table") {
+    Map<String, String> map(64);
+    for (int i = 0; i < 40; ++i) {
+      map.Insert(String("a key that is long enough for the heap ") + i, String("Value") + i);
+    }
+
+    map.Clear();
+    REQUIRE(map.GetSize() == 0);
+    REQUIRE(map.begin() == map.end());
+    REQUIRE_FALSE(map.Exists(String("a key that is long enough for the heap ") + 1));
+
+    map.Insert("Key", "Value");
+    REQUIRE(map.Get("Key") == "Value");
+    REQUIRE(map.GetSize() == 1);
+  }
+
+  SECTION("Clear: During an incremental resize") {
+    Map<int, int> map(16);
+    map.SetIncrementalResize(true);
+    int count = 0;
+    while (!map.IsResizing()) {
+      map.Insert(count, count);
+      count++;
+    }
+
+    map.Clear();
+    REQUIRE_FALSE(map.IsResizing());
+    REQUIRE(map.GetSize() == 0);
+    for (int i = 0; i < count; ++i) {
+      REQUIRE_FALSE(map.Exists(i));
+    }
+    map.Insert(3, 4);
+    REQUIRE(map.Get(3) == 4);
+  }
+
+  SECTION("String Key: Hashing is consistent with the raw algorithms") {
+    const String key = "Key1";
+    REQUIRE(hash::Hasher<String>{}(key, algorithms::Hash::DJB2) == hash::DJB2("Key1", 4));
+    REQUIRE(hash::Hasher<String>{}(key, algorithms::Hash::SDBM) == hash::SDBM("Key1", 4));
+    REQUIRE(hash::Hasher<String>{}(key, algorithms::Hash::FNV1a) == hash::FNV1a("Key1", 4));
+    REQUIRE(hash::Hasher<String>{}(key, algorithms::Hash::WyHash) == hash::WyHash("Key1", 4));
+    REQUIRE(hash::Hasher<std::string>{}("Key1", algorithms::Hash::FNV1a) == hash::FNV1a("Key1", 4));
+  }
+
+  SECTION("String Key: Lookup by view and c-string") {
+    Map<String, int> map(10);
+    map.Insert("Key1", 100);
+    map.Insert("Key2", 200);
+
+    const char buffer[] = "Key1Key2Key3";
+    REQUIRE(map.Get(StringView{buffer, 4}) == 100);
+    REQUIRE(map.Get(StringView{buffer + 4, 4}) == 200);
+    REQUIRE(map.Exists(StringView{buffer + 8, 4}) == false);
+    REQUIRE(map.Exists("Key2") == true);
+    REQUIRE(map.Find(StringView{buffer, 4})->second == 100);
+    REQUIRE(map.Find(StringView{buffer, 3}) == map.end());
+    REQUIRE(map["Key1"] == 100);
+
+    map[StringView{buffer + 8, 4}] = 300;
+    REQUIRE(map.GetSize() == 3);
+    REQUIRE(map.Get("Key3") == 300);
+
+    const Map<String, int>& constMap = map;
+    REQUIRE(constMap[StringView{buffer + 4, 4}] == 200);
+  }
+
+  SECTION("Std String Key: Lookup by string_view") {
+    Map<std::string, int> map(10);
+    map.Insert("Key1", 100);
+
+    REQUIRE(map.Get(std::string_view{"Key1Key2", 4}) == 100);
+    REQUIRE(map.Exists(std::string_view{"Key2"}) == false);
+    REQUIRE(map.Exists("Key1") == true);
+  }
+
+  SECTION("String Key: Moving entries and maps") {
+    Map<String, String> map(2);
+    map.Insert(String{"Key1"}, String{"Value1"});
+    REQUIRE(map.Emplace("Key2", "Value2") == "Value2");
+    REQUIRE(map.Emplace("Key2", "Other") == "Value2");
+    for (int i = 0; i < 100; ++i) {
+      map.Insert(String{"Key"} + (i + 3), String{"Value"} + (i + 3));
+    }
+
+    Map<String, String> moved(std::move(map));
+    REQUIRE(map.GetSize() == 0);
+    REQUIRE(map.Exists("Key1") == false);
+    REQUIRE(moved.GetSize() == 102);
+    REQUIRE(moved.Get("Key1") == "Value1");
+    REQUIRE(moved.Get("Key102") == "Value102");
+
+    Map<String, String> copy(4);
+    copy = moved;
+    moved.Clear();
+    REQUIRE(copy.GetSize() == 102);
+    REQUIRE(copy.Get("Key50") == "Value50");
+
+    map = std::move(copy);
+    map.Insert("Key1", "Replaced");
+    REQUIRE(map.Get("Key1") == "Replaced");
+  }
+
+  SECTION("Incremental Resize: Lookups during the migration") {
+    Map<int, int> map(16);
+    map.SetIncrementalResize(true);
+
+    bool resized = false;
+    for (int i = 0; i < 5000; ++i) {
+      map.Insert(i, i * 2);
+      if (!map.IsResizing())
+        continue;
+
+      // the entries are spread over both tables now
+      resized = true;
+      int counter = 0;
+      for (auto it = map.begin(); it != map.end(); ++it)
+        counter++;
+      REQUIRE(counter == i + 1);
+      REQUIRE(map.Get(i / 2) == i / 2 * 2);
+      REQUIRE(map.Exists(i + 1) == false);
+    }
+
+    REQUIRE(resized);
+    REQUIRE(map.GetSize() == 5000);
+    for (int i = 0; i < 5000; ++i) {
+      REQUIRE(map.Get(i) == i * 2);
+    }
+  }
+
+  SECTION("Incremental Resize: Random operations") {
+    Map<int, int> map(8);
+    map.SetIncrementalResize(true);
+    std::unordered_map<int, int> expected;
+
+    unsigned state = 7;
+    for (int step = 0; step < 50000; ++step) {
+      state = state * 1103515245u + 12345u;
+      const int key = static_cast<int>((state >> 8) % 4096);
+
+      if ((state >> 4) % 3 == 0 && expected.contains(key)) {
+        map.Remove(key);
+        expected.erase(key);
+      } else {
+        map.Insert(key, step);
+        expected[key] = step;
+      }
+
+      REQUIRE(map.GetSize() == expected.size());
+      REQUIRE(map.Exists(key) == expected.contains(key));
+    }
+
+    for (const auto& [key, value] : expected) {
+      REQUIRE(map.Get(key) == value);
+    }
+    int counter = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+      REQUIRE(expected.at(it->first) == it->second);
+      counter++;
+    }
+    REQUIRE(counter == static_cast<int>(expected.size()));
+  }
+
+  SECTION("Incremental Resize: Copying, moving and clearing during the migration") {
+    Map<String, int> map(4);
+    map.SetIncrementalResize(true);
+    int inserted = 0;
+    while (!map.IsResizing() || inserted < 64) {
+      map.Insert(String{"Key"} + inserted, inserted);
+      inserted++;
+    }
+    REQUIRE(map.ToString().Contains("Key0 : 0"));
+
+    Map<String, int> copy(map);
+    REQUIRE(copy.GetSize() == static_cast<Size>(inserted));
+    for (int i = 0; i < inserted; ++i) {
+      REQUIRE(copy.Get(String{"Key"} + i) == i);
+    }
+
+    Map<String, int> moved(std::move(map));
+    REQUIRE(moved.Get("Key0") == 0);
+    moved.Remove("Key0");
+    REQUIRE(moved.Exists("Key0") == false);
+    REQUIRE(moved.GetSize() == static_cast<Size>(inserted - 1));
+
+    moved.SetIncrementalResize(false);
+    REQUIRE(moved.IsResizing() == false);
+    REQUIRE(moved.Get("Key1") == 1);
+
+    copy.Clear();
+    REQUIRE(copy.IsResizing() == false);
+    REQUIRE(copy.GetSize() == 0);
+    copy.Insert("Key", 1);
+    REQUIRE(copy.Get("Key") == 1);
+  }
+
+  SECTION("Reserve: Inserting up to the reserved size never resizes") {
+    Map<int, int> map(2);
+    map.Reserve(1000);
+    map.SetIncrementalResize(true);
+    for (int i = 0; i < 1000; ++i) {
+      map.Insert(i, i);
+      REQUIRE(map.IsResizing() == false);
+    }
+    REQUIRE(map.GetSize() == 1000);
+
+    map.Reserve(10);
+    REQUIRE(map.Get(999) == 999);
+
+    Map<int, int> fixed(4, algorithms::Hash::FNV1a, 0.7, false);
+    fixed.Reserve(100);
+    for (int i = 0; i < 100; ++i) {
+      fixed.Insert(i, i);
+    }
+    REQUIRE(fixed.GetSize() == 100);
+  }
+}
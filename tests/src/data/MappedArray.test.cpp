@@ -0,0 +1,114 @@
+/**
+* @file MappedArray.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "data/MappedArray.hpp"
+
+TEST_CASE("MappedArray functionality validation", "[data]") {
+  using namespace ntl;
+
+  const std::string path = (std::filesystem::temp_directory_path() / "ntl_mapped_array.bin").string();
+
+  SECTION("saving and mapping an unsorted array") {
+    Array<I32> array(1000);
+    for(I32 i = 0; i < 1000; ++i)
+      array.Insert((i * 7919) % 1000);
+    REQUIRE(persist::Save(array, path.c_str()));
+
+    MappedArray<I32> mapped;
+    REQUIRE(mapped.Open(path.c_str(), true));
+    REQUIRE(mapped.IsOpen());
+    REQUIRE(!mapped.IsSorted());
+    REQUIRE(mapped.GetSize() == array.GetSize());
+    for(Size i = 0; i < array.GetSize(); ++i)
+      REQUIRE(mapped[i] == array[i]);
+    REQUIRE(mapped.Find(array[500]) == 500);
+    REQUIRE(!mapped.Contains(1000));
+
+    Size count = 0;
+    for(const I32 element : mapped)
+      count += element == array[count] ? 1 : 0;
+    REQUIRE(count == 1000);
+  }
+
+  SECTION("saving and mapping a sorted array") {
+    Array<double> array(128, true);
+    for(int i = 0; i < 100; ++i)
+      array.Insert(100.0 - i);
+    REQUIRE(persist::Save(array, path.c_str()));
+
+    MappedArray<double> mapped;
+    REQUIRE(mapped.Open(path.c_str()));
+    REQUIRE(mapped.IsSorted());
+    REQUIRE(mapped[0] == 1.0);
+    REQUIRE(mapped.Find(42.0) == 41);
+    REQUIRE(mapped.Find(0.5) == -1);
+    REQUIRE(reinterpret_cast<UPtr>(mapped.GetData()) % persist::ALIGNMENT == 0);
+  }
+
+  SECTION("saving and mapping an empty array") {
+    const Array<I64> array(4);
+    REQUIRE(persist::Save(array, path.c_str()));
+
+    MappedArray<I64> mapped;
+    REQUIRE(mapped.Open(path.c_str(), true));
+    REQUIRE(mapped.IsEmpty());
+    REQUIRE(mapped.Find(1) == -1);
+    REQUIRE(mapped.begin() == mapped.end());
+  }
+
+  SECTION("rejecting mismatching and corrupted files") {
+    Array<I32> array(64);
+    for(I32 i = 0; i < 64; ++i)
+      array.Insert(i);
+    REQUIRE(persist::Save(array, path.c_str()));
+
+    MappedArray<I64> wrong_type;
+    REQUIRE(!wrong_type.Open(path.c_str()));
+    REQUIRE(!wrong_type.IsOpen());
+
+    {
+      std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+      file.seekp(sizeof(persist::Header) + 8);
+      file.put('\x7f');
+    }
+    MappedArray<I32> corrupted;
+    REQUIRE(corrupted.Open(path.c_str()));
+    REQUIRE(!corrupted.Open(path.c_str(), true));
+
+    MappedArray<I32> missing;
+    REQUIRE(!missing.Open("/nonexistent/ntl_mapped_array.bin"));
+  }
+
+  SECTION("moving a mapped array") {
+    Array<U16> array(16);
+    array.Insert(3);
+    array.Insert(5);
+    REQUIRE(persist::Save(array, path.c_str()));
+
+    MappedArray<U16> mapped;
+    REQUIRE(mapped.Open(path.c_str()));
+    MappedArray<U16> moved{std::move(mapped)};
+    REQUIRE(!mapped.IsOpen());
+    REQUIRE(moved.GetSize() == 2);
+    REQUIRE(moved[1] == 5);
+
+    mapped = std::move(moved);
+    REQUIRE(mapped.Get(0) == 3);
+    mapped.Close();
+    REQUIRE(!mapped.IsOpen());
+    REQUIRE(mapped.GetSize() == 0);
+  }
+
+  std::remove(path.c_str());
+}
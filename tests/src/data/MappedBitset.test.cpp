@@ -0,0 +1,55 @@
+/**
+* @file MappedBitset.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "data/MappedBitset.hpp"
+
+TEST_CASE("MappedBitset functionality validation", "[data]") {
+  using namespace ntl;
+
+  const std::string path = (std::filesystem::temp_directory_path() / "ntl_mapped_bitset.bin").string();
+
+  SECTION("saving and mapping a bitset") {
+    PackedBitset<1000> bitset{};
+    for(Size i = 0; i < 1000; i += 3)
+      bitset.Set(i);
+    REQUIRE(persist::Save(bitset, path.c_str()));
+
+    MappedBitset mapped;
+    REQUIRE(mapped.Open(path.c_str(), true));
+    REQUIRE(mapped.IsOpen());
+    REQUIRE(mapped.GetCapacity() == 1000);
+    REQUIRE(mapped.GetWordCount() == 16);
+    REQUIRE(mapped.GetCount() == bitset.GetCount());
+    for(Size i = 0; i < 1000; ++i)
+      REQUIRE(mapped.IsSet(i) == bitset.IsSet(i));
+  }
+
+  SECTION("rejecting other containers") {
+    PackedBitset<64> bitset{};
+    bitset.Set(63);
+    REQUIRE(persist::Save(bitset, path.c_str()));
+
+    MappedBitset mapped;
+    REQUIRE(mapped.Open(path.c_str()));
+    MappedBitset moved{std::move(mapped)};
+    REQUIRE(!mapped.IsOpen());
+    REQUIRE(moved.IsSet(63));
+    REQUIRE(moved.GetCount() == 1);
+
+    moved.Close();
+    REQUIRE(!moved.IsOpen());
+    REQUIRE(!mapped.Open("/nonexistent/ntl_mapped_bitset.bin"));
+  }
+
+  std::remove(path.c_str());
+}
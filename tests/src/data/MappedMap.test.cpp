@@ -0,0 +1,79 @@
+/**
+* @file MappedMap.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "data/MappedMap.hpp"
+
+TEST_CASE("MappedMap functionality validation", "[data]") {
+  using namespace ntl;
+
+  const std::string path = (std::filesystem::temp_directory_path() / "ntl_mapped_map.bin").string();
+
+  SECTION("saving and mapping a map") {
+    Map<U64, double> map(16);
+    for(U64 i = 0; i < 5000; ++i)
+      map.Insert(i * 31, static_cast<double>(i) / 2);
+    REQUIRE(persist::Save(map, path.c_str()));
+
+    MappedMap<U64, double> mapped;
+    REQUIRE(mapped.Open(path.c_str(), true));
+    REQUIRE(mapped.IsOpen());
+    REQUIRE(mapped.GetSize() == 5000);
+    REQUIRE(mapped.GetCapacity() >= 5000);
+    REQUIRE(mapped.GetAlgorithm() == map.GetAlgorithm());
+
+    for(U64 i = 0; i < 5000; ++i) {
+      REQUIRE(mapped.Exists(i * 31));
+      REQUIRE(mapped[i * 31] == static_cast<double>(i) / 2);
+    }
+    REQUIRE(!mapped.Exists(1));
+    REQUIRE(mapped.Find(5000 * 31) == nullptr);
+
+    Size count = 0;
+    double total = 0;
+    mapped.ForEach([&](const U64 a_key, const double a_value) {
+      ++count;
+      total += a_value - static_cast<double>(a_key / 31) / 2;
+    });
+    REQUIRE(count == 5000);
+    REQUIRE(total == 0);
+  }
+
+  SECTION("saving and mapping an empty map") {
+    const Map<I32, I32> map(8);
+    REQUIRE(persist::Save(map, path.c_str()));
+
+    MappedMap<I32, I32> mapped;
+    REQUIRE(mapped.Open(path.c_str(), true));
+    REQUIRE(mapped.IsEmpty());
+    REQUIRE(!mapped.Exists(0));
+  }
+
+  SECTION("rejecting a map of other types") {
+    Map<I32, I32> map(8);
+    map.Insert(1, 2);
+    REQUIRE(persist::Save(map, path.c_str()));
+
+    MappedMap<I32, I64> wrong_value;
+    REQUIRE(!wrong_value.Open(path.c_str()));
+
+    MappedMap<I32, I32> mapped;
+    REQUIRE(mapped.Open(path.c_str()));
+    REQUIRE(mapped.Get(1) == 2);
+
+    MappedMap<I32, I32> moved{std::move(mapped)};
+    REQUIRE(!mapped.IsOpen());
+    REQUIRE(moved.Get(1) == 2);
+  }
+
+  std::remove(path.c_str());
+}
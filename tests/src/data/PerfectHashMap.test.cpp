@@ -0,0 +1,129 @@
+/**
+* @file PerfectHashMap.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <set>
+
+#include "Process.hpp"
+#include "data/PerfectHashMap.hpp"
+#include "data/String.hpp"
+
+namespace {
+  using namespace ntl;
+
+  constexpr auto g_keywords = MakePerfectHashMap<StringView, int>({
+    {"if", 0}, {"else", 1}, {"while", 2}, {"for", 3}, {"return", 4}, {"break", 5}, {"continue", 6},
+    {"switch", 7}, {"case", 8}, {"default", 9}, {"struct", 10}, {"class", 11}, {"enum", 12}
+  });
+
+  static_assert(g_keywords.GetSize() == 13);
+  static_assert(g_keywords.Get("while") == 2);
+  static_assert(g_keywords["enum"] == 12);
+  static_assert(g_keywords.Exists("default"));
+  static_assert(!g_keywords.Exists("goto"));
+  static_assert(!g_keywords.Exists("") && !g_keywords.Exists("whilst"));
+
+  constexpr Size COUNT = 500;
+
+  // squares of the keys, built entirely at compile time
+  constexpr auto g_squares = [] {
+    Pair<int, int> entries[COUNT]{};
+    for(Size i = 0; i < COUNT; ++i)
+      entries[i] = {static_cast<int>(i * 7), static_cast<int>(i * i)};
+    return PerfectHashMap<int, int, COUNT>(entries);
+  }();
+
+  static_assert(g_squares.Get(7 * 499) == 499 * 499);
+  static_assert(g_squares.TryGet(1) == nullptr);
+
+  // maps every key into the same bucket, so a single seed has to place all of them
+  struct BucketHasher {
+    U64 operator()(const int& a_key) const { return static_cast<U64>(a_key); }
+  };
+
+  // hashes every key to the same value, so no seed can separate them
+  struct ConstantHasher {
+    U64 operator()(const int&) const { return 42; }
+  };
+}
+
+TEST_CASE("PerfectHashMap functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("looking up keys") {
+    for(const auto& [key, value] : g_keywords) {
+      REQUIRE(g_keywords.Exists(key));
+      REQUIRE(g_keywords.Get(key) == value);
+      REQUIRE(*g_keywords.TryGet(key) == value);
+    }
+    REQUIRE(g_keywords.Get("if") == 0);
+    REQUIRE(g_keywords.Get("continue") == 6);
+    REQUIRE_FALSE(g_keywords.Exists("iff"));
+    REQUIRE_FALSE(g_keywords.Exists("els"));
+    REQUIRE(g_keywords.TryGet("do") == nullptr);
+  }
+
+  SECTION("looking up runtime strings") {
+    const String key = String("ret") + "urn";
+    REQUIRE(g_keywords.Get(key) == 4);
+    REQUIRE(g_keywords.TryGet(String("Return")) == nullptr);
+  }
+
+  SECTION("indexing slots") {
+    std::set<Size> slots{};
+    for(const auto& entry : g_keywords) {
+      const Size index = g_keywords.IndexOf(entry.first);
+      REQUIRE(index < g_keywords.GetSize());
+      REQUIRE(&*(g_keywords.begin() + index) == &entry);
+      slots.insert(index);
+    }
+    REQUIRE(slots.size() == g_keywords.GetSize());
+    REQUIRE(g_keywords.IndexOf("unknown") == g_keywords.GetSize());
+  }
+
+  SECTION("building large maps") {
+    REQUIRE(g_squares.end() - g_squares.begin() == COUNT);
+    for(Size i = 0; i < COUNT; ++i) {
+      REQUIRE(g_squares.Get(static_cast<int>(i * 7)) == static_cast<int>(i * i));
+      if(i % 7 != 0)
+        REQUIRE_FALSE(g_squares.Exists(static_cast<int>(i)));
+    }
+    REQUIRE_FALSE(g_squares.Exists(-7));
+    REQUIRE_FALSE(g_squares.Exists(7 * COUNT));
+  }
+
+  SECTION("building at runtime") {
+    Pair<int, int> entries[8]{};
+    for(int i = 0; i < 8; ++i)
+      entries[i] = {i, -i};
+
+    const PerfectHashMap<int, int, 8, BucketHasher> map(entries);
+    for(int i = 0; i < 8; ++i)
+      REQUIRE(map.Get(i) == -i);
+    REQUIRE_FALSE(map.Exists(8));
+  }
+
+  SECTION("rejecting duplicate keys") {
+    REQUIRE(test::Aborts([] {
+      const Pair<int, int> entries[] = {{1, 10}, {2, 20}, {1, 30}};
+      const PerfectHashMap<int, int, 3> map(entries);
+      static_cast<void>(map.Get(2));
+    }));
+    REQUIRE(test::Aborts([] {
+      const Pair<int, int> entries[] = {{1, 10}, {2, 20}};
+      const PerfectHashMap<int, int, 2, ConstantHasher> map(entries);
+      static_cast<void>(map.Get(2));
+    }));
+  }
+
+  SECTION("single entry") {
+    constexpr auto map = MakePerfectHashMap<StringView, int>({{"only", 1}});
+    STATIC_REQUIRE(map.Get("only") == 1);
+    STATIC_REQUIRE_FALSE(map.Exists("other"));
+  }
+}
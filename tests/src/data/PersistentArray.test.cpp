@@ -0,0 +1,124 @@
+/**
+* @file PersistentArray.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <vector>
+
+#include "data/PersistentArray.hpp"
+#include "data/String.hpp"
+
+TEST_CASE("PersistentArray functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new array") {
+    PersistentArray<int> array{};
+    REQUIRE(array.GetSize() == 0);
+    REQUIRE(array.IsEmpty());
+    REQUIRE(array.begin() == array.end());
+    REQUIRE(array.ToString() == "PersistentArray()");
+  }
+
+  SECTION("pushing and popping over several levels") {
+    PersistentArray<int> array{};
+    for(int i = 0; i < 40000; ++i)
+      array.PushBack(i);
+    REQUIRE(array.GetSize() == 40000);
+
+    for(int i = 0; i < 40000; ++i)
+      REQUIRE(array[i] == i);
+
+    int expected = 0;
+    for(const int value : array)
+      REQUIRE(value == expected++);
+    REQUIRE(expected == 40000);
+
+    for(int i = 39999; i >= 0; --i) {
+      REQUIRE(array.Get(array.GetSize() - 1) == i);
+      array.PopBack();
+    }
+    REQUIRE(array.IsEmpty());
+
+    array.PushBack(7);
+    REQUIRE(array.ToString() == "PersistentArray(7)");
+  }
+
+  SECTION("copies are snapshots") {
+    PersistentArray<int> array{};
+    for(int i = 0; i < 1000; ++i)
+      array.PushBack(i);
+
+    PersistentArray<int> snapshot{array};
+    REQUIRE(snapshot.IsSharedWith(array));
+    REQUIRE(snapshot == array);
+
+    array.Set(500, -1);
+    array.At(0) = -2;
+    array.PushBack(1000);
+    REQUIRE_FALSE(snapshot.IsSharedWith(array));
+    REQUIRE(snapshot != array);
+
+    REQUIRE(array[500] == -1);
+    REQUIRE(array[0] == -2);
+    REQUIRE(array.GetSize() == 1001);
+    for(int i = 0; i < 1000; ++i)
+      REQUIRE(snapshot[i] == i);
+    REQUIRE(snapshot.GetSize() == 1000);
+
+    // the snapshot is dropped first, so the array owns all nodes again
+    snapshot.Clear();
+    array.Set(1, -3);
+    REQUIRE(array[1] == -3);
+    REQUIRE(array[2] == 2);
+  }
+
+  SECTION("many generations of snapshots") {
+    std::vector<PersistentArray<String>> generations;
+    PersistentArray<String> array{};
+
+    for(int i = 0; i < 300; ++i) {
+      if(i % 3 == 0 && array.GetSize() > 0)
+        array.Set(static_cast<Size>(i) % array.GetSize(), String("set ") + i);
+      else if(i % 7 == 0 && array.GetSize() > 0)
+        array.PopBack();
+      else
+        array.PushBack(String().Append(i));
+      generations.push_back(array);
+    }
+
+    // replays the operations and compares every generation with its snapshot
+    std::vector<String> expected;
+    for(int i = 0; i < 300; ++i) {
+      if(i % 3 == 0 && !expected.empty())
+        expected[static_cast<Size>(i) % expected.size()] = String("set ") + i;
+      else if(i % 7 == 0 && !expected.empty())
+        expected.pop_back();
+      else
+        expected.push_back(String().Append(i));
+
+      const PersistentArray<String>& generation = generations[i];
+      REQUIRE(generation.GetSize() == expected.size());
+      for(Size j = 0; j < expected.size(); ++j)
+        REQUIRE(generation[j] == expected[j]);
+    }
+  }
+
+  SECTION("moving arrays") {
+    PersistentArray<int> array{};
+    for(int i = 0; i < 100; ++i)
+      array.PushBack(i);
+
+    PersistentArray<int> moved{std::move(array)};
+    REQUIRE(array.IsEmpty());
+    REQUIRE(moved.GetSize() == 100);
+
+    array = moved;
+    moved = PersistentArray<int>{};
+    REQUIRE(moved.IsEmpty());
+    REQUIRE(array[99] == 99);
+  }
+}
@@ -0,0 +1,155 @@
+/**
+* @file PersistentMap.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+#include "data/PersistentMap.hpp"
+#include "data/String.hpp"
+
+namespace {
+  // keeps two bits of the key, so most keys collide in the trie and share collision nodes
+  struct CollidingHasher {
+    ntl::U64 operator()(const int& a_key) const { return static_cast<ntl::U64>(a_key & 3) << 58; }
+  };
+}
+
+TEST_CASE("PersistentMap functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new map") {
+    PersistentMap<int, int> map{};
+    REQUIRE(map.GetSize() == 0);
+    REQUIRE(map.IsEmpty());
+    REQUIRE(map.begin() == map.end());
+    REQUIRE_FALSE(map.Exists(1));
+    REQUIRE_FALSE(map.Remove(1));
+    REQUIRE(map.ToString() == "PersistentMap()");
+  }
+
+  SECTION("inserting, replacing and removing") {
+    PersistentMap<String, int> map{};
+    REQUIRE(map.Insert("one", 1));
+    REQUIRE(map.Insert("two", 2));
+    REQUIRE_FALSE(map.Insert("one", 11));
+    REQUIRE(map.GetSize() == 2);
+    REQUIRE(map["one"] == 11);
+    REQUIRE(*map.TryGet("two") == 2);
+    REQUIRE(map.TryGet("three") == nullptr);
+
+    REQUIRE(map.Remove("one"));
+    REQUIRE_FALSE(map.Remove("one"));
+    REQUIRE(map.ToString() == "PersistentMap(two : 2)");
+    REQUIRE(map.Remove("two"));
+    REQUIRE(map.IsEmpty());
+  }
+
+  SECTION("random operations") {
+    PersistentMap<int, int> map{};
+    std::unordered_map<int, int> expected;
+
+    unsigned state = 3;
+    for(int step = 0; step < 50000; ++step) {
+      state = state * 1103515245u + 12345u;
+      const int key = static_cast<int>((state >> 8) % 8192);
+
+      if((state >> 4) % 3 == 0) {
+        REQUIRE(map.Remove(key) == (expected.erase(key) == 1));
+      } else {
+        REQUIRE(map.Insert(key, step) == !expected.contains(key));
+        expected[key] = step;
+      }
+      REQUIRE(map.GetSize() == expected.size());
+    }
+
+    for(const auto& [key, value] : expected)
+      REQUIRE(map.Get(key) == value);
+
+    Size counter = 0;
+    for(auto it = map.begin(); it != map.end(); ++it) {
+      REQUIRE(expected.at(it.GetKey()) == it.GetValue());
+      counter++;
+    }
+    REQUIRE(counter == expected.size());
+  }
+
+  SECTION("colliding hashes") {
+    PersistentMap<int, int, CollidingHasher> map{};
+    for(int i = 0; i < 200; ++i)
+      REQUIRE(map.Insert(i, i * 2));
+    REQUIRE(map.GetSize() == 200);
+
+    PersistentMap<int, int, CollidingHasher> snapshot{map};
+    for(int i = 0; i < 200; i += 2)
+      REQUIRE(map.Remove(i));
+
+    for(int i = 0; i < 200; ++i) {
+      REQUIRE(map.Exists(i) == (i % 2 == 1));
+      REQUIRE(snapshot.Get(i) == i * 2);
+    }
+
+    Size counter = 0;
+    for(auto it = map.begin(); it != map.end(); ++it)
+      counter++;
+    REQUIRE(counter == 100);
+  }
+
+  SECTION("copies are snapshots") {
+    PersistentMap<int, String> map{};
+    for(int i = 0; i < 1000; ++i)
+      map.Insert(i, String().Append(i));
+
+    PersistentMap<int, String> snapshot{map};
+    REQUIRE(snapshot.IsSharedWith(map));
+    REQUIRE(snapshot == map);
+
+    map.Insert(5, "five");
+    map.Insert(1000, "new");
+    map.Remove(7);
+    REQUIRE_FALSE(snapshot.IsSharedWith(map));
+    REQUIRE(snapshot != map);
+
+    REQUIRE(map.Get(5) == "five");
+    REQUIRE(map.Exists(1000));
+    REQUIRE_FALSE(map.Exists(7));
+    REQUIRE(snapshot.Get(5) == "5");
+    REQUIRE_FALSE(snapshot.Exists(1000));
+    REQUIRE(snapshot.Get(7) == "7");
+    REQUIRE(snapshot.GetSize() == 1000);
+
+    std::vector<PersistentMap<int, String>> generations;
+    for(int i = 0; i < 100; ++i) {
+      map.Insert(i, String("generation ") + i);
+      generations.push_back(map);
+    }
+    for(int i = 0; i < 100; ++i) {
+      REQUIRE(generations[i].Get(i) == String("generation ") + i);
+      REQUIRE(generations[i].Exists(7) == (i >= 7));
+      if(i < 99)
+        REQUIRE(generations[i].Get(99) == "99");
+      if(i < 5)
+        REQUIRE(generations[i].Get(5) == "five");
+    }
+  }
+
+  SECTION("moving maps") {
+    PersistentMap<int, int> map{};
+    for(int i = 0; i < 100; ++i)
+      map.Insert(i, i);
+
+    PersistentMap<int, int> moved{std::move(map)};
+    REQUIRE(map.IsEmpty());
+    REQUIRE(moved.GetSize() == 100);
+
+    map = moved;
+    moved.Clear();
+    REQUIRE(moved.IsEmpty());
+    REQUIRE(map.Get(99) == 99);
+  }
+}
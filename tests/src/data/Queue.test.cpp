@@ -56,4 +56,16 @@ TEST_CASE("Queue functionality validation", "[data]") {
     REQUIRE(stack.Peek() == 8);
     REQUIRE(stack.GetSize() == 1);
   }
+
+  SECTION("moving elements into the queue") {
+    Queue<String> queue{};
+    queue.Put(String{"first"});
+    queue.Emplace("second");
+
+    Queue<String> moved(std::move(queue));
+    REQUIRE(moved.GetSize() == 2);
+    REQUIRE(moved.Get() == "first");
+    REQUIRE(moved.Get() == "second");
+    REQUIRE(moved.IsEmpty());
+  }
 }
@@ -0,0 +1,112 @@
+/**
+* @file RingQueue.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include "data/RingQueue.hpp"
+#include "data/String.hpp"
+
+TEST_CASE("RingQueue functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new queue") {
+    RingQueue<int> queue{};
+    REQUIRE(queue.GetSize() == 0);
+    REQUIRE(queue.GetCapacity() == 0);
+    REQUIRE(queue.IsEmpty());
+  }
+
+  SECTION("putting and getting elements in order") {
+    RingQueue<int> queue{};
+    queue.Put(2);
+    queue.Put(4);
+    queue.Emplace(8);
+    REQUIRE(queue.GetSize() == 3);
+    REQUIRE(queue.Peek() == 2);
+    REQUIRE(queue.Get() == 2);
+    REQUIRE(queue.Get() == 4);
+    REQUIRE(queue.Get() == 8);
+    REQUIRE(queue.IsEmpty());
+  }
+
+  SECTION("growing while wrapped around") {
+    RingQueue<int> queue{};
+    queue.Reserve(4);
+    REQUIRE(queue.GetCapacity() == RingQueue<int>::DEFAULT_CAPACITY);
+
+    // move the head to the middle of the buffer, so the elements wrap around
+    for(int i = 0; i < 10; ++i)
+      queue.Put(i);
+    for(int i = 0; i < 10; ++i)
+      REQUIRE(queue.Get() == i);
+
+    for(int i = 0; i < 100; ++i)
+      queue.Put(i);
+    REQUIRE(queue.GetCapacity() == 128);
+
+    for(int i = 0; i < 100; ++i)
+      REQUIRE(queue.Get() == i);
+    REQUIRE(queue.IsEmpty());
+  }
+
+  SECTION("putting and getting many elements") {
+    RingQueue<int> queue{};
+    int elements[40];
+    for(int i = 0; i < 40; ++i)
+      elements[i] = i;
+
+    queue.PutMany(elements, 12);
+    int results[40]{};
+    REQUIRE(queue.GetMany(results, 10) == 10);
+    REQUIRE(results[9] == 9);
+
+    // wraps around the end of the 16 slots
+    queue.PutMany(elements + 12, 12);
+    REQUIRE(queue.GetCapacity() == 16);
+    REQUIRE(queue.GetSize() == 14);
+
+    queue.PutMany(elements + 24, 16);
+    REQUIRE(queue.GetSize() == 30);
+    REQUIRE(queue.GetMany(results, 40) == 30);
+    for(int i = 0; i < 30; ++i)
+      REQUIRE(results[i] == i + 10);
+    REQUIRE(queue.IsEmpty());
+  }
+
+  SECTION("peeking without copying") {
+    RingQueue<String> queue{};
+    queue.Put(String{"first"});
+    queue.Peek().Append(String{"!"});
+    REQUIRE(queue.Peek() == "first!");
+    REQUIRE(queue.GetSize() == 1);
+  }
+
+  SECTION("copying and moving queues") {
+    RingQueue<String> queue{};
+    for(int i = 0; i < 20; ++i)
+      queue.Put(String{"element"});
+    queue.Get();
+    queue.Put(String{"last"});
+
+    RingQueue<String> copy(queue);
+    REQUIRE(copy.GetSize() == 20);
+
+    RingQueue<String> moved(std::move(queue));
+    REQUIRE(moved.GetSize() == 20);
+    REQUIRE(queue.IsEmpty());
+
+    String results[20];
+    REQUIRE(copy.GetMany(results, 20) == 20);
+    REQUIRE(results[19] == "last");
+
+    copy = moved;
+    REQUIRE(copy.GetSize() == 20);
+    copy.Clear();
+    REQUIRE(copy.IsEmpty());
+    REQUIRE(copy.GetCapacity() >= 20);
+  }
+}
@@ -0,0 +1,102 @@
+/**
+* @file SmallArray.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include "data/SmallArray.hpp"
+#include "data/String.hpp"
+
+TEST_CASE("SmallArray functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new array") {
+    SmallArray<int, 4> array;
+    REQUIRE(array.IsEmpty());
+    REQUIRE(array.IsInline());
+    REQUIRE(array.GetCapacity() == 4);
+  }
+
+  SECTION("spilling to the heap") {
+    SmallArray<int, 4> array{1, 2, 3, 4};
+    REQUIRE(array.IsInline());
+
+    array.Insert(5);
+    REQUIRE(!array.IsInline());
+    REQUIRE(array.GetCapacity() == 8);
+
+    for(int i = 6; i <= 100; ++i)
+      array.Insert(i);
+    REQUIRE(array.GetSize() == 100);
+    for(Size i = 0; i < array.GetSize(); ++i)
+      REQUIRE(array[i] == static_cast<int>(i + 1));
+  }
+
+  SECTION("inserting and removing elements") {
+    SmallArray<String, 2> array;
+    array.Insert("a");
+    array.Insert("c");
+    array.Insert("b", 1);
+    array.Insert(array[0]);
+    REQUIRE(array.GetSize() == 4);
+    REQUIRE(array[1] == "b");
+    REQUIRE(array[3] == "a");
+
+    REQUIRE(array.Remove(0) == "a");
+    REQUIRE(array.RemoveElement("c") == 1);
+    REQUIRE(array.GetSize() == 2);
+    REQUIRE(array.GetFirst() == "b");
+    REQUIRE(array.GetLast() == "a");
+
+    array.Clear();
+    REQUIRE(array.IsEmpty());
+    REQUIRE(array.GetCapacity() >= 4);
+  }
+
+  SECTION("sorting and searching elements") {
+    SmallArray<int, 8> array;
+    for(int i = 0; i < 20; ++i)
+      array.Insert((i * 7) % 20);
+
+    array.Sort();
+    REQUIRE(array.IsSorted());
+    for(int i = 0; i < 20; ++i)
+      REQUIRE(array.Find(i) == i);
+    REQUIRE(array.Find(20) == -1);
+  }
+
+  SECTION("copying and moving arrays") {
+    SmallArray<String, 2> small{String{"a"}, String{"b"}};
+    SmallArray<String, 2> big{String{"a"}, String{"b"}, String{"c"}};
+
+    SmallArray<String, 2> copy{big};
+    REQUIRE(copy == big);
+    copy = small;
+    REQUIRE(copy == small);
+    REQUIRE(SmallArray<String, 2>{small}.IsInline());
+
+    SmallArray<String, 2> moved{std::move(small)};
+    REQUIRE(moved.IsInline());
+    REQUIRE(moved[1] == "b");
+    REQUIRE(small.IsEmpty());
+
+    String* data = big.GetData();
+    moved = std::move(big);
+    REQUIRE(moved.GetData() == data);
+    REQUIRE(moved.GetSize() == 3);
+    REQUIRE(big.IsEmpty());
+    REQUIRE(big.IsInline());
+  }
+
+  SECTION("iterating over the array") {
+    SmallArray<int, 2> array{1, 2, 3};
+    int sum = 0;
+    for(int value : array)
+      sum += value;
+    REQUIRE(sum == 6);
+    REQUIRE(array.ToString() == "SmallArray(1, 2, 3)\n");
+  }
+}
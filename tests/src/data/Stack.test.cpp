@@ -56,4 +56,16 @@ TEST_CASE("Stack functionality validation", "[data]") {
     REQUIRE(stack.Peek() == 2);
     REQUIRE(stack.GetSize() == 1);
   }
+
+  SECTION("moving elements onto the stack") {
+    Stack<String> stack{};
+    stack.Push(String{"first"});
+    stack.Emplace("second");
+
+    Stack<String> copy = stack;
+    REQUIRE(copy.GetSize() == 2);
+    REQUIRE(copy.Pop() == "second");
+    REQUIRE(copy.Pop() == "first");
+    REQUIRE(stack.Peek() == "second");
+  }
 }
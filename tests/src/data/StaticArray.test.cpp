@@ -0,0 +1,100 @@
+/**
+* @file StaticArray.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include "data/StaticArray.hpp"
+#include "data/String.hpp"
+
+namespace {
+  constexpr ntl::I64 sortAndFind() {
+    ntl::StaticArray<int, 8> array{5, 3, 8, 1};
+    array.Sort();
+    return array.Find(5);
+  }
+}
+
+TEST_CASE("StaticArray functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new array") {
+    StaticArray<int, 4> array;
+    REQUIRE(array.IsEmpty());
+    REQUIRE(array.IsSorted());
+    REQUIRE(array.GetCapacity() == 4);
+    REQUIRE(sizeof(array) <= 4 * sizeof(int) + 2 * sizeof(Size));
+  }
+
+  SECTION("using the array while compiling") {
+    static_assert(sortAndFind() == 2);
+
+    constexpr StaticArray<int, 3> array{1, 2, 3};
+    static_assert(array.GetSize() == 3);
+    static_assert(array.GetLast() == 3);
+    REQUIRE(array.Find(2) == 1);
+  }
+
+  SECTION("inserting and removing elements") {
+    StaticArray<int, 8> array;
+    for(int i = 0; i < 6; ++i)
+      REQUIRE(array.Insert(i) == static_cast<Size>(i));
+
+    array.Insert(10, 2);
+    REQUIRE(array.GetSize() == 7);
+    REQUIRE(array[2] == 10);
+    REQUIRE(array[3] == 2);
+
+    REQUIRE(array.Remove(2) == 10);
+    REQUIRE(array.RemoveElement(5) == 5);
+    REQUIRE(array.RemoveElement(42) == -1);
+    REQUIRE(array.GetSize() == 5);
+    REQUIRE(array.GetLast() == 4);
+
+    array.Emplace(7);
+    array.Emplace(8);
+    array.Emplace(9);
+    REQUIRE(array.IsFull());
+  }
+
+  SECTION("sorting and searching elements") {
+    StaticArray<String, 4> array{String{"d"}, String{"b"}, String{"c"}, String{"a"}};
+    REQUIRE(array.Find("b") == 1);
+
+    array.Sort();
+    REQUIRE(array.IsSorted());
+    REQUIRE(array[0] == "a");
+    REQUIRE(array[3] == "d");
+    REQUIRE(array.Find("c") == 2);
+    REQUIRE(array.Find("e") == -1);
+  }
+
+  SECTION("copying and moving arrays") {
+    StaticArray<String, 4> array{String{"a very long string that is stored on the heap"}, String{"b"}};
+
+    StaticArray<String, 4> copy{array};
+    REQUIRE(copy == array);
+
+    StaticArray<String, 4> moved{std::move(copy)};
+    REQUIRE(moved == array);
+    REQUIRE(copy.IsEmpty());
+
+    copy = moved;
+    REQUIRE(copy[1] == "b");
+    array = std::move(moved);
+    REQUIRE(array.GetSize() == 2);
+    REQUIRE(moved.IsEmpty());
+  }
+
+  SECTION("iterating over the array") {
+    StaticArray<int, 4> array{1, 2, 3};
+    int sum = 0;
+    for(int value : array)
+      sum += value;
+    REQUIRE(sum == 6);
+    REQUIRE(array.ToString() == "StaticArray(1, 2, 3)\n");
+  }
+}
@@ -7,7 +7,10 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <cstring>
+
 #include "data/Array.hpp"
+#include "data/StaticArray.hpp"
 #include "data/String.hpp"
 
 TEST_CASE("String functionality validation", "[data]") {
@@ -111,7 +114,7 @@ TEST_CASE("String functionality validation", "[data]") {
 
   SECTION("splitting a string") {
     String string{"aabcdde"};
-    Array<String> split = string.Split(3);
+    StaticArray<String, 2> split = string.Split(3);
 
     REQUIRE(split[0].GetLength() == 4);
     REQUIRE(split[1].GetLength() == 3);
@@ -137,6 +140,61 @@ TEST_CASE("String functionality validation", "[data]") {
     REQUIRE(string == "aff");
   }
 
+  SECTION("replacing every occurrence") {
+    String growing{"a-b-c-d"};
+    growing.ReplaceAll("-", " <-> ");
+    REQUIRE(growing == "a <-> b <-> c <-> d");
+    REQUIRE(growing.GetLength() == 19);
+
+    String shrinking{"xxaxxbxxxx"};
+    shrinking.ReplaceAll("xx", "y");
+    REQUIRE(shrinking == "yaybyy");
+
+    String unchanged{"abc"};
+    unchanged.ReplaceAll("d", "e");
+    REQUIRE(unchanged == "abc");
+
+    String self{"abab"};
+    self.ReplaceAll(StringView{self.GetCString(), 1}, self);
+    REQUIRE(self == "ababbababb");
+  }
+
+  SECTION("searching long strings") {
+    String string{};
+    for (Size i = 0; i < 100; ++i)
+      string += "abc";
+    string += "needle";
+
+    REQUIRE(string.Find("needle") == 300);
+    REQUIRE(string.Find("cab") == 2);
+    REQUIRE(string.Find("abd") == StringView::NPOS);
+    REQUIRE(string.Contains("eedl") == true);
+    REQUIRE(string.Contains("neeedle") == false);
+    REQUIRE(string.Contains('n') == true);
+    REQUIRE(string.Contains('x') == false);
+    REQUIRE(string.StartsWith("abcab") == true);
+    REQUIRE(string.EndsWith("cneedle") == true);
+    REQUIRE(string.EndsWith("needles") == false);
+  }
+
+  SECTION("converting case of long strings") {
+    String string{"Hello World! 0123456789 @[`{ \xC4\xE4 The QUICK brown fox."};
+
+    REQUIRE(String{string}.ToLowerCase() == "hello world! 0123456789 @[`{ \xC4\xE4 the quick brown fox.");
+    REQUIRE(String{string}.ToUpperCase() == "HELLO WORLD! 0123456789 @[`{ \xC4\xE4 THE QUICK BROWN FOX.");
+  }
+
+  SECTION("comparing long strings") {
+    String left{"a long string which differs only at the very end: a"};
+    String right{"a long string which differs only at the very end: b"};
+
+    REQUIRE((left < right) == true);
+    REQUIRE((right > left) == true);
+    REQUIRE((left == right) == false);
+    REQUIRE((left < String{"a long string"}) == false);
+    REQUIRE((String{"\xFF"} > String{"a"}) == true);
+  }
+
   SECTION("use of string iterator") {
     String string{"aabcdde"};
 
@@ -147,4 +205,115 @@ TEST_CASE("String functionality validation", "[data]") {
     }
     REQUIRE(idx == string.GetLength());
   }
+
+  SECTION("storing short strings inline") {
+    String empty{};
+    String small{"0123456789"};
+    String large{"0123456789012345678901234567890123456789"};
+
+    REQUIRE(empty.GetCapacity() == NTL_STRING_SSO_CAPACITY);
+    REQUIRE(small.GetCapacity() == NTL_STRING_SSO_CAPACITY);
+    REQUIRE(large.GetCapacity() == large.GetLength());
+
+    String moved{std::move(small)};
+    REQUIRE(moved == "0123456789");
+    REQUIRE(small.GetLength() == 0);
+
+    swap(moved, large);
+    REQUIRE(moved == "0123456789012345678901234567890123456789");
+    REQUIRE(large == "0123456789");
+    REQUIRE(large.GetCapacity() == NTL_STRING_SSO_CAPACITY);
+
+    large = moved;
+    moved = "short";
+    REQUIRE(large.GetLength() == 40);
+    REQUIRE(moved == "short");
+  }
+
+  SECTION("reserving and shrinking capacity") {
+    String string{"abc"};
+    string.Reserve(100);
+    REQUIRE(string.GetCapacity() == 100);
+    REQUIRE(string == "abc");
+
+    string.ShrinkToFit();
+    REQUIRE(string.GetCapacity() == NTL_STRING_SSO_CAPACITY);
+    REQUIRE(string == "abc");
+
+    for (Size i = 0; i < NTL_STRING_MAX_RETAINED_CAPACITY; ++i) {
+      string += 'x';
+    }
+    string.Clear();
+    REQUIRE(string.GetCapacity() == NTL_STRING_SSO_CAPACITY);
+    REQUIRE(string.IsEmpty());
+  }
+
+  SECTION("appending a string to itself") {
+    String string{"abcdefghijklmnopqrstuvw"};
+    string += string;
+    REQUIRE(string == "abcdefghijklmnopqrstuvwabcdefghijklmnopqrstuvw");
+    string = string.GetCString() + 23;
+    REQUIRE(string == "abcdefghijklmnopqrstuvw");
+  }
+
+  SECTION("appending characters written into the buffer") {
+    String string{"ab"};
+    REQUIRE(string.AppendWith(40, [](char* a_data, const Size a_count) {
+      REQUIRE(a_count == 40);
+      std::memset(a_data, 'c', 30);
+      return Size{30};
+    }) == 30);
+    REQUIRE(string.GetLength() == 32);
+    REQUIRE(string.GetCapacity() >= 42);
+    REQUIRE(string.EndsWith("cc"));
+    REQUIRE(string.GetCString()[32] == '\0');
+
+    REQUIRE(string.AppendWith(5, [](char*, Size) { return Size{0}; }) == 0);
+    REQUIRE(string.GetLength() == 32);
+  }
+
+  SECTION("caching the hash") {
+    String string{"some key"};
+    const Size hash = string.GetHash();
+    REQUIRE(hash == static_cast<Size>(hash::WyHash("some key", 8)));
+    REQUIRE(string.GetHash() == hash);
+    REQUIRE(std::hash<String>{}(string) == hash);
+    REQUIRE(String{"some key"}.GetHash() == hash);
+    REQUIRE(String{}.GetHash() == String{""}.GetHash());
+
+    string.Append('s');
+    REQUIRE(string.GetHash() == String{"some keys"}.GetHash());
+    string.Replace("keys", "values");
+    REQUIRE(string.GetHash() == String{"some values"}.GetHash());
+    string.ToUpperCase();
+    REQUIRE(string.GetHash() == String{"SOME VALUES"}.GetHash());
+    string[0] = 's';
+    REQUIRE(string.GetHash() == String{"sOME VALUES"}.GetHash());
+    string.Append(42);
+    REQUIRE(string.GetHash() == String{"sOME VALUES42"}.GetHash());
+
+    String moved{std::move(string)};
+    REQUIRE(moved.GetHash() == String{"sOME VALUES42"}.GetHash());
+    REQUIRE(string.GetHash() == String{}.GetHash());
+
+    String copy{moved};
+    copy.ReplaceAll("E", "e");
+    REQUIRE(copy.GetHash() == String{"sOMe VALUeS42"}.GetHash());
+    copy = "a much longer string that doesn't fit inline";
+    REQUIRE(copy.GetHash() == String{"a much longer string that doesn't fit inline"}.GetHash());
+    swap(copy, moved);
+    REQUIRE(moved.GetHash() == String{"a much longer string that doesn't fit inline"}.GetHash());
+    REQUIRE(copy.GetHash() == String{"sOME VALUES42"}.GetHash());
+    copy.Clear();
+    REQUIRE(copy.GetHash() == String{}.GetHash());
+  }
+
+  SECTION("combining hashes") {
+    std::size_t first = 0, second = 0, swapped = 0;
+    hash::Combine(first, String{"key"}, 7);
+    hash::Combine(second, StringView{"key"}, 7);
+    hash::Combine(swapped, 7, String{"key"});
+    REQUIRE(first == second);
+    REQUIRE(first != swapped);
+  }
 }
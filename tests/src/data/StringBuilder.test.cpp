@@ -0,0 +1,81 @@
+/**
+* @file StringBuilder.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include "data/Array.hpp"
+#include "data/String.hpp"
+#include "data/StringBuilder.hpp"
+
+TEST_CASE("StringBuilder functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("appending pieces") {
+    StringBuilder builder{};
+    builder.Append("Key").Append(String{"Value"}).Append(StringView{"abcdef", 3}).Append('!');
+    builder << true << ' ' << std::string{"std"} << std::string_view{"view"};
+
+    REQUIRE(builder.GetLength() == 24);
+    REQUIRE(builder.GetView() == "KeyValueabc!true stdview");
+  }
+
+  SECTION("formatting numbers like std::to_string") {
+    StringBuilder builder{};
+    builder << 0 << ' ' << -42 << ' ' << Size{18446744073709551615ULL} << ' ' << 1.5 << ' ' << -0.25f;
+
+    REQUIRE(builder.Build() == "0 -42 18446744073709551615 1.500000 -0.250000");
+    REQUIRE(String{}.Append(std::numeric_limits<long long>::min()) ==
+            std::to_string(std::numeric_limits<long long>::min()).c_str());
+    REQUIRE(String{}.Append(1e300) == std::to_string(1e300).c_str());
+    REQUIRE(String{}.Append(static_cast<unsigned short>(65535)) == "65535");
+  }
+
+  SECTION("building moves the result out") {
+    StringBuilder builder{100};
+    builder << "a long string which doesn't fit into the inline buffer";
+    const char* data = builder.GetView().GetData();
+
+    String result = builder.Build();
+    REQUIRE(result.GetCString() == data);
+    REQUIRE(builder.GetLength() == 0);
+
+    builder << 1 << 2;
+    REQUIRE(builder.Build() == "12");
+  }
+
+  SECTION("concatenating with a single allocation") {
+    String key{"a key long enough to live on the heap"};
+    String result = StringBuilder::Concat(key, " : ", 42, ", ", 2.5, ' ', false);
+
+    REQUIRE(result == "a key long enough to live on the heap : 42, 2.500000 false");
+    REQUIRE(result.GetCapacity() >= result.GetLength());
+    REQUIRE(StringBuilder::Measure(key) == key.GetLength());
+    REQUIRE(StringBuilder::Measure(42) >= 2);
+  }
+
+  SECTION("concatenating temporaries in place") {
+    String first{"first part of a chain, "};
+    String result = first + "second part, " + 3 + ", " + 4.0 + ' ' + true;
+
+    REQUIRE(result == "first part of a chain, second part, 3, 4.000000 true");
+    REQUIRE(first == "first part of a chain, ");
+  }
+
+  SECTION("building container strings") {
+    Array<int> empty{};
+    REQUIRE(empty.ToString() == "Array()\n");
+
+    Array<String> array{};
+    array.Insert(String{"a"});
+    array.Insert(String{"b"});
+    REQUIRE(array.ToString() == "Array(a, b)\n");
+  }
+}
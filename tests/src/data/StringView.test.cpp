@@ -0,0 +1,172 @@
+/**
+* @file StringView.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <cstring>
+#include <set>
+
+#include "data/Array.hpp"
+#include "data/String.hpp"
+#include "data/StringView.hpp"
+
+TEST_CASE("StringView functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new view") {
+    REQUIRE(StringView{}.GetLength() == 0);
+    REQUIRE(StringView{}.IsEmpty() == true);
+    REQUIRE(StringView{"abc"}.GetLength() == 3);
+    REQUIRE(StringView{"abcdef", 2}.GetLength() == 2);
+  }
+
+  SECTION("comparing") {
+    StringView view{"abcdef", 4};
+
+    REQUIRE((view == "abcd") == true);
+    REQUIRE((view == "abcdef") == false);
+    REQUIRE((view != "abc") == true);
+    REQUIRE((view == StringView{"xabcd" + 1}) == true);
+    REQUIRE(view[3] == 'd');
+  }
+
+  SECTION("converting from and to string") {
+    String string{"abcd"};
+    StringView view = string;
+
+    REQUIRE(view.GetData() == string.GetCString());
+    REQUIRE(view.GetLength() == 4);
+    REQUIRE((string == StringView{"abcd"}) == true);
+    REQUIRE(String{StringView{"abcdef", 3}} == "abc");
+  }
+
+  SECTION("iterating") {
+    Size counter = 0;
+    for (char c : StringView{"abcdef", 3}) {
+      REQUIRE(c == "abc"[counter]);
+      counter++;
+    }
+    REQUIRE(counter == 3);
+  }
+
+  SECTION("searching and slicing") {
+    StringView view{"key=value;key2=value2"};
+
+    REQUIRE(view.Find('=') == 3);
+    REQUIRE(view.Find('=', 4) == 14);
+    REQUIRE(view.Find('x') == StringView::NPOS);
+    REQUIRE(view.Find('k', 100) == StringView::NPOS);
+    REQUIRE(view.Find("key2") == 10);
+    REQUIRE(view.Find("value2") == 15);
+    REQUIRE(view.Find("value3") == StringView::NPOS);
+    REQUIRE(view.Find("y2=", 3) == 12);
+    REQUIRE(view.FindIf([](char c) { return c == ';'; }) == 9);
+    REQUIRE(view.Substr(4, 5) == "value");
+    REQUIRE(view.Substr(15) == "value2");
+    REQUIRE(view.Substr(15, 100) == "value2");
+    REQUIRE(view.StartsWith("key=") == true);
+    REQUIRE(view.EndsWith("value2") == true);
+    REQUIRE(view.EndsWith("value") == false);
+    REQUIRE(StringView{"abcd", 3}.Find("cd") == StringView::NPOS);
+  }
+
+  SECTION("comparing lexicographically") {
+    REQUIRE(StringView{"abc"}.Compare("abd") < 0);
+    REQUIRE(StringView{"abc"}.Compare("ab") > 0);
+    REQUIRE(StringView{"abc"}.Compare(StringView{"abcd", 3}) == 0);
+    REQUIRE((StringView{"a"} < StringView{"b"}) == true);
+    REQUIRE((StringView{"b"} > StringView{"ab"}) == true);
+  }
+
+  SECTION("splitting lazily") {
+    const char* record = "1,,abc,";
+    Array<StringView> pieces{};
+
+    for (StringView piece : StringView{record}.Split(','))
+      pieces.Insert(piece);
+
+    REQUIRE(pieces.GetSize() == 4);
+    REQUIRE(pieces[0] == "1");
+    REQUIRE(pieces[1].IsEmpty() == true);
+    REQUIRE(pieces[2] == "abc");
+    REQUIRE(pieces[2].GetData() == record + 3);
+    REQUIRE(pieces[3].IsEmpty() == true);
+
+    Size counter = 0;
+    for (StringView piece : StringView{}.Split(',')) {
+      (void) piece;
+      counter++;
+    }
+    REQUIRE(counter == 0);
+
+    counter = 0;
+    for (StringView piece : StringView{"no delimiter"}.Split(',')) {
+      REQUIRE(piece == "no delimiter");
+      counter++;
+    }
+    REQUIRE(counter == 1);
+  }
+
+  SECTION("splitting by sequence and predicate") {
+    const char* expected[] = {"a", "b", "", "c"};
+    Size counter = 0;
+
+    for (StringView piece : StringView{"a::b::::c"}.Split("::")) {
+      REQUIRE(piece == expected[counter]);
+      counter++;
+    }
+    REQUIRE(counter == 4);
+
+    counter = 0;
+    for (StringView piece : StringView{"a b\tc\nd"}.Split([](char c) { return c == ' ' || c == '\t' || c == '\n'; })) {
+      REQUIRE(piece == StringView{"abcd" + counter, 1});
+      counter++;
+    }
+    REQUIRE(counter == 4);
+  }
+
+  SECTION("hashing") {
+    REQUIRE(hash::Hasher<StringView>{}(StringView{"Key1x", 4}, algorithms::Hash::FNV1a) == hash::FNV1a("Key1", 4));
+    REQUIRE(hash::Hasher<String>{}(String{"Key1"}, algorithms::Hash::DJB2) ==
+            hash::Hasher<String>{}(StringView{"Key1x", 4}, algorithms::Hash::DJB2));
+  }
+
+  SECTION("hashing word by word") {
+    // the test vectors of wyhash final version 4.2, the seed being the index of the vector
+    REQUIRE(hash::WyHash("", 0, 0) == 0x93228a4de0eec5a2ULL);
+    REQUIRE(hash::WyHash("a", 1, 1) == 0xc5bac3db178713c4ULL);
+    REQUIRE(hash::WyHash("abc", 3, 2) == 0xa97f2f7b1d9b3314ULL);
+    REQUIRE(hash::WyHash("message digest", 14, 3) == 0x786d1f1df3801df4ULL);
+    REQUIRE(hash::WyHash("abcdefghijklmnopqrstuvwxyz", 26, 4) == 0xdca5a8138ad37c87ULL);
+    const StringView alphanumeric{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789"};
+    REQUIRE(hash::WyHash(alphanumeric.GetData(), alphanumeric.GetLength(), 5) == 0xb9e734f117cfaf70ULL);
+    const StringView digits{"12345678901234567890123456789012345678901234567890123456789012345678901234567890"};
+    REQUIRE(hash::WyHash(digits.GetData(), digits.GetLength(), 6) == 0x6cc5eab49a92d617ULL);
+
+    static_assert(hash::WyHash("message digest", 14, 3) == 0x786d1f1df3801df4ULL);
+    static_assert(hash::Hasher<StringView>{}("abc", algorithms::Hash::WyHash) == hash::WyHash("abc", 3));
+
+    // every length takes a different path through the reads, and unaligned keys hash the same
+    char buffer[256 + 8];
+    for(Size i = 0; i < sizeof(buffer); ++i)
+      buffer[i] = static_cast<char>('a' + i % 26);
+
+    std::set<U64> hashes{};
+    for(Size length = 0; length <= 256; ++length) {
+      const U64 hash = hash::WyHash(buffer, length);
+      hashes.insert(hash);
+      for(Size offset = 1; offset < 8; ++offset) {
+        char copy[256 + 8];
+        std::memcpy(copy + offset, buffer, length);
+        REQUIRE(hash::WyHash(copy + offset, length) == hash);
+      }
+    }
+    REQUIRE(hashes.size() == 257);
+    REQUIRE(hash::Calculate(algorithms::Hash::WyHash, buffer, 100) == hash::WyHash(buffer, 100));
+    REQUIRE(hash::WyHash(buffer, 100, 1) != hash::WyHash(buffer, 100));
+  }
+}
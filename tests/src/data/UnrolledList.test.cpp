@@ -0,0 +1,180 @@
+/**
+* @file UnrolledList.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <list>
+#include <random>
+
+#include "data/UnrolledList.hpp"
+
+TEST_CASE("UnrolledList functionality validation", "[data]") {
+  using namespace ntl;
+
+  SECTION("constructing new list") {
+    UnrolledList<int> list{};
+
+    REQUIRE(list.GetSize() == 0);
+    REQUIRE(list.IsEmpty());
+    REQUIRE(list.begin() == list.end());
+    REQUIRE(list.ToString() == String{"UnrolledList()\n"});
+  }
+
+  SECTION("adding elements to front and back of the list") {
+    UnrolledList<int, 4> list{};
+    for(int i = 0; i < 10; ++i)
+      list.InsertBack(i);
+    for(int i = 1; i <= 5; ++i)
+      list.InsertFront(-i);
+
+    REQUIRE(list.GetSize() == 15);
+    REQUIRE(list.GetFront() == -5);
+    REQUIRE(list.GetBack() == 9);
+    REQUIRE(list.GetNodeCount() == 5);
+    REQUIRE(list.ToString() == String{"UnrolledList(-5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9)\n"});
+  }
+
+  SECTION("adding elements after another one in the list") {
+    UnrolledList<int, 4> list{};
+    auto position = list.InsertAfter(list.GetHead(), 1);
+    for(int i = 2; i <= 4; ++i)
+      position = list.InsertAfter(position, i);
+
+    // inserting into the middle of a full node splits it
+    const auto it = list.InsertAfter(list.FindElement(2), 20);
+    REQUIRE(*it == 20);
+    list.InsertAfter(list.GetHead(), 0);
+
+    REQUIRE(list.GetSize() == 6);
+    REQUIRE(list.GetNodeCount() == 2);
+    REQUIRE(list.ToString() == String{"UnrolledList(0, 1, 2, 20, 3, 4)\n"});
+  }
+
+  SECTION("removing elements from the list") {
+    UnrolledList<int, 4> list{};
+    for(int i = 0; i < 8; ++i)
+      list.InsertBack(i);
+
+    REQUIRE(list.RemoveElement(3));
+    REQUIRE_FALSE(list.RemoveElement(42));
+    list.RemoveAfter(list.FindElement(2));
+    list.RemoveAfter(list.GetHead());
+    REQUIRE(list.RemoveFront() == 1);
+
+    // the sparse first node got merged with its successor
+    REQUIRE(list.GetSize() == 4);
+    REQUIRE(list.GetNodeCount() == 1);
+    REQUIRE(list.ToString() == String{"UnrolledList(2, 5, 6, 7)\n"});
+
+    list.Clear();
+    REQUIRE(list.IsEmpty());
+    REQUIRE(list.GetNodeCount() == 0);
+  }
+
+  SECTION("comparing lists") {
+    UnrolledList<int, 4> list{}, list2{};
+    for(int i = 0; i < 6; ++i) {
+      list.InsertBack(i);
+      list2.InsertFront(5 - i);
+    }
+
+    REQUIRE(list == list2);
+    list2.RemoveFront();
+    REQUIRE(list != list2);
+  }
+
+  SECTION("copying, moving and assigning lists") {
+    UnrolledList<String> list{};
+    list.InsertBack(String{"back"});
+    list.EmplaceFront("front");
+
+    UnrolledList<String> copy(list);
+    UnrolledList<String> moved(std::move(list));
+    REQUIRE(copy == moved);
+    REQUIRE(list.IsEmpty());
+
+    list = copy;
+    copy.Clear();
+    copy = std::move(moved);
+    REQUIRE(list == copy);
+    REQUIRE(copy.ToString() == String{"UnrolledList(front, back)\n"});
+  }
+
+  SECTION("usage of unrolled list iterator") {
+    UnrolledList<int, 4> list{};
+    for(int i = 0; i < 10; ++i)
+      list.InsertBack(i);
+
+    int sum = 0;
+    for(const int& element : list)
+      sum += element;
+    REQUIRE(sum == 45);
+
+    for(int& element : list)
+      element *= 2;
+    REQUIRE(list.GetBack() == 18);
+  }
+
+  SECTION("walking forward from the head") {
+    UnrolledList<int, 4> list{};
+    auto head = list.GetHead();
+    REQUIRE(++list.GetHead() == list.end());
+
+    // the head stays in front of the first element while elements are inserted at the front
+    for(int i = 9; i >= 0; --i)
+      list.InsertAfter(head, i);
+
+    int expected = 0;
+    for(auto position = ++head; position != list.end(); ++position)
+      REQUIRE(*position == expected++);
+    REQUIRE(expected == 10);
+    REQUIRE(*(++list.GetHead()) == list.GetFront());
+  }
+
+  SECTION("random insertions and removals match std::list") {
+    std::mt19937 random{42};
+    UnrolledList<int, 8> list{};
+    std::list<int> expected{};
+
+    for(int step = 0; step < 5000; ++step) {
+      const Size index = expected.empty() ? 0 : random() % (expected.size() + 1);
+      if(expected.empty() || random() % 3 != 0) {
+        if(index == 0) {
+          list.InsertAfter(list.GetHead(), step);
+          expected.push_front(step);
+        } else {
+          auto position = list.begin();
+          auto reference = expected.begin();
+          std::advance(position, index - 1);
+          std::advance(reference, index);
+          list.InsertAfter(position, step);
+          expected.insert(reference, step);
+        }
+      } else {
+        const Size removed = random() % expected.size();
+        auto reference = expected.begin();
+        std::advance(reference, removed);
+        if(removed == 0) {
+          list.RemoveAfter(list.GetHead());
+        } else {
+          auto position = list.begin();
+          std::advance(position, removed - 1);
+          list.RemoveAfter(position);
+        }
+        expected.erase(reference);
+      }
+
+      REQUIRE(list.GetSize() == expected.size());
+    }
+
+    REQUIRE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    if(!expected.empty()) {
+      REQUIRE(list.GetFront() == expected.front());
+      REQUIRE(list.GetBack() == expected.back());
+    }
+  }
+}
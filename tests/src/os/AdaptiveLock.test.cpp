@@ -0,0 +1,74 @@
+/**
+* @file AdaptiveLock.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "os/AdaptiveLock.hpp"
+#include "os/ScopeGuard.hpp"
+
+TEST_CASE("AdaptiveLock functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("acquiring and releasing the lock") {
+    AdaptiveLock lock{};
+    REQUIRE(lock.TryAcquire());
+    REQUIRE_FALSE(lock.TryAcquire());
+    lock.Release();
+
+    {
+      ScopeGuard guard{&lock};
+      REQUIRE_FALSE(lock.TryAcquire());
+    }
+    REQUIRE(lock.TryAcquire());
+    lock.Release();
+  }
+
+  SECTION("excluding multiple threads") {
+    constexpr int THREADS = 4;
+    constexpr int ITERATIONS = 20000;
+
+    AdaptiveLock lock{};
+    int counter = 0;
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < THREADS; ++t) {
+      threads.emplace_back([&] {
+        for(int i = 0; i < ITERATIONS; ++i) {
+          ScopeGuard guard{&lock};
+          ++counter;
+        }
+      });
+    }
+    for(auto& thread : threads)
+      thread.join();
+
+    REQUIRE(counter == THREADS * ITERATIONS);
+  }
+
+  SECTION("sleeping without spinning") {
+    AdaptiveLock lock{0};
+    int counter = 0;
+
+    lock.Acquire();
+    std::thread waiter{[&] {
+      ScopeGuard guard{&lock};
+      ++counter;
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    REQUIRE(counter == 0);
+    lock.Release();
+    waiter.join();
+
+    REQUIRE(counter == 1);
+    REQUIRE(lock.TryAcquire());
+    lock.Release();
+  }
+}
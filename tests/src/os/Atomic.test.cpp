@@ -0,0 +1,48 @@
+/**
+* @file Atomic.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include "core/Platform.hpp"
+#include "data/Integer.hpp"
+#include "os/Atomic.hpp"
+
+TEST_CASE("Atomic functionality validation", "[os]") {
+  using namespace ntl;
+  using Order = Atomic<U32>::MemoryOrder;
+
+  SECTION("using compile-time memory orders") {
+    Atomic<U32> value{5};
+    REQUIRE(value.Load<Order::Acquire>() == 5);
+
+    value.Store<Order::Release>(7);
+    REQUIRE(value.FetchAdd<Order::Relaxed>(3) == 7);
+    REQUIRE(value.FetchSub<Order::AcquireRelease>(2) == 10);
+    REQUIRE(value.FetchOr<Order::Relaxed>(0x10) == 8);
+    REQUIRE(value.FetchAnd<Order::Relaxed>(0x10) == 0x18);
+    REQUIRE(value.Exchange<Order::SequentiallyConsistent>(1) == 0x10);
+
+    U32 expected = 2;
+    REQUIRE_FALSE((value.CompareExchangeStrong<Order::Acquire, Order::Relaxed>(expected, 3)));
+    REQUIRE(expected == 1);
+    REQUIRE((value.CompareExchangeStrong<Order::Acquire, Order::Relaxed>(expected, 3)));
+    REQUIRE(value.Load() == 3);
+  }
+
+  SECTION("padding atomics") {
+    STATIC_REQUIRE(alignof(PaddedAtomic<U32>) == NTL_CACHE_LINE_SIZE);
+    STATIC_REQUIRE(sizeof(PaddedAtomic<U32>) == NTL_CACHE_LINE_SIZE);
+
+    PaddedAtomic<U32> padded[2]{};
+    padded[1] = 4;
+    padded[1].FetchAdd(1);
+    REQUIRE(padded[0].Load() == 0);
+    REQUIRE(padded[1].Load() == 5);
+    REQUIRE(reinterpret_cast<const char*>(&padded[1]) - reinterpret_cast<const char*>(&padded[0]) ==
+            NTL_CACHE_LINE_SIZE);
+  }
+}
@@ -0,0 +1,57 @@
+/**
+* @file Barrier.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "os/Atomic.hpp"
+#include "os/Barrier.hpp"
+
+TEST_CASE("Barrier functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("passing a barrier of a single thread") {
+    Barrier barrier{1};
+    REQUIRE(barrier.GetCount() == 1);
+    REQUIRE(barrier.ArriveAndWait());
+    REQUIRE(barrier.ArriveAndWait());
+  }
+
+  SECTION("synchronizing phases") {
+    constexpr int THREADS = 4;
+    constexpr int PHASES = 200;
+
+    Barrier barrier{THREADS};
+    Atomic<int> arrived{0};
+    Atomic<int> last{0};
+    Atomic<int> errors{0};
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < THREADS; ++t) {
+      threads.emplace_back([&] {
+        for(int phase = 0; phase < PHASES; ++phase) {
+          arrived.FetchAdd(1);
+          if(barrier.ArriveAndWait())
+            last.FetchAdd(1);
+
+          // every thread of this phase arrived before anyone passed
+          if(arrived.Load() < (phase + 1) * THREADS)
+            errors.FetchAdd(1);
+          barrier.ArriveAndWait();
+        }
+      });
+    }
+    for(auto& thread : threads)
+      thread.join();
+
+    REQUIRE(errors.Load() == 0);
+    REQUIRE(last.Load() == PHASES);
+  }
+}
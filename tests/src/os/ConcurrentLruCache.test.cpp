@@ -0,0 +1,88 @@
+/**
+* @file ConcurrentLruCache.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "data/String.hpp"
+#include "os/ConcurrentLruCache.hpp"
+
+TEST_CASE("ConcurrentLruCache functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("constructing new cache") {
+    ConcurrentLruCache<int, int> cache{256, LruCache<int, int>::NO_WEIGHT_LIMIT, 10};
+    REQUIRE(cache.GetShardCount() == 16);
+    REQUIRE(cache.GetSize() == 0);
+  }
+
+  SECTION("putting, getting and erasing entries") {
+    ConcurrentLruCache<String, int> cache{64, LruCache<String, int>::NO_WEIGHT_LIMIT, 4};
+    REQUIRE(cache.Put("one", 1));
+    REQUIRE(cache.Put("two", 2));
+
+    int value = 0;
+    REQUIRE(cache.Get("one", value));
+    REQUIRE(value == 1);
+    REQUIRE_FALSE(cache.Get("three", value));
+    REQUIRE(cache.Contains("two"));
+
+    REQUIRE(cache.Erase("one"));
+    REQUIRE_FALSE(cache.Erase("one"));
+    REQUIRE(cache.GetSize() == 1);
+
+    const CacheStatistics statistics = cache.GetStatistics();
+    REQUIRE(statistics.hits == 1);
+    REQUIRE(statistics.misses == 1);
+
+    cache.Clear();
+    REQUIRE(cache.GetSize() == 0);
+  }
+
+  SECTION("evicting within the capacity of the shards") {
+    ConcurrentLruCache<int, int> cache{64, LruCache<int, int>::NO_WEIGHT_LIMIT, 4};
+    for(int i = 0; i < 1000; ++i)
+      cache.Put(i, i);
+
+    REQUIRE(cache.GetSize() <= 64);
+    REQUIRE(cache.GetStatistics().evictions == 1000 - cache.GetSize());
+  }
+
+  SECTION("accessing the cache from multiple threads") {
+    constexpr int THREADS = 4;
+    constexpr int KEYS = 5000;
+
+    ConcurrentLruCache<int, int> cache{1024};
+    std::vector<std::thread> threads;
+    std::vector<int> mismatches(THREADS, 0);
+    for(int t = 0; t < THREADS; ++t) {
+      threads.emplace_back([&, t] {
+        for(int i = 0; i < KEYS; ++i) {
+          const int key = (i * 7 + t) % 2048;
+          int value = 0;
+          if(cache.Get(key, value) && value != key * 3)
+            mismatches[t]++;
+          else
+            cache.Put(key, key * 3);
+          if(i % 16 == 0)
+            cache.Erase(key + 1);
+        }
+      });
+    }
+    for(auto& thread : threads)
+      thread.join();
+
+    for(const int mismatch : mismatches)
+      REQUIRE(mismatch == 0);
+    REQUIRE(cache.GetSize() <= 1024);
+
+    const CacheStatistics statistics = cache.GetStatistics();
+    REQUIRE(statistics.hits + statistics.misses == THREADS * KEYS);
+  }
+}
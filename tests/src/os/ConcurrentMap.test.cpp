@@ -0,0 +1,129 @@
+/**
+* @file ConcurrentMap.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "data/String.hpp"
+#include "os/Atomic.hpp"
+#include "os/ConcurrentMap.hpp"
+
+TEST_CASE("ConcurrentMap functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("constructing new map") {
+    ConcurrentMap<int, int> map{256, 10};
+    REQUIRE(map.GetShardCount() == 16);
+    REQUIRE(map.GetSize() == 0);
+
+    ConcurrentMap<int, int> single{16, 0};
+    REQUIRE(single.GetShardCount() == 1);
+  }
+
+  SECTION("inserting, assigning and erasing entries") {
+    ConcurrentMap<String, int> map{};
+    REQUIRE(map.InsertOrAssign("one", 1));
+    REQUIRE(map.InsertOrAssign("two", 2));
+    REQUIRE_FALSE(map.InsertOrAssign("one", 11));
+    REQUIRE(map.GetSize() == 2);
+
+    int value = 0;
+    REQUIRE(map.Find("one", value));
+    REQUIRE(value == 11);
+    REQUIRE_FALSE(map.Find("three", value));
+
+    REQUIRE(map.Erase("one"));
+    REQUIRE_FALSE(map.Erase("one"));
+    REQUIRE_FALSE(map.Exists("one"));
+    REQUIRE(map.Exists("two"));
+
+    map.Clear();
+    REQUIRE(map.GetSize() == 0);
+  }
+
+  SECTION("computing missing values") {
+    ConcurrentMap<int, String> map{};
+    int calls = 0;
+    auto compute = [&] { ++calls; return String{"computed"}; };
+
+    REQUIRE(map.ComputeIfAbsent(5, compute) == "computed");
+    REQUIRE(map.ComputeIfAbsent(5, compute) == "computed");
+    REQUIRE(calls == 1);
+
+    map.InsertOrAssign(6, "existing");
+    REQUIRE(map.ComputeIfAbsent(6, compute) == "existing");
+    REQUIRE(calls == 1);
+  }
+
+  SECTION("growing shards beyond their capacity") {
+    ConcurrentMap<int, int> map{16, 4};
+    for(int i = 0; i < 10000; ++i)
+      map.InsertOrAssign(i, i * 2);
+    REQUIRE(map.GetSize() == 10000);
+
+    int value = 0;
+    for(int i = 0; i < 10000; ++i) {
+      REQUIRE(map.Find(i, value));
+      REQUIRE(value == i * 2);
+    }
+  }
+
+  SECTION("taking a snapshot") {
+    ConcurrentMap<int, int> map{};
+    for(int i = 0; i < 100; ++i)
+      map.InsertOrAssign(i, i);
+
+    auto snapshot = map.GetSnapshot();
+    REQUIRE(snapshot.GetSize() == 100);
+
+    map.Clear();
+    int sum = 0;
+    for(const auto& entry : snapshot) {
+      REQUIRE(entry.first == entry.second);
+      sum += entry.second;
+    }
+    REQUIRE(sum == 4950);
+
+    REQUIRE(map.GetSnapshot().GetSize() == 0);
+  }
+
+  SECTION("accessing the map from multiple threads") {
+    constexpr int THREADS = 4;
+    constexpr int KEYS = 2000;
+
+    ConcurrentMap<int, int> map{64};
+    Atomic<Size> computed{0};
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < THREADS; ++t) {
+      threads.emplace_back([&, t] {
+        for(int i = 0; i < KEYS; ++i) {
+          map.ComputeIfAbsent(i, [&] { computed.FetchAdd(1); return i; });
+          map.InsertOrAssign(KEYS * (t + 1) + i, t);
+          int value = 0;
+          if(map.Find(i, value) && value != i)
+            computed.FetchAdd(KEYS * THREADS);
+        }
+        for(int i = 0; i < KEYS; i += 2)
+          map.Erase(KEYS * (t + 1) + i);
+      });
+    }
+    threads.emplace_back([&] {
+      for(int i = 0; i < 20; ++i) {
+        auto snapshot = map.GetSnapshot();
+        (void) snapshot;
+      }
+    });
+    for(auto& thread : threads)
+      thread.join();
+
+    REQUIRE(computed.Load() == KEYS);
+    REQUIRE(map.GetSize() == KEYS + THREADS * KEYS / 2);
+  }
+}
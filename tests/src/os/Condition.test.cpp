@@ -0,0 +1,55 @@
+/**
+* @file Condition.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "os/Condition.hpp"
+#include "os/Lock.hpp"
+
+TEST_CASE("Condition functionality validation", "[os]") {
+  using namespace ntl;
+  using namespace std::chrono_literals;
+
+  SECTION("waiting with a timeout") {
+    Lock lock{};
+    Condition condition{&lock};
+
+    lock.Acquire();
+    const auto start = std::chrono::steady_clock::now();
+    REQUIRE_FALSE(condition.WaitFor(20ms));
+    REQUIRE(std::chrono::steady_clock::now() - start >= 20ms);
+    REQUIRE_FALSE(condition.WaitUntil(std::chrono::steady_clock::now() - 1ms));
+    lock.Release();
+  }
+
+  SECTION("signaling a timed waiter") {
+    Lock lock{};
+    Condition condition{&lock};
+    bool ready = false;
+    bool signaled = true;
+
+    std::thread waiter{[&] {
+      lock.Acquire();
+      while(!ready && signaled)
+        signaled = condition.WaitFor(10s);
+      lock.Release();
+    }};
+    std::this_thread::sleep_for(10ms);
+    lock.Acquire();
+    ready = true;
+    condition.Signal();
+    lock.Release();
+    waiter.join();
+
+    REQUIRE(ready);
+    REQUIRE(signaled);
+  }
+}
@@ -0,0 +1,49 @@
+/**
+* @file Counter.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "os/Counter.hpp"
+
+TEST_CASE("Counter functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("adding and resetting") {
+    Counter counter{5};
+    REQUIRE(counter.GetShardCount() == 8);
+    REQUIRE(counter.Sum() == 0);
+
+    counter.Add();
+    counter.Add(10);
+    counter.Add(-3);
+    REQUIRE(counter.Sum() == 8);
+
+    counter.Reset();
+    REQUIRE(counter.Sum() == 0);
+  }
+
+  SECTION("adding from multiple threads") {
+    constexpr int THREADS = 6;
+    constexpr int ITERATIONS = 100000;
+
+    Counter counter{4};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < THREADS; ++t) {
+      threads.emplace_back([&] {
+        for(int i = 0; i < ITERATIONS; ++i)
+          counter.Add();
+      });
+    }
+    for(auto& thread : threads)
+      thread.join();
+
+    REQUIRE(counter.Sum() == static_cast<I64>(THREADS) * ITERATIONS);
+  }
+}
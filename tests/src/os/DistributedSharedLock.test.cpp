@@ -0,0 +1,78 @@
+/**
+* @file DistributedSharedLock.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "os/Atomic.hpp"
+#include "os/DistributedSharedLock.hpp"
+#include "os/ScopeGuard.hpp"
+
+TEST_CASE("DistributedSharedLock functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("constructing new lock") {
+    DistributedSharedLock lock{3};
+    REQUIRE(lock.GetSlotCount() == 4);
+
+    const Size slot = lock.StartRead();
+    REQUIRE(slot < 4);
+    lock.EndRead(slot);
+
+    DistributedSharedLock automatic{};
+    REQUIRE(automatic.GetSlotCount() >= 1);
+  }
+
+  SECTION("sharing and excluding accesses") {
+    DistributedSharedLock lock{};
+    {
+      ScopeRead first{&lock};
+      ScopeRead second{&lock};
+      std::thread other{[&] { ScopeRead third{&lock}; }};
+      other.join();
+    }
+    {
+      ScopeWrite write{&lock};
+    }
+  }
+
+  SECTION("reading consistent data while writing") {
+    constexpr int READERS = 3;
+    constexpr int ITERATIONS = 5000;
+
+    DistributedSharedLock lock{};
+    int first = 0;
+    int second = 0;
+    Atomic<int> torn{0};
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([&] {
+      for(int i = 0; i < ITERATIONS; ++i) {
+        ScopeWrite write{&lock};
+        ++first;
+        ++second;
+      }
+    });
+    for(int t = 0; t < READERS; ++t) {
+      threads.emplace_back([&] {
+        for(int i = 0; i < ITERATIONS; ++i) {
+          ScopeRead read{&lock};
+          if(first != second)
+            torn.FetchAdd(1);
+        }
+      });
+    }
+    for(auto& thread : threads)
+      thread.join();
+
+    REQUIRE(first == ITERATIONS);
+    REQUIRE(second == ITERATIONS);
+    REQUIRE(torn.Load() == 0);
+  }
+}
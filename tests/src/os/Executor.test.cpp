@@ -0,0 +1,215 @@
+/**
+* @file Executor.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include "data/Array.hpp"
+#include "data/String.hpp"
+#include "os/Atomic.hpp"
+#include "os/Executor.hpp"
+
+namespace {
+  using namespace ntl;
+
+  Future<int> add(Executor& a_executor, Future<int> a_left, Future<int> a_right) {
+    co_await a_executor.Schedule();
+    const int left = co_await a_left;
+    const int right = co_await a_right;
+    co_return left + right;
+  }
+
+  Future<void> increment(Executor& a_executor, Atomic<int>& a_counter) {
+    co_await a_executor.Schedule();
+    a_counter.FetchAdd(1);
+  }
+
+  // raises the peak to the given value, if it is higher
+  void raise(Atomic<Size>& a_peak, const Size a_value) {
+    Size peak = a_peak.Load();
+    while(peak < a_value && !a_peak.CompareExchangeWeak(peak, a_value, Atomic<Size>::MemoryOrder::SequentiallyConsistent,
+                                                        Atomic<Size>::MemoryOrder::SequentiallyConsistent)) {
+      // Empty
+    }
+  }
+}
+
+TEST_CASE("Executor functionality validation", "[os]") {
+  using namespace ntl;
+
+  ThreadPool pool{3};
+  Executor executor{pool};
+  REQUIRE(&executor.GetPool() == &pool);
+  REQUIRE(executor.GetMaxInFlight() == 0);
+
+  SECTION("spawning tasks") {
+    Future<int> number = executor.Spawn([] { return 42; });
+    Future<String> text = executor.Spawn([] { return String{"a string that is long enough for the heap"}; });
+    Atomic<int> counter{0};
+    Future<void> nothing = executor.Spawn([&counter] { counter.FetchAdd(1); });
+
+    REQUIRE(number.IsValid());
+    REQUIRE(number.Get() == 42);
+    REQUIRE_FALSE(number.IsValid());
+    REQUIRE(text.Get() == String{"a string that is long enough for the heap"});
+    nothing.Wait();
+    REQUIRE(nothing.IsReady());
+    REQUIRE(counter.Load() == 1);
+
+    Future<int> invalid{};
+    REQUIRE_FALSE(invalid.IsValid());
+    REQUIRE_FALSE(invalid.IsReady());
+  }
+
+  SECTION("chaining continuations") {
+    Future<String> result = executor.Spawn([] { return 20; })
+      .Then([](const int a_value) { return a_value + 1; })
+      .Then([](const int a_value) { return String{"value: "} + (a_value * 2); });
+    REQUIRE(result.Get() == String{"value: 42"});
+
+    Atomic<int> counter{0};
+    Future<int> afterVoid = executor.Spawn([&counter] { counter.FetchAdd(1); }).Then([&counter] {
+      return counter.Load() + 1;
+    });
+    REQUIRE(afterVoid.Get() == 2);
+
+    // continuations attached to finished futures run as well
+    Future<int> finished = executor.Spawn([] { return 1; });
+    finished.Wait();
+    REQUIRE(finished.Then([](const int a_value) { return a_value + 1; }).Get() == 2);
+  }
+
+  SECTION("waiting within tasks") {
+    Future<int> outer = executor.Spawn([&executor] {
+      Array<Future<int>> inner(16);
+      for(int i = 0; i < 16; ++i)
+        inner.Insert(executor.Spawn([i] { return i; }));
+
+      int sum = 0;
+      for(Future<int>& future : inner)
+        sum += future.Get();
+      return sum;
+    });
+    REQUIRE(outer.Get() == 120);
+  }
+
+  SECTION("setting promises") {
+    Promise<int> promise{pool};
+    Future<int> future = promise.GetFuture();
+    Future<int> doubled = std::move(future).Then([](const int a_value) { return a_value * 2; });
+    REQUIRE_FALSE(doubled.IsReady());
+
+    std::thread producer([&promise] { promise.Set(21); });
+    REQUIRE(doubled.Get() == 42);
+    producer.join();
+
+    Promise<void> signal{pool};
+    Future<void> done = signal.GetFuture();
+    signal.Set();
+    REQUIRE(done.IsReady());
+  }
+
+  SECTION("waiting for all") {
+    auto [number, text, unit] = WhenAll(executor.Spawn([] { return 1; }), executor.Spawn([] { return String{"two"}; }),
+                                        executor.Spawn([] {})).Get();
+    REQUIRE(number == 1);
+    REQUIRE(text == String{"two"});
+    REQUIRE(unit == Unit{});
+
+    Array<Future<Size>> futures(100);
+    for(Size i = 0; i < 100; ++i)
+      futures.Insert(executor.Spawn([i] { return i * i; }));
+    const Array<Size> squares = WhenAll(futures).Get();
+    REQUIRE(squares.GetSize() == 100);
+    for(Size i = 0; i < 100; ++i)
+      REQUIRE(squares[i] == i * i);
+
+    Array<Future<int>> none(1);
+    REQUIRE(WhenAll(none).Get().GetSize() == 0);
+    REQUIRE(std::tuple_size_v<decltype(WhenAll().Get())> == 0);
+  }
+
+  SECTION("waiting for any") {
+    Promise<int> never{pool};
+    Future<int> slow = never.GetFuture();
+    Future<int> fast = executor.Spawn([] { return 7; });
+
+    const Pair<Size, int> first = WhenAny(std::move(slow), std::move(fast)).Get();
+    REQUIRE(first.first == 1);
+    REQUIRE(first.second == 7);
+    never.Set(0);
+
+    Array<Future<int>> futures(8);
+    for(int i = 0; i < 8; ++i)
+      futures.Insert(executor.Spawn([i] { return i; }));
+    const Pair<Size, int> any = WhenAny(futures).Get();
+    REQUIRE(static_cast<int>(any.first) == any.second);
+  }
+
+  SECTION("awaiting in coroutines") {
+    Future<int> sum = add(executor, executor.Spawn([] { return 40; }), executor.Spawn([] { return 2; }));
+    REQUIRE(sum.Get() == 42);
+
+    Atomic<int> counter{0};
+    Array<Future<void>> increments(32);
+    for(int i = 0; i < 32; ++i)
+      increments.Insert(increment(executor, counter));
+    WhenAll(increments).Wait();
+    REQUIRE(counter.Load() == 32);
+  }
+
+  SECTION("limiting the tasks in flight") {
+    Executor bounded{pool, 2};
+    REQUIRE(bounded.GetMaxInFlight() == 2);
+
+    Atomic<Size> active{0};
+    Atomic<Size> peak{0};
+    Array<Future<void>> futures(40);
+    for(int i = 0; i < 40; ++i) {
+      futures.Insert(bounded.Spawn([&active, &peak] {
+        raise(peak, active.FetchAdd(1) + 1);
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        active.FetchSub(1);
+      }));
+    }
+    WhenAll(futures).Wait();
+    REQUIRE(peak.Load() >= 1);
+    REQUIRE(peak.Load() <= 2);
+  }
+
+  SECTION("pipelining stages") {
+    constexpr Size CHUNKS = 16;
+    constexpr Size CHUNK_SIZE = 1000;
+
+    // parse -> sort -> build index, where every chunk moves on as soon as its previous stage finished
+    Executor bounded{pool, 4};
+    Array<Future<Array<Size>>> chunks(CHUNKS);
+    for(Size chunk = 0; chunk < CHUNKS; ++chunk) {
+      chunks.Insert(bounded.Spawn([chunk] {
+        Array<Size> numbers(CHUNK_SIZE);
+        for(Size i = 0; i < CHUNK_SIZE; ++i)
+          numbers.Insert((i * 7919 + chunk) % CHUNK_SIZE * CHUNKS + chunk);
+        return numbers;
+      }).Then([](Array<Size>&& a_numbers) {
+        a_numbers.Sort();
+        return std::move(a_numbers);
+      }));
+    }
+
+    Future<Size> index = WhenAll(chunks).Then([](Array<Array<Size>>&& a_sorted) {
+      Size ordered = 0;
+      for(const Array<Size>& numbers : a_sorted) {
+        for(Size i = 1; i < numbers.GetSize(); ++i)
+          ordered += numbers[i - 1] < numbers[i] ? 1 : 0;
+      }
+      return ordered;
+    });
+    REQUIRE(index.Get() == CHUNKS * (CHUNK_SIZE - 1));
+  }
+}
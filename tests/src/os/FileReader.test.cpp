@@ -0,0 +1,139 @@
+/**
+* @file FileReader.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "os/FileReader.hpp"
+
+TEST_CASE("FileReader functionality validation", "[os]") {
+  using namespace ntl;
+
+  const std::string path = (std::filesystem::temp_directory_path() / "ntl_file_reader.txt").string();
+  std::string content;
+  for(int i = 0; i < 2000; ++i)
+    content += "line " + std::to_string(i) + (i % 3 == 0 ? "\r\n" : "\n");
+  content += "last";
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << content;
+  }
+
+  SECTION("reading the whole file into a string") {
+    FileReader reader(path.c_str(), 100);
+    REQUIRE(reader.IsOpen());
+
+    String string{"prefix:"};
+    REQUIRE(reader.ReadAll(string) == content.size());
+    REQUIRE(string.GetLength() == content.size() + 7);
+    REQUIRE(std::string(string.GetCString() + 7) == content);
+    REQUIRE(reader.IsEnd());
+  }
+
+  SECTION("reading the whole file into a byte array") {
+    FileReader reader(path.c_str(), 64);
+    Array<Byte> bytes(1, false, true);
+    REQUIRE(reader.ReadAll(bytes) == content.size());
+    REQUIRE(bytes.GetSize() == content.size());
+    REQUIRE(std::string(reinterpret_cast<const char*>(bytes.GetData()), bytes.GetSize()) == content);
+  }
+
+  SECTION("reading small and big blocks") {
+    FileReader reader(path.c_str(), 128);
+    char small[10];
+    REQUIRE(reader.Read(small, 10) == 10);
+    REQUIRE(std::string(small, 10) == content.substr(0, 10));
+
+    std::string big(1000, '\0');
+    REQUIRE(reader.Read(big.data(), big.size()) == 1000);
+    REQUIRE(big == content.substr(10, 1000));
+
+    String rest;
+    REQUIRE(reader.Read(rest, 1 << 20) == content.size() - 1010);
+    REQUIRE(reader.Read(small, 10) == 0);
+  }
+
+  SECTION("reading into chunks") {
+    FileReader reader(path.c_str(), 16);
+    char first[5], second[3000], third[100000];
+    REQUIRE(reader.Read(first, 2) == 2);
+
+    const ReadChunk chunks[] = {{first, 5}, {second, 0}, {second, sizeof(second)}, {third, sizeof(third)}};
+    const Size read = reader.Read(chunks, 4);
+    REQUIRE(read == content.size() - 2);
+    REQUIRE(std::string(first, 5) == content.substr(2, 5));
+    REQUIRE(std::string(second, sizeof(second)) == content.substr(7, sizeof(second)));
+    REQUIRE(std::string(third, read - 5 - sizeof(second)) == content.substr(7 + sizeof(second)));
+  }
+
+  SECTION("iterating over lines") {
+    FileReader reader(path.c_str(), 8);
+    Size count = 0;
+    for(const StringView line : reader.GetLines()) {
+      if(count < 2000)
+        REQUIRE(std::string(line.GetData(), line.GetLength()) == "line " + std::to_string(count));
+      else
+        REQUIRE(line == StringView{"last"});
+      ++count;
+    }
+    REQUIRE(count == 2001);
+    REQUIRE(reader.IsEnd());
+
+    StringView line;
+    REQUIRE(!reader.ReadLine(line));
+  }
+
+  SECTION("iterating over records") {
+    {
+      std::ofstream file(path, std::ios::binary);
+      file << "a,bb,,ccc,";
+    }
+    FileReader reader(path.c_str());
+    std::string joined;
+    Size count = 0;
+    for(const StringView record : reader.GetRecords(',')) {
+      joined += std::string(record.GetData(), record.GetLength()) + "|";
+      ++count;
+    }
+    REQUIRE(count == 4);
+    REQUIRE(joined == "a|bb||ccc|");
+  }
+
+  SECTION("opening, moving and closing readers") {
+    FileReader reader;
+    REQUIRE(!reader.IsOpen());
+    REQUIRE(!reader.Open("/nonexistent/ntl_file_reader.txt"));
+    REQUIRE(reader.IsEnd());
+
+    REQUIRE(reader.Open(path.c_str()));
+    StringView line;
+    REQUIRE(reader.ReadLine(line));
+    REQUIRE(line == StringView{"line 0"});
+
+    FileReader moved{std::move(reader)};
+    REQUIRE(!reader.IsOpen());
+    REQUIRE(moved.ReadLine(line));
+    REQUIRE(line == StringView{"line 1"});
+
+    reader = std::move(moved);
+    REQUIRE(reader.ReadLine(line));
+    REQUIRE(line == StringView{"line 2"});
+
+    reader.Close();
+    REQUIRE(!reader.IsOpen());
+    REQUIRE(!moved.Open("/nonexistent/ntl_file_reader.txt"));
+    REQUIRE(moved.Open(path.c_str()));
+    REQUIRE(moved.ReadLine(line));
+    REQUIRE(line == StringView{"line 0"});
+  }
+
+  std::remove(path.c_str());
+}
@@ -0,0 +1,109 @@
+/**
+* @file FileWriter.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "data/String.hpp"
+#include "os/FileWriter.hpp"
+
+namespace {
+  std::string readFile(const std::string& a_path) {
+    std::ifstream file(a_path, std::ios::binary);
+    std::stringstream stream;
+    stream << file.rdbuf();
+    return stream.str();
+  }
+}
+
+TEST_CASE("FileWriter functionality validation", "[os]") {
+  using namespace ntl;
+
+  const std::string path = (std::filesystem::temp_directory_path() / "ntl_file_writer.txt").string();
+
+  SECTION("writing small pieces through the buffer") {
+    FileWriter writer(path.c_str(), false, 16);
+    REQUIRE(writer.IsOpen());
+    REQUIRE(writer.Write("abc"));
+    REQUIRE(writer.Write('d'));
+    REQUIRE(writer.GetBufferedSize() == 4);
+    REQUIRE(writer.WriteLine(String{"efg"}));
+    REQUIRE(writer.Flush());
+    REQUIRE(writer.GetBufferedSize() == 0);
+    REQUIRE(readFile(path) == "abcdefg\n");
+
+    for(int i = 0; i < 100; ++i)
+      REQUIRE(writer.Write('x'));
+    REQUIRE(writer.Close());
+    REQUIRE(readFile(path) == "abcdefg\n" + std::string(100, 'x'));
+  }
+
+  SECTION("writing big blocks and chunks") {
+    const std::string big(100000, 'y');
+    Array<Byte> bytes(3);
+    bytes.Insert('1');
+    bytes.Insert('2');
+    bytes.Insert('3');
+    {
+      FileWriter writer(path.c_str(), false, 64);
+      REQUIRE(writer.Write("head"));
+      REQUIRE(writer.Write(big.data(), big.size()));
+      REQUIRE(writer.GetBufferedSize() == 0);
+      REQUIRE(writer.Write(bytes));
+
+      WriteChunk chunks[40];
+      for(auto& chunk : chunks)
+        chunk = {"ab", 2};
+      chunks[7] = {big.data(), 1000};
+      REQUIRE(writer.Write(chunks, 40));
+    }
+
+    std::string expected = "head" + big + "123";
+    for(int i = 0; i < 40; ++i)
+      expected += i == 7 ? big.substr(0, 1000) : "ab";
+    REQUIRE(readFile(path) == expected);
+  }
+
+  SECTION("appending to a file") {
+    {
+      FileWriter writer(path.c_str());
+      writer.WriteLine("first");
+    }
+    {
+      FileWriter writer(path.c_str(), true);
+      writer.WriteLine("second");
+    }
+    REQUIRE(readFile(path) == "first\nsecond\n");
+
+    FileWriter writer(path.c_str());
+    REQUIRE(writer.Close());
+    REQUIRE(readFile(path).empty());
+  }
+
+  SECTION("opening, moving and failing writers") {
+    FileWriter writer;
+    REQUIRE(!writer.IsOpen());
+    REQUIRE(!writer.Open("/nonexistent/ntl_file_writer.txt"));
+
+    REQUIRE(writer.Open(path.c_str()));
+    writer.Write("moved ");
+    FileWriter moved{std::move(writer)};
+    REQUIRE(!writer.IsOpen());
+    REQUIRE(moved.Write("twice"));
+
+    writer = std::move(moved);
+    REQUIRE(writer.Close());
+    REQUIRE(readFile(path) == "moved twice");
+  }
+
+  std::remove(path.c_str());
+}
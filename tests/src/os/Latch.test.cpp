@@ -0,0 +1,67 @@
+/**
+* @file Latch.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "os/Latch.hpp"
+
+TEST_CASE("Latch functionality validation", "[os]") {
+  using namespace ntl;
+  using namespace std::chrono_literals;
+
+  SECTION("counting down") {
+    Latch latch{3};
+    REQUIRE_FALSE(latch.TryWait());
+    latch.CountDown(2);
+    REQUIRE_FALSE(latch.WaitFor(10ms));
+    latch.CountDown();
+    REQUIRE(latch.TryWait());
+    latch.Wait();
+    REQUIRE(latch.WaitFor(0ms));
+  }
+
+  SECTION("releasing waiting threads") {
+    constexpr int THREADS = 4;
+
+    auto* latch = new Latch{THREADS};
+    int done[THREADS] = {};
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < THREADS; ++t) {
+      threads.emplace_back([&, t] {
+        done[t] = 1;
+        latch->CountDown();
+      });
+    }
+
+    // the latch may be destroyed as soon as it was released
+    latch->Wait();
+    delete latch;
+    for(auto& thread : threads)
+      thread.join();
+
+    for(const int value : done)
+      REQUIRE(value == 1);
+  }
+
+  SECTION("arriving and waiting") {
+    constexpr int THREADS = 3;
+
+    Latch latch{THREADS};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < THREADS; ++t)
+      threads.emplace_back([&] { latch.ArriveAndWait(); });
+    for(auto& thread : threads)
+      thread.join();
+
+    REQUIRE(latch.TryWait());
+  }
+}
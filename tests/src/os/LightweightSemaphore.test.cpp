@@ -0,0 +1,74 @@
+/**
+* @file LightweightSemaphore.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "os/LightweightSemaphore.hpp"
+
+TEST_CASE("LightweightSemaphore functionality validation", "[os]") {
+  using namespace ntl;
+  using namespace std::chrono_literals;
+
+  SECTION("posting and waiting") {
+    LightweightSemaphore semaphore{2};
+    REQUIRE(semaphore.GetValue() == 2);
+    REQUIRE(semaphore.TryWait());
+    semaphore.Wait();
+    REQUIRE_FALSE(semaphore.TryWait());
+
+    semaphore.Post(3);
+    REQUIRE(semaphore.GetValue() == 3);
+    REQUIRE(semaphore.WaitFor(0ms));
+  }
+
+  SECTION("timing out") {
+    LightweightSemaphore semaphore{};
+    const auto start = std::chrono::steady_clock::now();
+    REQUIRE_FALSE(semaphore.WaitFor(20ms));
+    REQUIRE(std::chrono::steady_clock::now() - start >= 20ms);
+    REQUIRE_FALSE(semaphore.WaitUntil(std::chrono::steady_clock::now() - 1ms));
+  }
+
+  SECTION("handing off between threads") {
+    constexpr int ITEMS = 10000;
+
+    LightweightSemaphore filled{};
+    LightweightSemaphore empty{1};
+    int slot = 0;
+    long long sum = 0;
+
+    std::thread consumer{[&] {
+      for(int i = 0; i < ITEMS; ++i) {
+        filled.Wait();
+        sum += slot;
+        empty.Post();
+      }
+    }};
+    for(int i = 1; i <= ITEMS; ++i) {
+      empty.Wait();
+      slot = i;
+      filled.Post();
+    }
+    consumer.join();
+
+    REQUIRE(sum == static_cast<long long>(ITEMS) * (ITEMS + 1) / 2);
+  }
+
+  SECTION("waking a timed waiter") {
+    LightweightSemaphore semaphore{};
+    bool acquired = false;
+    std::thread waiter{[&] { acquired = semaphore.WaitFor(10s); }};
+    std::this_thread::sleep_for(10ms);
+    semaphore.Post();
+    waiter.join();
+    REQUIRE(acquired);
+  }
+}
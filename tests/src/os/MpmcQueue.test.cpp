@@ -0,0 +1,83 @@
+/**
+* @file MpmcQueue.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "data/String.hpp"
+#include "os/Atomic.hpp"
+#include "os/MpmcQueue.hpp"
+
+TEST_CASE("MpmcQueue functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("constructing new queue") {
+    MpmcQueue<int> queue{1};
+    REQUIRE(queue.GetCapacity() == 2);
+    REQUIRE(queue.IsEmpty());
+  }
+
+  SECTION("putting and getting until full and empty") {
+    MpmcQueue<String> queue{4};
+    for(int i = 0; i < 4; ++i)
+      REQUIRE(queue.TryEmplace("element"));
+    REQUIRE_FALSE(queue.TryPut(String{"too much"}));
+    REQUIRE(queue.GetSize() == 4);
+
+    String element{};
+    for(int i = 0; i < 4; ++i)
+      REQUIRE(queue.TryGet(element));
+    REQUIRE(element == "element");
+    REQUIRE_FALSE(queue.TryGet(element));
+
+    queue.Put(String{"last"});
+    REQUIRE(queue.Get() == "last");
+    REQUIRE(queue.IsEmpty());
+  }
+
+  SECTION("passing elements between many threads") {
+    constexpr U64 PER_PRODUCER = 50000;
+    constexpr Size THREADS = 4;
+
+    for(const bool blocking : {true, false}) {
+      MpmcQueue<U64> queue{128};
+      Atomic<U64> sum{0};
+
+      std::vector<std::thread> threads{};
+      for(Size t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&queue, blocking] {
+          for(U64 i = 1; i <= PER_PRODUCER; ++i) {
+            if(blocking)
+              queue.Put(i);
+            else
+              while(!queue.TryPut(i));
+          }
+        });
+        threads.emplace_back([&queue, &sum, blocking] {
+          U64 local = 0;
+          for(U64 i = 0; i < PER_PRODUCER; ++i) {
+            U64 element = 0;
+            if(blocking)
+              element = queue.Get();
+            else
+              while(!queue.TryGet(element));
+            local += element;
+          }
+          sum.FetchAdd(local);
+        });
+      }
+
+      for(auto& thread : threads)
+        thread.join();
+
+      REQUIRE(sum.Load() == THREADS * PER_PRODUCER * (PER_PRODUCER + 1) / 2);
+      REQUIRE(queue.IsEmpty());
+    }
+  }
+}
@@ -0,0 +1,82 @@
+/**
+* @file ReadWriteLock.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "os/Atomic.hpp"
+#include "os/ReadWriteLock.hpp"
+#include "os/ScopeGuard.hpp"
+
+TEST_CASE("ReadWriteLock functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("sharing and excluding accesses") {
+    ReadWriteLock lock{};
+    {
+      ScopeRead first{&lock};
+      ScopeRead second{&lock};
+      std::thread other{[&] { ScopeRead third{&lock}; }};
+      other.join();
+    }
+    {
+      ScopeWrite write{&lock};
+    }
+  }
+
+  SECTION("trying to start accesses") {
+    ReadWriteLock lock{};
+    REQUIRE(lock.TryStartRead());
+    REQUIRE(lock.TryStartRead());
+    REQUIRE_FALSE(lock.TryStartWrite());
+    lock.EndRead();
+    lock.EndRead();
+
+    REQUIRE(lock.TryStartWrite());
+    REQUIRE_FALSE(lock.TryStartRead());
+    REQUIRE_FALSE(lock.TryStartWrite());
+    lock.EndWrite();
+    REQUIRE(lock.TryStartRead());
+    lock.EndRead();
+  }
+
+  SECTION("reading consistent data while writing") {
+    constexpr int READERS = 3;
+    constexpr int ITERATIONS = 5000;
+
+    ReadWriteLock lock{};
+    int first = 0;
+    int second = 0;
+    Atomic<int> torn{0};
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([&] {
+      for(int i = 0; i < ITERATIONS; ++i) {
+        ScopeWrite write{&lock};
+        ++first;
+        ++second;
+      }
+    });
+    for(int t = 0; t < READERS; ++t) {
+      threads.emplace_back([&] {
+        for(int i = 0; i < ITERATIONS; ++i) {
+          ScopeRead read{&lock};
+          if(first != second)
+            torn.FetchAdd(1);
+        }
+      });
+    }
+    for(auto& thread : threads)
+      thread.join();
+
+    REQUIRE(first == ITERATIONS);
+    REQUIRE(second == ITERATIONS);
+    REQUIRE(torn.Load() == 0);
+  }
+}
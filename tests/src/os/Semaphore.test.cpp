@@ -0,0 +1,44 @@
+/**
+* @file Semaphore.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "os/Semaphore.hpp"
+
+TEST_CASE("Semaphore functionality validation", "[os]") {
+  using namespace ntl;
+  using namespace std::chrono_literals;
+
+  SECTION("posting and waiting") {
+    Semaphore semaphore{false, 1};
+    REQUIRE(semaphore.GetValue() == 1);
+    REQUIRE(semaphore.TryWait());
+    REQUIRE_FALSE(semaphore.TryWait());
+
+    REQUIRE(semaphore.Post());
+    REQUIRE(semaphore.Wait());
+    REQUIRE(semaphore.GetValue() == 0);
+  }
+
+  SECTION("waiting with a timeout") {
+    Semaphore semaphore{false, 0};
+    const auto start = std::chrono::steady_clock::now();
+    REQUIRE_FALSE(semaphore.WaitFor(20ms));
+    REQUIRE(std::chrono::steady_clock::now() - start >= 20ms);
+
+    bool acquired = false;
+    std::thread waiter{[&] { acquired = semaphore.WaitFor(10s); }};
+    std::this_thread::sleep_for(10ms);
+    semaphore.Post();
+    waiter.join();
+    REQUIRE(acquired);
+  }
+}
@@ -0,0 +1,105 @@
+/**
+* @file SnapshotCell.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "data/PersistentMap.hpp"
+#include "os/Atomic.hpp"
+#include "os/SnapshotCell.hpp"
+
+TEST_CASE("SnapshotCell functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("loading and publishing") {
+    SnapshotCell<int> cell{1};
+    const Snapshot<int> first = cell.Load();
+    REQUIRE(*first == 1);
+
+    cell.Publish(2);
+    const Snapshot<int> second = cell.Load();
+    REQUIRE(*first == 1);
+    REQUIRE(*second == 2);
+    REQUIRE_FALSE(first == second);
+    REQUIRE(cell.Load() == second);
+  }
+
+  SECTION("comparing and publishing") {
+    SnapshotCell<int> cell{1};
+    const Snapshot<int> stale = cell.Load();
+    REQUIRE(cell.CompareAndPublish(stale, 2));
+    REQUIRE_FALSE(cell.CompareAndPublish(stale, 3));
+    REQUIRE(cell.Load().Get() == 2);
+  }
+
+  SECTION("snapshots outlive replaced versions") {
+    SnapshotCell<PersistentMap<int, int>> cell{};
+    std::vector<Snapshot<PersistentMap<int, int>>> snapshots;
+
+    for(int i = 0; i < 100; ++i) {
+      PersistentMap<int, int> next = cell.Load().Get();
+      next.Insert(i, i);
+      cell.Publish(std::move(next));
+      snapshots.push_back(cell.Load());
+    }
+
+    for(int i = 0; i < 100; ++i) {
+      REQUIRE(snapshots[i]->GetSize() == static_cast<Size>(i + 1));
+      REQUIRE(snapshots[i]->Get(i) == i);
+    }
+  }
+
+  SECTION("readers see complete versions while writers publish") {
+    SnapshotCell<PersistentMap<int, int>> cell{};
+    Atomic<bool> done{false};
+    Atomic<int> errors{0};
+
+    // every version holds the keys 0 to n - 1 with the value n
+    std::vector<std::thread> readers;
+    for(int t = 0; t < 4; ++t) {
+      readers.emplace_back([&] {
+        while(!done.Load()) {
+          const auto snapshot = cell.Load();
+          const auto size = static_cast<int>(snapshot->GetSize());
+          for(int key = 0; key < size; key += 7) {
+            const int* value = snapshot->TryGet(key);
+            if(!value || *value != size)
+              errors.FetchAdd(1);
+          }
+        }
+      });
+    }
+
+    std::vector<std::thread> writers;
+    for(int t = 0; t < 2; ++t) {
+      writers.emplace_back([&] {
+        for(int i = 0; i < 300; ++i) {
+          while(true) {
+            const auto current = cell.Load();
+            PersistentMap<int, int> next = current.Get();
+            const auto size = static_cast<int>(next.GetSize());
+            for(int key = 0; key <= size; ++key)
+              next.Insert(key, size + 1);
+            if(cell.CompareAndPublish(current, std::move(next)))
+              break;
+          }
+        }
+      });
+    }
+
+    for(auto& writer : writers)
+      writer.join();
+    done.Store(true);
+    for(auto& reader : readers)
+      reader.join();
+
+    REQUIRE(errors.Load() == 0);
+    REQUIRE(cell.Load()->GetSize() == 600);
+  }
+}
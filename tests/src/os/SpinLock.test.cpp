@@ -0,0 +1,54 @@
+/**
+* @file SpinLock.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "os/SpinLock.hpp"
+#include "os/ScopeGuard.hpp"
+
+TEST_CASE("SpinLock functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("acquiring and releasing the lock") {
+    SpinLock lock{};
+    REQUIRE(lock.TryAcquire());
+    REQUIRE_FALSE(lock.TryAcquire());
+    lock.Release();
+
+    {
+      ScopeGuard guard{&lock};
+      REQUIRE_FALSE(lock.TryAcquire());
+    }
+    REQUIRE(lock.TryAcquire());
+    lock.Release();
+  }
+
+  SECTION("excluding multiple threads") {
+    constexpr int THREADS = 4;
+    constexpr int ITERATIONS = 20000;
+
+    SpinLock lock{};
+    int counter = 0;
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < THREADS; ++t) {
+      threads.emplace_back([&] {
+        for(int i = 0; i < ITERATIONS; ++i) {
+          ScopeGuard guard{&lock};
+          ++counter;
+        }
+      });
+    }
+    for(auto& thread : threads)
+      thread.join();
+
+    REQUIRE(counter == THREADS * ITERATIONS);
+  }
+}
@@ -0,0 +1,85 @@
+/**
+* @file SpscQueue.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+#include "data/String.hpp"
+#include "os/SpscQueue.hpp"
+
+TEST_CASE("SpscQueue functionality validation", "[os]") {
+  using namespace ntl;
+
+  SECTION("constructing new queue") {
+    SpscQueue<int> queue{10};
+    REQUIRE(queue.GetCapacity() == 16);
+    REQUIRE(queue.GetSize() == 0);
+    REQUIRE(queue.IsEmpty());
+  }
+
+  SECTION("putting and getting until full and empty") {
+    SpscQueue<int> queue{4};
+    for(int i = 0; i < 4; ++i)
+      REQUIRE(queue.TryPut(i));
+    REQUIRE_FALSE(queue.TryPut(4));
+    REQUIRE(queue.GetSize() == 4);
+
+    int element = -1;
+    for(int i = 0; i < 4; ++i) {
+      REQUIRE(queue.TryGet(element));
+      REQUIRE(element == i);
+    }
+    REQUIRE_FALSE(queue.TryGet(element));
+
+    // wraps around the buffer
+    REQUIRE(queue.TryEmplace(5));
+    queue.Put(6);
+    REQUIRE(queue.Get() == 5);
+    REQUIRE(queue.Get() == 6);
+  }
+
+  SECTION("keeping the remaining elements alive") {
+    SpscQueue<String> queue{2};
+    String element{"first"};
+    REQUIRE(queue.TryPut(element));
+    REQUIRE(queue.TryPut(String{"second"}));
+    REQUIRE_FALSE(queue.TryPut(std::move(element)));
+    REQUIRE(element == "first");
+    REQUIRE(queue.Get() == "first");
+  }
+
+  SECTION("passing elements between threads in order") {
+    constexpr int COUNT = 200000;
+    SpscQueue<int> queue{64};
+
+    std::thread producer{[&queue] {
+      for(int i = 0; i < COUNT; ++i)
+        queue.Put(i);
+    }};
+
+    bool ordered = true;
+    for(int i = 0; i < COUNT; ++i)
+      ordered &= queue.Get() == i;
+    producer.join();
+
+    std::thread spinning{[&queue] {
+      for(int i = 0; i < COUNT; ++i)
+        while(!queue.TryPut(i));
+    }};
+
+    for(int i = 0; i < COUNT; ++i) {
+      int element = -1;
+      while(!queue.TryGet(element));
+      ordered &= element == i;
+    }
+    spinning.join();
+
+    REQUIRE(ordered);
+    REQUIRE(queue.IsEmpty());
+  }
+}
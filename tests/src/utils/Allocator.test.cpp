@@ -0,0 +1,215 @@
+/**
+* @file Allocator.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <thread>
+
+#include "data/Array.hpp"
+#include "data/Bitset.hpp"
+#include "data/List.hpp"
+#include "data/Map.hpp"
+#include "data/Queue.hpp"
+#include "data/Stack.hpp"
+#include "utils/Allocator.hpp"
+
+TEST_CASE("Allocator functionality validation", "[utils]") {
+  using namespace ntl;
+
+  SECTION("pool allocator reuses freed blocks") {
+    PoolAllocator pool{};
+    void* first = pool.Allocate(24, alignof(U64));
+    pool.Deallocate(first, 24, alignof(U64));
+
+    // the same size class is served from the free list of the thread
+    void* second = pool.Allocate(32, alignof(U64));
+    REQUIRE(second == first);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(second) % PoolAllocator::GRANULARITY == 0);
+    pool.Deallocate(second, 32, alignof(U64));
+
+    void* big = pool.Allocate(PoolAllocator::MAX_BLOCK_SIZE + 1, alignof(U64));
+    REQUIRE(big != nullptr);
+    pool.Deallocate(big, PoolAllocator::MAX_BLOCK_SIZE + 1, alignof(U64));
+  }
+
+  SECTION("pool allocator hands out distinct blocks") {
+    PoolAllocator pool{};
+    Array<U64*> blocks(10000);
+    for(Size i = 0; i < 10000; ++i) {
+      auto* block = static_cast<U64*>(pool.Allocate(sizeof(U64), alignof(U64)));
+      *block = i;
+      blocks.Insert(block);
+    }
+
+    for(Size i = 0; i < 10000; ++i)
+      REQUIRE(*blocks[i] == i);
+
+    for(U64* block : blocks)
+      pool.Deallocate(block, sizeof(U64), alignof(U64));
+  }
+
+  SECTION("pool allocator works across threads") {
+    List<int, PoolAllocator> list{};
+
+    std::thread producer{[&list] {
+      for(int i = 0; i < 1000; ++i)
+        list.InsertBack(i);
+    }};
+    producer.join();
+
+    // the nodes were allocated by an exited thread and are freed here
+    REQUIRE(list.GetSize() == 1000);
+    REQUIRE(list.RemoveFront() == 0);
+    list.Clear();
+    REQUIRE(list.IsEmpty());
+  }
+
+  SECTION("arena hands out aligned memory and resets") {
+    Arena arena{256};
+    void* first = arena.Allocate(3, 1);
+    void* second = arena.Allocate(8, 64);
+
+    REQUIRE(reinterpret_cast<std::uintptr_t>(second) % 64 == 0);
+    REQUIRE(static_cast<char*>(second) >= static_cast<char*>(first) + 3);
+    REQUIRE(arena.GetAllocatedSize() == 11);
+
+    // bigger than the current block
+    void* big = arena.Allocate(4096, 16);
+    REQUIRE(big != nullptr);
+
+    // only the most recent allocation is given back
+    arena.Deallocate(second, 8);
+    REQUIRE(arena.GetAllocatedSize() == 4107);
+    arena.Deallocate(big, 4096);
+    REQUIRE(arena.GetAllocatedSize() == 11);
+
+    arena.Reset();
+    REQUIRE(arena.GetAllocatedSize() == 0);
+    REQUIRE(arena.Allocate(16, 16) != nullptr);
+  }
+
+  SECTION("list, queue and stack with pool allocator") {
+    List<int, PoolAllocator> list{};
+    list.InsertFront(2);
+    list.InsertFront(4);
+    list.InsertFront(8);
+    REQUIRE(list.ToString() == String{"List(8, 4, 2)\n"});
+
+    List<int, PoolAllocator> copy(list);
+    copy.RemoveElement(4);
+    REQUIRE(copy.GetSize() == 2);
+    REQUIRE(list.GetSize() == 3);
+
+    Queue<String, PoolAllocator> queue{};
+    queue.Put(String{"first"});
+    queue.Put(String{"second"});
+    REQUIRE(queue.Get() == String{"first"});
+    REQUIRE(queue.GetSize() == 1);
+
+    Stack<int, PoolAllocator> stack{};
+    stack.Push(1);
+    stack.Push(2);
+    REQUIRE(stack.Pop() == 2);
+    REQUIRE(stack.Pop() == 1);
+  }
+
+  SECTION("containers with arena allocator") {
+    Arena arena{};
+    ArenaAllocator allocator{arena};
+
+    List<int, ArenaAllocator> list{allocator};
+    for(int i = 0; i < 100; ++i)
+      list.InsertBack(i);
+    REQUIRE(list.GetSize() == 100);
+    REQUIRE(list.GetAllocator() == allocator);
+
+    Array<int, ArenaAllocator> array(4, false, true, allocator);
+    for(int i = 0; i < 100; ++i)
+      array.Insert(i);
+    REQUIRE(array.GetSize() == 100);
+    REQUIRE(array[99] == 99);
+
+    Array<int, ArenaAllocator> copy(array);
+    REQUIRE(copy.GetAllocator() == allocator);
+    REQUIRE(copy.IsEqual(array));
+
+    Map<int, int, hash::Hasher<int>, false, ArenaAllocator> map(4, algorithms::Hash::FNV1a, 0.7, true, allocator);
+    for(int i = 0; i < 100; ++i)
+      map.Insert(i, i * 2);
+    REQUIRE(map.GetSize() == 100);
+    REQUIRE(map[42] == 84);
+
+    PackedBitset<256, ArenaAllocator> bits{allocator};
+    bits.Set(200);
+    REQUIRE(bits.IsSet(200));
+    REQUIRE(bits.GetCount() == 1);
+
+    REQUIRE(arena.GetAllocatedSize() > 0);
+  }
+
+  SECTION("large page allocator maps big blocks") {
+    for(const PageSize pages : {PageSize::SMALL, PageSize::TRANSPARENT, PageSize::HUGE_2MB, PageSize::HUGE_1GB}) {
+      LargePageAllocator allocator{LargePagePolicy{.pages = pages, .threshold = 1 << 20}};
+      REQUIRE(allocator.GetPolicy().pages == pages);
+
+      // blocks below the threshold come from the default allocator
+      void* small = allocator.Allocate(64, 16);
+      REQUIRE(reinterpret_cast<std::uintptr_t>(small) % 16 == 0);
+      allocator.Deallocate(small, 64, 16);
+
+      constexpr Size SIZE = memory::PARALLEL_TOUCH_SIZE + 12345;
+      auto* block = static_cast<unsigned char*>(allocator.Allocate(SIZE, 64));
+      REQUIRE(block != nullptr);
+      REQUIRE(reinterpret_cast<std::uintptr_t>(block) % 4096 == 0);
+      if(pages == PageSize::TRANSPARENT)
+        REQUIRE(reinterpret_cast<std::uintptr_t>(block) % (2 << 20) == 0);
+
+      // the pages were touched already but are still zeroed
+      REQUIRE(block[0] == 0);
+      REQUIRE(block[SIZE - 1] == 0);
+      for(Size i = 0; i < SIZE; i += 4096)
+        block[i] = static_cast<unsigned char>(i / 4096);
+      REQUIRE(block[4096 * 7] == 7);
+      allocator.Deallocate(block, SIZE, 64);
+    }
+  }
+
+  SECTION("large page allocator applies numa policies") {
+    for(const NumaPolicy numa : {NumaPolicy::LOCAL, NumaPolicy::BIND, NumaPolicy::INTERLEAVE}) {
+      LargePageAllocator allocator{LargePagePolicy{.numa = numa, .nodes = 1, .parallel_touch = false}};
+      auto* block = static_cast<int*>(allocator.Allocate(4 << 20, alignof(int)));
+      block[0] = 1;
+      block[(4 << 20) / sizeof(int) - 1] = 2;
+      REQUIRE(block[0] + block[(4 << 20) / sizeof(int) - 1] == 3);
+      allocator.Deallocate(block, 4 << 20, alignof(int));
+    }
+  }
+
+  SECTION("containers with large page allocator") {
+    LargePageAllocator allocator{LargePagePolicy{.threshold = 1 << 16}};
+
+    Array<U64, LargePageAllocator> array(1 << 16, false, true, allocator);
+    for(U64 i = 0; i < (1 << 17); ++i)
+      array.Insert(i);
+    REQUIRE(array.GetSize() == (1 << 17));
+    REQUIRE(array[(1 << 17) - 1] == (1 << 17) - 1);
+
+    // a table big enough to be initialized and cleared by the pool
+    Map<U64, U64, hash::Hasher<U64>, false, LargePageAllocator> map(1 << 21, algorithms::Hash::FNV1a, 0.7, true, allocator);
+    for(U64 i = 0; i < 100000; ++i)
+      map.Insert(i, i * 2);
+    REQUIRE(map.GetSize() == 100000);
+    REQUIRE(map[4242] == 8484);
+
+    map.Clear();
+    REQUIRE(map.GetSize() == 0);
+    REQUIRE_FALSE(map.Exists(4242));
+    map.Insert(7, 8);
+    REQUIRE(map[7] == 8);
+  }
+}
@@ -0,0 +1,34 @@
+/**
+* @file CacheAligned.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include "core/Platform.hpp"
+#include "data/String.hpp"
+#include "utils/CacheAligned.hpp"
+
+TEST_CASE("CacheAligned functionality validation", "[utils]") {
+  using namespace ntl;
+
+  SECTION("aligning and padding values") {
+    STATIC_REQUIRE(alignof(CacheAligned<char>) == NTL_CACHE_LINE_SIZE);
+    STATIC_REQUIRE(sizeof(CacheAligned<char>) == NTL_CACHE_LINE_SIZE);
+    STATIC_REQUIRE(sizeof(CacheAligned<char[NTL_CACHE_LINE_SIZE + 1]>) == 2 * NTL_CACHE_LINE_SIZE);
+
+    CacheAligned<int> values[3]{};
+    *values[1] = 3;
+    REQUIRE(*values[0] == 0);
+    REQUIRE(values[1].value == 3);
+    REQUIRE(reinterpret_cast<Size>(&values[2]) % NTL_CACHE_LINE_SIZE == 0);
+  }
+
+  SECTION("constructing the value in place") {
+    const CacheAligned<String> text{"aligned"};
+    REQUIRE(*text == "aligned");
+    REQUIRE(text->GetSize() == 7);
+  }
+}
@@ -0,0 +1,127 @@
+/**
+* @file Profile.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+#include "data/Array.hpp"
+#include "data/List.hpp"
+#include "data/Map.hpp"
+#include "data/String.hpp"
+#include "os/Lock.hpp"
+#include "os/SharedLock.hpp"
+#include "utils/Profile.hpp"
+
+TEST_CASE("Profile functionality validation", "[utils]") {
+  using namespace ntl;
+
+#if NTL_PROFILE
+  SECTION("counting map lookups and resizes") {
+    Map<int, int> map(16);
+    profile::Reset();
+
+    for(int i = 0; i < 100; ++i)
+      map.Insert(i, i);
+    for(int i = 0; i < 200; ++i)
+      static_cast<void>(map.Exists(i));
+
+    const auto statistics = profile::GetStatistics();
+    REQUIRE(statistics.map.resizes >= 3);
+    REQUIRE(statistics.map.max_cluster > 0);
+    REQUIRE(statistics.map.lookups >= 200);
+
+    U64 probes = 0;
+    for(const U64 bucket : statistics.map.probes)
+      probes += bucket;
+    REQUIRE(probes == statistics.map.lookups);
+  }
+
+  SECTION("counting array resizes and moves") {
+    Array<int> array(4, false, true);
+    profile::Reset();
+
+    for(int i = 0; i < 8; ++i)
+      array.Insert(i);
+    array.Insert(-1, 0);
+    array.Remove(0);
+    array.Sort();
+
+    const auto statistics = profile::GetStatistics();
+    REQUIRE(statistics.array.resizes == 2);
+    // 4 relocated on growing, 8 shifted on inserting at the front and 8 on removing it again
+    REQUIRE(statistics.array.moves == 4 + 8 + 8 + 8);
+    REQUIRE(statistics.array.sorted == 8);
+  }
+
+  SECTION("counting string allocations and list nodes") {
+    profile::Reset();
+
+    String string{};
+    for(int i = 0; i < 100; ++i)
+      string.Append("0123456789");
+
+    List<int> list{};
+    for(int i = 0; i < 10; ++i)
+      list.InsertBack(i);
+
+    const auto statistics = profile::GetStatistics();
+    REQUIRE(statistics.string.allocations > 0);
+    REQUIRE(statistics.string.allocations < 100);
+    REQUIRE(statistics.string.copied_bytes >= 1000);
+    REQUIRE(statistics.list.allocations == 10);
+  }
+
+  SECTION("counting lock contention") {
+    Lock lock{};
+    SharedLock shared{};
+    profile::Reset();
+
+    lock.Acquire();
+    std::thread waiter([&lock] {
+      lock.Acquire();
+      lock.Release();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    lock.Release();
+    waiter.join();
+
+    shared.StartRead();
+    shared.EndRead();
+    shared.StartWrite();
+    shared.EndWrite();
+
+    const auto statistics = profile::GetStatistics();
+    REQUIRE(statistics.lock.acquisitions == 2);
+    REQUIRE(statistics.lock.contentions == 1);
+    REQUIRE(statistics.lock.wait_nanoseconds > 0);
+    REQUIRE(statistics.shared_read.acquisitions == 1);
+    REQUIRE(statistics.shared_write.acquisitions == 1);
+    REQUIRE(statistics.shared_write.contentions == 0);
+  }
+
+  SECTION("dumping and resetting the counters") {
+    List<int> list{};
+    list.InsertBack(1);
+
+    const String dump = profile::ToString(profile::GetStatistics());
+    REQUIRE(dump.Contains("Map: lookups="));
+    REQUIRE(dump.Contains("List: allocations="));
+    REQUIRE(dump.Contains("SharedLock (write): acquisitions="));
+
+    profile::Reset();
+    REQUIRE(profile::GetStatistics().list.allocations == 0);
+  }
+#else
+  SECTION("recording nothing without profiling") {
+    List<int> list{};
+    list.InsertBack(1);
+
+    REQUIRE(profile::GetStatistics().list.allocations == 0);
+  }
+#endif
+}
@@ -0,0 +1,127 @@
+/**
+* @file Trace.test.cpp
+* @author Marcus Gugacs
+* @date 10/14/2026
+* @copyright Copyright (c) 2026 Marcus Gugacs. All rights reserved.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "data/Array.hpp"
+#include "data/Map.hpp"
+#include "data/String.hpp"
+#include "utils/Trace.hpp"
+
+namespace {
+  ntl::Size occurrences(const std::string& a_text, const std::string& a_pattern) {
+    ntl::Size count = 0;
+    for(ntl::Size at = a_text.find(a_pattern); at != std::string::npos; at = a_text.find(a_pattern, at + 1))
+      count++;
+    return count;
+  }
+
+  std::string flush() {
+    return ntl::trace::Flush().GetCString();
+  }
+}
+
+TEST_CASE("Trace functionality validation", "[utils]") {
+  using namespace ntl;
+
+  // drops the zones recorded by earlier tests
+  static_cast<void>(trace::Flush());
+
+  SECTION("flushing recorded zones as trace events") {
+    {
+      const trace::Zone outer{"outer"};
+      const trace::Zone inner{"inner \"quoted\""};
+    }
+
+    const std::string document = flush();
+    REQUIRE(document.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    REQUIRE(document.ends_with("]}\n"));
+    REQUIRE(occurrences(document, "{\"name\":\"outer\",\"cat\":\"ntl\",\"ph\":\"X\",\"ts\":") == 1);
+    REQUIRE(occurrences(document, "\"name\":\"inner \\\"quoted\\\"\"") == 1);
+
+    // flushing drains the buffers
+    REQUIRE(occurrences(flush(), "\"name\"") == 0);
+  }
+
+  SECTION("recording on many threads") {
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; ++t) {
+      threads.emplace_back([] {
+        for(int i = 0; i < 100; ++i)
+          const trace::Zone zone{"worker"};
+      });
+    }
+    for(auto& thread : threads)
+      thread.join();
+
+    const std::string document = flush();
+    REQUIRE(occurrences(document, "\"name\":\"worker\"") == 400);
+
+    // the buffers of the finished threads were freed by the flush
+    REQUIRE(occurrences(flush(), "\"name\"") == 0);
+  }
+
+  SECTION("dropping events of full buffers") {
+    const U64 dropped = trace::GetDroppedCount();
+    const U64 now = trace::Now();
+    for(Size i = 0; i < trace::BUFFER_CAPACITY + 10; ++i)
+      trace::Record("burst", now, now + 1);
+
+    REQUIRE(trace::GetDroppedCount() == dropped + 10);
+    REQUIRE(occurrences(flush(), "\"name\":\"burst\"") == trace::BUFFER_CAPACITY);
+  }
+
+#if NTL_PROFILE
+  SECTION("placing the built-in zones") {
+    Array<int> array(4, false, true);
+    for(int i = 0; i < 100; ++i)
+      array.Insert(100 - i);
+    array.Sort();
+
+    Map<int, int> map(2);
+    for(int i = 0; i < 100; ++i)
+      map.Insert(i, i);
+
+    String string{"a-b-c"};
+    string.ReplaceAll("-", "+");
+
+    {
+      NTL_PROFILE_SCOPE("scope");
+    }
+
+    const std::string document = flush();
+    REQUIRE(occurrences(document, "\"name\":\"Array::Sort\"") == 1);
+    REQUIRE(occurrences(document, "\"name\":\"Map::Resize\"") > 1);
+    REQUIRE(occurrences(document, "\"name\":\"String::ReplaceAll\"") == 1);
+    REQUIRE(occurrences(document, "\"name\":\"scope\"") == 1);
+  }
+#endif
+
+  SECTION("writing a trace file") {
+    const std::string path = (std::filesystem::temp_directory_path() / "ntl_trace.json").string();
+    {
+      const trace::Zone zone{"file"};
+    }
+
+    REQUIRE(trace::Flush(StringView{path.c_str()}));
+
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    REQUIRE(occurrences(content.str(), "\"name\":\"file\"") == 1);
+
+    std::remove(path.c_str());
+  }
+}